@@ -0,0 +1,10 @@
+# Writes tensors as C++ headers for the step-by-step programs (src/mlp, src/conv). Each
+# tensor becomes an aligned constexpr std::array, so the compiler places it in .rodata
+# instead of building a std::vector on the heap before main; the programs read it
+# through views (quantnn::view_of in src/common/tensor.h).
+
+
+def cpp_array(name, values, ctype='float'):
+    values = list(values)
+    return 'alignas(64) constexpr std::array<{}, {}> {} = {{ {} }};'.format(
+        ctype, len(values), name, ','.join(str(x) for x in values))
@@ -0,0 +1,73 @@
+import struct
+
+# Writes the model bundle format read by src/engine/model_bundle.h:
+# a 16-byte header, one 88-byte entry per tensor, then the tensor data
+# with every tensor starting at a 64-byte aligned offset.
+
+MAGIC = 0x424e4e51  # "QNNB"
+VERSION = 1
+ALIGNMENT = 64
+MAX_NAME_LENGTH = 48
+MAX_DIMS = 4
+
+DTYPES = {
+    'f32': (0, 'f'),
+    's8': (1, 'b'),
+    'u8': (2, 'B'),
+    's32': (3, 'i'),
+    'f16': (4, 'e'),
+    'bf16': (5, 'H'),
+}
+
+
+def _bf16_bits(value):
+    """upper 16 bits of a float32, rounded to nearest even (float_to_bf16 in src/common/half.h)"""
+    bits = struct.unpack('<I', struct.pack('<f', value))[0]
+    if bits & 0x7fffffff > 0x7f800000:
+        return (bits >> 16) | 0x40
+    return ((bits + 0x7fff + ((bits >> 16) & 1)) >> 16) & 0xffff
+
+
+def _align(offset):
+    return (offset + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+
+
+def save_bundle(path, tensors):
+    """tensors: list of (name, dtype, shape, flat list of values)"""
+    entries = []
+    blobs = []
+    offset = _align(16 + 88 * len(tensors))
+    for name, dtype, shape, values in tensors:
+        assert len(name) < MAX_NAME_LENGTH and len(shape) <= MAX_DIMS
+        code, fmt = DTYPES[dtype]
+        if dtype == 'bf16':
+            values = [_bf16_bits(v) for v in values]
+        blob = struct.pack('<{}{}'.format(len(values), fmt), *values)
+        dims = list(shape) + [0] * (MAX_DIMS - len(shape))
+        entries.append(struct.pack('<48sII4IQQ', name.encode(), code, len(shape), *dims, offset, len(blob)))
+        blobs.append((offset, blob))
+        offset = _align(offset + len(blob))
+
+    with open(path, 'wb') as f:
+        f.write(struct.pack('<IIII', MAGIC, VERSION, len(tensors), 0))
+        for entry in entries:
+            f.write(entry)
+        for offset, blob in blobs:
+            f.write(b'\0' * (offset - f.tell()))
+            f.write(blob)
+
+
+def fp32_tensors(named_parameters, weight_dtype='f32'):
+    """(name, dtype, shape, values) tuples for the parameters of a torch module;
+    weight_dtype 'f16' or 'bf16' stores the *.weight tensors in 16 bits, biases stay f32"""
+    return [(name, weight_dtype if name.endswith('.weight') else 'f32', list(param.shape),
+             param.detach().flatten().tolist())
+            for name, param in named_parameters]
+
+
+def state_tensors(module):
+    """(name, dtype, shape, values) tuples for the parameters and BatchNorm statistics of a
+    torch module as trained, e.g. MobileOne blocks before reparameterize(); the C++ loader
+    folds their branches (src/engine/reparameterize.h)"""
+    return [(name, 'f32', list(t.shape), t.detach().flatten().tolist())
+            for name, t in module.state_dict().items() if t.is_floating_point()]
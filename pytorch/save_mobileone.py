@@ -19,7 +19,8 @@ def main():
     param_str_list = []
     for name, param in model.named_parameters():
         param_str = transform_param_to_str(param.flatten())
-        param_str = "const std::vector<float> {} = {{ {} }};\n".format(name.replace('.', '_'), param_str)
+        param_str = "alignas(64) constexpr std::array<float, {}> {} = {{ {} }};\n".format(
+            param.numel(), name.replace('.', '_'), param_str)
         param_str_list.append(param_str)
 
     with open('../src/mobileone/mobileone.h', 'w') as f:
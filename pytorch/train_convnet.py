@@ -1,14 +1,27 @@
+import argparse
+import os
 import torch
 import torch.nn as nn
 import torch.optim as optim
 from torch.utils.data import DataLoader
 from torchvision import transforms, datasets
 
+from cpp_header import cpp_array
+from mobileone import MobileOneBlock, SEBlock
+from model_bundle import save_bundle, fp32_tensors, state_tensors
+
 class MnistConvNet(nn.Module):
-    def __init__(self):
+    def __init__(self, branches=0, se=False):
         super().__init__()
 
-        self.conv1 = nn.Conv2d(1, 5, kernel_size=(3, 3), stride=(1, 1), padding=(1, 1))
+        if branches > 0:
+            # train-time MobileOne block: `branches` 3x3 conv-BN branches plus a 1x1 conv-BN branch
+            self.conv1 = MobileOneBlock(1, 5, kernel_size=3, stride=1, padding=1, num_conv_branches=branches)
+            if se:
+                # the default rd_ratio would leave no channel of 5
+                self.conv1.se = SEBlock(5, rd_ratio=0.4)
+        else:
+            self.conv1 = nn.Conv2d(1, 5, kernel_size=(3, 3), stride=(1, 1), padding=(1, 1))
         self.relu1 = nn.ReLU(inplace=True)
         self.fc1 = nn.Linear(5 * 28 * 28, 128)
         self.fc2 = nn.Linear(128, 10)
@@ -63,8 +76,17 @@ def evaluate(model, loader):
 
 
 def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--branches', type=int, default=0,
+                        help='train conv1 as a MobileOne block and save it un-reparameterized')
+    parser.add_argument('--se', action='store_true',
+                        help='add a squeeze-excitation to the MobileOne conv1 (with --branches)')
+    args = parser.parse_args()
+    if args.se and args.branches == 0:
+        parser.error('--se needs --branches')
+
     train_loader, test_loader = get_loaders()
-    model = MnistConvNet()
+    model = MnistConvNet(args.branches, args.se)
     optimizer = optim.Adam(model.parameters(), lr=1e-3)
 
     for epoch in range(5): # 5
@@ -72,28 +94,32 @@ def main():
         acc = evaluate(model, test_loader)
         print(f"Epoch {epoch+1} loss={loss:.4f} acc={acc*100:.2f}%")
 
+    if args.branches > 0:
+        # branches and BatchNorm statistics as trained; the engines fold them at load time
+        os.makedirs('../models', exist_ok=True)
+        save_bundle('../models/mnist_conv_branched.qnn', state_tensors(model))
+        return
+
     # save weight/bias as C++ float array
-    conv1_weight_str = ','.join([str(x) for x in model.conv1.weight.flatten().tolist()])
-    fc1_weight_str = ','.join([str(x) for x in model.fc1.weight.flatten().tolist()])
-    fc2_weight_str = ','.join([str(x) for x in model.fc2.weight.flatten().tolist()])
-    conv1_bias_str = ','.join([str(x) for x in model.conv1.bias.flatten().tolist()])
-    fc1_bias_str = ','.join([str(x) for x in model.fc1.bias.flatten().tolist()])
-    fc2_bias_str = ','.join([str(x) for x in model.fc2.bias.flatten().tolist()])
-
-    weight_const_str = (
-        "const std::vector<float> conv1_weight = {{ {} }};\n"
-        "const std::vector<float> conv1_bias = {{ {} }};\n"
-        "const std::vector<float> fc1_weight = {{ {} }};\n"
-        "const std::vector<float> fc1_bias = {{ {} }};\n"
-        "const std::vector<float> fc2_weight = {{ {} }};\n"
-        "const std::vector<float> fc2_bias = {{ {} }};"
-    ).format(conv1_weight_str, conv1_bias_str, 
-             fc1_weight_str, fc1_bias_str,
-             fc2_weight_str, fc2_bias_str)
+    weight_const_str = '\n'.join([
+        cpp_array('conv1_weight', model.conv1.weight.flatten().tolist()),
+        cpp_array('conv1_bias', model.conv1.bias.flatten().tolist()),
+        cpp_array('fc1_weight', model.fc1.weight.flatten().tolist()),
+        cpp_array('fc1_bias', model.fc1.bias.flatten().tolist()),
+        cpp_array('fc2_weight', model.fc2.weight.flatten().tolist()),
+        cpp_array('fc2_bias', model.fc2.bias.flatten().tolist()),
+    ])
 
     with open('../src/conv/fp32/mnist_conv.h', 'w') as f:
         f.write(weight_const_str)
 
+    # save weight/bias as a model bundle for the runtime engines (src/engine)
+    os.makedirs('../models', exist_ok=True)
+    save_bundle('../models/mnist_conv_fp32.qnn', fp32_tensors(model.named_parameters()))
+    for weight_dtype in ('f16', 'bf16'):
+        save_bundle('../models/mnist_conv_{}.qnn'.format(weight_dtype),
+                    fp32_tensors(model.named_parameters(), weight_dtype))
+
 
 if __name__ == "__main__":
     main()
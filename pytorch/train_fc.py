@@ -1,9 +1,13 @@
+import os
 import torch
 import torch.nn as nn
 import torch.optim as optim
 from torch.utils.data import DataLoader
 from torchvision import transforms, datasets
 
+from cpp_header import cpp_array
+from model_bundle import save_bundle, fp32_tensors
+
 class MnistFC(nn.Module):
     def __init__(self):
         super().__init__()
@@ -73,32 +77,27 @@ def main():
         print(f"Epoch {epoch+1} loss={loss:.4f} acc={acc*100:.2f}%")
 
     # save weight/bias as C++ float array
-    fc1_weights = model.fc1.weight.flatten().tolist()
-    fc2_weights = model.fc2.weight.flatten().tolist()
-
-    fc1_bias = model.fc1.bias.tolist()
-    fc2_bias = model.fc2.bias.tolist()
-    
-    fc1_weight_str = ','.join([str(x) for x in fc1_weights])
-    fc2_weight_str = ','.join([str(x) for x in fc2_weights])
-    fc1_bias_str = ','.join([str(x) for x in fc1_bias])
-    fc2_bias_str = ','.join([str(x) for x in fc2_bias])
-
-    weight_const_str = (
-        "const std::vector<float> fc1_weight = {{ {} }};\n"
-        "const std::vector<float> fc1_bias = {{ {} }};\n"
-        "const std::vector<float> fc2_weight = {{ {} }};\n"
-        "const std::vector<float> fc2_bias = {{ {} }};"
-    ).format(fc1_weight_str, fc1_bias_str, fc2_weight_str, fc2_bias_str)
+    weight_const_str = '\n'.join([
+        cpp_array('fc1_weight', model.fc1.weight.flatten().tolist()),
+        cpp_array('fc1_bias', model.fc1.bias.tolist()),
+        cpp_array('fc2_weight', model.fc2.weight.flatten().tolist()),
+        cpp_array('fc2_bias', model.fc2.bias.tolist()),
+    ])
     with open('../src/mnist_fc.h', 'w') as f:
         f.write(weight_const_str)
 
+    # save weight/bias as a model bundle for the runtime engines (src/engine)
+    os.makedirs('../models', exist_ok=True)
+    save_bundle('../models/mnist_fc_fp32.qnn', fp32_tensors(model.named_parameters()))
+    for weight_dtype in ('f16', 'bf16'):
+        save_bundle('../models/mnist_fc_{}.qnn'.format(weight_dtype),
+                    fp32_tensors(model.named_parameters(), weight_dtype))
+
     # save sample data as data
     data = test_loader.dataset[0][0].flatten().tolist()
     label = test_loader.dataset[0][1]
 
-    data_str = ','.join([str(x) for x in data])
-    data_const_str = "const std::vector<float> data = {{ {} }};\n".format(data_str)
+    data_const_str = cpp_array('data', data) + '\n'
     with open('../src/data_{}.h'.format(label), 'w') as f:
         f.write(data_const_str)
 
@@ -0,0 +1,503 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/bench.h"
+#include "common/cpu_features.h"
+#include "common/half.h"
+#include "common/thread_pool.h"
+
+#include "kernels/activation.h"
+#include "kernels/conv.h"
+#include "kernels/conv2d.h"
+#include "kernels/dispatch.h"
+#include "kernels/linear.h"
+#include "kernels/quantize.h"
+#include "kernels/se.h"
+#include "kernels/tuning.h"
+
+// Kernel-level microbenchmarks for the layers of the MNIST networks.
+//
+// Every kernel is timed in isolation with three numbers:
+//   first : the very first call on freshly written buffers (no warm-up)
+//   hot   : repeated calls on the same buffers after warm-up (cache-hot)
+//   cold  : calls after warm-up, with the data caches flushed before each one
+// Throughput is reported as GOP/s (one multiply-add = 2 ops, one element = 1 op
+// for the element-wise kernels) and effective GB/s over the bytes each call
+// must read and write. Every kernel is run for each ISA tier the CPU supports
+// (or the ones given with --isa), shown in the impl column. With --threads N the
+// conv and linear kernels split their output rows across N threads of the intra-op pool.
+// The tuning cache (kernels/tuning.h) is not applied; src/tools/autotune.cpp tunes it.
+
+struct KernelCase
+{
+    std::string kernel;
+    std::string shape;
+    std::string dtype;
+    double ops;
+    double bytes;
+    std::function<void()> run;
+};
+
+struct Options
+{
+    int reps = 200;
+    int warmup = 10;
+    int threads = 1;
+    std::vector<quantnn::Isa> isas;
+    std::string filter;
+    bool csv = false;
+};
+
+template <typename T>
+std::shared_ptr<std::vector<T>> random_buffer(size_t n, double lo, double hi, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(lo, hi);
+    auto buffer = std::make_shared<std::vector<T>>(n);
+    for (T & v : *buffer)
+    {
+        v = static_cast<T>(dist(rng));
+    }
+    return buffer;
+}
+
+std::vector<KernelCase> build_cases()
+{
+    std::vector<KernelCase> cases;
+
+    const int image_size = 28;
+    const int conv_out_c = 5;
+    const int conv_out_size = conv_out_c * image_size * image_size;
+    const int fc1_in = conv_out_size;
+    const int fc1_out = 128;
+    const int fc2_in = 128;
+    const int fc2_out = 10;
+
+    // quantize / requantize
+    {
+        const int n = image_size * image_size;
+        auto x = random_buffer<float>(n, -3, 3, 2);
+        auto q = std::make_shared<std::vector<int8_t>>(n);
+        cases.push_back({ "quantize", std::to_string(n), "fp32->s8", 2.0 * n, 5.0 * n,
+                          [=] {
+                              float s = quantnn::absmax_f32(x->data(), n) / 127.0f;
+                              quantnn::quantize_s8(x->data(), n, s, q->data());
+                          } });
+    }
+    {
+        const int n = fc1_out;
+        auto x = random_buffer<float>(n, 0, 6, 3);
+        auto q = std::make_shared<std::vector<uint8_t>>(n);
+        cases.push_back({ "quantize", std::to_string(n), "fp32->u8", 2.0 * n, 5.0 * n,
+                          [=] {
+                              float min_val, max_val;
+                              quantnn::minmax_f32(x->data(), n, min_val, max_val);
+                              float s = (max_val - min_val) / 255.0f;
+                              quantnn::quantize_u8(x->data(), n, s, static_cast<int>(std::round(-min_val / s)), q->data());
+                          } });
+    }
+    {
+        auto acc = random_buffer<int32_t>(conv_out_size, -20000, 20000, 4);
+        auto mult = random_buffer<float>(conv_out_c, 1e-5, 1e-4, 5);
+        auto bias = random_buffer<float>(conv_out_c, -0.1, 0.1, 6);
+        auto q = std::make_shared<std::vector<int8_t>>(conv_out_size);
+        cases.push_back({ "requantize", "5x784", "s32->s8", 1.0 * conv_out_size, 5.0 * conv_out_size,
+                          [=] {
+                              quantnn::requantize_s8(acc->data(), conv_out_c, image_size * image_size, mult->data(),
+                                                     bias->data(), 0.03f, q->data());
+                          } });
+    }
+
+    // conv1 3x3, 1 -> 5 channels, 28x28 with the zero border handled in the kernel
+    {
+        const double ops = 2.0 * conv_out_size * 9;
+        auto in = random_buffer<float>(image_size * image_size, -1, 1, 7);
+        auto w = random_buffer<float>(conv_out_c * 9, -1, 1, 8);
+        auto b = random_buffer<float>(conv_out_c, -1, 1, 9);
+        auto out = std::make_shared<std::vector<float>>(conv_out_size);
+        cases.push_back({ "conv1_3x3", "1x28x28->5x28x28", "fp32", ops,
+                          4.0 * (image_size * image_size + conv_out_c * 10 + conv_out_size),
+                          [=] { quantnn::conv3x3_f32(in->data(), 1, image_size, image_size, w->data(), b->data(), conv_out_c, out->data()); } });
+
+        auto qin = random_buffer<int8_t>(image_size * image_size, -127, 127, 10);
+        auto qw = random_buffer<int8_t>(conv_out_c * 9, -127, 127, 11);
+        auto acc = std::make_shared<std::vector<int32_t>>(conv_out_size);
+        cases.push_back({ "conv1_3x3", "1x28x28->5x28x28", "s8xs8", ops,
+                          1.0 * (image_size * image_size + conv_out_c * 9) + 4.0 * conv_out_size,
+                          [=] { quantnn::conv3x3_s8s8(qin->data(), 1, image_size, image_size, qw->data(), conv_out_c, acc->data()); } });
+
+        // the static engine's conv1: requantized per chunk of rows vs in a second pass
+        auto multiplier = random_buffer<float>(conv_out_c, 1e-3, 1e-2, 12);
+        auto qb = random_buffer<float>(conv_out_c, -1, 1, 13);
+        auto q = std::make_shared<std::vector<int8_t>>(conv_out_size);
+        cases.push_back({ "conv1_3x3", "1x28x28->5x28x28", "s8+rq", ops,
+                          1.0 * (image_size * image_size + conv_out_c * 9 + conv_out_size) + 8.0 * conv_out_size,
+                          [=] {
+                              quantnn::conv3x3_s8s8(qin->data(), 1, image_size, image_size, qw->data(), conv_out_c, acc->data());
+                              quantnn::requantize_s8(acc->data(), conv_out_c, image_size * image_size, multiplier->data(), qb->data(),
+                                                     0.05f, q->data());
+                          } });
+        cases.push_back({ "conv1_3x3", "1x28x28->5x28x28", "s8+rq-fused", ops,
+                          1.0 * (image_size * image_size + conv_out_c * 9 + conv_out_size),
+                          [=] {
+                              quantnn::conv3x3_s8s8_requantize(qin->data(), 1, image_size, image_size, 1, qw->data(), conv_out_c,
+                                                               multiplier->data(), qb->data(), 0.05f, acc->data(), q->data());
+                          } });
+
+        const int s2_size = (image_size - 1) / 2 + 1;
+        cases.push_back({ "conv1_3x3_s2", "1x28x28->5x14x14", "s8xs8", ops / 4,
+                          1.0 * (image_size * image_size + conv_out_c * 9) + 4.0 * conv_out_c * s2_size * s2_size,
+                          [=] { quantnn::conv3x3_s8s8_strided(qin->data(), 1, image_size, image_size, 2, qw->data(), conv_out_c, acc->data()); } });
+    }
+
+    // squeeze-excitation (2 reduced channels) on the conv1 output, before the ReLU:
+    // separate passes over the map (pool, scale, ReLU) vs fused into conv1 and the ReLU
+    {
+        const int hw = image_size * image_size;
+        const int reduced = 2;
+        const double ops = 2.0 * conv_out_size * 9 + 3.0 * conv_out_size;
+        auto in = random_buffer<float>(hw, -1, 1, 12);
+        auto w = random_buffer<float>(conv_out_c * 9, -1, 1, 13);
+        auto b = random_buffer<float>(conv_out_c, -1, 1, 14);
+        auto se_w = random_buffer<float>(2 * reduced * conv_out_c, -1, 1, 15);
+        auto se_b = random_buffer<float>(reduced + conv_out_c, -1, 1, 16);
+        auto out = std::make_shared<std::vector<float>>(conv_out_size);
+        auto row_sums = std::make_shared<std::vector<float>>(conv_out_c * image_size);
+        auto gate = std::make_shared<std::vector<float>>(2 * conv_out_c);
+        auto excite = [=] {
+            quantnn::se_gate(gate->data() + conv_out_c, conv_out_c, se_w->data(), se_b->data(), reduced,
+                             se_w->data() + reduced * conv_out_c, se_b->data() + reduced, gate->data());
+        };
+        cases.push_back({ "conv1_se", "1x28x28->5x28x28", "fp32", ops,
+                          4.0 * (hw + conv_out_c * 10 + 5.0 * conv_out_size),
+                          [=] {
+                              float * y = out->data();
+                              quantnn::conv3x3_f32(in->data(), 1, image_size, image_size, w->data(), b->data(), conv_out_c, y);
+                              for (int c = 0; c < conv_out_c; c++)
+                              {
+                                  float sum = 0.0f;
+                                  for (int i = 0; i < hw; i++)
+                                  {
+                                      sum += y[c * hw + i];
+                                  }
+                                  (*gate)[conv_out_c + c] = sum / hw;
+                              }
+                              excite();
+                              for (int i = 0; i < conv_out_size; i++)
+                              {
+                                  y[i] *= (*gate)[i / hw];
+                              }
+                              quantnn::relu_f32(y, conv_out_size);
+                          } });
+        cases.push_back({ "conv1_se", "1x28x28->5x28x28", "fp32-fused", ops,
+                          4.0 * (hw + conv_out_c * 10 + 2.0 * conv_out_size),
+                          [=] {
+                              quantnn::conv3x3_f32(in->data(), 1, image_size, image_size, w->data(), b->data(), conv_out_c,
+                                                   out->data(), row_sums->data());
+                              quantnn::channel_means_f32(row_sums->data(), conv_out_c, image_size, image_size, gate->data() + conv_out_c);
+                              excite();
+                              quantnn::relu_gate_f32(out->data(), conv_out_c, hw, gate->data());
+                          } });
+    }
+
+    // conv1 + ReLU + fc1: through the stored 5x28x28 map vs one channel tile at a time
+    // added into the fc1 accumulators (Engine::set_fuse_conv_fc1)
+    {
+        const int hw = image_size * image_size;
+        const double ops = 2.0 * conv_out_size * 9 + 2.0 * fc1_in * fc1_out;
+        auto in = random_buffer<float>(hw, -1, 1, 40);
+        auto w = random_buffer<float>(conv_out_c * 9, -1, 1, 41);
+        auto b = random_buffer<float>(conv_out_c, -1, 1, 42);
+        auto fw = random_buffer<float>(fc1_in * fc1_out, -1, 1, 43);
+        auto fb = random_buffer<float>(fc1_out, -1, 1, 44);
+        auto map = std::make_shared<std::vector<float>>(conv_out_size);
+        auto y = std::make_shared<std::vector<float>>(fc1_out);
+        cases.push_back({ "conv1_fc1", "1x28x28->128", "fp32", ops, 4.0 * (hw + fc1_in * fc1_out + 3.0 * conv_out_size + fc1_out),
+                          [=] {
+                              quantnn::conv3x3_f32(in->data(), 1, image_size, image_size, w->data(), b->data(), conv_out_c, map->data());
+                              quantnn::relu_f32(map->data(), conv_out_size);
+                              quantnn::linear_f32(map->data(), fw->data(), fb->data(), fc1_in, fc1_out, y->data());
+                          } });
+        cases.push_back({ "conv1_fc1", "1x28x28->128", "fp32-fused", ops, 4.0 * (hw + fc1_in * fc1_out + fc1_out),
+                          [=] {
+                              float * tile = map->data();
+                              std::copy(fb->begin(), fb->end(), y->begin());
+                              for (int c = 0; c < conv_out_c; c++)
+                              {
+                                  quantnn::conv3x3_f32(in->data(), 1, image_size, image_size, w->data() + c * 9, b->data() + c, 1, tile);
+                                  quantnn::relu_f32(tile, hw);
+                                  quantnn::linear_f32_accumulate(tile, fw->data() + c * hw, fc1_in, hw, fc1_out, y->data());
+                              }
+                          } });
+
+        auto qin = random_buffer<int8_t>(hw, -127, 127, 45);
+        auto qw = random_buffer<int8_t>(conv_out_c * 9, -127, 127, 46);
+        auto qfw = random_buffer<int8_t>(fc1_in * fc1_out, -127, 127, 47);
+        auto multiplier = random_buffer<float>(conv_out_c, 1e-3, 1e-2, 48);
+        auto conv_acc = std::make_shared<std::vector<int32_t>>(conv_out_size);
+        auto q = std::make_shared<std::vector<int8_t>>(conv_out_size);
+        auto acc = std::make_shared<std::vector<int32_t>>(fc1_out);
+        cases.push_back({ "conv1_fc1", "1x28x28->128", "s8xs8", ops, 1.0 * (hw + fc1_in * fc1_out + 3.0 * conv_out_size) + 4.0 * fc1_out,
+                          [=] {
+                              quantnn::conv3x3_s8s8_requantize(qin->data(), 1, image_size, image_size, 1, qw->data(), conv_out_c,
+                                                               multiplier->data(), b->data(), 0.05f, conv_acc->data(), q->data());
+                              quantnn::relu_s8(q->data(), conv_out_size);
+                              quantnn::linear_s8s8(q->data(), qfw->data(), fc1_in, fc1_out, acc->data());
+                          } });
+        cases.push_back({ "conv1_fc1", "1x28x28->128", "s8xs8-fused", ops, 1.0 * (hw + fc1_in * fc1_out) + 4.0 * fc1_out,
+                          [=] {
+                              std::fill(acc->begin(), acc->end(), 0);
+                              for (int c = 0; c < conv_out_c; c++)
+                              {
+                                  quantnn::conv3x3_s8s8_requantize(qin->data(), 1, image_size, image_size, 1, qw->data() + c * 9, 1,
+                                                                   multiplier->data() + c, b->data() + c, 0.05f, conv_acc->data(), q->data());
+                                  quantnn::relu_s8(q->data(), hw);
+                                  quantnn::linear_s8s8_accumulate(q->data(), qfw->data() + c * hw, fc1_in, hw, fc1_out, acc->data());
+                              }
+                          } });
+    }
+
+    // Conv2d on the layer shapes of a small MobileNet-style block (pointwise, depthwise,
+    // dense 3x3) and a 5x5 that only the generic rows run: the path chosen for the shape
+    // vs the same layer forced onto the generic rows (-gen)
+    struct Conv2dCase { const char * kernel; int in_c; int out_c; int k; int pad; int groups; uint32_t seed; };
+    for (Conv2dCase c : { Conv2dCase { "conv2d_pw", 64, 64, 1, 0, 1, 50 }, Conv2dCase { "conv2d_dw", 64, 64, 3, 1, 64, 51 },
+                          Conv2dCase { "conv2d_3x3", 16, 32, 3, 1, 1, 52 }, Conv2dCase { "conv2d_5x5", 16, 16, 5, 2, 1, 53 } })
+    {
+        quantnn::Conv2dShape shape;
+        shape.in_c = c.in_c;
+        shape.out_c = c.out_c;
+        shape.in_h = shape.in_w = image_size;
+        shape.kernel_h = shape.kernel_w = c.k;
+        shape.pad_h = shape.pad_w = c.pad;
+        shape.groups = c.groups;
+        auto chosen = std::make_shared<quantnn::Conv2d>(shape);
+        auto generic = std::make_shared<quantnn::Conv2d>(shape, quantnn::Conv2dPath::Generic);
+        const int in_size = c.in_c * image_size * image_size;
+        const int weights = c.out_c * c.in_c / c.groups * c.k * c.k;
+        const double ops = 2.0 * chosen->output_size() * weights / c.out_c;
+        std::ostringstream dims;
+        dims << c.in_c << "x28x28->" << c.out_c;
+        auto x = random_buffer<float>(in_size, -1, 1, c.seed);
+        auto w = random_buffer<float>(weights, -1, 1, c.seed + 1);
+        auto b = random_buffer<float>(c.out_c, -1, 1, c.seed + 2);
+        auto y = std::make_shared<std::vector<float>>(chosen->output_size());
+        auto qx = random_buffer<int8_t>(in_size, -127, 127, c.seed + 3);
+        auto qw = random_buffer<int8_t>(weights, -127, 127, c.seed + 4);
+        auto acc = std::make_shared<std::vector<int32_t>>(chosen->output_size());
+        const double f_bytes = 4.0 * (in_size + weights + c.out_c + chosen->output_size());
+        const double q_bytes = 1.0 * (in_size + weights) + 4.0 * chosen->output_size();
+        cases.push_back({ c.kernel, dims.str(), "fp32", ops, f_bytes,
+                          [=] { chosen->run_f32(x->data(), w->data(), b->data(), y->data()); } });
+        cases.push_back({ c.kernel, dims.str(), "s8xs8", ops, q_bytes, [=] { chosen->run_s8s8(qx->data(), qw->data(), acc->data()); } });
+        if (chosen->path() != quantnn::Conv2dPath::Generic)
+        {
+            cases.push_back({ c.kernel, dims.str(), "fp32-gen", ops, f_bytes,
+                              [=] { generic->run_f32(x->data(), w->data(), b->data(), y->data()); } });
+            cases.push_back({ c.kernel, dims.str(), "s8xs8-gen", ops, q_bytes,
+                              [=] { generic->run_s8s8(qx->data(), qw->data(), acc->data()); } });
+        }
+    }
+
+    // fc1 3920 -> 128 and fc2 128 -> 10
+    struct LinearShape { const char * kernel; int in; int out; uint32_t seed; };
+    for (LinearShape shape : { LinearShape { "fc1", fc1_in, fc1_out, 20 }, LinearShape { "fc2", fc2_in, fc2_out, 30 } })
+    {
+        const int in = shape.in;
+        const int out = shape.out;
+        const double ops = 2.0 * in * out;
+        std::string dims = std::to_string(in) + "->" + std::to_string(out);
+
+        auto x = random_buffer<float>(in, -1, 1, shape.seed);
+        auto w = random_buffer<float>(in * out, -1, 1, shape.seed + 1);
+        auto b = random_buffer<float>(out, -1, 1, shape.seed + 2);
+        auto y = std::make_shared<std::vector<float>>(out);
+        cases.push_back({ shape.kernel, dims, "fp32", ops, 4.0 * (in + in * out + 2 * out),
+                          [=] { quantnn::linear_f32(x->data(), w->data(), b->data(), in, out, y->data()); } });
+
+        auto hw = std::make_shared<std::vector<quantnn::Half>>(quantnn::narrow_weights<quantnn::Half>(w->data(), w->size()));
+        auto bw = std::make_shared<std::vector<quantnn::BFloat16>>(quantnn::narrow_weights<quantnn::BFloat16>(w->data(), w->size()));
+        cases.push_back({ shape.kernel, dims, "fp32xf16", ops, 4.0 * (in + 2 * out) + 2.0 * in * out,
+                          [=] { quantnn::linear_f16_batch(x->data(), hw->data(), b->data(), 1, in, out, y->data()); } });
+        cases.push_back({ shape.kernel, dims, "fp32xbf16", ops, 4.0 * (in + 2 * out) + 2.0 * in * out,
+                          [=] { quantnn::linear_bf16_batch(x->data(), bw->data(), b->data(), 1, in, out, y->data()); } });
+
+        auto qx = random_buffer<int8_t>(in, -127, 127, shape.seed + 3);
+        auto ux = random_buffer<uint8_t>(in, 0, 255, shape.seed + 4);
+        auto qw = random_buffer<int8_t>(in * out, -127, 127, shape.seed + 5);
+        auto acc = std::make_shared<std::vector<int32_t>>(out);
+        cases.push_back({ shape.kernel, dims, "s8xs8", ops, 1.0 * (in + in * out) + 4.0 * out,
+                          [=] { quantnn::linear_s8s8(qx->data(), qw->data(), in, out, acc->data()); } });
+        cases.push_back({ shape.kernel, dims, "u8xs8", ops, 1.0 * (in + in * out) + 4.0 * out,
+                          [=] { quantnn::linear_u8s8(ux->data(), qw->data(), in, out, acc->data()); } });
+    }
+
+    // ReLU on the fc1 output
+    {
+        const int n = fc1_out;
+        auto x = random_buffer<float>(n, -1, 1, 40);
+        cases.push_back({ "relu", std::to_string(n), "fp32", 1.0 * n, 8.0 * n,
+                          [=] { quantnn::relu_f32(x->data(), n); } });
+
+        auto qx = random_buffer<int8_t>(n, -127, 127, 41);
+        auto y = std::make_shared<std::vector<uint8_t>>(n);
+        cases.push_back({ "relu", std::to_string(n), "s8->u8", 1.0 * n, 2.0 * n,
+                          [=] { quantnn::relu_s8_u8(qx->data(), n, 0.2f, 0.09f, y->data()); } });
+    }
+
+    return cases;
+}
+
+void run_case(const KernelCase & c, const std::string & impl, const Options & options, quantnn::CacheFlusher & flusher)
+{
+    double t0 = quantnn::now_us();
+    c.run();
+    double first_us = quantnn::now_us() - t0;
+
+    for (int i = 0; i < options.warmup; i++)
+    {
+        c.run();
+    }
+
+    std::vector<double> hot (options.reps);
+    for (int i = 0; i < options.reps; i++)
+    {
+        double start = quantnn::now_us();
+        c.run();
+        hot[i] = quantnn::now_us() - start;
+    }
+
+    std::vector<double> cold (options.reps);
+    for (int i = 0; i < options.reps; i++)
+    {
+        flusher.flush();
+        double start = quantnn::now_us();
+        c.run();
+        cold[i] = quantnn::now_us() - start;
+    }
+
+    quantnn::Stats h = quantnn::summarize(hot);
+    quantnn::Stats k = quantnn::summarize(cold);
+    // throughput from the median; 1 op/us == 1e-3 GOP/s
+    double hot_gops = c.ops / h.median * 1e-3;
+    double hot_gbs = c.bytes / h.median * 1e-3;
+    double cold_gbs = c.bytes / k.median * 1e-3;
+
+    char line[512];
+    if (options.csv)
+    {
+        snprintf(line, sizeof(line), "%s,%s,%s,%s,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+                 c.kernel.c_str(), c.shape.c_str(), c.dtype.c_str(), impl.c_str(), first_us,
+                 h.min, h.median, h.mean, h.stddev, h.p95, k.min, k.median, k.p95, hot_gops, hot_gbs);
+    }
+    else
+    {
+        snprintf(line, sizeof(line), "%-10s %-17s %-9s %-10s %9.2f %9.2f %9.2f %7.2f %9.2f %9.2f %8.2f %8.2f %8.2f\n",
+                 c.kernel.c_str(), c.shape.c_str(), c.dtype.c_str(), impl.c_str(), first_us,
+                 h.median, h.mean, h.stddev, h.p95, k.median, hot_gops, hot_gbs, cold_gbs);
+    }
+    std::cout << line << std::flush;
+}
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc)
+        {
+            options.reps = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--filter" && i + 1 < argc)
+        {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            options.threads = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--isa" && i + 1 < argc)
+        {
+            std::stringstream ss(argv[++i]);
+            std::string name;
+            while (std::getline(ss, name, ','))
+            {
+                quantnn::Isa isa;
+                if (!quantnn::parse_isa(name, isa))
+                {
+                    std::cerr << "unknown ISA tier " << name << std::endl;
+                    return 1;
+                }
+                if (!quantnn::isa_supported(isa))
+                {
+                    std::cerr << "skipping " << name << ", not supported by this CPU" << std::endl;
+                    continue;
+                }
+                options.isas.push_back(isa);
+            }
+        }
+        else if (arg == "--csv")
+        {
+            options.csv = true;
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--reps N] [--threads N] [--isa avx2,avx512,...] [--filter substring] [--csv]" << std::endl;
+            return 1;
+        }
+    }
+
+    quantnn::set_intra_op_threads(options.threads);
+    quantnn::set_tuning_enabled(false); // time each tier as it is, not the tuned choice
+    if (options.isas.empty())
+    {
+        for (int i = 0; i < quantnn::kIsaCount; i++)
+        {
+            if (quantnn::isa_supported(static_cast<quantnn::Isa>(i)))
+            {
+                options.isas.push_back(static_cast<quantnn::Isa>(i));
+            }
+        }
+    }
+
+    if (options.csv)
+    {
+        std::cout << "kernel,shape,dtype,impl,first_us,hot_min_us,hot_median_us,hot_mean_us,hot_stddev_us,hot_p95_us,"
+                     "cold_min_us,cold_median_us,cold_p95_us,gops,gbs" << std::endl;
+    }
+    else
+    {
+        printf("%-10s %-17s %-9s %-10s %9s %9s %9s %7s %9s %9s %8s %8s %8s\n", "kernel", "shape", "dtype", "impl",
+               "first", "hot_med", "hot_mean", "sd", "hot_p95", "cold_med", "GOP/s", "GB/s", "cold_GB/s");
+        printf("%-10s %-17s %-9s %-10s %9s %9s %9s %7s %9s %9s\n", "", "", "", "",
+               "[us]", "[us]", "[us]", "[us]", "[us]", "[us]");
+    }
+
+    quantnn::CacheFlusher flusher;
+    std::vector<KernelCase> cases = build_cases();
+    for (const KernelCase & c : cases)
+    {
+        for (quantnn::Isa isa : options.isas)
+        {
+            std::string impl = quantnn::isa_name(isa);
+            std::string id = c.kernel + "/" + c.dtype + "/" + impl;
+            if (!options.filter.empty() && id.find(options.filter) == std::string::npos)
+            {
+                continue;
+            }
+            quantnn::set_isa(isa);
+            run_case(c, impl, options, flusher);
+        }
+    }
+    return 0;
+}
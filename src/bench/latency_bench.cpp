@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/affinity.h"
+#include "common/bench.h"
+#include "common/thread_pool.h"
+#include "engine/factory.h"
+#include "kernels/dispatch.h"
+#include "kernels/tuning.h"
+
+#include "mlp/static_quantization/data_7.h"
+
+// Single-request latency of one engine as a function of the intra-op thread count.
+// Every repetition is one forward pass of the test image (batch 1), timed end to
+// end; the speedup is the p50 at one thread over the p50 at N threads. --fused runs
+// conv1 fused into fc1 (Engine::set_fuse_conv_fc1).
+
+std::vector<int> default_thread_counts()
+{
+    std::vector<int> counts;
+    for (int t = 1; t < quantnn::cpu_count(); t *= 2)
+    {
+        counts.push_back(t);
+    }
+    counts.push_back(quantnn::cpu_count());
+    return counts;
+}
+
+int main(int argc, char * argv[])
+{
+    std::string model = "models/mnist_conv.qnn";
+    std::string precision = "static";
+    int reps = 2000;
+    bool fused = false;
+    std::vector<int> thread_counts = default_thread_counts();
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--model" && i + 1 < argc)
+        {
+            model = argv[++i];
+        }
+        else if (arg == "--precision" && i + 1 < argc)
+        {
+            precision = argv[++i];
+        }
+        else if (arg == "--reps" && i + 1 < argc)
+        {
+            reps = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--fused")
+        {
+            fused = true;
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            thread_counts.clear();
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ','))
+            {
+                thread_counts.push_back(std::max(1, atoi(item.c_str())));
+            }
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--model models/mnist_conv.qnn] [--precision fp32|dynamic|static]"
+                      << " [--reps 2000] [--threads 1,2,4,8] [--fused]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::unique_ptr<quantnn::Engine> engine;
+    try
+    {
+        engine = quantnn::make_engine(quantnn::load_model(model), quantnn::parse_precision(precision));
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    engine->set_fuse_conv_fc1(fused);
+    if (fused && !engine->fuses_conv_fc1())
+    {
+        std::cerr << engine->name() << " cannot fuse conv1 into fc1, running unfused" << std::endl;
+    }
+
+    const quantnn::Isa isa = quantnn::active_isa();
+    std::cout << engine->name() << (engine->fuses_conv_fc1() ? " (conv1->fc1 fused)" : "") << ", batch 1, " << reps << " reps, " << quantnn::cpu_count() << " CPUs, "
+              << quantnn::isa_name(isa) << " kernels, " << quantnn::tuning_cache().size() << " tuned shapes" << std::endl;
+    printf("%8s %10s %10s %10s %10s %8s %6s\n", "threads", "p50[us]", "p95[us]", "mean[us]", "max[us]", "speedup", "label");
+
+    std::vector<float> logits (engine->output_dim());
+    double base_p50 = 0.0;
+    for (int threads : thread_counts)
+    {
+        quantnn::set_intra_op_threads(threads);
+        for (int i = 0; i < std::min(reps, 100); i++)
+        {
+            engine->forward(data.data(), logits.data());
+        }
+
+        std::vector<double> samples (reps);
+        int label = -1;
+        for (int i = 0; i < reps; i++)
+        {
+            double start = quantnn::now_us();
+            label = engine->forward(data.data(), logits.data());
+            samples[i] = quantnn::now_us() - start;
+        }
+        quantnn::Stats s = quantnn::summarize(samples);
+        if (base_p50 == 0.0)
+        {
+            base_p50 = s.median;
+        }
+        printf("%8d %10.1f %10.1f %10.1f %10.1f %7.2fx %6d\n", threads, s.median, s.p95, s.mean, s.max,
+               base_p50 / s.median, label);
+    }
+    return 0;
+}
@@ -0,0 +1,444 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "common/bench.h"
+#include "common/histogram.h"
+#include "common/thread_pool.h"
+#include "engine/factory.h"
+#include "server/protocol.h"
+
+#include "mlp/static_quantization/data_7.h"
+
+// Open-loop load generator: the tail latency of an engine or of inference_server as a
+// function of the offered load.
+//
+// Requests arrive on a schedule fixed before the run (evenly spaced, or a Poisson
+// process with --arrival poisson) and not when the previous one returns, so a slow
+// request does not hold back the ones behind it. Each latency is taken from the time the
+// request was scheduled to arrive, not from when it could be sent, so the time spent
+// queueing behind a stall is counted (no coordinated omission).
+//
+// For every target the capacity is first measured with all requests due at once; each
+// rate of the sweep (--loads, fractions of the capacity, or --rates in req/s) then runs
+// for --duration seconds and reports p50/p99/p99.9/max from a LatencyHistogram. A rate
+// is marked saturated when the target completed less than 97% of it.
+//
+//   in process : every engine of every --models x --precisions (the six engines by
+//                default), served by --workers threads taking requests in arrival order
+//   --socket   : inference_server, with requests pipelined over --connections
+//                connections and collected by one reader thread per connection
+
+struct Options
+{
+    std::vector<std::string> models = { "models/mnist_fc.qnn", "models/mnist_conv.qnn" };
+    std::vector<std::string> precisions = { "fp32", "dynamic", "static" };
+    std::string socket_path;
+    bool poisson = false;
+    std::vector<double> loads = { 0.1, 0.25, 0.5, 0.7, 0.8, 0.9, 0.95, 1.0, 1.1 };
+    std::vector<double> rates;
+    double duration_s = 2.0;
+    int workers = 1;
+    int connections = 16;
+    int threads = 1;
+    uint64_t seed = 1;
+    bool csv = false;
+};
+
+struct RunResult
+{
+    quantnn::LatencyHistogram latency;
+    double elapsed_us = 0.0; // first scheduled arrival to last completion
+    int failures = 0;
+};
+
+class Target
+{
+public:
+    virtual ~Target() = default;
+    virtual std::string name() const = 0;
+    // runs one request at start + schedule[i] us for every i
+    virtual RunResult run(const std::vector<double> & schedule) = 0;
+};
+
+// sleeps until shortly before t, then spins, so that requests leave on time
+void wait_until_us(double t)
+{
+    for (;;)
+    {
+        const double left = t - quantnn::now_us();
+        if (left <= 0.0)
+        {
+            return;
+        }
+        if (left > 200.0)
+        {
+            usleep(static_cast<useconds_t>(left - 100.0));
+        }
+    }
+}
+
+class EngineTarget : public Target
+{
+public:
+    EngineTarget(std::string label, std::unique_ptr<quantnn::Engine> engine, int workers)
+        : label{std::move(label)}, engine{std::move(engine)}, workers{workers}
+    {
+    }
+
+    std::string name() const override { return label; }
+
+    RunResult run(const std::vector<double> & schedule) override
+    {
+        RunResult result;
+        std::mutex mutex;
+        std::atomic<size_t> next { 0 };
+        double last_done = 0.0;
+        const double start = quantnn::now_us() + 1000.0;
+        std::vector<std::thread> threads;
+        for (int w = 0; w < workers; w++)
+        {
+            threads.emplace_back([&] {
+                quantnn::LatencyHistogram local;
+                std::vector<float> logits (engine->output_dim());
+                double done = 0.0;
+                for (size_t i = next++; i < schedule.size(); i = next++)
+                {
+                    const double due = start + schedule[i];
+                    wait_until_us(due);
+                    engine->forward(data.data(), logits.data());
+                    done = quantnn::now_us();
+                    local.record_us(done - due);
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                result.latency.merge(local);
+                last_done = std::max(last_done, done);
+            });
+        }
+        for (std::thread & t : threads)
+        {
+            t.join();
+        }
+        result.elapsed_us = last_done - start;
+        return result;
+    }
+
+private:
+    std::string label;
+    std::unique_ptr<quantnn::Engine> engine;
+    int workers;
+};
+
+class SocketTarget : public Target
+{
+public:
+    SocketTarget(std::string path, int connections) : path{std::move(path)}, connections{connections} {}
+
+    std::string name() const override { return "server " + path; }
+
+    // request i goes over connection i % connections; responses come back in order
+    RunResult run(const std::vector<double> & schedule) override
+    {
+        RunResult result;
+        std::mutex mutex;
+        double last_done = 0.0;
+        const double start = quantnn::now_us() + 1000.0;
+        std::vector<std::thread> threads;
+        for (int c = 0; c < connections; c++)
+        {
+            size_t count = 0;
+            for (size_t i = c; i < schedule.size(); i += connections)
+            {
+                count++;
+            }
+            int fd = -1;
+            try
+            {
+                fd = quantnn::connect_unix(path);
+            }
+            catch (const std::exception & e)
+            {
+                std::cerr << e.what() << std::endl;
+                result.failures += static_cast<int>(count);
+                continue;
+            }
+            threads.emplace_back([&, c, fd] {
+                const quantnn::RequestHeader header { quantnn::kRequestMagic, static_cast<uint32_t>(quantnn::PixelFormat::F32) };
+                for (size_t i = c; i < schedule.size(); i += connections)
+                {
+                    wait_until_us(start + schedule[i]);
+                    if (!quantnn::write_full(fd, &header, sizeof(header))
+                        || !quantnn::write_full(fd, data.data(), quantnn::kImagePixels * sizeof(float)))
+                    {
+                        break;
+                    }
+                }
+            });
+            threads.emplace_back([&, c, fd, count] {
+                quantnn::LatencyHistogram local;
+                double done = 0.0;
+                size_t received = 0;
+                quantnn::Response response;
+                for (size_t i = c; i < schedule.size(); i += connections)
+                {
+                    if (!quantnn::read_full(fd, &response, sizeof(response)))
+                    {
+                        break;
+                    }
+                    done = quantnn::now_us();
+                    local.record_us(done - (start + schedule[i]));
+                    received++;
+                }
+                shutdown(fd, SHUT_RDWR);
+                std::lock_guard<std::mutex> lock(mutex);
+                result.latency.merge(local);
+                result.failures += static_cast<int>(count - received);
+                last_done = std::max(last_done, done);
+            });
+            sockets.push_back(fd);
+        }
+        for (std::thread & t : threads)
+        {
+            t.join();
+        }
+        for (int fd : sockets)
+        {
+            close(fd);
+        }
+        sockets.clear();
+        result.elapsed_us = last_done - start;
+        return result;
+    }
+
+private:
+    std::string path;
+    int connections;
+    std::vector<int> sockets;
+};
+
+// arrival times in us from the start of the run: rate * duration requests
+std::vector<double> make_schedule(double rate, double duration_s, bool poisson, std::mt19937_64 & rng)
+{
+    const size_t n = std::max<size_t>(1, static_cast<size_t>(rate * duration_s));
+    std::vector<double> schedule (n);
+    std::exponential_distribution<double> gap(rate * 1e-6);
+    double t = 0.0;
+    for (size_t i = 0; i < n; i++)
+    {
+        schedule[i] = poisson ? t : i * 1e6 / rate;
+        t += gap(rng);
+    }
+    return schedule;
+}
+
+std::vector<std::string> split_list(const std::string & value)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(value);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        items.push_back(item);
+    }
+    return items;
+}
+
+std::vector<double> parse_doubles(const std::string & value)
+{
+    std::vector<double> out;
+    for (const std::string & item : split_list(value))
+    {
+        out.push_back(atof(item.c_str()));
+    }
+    return out;
+}
+
+std::string base_name(const std::string & path)
+{
+    return path.substr(path.find_last_of('/') + 1);
+}
+
+void sweep(Target & target, const Options & options)
+{
+    // capacity: every request due at once, which keeps the target busy throughout
+    const std::vector<double> burst (2000, 0.0);
+    target.run(burst);
+    const RunResult full = target.run(burst);
+    const double capacity = full.elapsed_us > 0.0 ? full.latency.count() / (full.elapsed_us * 1e-6) : 0.0;
+
+    std::vector<double> rates = options.rates;
+    if (rates.empty())
+    {
+        for (double load : options.loads)
+        {
+            rates.push_back(load * capacity);
+        }
+    }
+    if (!options.csv)
+    {
+        printf("%s: capacity %.0f req/s, %s arrivals, %.1f s per rate\n", target.name().c_str(), capacity,
+               options.poisson ? "poisson" : "fixed", options.duration_s);
+        printf("%14s %6s %14s %10s %10s %10s %10s %9s\n", "offered[r/s]", "load", "achieved[r/s]", "p50[us]", "p99[us]",
+               "p99.9[us]", "max[us]", "requests");
+    }
+    std::mt19937_64 rng(options.seed);
+    for (double rate : rates)
+    {
+        if (rate <= 0.0)
+        {
+            continue;
+        }
+        const RunResult r = target.run(make_schedule(rate, options.duration_s, options.poisson, rng));
+        const double achieved = r.elapsed_us > 0.0 ? r.latency.count() / (r.elapsed_us * 1e-6) : 0.0;
+        const bool saturated = achieved < 0.97 * rate || r.failures > 0;
+        if (options.csv)
+        {
+            printf("%s,%s,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%llu,%d\n", target.name().c_str(), options.poisson ? "poisson" : "fixed",
+                   rate, achieved, r.latency.percentile_us(50.0), r.latency.percentile_us(99.0), r.latency.percentile_us(99.9),
+                   r.latency.max_us(), static_cast<unsigned long long>(r.latency.count()), r.failures);
+        }
+        else
+        {
+            printf("%14.0f %6.2f %14.0f %10.1f %10.1f %10.1f %10.1f %9llu%s\n", rate, capacity > 0.0 ? rate / capacity : 0.0,
+                   achieved, r.latency.percentile_us(50.0), r.latency.percentile_us(99.0), r.latency.percentile_us(99.9),
+                   r.latency.max_us(), static_cast<unsigned long long>(r.latency.count()), saturated ? "  saturated" : "");
+        }
+        if (r.failures > 0)
+        {
+            std::cerr << r.failures << " requests failed" << std::endl;
+        }
+    }
+    if (!options.csv)
+    {
+        printf("\n");
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--models" && i + 1 < argc)
+        {
+            options.models = split_list(argv[++i]);
+        }
+        else if (arg == "--precisions" && i + 1 < argc)
+        {
+            options.precisions = split_list(argv[++i]);
+        }
+        else if (arg == "--socket" && i + 1 < argc)
+        {
+            options.socket_path = argv[++i];
+        }
+        else if (arg == "--arrival" && i + 1 < argc)
+        {
+            std::string arrival = argv[++i];
+            if (arrival != "fixed" && arrival != "poisson")
+            {
+                std::cerr << "unknown arrival " << arrival << " (fixed or poisson)" << std::endl;
+                return 1;
+            }
+            options.poisson = arrival == "poisson";
+        }
+        else if (arg == "--loads" && i + 1 < argc)
+        {
+            options.loads = parse_doubles(argv[++i]);
+        }
+        else if (arg == "--rates" && i + 1 < argc)
+        {
+            options.rates = parse_doubles(argv[++i]);
+        }
+        else if (arg == "--duration" && i + 1 < argc)
+        {
+            options.duration_s = std::max(0.01, atof(argv[++i]));
+        }
+        else if (arg == "--workers" && i + 1 < argc)
+        {
+            options.workers = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--connections" && i + 1 < argc)
+        {
+            options.connections = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            options.threads = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--seed" && i + 1 < argc)
+        {
+            options.seed = strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--csv")
+        {
+            options.csv = true;
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0]
+                      << " [--models models/mnist_fc.qnn,models/mnist_conv.qnn] [--precisions fp32,dynamic,static]"
+                      << " [--socket /tmp/quantnn.sock] [--arrival fixed|poisson] [--loads 0.1,0.5,0.9,1.1 | --rates 1000,5000]"
+                      << " [--duration 2] [--workers 1] [--connections 16] [--threads 1] [--seed 1] [--csv]" << std::endl;
+            return 1;
+        }
+    }
+    quantnn::set_intra_op_threads(options.threads);
+
+    std::vector<std::unique_ptr<Target>> targets;
+    if (!options.socket_path.empty())
+    {
+        targets.push_back(std::make_unique<SocketTarget>(options.socket_path, options.connections));
+    }
+    else
+    {
+        for (const std::string & model : options.models)
+        {
+            std::shared_ptr<const quantnn::ModelBundle> bundle;
+            try
+            {
+                bundle = quantnn::load_model(model);
+            }
+            catch (const std::exception & e)
+            {
+                std::cerr << e.what() << std::endl;
+                return 1;
+            }
+            for (const std::string & precision : options.precisions)
+            {
+                try
+                {
+                    targets.push_back(std::make_unique<EngineTarget>(
+                        base_name(model) + " " + precision, quantnn::make_engine(bundle, quantnn::parse_precision(precision)),
+                        options.workers));
+                }
+                catch (const std::exception & e)
+                {
+                    std::cerr << base_name(model) << " " << precision << ": " << e.what() << std::endl;
+                }
+            }
+        }
+    }
+
+    if (options.csv)
+    {
+        printf("target,arrival,offered,achieved,p50_us,p99_us,p999_us,max_us,requests,failures\n");
+    }
+    for (std::unique_ptr<Target> & target : targets)
+    {
+        sweep(*target, options);
+    }
+    return 0;
+}
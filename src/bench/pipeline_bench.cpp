@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/affinity.h"
+#include "common/bench.h"
+#include "engine/factory.h"
+#include "engine/pipeline.h"
+
+// Streams images through one engine and compares three execution modes:
+//   serial        : one thread runs the whole forward pass per image
+//   pipeline      : features (conv1) and classifier (fc1, relu, fc2) on two pinned threads
+//   data-parallel : --workers pinned threads, each running the whole forward pass
+// A producer thread submits the images either as fast as the runner accepts them
+// (--rate 0, measures peak throughput) or at a fixed arrival rate in images/s,
+// and latency is measured from submit to result.
+
+struct Options
+{
+    std::string model = "models/mnist_conv.qnn";
+    std::string precision = "static";
+    int images = 20000;
+    double rate = 0.0;
+    int workers = 2;
+    size_t capacity = 64;
+    std::vector<int> cpus;
+};
+
+struct ModeResult
+{
+    double throughput = 0.0;
+    std::vector<double> latencies;
+    std::vector<int> labels;
+};
+
+std::vector<int> parse_cpus(const std::string & list)
+{
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        cpus.push_back(atoi(item.c_str()));
+    }
+    return cpus;
+}
+
+// a small pool of synthetic normalized images, cycled through by every mode
+std::vector<float> make_images(int count)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> pixel(0.0f, 1.0f);
+    std::vector<float> images (static_cast<size_t>(count) * quantnn::Engine::input_dim);
+    for (float & v : images)
+    {
+        v = (pixel(rng) - 0.1307f) / 0.3081f;
+    }
+    return images;
+}
+
+ModeResult run_serial(const quantnn::Engine & engine, const std::vector<float> & pool, int pool_size, int images)
+{
+    ModeResult r;
+    std::vector<float> logits (engine.output_dim());
+    double start = quantnn::now_us();
+    for (int i = 0; i < images; i++)
+    {
+        double t0 = quantnn::now_us();
+        r.labels.push_back(engine.forward(&pool[(i % pool_size) * quantnn::Engine::input_dim], logits.data()));
+        r.latencies.push_back(quantnn::now_us() - t0);
+    }
+    r.throughput = images / (quantnn::now_us() - start) * 1e6;
+    return r;
+}
+
+ModeResult run_stream(quantnn::StreamRunner & runner, const std::vector<float> & pool, int pool_size, int images, double rate)
+{
+    ModeResult r;
+    r.latencies.reserve(images);
+    r.labels.reserve(images);
+
+    double start = quantnn::now_us();
+    std::thread producer([&] {
+        for (int i = 0; i < images; i++)
+        {
+            if (rate > 0.0)
+            {
+                double due = start + i / rate * 1e6;
+                while (quantnn::now_us() < due)
+                {
+                    quantnn::cpu_relax();
+                }
+            }
+            runner.submit(i, &pool[(i % pool_size) * quantnn::Engine::input_dim]);
+        }
+        runner.close();
+    });
+
+    quantnn::StreamResult result;
+    while (runner.next(result))
+    {
+        r.latencies.push_back(result.done_us - result.submit_us);
+        r.labels.push_back(result.label);
+    }
+    r.throughput = r.labels.size() / (quantnn::now_us() - start) * 1e6;
+    producer.join();
+    return r;
+}
+
+void print_row(const std::string & mode, int threads, const ModeResult & r, const ModeResult & reference)
+{
+    quantnn::Stats s = quantnn::summarize(r.latencies);
+    double p99 = quantnn::percentile(r.latencies, 99.0);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < std::min(r.labels.size(), reference.labels.size()); i++)
+    {
+        mismatches += r.labels[i] != reference.labels[i];
+    }
+    mismatches += std::max(r.labels.size(), reference.labels.size()) - std::min(r.labels.size(), reference.labels.size());
+    printf("%-14s %7d %12.0f %10.1f %10.1f %10.1f %10.1f %10zu\n", mode.c_str(), threads, r.throughput,
+           s.median, s.p95, p99, s.max, mismatches);
+}
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--model" && i + 1 < argc)
+        {
+            options.model = argv[++i];
+        }
+        else if (arg == "--precision" && i + 1 < argc)
+        {
+            options.precision = argv[++i];
+        }
+        else if (arg == "--images" && i + 1 < argc)
+        {
+            options.images = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--rate" && i + 1 < argc)
+        {
+            options.rate = atof(argv[++i]);
+        }
+        else if (arg == "--workers" && i + 1 < argc)
+        {
+            options.workers = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--capacity" && i + 1 < argc)
+        {
+            options.capacity = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--cpus" && i + 1 < argc)
+        {
+            options.cpus = parse_cpus(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--model models/mnist_conv.qnn] [--precision fp32|dynamic|static]"
+                      << " [--images 20000] [--rate images/s] [--workers 2] [--capacity 64] [--cpus 1,2]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::unique_ptr<quantnn::Engine> engine;
+    try
+    {
+        engine = quantnn::make_engine(quantnn::load_model(options.model), quantnn::parse_precision(options.precision));
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    // worker threads default to CPUs 1.., leaving CPU 0 to the producer and consumer
+    if (options.cpus.empty())
+    {
+        for (int i = 0; i < std::max(options.workers, 2); i++)
+        {
+            options.cpus.push_back(quantnn::cpu_count() > 1 ? 1 + i % (quantnn::cpu_count() - 1) : -1);
+        }
+    }
+
+    const int pool_size = 256;
+    std::vector<float> pool = make_images(pool_size);
+
+    std::cout << engine->name() << ", " << options.images << " images, "
+              << (options.rate > 0.0 ? std::to_string(static_cast<int>(options.rate)) + " images/s" : std::string("saturated"))
+              << ", " << quantnn::cpu_count() << " CPUs" << std::endl;
+    printf("%-14s %7s %12s %10s %10s %10s %10s %10s\n", "mode", "threads", "images/s", "p50[us]", "p95[us]",
+           "p99[us]", "max[us]", "mismatch");
+
+    // warm up the weights and the per-thread scratch buffers
+    run_serial(*engine, pool, pool_size, std::min(options.images, 200));
+    ModeResult serial = run_serial(*engine, pool, pool_size, options.images);
+    print_row("serial", 1, serial, serial);
+
+    {
+        quantnn::PipelineRunner runner(*engine, options.capacity, options.cpus);
+        print_row(runner.name(), runner.threads(), run_stream(runner, pool, pool_size, options.images, options.rate), serial);
+    }
+    {
+        quantnn::DataParallelRunner runner(*engine, options.workers, options.capacity, options.cpus);
+        print_row(runner.name(), runner.threads(), run_stream(runner, pool, pool_size, options.images, options.rate), serial);
+    }
+    return 0;
+}
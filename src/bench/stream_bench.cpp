@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/bench.h"
+#include "engine/mixed_engine.h"
+#include "engine/streamed_engine.h"
+
+#include "mlp/static_quantization/data_7.h"
+
+// Bounded-memory execution (engine/streamed_engine.h) against the same layers with all
+// weights resident. Every repetition is one forward pass of the test image; each row
+// reports the latency, the penalty over the resident p50, the layer loads and how much
+// of their time was hidden behind computation, the peak weights in the window and the
+// peak RSS of the process. --budget picks the window from a memory budget instead,
+// --drop-cache evicts released layers from the page cache so that loads read the file.
+
+struct Run
+{
+    quantnn::Stats latency;
+    int label = -1;
+    std::vector<float> logits;
+};
+
+Run time_engine(const quantnn::Engine & engine, int reps)
+{
+    Run run;
+    run.logits.resize(engine.output_dim());
+    std::vector<double> samples (reps);
+    for (int i = 0; i < reps; i++)
+    {
+        double start = quantnn::now_us();
+        run.label = engine.forward(data.data(), run.logits.data());
+        samples[i] = quantnn::now_us() - start;
+    }
+    run.latency = quantnn::summarize(samples);
+    return run;
+}
+
+int main(int argc, char * argv[])
+{
+    std::string model = "models/mnist_conv.qnn";
+    std::string precision = "static";
+    int reps = 2000;
+    double budget_mb = 0.0;
+    bool drop_cache = false;
+    std::vector<int> windows;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--model" && i + 1 < argc)
+        {
+            model = argv[++i];
+        }
+        else if (arg == "--precision" && i + 1 < argc)
+        {
+            precision = argv[++i];
+        }
+        else if (arg == "--reps" && i + 1 < argc)
+        {
+            reps = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--windows" && i + 1 < argc)
+        {
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ','))
+            {
+                windows.push_back(std::max(1, atoi(item.c_str())));
+            }
+        }
+        else if (arg == "--budget" && i + 1 < argc)
+        {
+            budget_mb = atof(argv[++i]);
+        }
+        else if (arg == "--drop-cache")
+        {
+            drop_cache = true;
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--model models/mnist_conv.qnn] [--precision fp32|dynamic|static]"
+                      << " [--reps 2000] [--windows 1,2,3 | --budget MB] [--drop-cache]" << std::endl;
+            return 1;
+        }
+    }
+
+    try
+    {
+        const quantnn::LayerPrecisions precisions = quantnn::LayerPrecisions::uniform(quantnn::parse_precision(precision));
+        Run resident;
+        long resident_rss = 0;
+        {
+            quantnn::reset_peak_rss();
+            quantnn::MixedEngine engine(quantnn::ModelBundle::open(model), precisions);
+            time_engine(engine, std::min(reps, 100));
+            resident = time_engine(engine, reps);
+            resident_rss = quantnn::peak_rss_kb();
+        }
+
+        quantnn::StreamOptions options;
+        options.drop_page_cache = drop_cache;
+        options.budget_bytes = static_cast<size_t>(budget_mb * (1 << 20));
+        {
+            quantnn::StreamedEngine probe(model, precisions, options);
+            const quantnn::WeightStreamer & w = probe.weights();
+            std::cout << probe.name() << " " << precisions.to_string() << ", batch 1, " << reps << " reps, layer weights";
+            for (int l = 0; l < w.layer_count(); l++)
+            {
+                std::cout << (l > 0 ? " / " : " ") << w.layer_bytes(l) / 1024 << " KB";
+            }
+            std::cout << (drop_cache ? ", page cache dropped" : "") << std::endl;
+            if (budget_mb > 0.0)
+            {
+                windows = { w.window_layers() };
+            }
+            else if (windows.empty())
+            {
+                for (int k = 1; k <= w.layer_count(); k++)
+                {
+                    windows.push_back(k);
+                }
+            }
+        }
+
+        printf("%9s %9s %9s %8s %9s %9s %9s %8s %10s %10s %6s\n", "window", "p50[us]", "p95[us]", "penalty", "loads/fw",
+               "load[us]", "stall[us]", "overlap", "weights[KB]", "peakRSS[KB]", "label");
+        printf("%9s %9.1f %9.1f %7.2fx %9s %9s %9s %8s %10s %10ld %6d\n", "resident", resident.latency.median,
+               resident.latency.p95, 1.0, "-", "-", "-", "-", "all", resident_rss, resident.label);
+
+        for (int window : windows)
+        {
+            options.window = window;
+            quantnn::StreamedEngine engine(model, precisions, options);
+            time_engine(engine, std::min(reps, 100));
+            engine.reset_stats();
+            Run run = time_engine(engine, reps);
+            const quantnn::StreamStats s = engine.stats();
+            if (memcmp(run.logits.data(), resident.logits.data(), run.logits.size() * sizeof(float)) != 0)
+            {
+                std::cerr << "window " << window << ": the logits differ from the resident engine" << std::endl;
+                return 1;
+            }
+            printf("%9d %9.1f %9.1f %7.2fx %9.2f %9.1f %9.1f %7.1f%% %10zu %10ld %6d\n", engine.weights().window_layers(),
+                   run.latency.median, run.latency.p95, run.latency.median / resident.latency.median,
+                   static_cast<double>(s.loads) / reps, s.load_us / reps, s.stall_us / reps, 100.0 * s.overlap(),
+                   s.peak_window_bytes / 1024, s.peak_rss_kb, run.label);
+        }
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
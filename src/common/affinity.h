@@ -0,0 +1,33 @@
+#pragma once
+
+// Thread placement helpers.
+
+#include <thread>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace quantnn
+{
+
+inline int cpu_count()
+{
+    unsigned n = std::thread::hardware_concurrency();
+    return n > 0 ? static_cast<int>(n) : 1;
+}
+
+// Pins a thread to one CPU. Returns false when cpu is negative or the call fails,
+// e.g. because the CPU is not in the process's allowed set.
+inline bool pin_thread(std::thread & thread, int cpu)
+{
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+    {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+}
+
+} // namespace quantnn
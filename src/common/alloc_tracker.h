@@ -0,0 +1,319 @@
+#pragma once
+
+// In-process allocation accounting.
+//
+// With QUANTNN_TRACK_ALLOC defined (cmake -DQUANTNN_TRACK_ALLOC=ON) this header
+// replaces the global operator new/delete with counting versions, so it must be
+// included from exactly one translation unit of a program (the one with main).
+//
+// QUANTNN_ALLOC_SCOPE("fc1") attributes the allocations made inside a layer to it
+// (count, bytes and the peak of live bytes above the level at entry), and
+// QUANTNN_ALLOC_REPORT() prints the per-layer table.
+// quantnn::check_zero_alloc(fn) runs fn once to warm up and fails if a second
+// call allocates at all; the engines expose it as `--check-zero-alloc`.
+//
+// Without QUANTNN_TRACK_ALLOC the macros compile to nothing.
+
+#ifdef QUANTNN_TRACK_ALLOC
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <malloc.h>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace quantnn
+{
+
+struct AllocStats
+{
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+class AllocScope;
+
+namespace alloc_detail
+{
+
+inline std::atomic<uint64_t> total_count { 0 };
+inline std::atomic<uint64_t> total_bytes { 0 };
+inline std::atomic<int64_t> live_bytes { 0 };
+inline std::atomic<int64_t> peak_live_bytes { 0 };
+
+// innermost scope of the calling thread and whether its allocations are counted;
+// plain thread_locals so that touching them never allocates
+inline thread_local AllocScope * current_scope = nullptr;
+inline thread_local int paused = 0;
+
+// in front of every block handed out by operator new: the bytes it added to live_bytes
+// (0 when it was allocated while paused, so that its free is not counted either) and
+// the distance back to the start of the malloc block
+struct alignas(16) BlockHeader
+{
+    uint64_t counted;
+    uint64_t offset;
+};
+
+uint64_t on_alloc(size_t size);
+void on_free(uint64_t counted);
+
+} // namespace alloc_detail
+
+inline AllocStats alloc_stats()
+{
+    return AllocStats { alloc_detail::total_count.load(std::memory_order_relaxed),
+                        alloc_detail::total_bytes.load(std::memory_order_relaxed) };
+}
+
+// allocations made while an UntrackedScope is alive on this thread are not counted, and
+// neither are their frees, e.g. preparing the input of a forward call that is being checked
+class UntrackedScope
+{
+public:
+    UntrackedScope() { alloc_detail::paused++; }
+    ~UntrackedScope() { alloc_detail::paused--; }
+};
+
+class AllocScope
+{
+public:
+    struct Row
+    {
+        std::string name;
+        uint64_t calls = 0;
+        uint64_t count = 0;
+        uint64_t bytes = 0;
+        int64_t peak_live_bytes = 0;
+    };
+
+    explicit AllocScope(const char * name) : name{name}, parent{alloc_detail::current_scope}
+    {
+        entry_live_bytes = alloc_detail::live_bytes.load(std::memory_order_relaxed);
+        peak_bytes = entry_live_bytes;
+        alloc_detail::current_scope = this;
+    }
+
+    ~AllocScope()
+    {
+        alloc_detail::current_scope = parent;
+        if (parent != nullptr)
+        {
+            parent->count += count;
+            parent->bytes += bytes;
+            parent->peak_bytes = std::max(parent->peak_bytes, peak_bytes);
+        }
+
+        UntrackedScope untracked;
+        std::lock_guard<std::mutex> lock(mutex());
+        std::vector<Row> & table = rows();
+        auto it = std::find_if(table.begin(), table.end(), [&](const Row & row) { return row.name == name; });
+        if (it == table.end())
+        {
+            table.push_back(Row { name });
+            it = table.end() - 1;
+        }
+        it->calls++;
+        it->count += count;
+        it->bytes += bytes;
+        it->peak_live_bytes = std::max(it->peak_live_bytes, peak_bytes - entry_live_bytes);
+    }
+
+    AllocScope(const AllocScope &) = delete;
+    AllocScope & operator=(const AllocScope &) = delete;
+
+    static void report(std::ostream & os)
+    {
+        UntrackedScope untracked;
+        std::lock_guard<std::mutex> lock(mutex());
+        char line[160];
+        snprintf(line, sizeof(line), "%-16s %6s %12s %14s %16s\n",
+                 "layer", "calls", "allocs/call", "bytes/call", "peak_live[B]");
+        os << line;
+        for (const Row & row : rows())
+        {
+            snprintf(line, sizeof(line), "%-16s %6llu %12.1f %14.1f %16lld\n", row.name.c_str(),
+                     static_cast<unsigned long long>(row.calls), static_cast<double>(row.count) / row.calls,
+                     static_cast<double>(row.bytes) / row.calls, static_cast<long long>(row.peak_live_bytes));
+            os << line;
+        }
+        os << "process peak live bytes: " << alloc_detail::peak_live_bytes.load() << std::endl;
+    }
+
+    static void reset()
+    {
+        UntrackedScope untracked;
+        std::lock_guard<std::mutex> lock(mutex());
+        rows().clear();
+    }
+
+private:
+    friend uint64_t alloc_detail::on_alloc(size_t size);
+
+    static std::mutex & mutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+
+    static std::vector<Row> & rows()
+    {
+        static std::vector<Row> table;
+        return table;
+    }
+
+    const char * name;
+    AllocScope * parent;
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    int64_t entry_live_bytes = 0;
+    int64_t peak_bytes = 0;
+};
+
+namespace alloc_detail
+{
+
+// returns the bytes counted for the block, for its BlockHeader
+inline uint64_t on_alloc(size_t size)
+{
+    if (paused > 0)
+    {
+        return 0;
+    }
+    total_count.fetch_add(1, std::memory_order_relaxed);
+    total_bytes.fetch_add(size, std::memory_order_relaxed);
+    int64_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    int64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+    if (current_scope != nullptr)
+    {
+        current_scope->count++;
+        current_scope->bytes += size;
+        current_scope->peak_bytes = std::max(current_scope->peak_bytes, live);
+    }
+    return size;
+}
+
+inline void on_free(uint64_t counted)
+{
+    live_bytes.fetch_sub(static_cast<int64_t>(counted), std::memory_order_relaxed);
+}
+
+// through an integer, as the compiler would otherwise see an access before a new'ed array
+inline BlockHeader * header_of(void * ptr)
+{
+    return reinterpret_cast<BlockHeader *>(reinterpret_cast<uintptr_t>(ptr) - sizeof(BlockHeader));
+}
+
+// writes the header in front of base + offset and returns the pointer for the caller
+inline void * track(void * base, size_t offset)
+{
+    void * ptr = static_cast<char *>(base) + offset;
+    BlockHeader * header = header_of(ptr);
+    header->offset = offset;
+    header->counted = on_alloc(malloc_usable_size(base) - offset);
+    return ptr;
+}
+
+} // namespace alloc_detail
+
+// Runs fn `warmup` times, then once more and reports whether that call allocated.
+template <typename Fn>
+bool check_zero_alloc(Fn && fn, int warmup = 1)
+{
+    for (int i = 0; i < warmup; i++)
+    {
+        fn();
+    }
+    AllocStats before = alloc_stats();
+    fn();
+    AllocStats after = alloc_stats();
+
+    uint64_t count = after.count - before.count;
+    uint64_t bytes = after.bytes - before.bytes;
+    if (count > 0)
+    {
+        std::cout << "FAIL: warmed-up forward allocated " << count << " times (" << bytes << " bytes)" << std::endl;
+        return false;
+    }
+    std::cout << "OK: warmed-up forward did not allocate" << std::endl;
+    return true;
+}
+
+} // namespace quantnn
+
+// the replaced allocation functions; every block carries a BlockHeader, so delete
+// subtracts exactly what new counted and finds the malloc block for any alignment
+void * operator new(size_t size)
+{
+    constexpr size_t offset = sizeof(quantnn::alloc_detail::BlockHeader);
+    void * base = malloc(offset + size);
+    if (base == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return quantnn::alloc_detail::track(base, offset);
+}
+
+void * operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void * operator new(size_t size, std::align_val_t align)
+{
+    // the header takes a whole alignment unit in front of the block (alignments are
+    // powers of two, so 16 bytes keep the smaller ones)
+    size_t alignment = static_cast<size_t>(align);
+    size_t offset = std::max(alignment, sizeof(quantnn::alloc_detail::BlockHeader));
+    void * base = aligned_alloc(alignment, (offset + std::max<size_t>(size, 1) + alignment - 1) / alignment * alignment);
+    if (base == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return quantnn::alloc_detail::track(base, offset);
+}
+
+void * operator new[](size_t size, std::align_val_t align)
+{
+    return operator new(size, align);
+}
+
+void operator delete(void * ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    const quantnn::alloc_detail::BlockHeader * header = quantnn::alloc_detail::header_of(ptr);
+    quantnn::alloc_detail::on_free(header->counted);
+    free(static_cast<char *>(ptr) - header->offset);
+}
+
+void operator delete[](void * ptr) noexcept { operator delete(ptr); }
+void operator delete(void * ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void * ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete(void * ptr, std::align_val_t) noexcept { operator delete(ptr); }
+void operator delete[](void * ptr, std::align_val_t) noexcept { operator delete(ptr); }
+void operator delete(void * ptr, size_t, std::align_val_t) noexcept { operator delete(ptr); }
+void operator delete[](void * ptr, size_t, std::align_val_t) noexcept { operator delete(ptr); }
+
+#define QUANTNN_ALLOC_CONCAT_INNER(a, b) a##b
+#define QUANTNN_ALLOC_CONCAT(a, b) QUANTNN_ALLOC_CONCAT_INNER(a, b)
+#define QUANTNN_ALLOC_SCOPE(name) quantnn::AllocScope QUANTNN_ALLOC_CONCAT(quantnn_alloc_scope_, __LINE__)(name)
+#define QUANTNN_ALLOC_REPORT() quantnn::AllocScope::report(std::cout)
+
+#else
+
+#define QUANTNN_ALLOC_SCOPE(name) ((void)0)
+#define QUANTNN_ALLOC_REPORT() ((void)0)
+
+#endif
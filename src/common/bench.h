@@ -0,0 +1,108 @@
+#pragma once
+
+// Small helpers shared by the benchmark targets: a monotonic clock,
+// summary statistics over repetitions and an LLC flush for cache-cold runs.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <unistd.h>
+
+namespace quantnn
+{
+
+inline double now_us()
+{
+    auto t = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double, std::micro>(t).count();
+}
+
+struct Stats
+{
+    double min = 0.0;
+    double median = 0.0;
+    double mean = 0.0;
+    double stddev = 0.0;
+    double p95 = 0.0;
+    double max = 0.0;
+};
+
+inline double percentile(std::vector<double> sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+    std::sort(sorted.begin(), sorted.end());
+    double pos = p / 100.0 * (sorted.size() - 1);
+    size_t lo = static_cast<size_t>(pos);
+    size_t hi = std::min(lo + 1, sorted.size() - 1);
+    return sorted[lo] + (pos - lo) * (sorted[hi] - sorted[lo]);
+}
+
+inline Stats summarize(std::vector<double> samples)
+{
+    Stats stats;
+    if (samples.empty())
+    {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    stats.min = samples.front();
+    stats.max = samples.back();
+    stats.median = percentile(samples, 50.0);
+    stats.p95 = percentile(samples, 95.0);
+
+    double sum = 0.0;
+    for (double s : samples)
+    {
+        sum += s;
+    }
+    stats.mean = sum / samples.size();
+
+    double var = 0.0;
+    for (double s : samples)
+    {
+        var += (s - stats.mean) * (s - stats.mean);
+    }
+    stats.stddev = samples.size() > 1 ? std::sqrt(var / (samples.size() - 1)) : 0.0;
+    return stats;
+}
+
+// Evicts the data caches by streaming through a buffer twice the size of the LLC.
+class CacheFlusher
+{
+public:
+    CacheFlusher()
+    {
+        long llc = 0;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+        llc = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+        if (llc <= 0)
+        {
+            llc = 32L << 20;
+        }
+        buffer.resize(2 * llc / sizeof(uint64_t), 1);
+    }
+
+    void flush()
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < buffer.size(); i += 8)
+        {
+            buffer[i] += 1;
+            sum += buffer[i];
+        }
+        sink = sum;
+    }
+
+private:
+    std::vector<uint64_t> buffer;
+    volatile uint64_t sink = 0;
+};
+
+} // namespace quantnn
@@ -0,0 +1,198 @@
+#pragma once
+
+// Runtime CPU feature detection and the ISA tier the kernels are dispatched to.
+//
+// The tiers, from slowest to fastest:
+//   scalar     : portable C++, compiled for the baseline of the build
+//   sse4.1     : 128-bit SSE4.1
+//   avx2       : 256-bit AVX2 + FMA + F16C
+//   avxvnni    : avx2 + AVX-VNNI int8 dot products (VEX encoded, e.g. Alder Lake)
+//   avx512     : 512-bit AVX-512 F/BW/VL
+//   avx512vnni : avx512 + AVX512-VNNI int8 dot products
+// The best tier the CPU and the OS support is used, unless QUANTNN_ISA names another
+// one, e.g. QUANTNN_ISA=avx2 to test that path on a newer machine. A tier the machine
+// cannot run falls back to the best one below it.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define QUANTNN_X86 1
+#endif
+
+namespace quantnn
+{
+
+enum class Isa
+{
+    Scalar,
+    SSE41,
+    AVX2,
+    AVXVNNI,
+    AVX512,
+    AVX512VNNI,
+};
+
+constexpr int kIsaCount = 6;
+
+inline const char * isa_name(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::Scalar: return "scalar";
+        case Isa::SSE41: return "sse4.1";
+        case Isa::AVX2: return "avx2";
+        case Isa::AVXVNNI: return "avxvnni";
+        case Isa::AVX512: return "avx512";
+        case Isa::AVX512VNNI: return "avx512vnni";
+    }
+    return "unknown";
+}
+
+inline bool parse_isa(const std::string & name, Isa & isa)
+{
+    for (int i = 0; i < kIsaCount; i++)
+    {
+        if (name == isa_name(static_cast<Isa>(i)))
+        {
+            isa = static_cast<Isa>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+struct CpuFeatures
+{
+    bool sse41 = false;
+    bool avx2 = false;
+    bool fma = false;
+    bool f16c = false;
+    bool avxvnni = false;
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512vl = false;
+    bool avx512vnni = false;
+    std::string brand;
+
+    static CpuFeatures detect()
+    {
+        CpuFeatures f;
+#ifdef QUANTNN_X86
+        unsigned eax, ebx, ecx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        {
+            return f;
+        }
+        f.sse41 = (ecx >> 19) & 1;
+        const bool fma = (ecx >> 12) & 1;
+        const bool f16c = (ecx >> 29) & 1;
+        const bool osxsave = (ecx >> 27) & 1;
+        const bool avx = (ecx >> 28) & 1;
+
+        // the OS must save the YMM (and for AVX-512 the opmask and ZMM) registers
+        uint64_t xcr0 = 0;
+        if (osxsave)
+        {
+            uint32_t lo, hi;
+            __asm__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            xcr0 = (static_cast<uint64_t>(hi) << 32) | lo;
+        }
+        const bool os_avx = (xcr0 & 0x6) == 0x6;
+        const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        {
+            f.avx2 = os_avx && avx && ((ebx >> 5) & 1);
+            f.fma = os_avx && avx && fma;
+            f.f16c = os_avx && avx && f16c;
+            f.avx512f = os_avx512 && ((ebx >> 16) & 1);
+            f.avx512bw = os_avx512 && ((ebx >> 30) & 1);
+            f.avx512vl = os_avx512 && ((ebx >> 31) & 1);
+            f.avx512vnni = os_avx512 && ((ecx >> 11) & 1);
+        }
+        if (__get_cpuid_count(7, 1, &eax, &ebx, &ecx, &edx))
+        {
+            f.avxvnni = os_avx && ((eax >> 4) & 1);
+        }
+
+        unsigned brand[12];
+        if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) && eax >= 0x80000004)
+        {
+            for (unsigned i = 0; i < 3; i++)
+            {
+                __get_cpuid(0x80000002 + i, &brand[4 * i], &brand[4 * i + 1], &brand[4 * i + 2], &brand[4 * i + 3]);
+            }
+            f.brand = std::string(reinterpret_cast<const char *>(brand), strnlen(reinterpret_cast<const char *>(brand), sizeof(brand)));
+            f.brand.erase(0, f.brand.find_first_not_of(' '));
+        }
+#endif
+        return f;
+    }
+};
+
+inline const CpuFeatures & cpu_features()
+{
+    static const CpuFeatures features = CpuFeatures::detect();
+    return features;
+}
+
+inline bool isa_supported(Isa isa)
+{
+    const CpuFeatures & f = cpu_features();
+    const bool avx2 = f.avx2 && f.fma && f.f16c;
+    const bool avx512 = avx2 && f.avx512f && f.avx512bw && f.avx512vl;
+    switch (isa)
+    {
+        case Isa::Scalar: return true;
+#ifdef QUANTNN_X86
+        case Isa::SSE41: return f.sse41;
+        case Isa::AVX2: return avx2;
+        case Isa::AVXVNNI: return avx2 && f.avxvnni;
+        case Isa::AVX512: return avx512;
+        case Isa::AVX512VNNI: return avx512 && f.avx512vnni;
+#endif
+        default: return false;
+    }
+}
+
+// the fastest supported tier that is not above `limit`
+inline Isa best_isa(Isa limit = Isa::AVX512VNNI)
+{
+    for (int i = static_cast<int>(limit); i > 0; i--)
+    {
+        if (isa_supported(static_cast<Isa>(i)))
+        {
+            return static_cast<Isa>(i);
+        }
+    }
+    return Isa::Scalar;
+}
+
+// the tier chosen at startup: best_isa(), or the one QUANTNN_ISA asks for
+inline Isa default_isa()
+{
+    const char * env = getenv("QUANTNN_ISA");
+    if (env == nullptr || *env == '\0')
+    {
+        return best_isa();
+    }
+    Isa requested;
+    if (!parse_isa(env, requested))
+    {
+        std::cerr << "QUANTNN_ISA=" << env << " is not a known ISA tier, using " << isa_name(best_isa()) << std::endl;
+        return best_isa();
+    }
+    Isa isa = best_isa(requested);
+    if (isa != requested)
+    {
+        std::cerr << "QUANTNN_ISA=" << env << " is not supported by this CPU, using " << isa_name(isa) << std::endl;
+    }
+    return isa;
+}
+
+} // namespace quantnn
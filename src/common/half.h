@@ -0,0 +1,148 @@
+#pragma once
+
+// 16-bit floating point storage types for weights.
+//   Half     : IEEE 754 binary16 (1 sign, 5 exponent, 10 mantissa bits), as F16C converts
+//   BFloat16 : the upper half of a binary32 (1 sign, 8 exponent, 7 mantissa bits)
+// Both are only stored; the kernels widen them to float and accumulate in fp32.
+// Narrowing rounds to nearest, ties to even. Widening is exact.
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace quantnn
+{
+
+struct Half
+{
+    uint16_t bits;
+};
+
+struct BFloat16
+{
+    uint16_t bits;
+};
+
+static_assert(sizeof(Half) == 2 && sizeof(BFloat16) == 2, "16-bit storage types");
+
+inline uint32_t float_bits(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+inline float bits_float(uint32_t u)
+{
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+inline float half_to_float(Half h)
+{
+    const uint32_t sign = static_cast<uint32_t>(h.bits & 0x8000) << 16;
+    const uint32_t exponent = (h.bits >> 10) & 0x1f;
+    const uint32_t mantissa = h.bits & 0x3ff;
+    if (exponent == 0)
+    {
+        // zero or subnormal: mantissa * 2^-24, exact in float
+        const float value = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+        return sign != 0 ? -value : value;
+    }
+    if (exponent == 0x1f)
+    {
+        return bits_float(sign | 0x7f800000 | (mantissa << 13));
+    }
+    return bits_float(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+inline Half float_to_half(float f)
+{
+    const uint32_t u = float_bits(f);
+    const uint16_t sign = static_cast<uint16_t>((u >> 16) & 0x8000);
+    const uint32_t abs = u & 0x7fffffff;
+    if (abs >= 0x7f800000)
+    {
+        // inf stays inf, NaN stays a (quiet) NaN
+        return Half { static_cast<uint16_t>(sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0)) };
+    }
+    if (abs >= 0x477ff000)
+    {
+        // rounds to a magnitude of at least 65520, beyond the largest half
+        return Half { static_cast<uint16_t>(sign | 0x7c00) };
+    }
+    if (abs < 0x38800000)
+    {
+        // below the smallest normal half (2^-14): round to a multiple of 2^-24
+        const uint32_t mantissa = (abs & 0x7fffff) | 0x800000;
+        const int shift = 113 - static_cast<int>(abs >> 23) + 13;
+        if (shift > 24)
+        {
+            return Half { sign };
+        }
+        uint32_t value = mantissa >> shift;
+        const uint32_t rest = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (value & 1)))
+        {
+            value++;
+        }
+        return Half { static_cast<uint16_t>(sign | value) };
+    }
+    // normal: rebias the exponent and round the mantissa to 10 bits; a carry out of the
+    // mantissa correctly bumps the exponent
+    uint32_t value = ((abs >> 23) - 112) << 10 | ((abs >> 13) & 0x3ff);
+    const uint32_t rest = abs & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (value & 1)))
+    {
+        value++;
+    }
+    return Half { static_cast<uint16_t>(sign | value) };
+}
+
+inline float bf16_to_float(BFloat16 b)
+{
+    return bits_float(static_cast<uint32_t>(b.bits) << 16);
+}
+
+inline BFloat16 float_to_bf16(float f)
+{
+    const uint32_t u = float_bits(f);
+    if ((u & 0x7fffffff) > 0x7f800000)
+    {
+        return BFloat16 { static_cast<uint16_t>((u >> 16) | 0x40) };
+    }
+    const uint32_t rounded = u + 0x7fff + ((u >> 16) & 1);
+    return BFloat16 { static_cast<uint16_t>(rounded >> 16) };
+}
+
+inline float to_float(Half h) { return half_to_float(h); }
+inline float to_float(BFloat16 b) { return bf16_to_float(b); }
+
+template <typename T>
+std::vector<T> narrow_weights(const float * x, size_t n);
+
+template <>
+inline std::vector<Half> narrow_weights<Half>(const float * x, size_t n)
+{
+    std::vector<Half> out (n);
+    for (size_t i = 0; i < n; i++)
+    {
+        out[i] = float_to_half(x[i]);
+    }
+    return out;
+}
+
+template <>
+inline std::vector<BFloat16> narrow_weights<BFloat16>(const float * x, size_t n)
+{
+    std::vector<BFloat16> out (n);
+    for (size_t i = 0; i < n; i++)
+    {
+        out[i] = float_to_bf16(x[i]);
+    }
+    return out;
+}
+
+} // namespace quantnn
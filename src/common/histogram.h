@@ -0,0 +1,109 @@
+#pragma once
+
+// Latency histogram with a fixed relative precision, in the layout of HdrHistogram:
+// values below 2^kSubBits nanoseconds get a bucket each, and every further power of two
+// is split into 2^(kSubBits-1) equal buckets, so a recorded value is off by less than
+// 1/1024 (three significant digits) from 1 ns up in ~57k counters. Recording is
+// an increment; percentiles walk the cumulative counts. The exact max is kept on the
+// side, and histograms of several threads merge by adding their counts.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace quantnn
+{
+
+class LatencyHistogram
+{
+public:
+    static constexpr int kSubBits = 11;
+    static constexpr uint64_t kSubCount = uint64_t(1) << kSubBits;
+    static constexpr uint64_t kHalfCount = kSubCount / 2;
+    static constexpr int kMaxExponent = 64 - kSubBits + 1;
+
+    LatencyHistogram() : counts(kSubCount + kMaxExponent * kHalfCount, 0) {}
+
+    void record_ns(uint64_t value)
+    {
+        counts[index_of(value)]++;
+        total++;
+        max = std::max(max, value);
+        min = std::min(min, value);
+    }
+
+    void record_us(double value) { record_ns(value <= 0.0 ? 0 : static_cast<uint64_t>(value * 1e3 + 0.5)); }
+
+    void merge(const LatencyHistogram & other)
+    {
+        for (size_t i = 0; i < counts.size(); i++)
+        {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        max = std::max(max, other.max);
+        min = std::min(min, other.min);
+    }
+
+    void reset()
+    {
+        std::fill(counts.begin(), counts.end(), 0);
+        total = 0;
+        max = 0;
+        min = UINT64_MAX;
+    }
+
+    uint64_t count() const { return total; }
+    double max_us() const { return max * 1e-3; }
+    double min_us() const { return total == 0 ? 0.0 : min * 1e-3; }
+
+    // the highest value equivalent to the bucket that holds the p-th percentile, in us
+    double percentile_us(double p) const
+    {
+        if (total == 0)
+        {
+            return 0.0;
+        }
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(p / 100.0 * total + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts.size(); i++)
+        {
+            seen += counts[i];
+            if (seen >= rank)
+            {
+                return std::min(highest_equivalent(i), max) * 1e-3;
+            }
+        }
+        return max * 1e-3;
+    }
+
+private:
+    static size_t index_of(uint64_t value)
+    {
+        if (value < kSubCount)
+        {
+            return static_cast<size_t>(value);
+        }
+        // shift so that value >> e lies in [kHalfCount, kSubCount)
+        const int e = (63 - __builtin_clzll(value)) - (kSubBits - 1);
+        return static_cast<size_t>(kSubCount + (e - 1) * kHalfCount + ((value >> e) - kHalfCount));
+    }
+
+    static uint64_t highest_equivalent(size_t index)
+    {
+        if (index < kSubCount)
+        {
+            return index;
+        }
+        const int e = static_cast<int>((index - kSubCount) / kHalfCount) + 1;
+        const uint64_t lowest = (((index - kSubCount) % kHalfCount) + kHalfCount) << e;
+        return lowest + (uint64_t(1) << e) - 1;
+    }
+
+    std::vector<uint64_t> counts;
+    uint64_t total = 0;
+    uint64_t max = 0;
+    uint64_t min = UINT64_MAX;
+};
+
+} // namespace quantnn
@@ -0,0 +1,108 @@
+#pragma once
+
+// Loader for the MNIST IDX files that torchvision downloads to pytorch/data/MNIST/raw.
+// The files are read through zlib, so both the .gz archives and unpacked copies work.
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+namespace quantnn
+{
+
+struct MnistSet
+{
+    int count = 0;
+    int rows = 0;
+    int cols = 0;
+    std::vector<uint8_t> pixels; // count x rows x cols
+    std::vector<uint8_t> labels;
+
+    int image_size() const { return rows * cols; }
+
+    // the normalization of pytorch/train_*.py: (p / 255 - 0.1307) / 0.3081
+    std::vector<float> normalized() const
+    {
+        std::vector<float> images (pixels.size());
+        for (size_t i = 0; i < pixels.size(); i++)
+        {
+            images[i] = (pixels[i] / 255.0f - 0.1307f) / 0.3081f;
+        }
+        return images;
+    }
+};
+
+namespace mnist_detail
+{
+
+// opens `path`, or `path`.gz when only the archive is there
+inline gzFile open_idx(const std::string & path)
+{
+    gzFile file = gzopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        file = gzopen((path + ".gz").c_str(), "rb");
+    }
+    if (file == nullptr)
+    {
+        throw std::runtime_error("cannot open " + path + "[.gz]");
+    }
+    return file;
+}
+
+inline void read_exact(gzFile file, void * data, size_t size, const std::string & path)
+{
+    if (gzread(file, data, static_cast<unsigned>(size)) != static_cast<int>(size))
+    {
+        gzclose(file);
+        throw std::runtime_error("truncated IDX file " + path);
+    }
+}
+
+// IDX header fields are big-endian
+inline uint32_t read_u32(gzFile file, const std::string & path)
+{
+    uint8_t b[4];
+    read_exact(file, b, 4, path);
+    return (uint32_t(b[0]) << 24) | (uint32_t(b[1]) << 16) | (uint32_t(b[2]) << 8) | uint32_t(b[3]);
+}
+
+} // namespace mnist_detail
+
+// split: "t10k" for the test set, "train" for the training set
+inline MnistSet load_mnist(const std::string & dir, const std::string & split)
+{
+    MnistSet set;
+
+    const std::string image_path = dir + "/" + split + "-images-idx3-ubyte";
+    gzFile images = mnist_detail::open_idx(image_path);
+    if (mnist_detail::read_u32(images, image_path) != 0x00000803)
+    {
+        gzclose(images);
+        throw std::runtime_error(image_path + " is not an IDX image file");
+    }
+    set.count = static_cast<int>(mnist_detail::read_u32(images, image_path));
+    set.rows = static_cast<int>(mnist_detail::read_u32(images, image_path));
+    set.cols = static_cast<int>(mnist_detail::read_u32(images, image_path));
+    set.pixels.resize(static_cast<size_t>(set.count) * set.rows * set.cols);
+    mnist_detail::read_exact(images, set.pixels.data(), set.pixels.size(), image_path);
+    gzclose(images);
+
+    const std::string label_path = dir + "/" + split + "-labels-idx1-ubyte";
+    gzFile labels = mnist_detail::open_idx(label_path);
+    if (mnist_detail::read_u32(labels, label_path) != 0x00000801
+        || mnist_detail::read_u32(labels, label_path) != static_cast<uint32_t>(set.count))
+    {
+        gzclose(labels);
+        throw std::runtime_error(label_path + " does not match " + image_path);
+    }
+    set.labels.resize(set.count);
+    mnist_detail::read_exact(labels, set.labels.data(), set.labels.size(), label_path);
+    gzclose(labels);
+    return set;
+}
+
+} // namespace quantnn
@@ -0,0 +1,387 @@
+#pragma once
+
+// Benchmark history and the statistics to compare runs of it.
+//
+// A PerfRun is one invocation of perf_tracker: when and on which commit, machine and
+// configuration it ran, and for every benchmark a list of timing samples (each the
+// mean of a block of calls). Runs are appended to a text file:
+//
+//   run id=12 time=1760871234 commit=3f73f7d machine=9c1e5a0b7d2f4e61 config=threads=1,...
+//   cpu=<brand string>
+//   sample static/fc1 41.2 41.0 41.9 ...
+//
+// Two runs are compared with a bootstrap confidence interval of the ratio of their
+// medians (compare_samples), and the run medians of a series of runs are searched for
+// shifts with binary segmentation and a permutation test (change_points), which names
+// the first run of the new level.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace quantnn
+{
+
+struct PerfRun
+{
+    int id = 0;
+    int64_t time = 0; // unix seconds
+    std::string commit;
+    std::string machine; // fingerprint, see perf_tracker
+    std::string config;  // comma-separated key=value settings that change the timings
+    std::string cpu;
+    std::map<std::string, std::vector<double>> samples; // benchmark -> us
+
+    // runs are only comparable on the same machine and configuration
+    bool comparable(const PerfRun & other) const { return machine == other.machine && config == other.config; }
+};
+
+class PerfHistory
+{
+public:
+    // a missing file is an empty history
+    void load(const std::string & path)
+    {
+        runs.clear();
+        std::ifstream in(path);
+        if (!in)
+        {
+            return;
+        }
+        std::string line;
+        int line_no = 0;
+        while (std::getline(in, line))
+        {
+            line_no++;
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+            std::istringstream fields(line);
+            std::string kind;
+            fields >> kind;
+            if (kind == "run")
+            {
+                runs.emplace_back();
+                std::string field;
+                while (fields >> field)
+                {
+                    const size_t eq = field.find('=');
+                    const std::string name = field.substr(0, eq);
+                    const std::string value = eq == std::string::npos ? "" : field.substr(eq + 1);
+                    if (name == "id")
+                    {
+                        runs.back().id = std::stoi(value);
+                    }
+                    else if (name == "time")
+                    {
+                        runs.back().time = std::stoll(value);
+                    }
+                    else if (name == "commit")
+                    {
+                        runs.back().commit = value;
+                    }
+                    else if (name == "machine")
+                    {
+                        runs.back().machine = value;
+                    }
+                    else if (name == "config")
+                    {
+                        runs.back().config = value;
+                    }
+                }
+            }
+            else if (runs.empty())
+            {
+                throw std::runtime_error(path + ":" + std::to_string(line_no) + ": record before the first run");
+            }
+            else if (line.compare(0, 4, "cpu=") == 0)
+            {
+                runs.back().cpu = line.substr(4);
+            }
+            else if (kind == "sample")
+            {
+                std::string name;
+                fields >> name;
+                std::vector<double> & values = runs.back().samples[name];
+                double v;
+                while (fields >> v)
+                {
+                    values.push_back(v);
+                }
+            }
+            else
+            {
+                throw std::runtime_error(path + ":" + std::to_string(line_no) + ": unknown record " + kind);
+            }
+        }
+    }
+
+    // appends one run to the file
+    static void append(const std::string & path, const PerfRun & run)
+    {
+        std::ofstream out(path, std::ios::app);
+        if (!out)
+        {
+            throw std::runtime_error("cannot write " + path);
+        }
+        if (out.tellp() == 0)
+        {
+            out << "# quantnn benchmark history, written by perf_tracker (see common/perf_history.h)\n";
+        }
+        out << "run id=" << run.id << " time=" << run.time << " commit=" << run.commit << " machine=" << run.machine
+            << " config=" << run.config << "\n";
+        out << "cpu=" << run.cpu << "\n";
+        for (const auto & kv : run.samples)
+        {
+            out << "sample " << kv.first;
+            char value[32];
+            for (double v : kv.second)
+            {
+                snprintf(value, sizeof(value), " %.3f", v);
+                out << value;
+            }
+            out << "\n";
+        }
+    }
+
+    int next_id() const { return runs.empty() ? 1 : runs.back().id + 1; }
+
+    const PerfRun * find(int id) const
+    {
+        for (const PerfRun & r : runs)
+        {
+            if (r.id == id)
+            {
+                return &r;
+            }
+        }
+        return nullptr;
+    }
+
+    // the runs comparable with `run`, in the order they were recorded
+    std::vector<const PerfRun *> series(const PerfRun & run) const
+    {
+        std::vector<const PerfRun *> out;
+        for (const PerfRun & r : runs)
+        {
+            if (r.comparable(run))
+            {
+                out.push_back(&r);
+            }
+        }
+        return out;
+    }
+
+    std::vector<PerfRun> runs;
+};
+
+inline double median_of(std::vector<double> x)
+{
+    if (x.empty())
+    {
+        return 0.0;
+    }
+    const size_t mid = x.size() / 2;
+    std::nth_element(x.begin(), x.begin() + mid, x.end());
+    const double hi = x[mid];
+    if (x.size() % 2 == 1)
+    {
+        return hi;
+    }
+    return (*std::max_element(x.begin(), x.begin() + mid) + hi) / 2.0;
+}
+
+// percentile bootstrap interval of the median of x
+inline void bootstrap_median(const std::vector<double> & x, double & lo, double & hi, double confidence = 0.95,
+                             int resamples = 2000, uint64_t seed = 1)
+{
+    lo = hi = median_of(x);
+    if (x.size() < 2)
+    {
+        return;
+    }
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, x.size() - 1);
+    std::vector<double> medians (resamples);
+    std::vector<double> y (x.size());
+    for (int r = 0; r < resamples; r++)
+    {
+        for (double & v : y)
+        {
+            v = x[pick(rng)];
+        }
+        medians[r] = median_of(y);
+    }
+    std::sort(medians.begin(), medians.end());
+    const double tail = (1.0 - confidence) / 2.0;
+    lo = medians[static_cast<size_t>(tail * (resamples - 1))];
+    hi = medians[static_cast<size_t>((1.0 - tail) * (resamples - 1))];
+}
+
+enum class PerfVerdict
+{
+    Same,
+    Slower,
+    Faster,
+};
+
+struct PerfComparison
+{
+    double ratio = 1.0; // median(current) / median(baseline)
+    double ratio_lo = 1.0;
+    double ratio_hi = 1.0; // bootstrap confidence interval of ratio
+    PerfVerdict verdict = PerfVerdict::Same;
+};
+
+// Ratio of the medians of current and baseline with a percentile bootstrap interval
+// (both sample sets resampled with replacement). A change is significant when the whole
+// interval lies beyond 1 and the ratio itself differs by at least min_effect, so that
+// tiny but consistent differences are not flagged.
+inline PerfComparison compare_samples(const std::vector<double> & baseline, const std::vector<double> & current,
+                                      double min_effect = 0.02, double confidence = 0.95, int resamples = 2000,
+                                      uint64_t seed = 1)
+{
+    PerfComparison c;
+    if (baseline.empty() || current.empty())
+    {
+        return c;
+    }
+    c.ratio = median_of(current) / median_of(baseline);
+    std::mt19937_64 rng(seed);
+    std::vector<double> ratios (resamples);
+    std::vector<double> a (baseline.size());
+    std::vector<double> b (current.size());
+    std::uniform_int_distribution<size_t> pick_a(0, baseline.size() - 1);
+    std::uniform_int_distribution<size_t> pick_b(0, current.size() - 1);
+    for (int r = 0; r < resamples; r++)
+    {
+        for (double & v : a)
+        {
+            v = baseline[pick_a(rng)];
+        }
+        for (double & v : b)
+        {
+            v = current[pick_b(rng)];
+        }
+        ratios[r] = median_of(b) / median_of(a);
+    }
+    std::sort(ratios.begin(), ratios.end());
+    const double tail = (1.0 - confidence) / 2.0;
+    c.ratio_lo = ratios[static_cast<size_t>(tail * (resamples - 1))];
+    c.ratio_hi = ratios[static_cast<size_t>((1.0 - tail) * (resamples - 1))];
+    if (c.ratio_lo > 1.0 && c.ratio >= 1.0 + min_effect)
+    {
+        c.verdict = PerfVerdict::Slower;
+    }
+    else if (c.ratio_hi < 1.0 && c.ratio <= 1.0 - min_effect)
+    {
+        c.verdict = PerfVerdict::Faster;
+    }
+    return c;
+}
+
+struct ChangePoint
+{
+    size_t index = 0;    // first element of the new level
+    double before = 0.0; // mean level before and after
+    double after = 0.0;
+    double p_value = 1.0;
+};
+
+namespace perf_detail
+{
+
+// the split of x[begin, end) that removes the most squared error, and that reduction
+inline double best_split(const std::vector<double> & x, size_t begin, size_t end, size_t & split)
+{
+    double total = 0.0;
+    for (size_t i = begin; i < end; i++)
+    {
+        total += x[i];
+    }
+    const size_t n = end - begin;
+    double left = 0.0;
+    double best = 0.0;
+    split = begin;
+    for (size_t k = begin + 1; k < end; k++)
+    {
+        left += x[k - 1];
+        const double nl = static_cast<double>(k - begin);
+        const double nr = static_cast<double>(n) - nl;
+        const double diff = left / nl - (total - left) / nr;
+        const double gain = diff * diff * nl * nr / n; // SSE(whole) - SSE(left) - SSE(right)
+        if (gain > best)
+        {
+            best = gain;
+            split = k;
+        }
+    }
+    return best;
+}
+
+inline void segment(const std::vector<double> & x, size_t begin, size_t end, double alpha, int permutations,
+                    std::mt19937_64 & rng, std::vector<ChangePoint> & out)
+{
+    if (end - begin < 3)
+    {
+        return;
+    }
+    size_t split;
+    const double gain = best_split(x, begin, end, split);
+    if (gain <= 0.0)
+    {
+        return;
+    }
+    // how often the best split of a shuffled series removes as much error
+    std::vector<double> shuffled (x.begin() + begin, x.begin() + end);
+    int as_large = 0;
+    for (int p = 0; p < permutations; p++)
+    {
+        std::shuffle(shuffled.begin(), shuffled.end(), rng);
+        size_t unused;
+        as_large += best_split(shuffled, 0, shuffled.size(), unused) >= gain ? 1 : 0;
+    }
+    const double p_value = (1.0 + as_large) / (1.0 + permutations);
+    if (p_value >= alpha)
+    {
+        return;
+    }
+    segment(x, begin, split, alpha, permutations, rng, out);
+    ChangePoint c;
+    c.index = split;
+    c.p_value = p_value;
+    for (size_t i = begin; i < split; i++)
+    {
+        c.before += x[i] / (split - begin);
+    }
+    for (size_t i = split; i < end; i++)
+    {
+        c.after += x[i] / (end - split);
+    }
+    out.push_back(c);
+    segment(x, split, end, alpha, permutations, rng, out);
+}
+
+} // namespace perf_detail
+
+// Level shifts in a series (e.g. the median of one benchmark per run), in order: binary
+// segmentation at the split that removes the most squared error, kept when a
+// permutation test puts its p-value below alpha. A series needs at least 3 points.
+inline std::vector<ChangePoint> change_points(const std::vector<double> & x, double alpha = 0.01, int permutations = 1999,
+                                              uint64_t seed = 1)
+{
+    std::vector<ChangePoint> out;
+    std::mt19937_64 rng(seed);
+    perf_detail::segment(x, 0, x.size(), alpha, permutations, rng, out);
+    return out;
+}
+
+} // namespace quantnn
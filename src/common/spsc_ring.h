@@ -0,0 +1,127 @@
+#pragma once
+
+// Lock-free single-producer / single-consumer ring buffer of preallocated slots.
+//
+// The producer fills a slot in place (try_claim, then publish) and the consumer reads
+// it in place (try_front, then pop), so handing an activation to the next thread copies
+// nothing and never allocates. Head and tail sit on separate cache lines, and each side
+// keeps a private copy of the other side's index so that it only reads the shared line
+// when the ring looks full (producer) or empty (consumer).
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace quantnn
+{
+
+inline void cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+// Spins for a short while, then yields the core, for waits that are usually short.
+class Backoff
+{
+public:
+    void wait()
+    {
+        if (spins < 64)
+        {
+            spins++;
+            cpu_relax();
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    int spins = 0;
+};
+
+template <typename T>
+class SpscRing
+{
+public:
+    // capacity is rounded up to a power of two; every slot starts as a copy of prototype
+    explicit SpscRing(size_t capacity, const T & prototype = T())
+    {
+        size_t n = 1;
+        while (n < capacity)
+        {
+            n <<= 1;
+        }
+        slots.assign(n, prototype);
+        mask = n - 1;
+    }
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing & operator=(const SpscRing &) = delete;
+
+    size_t capacity() const { return slots.size(); }
+
+    // producer: the next free slot, or nullptr when the ring is full
+    T * try_claim()
+    {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head_cache == slots.size())
+        {
+            head_cache = head.load(std::memory_order_acquire);
+            if (t - head_cache == slots.size())
+            {
+                return nullptr;
+            }
+        }
+        return &slots[t & mask];
+    }
+
+    // producer: hands the claimed slot to the consumer
+    void publish()
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // consumer: the oldest published slot, or nullptr when the ring is empty
+    T * try_front()
+    {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail_cache)
+        {
+            tail_cache = tail.load(std::memory_order_acquire);
+            if (h == tail_cache)
+            {
+                return nullptr;
+            }
+        }
+        return &slots[h & mask];
+    }
+
+    // consumer: returns the front slot to the producer
+    void pop()
+    {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    std::vector<T> slots;
+    size_t mask = 0;
+
+    // consumer side
+    alignas(64) std::atomic<size_t> head { 0 };
+    size_t tail_cache = 0;
+
+    // producer side
+    alignas(64) std::atomic<size_t> tail { 0 };
+    size_t head_cache = 0;
+};
+
+} // namespace quantnn
@@ -0,0 +1,293 @@
+#pragma once
+
+// Tensors with 64-byte aligned storage, shape and strides, and quantization parameters.
+//
+//   Tensor<T>      owns its elements (AlignedVector<T>, zero-initialized) and its shape
+//   TensorRef<T>   a non-owning view: a pointer, a shape, strides in elements and the
+//                  quantization parameters; TensorRef<const T> for read-only data
+//
+// A quantized tensor holds q with real = scale * (q - zero_point), either per tensor or
+// per channel along one axis (QuantParams). Views are cheap to copy, and slice(),
+// select() and reshape() return views of the same elements, so a layer can hand a
+// sub-tensor to the next without copying it; the per-channel parameters follow a slice
+// along their axis. Views over model bundles or scratch buffers wrap the pointer as it
+// is; Tensor storage, AlignedVector and the arrays of the generated weight headers
+// (alignas(64) constexpr std::array, see view_of) start on a kTensorAlignment boundary,
+// so kernels given those may use aligned loads.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace quantnn
+{
+
+constexpr size_t kTensorAlignment = 64;
+
+template <typename T>
+struct AlignedAllocator
+{
+    using value_type = T;
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U> &) {}
+
+    T * allocate(size_t n)
+    {
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(kTensorAlignment)));
+    }
+
+    void deallocate(T * p, size_t) { ::operator delete(p, std::align_val_t(kTensorAlignment)); }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U> &) const { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U> &) const { return false; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+inline bool is_aligned(const void * p, size_t alignment = kTensorAlignment)
+{
+    return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+}
+
+struct QuantParams
+{
+    float scale = 1.0f;
+    int32_t zero_point = 0;
+    std::vector<float> scales;        // per channel along axis when not empty
+    std::vector<int32_t> zero_points; // per channel, or all zero_point when empty
+    int axis = 0;
+
+    static QuantParams per_tensor(float scale, int32_t zero_point = 0)
+    {
+        QuantParams q;
+        q.scale = scale;
+        q.zero_point = zero_point;
+        return q;
+    }
+
+    static QuantParams per_channel(std::vector<float> scales, int axis = 0)
+    {
+        QuantParams q;
+        q.scales = std::move(scales);
+        q.axis = axis;
+        return q;
+    }
+
+    bool per_channel() const { return !scales.empty(); }
+    float scale_of(int channel) const { return scales.empty() ? scale : scales[channel]; }
+    int32_t zero_point_of(int channel) const { return zero_points.empty() ? zero_point : zero_points[channel]; }
+
+    // the parameters of channels [begin, end) of `along`
+    QuantParams slice(int along, int begin, int end) const
+    {
+        QuantParams q = *this;
+        if (per_channel() && along == axis)
+        {
+            q.scales.assign(scales.begin() + begin, scales.begin() + end);
+            if (!zero_points.empty())
+            {
+                q.zero_points.assign(zero_points.begin() + begin, zero_points.begin() + end);
+            }
+        }
+        return q;
+    }
+};
+
+// row-major strides of `shape`, in elements
+inline std::vector<int64_t> contiguous_strides(const std::vector<int> & shape)
+{
+    std::vector<int64_t> strides (shape.size());
+    int64_t stride = 1;
+    for (size_t d = shape.size(); d-- > 0;)
+    {
+        strides[d] = stride;
+        stride *= shape[d];
+    }
+    return strides;
+}
+
+inline size_t numel_of(const std::vector<int> & shape)
+{
+    size_t n = 1;
+    for (int d : shape)
+    {
+        n *= static_cast<size_t>(d);
+    }
+    return n;
+}
+
+template <typename T>
+class TensorRef
+{
+public:
+    TensorRef() = default;
+
+    TensorRef(T * data, std::vector<int> shape, QuantParams quant = QuantParams())
+        : ptr{data}, dims{std::move(shape)}, quant_params{std::move(quant)}
+    {
+        steps = contiguous_strides(dims);
+    }
+
+    TensorRef(T * data, std::vector<int> shape, std::vector<int64_t> strides, QuantParams quant)
+        : ptr{data}, dims{std::move(shape)}, steps{std::move(strides)}, quant_params{std::move(quant)}
+    {
+        if (steps.size() != dims.size())
+        {
+            throw std::runtime_error("tensor has " + std::to_string(steps.size()) + " strides for "
+                                     + std::to_string(dims.size()) + " dimensions");
+        }
+    }
+
+    // a view of mutable elements is also a read-only view
+    template <typename U, typename = std::enable_if_t<std::is_same<const U, T>::value && !std::is_same<U, T>::value>>
+    TensorRef(const TensorRef<U> & other)
+        : ptr{other.data()}, dims{other.shape()}, steps{other.strides()}, quant_params{other.quant()}
+    {
+    }
+
+    T * data() const { return ptr; }
+    const std::vector<int> & shape() const { return dims; }
+    const std::vector<int64_t> & strides() const { return steps; }
+    const QuantParams & quant() const { return quant_params; }
+    int ndim() const { return static_cast<int>(dims.size()); }
+    int dim(int d) const { return dims[d]; }
+    size_t numel() const { return numel_of(dims); }
+    bool aligned() const { return is_aligned(ptr); }
+
+    bool contiguous() const { return steps == contiguous_strides(dims); }
+
+    // flat index into contiguous elements
+    T & operator[](size_t i) const { return ptr[i]; }
+    T * begin() const { return ptr; }
+    T * end() const { return ptr + numel(); }
+
+    T & at(std::initializer_list<int> index) const
+    {
+        int64_t offset = 0;
+        int d = 0;
+        for (int i : index)
+        {
+            offset += i * steps[d++];
+        }
+        return ptr[offset];
+    }
+
+    // elements [begin, end) of dimension `d`, same rank
+    TensorRef slice(int d, int begin, int end) const
+    {
+        if (d < 0 || d >= ndim() || begin < 0 || end > dims[d] || begin > end)
+        {
+            throw std::runtime_error("slice [" + std::to_string(begin) + ", " + std::to_string(end) + ") of dimension "
+                                     + std::to_string(d) + " is out of range");
+        }
+        std::vector<int> shape = dims;
+        shape[d] = end - begin;
+        return TensorRef(ptr + begin * steps[d], shape, steps, quant_params.slice(d, begin, end));
+    }
+
+    // element `index` of dimension `d`, one rank less (e.g. one output channel of a conv weight)
+    TensorRef select(int d, int index) const
+    {
+        TensorRef one = slice(d, index, index + 1);
+        one.dims.erase(one.dims.begin() + d);
+        one.steps.erase(one.steps.begin() + d);
+        QuantParams & q = one.quant_params;
+        if (q.per_channel() && q.axis == d)
+        {
+            q.scale = q.scales[0];
+            q.zero_point = q.zero_points.empty() ? q.zero_point : q.zero_points[0];
+            q.scales.clear();
+            q.zero_points.clear();
+        }
+        else if (q.per_channel() && q.axis > d)
+        {
+            q.axis--;
+        }
+        return one;
+    }
+
+    // the same contiguous elements in another shape; per-channel parameters stay on
+    // `quant_axis` of the new shape
+    TensorRef reshape(std::vector<int> shape, int quant_axis = 0) const
+    {
+        if (!contiguous() || numel_of(shape) != numel())
+        {
+            throw std::runtime_error("only a contiguous tensor can be reshaped, to as many elements");
+        }
+        QuantParams q = quant_params;
+        q.axis = quant_axis;
+        return TensorRef(ptr, std::move(shape), q);
+    }
+
+private:
+    T * ptr = nullptr;
+    std::vector<int> dims;
+    std::vector<int64_t> steps;
+    QuantParams quant_params;
+};
+
+// A view of a generated weight array. The arrays are constexpr, so they live in .rodata:
+// the pages are mapped from the executable on first touch and shared between processes,
+// and nothing is copied or run before main.
+template <typename T, size_t N>
+TensorRef<const T> view_of(const std::array<T, N> & values, std::vector<int> shape, QuantParams quant = QuantParams())
+{
+    if (numel_of(shape) != N)
+    {
+        throw std::runtime_error("a view of " + std::to_string(numel_of(shape)) + " elements over an array of "
+                                 + std::to_string(N));
+    }
+    return TensorRef<const T>(values.data(), std::move(shape), std::move(quant));
+}
+
+template <typename T>
+class Tensor
+{
+public:
+    Tensor() = default;
+
+    explicit Tensor(std::vector<int> shape, QuantParams quant = QuantParams())
+        : storage(numel_of(shape)), dims{std::move(shape)}, quant_params{std::move(quant)}
+    {
+    }
+
+    T * data() { return storage.data(); }
+    const T * data() const { return storage.data(); }
+    const std::vector<int> & shape() const { return dims; }
+    int dim(int d) const { return dims[d]; }
+    size_t numel() const { return storage.size(); }
+    QuantParams & quant() { return quant_params; }
+    const QuantParams & quant() const { return quant_params; }
+
+    T & operator[](size_t i) { return storage[i]; }
+    const T & operator[](size_t i) const { return storage[i]; }
+
+    // reuses the storage when it is large enough
+    void resize(std::vector<int> shape)
+    {
+        storage.resize(numel_of(shape));
+        dims = std::move(shape);
+    }
+
+    TensorRef<T> view() { return TensorRef<T>(data(), dims, quant_params); }
+    TensorRef<const T> view() const { return TensorRef<const T>(data(), dims, quant_params); }
+
+private:
+    AlignedVector<T> storage;
+    std::vector<int> dims;
+    QuantParams quant_params;
+};
+
+} // namespace quantnn
@@ -0,0 +1,303 @@
+#pragma once
+
+// Work-stealing thread pool for intra-op parallelism.
+//
+// parallel_for(begin, end, grain, fn) splits [begin, end) into chunks of at least
+// `grain` items, spreads them over per-worker deques and runs fn(lo, hi) on each
+// chunk. The calling thread works too: it drains its own deque and then steals from
+// the workers until every chunk of its call is done. An idle worker takes work from
+// the back of its own deque and steals from the front of the others, so a worker
+// that is descheduled does not hold up the whole layer.
+//
+// Workers persist across calls. They spin for a short while after running out of
+// work, since the next layer usually follows within microseconds, and then sleep.
+//
+// The process-wide pool used by the kernels has QUANTNN_THREADS threads (default 1,
+// which runs every parallel_for inline); set_intra_op_threads() changes it at startup.
+// Chunks are described by a function pointer and a context pointer, so a call does
+// not allocate.
+//
+// Each deque is guarded by one mutex that its owner and the thieves share, so every
+// push, pop and steal takes that lock. The pool has only been checked for correctness
+// on one CPU; its latency gain on 4-16 cores has not been measured yet.
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "common/spsc_ring.h"
+
+namespace quantnn
+{
+
+// chunks smaller than this many multiply-adds are not worth a hand-off to another core
+constexpr double kMinTaskOps = 16384.0;
+
+// the smallest chunk, in items of `ops_per_item` work each, that parallel_for should use
+inline int grain_for(double ops_per_item)
+{
+    return std::max(1, static_cast<int>(kMinTaskOps / std::max(ops_per_item, 1.0)));
+}
+
+class ThreadPool
+{
+public:
+    // threads counts the calling thread, so threads - 1 workers are started
+    explicit ThreadPool(int threads)
+    {
+        threads = std::max(1, threads);
+        for (int i = 0; i < threads; i++)
+        {
+            queues.emplace_back(new Queue);
+        }
+        for (int i = 1; i < threads; i++)
+        {
+            workers.emplace_back([this, i] { run_worker(i); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread & t : workers)
+        {
+            t.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    int size() const { return static_cast<int>(queues.size()); }
+
+    template <typename Fn>
+    void parallel_for(int begin, int end, int grain, Fn && fn)
+    {
+        const int n = end - begin;
+        if (n <= 0)
+        {
+            return;
+        }
+        grain = std::max(1, grain);
+        // a few chunks per thread so that stealing can even out the load
+        const int chunks = std::min((n + grain - 1) / grain, 4 * size());
+        if (chunks <= 1)
+        {
+            fn(begin, end);
+            return;
+        }
+
+        using Body = typename std::remove_reference<Fn>::type;
+        auto run = [](void * ctx, int lo, int hi) { (*static_cast<Body *>(ctx))(lo, hi); };
+        void * ctx = const_cast<void *>(static_cast<const void *>(&fn));
+        std::atomic<int> pending { chunks };
+        const int home = worker_index >= 0 && worker_owner == this ? worker_index : 0;
+        for (int c = 0; c < chunks; c++)
+        {
+            Task task { run, ctx, begin + static_cast<int>(static_cast<long long>(n) * c / chunks),
+                        begin + static_cast<int>(static_cast<long long>(n) * (c + 1) / chunks), &pending };
+            queued.fetch_add(1);
+            if (!queues[(home + c) % size()]->push(task))
+            {
+                queued.fetch_sub(1);
+                execute(task);
+            }
+        }
+        if (sleepers.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            wake.notify_all();
+        }
+
+        // help until every chunk of this call has finished
+        Backoff backoff;
+        while (pending.load(std::memory_order_acquire) > 0)
+        {
+            Task task;
+            if (find_task(home, task))
+            {
+                execute(task);
+            }
+            else
+            {
+                backoff.wait();
+            }
+        }
+    }
+
+private:
+    struct Task
+    {
+        void (*run)(void *, int, int) = nullptr;
+        void * ctx = nullptr;
+        int begin = 0;
+        int end = 0;
+        std::atomic<int> * pending = nullptr;
+    };
+
+    // bounded deque; the owner pushes and pops at the back, thieves take from the front
+    struct alignas(64) Queue
+    {
+        static constexpr size_t kCapacity = 256;
+
+        bool push(const Task & task)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (tail - head == kCapacity)
+            {
+                return false;
+            }
+            tasks[tail++ % kCapacity] = task;
+            return true;
+        }
+
+        bool pop_back(Task & task)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (tail == head)
+            {
+                return false;
+            }
+            task = tasks[--tail % kCapacity];
+            return true;
+        }
+
+        bool steal_front(Task & task)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (tail == head)
+            {
+                return false;
+            }
+            task = tasks[head++ % kCapacity];
+            return true;
+        }
+
+        std::mutex mutex;
+        Task tasks[kCapacity];
+        size_t head = 0;
+        size_t tail = 0;
+    };
+
+    static void execute(const Task & task)
+    {
+        task.run(task.ctx, task.begin, task.end);
+        task.pending->fetch_sub(1, std::memory_order_release);
+    }
+
+    bool find_task(int self, Task & task)
+    {
+        if (queued.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+        bool found = queues[self]->pop_back(task);
+        for (int i = 1; !found && i < size(); i++)
+        {
+            found = queues[(self + i) % size()]->steal_front(task);
+        }
+        if (found)
+        {
+            queued.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return found;
+    }
+
+    void run_worker(int index)
+    {
+        worker_index = index;
+        worker_owner = this;
+        for (;;)
+        {
+            Task task;
+            if (find_task(index, task))
+            {
+                execute(task);
+                continue;
+            }
+
+            bool found = false;
+            for (int spin = 0; spin < kSpinsBeforeSleep && !found; spin++)
+            {
+                cpu_relax();
+                found = queued.load(std::memory_order_relaxed) > 0;
+            }
+            if (found)
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleepers.fetch_add(1);
+            wake.wait(lock, [this] { return stopping || queued.load() > 0; });
+            sleepers.fetch_sub(1);
+            if (stopping)
+            {
+                return;
+            }
+        }
+    }
+
+    // roughly 50-100us of pause instructions
+    static constexpr int kSpinsBeforeSleep = 4000;
+
+    static inline thread_local int worker_index = -1;
+    static inline thread_local const ThreadPool * worker_owner = nullptr;
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<int> queued { 0 };
+    std::atomic<int> sleepers { 0 };
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+};
+
+namespace thread_pool_detail
+{
+
+inline int default_threads()
+{
+    const char * env = getenv("QUANTNN_THREADS");
+    return env != nullptr ? std::max(1, atoi(env)) : 1;
+}
+
+inline std::unique_ptr<ThreadPool> & global_pool()
+{
+    static std::unique_ptr<ThreadPool> pool(new ThreadPool(default_threads()));
+    return pool;
+}
+
+} // namespace thread_pool_detail
+
+inline ThreadPool & intra_op_pool()
+{
+    return *thread_pool_detail::global_pool();
+}
+
+// replaces the process-wide pool; call before any inference is running
+inline void set_intra_op_threads(int threads)
+{
+    if (intra_op_pool().size() != std::max(1, threads))
+    {
+        thread_pool_detail::global_pool().reset(new ThreadPool(threads));
+    }
+}
+
+template <typename Fn>
+void parallel_for(int begin, int end, int grain, Fn && fn)
+{
+    intra_op_pool().parallel_for(begin, end, grain, fn);
+}
+
+} // namespace quantnn
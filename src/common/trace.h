@@ -0,0 +1,325 @@
+#pragma once
+
+// Per-layer tracing.
+//
+// Put QUANTNN_TRACE_SCOPE("conv1") at the top of a layer and every call
+// records its wall time and, on Linux, the cycles / instructions / LLC misses /
+// branch misses spent inside it (via perf_event_open).
+// QUANTNN_TRACE_REPORT(path) writes a Chrome trace-event JSON file (open it in
+// chrome://tracing or https://ui.perfetto.dev) and prints a per-layer summary.
+//
+// Everything compiles to nothing unless QUANTNN_TRACE is defined
+// (cmake -DQUANTNN_TRACE=ON).
+
+#ifdef QUANTNN_TRACE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace quantnn
+{
+
+enum TraceCounter
+{
+    kCycles = 0,
+    kInstructions,
+    kLLCMisses,
+    kBranchMisses,
+    kCounterNum
+};
+
+struct TraceEvent
+{
+    const char * name;
+    uint64_t start_ns;
+    uint64_t dur_ns;
+    uint64_t self_ns;
+    int64_t counters[kCounterNum]; // -1 if the counter is not available
+    uint64_t tid;
+};
+
+// one set of counters per thread, counting user-space events of that thread only
+class PerfCounters
+{
+public:
+    PerfCounters()
+    {
+#ifdef __linux__
+        const uint64_t llc_read_miss = PERF_COUNT_HW_CACHE_LL
+                                     | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                     | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        fds[kCycles] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        fds[kInstructions] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        fds[kLLCMisses] = open_counter(PERF_TYPE_HW_CACHE, llc_read_miss);
+        fds[kBranchMisses] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#else
+        std::fill(fds, fds + kCounterNum, -1);
+#endif
+    }
+
+    ~PerfCounters()
+    {
+#ifdef __linux__
+        for (int i = 0; i < kCounterNum; i++)
+        {
+            if (fds[i] >= 0)
+            {
+                close(fds[i]);
+            }
+        }
+#endif
+    }
+
+    void read(int64_t * values) const
+    {
+        for (int i = 0; i < kCounterNum; i++)
+        {
+            values[i] = -1;
+#ifdef __linux__
+            uint64_t value = 0;
+            if (fds[i] >= 0 && ::read(fds[i], &value, sizeof(value)) == sizeof(value))
+            {
+                values[i] = static_cast<int64_t>(value);
+            }
+#endif
+        }
+    }
+
+private:
+#ifdef __linux__
+    static int open_counter(uint32_t type, uint64_t config)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+    int fds[kCounterNum];
+};
+
+class Tracer
+{
+public:
+    static Tracer & instance()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    uint64_t now_ns() const
+    {
+        auto elapsed = std::chrono::steady_clock::now() - epoch;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+
+    void record(const TraceEvent & event)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back(event);
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.clear();
+    }
+
+    void write_chrome_trace(const std::string & path);
+    void print_summary(std::ostream & os);
+
+    void report(const std::string & path)
+    {
+        write_chrome_trace(path);
+        print_summary(std::cout);
+        std::cout << "Trace written to " << path << std::endl;
+    }
+
+private:
+    Tracer() : epoch{std::chrono::steady_clock::now()} { events.reserve(1 << 12); }
+
+    std::chrono::steady_clock::time_point epoch;
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+};
+
+// RAII scope; nested scopes subtract their time from the parent's self time
+class TraceScope
+{
+public:
+    explicit TraceScope(const char * name) : parent{current()}
+    {
+        event.name = name;
+        event.tid = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        current() = this;
+        counters().read(start_counters);
+        event.start_ns = Tracer::instance().now_ns();
+    }
+
+    ~TraceScope()
+    {
+        uint64_t end_ns = Tracer::instance().now_ns();
+        int64_t end_counters[kCounterNum];
+        counters().read(end_counters);
+
+        event.dur_ns = end_ns - event.start_ns;
+        event.self_ns = event.dur_ns - child_ns;
+        for (int i = 0; i < kCounterNum; i++)
+        {
+            bool valid = start_counters[i] >= 0 && end_counters[i] >= 0;
+            event.counters[i] = valid ? end_counters[i] - start_counters[i] : -1;
+        }
+        if (parent != nullptr)
+        {
+            parent->child_ns += event.dur_ns;
+        }
+        current() = parent;
+        Tracer::instance().record(event);
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope & operator=(const TraceScope &) = delete;
+
+private:
+    static TraceScope *& current()
+    {
+        thread_local TraceScope * scope = nullptr;
+        return scope;
+    }
+
+    static PerfCounters & counters()
+    {
+        thread_local PerfCounters perf_counters;
+        return perf_counters;
+    }
+
+    TraceScope * parent;
+    TraceEvent event;
+    uint64_t child_ns = 0;
+    int64_t start_counters[kCounterNum];
+};
+
+inline void Tracer::write_chrome_trace(const std::string & path)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    static const char * counter_names[kCounterNum] = { "cycles", "instructions", "llc_misses", "branch_misses" };
+
+    std::ofstream ofs(path);
+    ofs << "{\"traceEvents\":[\n";
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        const TraceEvent & e = events[i];
+        char buf[128];
+        snprintf(buf, sizeof(buf), "\"ts\":%.3f,\"dur\":%.3f", e.start_ns / 1e3, e.dur_ns / 1e3);
+        ofs << "{\"name\":\"" << e.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << (e.tid & 0xffff)
+            << "," << buf << ",\"args\":{";
+        bool first = true;
+        for (int c = 0; c < kCounterNum; c++)
+        {
+            if (e.counters[c] < 0)
+            {
+                continue;
+            }
+            ofs << (first ? "" : ",") << "\"" << counter_names[c] << "\":" << e.counters[c];
+            first = false;
+        }
+        ofs << "}}" << (i + 1 < events.size() ? ",\n" : "\n");
+    }
+    ofs << "],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+inline void Tracer::print_summary(std::ostream & os)
+{
+    struct Row
+    {
+        uint64_t calls = 0;
+        uint64_t total_ns = 0;
+        uint64_t self_ns = 0;
+        int64_t counters[kCounterNum] = { 0, 0, 0, 0 };
+        bool has_counters[kCounterNum] = { true, true, true, true };
+        uint64_t first_start_ns = UINT64_MAX;
+    };
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::map<std::string, Row> rows;
+    uint64_t traced_self_ns = 0;
+    for (const TraceEvent & e : events)
+    {
+        Row & row = rows[e.name];
+        row.calls++;
+        row.total_ns += e.dur_ns;
+        row.self_ns += e.self_ns;
+        row.first_start_ns = std::min(row.first_start_ns, e.start_ns);
+        for (int c = 0; c < kCounterNum; c++)
+        {
+            row.has_counters[c] = row.has_counters[c] && e.counters[c] >= 0;
+            row.counters[c] += std::max<int64_t>(e.counters[c], 0);
+        }
+        traced_self_ns += e.self_ns;
+    }
+
+    // layers in the order they were first executed
+    std::vector<std::pair<std::string, Row>> ordered(rows.begin(), rows.end());
+    std::sort(ordered.begin(), ordered.end(), [](const auto & a, const auto & b) {
+        return a.second.first_start_ns < b.second.first_start_ns;
+    });
+
+    auto counter_str = [](const Row & row, int c) {
+        return row.has_counters[c] ? std::to_string(row.counters[c] / static_cast<int64_t>(row.calls)) : std::string("n/a");
+    };
+
+    char line[256];
+    snprintf(line, sizeof(line), "%-16s %6s %11s %11s %7s %12s %12s %6s %10s %10s\n",
+             "layer", "calls", "total[us]", "self[us]", "self%", "cycles/call", "instr/call", "IPC", "llc_miss", "br_miss");
+    os << line;
+    for (const auto & [name, row] : ordered)
+    {
+        char ipc[16] = "n/a";
+        if (row.has_counters[kCycles] && row.has_counters[kInstructions] && row.counters[kCycles] > 0)
+        {
+            snprintf(ipc, sizeof(ipc), "%.2f", static_cast<double>(row.counters[kInstructions]) / row.counters[kCycles]);
+        }
+        double self_pct = traced_self_ns > 0 ? 100.0 * row.self_ns / traced_self_ns : 0.0;
+        snprintf(line, sizeof(line), "%-16s %6llu %11.1f %11.1f %6.1f%% %12s %12s %6s %10s %10s\n",
+                 name.c_str(), static_cast<unsigned long long>(row.calls), row.total_ns / 1e3, row.self_ns / 1e3,
+                 self_pct, counter_str(row, kCycles).c_str(), counter_str(row, kInstructions).c_str(), ipc,
+                 counter_str(row, kLLCMisses).c_str(), counter_str(row, kBranchMisses).c_str());
+        os << line;
+    }
+}
+
+} // namespace quantnn
+
+#define QUANTNN_TRACE_CONCAT_INNER(a, b) a##b
+#define QUANTNN_TRACE_CONCAT(a, b) QUANTNN_TRACE_CONCAT_INNER(a, b)
+#define QUANTNN_TRACE_SCOPE(name) quantnn::TraceScope QUANTNN_TRACE_CONCAT(quantnn_trace_scope_, __LINE__)(name)
+#define QUANTNN_TRACE_REPORT(path) quantnn::Tracer::instance().report(path)
+
+#else
+
+#define QUANTNN_TRACE_SCOPE(name) ((void)0)
+#define QUANTNN_TRACE_REPORT(path) ((void)0)
+
+#endif
@@ -1,9 +1,13 @@
+#include <array>
 #include <iostream>
 #include <vector>
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
-#include <string.h>
+
+#include "common/alloc_tracker.h"
+#include "common/tensor.h"
+#include "common/trace.h"
 
 #include "mnist_conv.h"
 
@@ -13,48 +17,36 @@
 
 #include "data_7.h"
 
-template <typename T>
-struct QuantizedChannelBuffer
-{
-    std::vector<T> q;
-    std::vector<float> s;
-};
-
-template <typename T>
-struct QuantizedBuffer
-{
-    std::vector<T> q;
-    float s;
-    int zp;
-};
+using quantnn::QuantParams;
+using quantnn::Tensor;
+using quantnn::TensorRef;
 
 class MnistConv
 {
 public:
-    MnistConv(const QuantizedChannelBuffer<int8_t> & qconv1, const std::vector<float> & conv1_bias,
-              const QuantizedBuffer<int8_t> & qfc1, const std::vector<float> & fc1_bias,
-              const QuantizedBuffer<int8_t> & qfc2, const std::vector<float> & fc2_bias);
-
-    std::vector<float> padding(std::vector<float> & data);
-    QuantizedBuffer<int8_t> quantize(const std::vector<float> & data);
-    QuantizedBuffer<uint8_t> quantize_uint8(const std::vector<float> & data);
-    QuantizedBuffer<int8_t> conv1(QuantizedBuffer<int8_t> & data);
-    QuantizedBuffer<int8_t> fc1(QuantizedBuffer<int8_t> & data);
-    QuantizedBuffer<uint8_t> relu(QuantizedBuffer<int8_t> & data);
-    std::vector<float> fc2(QuantizedBuffer<uint8_t> & data);
-    int forward(std::vector<float> & data);
+    MnistConv(const TensorRef<const int8_t> & qconv1, const TensorRef<const float> & conv1_bias,
+              const TensorRef<const int8_t> & qfc1, const TensorRef<const float> & fc1_bias,
+              const TensorRef<const int8_t> & qfc2, const TensorRef<const float> & fc2_bias);
+
+    Tensor<int8_t> quantize(const float * data, int n);
+    Tensor<uint8_t> quantize_uint8(const std::vector<float> & data);
+    Tensor<int8_t> conv1(const Tensor<int8_t> & data);
+    Tensor<int8_t> fc1(Tensor<int8_t> & data);
+    Tensor<uint8_t> relu(Tensor<int8_t> & data);
+    std::vector<float> fc2(Tensor<uint8_t> & data);
+    int forward(const float * image, float * logits);
 
 public:
-    const QuantizedChannelBuffer<int8_t> qconv1;
-    const QuantizedBuffer<int8_t> qfc1;
-    const QuantizedBuffer<int8_t> qfc2;
+    // views of the weights in the generated headers, not copies
+    const TensorRef<const int8_t> qconv1;
+    const TensorRef<const int8_t> qfc1;
+    const TensorRef<const int8_t> qfc2;
 
-    const std::vector<float> conv1_bias;
-    const std::vector<float> fc1_bias;
-    const std::vector<float> fc2_bias;
+    const TensorRef<const float> conv1_bias;
+    const TensorRef<const float> fc1_bias;
+    const TensorRef<const float> fc2_bias;
 
     const int image_size = 28;
-    const int padded_image_size = 30;
     const int input_channel_num = 1;
     const int output_channel_num = 5;
     const int kernel_size = 3;
@@ -66,136 +58,143 @@ public:
 };
 
 
-MnistConv::MnistConv(const QuantizedChannelBuffer<int8_t> & qconv1, const std::vector<float> & conv1_bias,
-                     const QuantizedBuffer<int8_t> & qfc1, const std::vector<float> & fc1_bias,
-                     const QuantizedBuffer<int8_t> & qfc2, const std::vector<float> & fc2_bias) 
+MnistConv::MnistConv(const TensorRef<const int8_t> & qconv1, const TensorRef<const float> & conv1_bias,
+                     const TensorRef<const int8_t> & qfc1, const TensorRef<const float> & fc1_bias,
+                     const TensorRef<const int8_t> & qfc2, const TensorRef<const float> & fc2_bias) 
     : qconv1{qconv1}, conv1_bias{conv1_bias}, qfc1{qfc1}, fc1_bias{fc1_bias}, qfc2{qfc2}, fc2_bias{fc2_bias} {}
 
-std::vector<float> MnistConv::padding(std::vector<float> & data)
-{
-    std::vector<float> padded_data(padded_image_size * padded_image_size, 0.0f);
-    for (int i = 0; i < image_size; i++)
-    {
-        float * dst = &padded_data[(i + pad_size) * padded_image_size + pad_size];
-        float * src = &data[i * image_size];
-        memcpy(dst, src, image_size * sizeof(float));
-    }
-    return padded_data;
-}
-
-QuantizedBuffer<int8_t> MnistConv::quantize(const std::vector<float> & data)
+Tensor<int8_t> MnistConv::quantize(const float * data, int n)
 {
-    float min_val = *std::min_element(data.begin(), data.end());
-    float max_val = *std::max_element(data.begin(), data.end());
+    QUANTNN_TRACE_SCOPE("quantize");
+    QUANTNN_ALLOC_SCOPE("quantize");
+    float min_val = *std::min_element(data, data + n);
+    float max_val = *std::max_element(data, data + n);
     float s = std::max(std::abs(max_val), std::abs(min_val)) / 127.0f;
-    std::vector<int8_t> quantized (data.size());
-    for (int i = 0; i < data.size(); i++)
+    Tensor<int8_t> quantized ({ n }, QuantParams::per_tensor(s));
+    for (int i = 0; i < n; i++)
     {
         float qval = std::clamp(std::round(data[i] / s), -127.0f, 127.0f);
         quantized[i] = static_cast<int8_t>(qval);
     }
-    return QuantizedBuffer<int8_t> { quantized, s, 0 };
+    return quantized;
 }
 
-QuantizedBuffer<uint8_t> MnistConv::quantize_uint8(const std::vector<float> & data)
+Tensor<uint8_t> MnistConv::quantize_uint8(const std::vector<float> & data)
 {
+    QUANTNN_TRACE_SCOPE("quantize_uint8");
+    QUANTNN_ALLOC_SCOPE("quantize_uint8");
     float min_val = *std::min_element(data.begin(), data.end());
     float max_val = *std::max_element(data.begin(), data.end());
     float s = (max_val - min_val) / 255.0f;
     int zp = static_cast<int>(std::round(-min_val / s));
     zp = std::clamp(zp, 0, 255);
-    std::vector<uint8_t> quantized (data.size());
+    Tensor<uint8_t> quantized ({ static_cast<int>(data.size()) }, QuantParams::per_tensor(s, zp));
     for (int i = 0; i < data.size(); i++)
     {
         int qval = static_cast<int>(std::round(data[i] / s)) + zp;
         qval = std::clamp(qval, 0, 255);
         quantized[i] = static_cast<uint8_t>(qval);
     }
-    return QuantizedBuffer<uint8_t> { quantized, s, zp };
+    return quantized;
 }
 
-QuantizedBuffer<int8_t> MnistConv::conv1(QuantizedBuffer<int8_t> & data)
+// The image is read in place: the taps of the 3x3 window that fall on the one-pixel zero
+// border are skipped instead of multiplied with a padded copy, which gives the same sums.
+Tensor<int8_t> MnistConv::conv1(const Tensor<int8_t> & data)
 {
-    const int output_size = image_size - kernel_size + 2 * pad_size + 1;
-    std::vector<float> output (output_channel_num * output_size * output_size);
-    const int oW_size = padded_image_size - kernel_size + 1;
-    const int oH_size = padded_image_size - kernel_size + 1;
+    QUANTNN_TRACE_SCOPE("conv1");
+    QUANTNN_ALLOC_SCOPE("conv1");
+    std::vector<float> output (output_channel_num * image_size * image_size);
     for (int o = 0; o < output_channel_num; o++)
     {
-        for (int i = 0; i < oH_size; i++)
+        for (int i = 0; i < image_size; i++)
         {
-            for (int j = 0; j < oW_size; j++)
+            const int k_begin = std::max(0, pad_size - i);
+            const int k_end = std::min(kernel_size, image_size + pad_size - i);
+            for (int j = 0; j < image_size; j++)
             {
+                const int l_begin = std::max(0, pad_size - j);
+                const int l_end = std::min(kernel_size, image_size + pad_size - j);
                 int32_t qval = 0;
-                for (int k = 0; k < kernel_size; k++)
+                for (int k = k_begin; k < k_end; k++)
                 {
-                    for (int l = 0; l < kernel_size; l++)
+                    for (int l = l_begin; l < l_end; l++)
                     {
-                        int target_index = (i + k) * padded_image_size + (j + l);
+                        int target_index = (i + k - pad_size) * image_size + (j + l - pad_size);
                         int weight_index = o * kernel_size * kernel_size + kernel_size * k + l;
-                        qval += static_cast<int32_t>(data.q[target_index]) * static_cast<int32_t>(qconv1.q[weight_index]);
+                        qval += static_cast<int32_t>(data[target_index]) * static_cast<int32_t>(qconv1[weight_index]);
                     }
                 }
-                float rval = qconv1.s[o] * data.s * qval + conv1_bias[o];
-                int output_index = o * oH_size * oW_size + i * oW_size + j;
+                float rval = qconv1.quant().scale_of(o) * data.quant().scale * qval + conv1_bias[o];
+                int output_index = o * image_size * image_size + i * image_size + j;
                 output[output_index] = rval;
             }
         }
     }
-    return quantize(output);
+    return quantize(output.data(), output.size());
 }
 
-QuantizedBuffer<int8_t> MnistConv::fc1(QuantizedBuffer<int8_t> & data)
+Tensor<int8_t> MnistConv::fc1(Tensor<int8_t> & data)
 {
+    QUANTNN_TRACE_SCOPE("fc1");
+    QUANTNN_ALLOC_SCOPE("fc1");
     std::vector<float> output (fc1_hidden_dim);
     for (int i = 0; i < fc1_hidden_dim; i++)
     {
         int32_t qval = 0;
         for (int j = 0; j < fc1_input_dim; j++)
         {
-            qval += static_cast<int32_t>(qfc1.q[i * fc1_input_dim + j]) * static_cast<int32_t>(data.q[j]);
+            qval += static_cast<int32_t>(qfc1[i * fc1_input_dim + j]) * static_cast<int32_t>(data[j]);
         }
-        float value = data.s * qfc1.s * qval + fc1_bias[i];
+        float value = data.quant().scale * qfc1.quant().scale * qval + fc1_bias[i];
         output[i] = value;
     }
-    return quantize(output);
+    return quantize(output.data(), output.size());
 }
 
-std::vector<float> MnistConv::fc2(QuantizedBuffer<uint8_t> & data)
+std::vector<float> MnistConv::fc2(Tensor<uint8_t> & data)
 {
+    QUANTNN_TRACE_SCOPE("fc2");
+    QUANTNN_ALLOC_SCOPE("fc2");
     std::vector<float> output (fc2_hidden_dim);
     for (int i = 0; i < fc2_hidden_dim; i++)
     {
         int32_t qval = 0;
         for (int j = 0; j < fc1_hidden_dim; j++)
         {
-            qval += static_cast<int32_t>(qfc2.q[i * fc1_hidden_dim + j]) * static_cast<int32_t>(data.q[j]);
+            qval += static_cast<int32_t>(qfc2[i * fc1_hidden_dim + j]) * static_cast<int32_t>(data[j]);
         }
-        float value = data.s * qfc2.s * qval + fc2_bias[i];
+        float value = data.quant().scale * qfc2.quant().scale * qval + fc2_bias[i];
         output[i] = value;
     }
     return output;
 }
 
-QuantizedBuffer<uint8_t> MnistConv::relu(QuantizedBuffer<int8_t> & data)
+Tensor<uint8_t> MnistConv::relu(Tensor<int8_t> & data)
 {
+    QUANTNN_TRACE_SCOPE("relu");
+    QUANTNN_ALLOC_SCOPE("relu");
     std::vector<float> output (fc1_hidden_dim);
     for (int i = 0; i < fc1_hidden_dim; i++)
     {
-        float value = static_cast<float>(data.q[i]) * data.s;
+        float value = static_cast<float>(data[i]) * data.quant().scale;
         output[i] = std::max(0.0f, value);
     }
     
     return quantize_uint8(output);
 }
 
-int MnistConv::forward(std::vector<float> & data)
+// image: 28 x 28 normalized pixels, only read; logits: the fc2_hidden_dim outputs
+int MnistConv::forward(const float * image, float * logits)
 {
-    QuantizedBuffer<int8_t> qdata = quantize(padding(data));
+    QUANTNN_TRACE_SCOPE("forward");
+    QUANTNN_ALLOC_SCOPE("forward");
+    Tensor<int8_t> qdata = quantize(image, image_size * image_size);
     qdata = conv1(qdata);
     qdata = fc1(qdata);
-    QuantizedBuffer<uint8_t> uint8_qdata = relu(qdata);
+    Tensor<uint8_t> uint8_qdata = relu(qdata);
     std::vector<float> output = fc2(uint8_qdata);
+    std::copy(output.begin(), output.end(), logits);
 
     int max_index = 0;
     float max_val = 1e-5;
@@ -212,11 +211,24 @@ int MnistConv::forward(std::vector<float> & data)
 
 int main(int argc, char * argv[])
 {
-    const QuantizedChannelBuffer<int8_t> qconv1 { qconv1_weight, qconv1_scale };
-    const QuantizedBuffer<int8_t> qfc1 { qfc1_weight, qfc1_scale };
-    const QuantizedBuffer<int8_t> qfc2 { qfc2_weight, qfc2_scale };
-    MnistConv model(qconv1, conv1_bias, qfc1, fc1_bias, qfc2, fc2_bias);
-    int out = model.forward(data);
+    const QuantParams conv1_quant = QuantParams::per_channel({ qconv1_scale.begin(), qconv1_scale.end() });
+    const TensorRef<const int8_t> qconv1 = quantnn::view_of(qconv1_weight, { 5, 1, 3, 3 }, conv1_quant);
+    const TensorRef<const int8_t> qfc1 = quantnn::view_of(qfc1_weight, { 128, 5 * 28 * 28 }, QuantParams::per_tensor(qfc1_scale));
+    const TensorRef<const int8_t> qfc2 = quantnn::view_of(qfc2_weight, { 10, 128 }, QuantParams::per_tensor(qfc2_scale));
+    MnistConv model(qconv1, quantnn::view_of(conv1_bias, { 5 }), qfc1, quantnn::view_of(fc1_bias, { 128 }),
+                    qfc2, quantnn::view_of(fc2_bias, { 10 }));
+    std::vector<float> logits (model.fc2_hidden_dim);
+#ifdef QUANTNN_TRACK_ALLOC
+    if (argc > 1 && std::string(argv[1]) == "--check-zero-alloc")
+    {
+        bool ok = quantnn::check_zero_alloc([&] { model.forward(data.data(), logits.data()); });
+        QUANTNN_ALLOC_REPORT();
+        return ok ? 0 : 1;
+    }
+#endif
+    int out = model.forward(data.data(), logits.data());
     std::cout << "Prediction: " << out << std::endl;
+    QUANTNN_TRACE_REPORT("conv_dynamic_quantization.trace.json");
+    QUANTNN_ALLOC_REPORT();
     return 0;
 }
@@ -1,3 +1,4 @@
+#include <array>
 #include <vector>
 #include <cmath>
 #include <algorithm>
@@ -5,21 +6,13 @@
 #include <sstream>
 #include <fstream>
 
-#include "mnist_conv.h"
+#include "common/tensor.h"
 
-template<typename T>
-struct QuantizedConvBuffer
-{
-    std::vector<T> q;
-    std::vector<float> s;
-};
+#include "mnist_conv.h"
 
-template<typename T>
-struct QuantizedBuffer
-{
-    std::vector<T> q;
-    float s;
-};
+using quantnn::QuantParams;
+using quantnn::Tensor;
+using quantnn::TensorRef;
 
 struct ConvParams
 {
@@ -29,9 +22,11 @@ struct ConvParams
     int pad_size;
 };
 
-QuantizedConvBuffer<int8_t> quantize_channel_int8(const std::vector<float> & weight, const ConvParams & conv_params)
+// one scale per output channel (axis 0 of the out x 1 x k x k weight)
+Tensor<int8_t> quantize_channel_int8(const TensorRef<const float> & weight, const ConvParams & conv_params)
 {
-    std::vector<int8_t> quantized_weight (weight.size());
+    const int k = conv_params.kernel_size;
+    Tensor<int8_t> quantized_weight ({ conv_params.output_channel_num, 1, k, k });
     std::vector<float> scales (conv_params.output_channel_num);
     for (int i = 0; i < conv_params.output_channel_num; i++)
     {
@@ -54,65 +49,68 @@ QuantizedConvBuffer<int8_t> quantize_channel_int8(const std::vector<float> & wei
         }
         scales[i] = scale;
     }
-    return QuantizedConvBuffer<int8_t> { quantized_weight, scales };
+    quantized_weight.quant() = QuantParams::per_channel(scales);
+    return quantized_weight;
 }
 
-QuantizedBuffer<int8_t> quantize_int8(const std::vector<float> & weight)
+Tensor<int8_t> quantize_int8(const TensorRef<const float> & weight)
 {
     float min_val = 1e+5;
     float max_val = 1e-5;
-    for (int i = 0; i < weight.size(); i++)
+    for (int i = 0; i < weight.numel(); i++)
     {
         min_val = std::min(weight[i], min_val);
         max_val = std::max(weight[i], max_val);
     }
     float scale = std::max(std::abs(max_val), std::abs(min_val)) / 127.0f;
-    std::vector<int8_t> quantized_weight (weight.size());
-    for (int i = 0; i < quantized_weight.size(); i++)
+    Tensor<int8_t> quantized_weight ({ static_cast<int>(weight.numel()) }, QuantParams::per_tensor(scale));
+    for (int i = 0; i < quantized_weight.numel(); i++)
     {
         float qval = std::clamp(std::round(weight[i] / scale), -127.0f, 127.0f);
         quantized_weight[i] = static_cast<int8_t>(qval);
     }
 
-    return QuantizedBuffer<int8_t> { quantized_weight, scale };
+    return quantized_weight;
 }
 
-void dump_as_header_file(const QuantizedBuffer<int8_t> & quantized, const char * prefix, const char * output_file)
+// constexpr arrays, as in src/mlp/dynamic_quantization/quantize_weight.cpp
+void dump_as_header_file(const Tensor<int8_t> & quantized, const char * prefix, const char * output_file)
 {
     std::ostringstream oss;
-    oss << "const std::vector<int8_t> " << prefix << "_weight = { ";
-    for (int i = 0; i < quantized.q.size(); i++)
+    oss << "alignas(64) constexpr std::array<int8_t, " << quantized.numel() << "> " << prefix << "_weight = { ";
+    for (int i = 0; i < quantized.numel(); i++)
     {
-        oss << static_cast<int>(quantized.q[i]);
-        if (i + 1 < quantized.q.size())
+        oss << static_cast<int>(quantized[i]);
+        if (i + 1 < quantized.numel())
         {
             oss << ", ";
         }
     }
 
-    oss << " };\n\nconst float " << prefix << "_scale = " << quantized.s << ";\n";
+    oss << " };\n\nconstexpr float " << prefix << "_scale = " << quantized.quant().scale << ";\n";
     std::ofstream ofs(output_file);
     ofs << oss.str();
     ofs.close();
 }
 
-void dump_as_header_file_conv(const QuantizedConvBuffer<int8_t> & quantized, const char * prefix, const char * output_file)
+void dump_as_header_file_conv(const Tensor<int8_t> & quantized, const char * prefix, const char * output_file)
 {
     std::ostringstream oss;
-    oss << "const std::vector<int8_t> " << prefix << "_weight = { ";
-    for (int i = 0; i < quantized.q.size(); i++)
+    oss << "alignas(64) constexpr std::array<int8_t, " << quantized.numel() << "> " << prefix << "_weight = { ";
+    for (int i = 0; i < quantized.numel(); i++)
     {
-        oss << static_cast<int>(quantized.q[i]);
-        if (i + 1 < quantized.q.size())
+        oss << static_cast<int>(quantized[i]);
+        if (i + 1 < quantized.numel())
         {
             oss << ", ";
         }
     }
 
-    oss << " };\n\nconst std::vector<float> " << prefix << "_scale = { ";
-    for (int i = 0; i < quantized.s.size(); i++)
+    const std::vector<float> & scales = quantized.quant().scales;
+    oss << " };\n\nalignas(64) constexpr std::array<float, " << scales.size() << "> " << prefix << "_scale = { ";
+    for (float s : scales)
     {
-        oss << quantized.s[i] << ", ";
+        oss << s << ", ";
     }
     oss << " };\n";
     std::ofstream ofs(output_file);
@@ -123,9 +121,9 @@ void dump_as_header_file_conv(const QuantizedConvBuffer<int8_t> & quantized, con
 int main()
 {
     ConvParams conv1_params { 5, 3, 1, 1 };
-    QuantizedConvBuffer<int8_t> quantized_conv1 = quantize_channel_int8(conv1_weight, conv1_params);
-    QuantizedBuffer<int8_t> quantized_fc1 = quantize_int8(fc1_weight);
-    QuantizedBuffer<int8_t> quantized_fc2 = quantize_int8(fc2_weight);
+    Tensor<int8_t> quantized_conv1 = quantize_channel_int8(quantnn::view_of(conv1_weight, { 5, 1, 3, 3 }), conv1_params);
+    Tensor<int8_t> quantized_fc1 = quantize_int8(quantnn::view_of(fc1_weight, { 128, 5 * 28 * 28 }));
+    Tensor<int8_t> quantized_fc2 = quantize_int8(quantnn::view_of(fc2_weight, { 10, 128 }));
 
     dump_as_header_file_conv(quantized_conv1, "qconv1", "src/conv/dynamic_quantization/quantized_conv1.h");
     dump_as_header_file(quantized_fc1, "qfc1", "src/conv/dynamic_quantization/quantized_fc1.h");
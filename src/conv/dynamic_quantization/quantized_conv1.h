@@ -1,3 +1,3 @@
-const std::vector<int8_t> qconv1_weight = { 125, 31, 121, -47, -56, -12, -64, -127, 57, -66, 64, -57, -28, -56, 59, 112, 110, 127, -50, 127, 87, 48, 64, -6, 111, 65, 23, -66, 22, -127, -20, 33, -105, 119, 35, 85, -101, -58, 78, -16, 31, 106, -127, -32, 70 };
+alignas(64) constexpr std::array<int8_t, 45> qconv1_weight = { 125, 31, 121, -47, -56, -12, -64, -127, 57, -66, 64, -57, -28, -56, 59, 112, 110, 127, -50, 127, 87, 48, 64, -6, 111, 65, 23, -66, 22, -127, -20, 33, -105, 119, 35, 85, -101, -58, 78, -16, 31, 106, -127, -32, 70 };
 
-const std::vector<float> qconv1_scale = { 0.00346462, 0.00280784, 0.00265714, 0.00338478, 0.00375993,  };
+alignas(64) constexpr std::array<float, 5> qconv1_scale = { 0.00346462, 0.00280784, 0.00265714, 0.00338478, 0.00375993,  };
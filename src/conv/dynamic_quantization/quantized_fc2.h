@@ -1,3 +1,3 @@
-const std::vector<int8_t> qfc2_weight = { -57, -57, 31, -60, -40, -54, 27, -38, 13, 43, -46, -45, 41, -4, 18, 11, -38, 19, 97, -54, 1, 11, -42, -30, -45, 2, -22, 35, 26, 36, -56, 13, 0, 48, 26, 25, 25, 5, 5, 36, 26, 9, -16, -51, 32, -4, -46, -79, -38, -28, 25, -24, 21, -33, 41, 36, 30, -36, 17, 46, 54, -65, -17, -11, 13, -4, -47, 21, -27, 17, 21, -10, 5, 15, 67, -7, 27, -38, 21, -18, -15, -21, -39, 59, 41, 3, -17, -68, 49, -48, -22, -11, -48, 40, 19, 31, -41, 37, -27, 52, 10, 45, -44, -73, -18, 40, -40, -51, 9, -4, 15, 33, 31, 14, 4, -38, -1, 30, -81, -14, -6, 8, -18, 26, 4, -6, 38, -66, -43, 18, -9, -29, 41, 45, -11, -41, -55, 27, -8, -26, 4, 24, -13, -70, 40, 27, -44, 50, -5, 11, -18, 39, -29, 26, -76, 21, 47, -32, 0, -18, -4, -34, -67, 34, -4, 1, 12, -32, -44, -15, -56, 72, -24, 64, -61, 32, -67, 63, 41, -24, -8, -28, 31, -22, -34, -39, -6, -51, 5, -47, -33, 53, 21, -29, 6, -45, -7, -34, -56, -67, 14, 37, 22, 25, -54, -14, -3, -17, -34, 0, -16, -113, -39, 21, 52, 47, 52, 27, -57, 52, 30, -8, -37, 40, -36, -30, 5, 32, -39, 36, 1, 9, 127, 69, -29, 44, 26, -19, 27, -3, 22, 34, 19, 48, 23, -49, 1, 39, -25, -41, -11, -69, 32, -19, -46, 6, -16, -46, 22, -118, 29, 17, 5, -24, -45, 28, 50, -20, 27, 10, -14, 8, -29, 33, 69, -33, -56, 37, 46, -58, -22, -71, 62, -25, 36, -19, 38, 30, 48, -32, 2, -78, -11, 7, 49, 52, 11, -40, 68, 11, -25, 50, -29, 23, -23, -40, 11, -9, -43, -3, -41, -45, -19, 16, 6, 15, 46, -35, -22, 36, 43, 14, 43, 31, 46, -10, -24, 49, -29, -14, 17, -55, 36, -47, 3, 45, 5, -13, -22, -63, 34, 8, 19, -17, 15, -30, -1, 35, 50, 34, -2, -8, 13, 10, 41, 2, 29, -45, -53, 1, -21, 3, -36, -108, 2, 8, 34, 21, 8, -16, 44, -58, -33, 19, 34, 20, 8, -23, 37, -45, 41, -45, 33, -26, -2, 30, 25, -44, 52, -14, -31, -60, -6, 21, -5, -4, 25, -41, 25, -6, 39, 31, -62, 3, -20, 26, -8, -89, -6, -4, -6, 32, 40, 54, -9, -59, 57, -13, 26, 50, -30, 59, -35, -8, 43, 64, -67, -34, -8, 20, 27, 10, 42, -107, -83, 56, -41, -24, -28, -3, -22, -37, 48, -26, -13, 0, -53, -76, -30, 36, -19, 30, -7, -32, 7, 47, -22, -36, -47, -38, 33, 24, -17, 29, -27, 5, 8, 22, -43, -2, 0, -33, -27, 23, -39, 49, -41, 37, -12, -21, 32, -14, -19, -60, -24, -39, 68, -4, 22, -46, -38, 42, -49, -11, 22, 52, 24, 4, 15, 16, -13, -18, 36, 1, -35, -29, -31, -13, 23, 32, -44, 48, -32, 36, 39, -10, -48, -40, 30, -1, -5, -53, -52, 54, 47, -55, 9, 50, 23, -74, -43, 1, -37, -66, -29, 34, 21, 6, 45, -70, 22, -72, 7, 13, -58, 30, 41, -36, -8, -41, 0, 15, -12, -88, 46, 38, -50, 50, -27, -74, -16, 11, 44, -5, -15, 18, 31, -22, -31, -35, 36, -38, 51, 30, 29, 40, 17, 34, -13, 38, -99, -15, -36, -52, 48, 17, 55, 25, -15, 38, -15, -76, 20, 10, 40, -58, -21, 12, -45, 37, -17, 0, 39, 47, 21, -4, 26, -35, -22, 35, -14, 3, 23, 41, -1, -33, 32, -54, -21, 61, -6, 5, -51, 32, -71, -63, -48, 57, 36, 34, 28, -30, -36, -43, 30, -4, 10, 43, 15, 47, 47, 53, -84, 58, -6, -44, -5, -41, 16, -42, -65, -56, 10, -37, -8, 44, -40, 24, -117, 53, -48, 31, -5, 96, -13, 41, -20, 39, 38, -23, 2, 38, -37, -17, 19, -57, 42, 53, 12, -13, 17, 33, -35, -41, 32, -56, 42, 54, 4, -46, -40, -45, 48, -7, 38, -32, -15, -18, 16, 32, -7, -20, -48, 28, 3, 10, -62, 40, 26, -37, -37, -44, -63, 25, -40, 48, 22, 31, -12, -4, -16, -26, -23, 74, -39, 9, 32, -3, -64, 21, 45, -53, 5, 39, 20, 70, -30, -14, 67, -64, -41, -58, -84, 41, -4, 15, -20, 46, -68, 10, 23, 47, 42, 45, -53, 44, 1, 40, 28, 6, -47, 32, -10, 23, -29, -66, -47, 8, -25, 41, -21, 107, -29, -11, 22, 40, 27, 32, -25, 36, -15, 27, -12, -19, 1, -25, -18, 56, 31, -47, 41, -9, -20, -42, 34, 25, 53, 64, -65, 55, -1, -21, -8, 40, -39, -7, 10, 1, -10, 32, -46, -13, 23, -37, -23, 3, -32, 61, -11, -43, 53, 4, 18, -15, -29, 2, 37, 27, 20, -28, 31, -44, 18, 9, -53, 32, 27, -18, -61, -28, -64, -8, 41, 42, 40, -34, -10, -69, -18, -13, -36, 10, -10, -12, -84, -76, 42, -58, -24, 23, 43, -27, -30, -69, 24, -20, 58, -33, 21, 26, -63, -86, 14, -8, -9, -59, 15, 19, 21, -34, 12, -12, 18, 60, -30, 7, -57, 30, -56, 17, 34, 50, -1, -20, -35, -54, 27, -40, 34, -41, 25, -46, -20, -76, -57, -9, 69, -37, -16, -15, 6, -39, -26, 32, 59, -17, 47, -47, -10, 41, 7, 45, -90, -93, 49, 48, 24, 20, 51, 27, 30, 2, -5, 24, -38, -42, 12, 37, 47, -5, -64, -16, -25, -7, 7, -49, 25, -35, 15, 20, -7, -6, 10, -7, -17, -55, -48, -52, -16, 45, -83, -11, -14, 5, 21, 10, 47, 58, 30, 36, 8, 46, -54, 41, -28, -24, 7, 31, 20, -16, 37, 6, 8, -24, 42, -6, 39, 63, 14, -5, 33, 36, 39, 52, -22, 3, 3, -53, -28, -1, 108, 52, 41, -69, 47, -31, -44, -24, 2, -13, 35, 24, 9, 38, -31, -20, 44, 16, -1, 0, 2, 31, 26, 17, 12, 48, 32, 7, 18, 23, -23, 55, -16, 4, -45, -10, 49, 35, -16, 39, -8, -43, 54, -25, 52, 37, 8, -14, 28, -29, -28, 4, 16, -37, -5, -2, 34, 6, 22, -14, 39, -50, 25, 7, 46, 7, -27, -47, -3, 5, 23, -15, 36, -59, 34, -43, 24, 41, -32, -45, -43, -46, 13, 20, -81, 47, 44, -114, -71, -32, 36, -19, -30, -33, -9, -32, -9, 2, -99, 19, -16, -36, 29, 32, 40, -39, -16, 25, -28, 18, -14, 7, -60, 45, 32, -11, 39, -7, 31, -52, -32, -70, -93, 49, -26, 17, -52, -13, -88, -71, -21, -22, -36, -29, -16, -3, -40, 27, -80, -8, -5, 31, -8, -39, 39, 24, -18, 23, 30, 4, 16, 14, 29, 41, 19, -18, -84, -19, 9, -32, 20, 14, -33, -45, 44, -91, 35, 33, -16, 26, -9, 36, 50, -44, 23, -36, -40, 24, 21, -29, -98, 41, -19, -23, -57, 9, 44, 26, 33, 31, -81, 49, -21, -25, 33, 15, -26, -13, -19, 4, 3, 14, 20, 46, -83, 4, 10, -8, 24, 40, -71, 21, 24, 24, 37, -40, -74, 40, 22, 46, -85, 15, 9, 22, -35, -16, -11, -45, -19, 0, -26, -2, -28, 40, -41, 79, -21, 20, 49, 41, 16, -41, 39, -90, -50, 41, 13, 36, 34, 3, 45, -10, -42, 9, 39, 34, -90, -66, -28, 16, -62, -27, 25, 16, -55, 17, 29, -29, -8, 43, 30, 28, -17, -2, 5, 32, 36, 29, -5, -16 };
+alignas(64) constexpr std::array<int8_t, 1280> qfc2_weight = { -57, -57, 31, -60, -40, -54, 27, -38, 13, 43, -46, -45, 41, -4, 18, 11, -38, 19, 97, -54, 1, 11, -42, -30, -45, 2, -22, 35, 26, 36, -56, 13, 0, 48, 26, 25, 25, 5, 5, 36, 26, 9, -16, -51, 32, -4, -46, -79, -38, -28, 25, -24, 21, -33, 41, 36, 30, -36, 17, 46, 54, -65, -17, -11, 13, -4, -47, 21, -27, 17, 21, -10, 5, 15, 67, -7, 27, -38, 21, -18, -15, -21, -39, 59, 41, 3, -17, -68, 49, -48, -22, -11, -48, 40, 19, 31, -41, 37, -27, 52, 10, 45, -44, -73, -18, 40, -40, -51, 9, -4, 15, 33, 31, 14, 4, -38, -1, 30, -81, -14, -6, 8, -18, 26, 4, -6, 38, -66, -43, 18, -9, -29, 41, 45, -11, -41, -55, 27, -8, -26, 4, 24, -13, -70, 40, 27, -44, 50, -5, 11, -18, 39, -29, 26, -76, 21, 47, -32, 0, -18, -4, -34, -67, 34, -4, 1, 12, -32, -44, -15, -56, 72, -24, 64, -61, 32, -67, 63, 41, -24, -8, -28, 31, -22, -34, -39, -6, -51, 5, -47, -33, 53, 21, -29, 6, -45, -7, -34, -56, -67, 14, 37, 22, 25, -54, -14, -3, -17, -34, 0, -16, -113, -39, 21, 52, 47, 52, 27, -57, 52, 30, -8, -37, 40, -36, -30, 5, 32, -39, 36, 1, 9, 127, 69, -29, 44, 26, -19, 27, -3, 22, 34, 19, 48, 23, -49, 1, 39, -25, -41, -11, -69, 32, -19, -46, 6, -16, -46, 22, -118, 29, 17, 5, -24, -45, 28, 50, -20, 27, 10, -14, 8, -29, 33, 69, -33, -56, 37, 46, -58, -22, -71, 62, -25, 36, -19, 38, 30, 48, -32, 2, -78, -11, 7, 49, 52, 11, -40, 68, 11, -25, 50, -29, 23, -23, -40, 11, -9, -43, -3, -41, -45, -19, 16, 6, 15, 46, -35, -22, 36, 43, 14, 43, 31, 46, -10, -24, 49, -29, -14, 17, -55, 36, -47, 3, 45, 5, -13, -22, -63, 34, 8, 19, -17, 15, -30, -1, 35, 50, 34, -2, -8, 13, 10, 41, 2, 29, -45, -53, 1, -21, 3, -36, -108, 2, 8, 34, 21, 8, -16, 44, -58, -33, 19, 34, 20, 8, -23, 37, -45, 41, -45, 33, -26, -2, 30, 25, -44, 52, -14, -31, -60, -6, 21, -5, -4, 25, -41, 25, -6, 39, 31, -62, 3, -20, 26, -8, -89, -6, -4, -6, 32, 40, 54, -9, -59, 57, -13, 26, 50, -30, 59, -35, -8, 43, 64, -67, -34, -8, 20, 27, 10, 42, -107, -83, 56, -41, -24, -28, -3, -22, -37, 48, -26, -13, 0, -53, -76, -30, 36, -19, 30, -7, -32, 7, 47, -22, -36, -47, -38, 33, 24, -17, 29, -27, 5, 8, 22, -43, -2, 0, -33, -27, 23, -39, 49, -41, 37, -12, -21, 32, -14, -19, -60, -24, -39, 68, -4, 22, -46, -38, 42, -49, -11, 22, 52, 24, 4, 15, 16, -13, -18, 36, 1, -35, -29, -31, -13, 23, 32, -44, 48, -32, 36, 39, -10, -48, -40, 30, -1, -5, -53, -52, 54, 47, -55, 9, 50, 23, -74, -43, 1, -37, -66, -29, 34, 21, 6, 45, -70, 22, -72, 7, 13, -58, 30, 41, -36, -8, -41, 0, 15, -12, -88, 46, 38, -50, 50, -27, -74, -16, 11, 44, -5, -15, 18, 31, -22, -31, -35, 36, -38, 51, 30, 29, 40, 17, 34, -13, 38, -99, -15, -36, -52, 48, 17, 55, 25, -15, 38, -15, -76, 20, 10, 40, -58, -21, 12, -45, 37, -17, 0, 39, 47, 21, -4, 26, -35, -22, 35, -14, 3, 23, 41, -1, -33, 32, -54, -21, 61, -6, 5, -51, 32, -71, -63, -48, 57, 36, 34, 28, -30, -36, -43, 30, -4, 10, 43, 15, 47, 47, 53, -84, 58, -6, -44, -5, -41, 16, -42, -65, -56, 10, -37, -8, 44, -40, 24, -117, 53, -48, 31, -5, 96, -13, 41, -20, 39, 38, -23, 2, 38, -37, -17, 19, -57, 42, 53, 12, -13, 17, 33, -35, -41, 32, -56, 42, 54, 4, -46, -40, -45, 48, -7, 38, -32, -15, -18, 16, 32, -7, -20, -48, 28, 3, 10, -62, 40, 26, -37, -37, -44, -63, 25, -40, 48, 22, 31, -12, -4, -16, -26, -23, 74, -39, 9, 32, -3, -64, 21, 45, -53, 5, 39, 20, 70, -30, -14, 67, -64, -41, -58, -84, 41, -4, 15, -20, 46, -68, 10, 23, 47, 42, 45, -53, 44, 1, 40, 28, 6, -47, 32, -10, 23, -29, -66, -47, 8, -25, 41, -21, 107, -29, -11, 22, 40, 27, 32, -25, 36, -15, 27, -12, -19, 1, -25, -18, 56, 31, -47, 41, -9, -20, -42, 34, 25, 53, 64, -65, 55, -1, -21, -8, 40, -39, -7, 10, 1, -10, 32, -46, -13, 23, -37, -23, 3, -32, 61, -11, -43, 53, 4, 18, -15, -29, 2, 37, 27, 20, -28, 31, -44, 18, 9, -53, 32, 27, -18, -61, -28, -64, -8, 41, 42, 40, -34, -10, -69, -18, -13, -36, 10, -10, -12, -84, -76, 42, -58, -24, 23, 43, -27, -30, -69, 24, -20, 58, -33, 21, 26, -63, -86, 14, -8, -9, -59, 15, 19, 21, -34, 12, -12, 18, 60, -30, 7, -57, 30, -56, 17, 34, 50, -1, -20, -35, -54, 27, -40, 34, -41, 25, -46, -20, -76, -57, -9, 69, -37, -16, -15, 6, -39, -26, 32, 59, -17, 47, -47, -10, 41, 7, 45, -90, -93, 49, 48, 24, 20, 51, 27, 30, 2, -5, 24, -38, -42, 12, 37, 47, -5, -64, -16, -25, -7, 7, -49, 25, -35, 15, 20, -7, -6, 10, -7, -17, -55, -48, -52, -16, 45, -83, -11, -14, 5, 21, 10, 47, 58, 30, 36, 8, 46, -54, 41, -28, -24, 7, 31, 20, -16, 37, 6, 8, -24, 42, -6, 39, 63, 14, -5, 33, 36, 39, 52, -22, 3, 3, -53, -28, -1, 108, 52, 41, -69, 47, -31, -44, -24, 2, -13, 35, 24, 9, 38, -31, -20, 44, 16, -1, 0, 2, 31, 26, 17, 12, 48, 32, 7, 18, 23, -23, 55, -16, 4, -45, -10, 49, 35, -16, 39, -8, -43, 54, -25, 52, 37, 8, -14, 28, -29, -28, 4, 16, -37, -5, -2, 34, 6, 22, -14, 39, -50, 25, 7, 46, 7, -27, -47, -3, 5, 23, -15, 36, -59, 34, -43, 24, 41, -32, -45, -43, -46, 13, 20, -81, 47, 44, -114, -71, -32, 36, -19, -30, -33, -9, -32, -9, 2, -99, 19, -16, -36, 29, 32, 40, -39, -16, 25, -28, 18, -14, 7, -60, 45, 32, -11, 39, -7, 31, -52, -32, -70, -93, 49, -26, 17, -52, -13, -88, -71, -21, -22, -36, -29, -16, -3, -40, 27, -80, -8, -5, 31, -8, -39, 39, 24, -18, 23, 30, 4, 16, 14, 29, 41, 19, -18, -84, -19, 9, -32, 20, 14, -33, -45, 44, -91, 35, 33, -16, 26, -9, 36, 50, -44, 23, -36, -40, 24, 21, -29, -98, 41, -19, -23, -57, 9, 44, 26, 33, 31, -81, 49, -21, -25, 33, 15, -26, -13, -19, 4, 3, 14, 20, 46, -83, 4, 10, -8, 24, 40, -71, 21, 24, 24, 37, -40, -74, 40, 22, 46, -85, 15, 9, 22, -35, -16, -11, -45, -19, 0, -26, -2, -28, 40, -41, 79, -21, 20, 49, 41, 16, -41, 39, -90, -50, 41, 13, 36, 34, 3, 45, -10, -42, 9, 39, 34, -90, -66, -28, 16, -62, -27, 25, 16, -55, 17, 29, -29, -8, 43, 30, 28, -17, -2, 5, 32, 36, 29, -5, -16 };
 
-const float qfc2_scale = 0.00199686;
+constexpr float qfc2_scale = 0.00199686;
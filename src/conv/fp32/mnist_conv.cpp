@@ -1,36 +1,41 @@
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <vector>
-#include <string.h>
+
+#include "common/alloc_tracker.h"
+#include "common/tensor.h"
+#include "common/trace.h"
 
 #include "mnist_conv.h"
 #include "data_7.h"
 
+using quantnn::TensorRef;
 
 class MnistConv
 {
 public:
-    MnistConv(const std::vector<float> & conv1_weight, const std::vector<float> & conv1_bias,
-              const std::vector<float> & fc1_weight, const std::vector<float> & fc1_bias,
-              const std::vector<float> & fc2_weight, const std::vector<float> & fc2_bias);
+    MnistConv(const TensorRef<const float> & conv1_weight, const TensorRef<const float> & conv1_bias,
+              const TensorRef<const float> & fc1_weight, const TensorRef<const float> & fc1_bias,
+              const TensorRef<const float> & fc2_weight, const TensorRef<const float> & fc2_bias);
 
-    std::vector<float> padding(std::vector<float> & data);
-    std::vector<float> conv1(std::vector<float> & data);
+    std::vector<float> conv1(const float * image);
     std::vector<float> fc1(std::vector<float> & data);
     std::vector<float> relu(std::vector<float> & data);
     std::vector<float> fc2(std::vector<float> & data);
-    int forward(std::vector<float> & data);
+    int forward(const float * image, float * logits);
 
 public:
-    const std::vector<float> & conv1_weight;
-    const std::vector<float> & fc1_weight;
-    const std::vector<float> & fc2_weight;
+    // views of the arrays in mnist_conv.h
+    const TensorRef<const float> conv1_weight;
+    const TensorRef<const float> fc1_weight;
+    const TensorRef<const float> fc2_weight;
 
-    const std::vector<float> & conv1_bias;
-    const std::vector<float> & fc1_bias;
-    const std::vector<float> & fc2_bias;
+    const TensorRef<const float> conv1_bias;
+    const TensorRef<const float> fc1_bias;
+    const TensorRef<const float> fc2_bias;
 
     const int image_size = 28;
-    const int padded_image_size = 30;
     const int input_channel_num = 1;
     const int output_channel_num = 5;
     const int kernel_size = 3;
@@ -41,47 +46,40 @@ public:
     const int fc2_hidden_dim = 10;
 };
 
-MnistConv::MnistConv(const std::vector<float> & conv1_weight, const std::vector<float> & conv1_bias,
-                     const std::vector<float> & fc1_weight, const std::vector<float> & fc1_bias,
-                     const std::vector<float> & fc2_weight, const std::vector<float> & fc2_bias)
+MnistConv::MnistConv(const TensorRef<const float> & conv1_weight, const TensorRef<const float> & conv1_bias,
+                     const TensorRef<const float> & fc1_weight, const TensorRef<const float> & fc1_bias,
+                     const TensorRef<const float> & fc2_weight, const TensorRef<const float> & fc2_bias)
     : conv1_weight{conv1_weight}, conv1_bias{conv1_bias}, fc1_weight{fc1_weight}, fc1_bias{fc1_bias},
       fc2_weight{fc2_weight}, fc2_bias{fc2_bias} {}
 
-std::vector<float> MnistConv::padding(std::vector<float> & data)
+// The image is read in place: the taps of the 3x3 window that fall on the one-pixel zero
+// border are skipped instead of multiplied with a padded copy, which gives the same sums.
+std::vector<float> MnistConv::conv1(const float * image)
 {
-    std::vector<float> padded_data(padded_image_size * padded_image_size, 0.0f);
-    for (int i = 0; i < image_size; i++)
-    {
-        float * dst = &padded_data[(i + pad_size) * padded_image_size + pad_size];
-        float * src = &data[i * image_size];
-        memcpy(dst, src, image_size * sizeof(float));
-    }
-    return padded_data;
-}
-
-std::vector<float> MnistConv::conv1(std::vector<float> & data)
-{
-    const int output_size = image_size - kernel_size + 2 * pad_size + 1;
-    std::vector<float> output (output_channel_num * output_size * output_size);
-    const int oW_size = padded_image_size - kernel_size + 1;
-    const int oH_size = padded_image_size - kernel_size + 1;
+    QUANTNN_TRACE_SCOPE("conv1");
+    QUANTNN_ALLOC_SCOPE("conv1");
+    std::vector<float> output (output_channel_num * image_size * image_size);
     for (int o = 0; o < output_channel_num; o++)
     {
-        for (int i = 0; i < oH_size; i++)
+        for (int i = 0; i < image_size; i++)
         {
-            for (int j = 0; j < oW_size; j++)
+            const int k_begin = std::max(0, pad_size - i);
+            const int k_end = std::min(kernel_size, image_size + pad_size - i);
+            for (int j = 0; j < image_size; j++)
             {
+                const int l_begin = std::max(0, pad_size - j);
+                const int l_end = std::min(kernel_size, image_size + pad_size - j);
                 float val = 0.0f;
-                for (int k = 0; k < kernel_size; k++)
+                for (int k = k_begin; k < k_end; k++)
                 {
-                    for (int l = 0; l < kernel_size; l++)
+                    for (int l = l_begin; l < l_end; l++)
                     {
-                        int target_index = (i + k) * padded_image_size + (j + l);
+                        int target_index = (i + k - pad_size) * image_size + (j + l - pad_size);
                         int weight_index = o * kernel_size * kernel_size + kernel_size * k + l;
-                        val += data[target_index] * conv1_weight[weight_index];
+                        val += image[target_index] * conv1_weight[weight_index];
                     }
                 }
-                int output_index = o * oH_size * oW_size + i * oW_size + j;
+                int output_index = o * image_size * image_size + i * image_size + j;
                 output[output_index] = val + conv1_bias[o];
             }
         }
@@ -91,6 +89,8 @@ std::vector<float> MnistConv::conv1(std::vector<float> & data)
 
 std::vector<float> MnistConv::fc1(std::vector<float> & data)
 {
+    QUANTNN_TRACE_SCOPE("fc1");
+    QUANTNN_ALLOC_SCOPE("fc1");
     std::vector<float> fc1_output (fc1_hidden_dim);
     for (int i = 0; i < fc1_hidden_dim; i++)
     {
@@ -106,6 +106,8 @@ std::vector<float> MnistConv::fc1(std::vector<float> & data)
 
 std::vector<float> MnistConv::relu(std::vector<float> & data)
 {
+    QUANTNN_TRACE_SCOPE("relu");
+    QUANTNN_ALLOC_SCOPE("relu");
     for (int i = 0; i < fc1_hidden_dim; i++)
     {
         data[i] = std::max(0.0f, data[i]);
@@ -115,6 +117,8 @@ std::vector<float> MnistConv::relu(std::vector<float> & data)
 
 std::vector<float> MnistConv::fc2(std::vector<float> & data)
 {
+    QUANTNN_TRACE_SCOPE("fc2");
+    QUANTNN_ALLOC_SCOPE("fc2");
     std::vector<float> fc2_output (fc2_hidden_dim);
     for (int i = 0; i < fc2_hidden_dim; i++)
     {
@@ -128,22 +132,25 @@ std::vector<float> MnistConv::fc2(std::vector<float> & data)
     return fc2_output;
 }
 
-int MnistConv::forward(std::vector<float> & data)
+// image: 28 x 28 normalized pixels, only read; logits: the fc2_hidden_dim outputs
+int MnistConv::forward(const float * image, float * logits)
 {
-    data = padding(data);
-    data = conv1(data);
+    QUANTNN_TRACE_SCOPE("forward");
+    QUANTNN_ALLOC_SCOPE("forward");
+    std::vector<float> data = conv1(image);
     data = fc1(data);
     data = relu(data);
     data = fc2(data);
+    std::copy(data.begin(), data.end(), logits);
 
     int max_index = 0;
     float max_val = -1e+5;
-    for (int i = 0; i < data.size(); i++)
+    for (int i = 0; i < fc2_hidden_dim; i++)
     {
-        if (data[i] > max_val)
+        if (logits[i] > max_val)
         {
             max_index = i;
-            max_val = data[i];
+            max_val = logits[i];
         }
     }
     return max_index;
@@ -151,8 +158,21 @@ int MnistConv::forward(std::vector<float> & data)
 
 int main(int argc, char * argv[])
 {
-    MnistConv model(conv1_weight, conv1_bias, fc1_weight, fc1_bias, fc2_weight, fc2_bias);
-    int out = model.forward(data);
+    MnistConv model(quantnn::view_of(conv1_weight, { 5, 1, 3, 3 }), quantnn::view_of(conv1_bias, { 5 }),
+                    quantnn::view_of(fc1_weight, { 128, 5 * 28 * 28 }), quantnn::view_of(fc1_bias, { 128 }),
+                    quantnn::view_of(fc2_weight, { 10, 128 }), quantnn::view_of(fc2_bias, { 10 }));
+    std::vector<float> logits (model.fc2_hidden_dim);
+#ifdef QUANTNN_TRACK_ALLOC
+    if (argc > 1 && std::string(argv[1]) == "--check-zero-alloc")
+    {
+        bool ok = quantnn::check_zero_alloc([&] { model.forward(data.data(), logits.data()); });
+        QUANTNN_ALLOC_REPORT();
+        return ok ? 0 : 1;
+    }
+#endif
+    int out = model.forward(data.data(), logits.data());
     std::cout << "Prediction: " << out << std::endl;
+    QUANTNN_TRACE_REPORT("conv_float32.trace.json");
+    QUANTNN_ALLOC_REPORT();
     return 0;
 }
@@ -1,10 +1,15 @@
+#include <array>
 #include <iostream>
 #include <vector>
 #include <cstring>
 
+#include "common/tensor.h"
+
 #include "mnist_conv.h"
 #include "calibration_data.h"
 
+using quantnn::TensorRef;
+
 struct Scale
 {
     float input_scale;
@@ -47,25 +52,25 @@ float calculate_scale_uint8(std::vector<std::vector<float>> & data)
 class MnistConv
 {
 public:
-    MnistConv(const std::vector<float> & conv1_weight, const std::vector<float> & conv1_bias,
-              const std::vector<float> & fc1_weight, const std::vector<float> & fc1_bias,
-              const std::vector<float> & fc2_weight, const std::vector<float> & fc2_bias);
+    MnistConv(const TensorRef<const float> & conv1_weight, const TensorRef<const float> & conv1_bias,
+              const TensorRef<const float> & fc1_weight, const TensorRef<const float> & fc1_bias,
+              const TensorRef<const float> & fc2_weight, const TensorRef<const float> & fc2_bias);
 
-    std::vector<std::vector<float>> padding(std::vector<std::vector<float>> & data);
+    std::vector<std::vector<float>> padding(const TensorRef<const float> & data);
     std::vector<std::vector<float>> conv1(std::vector<std::vector<float>> & data);
     std::vector<std::vector<float>> fc1(std::vector<std::vector<float>> & data);
     std::vector<std::vector<float>> relu(std::vector<std::vector<float>> & data);
     std::vector<std::vector<float>> fc2(std::vector<std::vector<float>> & data);
-    Scale calibrate(std::vector<std::vector<float>> & data);
+    Scale calibrate(const TensorRef<const float> & data);
 
 public:
-    const std::vector<float> & conv1_weight;
-    const std::vector<float> & fc1_weight;
-    const std::vector<float> & fc2_weight;
+    const TensorRef<const float> conv1_weight;
+    const TensorRef<const float> fc1_weight;
+    const TensorRef<const float> fc2_weight;
 
-    const std::vector<float> & conv1_bias;
-    const std::vector<float> & fc1_bias;
-    const std::vector<float> & fc2_bias;
+    const TensorRef<const float> conv1_bias;
+    const TensorRef<const float> fc1_bias;
+    const TensorRef<const float> fc2_bias;
 
     const int image_size = 28;
     const int padded_image_size = 30;
@@ -79,22 +84,24 @@ public:
     const int fc2_hidden_dim = 10;
 };
 
-MnistConv::MnistConv(const std::vector<float> & conv1_weight, const std::vector<float> & conv1_bias,
-                     const std::vector<float> & fc1_weight, const std::vector<float> & fc1_bias,
-                     const std::vector<float> & fc2_weight, const std::vector<float> & fc2_bias)
+MnistConv::MnistConv(const TensorRef<const float> & conv1_weight, const TensorRef<const float> & conv1_bias,
+                     const TensorRef<const float> & fc1_weight, const TensorRef<const float> & fc1_bias,
+                     const TensorRef<const float> & fc2_weight, const TensorRef<const float> & fc2_bias)
     : conv1_weight{conv1_weight}, conv1_bias{conv1_bias}, fc1_weight{fc1_weight}, fc1_bias{fc1_bias},
       fc2_weight{fc2_weight}, fc2_bias{fc2_bias} {}
 
-std::vector<std::vector<float>> MnistConv::padding(std::vector<std::vector<float>> & data)
+// data: count x 784, one image per row
+std::vector<std::vector<float>> MnistConv::padding(const TensorRef<const float> & data)
 {
-    std::vector<std::vector<float>> padded_data_list (data.size());
-    for (int i = 0; i < data.size(); i++)
+    std::vector<std::vector<float>> padded_data_list (data.dim(0));
+    for (int i = 0; i < data.dim(0); i++)
     {
         std::vector<float> padded_data(padded_image_size * padded_image_size, 0.0f);
+        const TensorRef<const float> image = data.select(0, i);
         for (int j = 0; j < image_size; j++)
         {
             float * dst = &padded_data[(j + pad_size) * padded_image_size + pad_size];
-            float * src = &data[i][j * image_size];
+            const float * src = &image[j * image_size];
             memcpy(dst, src, image_size * sizeof(float));
         }
         padded_data_list[i] = padded_data;
@@ -189,13 +196,13 @@ std::vector<std::vector<float>> MnistConv::fc2(std::vector<std::vector<float>> &
     return fc2_output_list;
 }
 
-Scale MnistConv::calibrate(std::vector<std::vector<float>> & data)
+Scale MnistConv::calibrate(const TensorRef<const float> & data)
 {
     std::vector<std::vector<float>> padded_data = padding(data);
     float input_scale = calculate_scale_int8(padded_data);
     std::vector<std::vector<float>> conv1_data = conv1(padded_data);
     float conv1_scale = calculate_scale_int8(conv1_data);
-    std::vector<std::vector<float>> fc1_data = fc1(data);
+    std::vector<std::vector<float>> fc1_data = fc1(conv1_data);
     float fc1_scale = calculate_scale_int8(fc1_data);
     std::vector<std::vector<float>> relu_data = relu(fc1_data);
     float relu_scale = calculate_scale_uint8(relu_data);
@@ -207,8 +214,10 @@ Scale MnistConv::calibrate(std::vector<std::vector<float>> & data)
 
 int main(int argc, char * argv[])
 {
-    MnistConv model(conv1_weight, conv1_bias, fc1_weight, fc1_bias, fc2_weight, fc2_bias);
-    Scale scale = model.calibrate(calibration_data);
+    MnistConv model(quantnn::view_of(conv1_weight, { 5, 1, 3, 3 }), quantnn::view_of(conv1_bias, { 5 }),
+                    quantnn::view_of(fc1_weight, { 128, 5 * 28 * 28 }), quantnn::view_of(fc1_bias, { 128 }),
+                    quantnn::view_of(fc2_weight, { 10, 128 }), quantnn::view_of(fc2_bias, { 10 }));
+    Scale scale = model.calibrate(quantnn::view_of(calibration_data, { calibration_count, 28 * 28 }));
     
     float input_scale = scale.input_scale;
     float conv1_scale = scale.conv1_scale;
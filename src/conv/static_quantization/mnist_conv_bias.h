@@ -1,3 +1,3 @@
-const std::vector<float> conv1_bias = { 0.03777122497558594,0.3034282326698303,0.21036511659622192,0.1992756873369217,-0.07911112159490585 };
-const std::vector<float> fc1_bias = { -0.004467110615223646,-0.013618887402117252,-0.01173732616007328,-0.011809236370027065,0.0027790945023298264,0.0014297737507149577,0.004538386594504118,-0.0013652165653184056,0.006249391473829746,-0.004059141501784325,0.004208856727927923,0.00584980845451355,0.0016955520259216428,-0.009176156483590603,0.008721686899662018,-0.019402431324124336,-0.0035659740678966045,0.022770127281546593,-0.01261807233095169,0.00616110535338521,0.002057024510577321,-0.015866905450820923,-0.006716967560350895,-0.006878366693854332,-0.012310606427490711,0.029370754957199097,-0.012869949452579021,0.004545798525214195,0.0030200183391571045,0.006481838412582874,-0.004976615309715271,0.029194306582212448,-0.0053219785913825035,0.014614296145737171,-0.015266031958162785,0.0006018573767505586,-0.013416036032140255,0.014407804235816002,0.018472429364919662,-0.017546433955430984,-0.016969213262200356,0.01889381930232048,0.018770575523376465,0.006451610941439867,-0.014355956576764584,-0.00010918949556071311,-0.00890311785042286,0.02448313683271408,0.0018793586641550064,0.010965111665427685,-0.002068642992526293,-0.006994115654379129,0.004205347970128059,-0.016220537945628166,-0.02000860497355461,-0.015085570514202118,-0.019697202369570732,-0.011582237668335438,0.003129175864160061,-0.006612455006688833,0.016511345282197,-0.01941198855638504,-0.0063678547739982605,0.012348060496151447,0.006947499234229326,-0.012239202857017517,0.010858043096959591,-0.0008645830675959587,0.008680305443704128,0.0014896915527060628,0.018934855237603188,0.013894053176045418,-0.00804136786609888,-0.016744202002882957,0.010847304947674274,0.009945470839738846,0.003989724442362785,0.014081793837249279,-0.000770369078963995,-0.0039132158271968365,-0.007081673946231604,0.0037966647651046515,0.009323963895440102,-0.017958395183086395,-0.008663610555231571,-0.0001719310093903914,-0.002341665094718337,0.009095204062759876,0.016999296844005585,0.010319085791707039,0.014206117019057274,0.010421649552881718,0.00042192579712718725,-0.007262866478413343,-0.019146272912621498,0.026813380420207977,-0.01074558962136507,0.018801052123308182,0.023007219657301903,-0.006146032363176346,-0.0212648157030344,0.007949745282530785,0.024344686418771744,0.013566456735134125,0.00956153217703104,0.020182373002171516,-0.009346849285066128,0.006987650878727436,0.007508559618145227,-0.010747749358415604,0.004936011973768473,0.013353463262319565,0.015731297433376312,-0.008544322103261948,0.028277264907956123,0.012304448522627354,-0.009338264353573322,0.008611181750893593,0.012572864070534706,-0.004863528534770012,0.006707267835736275,-0.021021822467446327,-0.007882638834416866,0.0047022560611367226,-0.004508625715970993,0.0077723790891468525,-0.00617575878277421,0.015659013763070107 };
-const std::vector<float> fc2_bias = { 0.0624246783554554,-0.057171471416950226,0.025689395144581795,-0.0752389058470726,-0.013692039996385574,-0.05665803328156471,-0.03250453248620033,-0.06157593056559563,-0.010360932908952236,-0.0259233471006155 };
+alignas(64) constexpr std::array<float, 5> conv1_bias = { 0.03777122497558594,0.3034282326698303,0.21036511659622192,0.1992756873369217,-0.07911112159490585 };
+alignas(64) constexpr std::array<float, 128> fc1_bias = { -0.004467110615223646,-0.013618887402117252,-0.01173732616007328,-0.011809236370027065,0.0027790945023298264,0.0014297737507149577,0.004538386594504118,-0.0013652165653184056,0.006249391473829746,-0.004059141501784325,0.004208856727927923,0.00584980845451355,0.0016955520259216428,-0.009176156483590603,0.008721686899662018,-0.019402431324124336,-0.0035659740678966045,0.022770127281546593,-0.01261807233095169,0.00616110535338521,0.002057024510577321,-0.015866905450820923,-0.006716967560350895,-0.006878366693854332,-0.012310606427490711,0.029370754957199097,-0.012869949452579021,0.004545798525214195,0.0030200183391571045,0.006481838412582874,-0.004976615309715271,0.029194306582212448,-0.0053219785913825035,0.014614296145737171,-0.015266031958162785,0.0006018573767505586,-0.013416036032140255,0.014407804235816002,0.018472429364919662,-0.017546433955430984,-0.016969213262200356,0.01889381930232048,0.018770575523376465,0.006451610941439867,-0.014355956576764584,-0.00010918949556071311,-0.00890311785042286,0.02448313683271408,0.0018793586641550064,0.010965111665427685,-0.002068642992526293,-0.006994115654379129,0.004205347970128059,-0.016220537945628166,-0.02000860497355461,-0.015085570514202118,-0.019697202369570732,-0.011582237668335438,0.003129175864160061,-0.006612455006688833,0.016511345282197,-0.01941198855638504,-0.0063678547739982605,0.012348060496151447,0.006947499234229326,-0.012239202857017517,0.010858043096959591,-0.0008645830675959587,0.008680305443704128,0.0014896915527060628,0.018934855237603188,0.013894053176045418,-0.00804136786609888,-0.016744202002882957,0.010847304947674274,0.009945470839738846,0.003989724442362785,0.014081793837249279,-0.000770369078963995,-0.0039132158271968365,-0.007081673946231604,0.0037966647651046515,0.009323963895440102,-0.017958395183086395,-0.008663610555231571,-0.0001719310093903914,-0.002341665094718337,0.009095204062759876,0.016999296844005585,0.010319085791707039,0.014206117019057274,0.010421649552881718,0.00042192579712718725,-0.007262866478413343,-0.019146272912621498,0.026813380420207977,-0.01074558962136507,0.018801052123308182,0.023007219657301903,-0.006146032363176346,-0.0212648157030344,0.007949745282530785,0.024344686418771744,0.013566456735134125,0.00956153217703104,0.020182373002171516,-0.009346849285066128,0.006987650878727436,0.007508559618145227,-0.010747749358415604,0.004936011973768473,0.013353463262319565,0.015731297433376312,-0.008544322103261948,0.028277264907956123,0.012304448522627354,-0.009338264353573322,0.008611181750893593,0.012572864070534706,-0.004863528534770012,0.006707267835736275,-0.021021822467446327,-0.007882638834416866,0.0047022560611367226,-0.004508625715970993,0.0077723790891468525,-0.00617575878277421,0.015659013763070107 };
+alignas(64) constexpr std::array<float, 10> fc2_bias = { 0.0624246783554554,-0.057171471416950226,0.025689395144581795,-0.0752389058470726,-0.013692039996385574,-0.05665803328156471,-0.03250453248620033,-0.06157593056559563,-0.010360932908952236,-0.0259233471006155 };
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/engine.h"
+#include "engine/model_bundle.h"
+
+#include "kernels/activation.h"
+#include "kernels/conv.h"
+#include "kernels/linear.h"
+#include "kernels/quantize.h"
+
+namespace quantnn
+{
+
+// int8 weights; every activation is quantized with a scale computed from its own
+// absolute maximum (symmetric int8) or maximum (ReLU output, uint8).
+class DynamicInt8Engine : public Engine
+{
+public:
+    explicit DynamicInt8Engine(std::shared_ptr<const ModelBundle> bundle)
+        : bundle{bundle}, shape{MnistNet::from_bundle(*bundle)}
+    {
+        if (shape.conv)
+        {
+            qconv1_weight = bundle->get("conv1.qweight").as<int8_t>();
+            conv1_scale = bundle->get("conv1.wscale").as<float>();
+            conv1_bias = bundle->get("conv1.bias").as<float>();
+            se = SqueezeExcite::from_bundle(*bundle, "conv1.se", shape.conv_out_c);
+        }
+        qfc1_weight = bundle->get("fc1.qweight").as<int8_t>();
+        fc1_scale = bundle->get("fc1.wscale").as<float>()[0];
+        fc1_bias = bundle->get("fc1.bias").as<float>();
+        qfc2_weight = bundle->get("fc2.qweight").as<int8_t>();
+        fc2_scale = bundle->get("fc2.wscale").as<float>()[0];
+        fc2_bias = bundle->get("fc2.bias").as<float>();
+    }
+
+    std::string name() const override { return shape.conv ? "conv_dynamic" : "mlp_dynamic"; }
+    const MnistNet & net() const override { return shape; }
+
+    // features: fc1_in int8 values followed by their float scale
+    size_t feature_bytes() const override { return scale_offset() + sizeof(float); }
+
+    void forward_features(const float * image, void * features) const override
+    {
+        const float * x = image;
+        if (shape.conv)
+        {
+            float * conv_out = scratch<float>(1, shape.fc1_in);
+            conv1(image, conv_out);
+            x = conv_out;
+        }
+        uint8_t * out = static_cast<uint8_t *>(features);
+        float s = quantize_dynamic(x, shape.fc1_in, reinterpret_cast<int8_t *>(out));
+        memcpy(&out[scale_offset()], &s, sizeof(float));
+    }
+
+    void forward_classifier(const void * features, int batch, float * logits) const override
+    {
+        const int in = shape.fc1_in;
+        const int hidden_dim = shape.fc1_out;
+        const uint8_t * blocks = static_cast<const uint8_t *>(features);
+        const size_t bytes = feature_bytes();
+
+        // gather the int8 rows into one contiguous batch x in matrix
+        int8_t * qx = scratch<int8_t>(0, static_cast<size_t>(batch) * in);
+        float * x_scale = scratch<float>(0, batch);
+        for (int b = 0; b < batch; b++)
+        {
+            memcpy(&qx[b * in], &blocks[b * bytes], in);
+            memcpy(&x_scale[b], &blocks[b * bytes + scale_offset()], sizeof(float));
+        }
+
+        int32_t * acc = scratch<int32_t>(0, static_cast<size_t>(batch) * hidden_dim);
+        linear_s8s8_batch(qx, qfc1_weight, batch, in, hidden_dim, acc);
+
+        float * hidden = scratch<float>(2, hidden_dim);
+        float * multiplier = scratch<float>(3, std::max(hidden_dim, shape.fc2_out));
+        uint8_t * qh = scratch<uint8_t>(0, static_cast<size_t>(batch) * hidden_dim);
+        float * h_scale = scratch<float>(4, batch);
+        for (int b = 0; b < batch; b++)
+        {
+            std::fill(multiplier, multiplier + hidden_dim, x_scale[b] * fc1_scale);
+            dequantize_s32(&acc[b * hidden_dim], hidden_dim, 1, multiplier, fc1_bias, hidden);
+            relu_f32(hidden, hidden_dim);
+            float max_val = absmax_f32(hidden, hidden_dim);
+            h_scale[b] = max_val > 0.0f ? max_val / 255.0f : 1.0f;
+            quantize_u8(hidden, hidden_dim, h_scale[b], 0, &qh[b * hidden_dim]);
+        }
+
+        const int out = shape.fc2_out;
+        int32_t * acc2 = scratch<int32_t>(1, static_cast<size_t>(batch) * out);
+        linear_u8s8_batch(qh, qfc2_weight, batch, hidden_dim, out, acc2);
+        for (int b = 0; b < batch; b++)
+        {
+            std::fill(multiplier, multiplier + out, h_scale[b] * fc2_scale);
+            dequantize_s32(&acc2[b * out], out, 1, multiplier, fc2_bias, &logits[b * out]);
+        }
+    }
+
+    // conv1 (+ squeeze-excitation) + ReLU of a single image, output in fp32
+    void conv1(const float * image, float * out) const
+    {
+        const int size = shape.image_size;
+        const int out_c = shape.conv_out_c;
+        int8_t * qimage = scratch<int8_t>(1, size * size);
+        float s = quantize_dynamic(image, size * size, qimage);
+
+        int32_t * acc = scratch<int32_t>(2, shape.fc1_in);
+        int64_t * row_sums = se.enabled() ? scratch<int64_t>(0, out_c * size) : nullptr;
+        conv3x3_s8s8(qimage, 1, size, size, qconv1_weight, out_c, acc, row_sums);
+
+        float * multiplier = scratch<float>(6, out_c);
+        for (int o = 0; o < out_c; o++)
+        {
+            multiplier[o] = conv1_scale[o] * s;
+        }
+        const float * bias = conv1_bias;
+        if (se.enabled())
+        {
+            // the gate scales the dequantized map, so it goes into the multiplier and bias
+            float * gate = scratch<float>(5, 3 * out_c);
+            float * gated_bias = gate + 2 * out_c;
+            channel_means_s32(row_sums, out_c, size, size, multiplier, conv1_bias, gate + out_c);
+            se.gate(gate + out_c, gate);
+            se_gate_affine(multiplier, conv1_bias, gate, out_c, multiplier, gated_bias);
+            bias = gated_bias;
+        }
+        dequantize_s32(acc, out_c, size * size, multiplier, bias, out);
+        relu_f32(out, shape.fc1_in);
+    }
+
+private:
+    size_t scale_offset() const { return (static_cast<size_t>(shape.fc1_in) + 3) / 4 * 4; }
+
+    // symmetric per-tensor quantization, returns the scale
+    static float quantize_dynamic(const float * x, int n, int8_t * q)
+    {
+        float max_val = absmax_f32(x, n);
+        float s = max_val > 0.0f ? max_val / 127.0f : 1.0f;
+        quantize_s8(x, n, s, q);
+        return s;
+    }
+
+    std::shared_ptr<const ModelBundle> bundle;
+    MnistNet shape;
+
+    const int8_t * qconv1_weight = nullptr;
+    const float * conv1_scale = nullptr;
+    const float * conv1_bias = nullptr;
+    SqueezeExcite se;
+    const int8_t * qfc1_weight = nullptr;
+    float fc1_scale = 1.0f;
+    const float * fc1_bias = nullptr;
+    const int8_t * qfc2_weight = nullptr;
+    float fc2_scale = 1.0f;
+    const float * fc2_bias = nullptr;
+};
+
+} // namespace quantnn
@@ -0,0 +1,206 @@
+#pragma once
+
+// Runtime inference engines for the MNIST networks, loaded from a model bundle.
+//
+// The same three numeric schemes as the step-by-step programs under src/mlp and
+// src/conv are implemented on top of src/kernels, for both networks:
+//   fp32    : float weights and activations
+//   dynamic : int8 weights, activation scales computed per image at runtime
+//   static  : int8 weights, activation scales calibrated offline (scale.* tensors)
+// The network is the ConvNet when the bundle has conv1 tensors and the MLP otherwise.
+// Unlike the step-by-step ConvNet programs, the engines apply the ReLU after conv1
+// that pytorch/train_convnet.py trains with, preceded by a squeeze-excitation when the
+// bundle has conv1.se tensors.
+//
+// Engines only read their weights, so one instance can be shared by many threads.
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "common/tensor.h"
+#include "engine/model_bundle.h"
+#include "kernels/se.h"
+
+namespace quantnn
+{
+
+enum class Precision
+{
+    FP32,
+    DynamicInt8,
+    StaticInt8,
+};
+
+inline const char * precision_name(Precision precision)
+{
+    switch (precision)
+    {
+        case Precision::FP32: return "fp32";
+        case Precision::DynamicInt8: return "dynamic";
+        case Precision::StaticInt8: return "static";
+    }
+    return "unknown";
+}
+
+inline Precision parse_precision(const std::string & name)
+{
+    if (name == "fp32") return Precision::FP32;
+    if (name == "dynamic") return Precision::DynamicInt8;
+    if (name == "static") return Precision::StaticInt8;
+    throw std::runtime_error("unknown precision " + name + " (fp32, dynamic or static)");
+}
+
+// layer sizes of the network stored in a bundle
+struct MnistNet
+{
+    bool conv = false;
+    int image_size = 28;
+    int conv_out_c = 0;
+    int fc1_in = 0;
+    int fc1_out = 0;
+    int fc2_out = 0;
+
+    static MnistNet from_bundle(const ModelBundle & bundle)
+    {
+        MnistNet net;
+        net.conv = bundle.has("conv1.bias");
+        if (net.conv)
+        {
+            net.conv_out_c = static_cast<int>(bundle.get("conv1.bias").numel());
+        }
+        net.fc1_out = static_cast<int>(bundle.get("fc1.bias").numel());
+        net.fc2_out = static_cast<int>(bundle.get("fc2.bias").numel());
+        net.fc1_in = net.conv ? net.conv_out_c * net.image_size * net.image_size : net.image_size * net.image_size;
+        return net;
+    }
+};
+
+// Squeeze-excitation on the conv1 output (conv1.se.reduce/expand.weight/bias, the SEBlock
+// of a MobileOne conv1), applied before its ReLU as in MobileOneBlock. The engines fuse
+// it into conv1 and the ReLU as described in kernels/se.h.
+struct SqueezeExcite
+{
+    int channels = 0;
+    int reduced = 0;
+    const float * reduce_weight = nullptr;
+    const float * reduce_bias = nullptr;
+    const float * expand_weight = nullptr;
+    const float * expand_bias = nullptr;
+
+    static SqueezeExcite from_bundle(const ModelBundle & bundle, const std::string & prefix, int channels)
+    {
+        SqueezeExcite se;
+        if (!bundle.has(prefix + ".reduce.weight"))
+        {
+            return se;
+        }
+        const TensorView & reduce = bundle.get(prefix + ".reduce.weight");
+        se.channels = channels;
+        se.reduced = reduce.shape.empty() ? 0 : reduce.shape[0];
+        se.reduce_weight = reduce.as<float>();
+        se.reduce_bias = bundle.get(prefix + ".reduce.bias").as<float>();
+        se.expand_weight = bundle.get(prefix + ".expand.weight").as<float>();
+        se.expand_bias = bundle.get(prefix + ".expand.bias").as<float>();
+        const size_t weights = static_cast<size_t>(se.reduced) * channels;
+        if (se.reduced <= 0 || reduce.numel() != weights || bundle.get(prefix + ".expand.weight").numel() != weights
+            || bundle.get(prefix + ".reduce.bias").numel() != static_cast<size_t>(se.reduced)
+            || bundle.get(prefix + ".expand.bias").numel() != static_cast<size_t>(channels))
+        {
+            throw std::runtime_error(prefix + " does not match the " + std::to_string(channels) + " conv channels");
+        }
+        return se;
+    }
+
+    bool enabled() const { return reduced > 0; }
+
+    void gate(const float * mean, float * g) const
+    {
+        se_gate(mean, channels, reduce_weight, reduce_bias, reduced, expand_weight, expand_bias, g);
+    }
+};
+
+// Per-thread activation buffers, 64-byte aligned. They only grow, so a warmed-up
+// forward does not allocate.
+template <typename T>
+T * scratch(int slot, size_t n)
+{
+    thread_local AlignedVector<T> buffers[8];
+    AlignedVector<T> & buffer = buffers[slot];
+    if (buffer.size() < n)
+    {
+        buffer.resize(n);
+    }
+    return buffer.data();
+}
+
+inline int argmax(const float * x, int n)
+{
+    return static_cast<int>(std::max_element(x, x + n) - x);
+}
+
+class Engine
+{
+public:
+    static constexpr int input_dim = 28 * 28;
+
+    virtual ~Engine() = default;
+
+    virtual std::string name() const = 0;
+    virtual const MnistNet & net() const = 0;
+
+    // The forward pass in two halves: the feature extractor (quantize, conv1)
+    // runs per image, the classifier (fc1, relu, fc2) on a batch of feature blocks of
+    // feature_bytes() each. Pipelined execution runs the halves on different threads.
+    virtual size_t feature_bytes() const = 0;
+    virtual void forward_features(const float * image, void * features) const = 0;
+    virtual void forward_classifier(const void * features, int batch, float * logits) const = 0;
+
+    int output_dim() const { return net().fc2_out; }
+
+    // images: batch x 784 normalized pixels, logits: batch x 10
+    void forward_batch(const float * images, int batch, float * logits) const
+    {
+        const size_t bytes = feature_bytes();
+        uint8_t * features = scratch<uint8_t>(7, batch * bytes);
+        for (int b = 0; b < batch; b++)
+        {
+            forward_features(&images[b * input_dim], &features[b * bytes]);
+        }
+        forward_classifier(features, batch, logits);
+    }
+
+    int forward(const float * image, float * logits) const
+    {
+        if (fuse_conv_fc1)
+        {
+            forward_fused(image, logits);
+        }
+        else
+        {
+            forward_batch(image, 1, logits);
+        }
+        return argmax(logits, output_dim());
+    }
+
+    // Fused conv1 -> fc1 for forward(): each conv1 output channel is computed into an
+    // L1-sized tile and added into the fc1 accumulators right away, so the feature map
+    // is never stored. Only engines whose conv1 output does not depend on the whole map
+    // support it: fp32 and static int8 ConvNets without squeeze-excitation (dynamic int8
+    // takes its activation scale from the max of the map). The logits match the unfused
+    // path exactly in int8 and up to the order of the fp32 additions in fp32.
+    virtual bool can_fuse_conv_fc1() const { return false; }
+    void set_fuse_conv_fc1(bool on) { fuse_conv_fc1 = on && can_fuse_conv_fc1(); }
+    bool fuses_conv_fc1() const { return fuse_conv_fc1; }
+
+protected:
+    virtual void forward_fused(const float * image, float * logits) const { forward_batch(image, 1, logits); }
+
+private:
+    bool fuse_conv_fc1 = false;
+};
+
+} // namespace quantnn
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+
+#include "engine/dynamic_int8_engine.h"
+#include "engine/engine.h"
+#include "engine/fp32_engine.h"
+#include "engine/mixed_engine.h"
+#include "engine/reparameterize.h"
+#include "engine/static_int8_engine.h"
+
+namespace quantnn
+{
+
+inline std::unique_ptr<Engine> make_engine(std::shared_ptr<const ModelBundle> bundle, Precision precision)
+{
+    switch (precision)
+    {
+        case Precision::FP32: return std::make_unique<Fp32Engine>(bundle);
+        case Precision::DynamicInt8: return std::make_unique<DynamicInt8Engine>(bundle);
+        case Precision::StaticInt8: return std::make_unique<StaticInt8Engine>(bundle);
+    }
+    throw std::runtime_error("unknown precision");
+}
+
+// one precision per layer (engine/mixed_engine.h)
+inline std::unique_ptr<Engine> make_engine(std::shared_ptr<const ModelBundle> bundle, const LayerPrecisions & precisions)
+{
+    return std::make_unique<MixedEngine>(bundle, precisions);
+}
+
+} // namespace quantnn
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "engine/engine.h"
+#include "engine/model_bundle.h"
+
+#include "kernels/activation.h"
+#include "kernels/conv.h"
+#include "kernels/conv2d.h"
+#include "kernels/linear.h"
+
+namespace quantnn
+{
+
+// A float weight tensor, stored as f32 or as 16-bit floats (f16, bf16) that the
+// kernels widen on the fly; biases stay f32.
+struct FloatWeights
+{
+    DType dtype = DType::F32;
+    const void * data = nullptr;
+
+    static FloatWeights from(const TensorView & t)
+    {
+        if (t.dtype != DType::F32 && t.dtype != DType::F16 && t.dtype != DType::BF16)
+        {
+            throw std::runtime_error("tensor " + t.name + " is not f32, f16 or bf16");
+        }
+        return FloatWeights { t.dtype, t.data };
+    }
+
+    // the weights from element n on
+    FloatWeights offset(size_t n) const
+    {
+        const size_t bytes = dtype == DType::F32 ? sizeof(float) : sizeof(uint16_t);
+        return FloatWeights { dtype, static_cast<const uint8_t *>(data) + n * bytes };
+    }
+};
+
+inline const char * weight_suffix(DType dtype)
+{
+    switch (dtype)
+    {
+        case DType::F16: return "_f16w";
+        case DType::BF16: return "_bf16w";
+        default: return "";
+    }
+}
+
+inline void linear_batch(const float * x, const FloatWeights & weight, const float * bias,
+                         int batch, int in_dim, int out_dim, float * y)
+{
+    switch (weight.dtype)
+    {
+        case DType::F16:
+            linear_f16_batch(x, static_cast<const Half *>(weight.data), bias, batch, in_dim, out_dim, y);
+            break;
+        case DType::BF16:
+            linear_bf16_batch(x, static_cast<const BFloat16 *>(weight.data), bias, batch, in_dim, out_dim, y);
+            break;
+        default:
+            linear_f32_batch(x, static_cast<const float *>(weight.data), bias, batch, in_dim, out_dim, y);
+            break;
+    }
+}
+
+// y[i] += W[i, 0:in_dim] x with rows ld apart, see linear_f32_accumulate
+inline void linear_accumulate(const float * x, const FloatWeights & weight, int ld, int in_dim, int out_dim, float * y)
+{
+    switch (weight.dtype)
+    {
+        case DType::F16:
+            linear_f16_accumulate(x, static_cast<const Half *>(weight.data), ld, in_dim, out_dim, y);
+            break;
+        case DType::BF16:
+            linear_bf16_accumulate(x, static_cast<const BFloat16 *>(weight.data), ld, in_dim, out_dim, y);
+            break;
+        default:
+            linear_f32_accumulate(x, static_cast<const float *>(weight.data), ld, in_dim, out_dim, y);
+            break;
+    }
+}
+
+inline void conv3x3(const float * in, int in_c, int h, int w,
+                    const FloatWeights & weight, const float * bias, int out_c, float * out,
+                    float * row_sums = nullptr)
+{
+    switch (weight.dtype)
+    {
+        case DType::F16:
+            conv3x3_w16(in, in_c, h, w, static_cast<const Half *>(weight.data), bias, out_c, out, row_sums);
+            break;
+        case DType::BF16:
+            conv3x3_w16(in, in_c, h, w, static_cast<const BFloat16 *>(weight.data), bias, out_c, out, row_sums);
+            break;
+        default:
+            conv3x3_f32(in, in_c, h, w, static_cast<const float *>(weight.data), bias, out_c, out, row_sums);
+            break;
+    }
+}
+
+class Fp32Engine : public Engine
+{
+public:
+    explicit Fp32Engine(std::shared_ptr<const ModelBundle> bundle)
+        : bundle{bundle}, shape{MnistNet::from_bundle(*bundle)}
+    {
+        if (shape.conv)
+        {
+            const TensorView conv1 = bundle->get("conv1.weight");
+            const std::vector<int> conv1_shape { shape.conv_out_c, 1, 3, 3 };
+            if (conv1.shape != conv1_shape)
+            {
+                throw std::runtime_error("tensor conv1.weight is not " + std::to_string(shape.conv_out_c) + "x1x3x3");
+            }
+            conv1_weight = FloatWeights::from(conv1);
+            conv1_bias = bundle->get("conv1.bias").as<float>();
+            se = SqueezeExcite::from_bundle(*bundle, "conv1.se", shape.conv_out_c);
+            if (conv1_weight.dtype == DType::F32 && !se.enabled())
+            {
+                // 3x3, padding 1: the Conv2d picks its dense 3x3 path here, once
+                Conv2dShape s;
+                s.in_h = s.in_w = shape.image_size;
+                s.out_c = shape.conv_out_c;
+                s.pad_h = s.pad_w = 1;
+                conv1_op = std::make_unique<Conv2d>(s);
+            }
+        }
+        fc1_weight = FloatWeights::from(bundle->get("fc1.weight"));
+        fc1_bias = bundle->get("fc1.bias").as<float>();
+        fc2_weight = FloatWeights::from(bundle->get("fc2.weight"));
+        fc2_bias = bundle->get("fc2.bias").as<float>();
+    }
+
+    std::string name() const override
+    {
+        return std::string(shape.conv ? "conv_fp32" : "mlp_fp32") + weight_suffix(fc1_weight.dtype);
+    }
+    const MnistNet & net() const override { return shape; }
+
+    size_t feature_bytes() const override { return sizeof(float) * shape.fc1_in; }
+
+    void forward_features(const float * image, void * features) const override
+    {
+        float * out = static_cast<float *>(features);
+        if (shape.conv)
+        {
+            conv1(image, out);
+        }
+        else
+        {
+            memcpy(out, image, feature_bytes());
+        }
+    }
+
+    void forward_classifier(const void * features, int batch, float * logits) const override
+    {
+        const float * x = static_cast<const float *>(features);
+        float * hidden = scratch<float>(1, static_cast<size_t>(batch) * shape.fc1_out);
+        linear_batch(x, fc1_weight, fc1_bias, batch, shape.fc1_in, shape.fc1_out, hidden);
+        relu_f32(hidden, batch * shape.fc1_out);
+        linear_batch(hidden, fc2_weight, fc2_bias, batch, shape.fc1_out, shape.fc2_out, logits);
+    }
+
+    bool can_fuse_conv_fc1() const override { return shape.conv && !se.enabled(); }
+
+    // conv1 (+ squeeze-excitation) + ReLU of a single image
+    void conv1(const float * image, float * out) const
+    {
+        const int size = shape.image_size;
+        if (conv1_op)
+        {
+            conv1_op->run_f32(image, static_cast<const float *>(conv1_weight.data), conv1_bias, out);
+            relu_f32(out, shape.fc1_in);
+            return;
+        }
+        if (!se.enabled())
+        {
+            conv3x3(image, 1, size, size, conv1_weight, conv1_bias, shape.conv_out_c, out);
+            relu_f32(out, shape.fc1_in);
+            return;
+        }
+        float * row_sums = scratch<float>(6, shape.conv_out_c * size);
+        float * gate = scratch<float>(5, 2 * shape.conv_out_c);
+        conv3x3(image, 1, size, size, conv1_weight, conv1_bias, shape.conv_out_c, out, row_sums);
+        channel_means_f32(row_sums, shape.conv_out_c, size, size, gate + shape.conv_out_c);
+        se.gate(gate + shape.conv_out_c, gate);
+        relu_gate_f32(out, shape.conv_out_c, size * size, gate);
+    }
+
+protected:
+    // conv1 one output channel at a time into a tile, each tile added into fc1 at once
+    void forward_fused(const float * image, float * logits) const override
+    {
+        const int size = shape.image_size;
+        const int plane = size * size;
+        float * tile = scratch<float>(4, plane);
+        float * hidden = scratch<float>(1, shape.fc1_out);
+        for (int i = 0; i < shape.fc1_out; i++)
+        {
+            hidden[i] = fc1_bias[i];
+        }
+        for (int o = 0; o < shape.conv_out_c; o++)
+        {
+            conv3x3(image, 1, size, size, conv1_weight.offset(static_cast<size_t>(o) * 9), &conv1_bias[o], 1, tile);
+            relu_f32(tile, plane);
+            linear_accumulate(tile, fc1_weight.offset(static_cast<size_t>(o) * plane), shape.fc1_in, plane, shape.fc1_out, hidden);
+        }
+        relu_f32(hidden, shape.fc1_out);
+        linear_batch(hidden, fc2_weight, fc2_bias, 1, shape.fc1_out, shape.fc2_out, logits);
+    }
+
+private:
+    std::shared_ptr<const ModelBundle> bundle;
+    MnistNet shape;
+
+    FloatWeights conv1_weight;
+    const float * conv1_bias = nullptr;
+    SqueezeExcite se;
+    std::unique_ptr<Conv2d> conv1_op; // f32 weights without SE; 16-bit weights and SE keep conv3x3
+    FloatWeights fc1_weight;
+    const float * fc1_bias = nullptr;
+    FloatWeights fc2_weight;
+    const float * fc2_bias = nullptr;
+};
+
+} // namespace quantnn
@@ -0,0 +1,380 @@
+#pragma once
+
+// Per-layer mixed precision: conv1, fc1 and fc2 each run in fp32, dynamic int8 or
+// static int8, as chosen by a LayerPrecisions config (src/tools/select_precision.cpp
+// picks one under an accuracy budget).
+//
+// Activations are fp32 between layers. An int8 layer quantizes its input (with a scale
+// from the input itself, or the calibrated scale.* of the bundle) and dequantizes its
+// int32 accumulators, so any layer can switch precision without touching its neighbours.
+// The ReLU outputs feeding fc2 are quantized to uint8 as in the other int8 engines.
+// fp32 layers take f16 or bf16 weights as well, like Fp32Engine.
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "engine/engine.h"
+#include "engine/fp32_engine.h"
+#include "engine/model_bundle.h"
+
+#include "kernels/activation.h"
+#include "kernels/conv.h"
+#include "kernels/linear.h"
+#include "kernels/quantize.h"
+
+namespace quantnn
+{
+
+enum class Layer
+{
+    Conv1,
+    FC1,
+    FC2,
+};
+
+constexpr int kLayerCount = 3;
+
+inline const char * layer_name(Layer layer)
+{
+    switch (layer)
+    {
+        case Layer::Conv1: return "conv1";
+        case Layer::FC1: return "fc1";
+        case Layer::FC2: return "fc2";
+    }
+    return "unknown";
+}
+
+struct LayerPrecisions
+{
+    Precision layers[kLayerCount] = { Precision::FP32, Precision::FP32, Precision::FP32 };
+
+    Precision & operator[](Layer layer) { return layers[static_cast<int>(layer)]; }
+    Precision operator[](Layer layer) const { return layers[static_cast<int>(layer)]; }
+
+    static LayerPrecisions uniform(Precision precision)
+    {
+        LayerPrecisions p;
+        std::fill(p.layers, p.layers + kLayerCount, precision);
+        return p;
+    }
+
+    // "conv1=static,fc1=static,fc2=fp32"
+    std::string to_string() const
+    {
+        std::string s;
+        for (int l = 0; l < kLayerCount; l++)
+        {
+            s += (l > 0 ? "," : "") + std::string(layer_name(static_cast<Layer>(l))) + "=" + precision_name(layers[l]);
+        }
+        return s;
+    }
+
+    // one "<layer> <precision>" per line, '#' starts a comment; unlisted layers stay fp32
+    static LayerPrecisions load(const std::string & path)
+    {
+        std::ifstream in(path);
+        if (!in)
+        {
+            throw std::runtime_error("cannot open layer config " + path);
+        }
+        LayerPrecisions p;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            line = line.substr(0, line.find('#'));
+            std::istringstream fields(line);
+            std::string layer, precision;
+            if (!(fields >> layer))
+            {
+                continue;
+            }
+            if (!(fields >> precision))
+            {
+                throw std::runtime_error("layer config " + path + ": no precision for " + layer);
+            }
+            bool known = false;
+            for (int l = 0; l < kLayerCount; l++)
+            {
+                if (layer == layer_name(static_cast<Layer>(l)))
+                {
+                    p.layers[l] = parse_precision(precision);
+                    known = true;
+                }
+            }
+            if (!known)
+            {
+                throw std::runtime_error("layer config " + path + ": unknown layer " + layer);
+            }
+        }
+        return p;
+    }
+
+    void save(const std::string & path, const std::string & comment) const
+    {
+        std::ofstream out(path);
+        if (!out)
+        {
+            throw std::runtime_error("cannot write " + path);
+        }
+        std::istringstream lines(comment);
+        std::string line;
+        while (std::getline(lines, line))
+        {
+            out << "# " << line << "\n";
+        }
+        for (int l = 0; l < kLayerCount; l++)
+        {
+            out << layer_name(static_cast<Layer>(l)) << " " << precision_name(layers[l]) << "\n";
+        }
+    }
+};
+
+class MixedEngine : public Engine
+{
+public:
+    MixedEngine(std::shared_ptr<const ModelBundle> bundle, const LayerPrecisions & precisions)
+        : bundle{bundle}, shape{MnistNet::from_bundle(*bundle)}, precisions{precisions}
+    {
+        input_scale = scalar("scale.input");
+        if (shape.conv)
+        {
+            conv1_weight = float_weights("conv1.weight");
+            qconv1_weight = data<int8_t>("conv1.qweight");
+            conv1_wscale = data<float>("conv1.wscale");
+            conv1_bias = bundle->get("conv1.bias").as<float>();
+            se = SqueezeExcite::from_bundle(*bundle, "conv1.se", shape.conv_out_c);
+        }
+        fc1 = load_linear("fc1", shape.fc1_in, shape.fc1_out, shape.conv ? scalar("scale.conv1") : input_scale, false);
+        fc2 = load_linear("fc2", shape.fc1_out, shape.fc2_out, scalar("scale.relu"), true);
+
+        for (int l = shape.conv ? 0 : 1; l < kLayerCount; l++)
+        {
+            check(static_cast<Layer>(l), precisions.layers[l]);
+        }
+    }
+
+    std::string name() const override { return shape.conv ? "conv_mixed" : "mlp_mixed"; }
+    const MnistNet & net() const override { return shape; }
+    const LayerPrecisions & layer_precisions() const { return precisions; }
+
+    size_t feature_bytes() const override { return sizeof(float) * shape.fc1_in; }
+
+    void forward_features(const float * image, void * features) const override
+    {
+        float * out = static_cast<float *>(features);
+        if (shape.conv)
+        {
+            conv1(image, out, precisions[Layer::Conv1]);
+        }
+        else
+        {
+            memcpy(out, image, feature_bytes());
+        }
+    }
+
+    void forward_classifier(const void * features, int batch, float * logits) const override
+    {
+        const float * x = static_cast<const float *>(features);
+        float * hidden = scratch<float>(2, static_cast<size_t>(batch) * shape.fc1_out);
+        linear(Layer::FC1, x, batch, hidden, precisions[Layer::FC1]);
+        relu_f32(hidden, batch * shape.fc1_out);
+        linear(Layer::FC2, hidden, batch, logits, precisions[Layer::FC2]);
+    }
+
+    // throws if the bundle lacks the tensors to run `layer` in `precision`
+    void check(Layer layer, Precision precision) const
+    {
+        bool ok = true;
+        if (layer == Layer::Conv1)
+        {
+            ok = shape.conv && (precision == Precision::FP32 ? conv1_weight.data != nullptr : qconv1_weight != nullptr && conv1_wscale != nullptr)
+                 && (precision != Precision::StaticInt8 || input_scale > 0.0f);
+        }
+        else
+        {
+            const LinearLayer & fc = layer == Layer::FC1 ? fc1 : fc2;
+            ok = precision == Precision::FP32 ? fc.weight.data != nullptr : fc.qweight != nullptr;
+            ok = ok && (precision != Precision::StaticInt8 || fc.in_scale > 0.0f);
+        }
+        if (!ok)
+        {
+            throw std::runtime_error(std::string("model bundle cannot run ") + layer_name(layer) + " in " + precision_name(precision));
+        }
+    }
+
+    // conv1 (+ squeeze-excitation) + ReLU of a single image in the given precision
+    void conv1(const float * image, float * out, Precision precision) const
+    {
+        const int size = shape.image_size;
+        const int out_c = shape.conv_out_c;
+        float * gate = se.enabled() ? scratch<float>(5, 3 * out_c) : nullptr;
+        if (precision == Precision::FP32)
+        {
+            float * row_sums = se.enabled() ? scratch<float>(6, out_c * size) : nullptr;
+            conv3x3(image, 1, size, size, conv1_weight, conv1_bias, out_c, out, row_sums);
+            if (se.enabled())
+            {
+                channel_means_f32(row_sums, out_c, size, size, gate + out_c);
+                se.gate(gate + out_c, gate);
+                relu_gate_f32(out, out_c, size * size, gate);
+                return;
+            }
+        }
+        else
+        {
+            float s = precision == Precision::StaticInt8 ? input_scale : symmetric_scale(image, size * size);
+            int8_t * qimage = scratch<int8_t>(0, size * size);
+            quantize_s8(image, size * size, s, qimage);
+
+            int32_t * acc = scratch<int32_t>(0, shape.fc1_in);
+            int64_t * row_sums = se.enabled() ? scratch<int64_t>(0, out_c * size) : nullptr;
+            conv3x3_s8s8(qimage, 1, size, size, qconv1_weight, out_c, acc, row_sums);
+
+            float * multiplier = scratch<float>(1, out_c);
+            for (int o = 0; o < out_c; o++)
+            {
+                multiplier[o] = conv1_wscale[o] * s;
+            }
+            const float * bias = conv1_bias;
+            if (se.enabled())
+            {
+                channel_means_s32(row_sums, out_c, size, size, multiplier, conv1_bias, gate + out_c);
+                se.gate(gate + out_c, gate);
+                se_gate_affine(multiplier, conv1_bias, gate, out_c, multiplier, gate + 2 * out_c);
+                bias = gate + 2 * out_c;
+            }
+            dequantize_s32(acc, out_c, size * size, multiplier, bias, out);
+        }
+        relu_f32(out, shape.fc1_in);
+    }
+
+    // fc1 or fc2 on a batch of fp32 inputs in the given precision
+    void linear(Layer layer, const float * x, int batch, float * y, Precision precision) const
+    {
+        const LinearLayer & fc = layer == Layer::FC1 ? fc1 : fc2;
+        const int in = fc.in;
+        const int out = fc.out;
+        if (precision == Precision::FP32)
+        {
+            linear_batch(x, fc.weight, fc.bias, batch, in, out, y);
+            return;
+        }
+
+        // per-image input scales: calibrated (static) or from each image (dynamic)
+        float * x_scale = scratch<float>(4, batch);
+        for (int b = 0; b < batch; b++)
+        {
+            const float * xb = &x[b * in];
+            x_scale[b] = precision == Precision::StaticInt8 ? fc.in_scale
+                         : fc.unsigned_input ? unsigned_scale(xb, in) : symmetric_scale(xb, in);
+        }
+
+        int32_t * acc = scratch<int32_t>(1, static_cast<size_t>(batch) * out);
+        if (fc.unsigned_input)
+        {
+            uint8_t * qx = scratch<uint8_t>(1, static_cast<size_t>(batch) * in);
+            for (int b = 0; b < batch; b++)
+            {
+                quantize_u8(&x[b * in], in, x_scale[b], 0, &qx[b * in]);
+            }
+            linear_u8s8_batch(qx, fc.qweight, batch, in, out, acc);
+        }
+        else
+        {
+            int8_t * qx = scratch<int8_t>(1, static_cast<size_t>(batch) * in);
+            for (int b = 0; b < batch; b++)
+            {
+                quantize_s8(&x[b * in], in, x_scale[b], &qx[b * in]);
+            }
+            linear_s8s8_batch(qx, fc.qweight, batch, in, out, acc);
+        }
+
+        float * multiplier = scratch<float>(3, out);
+        for (int b = 0; b < batch; b++)
+        {
+            std::fill(multiplier, multiplier + out, x_scale[b] * fc.wscale);
+            dequantize_s32(&acc[b * out], out, 1, multiplier, fc.bias, &y[b * out]);
+        }
+    }
+
+private:
+    struct LinearLayer
+    {
+        int in = 0;
+        int out = 0;
+        FloatWeights weight;
+        const int8_t * qweight = nullptr;
+        float wscale = 1.0f;
+        const float * bias = nullptr;
+        float in_scale = 0.0f;
+        bool unsigned_input = false;
+    };
+
+    // optional tensors: the engine only needs the ones of the precisions it runs
+    template <typename T>
+    const T * data(const std::string & name) const
+    {
+        const TensorView * t = bundle->find(name);
+        return t != nullptr ? t->as<T>() : nullptr;
+    }
+
+    FloatWeights float_weights(const std::string & name) const
+    {
+        const TensorView * t = bundle->find(name);
+        return t != nullptr ? FloatWeights::from(*t) : FloatWeights();
+    }
+
+    float scalar(const std::string & name) const
+    {
+        const float * value = data<float>(name);
+        return value != nullptr ? value[0] : 0.0f;
+    }
+
+    LinearLayer load_linear(const std::string & name, int in, int out, float in_scale, bool unsigned_input) const
+    {
+        LinearLayer fc;
+        fc.in = in;
+        fc.out = out;
+        fc.weight = float_weights(name + ".weight");
+        fc.qweight = data<int8_t>(name + ".qweight");
+        fc.wscale = scalar(name + ".wscale");
+        fc.bias = bundle->get(name + ".bias").as<float>();
+        fc.in_scale = in_scale;
+        fc.unsigned_input = unsigned_input;
+        return fc;
+    }
+
+    static float symmetric_scale(const float * x, int n)
+    {
+        float max_val = absmax_f32(x, n);
+        return max_val > 0.0f ? max_val / 127.0f : 1.0f;
+    }
+
+    static float unsigned_scale(const float * x, int n)
+    {
+        float max_val = absmax_f32(x, n);
+        return max_val > 0.0f ? max_val / 255.0f : 1.0f;
+    }
+
+    std::shared_ptr<const ModelBundle> bundle;
+    MnistNet shape;
+    LayerPrecisions precisions;
+
+    float input_scale = 0.0f;
+    FloatWeights conv1_weight;
+    const int8_t * qconv1_weight = nullptr;
+    const float * conv1_wscale = nullptr;
+    const float * conv1_bias = nullptr;
+    SqueezeExcite se;
+    LinearLayer fc1;
+    LinearLayer fc2;
+};
+
+} // namespace quantnn
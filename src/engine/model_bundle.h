@@ -0,0 +1,322 @@
+#pragma once
+
+// Model bundle: a flat binary file of named tensors that the engines load at runtime
+// instead of compiling the weights in.
+//
+//   BundleHeader                      magic "QNNB", version, tensor count
+//   BundleEntry[tensor count]         name, dtype, shape, offset and size of the data
+//   tensor data                       each tensor starts at a 64-byte aligned offset
+//
+// All integers are little-endian. pytorch/model_bundle.py writes the same layout.
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/half.h"
+#include "common/tensor.h"
+
+namespace quantnn
+{
+
+enum class DType : uint32_t
+{
+    F32 = 0,
+    S8 = 1,
+    U8 = 2,
+    S32 = 3,
+    F16 = 4,
+    BF16 = 5,
+};
+
+inline size_t dtype_size(DType dtype)
+{
+    switch (dtype)
+    {
+        case DType::F32: return 4;
+        case DType::S8: return 1;
+        case DType::U8: return 1;
+        case DType::S32: return 4;
+        case DType::F16: return 2;
+        case DType::BF16: return 2;
+    }
+    throw std::runtime_error("unknown dtype");
+}
+
+template <typename T> constexpr DType dtype_of();
+template <> constexpr DType dtype_of<float>() { return DType::F32; }
+template <> constexpr DType dtype_of<int8_t>() { return DType::S8; }
+template <> constexpr DType dtype_of<uint8_t>() { return DType::U8; }
+template <> constexpr DType dtype_of<int32_t>() { return DType::S32; }
+template <> constexpr DType dtype_of<Half>() { return DType::F16; }
+template <> constexpr DType dtype_of<BFloat16>() { return DType::BF16; }
+
+constexpr uint32_t kBundleMagic = 0x424e4e51; // "QNNB"
+constexpr uint32_t kBundleVersion = 1;
+constexpr size_t kBundleAlignment = 64;
+constexpr int kMaxNameLength = 48;
+constexpr int kMaxDims = 4;
+
+struct BundleHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t tensor_count;
+    uint32_t reserved;
+};
+
+struct BundleEntry
+{
+    char name[kMaxNameLength];
+    uint32_t dtype;
+    uint32_t ndim;
+    uint32_t dims[kMaxDims];
+    uint64_t offset;
+    uint64_t nbytes;
+};
+
+static_assert(sizeof(BundleHeader) == 16, "bundle header layout");
+static_assert(sizeof(BundleEntry) == 88, "bundle entry layout");
+
+// non-owning view of one tensor inside a bundle
+struct TensorView
+{
+    std::string name;
+    DType dtype;
+    std::vector<int> shape;
+    const void * data;
+    size_t nbytes;
+
+    size_t numel() const { return nbytes / dtype_size(dtype); }
+
+    template <typename T>
+    const T * as() const
+    {
+        if (dtype != dtype_of<T>())
+        {
+            throw std::runtime_error("tensor " + name + " has a different dtype");
+        }
+        return static_cast<const T *>(data);
+    }
+
+    // the tensor in place, with its shape
+    template <typename T>
+    TensorRef<const T> ref(QuantParams quant = QuantParams()) const
+    {
+        return TensorRef<const T>(as<T>(), shape, std::move(quant));
+    }
+};
+
+class ModelBundle
+{
+public:
+    // maps the file read-only; the tensors are used in place
+    static std::shared_ptr<const ModelBundle> open(const std::string & path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("cannot open model bundle " + path);
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(BundleHeader)))
+        {
+            ::close(fd);
+            throw std::runtime_error("invalid model bundle " + path);
+        }
+        size_t size = static_cast<size_t>(st.st_size);
+        void * ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (ptr == MAP_FAILED)
+        {
+            throw std::runtime_error("cannot map model bundle " + path);
+        }
+        std::shared_ptr<const void> owner(ptr, [size](const void * p) { munmap(const_cast<void *>(p), size); });
+        return std::shared_ptr<const ModelBundle>(new ModelBundle(owner, static_cast<const uint8_t *>(ptr), size));
+    }
+
+    // parses a bundle that already is in memory; `owner` keeps that memory alive
+    static std::shared_ptr<const ModelBundle> from_memory(std::shared_ptr<const void> owner, const void * data, size_t size)
+    {
+        return std::shared_ptr<const ModelBundle>(new ModelBundle(owner, static_cast<const uint8_t *>(data), size));
+    }
+
+    const TensorView * find(const std::string & name) const
+    {
+        for (const TensorView & t : tensors)
+        {
+            if (t.name == name)
+            {
+                return &t;
+            }
+        }
+        return nullptr;
+    }
+
+    const TensorView & get(const std::string & name) const
+    {
+        const TensorView * t = find(name);
+        if (t == nullptr)
+        {
+            throw std::runtime_error("model bundle has no tensor " + name);
+        }
+        return *t;
+    }
+
+    bool has(const std::string & name) const { return find(name) != nullptr; }
+
+    const std::vector<TensorView> & all() const { return tensors; }
+    const uint8_t * data() const { return base; }
+    size_t size() const { return bytes; }
+
+private:
+    ModelBundle(std::shared_ptr<const void> owner, const uint8_t * base, size_t bytes)
+        : owner{owner}, base{base}, bytes{bytes}
+    {
+        BundleHeader header;
+        memcpy(&header, base, sizeof(header));
+        if (header.magic != kBundleMagic || header.version != kBundleVersion)
+        {
+            throw std::runtime_error("not a quantnn model bundle");
+        }
+        size_t table_end = sizeof(BundleHeader) + header.tensor_count * sizeof(BundleEntry);
+        if (table_end > bytes)
+        {
+            throw std::runtime_error("truncated model bundle");
+        }
+        for (uint32_t i = 0; i < header.tensor_count; i++)
+        {
+            BundleEntry entry;
+            memcpy(&entry, base + sizeof(BundleHeader) + i * sizeof(BundleEntry), sizeof(entry));
+            if (entry.offset + entry.nbytes > bytes || entry.ndim > kMaxDims)
+            {
+                throw std::runtime_error("corrupt model bundle entry");
+            }
+            TensorView t;
+            t.name = std::string(entry.name, strnlen(entry.name, kMaxNameLength));
+            t.dtype = static_cast<DType>(entry.dtype);
+            t.shape.assign(entry.dims, entry.dims + entry.ndim);
+            t.data = base + entry.offset;
+            t.nbytes = entry.nbytes;
+            tensors.push_back(t);
+        }
+    }
+
+    std::shared_ptr<const void> owner;
+    const uint8_t * base;
+    size_t bytes;
+    std::vector<TensorView> tensors;
+};
+
+class BundleWriter
+{
+public:
+    template <typename T>
+    void add(const std::string & name, const std::vector<int> & shape, const T * data, size_t numel)
+    {
+        add_raw(name, dtype_of<T>(), shape, data, numel * sizeof(T));
+    }
+
+    template <typename T>
+    void add(const std::string & name, const std::vector<int> & shape, const std::vector<T> & data)
+    {
+        add(name, shape, data.data(), data.size());
+    }
+
+    template <typename T, size_t N>
+    void add(const std::string & name, const std::vector<int> & shape, const std::array<T, N> & data)
+    {
+        add(name, shape, data.data(), N);
+    }
+
+    void add_scalar(const std::string & name, float value)
+    {
+        add(name, { 1 }, &value, 1);
+    }
+
+    void add_raw(const std::string & name, DType dtype, const std::vector<int> & shape, const void * data, size_t nbytes)
+    {
+        if (name.size() >= kMaxNameLength || shape.size() > kMaxDims)
+        {
+            throw std::runtime_error("tensor name or rank too large: " + name);
+        }
+        Pending p { name, dtype, shape, std::vector<uint8_t>(nbytes) };
+        memcpy(p.bytes.data(), data, nbytes);
+        pending.push_back(std::move(p));
+    }
+
+    // the bundle file as bytes, e.g. for ModelBundle::from_memory
+    std::vector<uint8_t> serialize() const
+    {
+        uint64_t offset = align(sizeof(BundleHeader) + pending.size() * sizeof(BundleEntry));
+        uint64_t end = sizeof(BundleHeader) + pending.size() * sizeof(BundleEntry);
+        std::vector<BundleEntry> entries (pending.size());
+        for (size_t i = 0; i < pending.size(); i++)
+        {
+            const Pending & p = pending[i];
+            BundleEntry & entry = entries[i];
+            memset(&entry, 0, sizeof(entry));
+            memcpy(entry.name, p.name.data(), p.name.size());
+            entry.dtype = static_cast<uint32_t>(p.dtype);
+            entry.ndim = static_cast<uint32_t>(p.shape.size());
+            for (size_t d = 0; d < p.shape.size(); d++)
+            {
+                entry.dims[d] = static_cast<uint32_t>(p.shape[d]);
+            }
+            entry.offset = offset;
+            entry.nbytes = p.bytes.size();
+            end = offset + p.bytes.size();
+            offset = align(end);
+        }
+
+        std::vector<uint8_t> out (end, 0);
+        BundleHeader header { kBundleMagic, kBundleVersion, static_cast<uint32_t>(pending.size()), 0 };
+        memcpy(out.data(), &header, sizeof(header));
+        memcpy(out.data() + sizeof(header), entries.data(), entries.size() * sizeof(BundleEntry));
+        for (size_t i = 0; i < pending.size(); i++)
+        {
+            memcpy(out.data() + entries[i].offset, pending[i].bytes.data(), pending[i].bytes.size());
+        }
+        return out;
+    }
+
+    void write(const std::string & path) const
+    {
+        FILE * fp = fopen(path.c_str(), "wb");
+        if (fp == nullptr)
+        {
+            throw std::runtime_error("cannot write " + path);
+        }
+        std::vector<uint8_t> bytes = serialize();
+        fwrite(bytes.data(), 1, bytes.size(), fp);
+        fclose(fp);
+    }
+
+private:
+    struct Pending
+    {
+        std::string name;
+        DType dtype;
+        std::vector<int> shape;
+        std::vector<uint8_t> bytes;
+    };
+
+    static uint64_t align(uint64_t offset)
+    {
+        return (offset + kBundleAlignment - 1) / kBundleAlignment * kBundleAlignment;
+    }
+
+    std::vector<Pending> pending;
+};
+
+} // namespace quantnn
@@ -0,0 +1,371 @@
+#pragma once
+
+// Streamed execution of an Engine on dedicated, pinned threads.
+//
+// PipelineRunner assigns the two halves of the forward pass to their own threads,
+// connected by lock-free SPSC rings:
+//
+//   submit() -> [features: quantize, conv1] -> [classifier: fc1, relu, fc2] -> next()
+//
+// so that image N+1's conv1 overlaps image N's fc1. DataParallelRunner is the
+// alternative it is measured against (src/bench/pipeline_bench.cpp): N workers that
+// each run the whole forward pass, fed round-robin.
+//
+// Both runners have a single producer (the thread calling submit and close) and a
+// single consumer (the thread calling next), and return results in submission order.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/affinity.h"
+#include "common/bench.h"
+#include "common/spsc_ring.h"
+#include "engine/engine.h"
+
+namespace quantnn
+{
+
+struct StreamResult
+{
+    uint64_t id = 0;
+    int label = -1;
+    double submit_us = 0.0;
+    double done_us = 0.0;
+    std::vector<float> logits;
+};
+
+class StreamRunner
+{
+public:
+    virtual ~StreamRunner() = default;
+
+    virtual std::string name() const = 0;
+    virtual int threads() const = 0;
+
+    // blocks while the runner is full
+    virtual void submit(uint64_t id, const float * image) = 0;
+    // no more submits; next() returns false once every result has been taken
+    virtual void close() = 0;
+    // blocks until the next result in submission order is ready
+    virtual bool next(StreamResult & result) = 0;
+
+protected:
+    // an activation in flight; the payload is sized once for the stage it feeds
+    struct Slot
+    {
+        explicit Slot(size_t bytes = 0) : data((bytes + sizeof(float) - 1) / sizeof(float)) {}
+
+        uint64_t id = 0;
+        double submit_us = 0.0;
+        bool end = false;
+        std::vector<float> data;
+    };
+
+    struct ResultSlot
+    {
+        explicit ResultSlot(int outputs = 0) : logits(outputs) {}
+
+        uint64_t id = 0;
+        double submit_us = 0.0;
+        double done_us = 0.0;
+        int label = -1;
+        bool end = false;
+        std::vector<float> logits;
+    };
+
+    // start a worker thread per body; cpus[i] pins worker i, a missing or negative entry leaves it unpinned
+    void start(std::vector<std::function<void()>> bodies, const std::vector<int> & cpus)
+    {
+        for (size_t i = 0; i < bodies.size(); i++)
+        {
+            workers.emplace_back(std::move(bodies[i]));
+            if (i < cpus.size())
+            {
+                pin_thread(workers.back(), cpus[i]);
+            }
+        }
+    }
+
+    // unblocks and joins the workers; derived destructors call it before their rings go away
+    void stop()
+    {
+        aborting.store(true, std::memory_order_relaxed);
+        for (std::thread & t : workers)
+        {
+            t.join();
+        }
+        workers.clear();
+    }
+
+    // wait for a free / published slot; nullptr once the runner is being torn down
+    template <typename T>
+    T * claim(SpscRing<T> & ring) const
+    {
+        Backoff backoff;
+        T * slot;
+        while ((slot = ring.try_claim()) == nullptr)
+        {
+            if (aborting.load(std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            backoff.wait();
+        }
+        return slot;
+    }
+
+    template <typename T>
+    T * front(SpscRing<T> & ring) const
+    {
+        Backoff backoff;
+        T * slot;
+        while ((slot = ring.try_front()) == nullptr)
+        {
+            if (aborting.load(std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            backoff.wait();
+        }
+        return slot;
+    }
+
+    void push_image(SpscRing<Slot> & ring, uint64_t id, const float * image)
+    {
+        Slot * slot = claim(ring);
+        if (slot == nullptr)
+        {
+            return;
+        }
+        slot->id = id;
+        slot->submit_us = now_us();
+        slot->end = false;
+        memcpy(slot->data.data(), image, Engine::input_dim * sizeof(float));
+        ring.publish();
+    }
+
+    void push_end(SpscRing<Slot> & ring)
+    {
+        Slot * slot = claim(ring);
+        if (slot == nullptr)
+        {
+            return;
+        }
+        slot->end = true;
+        ring.publish();
+    }
+
+    // false at the end of the stream
+    bool pop_result(SpscRing<ResultSlot> & ring, StreamResult & result)
+    {
+        ResultSlot * slot = front(ring);
+        if (slot == nullptr || slot->end)
+        {
+            return false;
+        }
+        result.id = slot->id;
+        result.label = slot->label;
+        result.submit_us = slot->submit_us;
+        result.done_us = slot->done_us;
+        result.logits.assign(slot->logits.begin(), slot->logits.end());
+        ring.pop();
+        return true;
+    }
+
+    std::atomic<bool> aborting { false };
+    std::vector<std::thread> workers;
+};
+
+class PipelineRunner : public StreamRunner
+{
+public:
+    // cpus: the CPUs of the feature and the classifier thread
+    PipelineRunner(const Engine & engine, size_t capacity, const std::vector<int> & cpus)
+        : engine{engine},
+          input(capacity, Slot(Engine::input_dim * sizeof(float))),
+          features(capacity, Slot(engine.feature_bytes())),
+          output(capacity, ResultSlot(engine.output_dim()))
+    {
+        start({ [this] { run_features(); }, [this] { run_classifier(); } }, cpus);
+    }
+
+    ~PipelineRunner() override { stop(); }
+
+    std::string name() const override { return "pipeline"; }
+    int threads() const override { return 2; }
+
+    void submit(uint64_t id, const float * image) override { push_image(input, id, image); }
+
+    void close() override
+    {
+        if (!closed)
+        {
+            closed = true;
+            push_end(input);
+        }
+    }
+
+    bool next(StreamResult & result) override { return pop_result(output, result); }
+
+private:
+    // quantize, conv1
+    void run_features()
+    {
+        for (;;)
+        {
+            Slot * in = front(input);
+            Slot * out = in != nullptr ? claim(features) : nullptr;
+            if (out == nullptr)
+            {
+                return;
+            }
+            const bool end = in->end;
+            out->id = in->id;
+            out->submit_us = in->submit_us;
+            out->end = end;
+            if (!end)
+            {
+                engine.forward_features(in->data.data(), out->data.data());
+            }
+            input.pop();
+            features.publish();
+            if (end)
+            {
+                return;
+            }
+        }
+    }
+
+    // fc1, relu, fc2
+    void run_classifier()
+    {
+        for (;;)
+        {
+            Slot * in = front(features);
+            ResultSlot * out = in != nullptr ? claim(output) : nullptr;
+            if (out == nullptr)
+            {
+                return;
+            }
+            const bool end = in->end;
+            out->id = in->id;
+            out->submit_us = in->submit_us;
+            out->end = end;
+            if (!end)
+            {
+                engine.forward_classifier(in->data.data(), 1, out->logits.data());
+                out->label = argmax(out->logits.data(), engine.output_dim());
+                out->done_us = now_us();
+            }
+            features.pop();
+            output.publish();
+            if (end)
+            {
+                return;
+            }
+        }
+    }
+
+    const Engine & engine;
+    SpscRing<Slot> input;
+    SpscRing<Slot> features;
+    SpscRing<ResultSlot> output;
+    bool closed = false;
+};
+
+class DataParallelRunner : public StreamRunner
+{
+public:
+    // one input and one output ring per worker; cpus[i] pins worker i
+    DataParallelRunner(const Engine & engine, int worker_count, size_t capacity, const std::vector<int> & cpus)
+        : engine{engine}
+    {
+        worker_count = std::max(1, worker_count);
+        const size_t per_worker = std::max<size_t>(1, capacity / worker_count);
+        std::vector<std::function<void()>> bodies;
+        for (int w = 0; w < worker_count; w++)
+        {
+            inputs.emplace_back(new SpscRing<Slot>(per_worker, Slot(Engine::input_dim * sizeof(float))));
+            outputs.emplace_back(new SpscRing<ResultSlot>(per_worker, ResultSlot(engine.output_dim())));
+            bodies.push_back([this, w] { run_worker(*inputs[w], *outputs[w]); });
+        }
+        start(std::move(bodies), cpus);
+    }
+
+    ~DataParallelRunner() override { stop(); }
+
+    std::string name() const override { return "data-parallel"; }
+    int threads() const override { return static_cast<int>(inputs.size()); }
+
+    void submit(uint64_t id, const float * image) override
+    {
+        push_image(*inputs[submitted++ % inputs.size()], id, image);
+    }
+
+    void close() override
+    {
+        if (!closed)
+        {
+            closed = true;
+            for (auto & ring : inputs)
+            {
+                push_end(*ring);
+            }
+        }
+    }
+
+    bool next(StreamResult & result) override
+    {
+        if (!pop_result(*outputs[taken % outputs.size()], result))
+        {
+            return false;
+        }
+        taken++;
+        return true;
+    }
+
+private:
+    void run_worker(SpscRing<Slot> & input, SpscRing<ResultSlot> & output)
+    {
+        for (;;)
+        {
+            Slot * in = front(input);
+            ResultSlot * out = in != nullptr ? claim(output) : nullptr;
+            if (out == nullptr)
+            {
+                return;
+            }
+            const bool end = in->end;
+            out->id = in->id;
+            out->submit_us = in->submit_us;
+            out->end = end;
+            if (!end)
+            {
+                out->label = engine.forward(in->data.data(), out->logits.data());
+                out->done_us = now_us();
+            }
+            input.pop();
+            output.publish();
+            if (end)
+            {
+                return;
+            }
+        }
+    }
+
+    const Engine & engine;
+    std::vector<std::unique_ptr<SpscRing<Slot>>> inputs;
+    std::vector<std::unique_ptr<SpscRing<ResultSlot>>> outputs;
+    uint64_t submitted = 0;
+    uint64_t taken = 0;
+    bool closed = false;
+};
+
+} // namespace quantnn
@@ -0,0 +1,210 @@
+#pragma once
+
+// Branch merging and BatchNorm folding at load time.
+//
+// A MobileOne block (pytorch/mobileone.py) is trained as several parallel branches
+// that each end in a BatchNorm: num_conv_branches kxk conv-BN branches, a 1x1 conv-BN
+// scale branch and, when in == out channels at stride 1, a BN-only identity branch.
+// Saved before reparameterization, a block `<p>` has the tensors
+//
+//   <p>.rbr_conv.<i>.conv.weight   [out, in / groups, k, k]  + <p>.rbr_conv.<i>.bn.*
+//   <p>.rbr_scale.conv.weight      [out, in / groups, 1, 1]  + <p>.rbr_scale.bn.*
+//   <p>.rbr_skip.*                 BN over the input channels
+//
+// with bn.* = weight, bias, running_mean, running_var and an optional eps scalar
+// (default 1e-5). reparameterize() replaces every such block by the single conv
+// `<p>.weight` [out, in / groups, k, k] and `<p>.bias` [out] that the engines load,
+// using the same fp32 operations in the same order as MobileOneBlock.reparameterize,
+// so a train-time checkpoint runs on the plain single-branch path (and can then be
+// quantized like any fp32 bundle). All other tensors are kept as they are.
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "engine/model_bundle.h"
+
+namespace quantnn
+{
+
+namespace reparam_detail
+{
+
+struct FoldedConv
+{
+    std::vector<int> shape; // [out, in / groups, k, k]
+    std::vector<float> weight;
+    std::vector<float> bias;
+};
+
+inline bool starts_with(const std::string & s, const std::string & prefix)
+{
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+inline const float * bn_tensor(const ModelBundle & bundle, const std::string & bn, const char * name, int channels)
+{
+    const TensorView & t = bundle.get(bn + "." + name);
+    if (static_cast<int>(t.numel()) != channels)
+    {
+        throw std::runtime_error(t.name + " does not match the " + std::to_string(channels) + " channels of its branch");
+    }
+    return t.as<float>();
+}
+
+// per-channel scale gamma / std and shift beta - mean * gamma / std of a BatchNorm (_fuse_bn_tensor)
+inline void fold_bn(const ModelBundle & bundle, const std::string & bn, int channels, std::vector<float> & scale, std::vector<float> & shift)
+{
+    const float * gamma = bn_tensor(bundle, bn, "weight", channels);
+    const float * beta = bn_tensor(bundle, bn, "bias", channels);
+    const float * mean = bn_tensor(bundle, bn, "running_mean", channels);
+    const float * var = bn_tensor(bundle, bn, "running_var", channels);
+    const float eps = bundle.has(bn + ".eps") ? bundle.get(bn + ".eps").as<float>()[0] : 1e-5f;
+    scale.resize(channels);
+    shift.resize(channels);
+    for (int c = 0; c < channels; c++)
+    {
+        const float std = std::sqrt(var[c] + eps);
+        scale[c] = gamma[c] / std;
+        shift[c] = beta[c] - mean[c] * gamma[c] / std;
+    }
+}
+
+// adds the folded conv-BN branch `<branch>.conv` + `<branch>.bn`, centered in a k x k kernel
+inline void add_conv_bn(const ModelBundle & bundle, const std::string & branch, FoldedConv & out)
+{
+    const TensorView & conv = bundle.get(branch + ".conv.weight");
+    const int out_c = out.shape[0];
+    const int in_c = out.shape[1];
+    const int k = out.shape[2];
+    if (conv.shape.size() != 4 || conv.shape[0] != out_c || conv.shape[1] != in_c || conv.shape[2] != conv.shape[3]
+        || conv.shape[2] > k || (k - conv.shape[2]) % 2 != 0)
+    {
+        throw std::runtime_error(conv.name + " does not match the shape of its block");
+    }
+    const int kb = conv.shape[2];
+    const int pad = (k - kb) / 2;
+    const float * w = conv.as<float>();
+    std::vector<float> scale;
+    std::vector<float> shift;
+    fold_bn(bundle, branch + ".bn", out_c, scale, shift);
+    for (int o = 0; o < out_c; o++)
+    {
+        for (int i = 0; i < in_c; i++)
+        {
+            for (int y = 0; y < kb; y++)
+            {
+                for (int x = 0; x < kb; x++)
+                {
+                    const float v = w[((o * in_c + i) * kb + y) * kb + x] * scale[o];
+                    out.weight[((o * in_c + i) * k + y + pad) * k + x + pad] += v;
+                }
+            }
+        }
+        out.bias[o] += shift[o];
+    }
+}
+
+inline FoldedConv fold_block(const ModelBundle & bundle, const std::string & prefix)
+{
+    const TensorView & first = bundle.get(prefix + ".rbr_conv.0.conv.weight");
+    if (first.shape.size() != 4 || first.shape[2] != first.shape[3] || first.shape[2] % 2 == 0)
+    {
+        throw std::runtime_error(first.name + " is not an odd square conv kernel");
+    }
+    FoldedConv folded;
+    folded.shape = first.shape;
+    const int out_c = folded.shape[0];
+    const int in_c = folded.shape[1];
+    const int k = folded.shape[2];
+    folded.weight.assign(static_cast<size_t>(out_c) * in_c * k * k, 0.0f);
+    folded.bias.assign(out_c, 0.0f);
+
+    // conv branches, then the scale branch, then the identity, as in _get_kernel_bias
+    for (int b = 0; bundle.has(prefix + ".rbr_conv." + std::to_string(b) + ".conv.weight"); b++)
+    {
+        add_conv_bn(bundle, prefix + ".rbr_conv." + std::to_string(b), folded);
+    }
+    if (bundle.has(prefix + ".rbr_scale.conv.weight"))
+    {
+        add_conv_bn(bundle, prefix + ".rbr_scale", folded);
+    }
+    if (bundle.has(prefix + ".rbr_skip.running_var"))
+    {
+        // BN(x) as a conv: channel c of a group reads input channel c % (in / groups) at the center tap
+        std::vector<float> scale;
+        std::vector<float> shift;
+        fold_bn(bundle, prefix + ".rbr_skip", out_c, scale, shift);
+        for (int o = 0; o < out_c; o++)
+        {
+            folded.weight[((o * in_c + o % in_c) * k + k / 2) * k + k / 2] += scale[o];
+            folded.bias[o] += shift[o];
+        }
+    }
+    return folded;
+}
+
+} // namespace reparam_detail
+
+// the prefixes of the un-reparameterized blocks in a bundle, in tensor order
+inline std::vector<std::string> branched_blocks(const ModelBundle & bundle)
+{
+    const std::string marker = ".rbr_conv.0.conv.weight";
+    std::vector<std::string> prefixes;
+    for (const TensorView & t : bundle.all())
+    {
+        if (t.name.size() > marker.size() && t.name.compare(t.name.size() - marker.size(), marker.size(), marker) == 0)
+        {
+            prefixes.push_back(t.name.substr(0, t.name.size() - marker.size()));
+        }
+    }
+    return prefixes;
+}
+
+// The bundle with every branched block folded into a single conv; the bundle itself
+// when it has none, so a plain bundle is still used in place.
+inline std::shared_ptr<const ModelBundle> reparameterize(std::shared_ptr<const ModelBundle> bundle)
+{
+    const std::vector<std::string> prefixes = branched_blocks(*bundle);
+    if (prefixes.empty())
+    {
+        return bundle;
+    }
+
+    BundleWriter writer;
+    for (const TensorView & t : bundle->all())
+    {
+        bool branch_tensor = false;
+        for (const std::string & p : prefixes)
+        {
+            branch_tensor = branch_tensor || reparam_detail::starts_with(t.name, p + ".rbr_");
+        }
+        if (!branch_tensor)
+        {
+            writer.add_raw(t.name, t.dtype, t.shape, t.data, t.nbytes);
+        }
+    }
+    for (const std::string & p : prefixes)
+    {
+        if (bundle->has(p + ".weight") || bundle->has(p + ".bias"))
+        {
+            throw std::runtime_error("block " + p + " has both branch tensors and a merged conv");
+        }
+        reparam_detail::FoldedConv folded = reparam_detail::fold_block(*bundle, p);
+        writer.add(p + ".weight", folded.shape, folded.weight);
+        writer.add(p + ".bias", { folded.shape[0] }, folded.bias);
+    }
+
+    auto bytes = std::make_shared<std::vector<uint8_t>>(writer.serialize());
+    return ModelBundle::from_memory(bytes, bytes->data(), bytes->size());
+}
+
+// opens a model bundle for the engines, folding train-time branches if it has any
+inline std::shared_ptr<const ModelBundle> load_model(const std::string & path)
+{
+    return reparameterize(ModelBundle::open(path));
+}
+
+} // namespace quantnn
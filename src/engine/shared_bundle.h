@@ -0,0 +1,337 @@
+#pragma once
+
+// Model bundles shared read-only between worker processes.
+//
+// With one worker process per core, every worker that loads a bundle on its own holds
+// its own copy of whatever is built at load time (a bundle with train-time branches is
+// folded into a heap copy, see engine/reparameterize.h) and pays the load on every cold
+// start. open_shared_model() instead keeps the bundle as the engines use it in a named
+// POSIX shared memory segment (/dev/shm/<name>):
+//
+//   - the first process creates the segment (O_EXCL decides the race), loads and folds
+//     the bundle once, copies it in and marks the segment ready
+//   - every later process maps the segment read-only and builds its engine on the
+//     tensors in place, so a worker only adds its activations and scratch buffers
+//
+// The segment is asked for transparent huge pages (MADV_HUGEPAGE, effective when
+// /sys/kernel/mm/transparent_hugepage/shmem_enabled is "advise" or "within_size").
+// It outlives the processes: remove it with unlink_shared_model() or rm /dev/shm/<name>
+// when the model changes; a segment published from a different file is refused
+// (shared_model_is_stale() tells). reopen_shared_model() replaces a stale segment on a
+// reload. Opening, replacing and republishing all serialize on the lock segment
+// /dev/shm/<name>.lock, so of the processes reloading at once exactly one unlinks and
+// republishes, and neither they nor a process starting up attach to a segment that is
+// being replaced.
+//
+//   SharedSegmentHeader   magic "QNNS", state, size of the bundle, identity of the file
+//   bundle bytes          at kSharedDataOffset, so the 64-byte tensor alignment holds
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "engine/model_bundle.h"
+#include "engine/reparameterize.h"
+
+namespace quantnn
+{
+
+constexpr uint32_t kSharedMagic = 0x534e4e51; // "QNNS"
+constexpr size_t kSharedDataOffset = 4096;
+constexpr size_t kHugePageBytes = 2u << 20;
+
+struct SharedSegmentHeader
+{
+    uint32_t magic;
+    std::atomic<uint32_t> state; // 0 = being written, 1 = ready
+    uint64_t bundle_bytes;
+    // the file the bundle was loaded from
+    uint64_t source_size;
+    uint64_t source_inode;
+    int64_t source_mtime_ns;
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "the ready flag is shared between processes");
+
+namespace shared_detail
+{
+
+inline void stat_source(const std::string & path, SharedSegmentHeader & header)
+{
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0)
+    {
+        throw std::runtime_error("cannot open model bundle " + path);
+    }
+    header.source_size = static_cast<uint64_t>(st.st_size);
+    header.source_inode = static_cast<uint64_t>(st.st_ino);
+    header.source_mtime_ns = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+}
+
+inline std::string segment_path(const std::string & name)
+{
+    return name[0] == '/' ? name : "/" + name;
+}
+
+// maps `size` bytes of fd read-only; the returned owner unmaps them
+inline std::shared_ptr<const void> map_read_only(int fd, size_t size)
+{
+    void * ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED)
+    {
+        throw std::runtime_error("cannot map shared weight segment");
+    }
+    if (size >= kHugePageBytes)
+    {
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+    return std::shared_ptr<const void>(ptr, [size](const void * p) { munmap(const_cast<void *>(p), size); });
+}
+
+inline size_t segment_bytes(size_t bundle_bytes)
+{
+    const size_t bytes = kSharedDataOffset + bundle_bytes;
+    const size_t align = bytes >= kHugePageBytes ? kHugePageBytes : 4096;
+    return (bytes + align - 1) / align * align;
+}
+
+inline std::shared_ptr<const ModelBundle> publish(int fd, const std::string & path)
+{
+    std::shared_ptr<const ModelBundle> bundle = load_model(path);
+    const size_t bytes = segment_bytes(bundle->size());
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0)
+    {
+        throw std::runtime_error("cannot size shared weight segment");
+    }
+    void * ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED)
+    {
+        throw std::runtime_error("cannot map shared weight segment");
+    }
+    if (bytes >= kHugePageBytes)
+    {
+        madvise(ptr, bytes, MADV_HUGEPAGE);
+    }
+    // ftruncate zero-fills, so the state reads 0 until the bundle is complete
+    auto * header = new (ptr) SharedSegmentHeader;
+    header->magic = kSharedMagic;
+    header->bundle_bytes = bundle->size();
+    stat_source(path, *header);
+    memcpy(static_cast<uint8_t *>(ptr) + kSharedDataOffset, bundle->data(), bundle->size());
+    header->state.store(1, std::memory_order_release);
+    munmap(ptr, bytes);
+
+    std::shared_ptr<const void> owner = map_read_only(fd, bytes);
+    return ModelBundle::from_memory(owner, static_cast<const uint8_t *>(owner.get()) + kSharedDataOffset, bundle->size());
+}
+
+// waits up to `timeout` for the publisher to size the segment and mark it ready
+inline std::shared_ptr<const ModelBundle> attach(int fd, const std::string & name, const std::string & path,
+                                                 std::chrono::milliseconds timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (;;)
+    {
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            throw std::runtime_error("cannot stat shared weight segment " + name);
+        }
+        if (static_cast<size_t>(st.st_size) >= kSharedDataOffset)
+        {
+            const size_t bytes = static_cast<size_t>(st.st_size);
+            std::shared_ptr<const void> owner = map_read_only(fd, bytes);
+            const auto * header = static_cast<const SharedSegmentHeader *>(owner.get());
+            if (header->magic == kSharedMagic && header->state.load(std::memory_order_acquire) == 1)
+            {
+                if (kSharedDataOffset + header->bundle_bytes > bytes)
+                {
+                    throw std::runtime_error("corrupt shared weight segment " + name);
+                }
+                if (!path.empty())
+                {
+                    SharedSegmentHeader source {};
+                    stat_source(path, source);
+                    if (source.source_size != header->source_size || source.source_inode != header->source_inode
+                        || source.source_mtime_ns != header->source_mtime_ns)
+                    {
+                        throw std::runtime_error("shared weight segment " + name + " holds another version of " + path
+                                                 + "; remove /dev/shm" + segment_path(name));
+                    }
+                }
+                return ModelBundle::from_memory(owner, static_cast<const uint8_t *>(owner.get()) + kSharedDataOffset,
+                                                header->bundle_bytes);
+            }
+        }
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            throw std::runtime_error("shared weight segment " + name + " was never published; remove /dev/shm" + segment_path(name));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+// holds an exclusive flock on the segment <name>.lock until destroyed
+class ReplaceLock
+{
+public:
+    explicit ReplaceLock(const std::string & name)
+    {
+        const std::string lock_name = segment_path(name) + ".lock";
+        fd = shm_open(lock_name.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0)
+        {
+            throw std::runtime_error("cannot open shared weight lock " + lock_name);
+        }
+        while (flock(fd, LOCK_EX) != 0)
+        {
+            if (errno != EINTR)
+            {
+                ::close(fd);
+                throw std::runtime_error("cannot lock shared weight lock " + lock_name);
+            }
+        }
+    }
+
+    ~ReplaceLock()
+    {
+        ::close(fd);
+    }
+
+    ReplaceLock(const ReplaceLock &) = delete;
+    ReplaceLock & operator=(const ReplaceLock &) = delete;
+
+private:
+    int fd;
+};
+
+// open_shared_model() without the lock, which the caller holds when path is not empty
+inline std::shared_ptr<const ModelBundle> open_unlocked(const std::string & name, const std::string & path, bool * published,
+                                                        std::chrono::milliseconds timeout)
+{
+    const std::string shm_name = segment_path(name);
+    int fd = path.empty() ? -1 : shm_open(shm_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd >= 0)
+    {
+        if (published != nullptr)
+        {
+            *published = true;
+        }
+        try
+        {
+            std::shared_ptr<const ModelBundle> bundle = publish(fd, path);
+            ::close(fd);
+            return bundle;
+        }
+        catch (...)
+        {
+            ::close(fd);
+            shm_unlink(shm_name.c_str());
+            throw;
+        }
+    }
+    if (!path.empty() && errno != EEXIST)
+    {
+        throw std::runtime_error("cannot create shared weight segment " + name);
+    }
+    if (published != nullptr)
+    {
+        *published = false;
+    }
+    fd = shm_open(shm_name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+        throw std::runtime_error("cannot open shared weight segment " + name);
+    }
+    try
+    {
+        std::shared_ptr<const ModelBundle> bundle = attach(fd, name, path, timeout);
+        ::close(fd);
+        return bundle;
+    }
+    catch (...)
+    {
+        ::close(fd);
+        throw;
+    }
+}
+
+} // namespace shared_detail
+
+// The bundle at `path`, folded as by load_model(), from the shared segment `name`:
+// published by this process if the segment does not exist yet (*published = true),
+// else attached read-only. An empty path attaches without checking the source file.
+// With a path, it runs under the lock segment <name>.lock, so it never attaches to a
+// segment that reopen_shared_model() is replacing.
+inline std::shared_ptr<const ModelBundle> open_shared_model(const std::string & name, const std::string & path,
+                                                            bool * published = nullptr,
+                                                            std::chrono::milliseconds timeout = std::chrono::seconds(30))
+{
+    if (path.empty())
+    {
+        return shared_detail::open_unlocked(name, path, published, timeout);
+    }
+    shared_detail::ReplaceLock lock (name);
+    return shared_detail::open_unlocked(name, path, published, timeout);
+}
+
+// whether the segment name exists and was published from another version of path
+inline bool shared_model_is_stale(const std::string & name, const std::string & path)
+{
+    const int fd = shm_open(shared_detail::segment_path(name).c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat st;
+    bool stale = false;
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= kSharedDataOffset)
+    {
+        std::shared_ptr<const void> owner = shared_detail::map_read_only(fd, kSharedDataOffset);
+        const auto * header = static_cast<const SharedSegmentHeader *>(owner.get());
+        SharedSegmentHeader source {};
+        shared_detail::stat_source(path, source);
+        stale = header->state.load(std::memory_order_acquire) == 1
+                && (source.source_size != header->source_size || source.source_inode != header->source_inode
+                    || source.source_mtime_ns != header->source_mtime_ns);
+    }
+    ::close(fd);
+    return stale;
+}
+
+// removes the segment name; processes that have it mapped keep their mapping
+inline bool unlink_shared_model(const std::string & name)
+{
+    return shm_unlink(shared_detail::segment_path(name).c_str()) == 0;
+}
+
+// open_shared_model() for a reload: a segment published from another version of path is
+// replaced first. The staleness check, the unlink and the republish run under the lock
+// segment <name>.lock, so a process that waited for it sees the segment another one just
+// published as current and attaches to it instead of unlinking it again.
+inline std::shared_ptr<const ModelBundle> reopen_shared_model(const std::string & name, const std::string & path,
+                                                              bool * published = nullptr,
+                                                              std::chrono::milliseconds timeout = std::chrono::seconds(30))
+{
+    shared_detail::ReplaceLock lock (name);
+    if (shared_model_is_stale(name, path))
+    {
+        unlink_shared_model(name);
+    }
+    return shared_detail::open_unlocked(name, path, published, timeout);
+}
+
+} // namespace quantnn
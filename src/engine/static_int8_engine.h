@@ -0,0 +1,184 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/engine.h"
+#include "engine/model_bundle.h"
+
+#include "kernels/activation.h"
+#include "kernels/conv.h"
+#include "kernels/linear.h"
+#include "kernels/quantize.h"
+
+namespace quantnn
+{
+
+// int8 weights and activations with the activation scales calibrated offline
+// (scale.input, scale.conv1, scale.fc1, scale.relu in the bundle).
+class StaticInt8Engine : public Engine
+{
+public:
+    explicit StaticInt8Engine(std::shared_ptr<const ModelBundle> bundle)
+        : bundle{bundle}, shape{MnistNet::from_bundle(*bundle)}
+    {
+        input_scale = bundle->get("scale.input").as<float>()[0];
+        fc1_out_scale = bundle->get("scale.fc1").as<float>()[0];
+        relu_scale = bundle->get("scale.relu").as<float>()[0];
+
+        float fc1_in_scale = input_scale;
+        if (shape.conv)
+        {
+            qconv1_weight = bundle->get("conv1.qweight").as<int8_t>();
+            conv1_bias = bundle->get("conv1.bias").as<float>();
+            conv1_out_scale = bundle->get("scale.conv1").as<float>()[0];
+            se = SqueezeExcite::from_bundle(*bundle, "conv1.se", shape.conv_out_c);
+            const float * wscale = bundle->get("conv1.wscale").as<float>();
+            for (int o = 0; o < shape.conv_out_c; o++)
+            {
+                conv1_multiplier.push_back(wscale[o] * input_scale);
+            }
+            fc1_in_scale = conv1_out_scale;
+        }
+
+        qfc1_weight = bundle->get("fc1.qweight").as<int8_t>();
+        fc1_bias = bundle->get("fc1.bias").as<float>();
+        fc1_multiplier.assign(shape.fc1_out, fc1_in_scale * bundle->get("fc1.wscale").as<float>()[0]);
+
+        qfc2_weight = bundle->get("fc2.qweight").as<int8_t>();
+        fc2_bias = bundle->get("fc2.bias").as<float>();
+        fc2_multiplier.assign(shape.fc2_out, relu_scale * bundle->get("fc2.wscale").as<float>()[0]);
+    }
+
+    std::string name() const override { return shape.conv ? "conv_static" : "mlp_static"; }
+    const MnistNet & net() const override { return shape; }
+
+    // features: fc1_in int8 values with scale.conv1 (ConvNet) or scale.input (MLP)
+    size_t feature_bytes() const override { return shape.fc1_in; }
+
+    void forward_features(const float * image, void * features) const override
+    {
+        int8_t * out = static_cast<int8_t *>(features);
+        if (shape.conv)
+        {
+            conv1(image, out);
+        }
+        else
+        {
+            quantize_s8(image, shape.fc1_in, input_scale, out);
+        }
+    }
+
+    void forward_classifier(const void * features, int batch, float * logits) const override
+    {
+        const int in = shape.fc1_in;
+        const int hidden_dim = shape.fc1_out;
+        const int8_t * qx = static_cast<const int8_t *>(features);
+
+        int32_t * acc = scratch<int32_t>(0, static_cast<size_t>(batch) * hidden_dim);
+        linear_s8s8_batch(qx, qfc1_weight, batch, in, hidden_dim, acc);
+        classify_hidden(acc, batch, logits);
+    }
+
+    bool can_fuse_conv_fc1() const override { return shape.conv && !se.enabled(); }
+
+    // fc1 accumulators (batch x fc1_out) -> requantize, ReLU, fc2 -> logits
+    void classify_hidden(const int32_t * acc, int batch, float * logits) const
+    {
+        const int hidden_dim = shape.fc1_out;
+        int8_t * qh = scratch<int8_t>(1, static_cast<size_t>(batch) * hidden_dim);
+        uint8_t * uh = scratch<uint8_t>(0, static_cast<size_t>(batch) * hidden_dim);
+        for (int b = 0; b < batch; b++)
+        {
+            requantize_s8(&acc[b * hidden_dim], hidden_dim, 1, fc1_multiplier.data(), fc1_bias, fc1_out_scale, &qh[b * hidden_dim]);
+        }
+        relu_s8_u8(qh, batch * hidden_dim, fc1_out_scale, relu_scale, uh);
+
+        const int out = shape.fc2_out;
+        int32_t * acc2 = scratch<int32_t>(1, static_cast<size_t>(batch) * out);
+        linear_u8s8_batch(uh, qfc2_weight, batch, hidden_dim, out, acc2);
+        for (int b = 0; b < batch; b++)
+        {
+            dequantize_s32(&acc2[b * out], out, 1, fc2_multiplier.data(), fc2_bias, &logits[b * out]);
+        }
+    }
+
+    // conv1 (+ squeeze-excitation) + ReLU of a single image, output in int8 with scale.conv1
+    void conv1(const float * image, int8_t * out) const
+    {
+        const int size = shape.image_size;
+        const int out_c = shape.conv_out_c;
+        int8_t * qimage = scratch<int8_t>(2, size * size);
+        quantize_s8(image, size * size, input_scale, qimage);
+
+        int32_t * acc = scratch<int32_t>(2, shape.fc1_in);
+        if (!se.enabled())
+        {
+            conv3x3_s8s8_requantize(qimage, 1, size, size, 1, qconv1_weight, out_c, conv1_multiplier.data(), conv1_bias,
+                                    conv1_out_scale, acc, out);
+            relu_s8(out, shape.fc1_in);
+            return;
+        }
+        // the gate lies in (0, 1), so the gated map stays within the calibrated scale.conv1
+        int64_t * row_sums = scratch<int64_t>(0, out_c * size);
+        conv3x3_s8s8(qimage, 1, size, size, qconv1_weight, out_c, acc, row_sums);
+        float * gate = scratch<float>(5, 4 * out_c);
+        float * gated_multiplier = gate + 2 * out_c;
+        float * gated_bias = gate + 3 * out_c;
+        channel_means_s32(row_sums, out_c, size, size, conv1_multiplier.data(), conv1_bias, gate + out_c);
+        se.gate(gate + out_c, gate);
+        se_gate_affine(conv1_multiplier.data(), conv1_bias, gate, out_c, gated_multiplier, gated_bias);
+        requantize_s8(acc, out_c, size * size, gated_multiplier, gated_bias, conv1_out_scale, out);
+        relu_s8(out, shape.fc1_in);
+    }
+
+protected:
+    // conv1 one output channel at a time into an int8 tile, each tile added into the fc1
+    // accumulators at once; integer sums, so the logits equal the unfused ones
+    void forward_fused(const float * image, float * logits) const override
+    {
+        const int size = shape.image_size;
+        const int plane = size * size;
+        int8_t * qimage = scratch<int8_t>(2, plane);
+        quantize_s8(image, plane, input_scale, qimage);
+
+        int32_t * conv_acc = scratch<int32_t>(2, plane);
+        int8_t * tile = scratch<int8_t>(3, plane);
+        int32_t * acc = scratch<int32_t>(0, shape.fc1_out);
+        for (int i = 0; i < shape.fc1_out; i++)
+        {
+            acc[i] = 0;
+        }
+        for (int o = 0; o < shape.conv_out_c; o++)
+        {
+            conv3x3_s8s8_requantize(qimage, 1, size, size, 1, &qconv1_weight[o * 9], 1, &conv1_multiplier[o], &conv1_bias[o],
+                                    conv1_out_scale, conv_acc, tile);
+            relu_s8(tile, plane);
+            linear_s8s8_accumulate(tile, &qfc1_weight[static_cast<size_t>(o) * plane], shape.fc1_in, plane, shape.fc1_out, acc);
+        }
+        classify_hidden(acc, 1, logits);
+    }
+
+private:
+    std::shared_ptr<const ModelBundle> bundle;
+    MnistNet shape;
+
+    float input_scale = 1.0f;
+    float conv1_out_scale = 1.0f;
+    float fc1_out_scale = 1.0f;
+    float relu_scale = 1.0f;
+
+    const int8_t * qconv1_weight = nullptr;
+    const float * conv1_bias = nullptr;
+    std::vector<float> conv1_multiplier;
+    SqueezeExcite se;
+    const int8_t * qfc1_weight = nullptr;
+    const float * fc1_bias = nullptr;
+    std::vector<float> fc1_multiplier;
+    const int8_t * qfc2_weight = nullptr;
+    const float * fc2_bias = nullptr;
+    std::vector<float> fc2_multiplier;
+};
+
+} // namespace quantnn
@@ -0,0 +1,492 @@
+#pragma once
+
+// Bounded-memory execution: the weights of only a window of layers are resident.
+//
+// StreamedEngine maps the bundle file and runs the layers of a MixedEngine one at a
+// time. Before a layer runs, WeightStreamer makes sure its tensors are mapped in,
+// hands the next window - 1 layers to a prefetch thread (madvise(MADV_WILLNEED) to
+// start the readahead, then one read per page to fault them in) and drops every layer
+// outside the window with madvise(MADV_DONTNEED). The layers form a cycle, so during
+// fc2 of one forward pass the prefetcher already brings in conv1 of the next one:
+//
+//   window 1      load each layer on demand, nothing overlaps (the slowest, smallest)
+//   window 2      the current layer computes while the next one loads
+//   window >= L   every layer stays resident after the first pass, as with Engine
+//
+// Only the tensors the layer's precision reads are streamed (fc1.weight or
+// fc1.qweight, not both). Dropped pages of an unmodified read-only file mapping are
+// read back from the page cache or the file on their next use, so a release never
+// changes the results, only the cost of the next load; with drop_page_cache the
+// released range is also evicted from the page cache (posix_fadvise), so that the
+// next load really reads the file, as it would on a host without room to cache it.
+//
+// StreamStats reports the time spent loading layers, the part of it the compute thread
+// waited for (stall), the overlap 1 - stall / load, the peak bytes of weights in the
+// window and the process's peak RSS (VmHWM, reset by reset_stats()). Forward passes on
+// one StreamedEngine are serialized, as the window follows a single sequence of layers.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "engine/engine.h"
+#include "engine/mixed_engine.h"
+#include "engine/model_bundle.h"
+#include "engine/reparameterize.h"
+
+namespace quantnn
+{
+
+struct StreamOptions
+{
+    int window = 2;          // layers resident at once, the running one included
+    size_t budget_bytes = 0; // when set, the largest window whose weights fit in it
+    bool drop_page_cache = false;
+};
+
+struct StreamStats
+{
+    uint64_t loads = 0;        // layers brought in
+    double load_us = 0.0;      // time spent bringing them in, on either thread
+    double stall_us = 0.0;     // time the compute thread waited for a layer
+    double compute_us = 0.0;   // time in the layers themselves
+    size_t peak_window_bytes = 0;
+    long peak_rss_kb = 0;
+
+    // the share of the load time hidden behind computation
+    double overlap() const { return load_us > 0.0 ? std::max(0.0, 1.0 - stall_us / load_us) : 1.0; }
+};
+
+// peak resident set size of the process (VmHWM), 0 if /proc is not there
+inline long peak_rss_kb()
+{
+    FILE * fp = fopen("/proc/self/status", "r");
+    if (fp == nullptr)
+    {
+        return 0;
+    }
+    char line[256];
+    long kb = 0;
+    while (fgets(line, sizeof(line), fp) != nullptr)
+    {
+        if (strncmp(line, "VmHWM:", 6) == 0)
+        {
+            kb = atol(line + 6);
+            break;
+        }
+    }
+    fclose(fp);
+    return kb;
+}
+
+// restarts VmHWM from the current RSS (Linux 4.0+); false if the kernel refused
+inline bool reset_peak_rss()
+{
+    FILE * fp = fopen("/proc/self/clear_refs", "w");
+    if (fp == nullptr)
+    {
+        return false;
+    }
+    const bool ok = fputs("5", fp) >= 0;
+    return fclose(fp) == 0 && ok;
+}
+
+class WeightStreamer
+{
+public:
+    // [begin, end) byte offsets into the file of one tensor
+    struct Range
+    {
+        size_t begin;
+        size_t end;
+    };
+
+    // layers: the tensor ranges of each layer, in execution order
+    WeightStreamer(const uint8_t * base, int fd, const std::vector<std::vector<Range>> & layers, const StreamOptions & options)
+        : base{base}, fd{fd}, drop_page_cache{options.drop_page_cache}
+    {
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        for (const std::vector<Range> & tensors : layers)
+        {
+            LayerPages l;
+            for (const Range & r : tensors)
+            {
+                if (r.end > r.begin)
+                {
+                    Range p { r.begin / page * page, (r.end + page - 1) / page * page };
+                    l.ranges.push_back(p);
+                    l.bytes += p.end - p.begin;
+                }
+            }
+            pages.push_back(l);
+        }
+        this->page = page;
+        window = options.budget_bytes > 0 ? window_for_budget(options.budget_bytes) : options.window;
+        window = std::max(1, std::min(window, layer_count()));
+        prefetcher = std::thread([this] { prefetch_loop(); });
+    }
+
+    ~WeightStreamer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        prefetcher.join();
+    }
+
+    WeightStreamer(const WeightStreamer &) = delete;
+    WeightStreamer & operator=(const WeightStreamer &) = delete;
+
+    int layer_count() const { return static_cast<int>(pages.size()); }
+    int window_layers() const { return window; }
+    size_t layer_bytes(int layer) const { return pages[layer].bytes; }
+
+    // Makes `layer` resident before it runs, waiting for the prefetcher if it is
+    // loading it, then prefetches the rest of the window and releases the other layers.
+    void acquire(int layer)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        LayerPages & l = pages[layer];
+        if (l.state == State::Released)
+        {
+            l.state = State::Loading;
+            lock.unlock();
+            const double us = load(layer);
+            lock.lock();
+            l.state = State::Resident;
+            totals.loads++;
+            totals.load_us += us;
+            totals.stall_us += us;
+        }
+        else if (l.state != State::Resident)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            done.wait(lock, [&] { return l.state == State::Resident; });
+            totals.stall_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        for (int j = 0; j < layer_count(); j++)
+        {
+            if (!in_window_of(layer, j) && pages[j].state == State::Resident)
+            {
+                release(j, layer);
+                pages[j].state = State::Released;
+            }
+        }
+        for (int k = 1; k < window; k++)
+        {
+            const int next = (layer + k) % layer_count();
+            if (pages[next].state == State::Released)
+            {
+                pages[next].state = State::Queued;
+                queue.push_back(next);
+                wake.notify_one();
+            }
+        }
+
+        size_t in_window = 0;
+        for (const LayerPages & p : pages)
+        {
+            in_window += p.state != State::Released ? p.bytes : 0;
+        }
+        totals.peak_window_bytes = std::max(totals.peak_window_bytes, in_window);
+    }
+
+    void add_compute_us(double us)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        totals.compute_us += us;
+    }
+
+    StreamStats stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        StreamStats s = totals;
+        s.peak_rss_kb = peak_rss_kb();
+        return s;
+    }
+
+    void reset_stats()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        totals = StreamStats();
+        reset_peak_rss();
+    }
+
+private:
+    enum class State
+    {
+        Released,
+        Queued,
+        Loading,
+        Resident,
+    };
+
+    struct LayerPages
+    {
+        std::vector<Range> ranges; // page aligned
+        size_t bytes = 0;
+        State state = State::Released;
+    };
+
+    bool in_window_of(int current, int layer) const
+    {
+        return (layer - current + layer_count()) % layer_count() < window;
+    }
+
+    // the largest window whose every run of consecutive layers fits in the budget
+    int window_for_budget(size_t budget) const
+    {
+        int best = 0;
+        for (int w = 1; w <= layer_count(); w++)
+        {
+            bool fits = true;
+            for (int first = 0; first < layer_count() && fits; first++)
+            {
+                size_t bytes = 0;
+                for (int k = 0; k < w; k++)
+                {
+                    bytes += pages[(first + k) % layer_count()].bytes;
+                }
+                fits = bytes <= budget;
+            }
+            if (!fits)
+            {
+                break;
+            }
+            best = w;
+        }
+        if (best == 0)
+        {
+            size_t largest = 0;
+            for (const LayerPages & l : pages)
+            {
+                largest = std::max(largest, l.bytes);
+            }
+            throw std::runtime_error("a layer has " + std::to_string(largest) + " bytes of weights, more than the budget of "
+                                     + std::to_string(budget));
+        }
+        return best;
+    }
+
+    // madvise(WILLNEED) to start the readahead, then a read per page to map it in
+    double load(int layer) const
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (const Range & r : pages[layer].ranges)
+        {
+            madvise(const_cast<uint8_t *>(base) + r.begin, r.end - r.begin, MADV_WILLNEED);
+        }
+        for (const Range & r : pages[layer].ranges)
+        {
+            for (size_t p = r.begin; p < r.end; p += page)
+            {
+                (void) *static_cast<const volatile uint8_t *>(base + p);
+            }
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Drops the pages of `layer`, keeping a first or last page shared with a tensor of
+    // a layer that stays in the window of `current`. Called with the mutex held.
+    void release(int layer, int current) const
+    {
+        for (const Range & r : pages[layer].ranges)
+        {
+            size_t begin = r.begin;
+            size_t end = r.end;
+            for (int j = 0; j < layer_count(); j++)
+            {
+                if (j == layer || !in_window_of(current, j))
+                {
+                    continue;
+                }
+                for (const Range & kept : pages[j].ranges)
+                {
+                    if (kept.begin <= begin && begin < kept.end)
+                    {
+                        begin += page;
+                    }
+                    if (end > begin && kept.begin < end && end <= kept.end)
+                    {
+                        end -= page;
+                    }
+                }
+            }
+            if (end > begin)
+            {
+                madvise(const_cast<uint8_t *>(base) + begin, end - begin, MADV_DONTNEED);
+                if (drop_page_cache)
+                {
+                    posix_fadvise(fd, static_cast<off_t>(begin), static_cast<off_t>(end - begin), POSIX_FADV_DONTNEED);
+                }
+            }
+        }
+    }
+
+    void prefetch_loop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            wake.wait(lock, [this] { return stop || !queue.empty(); });
+            if (stop)
+            {
+                return;
+            }
+            const int layer = queue.front();
+            queue.pop_front();
+            pages[layer].state = State::Loading;
+            lock.unlock();
+            const double us = load(layer);
+            lock.lock();
+            pages[layer].state = State::Resident;
+            totals.loads++;
+            totals.load_us += us;
+            done.notify_all();
+        }
+    }
+
+    const uint8_t * base;
+    int fd;
+    bool drop_page_cache;
+    size_t page = 4096;
+    int window = 2;
+    std::vector<LayerPages> pages;
+
+    mutable std::mutex mutex;
+    std::condition_variable wake; // work for the prefetcher
+    std::condition_variable done; // a layer became resident
+    std::deque<int> queue;
+    bool stop = false;
+    StreamStats totals;
+    std::thread prefetcher;
+};
+
+class StreamedEngine : public Engine
+{
+public:
+    // The bundle must be a file as the engines run it: branched blocks have to be
+    // folded beforehand (convert_bundle), as a folded copy would live on the heap.
+    StreamedEngine(const std::string & path, const LayerPrecisions & precisions, const StreamOptions & options = StreamOptions())
+    {
+        std::shared_ptr<const ModelBundle> bundle = ModelBundle::open(path);
+        if (!branched_blocks(*bundle).empty())
+        {
+            throw std::runtime_error(path + " has train-time branches; fold it with convert_bundle to stream it");
+        }
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("cannot open model bundle " + path);
+        }
+        mixed = std::make_unique<MixedEngine>(bundle, precisions);
+        std::vector<Layer> layers;
+        if (mixed->net().conv)
+        {
+            layers.push_back(Layer::Conv1);
+        }
+        layers.push_back(Layer::FC1);
+        layers.push_back(Layer::FC2);
+
+        std::vector<std::vector<WeightStreamer::Range>> ranges;
+        for (Layer layer : layers)
+        {
+            ranges.push_back(tensor_ranges(*bundle, layer, precisions[layer]));
+        }
+        streamer = std::make_unique<WeightStreamer>(bundle->data(), fd, ranges, options);
+        // the engine has read what it needs at load; start from an empty window
+        madvise(const_cast<uint8_t *>(bundle->data()), bundle->size(), MADV_DONTNEED);
+    }
+
+    ~StreamedEngine() override
+    {
+        streamer.reset();
+        ::close(fd);
+    }
+
+    std::string name() const override { return mixed->net().conv ? "conv_streamed" : "mlp_streamed"; }
+    const MnistNet & net() const override { return mixed->net(); }
+    size_t feature_bytes() const override { return mixed->feature_bytes(); }
+
+    const LayerPrecisions & layer_precisions() const { return mixed->layer_precisions(); }
+    const WeightStreamer & weights() const { return *streamer; }
+    StreamStats stats() const { return streamer->stats(); }
+    void reset_stats() { streamer->reset_stats(); }
+
+    void forward_features(const float * image, void * features) const override
+    {
+        if (!net().conv)
+        {
+            mixed->forward_features(image, features);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(running);
+        run(0, [&] { mixed->conv1(image, static_cast<float *>(features), layer_precisions()[Layer::Conv1]); });
+    }
+
+    void forward_classifier(const void * features, int batch, float * logits) const override
+    {
+        const float * x = static_cast<const float *>(features);
+        const MnistNet & shape = net();
+        const int fc1 = shape.conv ? 1 : 0;
+        float * hidden = scratch<float>(2, static_cast<size_t>(batch) * shape.fc1_out);
+        std::lock_guard<std::mutex> lock(running);
+        run(fc1, [&] {
+            mixed->linear(Layer::FC1, x, batch, hidden, layer_precisions()[Layer::FC1]);
+            relu_f32(hidden, batch * shape.fc1_out);
+        });
+        run(fc1 + 1, [&] { mixed->linear(Layer::FC2, hidden, batch, logits, layer_precisions()[Layer::FC2]); });
+    }
+
+private:
+    template <typename F>
+    void run(int layer, F compute) const
+    {
+        streamer->acquire(layer);
+        const auto start = std::chrono::steady_clock::now();
+        compute();
+        streamer->add_compute_us(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    // the tensors `layer` reads in `precision`: <layer>.* without the weights of the other precision
+    static std::vector<WeightStreamer::Range> tensor_ranges(const ModelBundle & bundle, Layer layer, Precision precision)
+    {
+        const std::string prefix = std::string(layer_name(layer)) + ".";
+        const std::string unused = prefix + (precision == Precision::FP32 ? "qweight" : "weight");
+        std::vector<WeightStreamer::Range> ranges;
+        for (const TensorView & t : bundle.all())
+        {
+            if (reparam_detail::starts_with(t.name, prefix) && t.name != unused)
+            {
+                const size_t begin = static_cast<const uint8_t *>(t.data) - bundle.data();
+                ranges.push_back({ begin, begin + t.nbytes });
+            }
+        }
+        return ranges;
+    }
+
+    int fd = -1;
+    std::unique_ptr<MixedEngine> mixed;
+    std::unique_ptr<WeightStreamer> streamer;
+    mutable std::mutex running;
+};
+
+} // namespace quantnn
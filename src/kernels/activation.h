@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+#include "kernels/dispatch.h"
+
+namespace quantnn
+{
+
+inline void relu_f32(float * x, int n)
+{
+    kernels().relu_f32(x, n);
+}
+
+// ReLU on symmetric int8 values in place; the scale is unchanged
+inline void relu_s8(int8_t * x, int n)
+{
+    kernels().relu_s8(x, n);
+}
+
+// ReLU on symmetric int8 input, requantized to uint8 with zero-point 0
+inline void relu_s8_u8(const int8_t * x, int n, float in_scale, float out_scale, uint8_t * y)
+{
+    kernels().relu_s8_u8(x, n, in_scale, out_scale, y);
+}
+
+} // namespace quantnn
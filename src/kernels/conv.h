@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "common/half.h"
+#include "common/thread_pool.h"
+#include "kernels/dispatch.h"
+#include "kernels/tuning.h"
+
+namespace quantnn
+{
+
+// Direct 3x3 convolution, stride 1, with a one-pixel zero border ("same" padding).
+//   in:     in_c x h x w, read as is: the border is handled inside the kernel, so the
+//           input is never copied into a padded buffer
+//   weight: out_c x in_c x 3 x 3
+//   out:    out_c x h x w
+// The out_c x h output rows are split across the intra-op pool, and each row is
+// computed by the selected ISA tier (kernels/dispatch.h); the tier and the split of each
+// shape come from the tuning cache (kernels/tuning.h).
+// With row_sums (out_c x h), each output row is also summed right after it is computed,
+// which is the pooling of a following squeeze-excitation (kernels/se.h).
+inline void conv3x3_f32(const float * in, int in_c, int h, int w,
+                        const float * weight, const float * bias, int out_c, float * out,
+                        float * row_sums = nullptr)
+{
+    const TuneConfig t = tuned_config(TuneKey::conv(TunedOp::Conv3x3F32, in_c, out_c, h, w));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_c * h, t.grain(out_c * h, 9.0 * in_c * w), [=, &k](int begin, int end) {
+        k.conv3x3_f32_rows(in, in_c, h, w, weight, bias, out, begin, end);
+        for (int r = begin; row_sums != nullptr && r < end; r++)
+        {
+            float sum = 0.0f;
+            for (int j = 0; j < w; j++)
+            {
+                sum += out[r * w + j];
+            }
+            row_sums[r] = sum;
+        }
+    });
+}
+
+// int8 x int8 -> int32 accumulators with a one-pixel zero border at stride 1 or 2:
+//   out: out_c x out_h x out_w with out_h = (h - 1) / stride + 1, likewise out_w
+// The AVX2 and AVX-512 tiers multiply-add pairs of taps in int16 (pmaddwd) and are
+// bit-exact with the scalar loop.
+// row_sums (out_c x out_h) are exact.
+inline void conv3x3_s8s8_strided(const int8_t * in, int in_c, int h, int w, int stride,
+                                 const int8_t * weight, int out_c, int32_t * acc,
+                                 int64_t * row_sums = nullptr)
+{
+    const int out_h = (h - 1) / stride + 1;
+    const int out_w = (w - 1) / stride + 1;
+    const TuneConfig t = tuned_config(TuneKey::conv(TunedOp::Conv3x3S8S8, in_c, out_c, out_h, out_w));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_c * out_h, t.grain(out_c * out_h, 9.0 * in_c * out_w), [=, &k](int begin, int end) {
+        k.conv3x3_s8s8_rows(in, in_c, h, w, stride, weight, acc, begin, end);
+        for (int r = begin; row_sums != nullptr && r < end; r++)
+        {
+            int64_t sum = 0;
+            for (int j = 0; j < out_w; j++)
+            {
+                sum += acc[r * out_w + j];
+            }
+            row_sums[r] = sum;
+        }
+    });
+}
+
+// stride 1, same layout as conv3x3_f32
+inline void conv3x3_s8s8(const int8_t * in, int in_c, int h, int w,
+                         const int8_t * weight, int out_c, int32_t * acc,
+                         int64_t * row_sums = nullptr)
+{
+    conv3x3_s8s8_strided(in, in_c, h, w, 1, weight, out_c, acc, row_sums);
+}
+
+// conv3x3_s8s8_strided followed by requantize_s8 (per output channel multiplier and
+// bias), with each chunk of rows requantized while its accumulators are still in L1.
+// acc is scratch of out_c x out_h x out_w.
+inline void conv3x3_s8s8_requantize(const int8_t * in, int in_c, int h, int w, int stride,
+                                    const int8_t * weight, int out_c, const float * multiplier,
+                                    const float * bias, float out_scale, int32_t * acc, int8_t * out)
+{
+    const int out_h = (h - 1) / stride + 1;
+    const int out_w = (w - 1) / stride + 1;
+    const TuneConfig t = tuned_config(TuneKey::conv(TunedOp::Conv3x3S8S8, in_c, out_c, out_h, out_w));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_c * out_h, t.grain(out_c * out_h, 9.0 * in_c * out_w), [=, &k](int begin, int end) {
+        k.conv3x3_s8s8_rows(in, in_c, h, w, stride, weight, acc, begin, end);
+        // the rows of one channel are contiguous, so each channel of the chunk is one call
+        for (int r = begin; r < end;)
+        {
+            const int o = r / out_h;
+            const int r_end = min_of(end, (o + 1) * out_h);
+            k.requantize_row(&acc[r * out_w], (r_end - r) * out_w, multiplier[o], bias[o], out_scale, &out[r * out_w]);
+            r = r_end;
+        }
+    });
+}
+
+// fp32 convolution with fp16 or bf16 weights (W = Half or BFloat16). There are only
+// out_c x in_c x 9 weights, so they are widened once per call into a per-thread buffer.
+template <typename W>
+inline void conv3x3_w16(const float * in, int in_c, int h, int w,
+                        const W * weight, const float * bias, int out_c, float * out,
+                        float * row_sums = nullptr)
+{
+    thread_local std::vector<float> wide;
+    const size_t n = static_cast<size_t>(out_c) * in_c * 9;
+    if (wide.size() < n)
+    {
+        wide.resize(n);
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        wide[i] = to_float(weight[i]);
+    }
+    conv3x3_f32(in, in_c, h, w, wide.data(), bias, out_c, out, row_sums);
+}
+
+} // namespace quantnn
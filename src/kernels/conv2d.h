@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "common/thread_pool.h"
+#include "kernels/conv.h"
+#include "kernels/dispatch.h"
+
+namespace quantnn
+{
+
+// General 2-D convolution (Conv2dShape in kernels/dispatch.h: any channels, kernel size,
+// stride, padding, dilation and groups, including depthwise), in fp32 or int8 x int8 ->
+// int32 accumulators. The implementation is chosen once per layer, when the Conv2d is
+// built at model load:
+//   pointwise   1x1, stride 1, no padding, one group: four output channels per pass
+//               over the input (conv1x1_*_channels)
+//   depthwise   3x3, padding 1, groups = in_c = out_c: the conv3x3 row kernels of
+//               conv.h on one channel each
+//   dense3x3    3x3, padding 1, one group: conv3x3_f32 / conv3x3_s8s8_strided
+//   generic     everything else (conv2d_*_rows)
+// The 3x3 paths take stride 1 or 2 (and dilation 1); fp32 at stride 2 runs the generic
+// rows, as the fp32 3x3 kernel has no stride. Every path sums in the order of the
+// generic one, so all of them give bit-identical results on every tier. The 3x3 fp32
+// kernels always add a bias, so without one the fp32 3x3 layers also run generic.
+enum class Conv2dPath
+{
+    Pointwise,
+    Depthwise3x3,
+    Dense3x3,
+    Generic,
+};
+
+inline const char * conv2d_path_name(Conv2dPath path)
+{
+    switch (path)
+    {
+        case Conv2dPath::Pointwise: return "pointwise";
+        case Conv2dPath::Depthwise3x3: return "depthwise3x3";
+        case Conv2dPath::Dense3x3: return "dense3x3";
+        case Conv2dPath::Generic: return "generic";
+    }
+    return "unknown";
+}
+
+inline Conv2dPath select_conv2d_path(const Conv2dShape & s)
+{
+    const bool square_stride = s.stride_h == s.stride_w && (s.stride_h == 1 || s.stride_h == 2);
+    const bool same_3x3 = s.kernel_h == 3 && s.kernel_w == 3 && s.pad_h == 1 && s.pad_w == 1 && s.dilation_h == 1
+                          && s.dilation_w == 1 && square_stride;
+    if (s.kernel_h == 1 && s.kernel_w == 1 && s.stride_h == 1 && s.stride_w == 1 && s.pad_h == 0 && s.pad_w == 0
+        && s.groups == 1)
+    {
+        return Conv2dPath::Pointwise;
+    }
+    if (same_3x3 && s.groups > 1 && s.groups == s.in_c && s.groups == s.out_c)
+    {
+        return Conv2dPath::Depthwise3x3;
+    }
+    if (same_3x3 && s.groups == 1)
+    {
+        return Conv2dPath::Dense3x3;
+    }
+    return Conv2dPath::Generic;
+}
+
+class Conv2d
+{
+public:
+    // path is normally chosen from the shape; benchmarks and tests may force Generic
+    explicit Conv2d(const Conv2dShape & shape) : Conv2d(shape, select_conv2d_path(shape)) {}
+
+    Conv2d(const Conv2dShape & shape, Conv2dPath path) : s{shape}, chosen{path}
+    {
+        if (s.in_c <= 0 || s.out_c <= 0 || s.groups <= 0 || s.in_c % s.groups != 0 || s.out_c % s.groups != 0)
+        {
+            throw std::runtime_error("conv2d: " + std::to_string(s.in_c) + " -> " + std::to_string(s.out_c)
+                                     + " channels do not split into " + std::to_string(s.groups) + " groups");
+        }
+        if (s.kernel_h <= 0 || s.kernel_w <= 0 || s.stride_h <= 0 || s.stride_w <= 0 || s.dilation_h <= 0
+            || s.dilation_w <= 0 || s.pad_h < 0 || s.pad_w < 0 || s.out_h() <= 0 || s.out_w() <= 0)
+        {
+            throw std::runtime_error("conv2d: invalid kernel, stride, padding or dilation for a "
+                                     + std::to_string(s.in_h) + "x" + std::to_string(s.in_w) + " input");
+        }
+        if (path != Conv2dPath::Generic && path != select_conv2d_path(s))
+        {
+            throw std::runtime_error(std::string("conv2d: the ") + conv2d_path_name(path) + " path does not fit this shape");
+        }
+    }
+
+    const Conv2dShape & shape() const { return s; }
+    Conv2dPath path() const { return chosen; }
+    size_t output_size() const { return static_cast<size_t>(s.out_c) * s.out_h() * s.out_w(); }
+
+    // in: in_c x in_h x in_w, weight: out_c x in_c / groups x kernel_h x kernel_w,
+    // bias: out_c or nullptr, out: out_c x out_h x out_w
+    void run_f32(const float * in, const float * weight, const float * bias, float * out) const
+    {
+        const KernelTable & k = kernels();
+        const int out_h = s.out_h();
+        const int out_w = s.out_w();
+        const int hw = s.in_h * s.in_w;
+        switch (chosen)
+        {
+            case Conv2dPath::Pointwise:
+                parallel_for(0, s.out_c, grain_for(2.0 * s.in_c * hw), [=, &k](int begin, int end) {
+                    k.conv1x1_f32_channels(in, s.in_c, hw, weight, bias, out, begin, end);
+                });
+                return;
+            case Conv2dPath::Depthwise3x3:
+                if (s.stride_h == 1 && bias != nullptr)
+                {
+                    parallel_for(0, s.out_c * out_h, grain_for(18.0 * out_w), [=, &k](int begin, int end) {
+                        for (int r = begin; r < end;)
+                        {
+                            const int c = r / out_h;
+                            const int r_end = min_of(end, (c + 1) * out_h);
+                            const size_t plane = static_cast<size_t>(c) * hw;
+                            k.conv3x3_f32_rows(in + plane, 1, s.in_h, s.in_w, weight + c * 9, bias + c,
+                                               out + plane, r - c * out_h, r_end - c * out_h);
+                            r = r_end;
+                        }
+                    });
+                    return;
+                }
+                break;
+            case Conv2dPath::Dense3x3:
+                if (s.stride_h == 1 && bias != nullptr)
+                {
+                    conv3x3_f32(in, s.in_c, s.in_h, s.in_w, weight, bias, s.out_c, out);
+                    return;
+                }
+                break;
+            case Conv2dPath::Generic:
+                break;
+        }
+        const Conv2dShape shape = s;
+        parallel_for(0, s.out_c * out_h, grain_for(2.0 * s.in_c / s.groups * s.kernel_h * s.kernel_w * out_w),
+                     [=, &k](int begin, int end) { k.conv2d_f32_rows(in, shape, weight, bias, out, begin, end); });
+    }
+
+    // int8 x int8 -> int32 accumulators, layouts as in run_f32
+    void run_s8s8(const int8_t * in, const int8_t * weight, int32_t * acc) const
+    {
+        const KernelTable & k = kernels();
+        const int out_h = s.out_h();
+        const int out_w = s.out_w();
+        const int hw = s.in_h * s.in_w;
+        switch (chosen)
+        {
+            case Conv2dPath::Pointwise:
+                parallel_for(0, s.out_c, grain_for(2.0 * s.in_c * hw), [=, &k](int begin, int end) {
+                    k.conv1x1_s8s8_channels(in, s.in_c, hw, weight, acc, begin, end);
+                });
+                return;
+            case Conv2dPath::Depthwise3x3:
+            {
+                const int stride = s.stride_h;
+                const size_t out_plane = static_cast<size_t>(out_h) * out_w;
+                parallel_for(0, s.out_c * out_h, grain_for(18.0 * out_w), [=, &k](int begin, int end) {
+                    for (int r = begin; r < end;)
+                    {
+                        const int c = r / out_h;
+                        const int r_end = min_of(end, (c + 1) * out_h);
+                        k.conv3x3_s8s8_rows(in + static_cast<size_t>(c) * hw, 1, s.in_h, s.in_w, stride, weight + c * 9,
+                                            acc + c * out_plane, r - c * out_h, r_end - c * out_h);
+                        r = r_end;
+                    }
+                });
+                return;
+            }
+            case Conv2dPath::Dense3x3:
+                conv3x3_s8s8_strided(in, s.in_c, s.in_h, s.in_w, s.stride_h, weight, s.out_c, acc);
+                return;
+            case Conv2dPath::Generic:
+                break;
+        }
+        const Conv2dShape shape = s;
+        parallel_for(0, s.out_c * out_h, grain_for(2.0 * s.in_c / s.groups * s.kernel_h * s.kernel_w * out_w),
+                     [=, &k](int begin, int end) { k.conv2d_s8s8_rows(in, shape, weight, acc, begin, end); });
+    }
+
+private:
+    Conv2dShape s;
+    Conv2dPath chosen;
+};
+
+} // namespace quantnn
@@ -0,0 +1,260 @@
+#pragma once
+
+// Kernel dispatch: one table of function pointers per ISA tier (common/cpu_features.h),
+// with the table of the selected tier used by the public kernels in src/kernels.
+//
+// Every tier starts from the portable bodies in kernels/isa/generic.inc compiled for
+// that tier, and replaces the reductions with the hand-written SIMD code of
+// kernels/isa/x86.h. The tier is chosen once at startup; set_isa() switches it, e.g.
+// for kernel_bench to time every tier in one run.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "common/cpu_features.h"
+#include "common/half.h"
+
+#ifdef QUANTNN_X86
+#include "kernels/isa/x86.h"
+#endif
+
+namespace quantnn
+{
+
+// std::round (halfway cases away from zero) in a form the compiler can vectorize:
+// v - trunc(v) is exact, so this gives the same result for every float
+__attribute__((always_inline)) inline float round_half_away(float v)
+{
+    float t = __builtin_truncf(v); // std::trunc would not be inlined into the tiers
+    float d = v - t;
+    return d >= 0.5f ? t + 1.0f : (d <= -0.5f ? t - 1.0f : t);
+}
+
+// std::max, std::min and std::clamp with the same semantics (including which operand a
+// NaN propagates from). GCC does not inline the std:: versions into functions compiled
+// with different optimize options, which keeps the tier loops from vectorizing.
+template <typename T>
+__attribute__((always_inline)) inline T max_of(T a, T b)
+{
+    return a < b ? b : a;
+}
+
+template <typename T>
+__attribute__((always_inline)) inline T min_of(T a, T b)
+{
+    return b < a ? b : a;
+}
+
+template <typename T>
+__attribute__((always_inline)) inline T clamp_to(T v, T lo, T hi)
+{
+    return v < lo ? lo : (hi < v ? hi : v);
+}
+
+// A 2-D convolution over a CHW image (kernels/conv2d.h): weights out_c x (in_c / groups)
+// x kernel_h x kernel_w, output out_c x out_h x out_w, zero padding.
+struct Conv2dShape
+{
+    int in_c = 1;
+    int in_h = 1;
+    int in_w = 1;
+    int out_c = 1;
+    int kernel_h = 3;
+    int kernel_w = 3;
+    int stride_h = 1;
+    int stride_w = 1;
+    int pad_h = 0;
+    int pad_w = 0;
+    int dilation_h = 1;
+    int dilation_w = 1;
+    int groups = 1;
+
+    int out_h() const { return (in_h + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1; }
+    int out_w() const { return (in_w + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1; }
+};
+
+struct KernelTable
+{
+    Isa isa;
+    float (*dot_f32)(const float *, const float *, int);
+    int32_t (*dot_s8s8)(const int8_t *, const int8_t *, int);
+    int32_t (*dot_u8s8)(const uint8_t *, const int8_t *, int);
+    float (*dot_f16_f32)(const Half *, const float *, int);
+    float (*dot_bf16_f32)(const BFloat16 *, const float *, int);
+    float (*absmax_f32)(const float *, int);
+    void (*minmax_f32)(const float *, int, float &, float &);
+    void (*quantize_s8)(const float *, int, float, int8_t *);
+    void (*quantize_u8)(const float *, int, float, int, uint8_t *);
+    void (*dequantize_row)(const int32_t *, int, float, float, float *);
+    void (*requantize_row)(const int32_t *, int, float, float, float, int8_t *);
+    void (*relu_f32)(float *, int);
+    void (*relu_s8)(int8_t *, int);
+    void (*relu_s8_u8)(const int8_t *, int, float, float, uint8_t *);
+    void (*conv3x3_f32_rows)(const float *, int, int, int, const float *, const float *, float *, int, int);
+    void (*conv3x3_s8s8_rows)(const int8_t *, int, int, int, int, const int8_t *, int32_t *, int, int);
+    void (*conv2d_f32_rows)(const float *, const Conv2dShape &, const float *, const float *, float *, int, int);
+    void (*conv2d_s8s8_rows)(const int8_t *, const Conv2dShape &, const int8_t *, int32_t *, int, int);
+    void (*conv1x1_f32_channels)(const float *, int, int, const float *, const float *, float *, int, int);
+    void (*conv1x1_s8s8_channels)(const int8_t *, int, int, const int8_t *, int32_t *, int, int);
+};
+
+} // namespace quantnn
+
+// The generic tiers are compiled without FMA contraction so that they match the scalar
+// tier, and without trapping math: otherwise GCC keeps the float compares of clamp and
+// round_half_away as branches and the quantize loops do not vectorize. Neither option
+// changes a result, only whether FP exception flags are raised exactly.
+#if defined(__GNUC__) && !defined(__clang__)
+#define QUANTNN_TIER_OPTIMIZE optimize("fp-contract=off,no-trapping-math"),
+#else
+#define QUANTNN_TIER_OPTIMIZE
+#endif
+
+#define QUANTNN_ISA_NS scalar
+#define QUANTNN_ISA_TARGET
+#include "kernels/isa/generic.inc"
+#undef QUANTNN_ISA_NS
+#undef QUANTNN_ISA_TARGET
+
+#ifdef QUANTNN_X86
+#define QUANTNN_ISA_NS sse41
+#define QUANTNN_ISA_TARGET __attribute__((QUANTNN_TIER_OPTIMIZE target("sse4.1")))
+#include "kernels/isa/generic.inc"
+#undef QUANTNN_ISA_NS
+#undef QUANTNN_ISA_TARGET
+
+#define QUANTNN_ISA_NS avx2
+#define QUANTNN_ISA_TARGET __attribute__((QUANTNN_TIER_OPTIMIZE target("avx2")))
+#include "kernels/isa/generic.inc"
+#undef QUANTNN_ISA_NS
+#undef QUANTNN_ISA_TARGET
+
+#define QUANTNN_ISA_NS avx512
+#define QUANTNN_ISA_TARGET __attribute__((QUANTNN_TIER_OPTIMIZE target("avx512f,avx512bw,avx512vl")))
+#include "kernels/isa/generic.inc"
+#undef QUANTNN_ISA_NS
+#undef QUANTNN_ISA_TARGET
+#endif
+
+#define QUANTNN_GENERIC_KERNELS(tier, ns)                                                                \
+    KernelTable { tier, isa::ns::dot_f32, isa::ns::dot_s8s8, isa::ns::dot_u8s8, isa::ns::dot_f16_f32,    \
+                  isa::ns::dot_bf16_f32, isa::ns::absmax_f32, isa::ns::minmax_f32, isa::ns::quantize_s8, \
+                  isa::ns::quantize_u8, isa::ns::dequantize_row, isa::ns::requantize_row,                \
+                  isa::ns::relu_f32, isa::ns::relu_s8, isa::ns::relu_s8_u8, isa::ns::conv3x3_f32_rows,   \
+                  isa::ns::conv3x3_s8s8_rows, isa::ns::conv2d_f32_rows, isa::ns::conv2d_s8s8_rows,       \
+                  isa::ns::conv1x1_f32_channels, isa::ns::conv1x1_s8s8_channels }
+
+namespace quantnn
+{
+
+namespace dispatch_detail
+{
+
+inline KernelTable make_table(Isa tier)
+{
+    KernelTable t = QUANTNN_GENERIC_KERNELS(Isa::Scalar, scalar);
+#ifdef QUANTNN_X86
+    switch (tier)
+    {
+        case Isa::Scalar:
+            break;
+        case Isa::SSE41:
+            t = QUANTNN_GENERIC_KERNELS(tier, sse41);
+            t.dot_f32 = simd::dot_f32_sse41;
+            t.dot_s8s8 = simd::dot_s8s8_sse41;
+            t.dot_u8s8 = simd::dot_u8s8_sse41;
+            t.absmax_f32 = simd::absmax_f32_sse41;
+            break;
+        case Isa::AVX2:
+        case Isa::AVXVNNI:
+            t = QUANTNN_GENERIC_KERNELS(tier, avx2);
+            t.dot_f32 = simd::dot_f32_avx2;
+            t.dot_s8s8 = simd::dot_s8s8_avx2;
+            t.dot_u8s8 = simd::dot_u8s8_avx2;
+            t.dot_f16_f32 = simd::dot_f16_f32_avx2;
+            t.dot_bf16_f32 = simd::dot_bf16_f32_avx2;
+            t.absmax_f32 = simd::absmax_f32_avx2;
+            t.conv3x3_s8s8_rows = simd::conv3x3_s8s8_rows_avx2;
+#ifdef QUANTNN_HAVE_AVXVNNI
+            if (tier == Isa::AVXVNNI)
+            {
+                t.dot_s8s8 = simd::dot_s8s8_avxvnni;
+                t.dot_u8s8 = simd::dot_u8s8_avxvnni;
+            }
+#endif
+            break;
+        case Isa::AVX512:
+        case Isa::AVX512VNNI:
+            t = QUANTNN_GENERIC_KERNELS(tier, avx512);
+            t.dot_f32 = simd::dot_f32_avx512;
+            t.dot_s8s8 = simd::dot_s8s8_avx512;
+            t.dot_u8s8 = simd::dot_u8s8_avx512;
+            t.dot_f16_f32 = simd::dot_f16_f32_avx512;
+            t.dot_bf16_f32 = simd::dot_bf16_f32_avx512;
+            t.absmax_f32 = simd::absmax_f32_avx512;
+            t.conv3x3_s8s8_rows = simd::conv3x3_s8s8_rows_avx512;
+            if (tier == Isa::AVX512VNNI)
+            {
+                t.dot_s8s8 = simd::dot_s8s8_avx512vnni;
+                t.dot_u8s8 = simd::dot_u8s8_avx512vnni;
+            }
+            break;
+    }
+#endif
+    t.isa = tier;
+    return t;
+}
+
+inline std::atomic<const KernelTable *> & active()
+{
+    static std::atomic<const KernelTable *> table { nullptr };
+    return table;
+}
+
+} // namespace dispatch_detail
+
+// the table of one tier; only call it for a tier that isa_supported()
+inline const KernelTable & kernel_table(Isa tier)
+{
+    static const KernelTable tables[kIsaCount] = {
+        dispatch_detail::make_table(Isa::Scalar),  dispatch_detail::make_table(Isa::SSE41),
+        dispatch_detail::make_table(Isa::AVX2),    dispatch_detail::make_table(Isa::AVXVNNI),
+        dispatch_detail::make_table(Isa::AVX512),  dispatch_detail::make_table(Isa::AVX512VNNI),
+    };
+    return tables[static_cast<int>(tier)];
+}
+
+// the table the kernels use; default_isa() on first use
+inline const KernelTable & kernels()
+{
+    const KernelTable * table = dispatch_detail::active().load(std::memory_order_acquire);
+    if (table == nullptr)
+    {
+        static const KernelTable * initial = &kernel_table(default_isa());
+        const KernelTable * expected = nullptr;
+        dispatch_detail::active().compare_exchange_strong(expected, initial);
+        table = dispatch_detail::active().load(std::memory_order_acquire);
+    }
+    return *table;
+}
+
+inline Isa active_isa()
+{
+    return kernels().isa;
+}
+
+// switches every kernel to another tier; throws if this CPU cannot run it
+inline void set_isa(Isa tier)
+{
+    if (!isa_supported(tier))
+    {
+        throw std::runtime_error(std::string("ISA tier ") + isa_name(tier) + " is not supported by this CPU");
+    }
+    dispatch_detail::active().store(&kernel_table(tier), std::memory_order_release);
+}
+
+} // namespace quantnn
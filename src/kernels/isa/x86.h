@@ -0,0 +1,678 @@
+#pragma once
+
+// Hand-written x86 SIMD versions of the reductions that the compiler does not vectorize
+// by itself: the dot products behind the linear layers, absmax and the int8 3x3 conv.
+// Integer results are exact on every tier; the fp32 dot products sum in a different
+// order than the scalar loop, so their results can differ from the scalar tier in the
+// last bits.
+//
+// fp16 weights are widened with F16C (vcvtph2ps) and bf16 weights by shifting them into
+// the upper half of a 32-bit lane; both widenings are exact.
+//
+// int8 x int8 without VNNI sign-extends to int16 and uses madd (pmaddwd), which cannot
+// saturate, unlike pmaddubsw. With VNNI, u8 x s8 maps to vpdpbusd directly, and s8 x s8
+// is computed as (x + 128) x w - 128 * sum(w) with the weight sum from a second vpdpbusd.
+//
+// The int8 3x3 convolution computes a block of output columns of one output row per
+// vector: the three input rows of the output row are staged with their zero border (and
+// at stride 2 split into even and odd columns), so that each of the 9 taps is a plain
+// unaligned load of consecutive columns, and the int16 values of two taps are interleaved
+// and multiplied by a (w_a, w_b) pair with madd. The VNNI tiers use the same kernels:
+// interleaving the bytes of four taps for vpdpbusd costs more than it saves at 9 taps.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <immintrin.h>
+
+#include "common/half.h"
+
+#if (defined(__clang__) && __clang_major__ >= 12) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11)
+#define QUANTNN_HAVE_AVXVNNI 1
+#endif
+
+#define QUANTNN_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define QUANTNN_TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+#define QUANTNN_TARGET_AVXVNNI __attribute__((target("avx2,fma,f16c,avxvnni")))
+#define QUANTNN_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl")))
+#define QUANTNN_TARGET_AVX512VNNI __attribute__((target("avx512f,avx512bw,avx512vl,avx512vnni")))
+
+namespace quantnn
+{
+namespace simd
+{
+
+// ---- conv3x3 row staging ----
+
+// zero bytes after each staged row, so that a whole vector can be loaded past out_w
+constexpr int kConvStageSlack = 64;
+
+inline int conv_stage_row_bytes(int out_w)
+{
+    return 2 * (out_w + 2 + kConvStageSlack);
+}
+
+// thread-local staging buffer for in_c channels x 3 rows, plus the 9 tap pointers per channel
+inline int8_t * conv_stage_buffer(int in_c, int row_bytes, const int8_t ** & taps)
+{
+    thread_local std::vector<int8_t> buffer;
+    thread_local std::vector<const int8_t *> tap_buffer;
+    const size_t n = static_cast<size_t>(in_c) * 3 * row_bytes;
+    if (buffer.size() < n)
+    {
+        buffer.resize(n);
+    }
+    if (tap_buffer.size() < static_cast<size_t>(in_c) * 9)
+    {
+        tap_buffer.resize(static_cast<size_t>(in_c) * 9);
+    }
+    taps = tap_buffer.data();
+    return buffer.data();
+}
+
+// Stages the rows i * stride - 1 .. i * stride + 1 of one input channel (zero outside the
+// image) into buf and points taps[k * 3 + l] at the input of tap (k, l) for output column 0.
+// Padded column q + 1 holds input column q; at stride 2 the even padded columns go to the
+// first half of the row and the odd ones to the second.
+inline void stage_conv3x3_rows(const int8_t * in, int h, int w, int stride, int i,
+                               int8_t * buf, int row_bytes, const int8_t ** taps)
+{
+    const int half = row_bytes / 2;
+    for (int k = 0; k < 3; k++)
+    {
+        int8_t * dst = buf + k * row_bytes;
+        memset(dst, 0, row_bytes);
+        const int r = i * stride + k - 1;
+        if (r >= 0 && r < h)
+        {
+            const int8_t * x = in + r * w;
+            if (stride == 1)
+            {
+                memcpy(dst + 1, x, w);
+            }
+            else
+            {
+                for (int m = 0; 2 * m + 1 < w; m++)
+                {
+                    dst[1 + m] = x[2 * m + 1];
+                }
+                for (int m = 0; 2 * m < w; m++)
+                {
+                    dst[half + m] = x[2 * m];
+                }
+            }
+        }
+        for (int l = 0; l < 3; l++)
+        {
+            taps[k * 3 + l] = stride == 1 ? dst + l : dst + (l == 1 ? half : l / 2);
+        }
+    }
+}
+
+// (w_a, w_b) as the two int16 halves of an int32 lane, for madd
+inline int32_t pack_pair(int8_t a, int8_t b)
+{
+    const uint32_t lo = static_cast<uint16_t>(static_cast<int16_t>(a));
+    const uint32_t hi = static_cast<uint16_t>(static_cast<int16_t>(b));
+    return static_cast<int32_t>(lo | (hi << 16));
+}
+
+// ---- SSE4.1 ----
+
+QUANTNN_TARGET_SSE41 inline float hsum_128(__m128 v)
+{
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+}
+
+QUANTNN_TARGET_SSE41 inline int32_t hsum_128(__m128i v)
+{
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+QUANTNN_TARGET_SSE41 inline float dot_f32_sse41(const float * a, const float * b, int n)
+{
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    int j = 0;
+    for (; j + 8 <= n; j += 8)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + j), _mm_loadu_ps(b + j)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + j + 4), _mm_loadu_ps(b + j + 4)));
+    }
+    float value = hsum_128(_mm_add_ps(acc0, acc1));
+    for (; j < n; j++)
+    {
+        value += a[j] * b[j];
+    }
+    return value;
+}
+
+QUANTNN_TARGET_SSE41 inline int32_t dot_s8s8_sse41(const int8_t * a, const int8_t * b, int n)
+{
+    __m128i acc = _mm_setzero_si128();
+    int j = 0;
+    for (; j + 16 <= n; j += 16)
+    {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + j));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_cvtepi8_epi16(va), _mm_cvtepi8_epi16(vb)));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(va, 8)),
+                                                _mm_cvtepi8_epi16(_mm_srli_si128(vb, 8))));
+    }
+    int32_t value = hsum_128(acc);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+QUANTNN_TARGET_SSE41 inline int32_t dot_u8s8_sse41(const uint8_t * a, const int8_t * b, int n)
+{
+    __m128i acc = _mm_setzero_si128();
+    int j = 0;
+    for (; j + 16 <= n; j += 16)
+    {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + j));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_cvtepu8_epi16(va), _mm_cvtepi8_epi16(vb)));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(va, 8)),
+                                                _mm_cvtepi8_epi16(_mm_srli_si128(vb, 8))));
+    }
+    int32_t value = hsum_128(acc);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+QUANTNN_TARGET_SSE41 inline float absmax_f32_sse41(const float * x, int n)
+{
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 acc = _mm_setzero_ps();
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        acc = _mm_max_ps(acc, _mm_and_ps(_mm_loadu_ps(x + i), abs_mask));
+    }
+    acc = _mm_max_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_max_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+    float max_val = _mm_cvtss_f32(acc);
+    for (; i < n; i++)
+    {
+        max_val = std::max(max_val, std::abs(x[i]));
+    }
+    return max_val;
+}
+
+// ---- AVX2 ----
+
+QUANTNN_TARGET_AVX2 inline float hsum_256(__m256 v)
+{
+    __m128 lo = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    lo = _mm_add_ps(lo, _mm_movehl_ps(lo, lo));
+    lo = _mm_add_ss(lo, _mm_shuffle_ps(lo, lo, 1));
+    return _mm_cvtss_f32(lo);
+}
+
+QUANTNN_TARGET_AVX2 inline int32_t hsum_256(__m256i v)
+{
+    __m128i lo = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    lo = _mm_add_epi32(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2)));
+    lo = _mm_add_epi32(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(lo);
+}
+
+QUANTNN_TARGET_AVX2 inline float dot_f32_avx2(const float * a, const float * b, int n)
+{
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int j = 0;
+    for (; j + 16 <= n; j += 16)
+    {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + j), _mm256_loadu_ps(b + j), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + j + 8), _mm256_loadu_ps(b + j + 8), acc1);
+    }
+    float value = hsum_256(_mm256_add_ps(acc0, acc1));
+    for (; j < n; j++)
+    {
+        value += a[j] * b[j];
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX2 inline __m256 load_bf16x8(const BFloat16 * w)
+{
+    __m256i bits = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(w)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(bits, 16));
+}
+
+QUANTNN_TARGET_AVX2 inline float dot_f16_f32_avx2(const Half * w, const float * x, int n)
+{
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int j = 0;
+    for (; j + 16 <= n; j += 16)
+    {
+        __m256 w0 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(w + j)));
+        __m256 w1 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(w + j + 8)));
+        acc0 = _mm256_fmadd_ps(w0, _mm256_loadu_ps(x + j), acc0);
+        acc1 = _mm256_fmadd_ps(w1, _mm256_loadu_ps(x + j + 8), acc1);
+    }
+    float value = hsum_256(_mm256_add_ps(acc0, acc1));
+    for (; j < n; j++)
+    {
+        value += half_to_float(w[j]) * x[j];
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX2 inline float dot_bf16_f32_avx2(const BFloat16 * w, const float * x, int n)
+{
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int j = 0;
+    for (; j + 16 <= n; j += 16)
+    {
+        acc0 = _mm256_fmadd_ps(load_bf16x8(w + j), _mm256_loadu_ps(x + j), acc0);
+        acc1 = _mm256_fmadd_ps(load_bf16x8(w + j + 8), _mm256_loadu_ps(x + j + 8), acc1);
+    }
+    float value = hsum_256(_mm256_add_ps(acc0, acc1));
+    for (; j < n; j++)
+    {
+        value += bf16_to_float(w[j]) * x[j];
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX2 inline int32_t dot_s8s8_avx2(const int8_t * a, const int8_t * b, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int j = 0;
+    for (; j + 16 <= n; j += 16)
+    {
+        __m256i va = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + j)));
+        __m256i vb = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(va, vb));
+    }
+    int32_t value = hsum_256(acc);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX2 inline int32_t dot_u8s8_avx2(const uint8_t * a, const int8_t * b, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int j = 0;
+    for (; j + 16 <= n; j += 16)
+    {
+        __m256i va = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + j)));
+        __m256i vb = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(va, vb));
+    }
+    int32_t value = hsum_256(acc);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX2 inline float absmax_f32_avx2(const float * x, int n)
+{
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    __m256 acc = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        acc = _mm256_max_ps(acc, _mm256_and_ps(_mm256_loadu_ps(x + i), abs_mask));
+    }
+    __m128 lo = _mm_max_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    lo = _mm_max_ps(lo, _mm_movehl_ps(lo, lo));
+    lo = _mm_max_ss(lo, _mm_shuffle_ps(lo, lo, 1));
+    float max_val = _mm_cvtss_f32(lo);
+    for (; i < n; i++)
+    {
+        max_val = std::max(max_val, std::abs(x[i]));
+    }
+    return max_val;
+}
+
+QUANTNN_TARGET_AVX2 inline __m256i load_s8x16_epi16(const int8_t * p)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+}
+
+// conv3x3_s8s8_rows with 16 output columns per step
+QUANTNN_TARGET_AVX2 inline void conv3x3_s8s8_rows_avx2(const int8_t * in, int in_c, int h, int w, int stride,
+                                                      const int8_t * weight, int32_t * acc, int row_begin, int row_end)
+{
+    const int out_h = (h - 1) / stride + 1;
+    const int out_w = (w - 1) / stride + 1;
+    const int row_bytes = conv_stage_row_bytes(out_w);
+    const int8_t ** taps;
+    int8_t * stage = conv_stage_buffer(in_c, row_bytes, taps);
+    for (int row = row_begin; row < row_end; row++)
+    {
+        const int o = row / out_h;
+        const int i = row % out_h;
+        for (int c = 0; c < in_c; c++)
+        {
+            stage_conv3x3_rows(in + c * h * w, h, w, stride, i, stage + c * 3 * row_bytes, row_bytes, taps + c * 9);
+        }
+        int32_t * y = &acc[row * out_w];
+        for (int j = 0; j < out_w; j += 16)
+        {
+            __m256i lo = _mm256_setzero_si256();
+            __m256i hi = _mm256_setzero_si256();
+            for (int c = 0; c < in_c; c++)
+            {
+                const int8_t * const * t = taps + c * 9;
+                const int8_t * wc = weight + (o * in_c + c) * 9;
+                for (int p = 0; p < 9; p += 2)
+                {
+                    const __m256i a = load_s8x16_epi16(t[p] + j);
+                    const __m256i b = p + 1 < 9 ? load_s8x16_epi16(t[p + 1] + j) : _mm256_setzero_si256();
+                    const __m256i wp = _mm256_set1_epi32(pack_pair(wc[p], p + 1 < 9 ? wc[p + 1] : 0));
+                    lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), wp));
+                    hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), wp));
+                }
+            }
+            // unpack works per 128-bit lane: lo holds columns 0-3 and 8-11, hi 4-7 and 12-15
+            const __m256i first = _mm256_permute2x128_si256(lo, hi, 0x20);
+            const __m256i second = _mm256_permute2x128_si256(lo, hi, 0x31);
+            if (j + 16 <= out_w)
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(y + j), first);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(y + j + 8), second);
+            }
+            else
+            {
+                alignas(32) int32_t tail[16];
+                _mm256_store_si256(reinterpret_cast<__m256i *>(tail), first);
+                _mm256_store_si256(reinterpret_cast<__m256i *>(tail + 8), second);
+                memcpy(y + j, tail, sizeof(int32_t) * (out_w - j));
+            }
+        }
+    }
+}
+
+// ---- AVX-VNNI (256-bit, VEX) ----
+
+#ifdef QUANTNN_HAVE_AVXVNNI
+QUANTNN_TARGET_AVXVNNI inline int32_t dot_u8s8_avxvnni(const uint8_t * a, const int8_t * b, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int j = 0;
+    for (; j + 32 <= n; j += 32)
+    {
+        acc = _mm256_dpbusd_avx_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + j)),
+                                      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j)));
+    }
+    int32_t value = hsum_256(acc);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVXVNNI inline int32_t dot_s8s8_avxvnni(const int8_t * a, const int8_t * b, int n)
+{
+    const __m256i bias = _mm256_set1_epi8(static_cast<char>(0x80));
+    const __m256i ones = _mm256_set1_epi8(1);
+    __m256i acc = _mm256_setzero_si256();
+    __m256i b_sum = _mm256_setzero_si256();
+    int j = 0;
+    for (; j + 32 <= n; j += 32)
+    {
+        __m256i va = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + j)), bias);
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j));
+        acc = _mm256_dpbusd_avx_epi32(acc, va, vb);
+        b_sum = _mm256_dpbusd_avx_epi32(b_sum, ones, vb);
+    }
+    int32_t value = hsum_256(acc) - 128 * hsum_256(b_sum);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+#endif
+
+// ---- AVX-512 ----
+
+QUANTNN_TARGET_AVX512 inline float dot_f32_avx512(const float * a, const float * b, int n)
+{
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int j = 0;
+    for (; j + 32 <= n; j += 32)
+    {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + j), _mm512_loadu_ps(b + j), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + j + 16), _mm512_loadu_ps(b + j + 16), acc1);
+    }
+    if (j + 16 <= n)
+    {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + j), _mm512_loadu_ps(b + j), acc0);
+        j += 16;
+    }
+    float value = _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+    for (; j < n; j++)
+    {
+        value += a[j] * b[j];
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX512 inline __m512 load_bf16x16(const BFloat16 * w)
+{
+    __m512i bits = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(w)));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(bits, 16));
+}
+
+QUANTNN_TARGET_AVX512 inline __m512 load_f16x16(const Half * w)
+{
+    return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(w)));
+}
+
+QUANTNN_TARGET_AVX512 inline float dot_f16_f32_avx512(const Half * w, const float * x, int n)
+{
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int j = 0;
+    for (; j + 32 <= n; j += 32)
+    {
+        acc0 = _mm512_fmadd_ps(load_f16x16(w + j), _mm512_loadu_ps(x + j), acc0);
+        acc1 = _mm512_fmadd_ps(load_f16x16(w + j + 16), _mm512_loadu_ps(x + j + 16), acc1);
+    }
+    if (j + 16 <= n)
+    {
+        acc0 = _mm512_fmadd_ps(load_f16x16(w + j), _mm512_loadu_ps(x + j), acc0);
+        j += 16;
+    }
+    float value = _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+    for (; j < n; j++)
+    {
+        value += half_to_float(w[j]) * x[j];
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX512 inline float dot_bf16_f32_avx512(const BFloat16 * w, const float * x, int n)
+{
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int j = 0;
+    for (; j + 32 <= n; j += 32)
+    {
+        acc0 = _mm512_fmadd_ps(load_bf16x16(w + j), _mm512_loadu_ps(x + j), acc0);
+        acc1 = _mm512_fmadd_ps(load_bf16x16(w + j + 16), _mm512_loadu_ps(x + j + 16), acc1);
+    }
+    if (j + 16 <= n)
+    {
+        acc0 = _mm512_fmadd_ps(load_bf16x16(w + j), _mm512_loadu_ps(x + j), acc0);
+        j += 16;
+    }
+    float value = _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+    for (; j < n; j++)
+    {
+        value += bf16_to_float(w[j]) * x[j];
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX512 inline int32_t dot_s8s8_avx512(const int8_t * a, const int8_t * b, int n)
+{
+    __m512i acc = _mm512_setzero_si512();
+    int j = 0;
+    for (; j + 32 <= n; j += 32)
+    {
+        __m512i va = _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + j)));
+        __m512i vb = _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j)));
+        acc = _mm512_add_epi32(acc, _mm512_madd_epi16(va, vb));
+    }
+    int32_t value = _mm512_reduce_add_epi32(acc);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX512 inline int32_t dot_u8s8_avx512(const uint8_t * a, const int8_t * b, int n)
+{
+    __m512i acc = _mm512_setzero_si512();
+    int j = 0;
+    for (; j + 32 <= n; j += 32)
+    {
+        __m512i va = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + j)));
+        __m512i vb = _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j)));
+        acc = _mm512_add_epi32(acc, _mm512_madd_epi16(va, vb));
+    }
+    int32_t value = _mm512_reduce_add_epi32(acc);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX512 inline float absmax_f32_avx512(const float * x, int n)
+{
+    __m512 acc = _mm512_setzero_ps();
+    int i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        acc = _mm512_max_ps(acc, _mm512_abs_ps(_mm512_loadu_ps(x + i)));
+    }
+    float max_val = _mm512_reduce_max_ps(acc);
+    for (; i < n; i++)
+    {
+        max_val = std::max(max_val, std::abs(x[i]));
+    }
+    return max_val;
+}
+
+// conv3x3_s8s8_rows with 32 output columns per step
+QUANTNN_TARGET_AVX512 inline void conv3x3_s8s8_rows_avx512(const int8_t * in, int in_c, int h, int w, int stride,
+                                                          const int8_t * weight, int32_t * acc, int row_begin, int row_end)
+{
+    const int out_h = (h - 1) / stride + 1;
+    const int out_w = (w - 1) / stride + 1;
+    const int row_bytes = conv_stage_row_bytes(out_w);
+    const int8_t ** taps;
+    int8_t * stage = conv_stage_buffer(in_c, row_bytes, taps);
+    // unpack works per 128-bit lane: lo holds columns 0-3, 8-11, 16-19, 24-27 and hi the others
+    const __m512i first_half = _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0);
+    const __m512i second_half = _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4);
+    for (int row = row_begin; row < row_end; row++)
+    {
+        const int o = row / out_h;
+        const int i = row % out_h;
+        for (int c = 0; c < in_c; c++)
+        {
+            stage_conv3x3_rows(in + c * h * w, h, w, stride, i, stage + c * 3 * row_bytes, row_bytes, taps + c * 9);
+        }
+        int32_t * y = &acc[row * out_w];
+        for (int j = 0; j < out_w; j += 32)
+        {
+            __m512i lo = _mm512_setzero_si512();
+            __m512i hi = _mm512_setzero_si512();
+            for (int c = 0; c < in_c; c++)
+            {
+                const int8_t * const * t = taps + c * 9;
+                const int8_t * wc = weight + (o * in_c + c) * 9;
+                for (int p = 0; p < 9; p += 2)
+                {
+                    const __m512i a = _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(t[p] + j)));
+                    const __m512i b = p + 1 < 9 ? _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(t[p + 1] + j)))
+                                                : _mm512_setzero_si512();
+                    const __m512i wp = _mm512_set1_epi32(pack_pair(wc[p], p + 1 < 9 ? wc[p + 1] : 0));
+                    lo = _mm512_add_epi32(lo, _mm512_madd_epi16(_mm512_unpacklo_epi16(a, b), wp));
+                    hi = _mm512_add_epi32(hi, _mm512_madd_epi16(_mm512_unpackhi_epi16(a, b), wp));
+                }
+            }
+            const int n = std::min(32, out_w - j);
+            const __mmask16 first_mask = static_cast<__mmask16>(n >= 16 ? 0xffff : (1u << n) - 1);
+            const __mmask16 second_mask = static_cast<__mmask16>(n >= 32 ? 0xffff : (n > 16 ? (1u << (n - 16)) - 1 : 0));
+            _mm512_mask_storeu_epi32(y + j, first_mask, _mm512_permutex2var_epi64(lo, first_half, hi));
+            _mm512_mask_storeu_epi32(y + j + 16, second_mask, _mm512_permutex2var_epi64(lo, second_half, hi));
+        }
+    }
+}
+
+// ---- AVX512-VNNI ----
+
+QUANTNN_TARGET_AVX512VNNI inline int32_t dot_u8s8_avx512vnni(const uint8_t * a, const int8_t * b, int n)
+{
+    __m512i acc = _mm512_setzero_si512();
+    int j = 0;
+    for (; j + 64 <= n; j += 64)
+    {
+        acc = _mm512_dpbusd_epi32(acc, _mm512_loadu_si512(a + j), _mm512_loadu_si512(b + j));
+    }
+    int32_t value = _mm512_reduce_add_epi32(acc);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+QUANTNN_TARGET_AVX512VNNI inline int32_t dot_s8s8_avx512vnni(const int8_t * a, const int8_t * b, int n)
+{
+    const __m512i bias = _mm512_set1_epi8(static_cast<char>(0x80));
+    const __m512i ones = _mm512_set1_epi8(1);
+    __m512i acc = _mm512_setzero_si512();
+    __m512i b_sum = _mm512_setzero_si512();
+    int j = 0;
+    for (; j + 64 <= n; j += 64)
+    {
+        __m512i va = _mm512_xor_si512(_mm512_loadu_si512(a + j), bias);
+        __m512i vb = _mm512_loadu_si512(b + j);
+        acc = _mm512_dpbusd_epi32(acc, va, vb);
+        b_sum = _mm512_dpbusd_epi32(b_sum, ones, vb);
+    }
+    int32_t value = _mm512_reduce_add_epi32(acc) - 128 * _mm512_reduce_add_epi32(b_sum);
+    for (; j < n; j++)
+    {
+        value += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+    }
+    return value;
+}
+
+} // namespace simd
+} // namespace quantnn
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+
+#include "common/thread_pool.h"
+#include "kernels/dispatch.h"
+#include "kernels/tuning.h"
+
+namespace quantnn
+{
+
+// The output rows are independent, so every kernel splits them across the intra-op
+// pool (common/thread_pool.h); layers too small to be worth it, like fc2, run inline.
+// Each (row, image) pair is one dot product of the selected ISA tier (kernels/dispatch.h).
+// The tier, the split and the tiling of each shape come from the tuning cache
+// (kernels/tuning.h); only the tier changes a result, that of the fp32 dot product.
+
+// Batched versions: x is batch x in_dim and y is batch x out_dim. Each weight row is
+// streamed from memory once per batch instead of once per image, which is what makes
+// batching pay off for the weight-bound fc layers.
+inline void linear_f32_batch(const float * x, const float * weight, const float * bias,
+                             int batch, int in_dim, int out_dim, float * y)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearF32, in_dim, out_dim, batch));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, static_cast<double>(batch) * in_dim), [=, &k](int begin, int end) {
+        for_each_tile(begin, end, batch, t, [&](int i, int b) {
+            float value = k.dot_f32(&weight[i * in_dim], &x[b * in_dim], in_dim);
+            y[b * out_dim + i] = bias != nullptr ? value + bias[i] : value;
+        });
+    });
+}
+
+inline void linear_s8s8_batch(const int8_t * x, const int8_t * weight, int batch, int in_dim, int out_dim, int32_t * acc)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearS8S8, in_dim, out_dim, batch));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, static_cast<double>(batch) * in_dim), [=, &k](int begin, int end) {
+        for_each_tile(begin, end, batch, t, [&](int i, int b) {
+            acc[b * out_dim + i] = k.dot_s8s8(&x[b * in_dim], &weight[i * in_dim], in_dim);
+        });
+    });
+}
+
+inline void linear_u8s8_batch(const uint8_t * x, const int8_t * weight, int batch, int in_dim, int out_dim, int32_t * acc)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearU8S8, in_dim, out_dim, batch));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, static_cast<double>(batch) * in_dim), [=, &k](int begin, int end) {
+        for_each_tile(begin, end, batch, t, [&](int i, int b) {
+            acc[b * out_dim + i] = k.dot_u8s8(&x[b * in_dim], &weight[i * in_dim], in_dim);
+        });
+    });
+}
+
+// fp32 activations with fp16 or bf16 weights, widened inside the dot product and
+// accumulated in fp32; half the weight bytes of linear_f32_batch
+inline void linear_f16_batch(const float * x, const Half * weight, const float * bias,
+                             int batch, int in_dim, int out_dim, float * y)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearF16, in_dim, out_dim, batch));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, static_cast<double>(batch) * in_dim), [=, &k](int begin, int end) {
+        for_each_tile(begin, end, batch, t, [&](int i, int b) {
+            float value = k.dot_f16_f32(&weight[i * in_dim], &x[b * in_dim], in_dim);
+            y[b * out_dim + i] = bias != nullptr ? value + bias[i] : value;
+        });
+    });
+}
+
+inline void linear_bf16_batch(const float * x, const BFloat16 * weight, const float * bias,
+                              int batch, int in_dim, int out_dim, float * y)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearBF16, in_dim, out_dim, batch));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, static_cast<double>(batch) * in_dim), [=, &k](int begin, int end) {
+        for_each_tile(begin, end, batch, t, [&](int i, int b) {
+            float value = k.dot_bf16_f32(&weight[i * in_dim], &x[b * in_dim], in_dim);
+            y[b * out_dim + i] = bias != nullptr ? value + bias[i] : value;
+        });
+    });
+}
+
+// y[i] += W[i, 0:in_dim] x for a slice of the columns of a wider weight matrix whose
+// rows are ld apart. forward_fused of the engines adds up fc1 this way one conv1
+// channel at a time; the integer version gives the same accumulators as one full dot.
+inline void linear_f32_accumulate(const float * x, const float * weight, int ld, int in_dim, int out_dim, float * y)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearF32, in_dim, out_dim, 1));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, in_dim), [=, &k](int begin, int end) {
+        for (int i = begin; i < end; i++)
+        {
+            y[i] += k.dot_f32(&weight[static_cast<size_t>(i) * ld], x, in_dim);
+        }
+    });
+}
+
+inline void linear_f16_accumulate(const float * x, const Half * weight, int ld, int in_dim, int out_dim, float * y)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearF16, in_dim, out_dim, 1));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, in_dim), [=, &k](int begin, int end) {
+        for (int i = begin; i < end; i++)
+        {
+            y[i] += k.dot_f16_f32(&weight[static_cast<size_t>(i) * ld], x, in_dim);
+        }
+    });
+}
+
+inline void linear_bf16_accumulate(const float * x, const BFloat16 * weight, int ld, int in_dim, int out_dim, float * y)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearBF16, in_dim, out_dim, 1));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, in_dim), [=, &k](int begin, int end) {
+        for (int i = begin; i < end; i++)
+        {
+            y[i] += k.dot_bf16_f32(&weight[static_cast<size_t>(i) * ld], x, in_dim);
+        }
+    });
+}
+
+inline void linear_s8s8_accumulate(const int8_t * x, const int8_t * weight, int ld, int in_dim, int out_dim, int32_t * acc)
+{
+    const TuneConfig t = tuned_config(TuneKey::linear(TunedOp::LinearS8S8, in_dim, out_dim, 1));
+    const KernelTable & k = t.table();
+    parallel_for(0, out_dim, t.grain(out_dim, in_dim), [=, &k](int begin, int end) {
+        for (int i = begin; i < end; i++)
+        {
+            acc[i] += k.dot_s8s8(x, &weight[static_cast<size_t>(i) * ld], in_dim);
+        }
+    });
+}
+
+// y = W x + b with W stored row-major as out_dim x in_dim; bias may be nullptr
+inline void linear_f32(const float * x, const float * weight, const float * bias,
+                       int in_dim, int out_dim, float * y)
+{
+    linear_f32_batch(x, weight, bias, 1, in_dim, out_dim, y);
+}
+
+// int32 accumulators of W x for signed int8 activations
+inline void linear_s8s8(const int8_t * x, const int8_t * weight, int in_dim, int out_dim, int32_t * acc)
+{
+    linear_s8s8_batch(x, weight, 1, in_dim, out_dim, acc);
+}
+
+// int32 accumulators of W x for unsigned int8 activations (e.g. the output of ReLU)
+inline void linear_u8s8(const uint8_t * x, const int8_t * weight, int in_dim, int out_dim, int32_t * acc)
+{
+    linear_u8s8_batch(x, weight, 1, in_dim, out_dim, acc);
+}
+
+} // namespace quantnn
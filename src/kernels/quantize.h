@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+#include "kernels/dispatch.h"
+
+namespace quantnn
+{
+
+inline float absmax_f32(const float * x, int n)
+{
+    return kernels().absmax_f32(x, n);
+}
+
+inline void minmax_f32(const float * x, int n, float & min_val, float & max_val)
+{
+    kernels().minmax_f32(x, n, min_val, max_val);
+}
+
+// symmetric int8: q = clamp(round(x / scale), -127, 127)
+inline void quantize_s8(const float * x, int n, float scale, int8_t * q)
+{
+    kernels().quantize_s8(x, n, scale, q);
+}
+
+// asymmetric uint8: q = clamp(round(x / scale) + zp, 0, 255)
+inline void quantize_u8(const float * x, int n, float scale, int zp, uint8_t * q)
+{
+    kernels().quantize_u8(x, n, scale, zp, q);
+}
+
+// int32 accumulators of a rows x cols output (one row per output channel / neuron)
+// back to real values: y = multiplier[r] * acc + bias[r]
+inline void dequantize_s32(const int32_t * acc, int rows, int cols, const float * multiplier,
+                           const float * bias, float * y)
+{
+    const KernelTable & k = kernels();
+    for (int r = 0; r < rows; r++)
+    {
+        k.dequantize_row(&acc[r * cols], cols, multiplier[r], bias[r], &y[r * cols]);
+    }
+}
+
+// same as dequantize_s32 followed by quantize_s8 with a fixed output scale
+inline void requantize_s8(const int32_t * acc, int rows, int cols, const float * multiplier,
+                          const float * bias, float out_scale, int8_t * q)
+{
+    const KernelTable & k = kernels();
+    for (int r = 0; r < rows; r++)
+    {
+        k.requantize_row(&acc[r * cols], cols, multiplier[r], bias[r], out_scale, &q[r * cols]);
+    }
+}
+
+} // namespace quantnn
@@ -0,0 +1,109 @@
+#pragma once
+
+// Squeeze-and-excitation (SEBlock in pytorch/mobileone.py) fused into the layers around
+// it, so that the feature map is not read again just to pool it and once more to scale it:
+//   squeeze: the producing conv sums each output row while it is still in L1 (the
+//            row_sums argument of conv3x3_f32 / conv3x3_s8s8), and channel_means_*
+//            reduces the h sums of each channel in a fixed order
+//   excite:  se_gate runs reduce 1x1 conv, ReLU, expand 1x1 conv and sigmoid on the
+//            c means in stack buffers
+//   scale:   the consumer applies the gate as it reads the map: relu_gate_f32 in place
+//            of the ReLU that follows (relu(g * x) == g * relu(x) for g > 0), or the gate
+//            folded into the per-channel multiplier and bias of dequantize_s32 /
+//            requantize_s8 with se_gate_affine
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace quantnn
+{
+
+constexpr int kMaxSeReduced = 256;
+
+// per-channel means of a c x h x w map from its c x h row sums
+inline void channel_means_f32(const float * row_sums, int c, int h, int w, float * mean)
+{
+    for (int ch = 0; ch < c; ch++)
+    {
+        float sum = 0.0f;
+        for (int r = 0; r < h; r++)
+        {
+            sum += row_sums[ch * h + r];
+        }
+        mean[ch] = sum / static_cast<float>(h * w);
+    }
+}
+
+// per-channel means of the dequantized map multiplier[ch] * acc + bias[ch] from the
+// row sums of the int32 accumulators (exact in int64)
+inline void channel_means_s32(const int64_t * row_sums, int c, int h, int w,
+                              const float * multiplier, const float * bias, float * mean)
+{
+    for (int ch = 0; ch < c; ch++)
+    {
+        int64_t sum = 0;
+        for (int r = 0; r < h; r++)
+        {
+            sum += row_sums[ch * h + r];
+        }
+        mean[ch] = static_cast<float>(static_cast<double>(sum) / (h * w)) * multiplier[ch] + bias[ch];
+    }
+}
+
+// gate = sigmoid(expand(relu(reduce(mean)))), reduce: reduced x c, expand: c x reduced
+inline void se_gate(const float * mean, int c, const float * reduce_weight, const float * reduce_bias, int reduced,
+                    const float * expand_weight, const float * expand_bias, float * gate)
+{
+    if (reduced > kMaxSeReduced)
+    {
+        throw std::runtime_error("squeeze-excitation reduced width exceeds kMaxSeReduced");
+    }
+    float hidden[kMaxSeReduced];
+    for (int r = 0; r < reduced; r++)
+    {
+        float acc = reduce_bias[r];
+        for (int ch = 0; ch < c; ch++)
+        {
+            acc += reduce_weight[r * c + ch] * mean[ch];
+        }
+        hidden[r] = acc > 0.0f ? acc : 0.0f;
+    }
+    for (int ch = 0; ch < c; ch++)
+    {
+        float acc = expand_bias[ch];
+        for (int r = 0; r < reduced; r++)
+        {
+            acc += expand_weight[ch * reduced + r] * hidden[r];
+        }
+        gate[ch] = 1.0f / (1.0f + std::exp(-acc));
+    }
+}
+
+// x = gate[ch] * max(x, 0) over a c x hw map, in place
+inline void relu_gate_f32(float * x, int c, int hw, const float * gate)
+{
+    for (int ch = 0; ch < c; ch++)
+    {
+        const float g = gate[ch];
+        float * row = &x[ch * hw];
+        for (int i = 0; i < hw; i++)
+        {
+            row[i] = std::max(row[i], 0.0f) * g;
+        }
+    }
+}
+
+// the multiplier and bias of a dequantize/requantize whose output is scaled by gate
+inline void se_gate_affine(const float * multiplier, const float * bias, const float * gate, int c,
+                           float * gated_multiplier, float * gated_bias)
+{
+    for (int ch = 0; ch < c; ch++)
+    {
+        gated_multiplier[ch] = multiplier[ch] * gate[ch];
+        gated_bias[ch] = bias[ch] * gate[ch];
+    }
+}
+
+} // namespace quantnn
@@ -0,0 +1,449 @@
+#pragma once
+
+// Per-shape kernel tuning.
+//
+// How a conv or linear call is executed can be changed without changing its result
+// (except for the fp32 linear layers, whose dot products sum in a different order per tier):
+//   isa         : the ISA tier (kernels/dispatch.h), never above the active one
+//   threads     : how many equal chunks the output rows are split into (0 = by grain_for)
+//   row_block   : output rows computed together, so their weights stay in L1
+//   batch_block : images of a batch run against one row block before moving on
+// The best choice depends on the machine (an AVX-512 part may clock down enough that
+// avx2 wins for a small layer, or one thread may beat two on fc2), so src/tools/autotune.cpp
+// benchmarks the candidates for every layer shape of the models and stores the winners
+// in a tuning cache. The cache file holds sections of entries per CPU model:
+//   cpu=Intel(R) Xeon(R) Gold 6148 CPU @ 2.40GHz
+//   linear_s8s8 in=3920 out=128 batch=1 pool=1 isa=avx512vnni threads=1 row_block=4 batch_block=1 us=3.21
+// It is read on first use from QUANTNN_TUNING_CACHE (default quantnn_tuning.txt, an
+// empty value disables it), and only the section of the running CPU is applied.
+// A shape without an entry, or with tuning turned off, runs with the defaults.
+//
+// Lookups do not allocate. The cache is only modified by the tuner; engines only read it.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "common/cpu_features.h"
+#include "common/thread_pool.h"
+#include "kernels/dispatch.h"
+
+namespace quantnn
+{
+
+enum class TunedOp
+{
+    LinearF32,
+    LinearS8S8,
+    LinearU8S8,
+    LinearF16,
+    LinearBF16,
+    Conv3x3F32,
+    Conv3x3S8S8,
+};
+
+constexpr int kTunedOpCount = 7;
+
+inline const char * tuned_op_name(TunedOp op)
+{
+    switch (op)
+    {
+        case TunedOp::LinearF32: return "linear_f32";
+        case TunedOp::LinearS8S8: return "linear_s8s8";
+        case TunedOp::LinearU8S8: return "linear_u8s8";
+        case TunedOp::LinearF16: return "linear_f16";
+        case TunedOp::LinearBF16: return "linear_bf16";
+        case TunedOp::Conv3x3F32: return "conv3x3_f32";
+        case TunedOp::Conv3x3S8S8: return "conv3x3_s8s8";
+    }
+    return "unknown";
+}
+
+inline bool is_conv(TunedOp op)
+{
+    return op == TunedOp::Conv3x3F32 || op == TunedOp::Conv3x3S8S8;
+}
+
+// One concrete call shape. Linear: dims = { in, out }, conv: dims = { in_c, out_c, out_h, out_w }.
+// pool is the size of the intra-op pool the entry was tuned with.
+struct TuneKey
+{
+    TunedOp op = TunedOp::LinearF32;
+    int dims[4] = { 0, 0, 0, 0 };
+    int batch = 1;
+    int pool = 1;
+
+    static TuneKey linear(TunedOp op, int in, int out, int batch)
+    {
+        TuneKey key;
+        key.op = op;
+        key.dims[0] = in;
+        key.dims[1] = out;
+        key.batch = batch;
+        key.pool = intra_op_pool().size();
+        return key;
+    }
+
+    static TuneKey conv(TunedOp op, int in_c, int out_c, int out_h, int out_w)
+    {
+        TuneKey key;
+        key.op = op;
+        key.dims[0] = in_c;
+        key.dims[1] = out_c;
+        key.dims[2] = out_h;
+        key.dims[3] = out_w;
+        key.pool = intra_op_pool().size();
+        return key;
+    }
+
+    bool same_layer(const TuneKey & other) const
+    {
+        return op == other.op && pool == other.pool && std::equal(dims, dims + 4, other.dims);
+    }
+
+    bool operator==(const TuneKey & other) const { return same_layer(other) && batch == other.batch; }
+
+    // "linear_s8s8 in=3920 out=128 batch=1 pool=1"
+    std::string to_string() const
+    {
+        std::ostringstream s;
+        s << tuned_op_name(op);
+        if (is_conv(op))
+        {
+            s << " in_c=" << dims[0] << " out_c=" << dims[1] << " out_h=" << dims[2] << " out_w=" << dims[3];
+        }
+        else
+        {
+            s << " in=" << dims[0] << " out=" << dims[1] << " batch=" << batch;
+        }
+        s << " pool=" << pool;
+        return s.str();
+    }
+};
+
+struct TuneConfig
+{
+    Isa isa = Isa::AVX512VNNI; // capped to the active tier
+    int threads = 0;
+    int row_block = 1;
+    int batch_block = 0; // 0 = the whole batch
+
+    const KernelTable & table() const
+    {
+        const Isa active = active_isa();
+        return kernel_table(static_cast<int>(isa) < static_cast<int>(active) ? isa : active);
+    }
+
+    // the parallel_for grain for `rows` output rows of `ops_per_row` work each
+    int grain(int rows, double ops_per_row) const
+    {
+        if (threads <= 0)
+        {
+            return grain_for(ops_per_row);
+        }
+        return std::max(1, (rows + threads - 1) / threads);
+    }
+
+    int batch_step(int batch) const
+    {
+        return batch_block > 0 ? batch_block : std::max(batch, 1);
+    }
+
+    std::string to_string() const
+    {
+        std::ostringstream s;
+        s << "isa=" << isa_name(isa) << " threads=" << threads << " row_block=" << row_block
+          << " batch_block=" << batch_block;
+        return s.str();
+    }
+};
+
+// Calls fn(row, image) for rows [begin, end) and images [0, batch) in tiles of
+// row_block x batch_block; the defaults give the plain row-major order.
+template <typename Fn>
+inline void for_each_tile(int begin, int end, int batch, const TuneConfig & config, Fn && fn)
+{
+    const int row_step = std::max(config.row_block, 1);
+    const int batch_step = config.batch_step(batch);
+    for (int r0 = begin; r0 < end; r0 += row_step)
+    {
+        const int r1 = std::min(end, r0 + row_step);
+        for (int b0 = 0; b0 < batch; b0 += batch_step)
+        {
+            const int b1 = std::min(batch, b0 + batch_step);
+            for (int i = r0; i < r1; i++)
+            {
+                for (int b = b0; b < b1; b++)
+                {
+                    fn(i, b);
+                }
+            }
+        }
+    }
+}
+
+class TuningCache
+{
+public:
+    struct Entry
+    {
+        std::string cpu;
+        TuneKey key;
+        TuneConfig config;
+        double us = 0.0;
+    };
+
+    // the entry for `key` on this CPU; for a batch without one, the entry of the largest
+    // tuned batch below it. nullptr when the shape was not tuned.
+    const TuneConfig * find(const TuneKey & key) const
+    {
+        const Entry * best = nullptr;
+        for (const Entry & e : local)
+        {
+            if (e.key.same_layer(key) && e.key.batch <= key.batch && (best == nullptr || e.key.batch > best->key.batch))
+            {
+                best = &e;
+            }
+        }
+        return best != nullptr ? &best->config : nullptr;
+    }
+
+    const Entry * exact(const TuneKey & key) const
+    {
+        for (const Entry & e : local)
+        {
+            if (e.key == key)
+            {
+                return &e;
+            }
+        }
+        return nullptr;
+    }
+
+    void set(const TuneKey & key, const TuneConfig & config, double us)
+    {
+        for (Entry & e : local)
+        {
+            if (e.key == key)
+            {
+                e.config = config;
+                e.us = us;
+                return;
+            }
+        }
+        local.push_back(Entry { cpu_features().brand, key, config, us });
+    }
+
+    size_t size() const { return local.size(); }
+    const std::vector<Entry> & entries() const { return local; }
+
+    // Reads a cache file; a missing file is an empty cache. Entries of other CPUs are
+    // kept so that save() writes them back, entries naming a tier this CPU lacks are dropped.
+    void load(const std::string & path)
+    {
+        local.clear();
+        others.clear();
+        std::ifstream in(path);
+        if (!in)
+        {
+            return;
+        }
+        std::string cpu;
+        std::string line;
+        int line_no = 0;
+        while (std::getline(in, line))
+        {
+            line_no++;
+            line = line.substr(0, line.find('#'));
+            if (line.compare(0, 4, "cpu=") == 0)
+            {
+                cpu = line.substr(4);
+                continue;
+            }
+            std::istringstream fields(line);
+            std::string op_name;
+            if (!(fields >> op_name))
+            {
+                continue;
+            }
+            Entry e;
+            e.cpu = cpu;
+            if (!parse_entry(op_name, fields, e))
+            {
+                throw std::runtime_error("tuning cache " + path + ":" + std::to_string(line_no) + ": cannot parse entry");
+            }
+            if (cpu != cpu_features().brand)
+            {
+                others.push_back(e);
+            }
+            else if (isa_supported(e.config.isa))
+            {
+                local.push_back(e);
+            }
+        }
+    }
+
+    void save(const std::string & path) const
+    {
+        std::ofstream out(path);
+        if (!out)
+        {
+            throw std::runtime_error("cannot write " + path);
+        }
+        out << "# quantnn tuning cache, written by autotune (see kernels/tuning.h)\n";
+        std::vector<std::string> cpus;
+        for (const std::vector<Entry> * list : { &others, &local })
+        {
+            for (const Entry & e : *list)
+            {
+                if (std::find(cpus.begin(), cpus.end(), e.cpu) == cpus.end())
+                {
+                    cpus.push_back(e.cpu);
+                }
+            }
+        }
+        for (const std::string & cpu : cpus)
+        {
+            out << "cpu=" << cpu << "\n";
+            for (const std::vector<Entry> * list : { &others, &local })
+            {
+                for (const Entry & e : *list)
+                {
+                    if (e.cpu == cpu)
+                    {
+                        char us[32];
+                        snprintf(us, sizeof(us), "%.3f", e.us);
+                        out << e.key.to_string() << " " << e.config.to_string() << " us=" << us << "\n";
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    static bool parse_entry(const std::string & op_name, std::istringstream & fields, Entry & e)
+    {
+        bool known = false;
+        for (int i = 0; i < kTunedOpCount; i++)
+        {
+            if (op_name == tuned_op_name(static_cast<TunedOp>(i)))
+            {
+                e.key.op = static_cast<TunedOp>(i);
+                known = true;
+            }
+        }
+        if (!known)
+        {
+            return false;
+        }
+        std::string field;
+        while (fields >> field)
+        {
+            const size_t eq = field.find('=');
+            if (eq == std::string::npos)
+            {
+                return false;
+            }
+            const std::string name = field.substr(0, eq);
+            const std::string value = field.substr(eq + 1);
+            if (name == "isa")
+            {
+                if (!parse_isa(value, e.config.isa))
+                {
+                    return false;
+                }
+                continue;
+            }
+            if (name == "us")
+            {
+                e.us = atof(value.c_str());
+                continue;
+            }
+            const int v = atoi(value.c_str());
+            if (name == "in" || name == "in_c") e.key.dims[0] = v;
+            else if (name == "out" || name == "out_c") e.key.dims[1] = v;
+            else if (name == "out_h") e.key.dims[2] = v;
+            else if (name == "out_w") e.key.dims[3] = v;
+            else if (name == "batch") e.key.batch = v;
+            else if (name == "pool") e.key.pool = v;
+            else if (name == "threads") e.config.threads = v;
+            else if (name == "row_block") e.config.row_block = v;
+            else if (name == "batch_block") e.config.batch_block = v;
+            else return false;
+        }
+        return true;
+    }
+
+    std::vector<Entry> local;  // this CPU
+    std::vector<Entry> others; // other CPU models, kept for save()
+};
+
+namespace tuning_detail
+{
+
+inline std::atomic<bool> & enabled()
+{
+    static std::atomic<bool> flag { true };
+    return flag;
+}
+
+} // namespace tuning_detail
+
+// QUANTNN_TUNING_CACHE, or quantnn_tuning.txt in the working directory; "" if disabled
+inline std::string tuning_cache_path()
+{
+    const char * env = getenv("QUANTNN_TUNING_CACHE");
+    return env != nullptr ? env : "quantnn_tuning.txt";
+}
+
+// the process-wide cache, loaded from tuning_cache_path() on first use
+inline TuningCache & tuning_cache()
+{
+    static TuningCache cache = [] {
+        TuningCache c;
+        const std::string path = tuning_cache_path();
+        if (!path.empty())
+        {
+            try
+            {
+                c.load(path);
+            }
+            catch (const std::exception & e)
+            {
+                std::cerr << e.what() << ", running untuned" << std::endl;
+                c = TuningCache();
+            }
+        }
+        return c;
+    }();
+    return cache;
+}
+
+// Turns applying the cache on or off, e.g. so that kernel_bench times the plain tiers.
+inline void set_tuning_enabled(bool on)
+{
+    tuning_detail::enabled().store(on, std::memory_order_relaxed);
+}
+
+// the configuration a kernel call of this shape runs with
+inline TuneConfig tuned_config(const TuneKey & key)
+{
+    if (tuning_detail::enabled().load(std::memory_order_relaxed))
+    {
+        const TuneConfig * config = tuning_cache().find(key);
+        if (config != nullptr)
+        {
+            return *config;
+        }
+    }
+    return TuneConfig();
+}
+
+} // namespace quantnn
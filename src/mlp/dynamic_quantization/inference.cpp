@@ -1,50 +1,47 @@
+#include <array>
 #include <cmath>
 #include <algorithm>
 #include <iostream>
 #include <vector>
 #include <cstdint>
 
+#include "common/alloc_tracker.h"
+#include "common/tensor.h"
+#include "common/trace.h"
+
 #include "quantized_fc1.h"
 #include "quantized_fc2.h"
 #include "data_7.h"
 
-struct QuantizedBuffer
-{
-    std::vector<int8_t> q;
-    float s;
-};
-
-struct UnsignedQuantizedBuffer
-{
-    std::vector<uint8_t> q;
-    float s;
-};
+using quantnn::QuantParams;
+using quantnn::Tensor;
+using quantnn::TensorRef;
 
 class MnistFC
 {
 public:
-    MnistFC(const QuantizedBuffer & qfc1, const std::vector<float> & fc1_bias,
-            const QuantizedBuffer & qfc2, const std::vector<float> & fc2_bias);
+    MnistFC(const TensorRef<const int8_t> & qfc1, const TensorRef<const float> & fc1_bias,
+            const TensorRef<const int8_t> & qfc2, const TensorRef<const float> & fc2_bias);
 
-    QuantizedBuffer quantize(const std::vector<float> & data);
+    Tensor<int8_t> quantize(const TensorRef<const float> & data);
 
-    int forward_fp32(const std::vector<float> & data);
-    int forward_int8(const std::vector<float> & data);
+    int forward_fp32(const TensorRef<const float> & data);
+    int forward_int8(const TensorRef<const float> & data);
 
-    void fc1(std::vector<float> & hidden, const std::vector<float> & data);
-    void fc1(QuantizedBuffer & hidden, const QuantizedBuffer & data);
+    void fc1(std::vector<float> & hidden, const TensorRef<const float> & data);
+    void fc1(Tensor<int8_t> & hidden, const Tensor<int8_t> & data);
 
     void relu(std::vector<float> & hidden);
-    void relu(UnsignedQuantizedBuffer & relu_hidden, const QuantizedBuffer & hidden);
+    void relu(Tensor<uint8_t> & relu_hidden, const Tensor<int8_t> & hidden);
 
     void fc2(std::vector<float> & output, const std::vector<float> & hidden);
-    void fc2(QuantizedBuffer & output, const UnsignedQuantizedBuffer & relu_hidden);
+    void fc2(Tensor<int8_t> & output, const Tensor<uint8_t> & relu_hidden);
 
 public:
-    const QuantizedBuffer & qfc1;
-    const QuantizedBuffer & qfc2;
-    const std::vector<float> & fc1_bias;
-    const std::vector<float> & fc2_bias;
+    const TensorRef<const int8_t> qfc1;
+    const TensorRef<const int8_t> qfc2;
+    const TensorRef<const float> fc1_bias;
+    const TensorRef<const float> fc2_bias;
 
     int input_dim = 784;
     int hidden_dim = 128;
@@ -52,13 +49,15 @@ public:
 
 };
 
-MnistFC::MnistFC(const QuantizedBuffer & qfc1, const std::vector<float> & fc1_bias,
-                 const QuantizedBuffer & qfc2, const std::vector<float> & fc2_bias) 
+MnistFC::MnistFC(const TensorRef<const int8_t> & qfc1, const TensorRef<const float> & fc1_bias,
+                 const TensorRef<const int8_t> & qfc2, const TensorRef<const float> & fc2_bias) 
     : qfc1{qfc1}, fc1_bias{fc1_bias}, qfc2{qfc2}, fc2_bias{fc2_bias} {}
 
 
-int MnistFC::forward_fp32(const std::vector<float> & data)
+int MnistFC::forward_fp32(const TensorRef<const float> & data)
 {
+    QUANTNN_TRACE_SCOPE("forward_fp32");
+    QUANTNN_ALLOC_SCOPE("forward_fp32");
     // convert int8 weight to float32 and calculate for checking
     std::vector<float> hidden(hidden_dim);
     fc1(hidden, data);
@@ -81,72 +80,81 @@ int MnistFC::forward_fp32(const std::vector<float> & data)
     return max_index;
 }
 
-int MnistFC::forward_int8(const std::vector<float> & data)
+int MnistFC::forward_int8(const TensorRef<const float> & data)
 {
-    QuantizedBuffer qdata = quantize(data);
-    QuantizedBuffer hidden;
+    QUANTNN_TRACE_SCOPE("forward_int8");
+    QUANTNN_ALLOC_SCOPE("forward_int8");
+    Tensor<int8_t> qdata = quantize(data);
+    Tensor<int8_t> hidden;
     fc1(hidden, qdata);
 
-    UnsignedQuantizedBuffer relu_hidden;
+    Tensor<uint8_t> relu_hidden;
     relu(relu_hidden, hidden);
 
-    QuantizedBuffer output;
+    Tensor<int8_t> output;
     fc2(output, relu_hidden);
 
     int max_index = 0;
-    int8_t max_value = output.q[0];
+    int8_t max_value = output[0];
     for (int i = 0; i < output_dim; i++)
     {
-        if (output.q[i] > max_value)
+        if (output[i] > max_value)
         {
             max_index = i;
-            max_value = output.q[i];
+            max_value = output[i];
         }
     }
     return max_index;
 }
 
-void MnistFC::relu(UnsignedQuantizedBuffer & relu_hidden, const QuantizedBuffer & hidden)
+void MnistFC::relu(Tensor<uint8_t> & relu_hidden, const Tensor<int8_t> & hidden)
 {
-    std::vector<float> hidden_fp32 (hidden.q.size());
+    QUANTNN_TRACE_SCOPE("relu");
+    QUANTNN_ALLOC_SCOPE("relu");
+    std::vector<float> hidden_fp32 (hidden.numel());
     for (int i = 0; i < hidden_fp32.size(); i++)
     {
-        hidden_fp32[i] = std::max(0.0f, static_cast<float>(hidden.q[i]) * hidden.s);
+        hidden_fp32[i] = std::max(0.0f, static_cast<float>(hidden[i]) * hidden.quant().scale);
     }
 
     float min_val = 0; // because of ReLU
     float max_val = *std::max_element(hidden_fp32.begin(), hidden_fp32.end());
 
-    relu_hidden.s = max_val / 255.0f;
-    relu_hidden.q.resize(hidden_fp32.size());
-    for (int i = 0; i < relu_hidden.q.size(); i++)
+    const float s = max_val / 255.0f;
+    relu_hidden.quant() = QuantParams::per_tensor(s);
+    relu_hidden.resize({ static_cast<int>(hidden_fp32.size()) });
+    for (int i = 0; i < relu_hidden.numel(); i++)
     {
-        relu_hidden.q[i] = static_cast<uint8_t>(std::clamp(std::round(hidden_fp32[i] / relu_hidden.s), 0.0f, 255.0f));
+        relu_hidden[i] = static_cast<uint8_t>(std::clamp(std::round(hidden_fp32[i] / s), 0.0f, 255.0f));
     }
 }
 
 void MnistFC::relu(std::vector<float> & hidden)
 {
+    QUANTNN_TRACE_SCOPE("relu");
+    QUANTNN_ALLOC_SCOPE("relu");
     for (int i = 0; i < hidden_dim; i++)
     {
         hidden[i] = std::max(0.0f, hidden[i]);
     }
 }
 
-void MnistFC::fc1(QuantizedBuffer & hidden, const QuantizedBuffer & data)
+void MnistFC::fc1(Tensor<int8_t> & hidden, const Tensor<int8_t> & data)
 {
+    QUANTNN_TRACE_SCOPE("fc1");
+    QUANTNN_ALLOC_SCOPE("fc1");
     /* calculate scale based on W, x */
-    float scale = data.s * qfc1.s;
+    float scale = data.quant().scale * qfc1.quant().scale;
 
     /* convert bias -> int8 */
-    std::vector<int32_t> bias_int32 (fc1_bias.size());
-    for (int i = 0; i < fc1_bias.size(); i++)
+    std::vector<int32_t> bias_int32 (fc1_bias.numel());
+    for (int i = 0; i < fc1_bias.numel(); i++)
     {
         bias_int32[i] = static_cast<int32_t>(std::round(fc1_bias[i] / scale));
     }
 
     /* calculate int8 */
-    hidden.q.resize(hidden_dim);
+    hidden.resize({ hidden_dim });
     std::vector<int32_t> hidden_test (hidden_dim);
 
     for (int i = 0; i < hidden_dim; i++)
@@ -154,7 +162,7 @@ void MnistFC::fc1(QuantizedBuffer & hidden, const QuantizedBuffer & data)
         int32_t value = 0;
         for (int j = 0; j < input_dim; j++)
         {
-            value += static_cast<int32_t>(qfc1.q[i * input_dim + j]) * static_cast<int32_t>(data.q[j]);
+            value += static_cast<int32_t>(qfc1[i * input_dim + j]) * static_cast<int32_t>(data[j]);
         }
         value = value + bias_int32[i];
         hidden_test[i] = value;
@@ -163,22 +171,25 @@ void MnistFC::fc1(QuantizedBuffer & hidden, const QuantizedBuffer & data)
     /* requantize the output vector */
     int32_t max_val = *std::max_element(hidden_test.begin(), hidden_test.end());
     int32_t min_val = *std::min_element(hidden_test.begin(), hidden_test.end());
-    hidden.s = std::max(std::abs(max_val), std::abs(min_val)) / 127.0f;
+    const float s = std::max(std::abs(max_val), std::abs(min_val)) / 127.0f;
+    hidden.quant() = QuantParams::per_tensor(s);
 
     for (int i = 0; i < hidden_test.size(); i++)
     {
-        hidden.q[i] = static_cast<int8_t>(std::clamp(static_cast<float>(hidden_test[i]) / hidden.s, -127.0f, 127.0f));
+        hidden[i] = static_cast<int8_t>(std::clamp(static_cast<float>(hidden_test[i]) / s, -127.0f, 127.0f));
     }
 
 }
 
-void MnistFC::fc1(std::vector<float> & hidden, const std::vector<float> & data)
+void MnistFC::fc1(std::vector<float> & hidden, const TensorRef<const float> & data)
 {
-    std::vector<float> fc1_weight(qfc1.q.size());
+    QUANTNN_TRACE_SCOPE("fc1");
+    QUANTNN_ALLOC_SCOPE("fc1");
+    std::vector<float> fc1_weight(qfc1.numel());
     // convert int8 weight into float32
     for (int i = 0; i < fc1_weight.size(); i++)
     {
-        fc1_weight[i] = static_cast<float>(qfc1.q[i]) * qfc1.s;
+        fc1_weight[i] = static_cast<float>(qfc1[i]) * qfc1.quant().scale;
     }
 
     for (int i = 0; i < hidden_dim; i++)
@@ -192,37 +203,38 @@ void MnistFC::fc1(std::vector<float> & hidden, const std::vector<float> & data)
     }
 }
 
-void MnistFC::fc2(QuantizedBuffer & output, const UnsignedQuantizedBuffer & relu_hidden)
+void MnistFC::fc2(Tensor<int8_t> & output, const Tensor<uint8_t> & relu_hidden)
 {
+    QUANTNN_TRACE_SCOPE("fc2");
+    QUANTNN_ALLOC_SCOPE("fc2");
     /* convert uint8_t (ReLU output) to int8_t */
-    QuantizedBuffer relu_hidden_int8;
-    relu_hidden_int8.q.resize(relu_hidden.q.size());
+    Tensor<int8_t> relu_hidden_int8 ({ static_cast<int>(relu_hidden.numel()) });
 
     float max_relu_val = 1e-5;
     float min_relu_val = 1e+5;
-    for (int i = 0; i < relu_hidden_int8.q.size(); i++)
+    for (int i = 0; i < relu_hidden_int8.numel(); i++)
     {
-        float real_val = static_cast<float>(relu_hidden.q[i]) * relu_hidden.s;
+        float real_val = static_cast<float>(relu_hidden[i]) * relu_hidden.quant().scale;
         min_relu_val = std::min(real_val, min_relu_val);
         max_relu_val = std::max(real_val, max_relu_val);
-        float q_val = real_val / relu_hidden.s;
+        float q_val = real_val / relu_hidden.quant().scale;
         q_val = std::round(std::clamp(q_val, -127.0f, 127.0f));
-        relu_hidden_int8.q[i] = static_cast<int8_t>(q_val);
+        relu_hidden_int8[i] = static_cast<int8_t>(q_val);
     }
-    relu_hidden_int8.s = std::max(std::abs(min_relu_val), std::abs(max_relu_val)) / 127.0f;
+    relu_hidden_int8.quant().scale = std::max(std::abs(min_relu_val), std::abs(max_relu_val)) / 127.0f;
 
     /* calculate scale based on W, x */
-    float scale = relu_hidden_int8.s * qfc2.s;
+    float scale = relu_hidden_int8.quant().scale * qfc2.quant().scale;
 
     /* convert bias -> int8 */
-    std::vector<int32_t> bias_int32 (fc2_bias.size());
-    for (int i = 0; i < fc2_bias.size(); i++)
+    std::vector<int32_t> bias_int32 (fc2_bias.numel());
+    for (int i = 0; i < fc2_bias.numel(); i++)
     {
         bias_int32[i] = static_cast<int32_t>(std::round(fc2_bias[i] / scale));
     }
 
     /* calculate int8 */
-    output.q.resize(output_dim);
+    output.resize({ output_dim });
     std::vector<int32_t> output_i32 (output_dim);
 
     for (int i = 0; i < output_dim; i++)
@@ -230,7 +242,7 @@ void MnistFC::fc2(QuantizedBuffer & output, const UnsignedQuantizedBuffer & relu
         int32_t value = 0;
         for (int j = 0; j < hidden_dim; j++)
         {
-            value += static_cast<int32_t>(qfc2.q[i * hidden_dim + j]) * static_cast<int32_t>(relu_hidden_int8.q[j]);
+            value += static_cast<int32_t>(qfc2[i * hidden_dim + j]) * static_cast<int32_t>(relu_hidden_int8[j]);
         }
         value = value + bias_int32[i];
         output_i32[i] = value;
@@ -239,20 +251,23 @@ void MnistFC::fc2(QuantizedBuffer & output, const UnsignedQuantizedBuffer & relu
     /* requantize the output vector */
     int32_t max_val = *std::max_element(output_i32.begin(), output_i32.end());
     int32_t min_val = *std::min_element(output_i32.begin(), output_i32.end());
-    output.s = std::max(std::abs(max_val), std::abs(min_val)) / 127.0f;
+    const float s = std::max(std::abs(max_val), std::abs(min_val)) / 127.0f;
+    output.quant() = QuantParams::per_tensor(s);
 
     for (int i = 0; i < output_i32.size(); i++)
     {
-        output.q[i] = static_cast<int8_t>(std::clamp(static_cast<float>(output_i32[i]) / output.s, -127.0f, 127.0f));
+        output[i] = static_cast<int8_t>(std::clamp(static_cast<float>(output_i32[i]) / s, -127.0f, 127.0f));
     }
 }
 
 void MnistFC::fc2(std::vector<float> & output, const std::vector<float> & hidden)
 {
-    std::vector<float> fc2_weight(qfc2.q.size());
+    QUANTNN_TRACE_SCOPE("fc2");
+    QUANTNN_ALLOC_SCOPE("fc2");
+    std::vector<float> fc2_weight(qfc2.numel());
     for (int i = 0; i < fc2_weight.size(); i++)
     {
-        fc2_weight[i] = static_cast<float>(qfc2.q[i]) * qfc2.s;
+        fc2_weight[i] = static_cast<float>(qfc2[i]) * qfc2.quant().scale;
     }
 
     for (int i = 0; i < output_dim; i++)
@@ -266,29 +281,42 @@ void MnistFC::fc2(std::vector<float> & output, const std::vector<float> & hidden
     }
 }
 
-QuantizedBuffer MnistFC::quantize(const std::vector<float> & data)
+Tensor<int8_t> MnistFC::quantize(const TensorRef<const float> & data)
 {
+    QUANTNN_TRACE_SCOPE("quantize");
+    QUANTNN_ALLOC_SCOPE("quantize");
     float min_val = *std::min_element(data.begin(), data.end());
     float max_val = *std::max_element(data.begin(), data.end());
     float s = std::max(std::abs(max_val), std::abs(min_val)) / 127.0f;
     
-    std::vector<int8_t> quantized (data.size());
-    for (int i = 0; i < data.size(); i++)
+    Tensor<int8_t> quantized ({ static_cast<int>(data.numel()) }, QuantParams::per_tensor(s));
+    for (int i = 0; i < data.numel(); i++)
     {
         float clamped_qw = std::clamp(std::round(data[i] / s), -127.0f, 127.0f);
         quantized[i] = static_cast<int8_t>(clamped_qw);
     }
 
-    return QuantizedBuffer { quantized, s };
+    return quantized;
 }
 
 
 int main(int argc, char * argv [])
 {
-    QuantizedBuffer qfc1 { fc1_weight, fc1_scale };
-    QuantizedBuffer qfc2 { fc2_weight, fc2_scale };
-    MnistFC model(qfc1, fc1_bias, qfc2, fc2_bias);
-    int out = model.forward_int8(data);
+    TensorRef<const int8_t> qfc1 = quantnn::view_of(fc1_weight, { 128, 784 }, QuantParams::per_tensor(fc1_scale));
+    TensorRef<const int8_t> qfc2 = quantnn::view_of(fc2_weight, { 10, 128 }, QuantParams::per_tensor(fc2_scale));
+    MnistFC model(qfc1, quantnn::view_of(fc1_bias, { 128 }), qfc2, quantnn::view_of(fc2_bias, { 10 }));
+    const TensorRef<const float> image = quantnn::view_of(data, { 784 });
+#ifdef QUANTNN_TRACK_ALLOC
+    if (argc > 1 && std::string(argv[1]) == "--check-zero-alloc")
+    {
+        bool ok = quantnn::check_zero_alloc([&] { model.forward_int8(image); });
+        QUANTNN_ALLOC_REPORT();
+        return ok ? 0 : 1;
+    }
+#endif
+    int out = model.forward_int8(image);
     std::cout << "Prediction: " << out << std::endl;
+    QUANTNN_TRACE_REPORT("mlp_dynamic_quantization.trace.json");
+    QUANTNN_ALLOC_REPORT();
     return 0;
 }
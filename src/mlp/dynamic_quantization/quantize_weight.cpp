@@ -1,5 +1,6 @@
 #include <iostream>
 #include <algorithm>
+#include <array>
 #include <vector>
 #include <string>
 #include <cmath>
@@ -7,21 +8,19 @@
 #include <sstream>
 #include <fstream>
 
-#include "mnist_fc.h"
+#include "common/tensor.h"
 
-struct QuantizedBuffer
-{
-    std::vector<int8_t> q;
-    float s;
-    uint8_t zero_point = 0;
-};
+#include "mnist_fc.h"
 
+using quantnn::QuantParams;
+using quantnn::Tensor;
+using quantnn::TensorRef;
 
-QuantizedBuffer quantize_int8(const std::vector<float> & weight)
+Tensor<int8_t> quantize_int8(const TensorRef<const float> & weight)
 {
     float min_val = 1e+5;
     float max_val = 1e-5;
-    for (int i = 0; i < weight.size(); i++)
+    for (int i = 0; i < weight.numel(); i++)
     {
         min_val = std::min(weight[i], min_val);
         max_val = std::max(weight[i], max_val);
@@ -29,31 +28,34 @@ QuantizedBuffer quantize_int8(const std::vector<float> & weight)
 
     float s = (max_val - min_val) / 127.0f;
     
-    std::vector<int8_t> quantized_weight (weight.size());
-    for (int i = 0; i < quantized_weight.size(); i++)
+    Tensor<int8_t> quantized_weight ({ static_cast<int>(weight.numel()) }, QuantParams::per_tensor(s));
+    for (int i = 0; i < quantized_weight.numel(); i++)
     {
         float clamped_qw = std::clamp(std::round(weight[i] / s), -127.0f, 127.0f);
         quantized_weight[i] = static_cast<int8_t>(clamped_qw);
     }
 
-    return QuantizedBuffer { quantized_weight, s, 0 };
+    return quantized_weight;
 
 }
 
-void dump_as_header_file(const QuantizedBuffer & quantized, const char * prefix, const char * output_file)
+// The weights become an aligned constexpr array: it is placed in .rodata, so a program
+// that includes the header pages it in from the executable instead of copying it to the
+// heap before main. The including file provides <array> and <cstdint>.
+void dump_as_header_file(const Tensor<int8_t> & quantized, const char * prefix, const char * output_file)
 {
     std::ostringstream oss;
-    oss << "const std::vector<int8_t> " << prefix << "_weight = { ";
-    for (int i = 0; i < quantized.q.size(); i++)
+    oss << "alignas(64) constexpr std::array<int8_t, " << quantized.numel() << "> " << prefix << "_weight = { ";
+    for (int i = 0; i < quantized.numel(); i++)
     {
-        oss << static_cast<int>(quantized.q[i]);
-        if (i + 1 < quantized.q.size())
+        oss << static_cast<int>(quantized[i]);
+        if (i + 1 < quantized.numel())
         {
             oss << ", ";
         }
     }
 
-    oss << " };\n\nconst float " << prefix << "_scale = " << quantized.s << ";\n";
+    oss << " };\n\nconstexpr float " << prefix << "_scale = " << quantized.quant().scale << ";\n";
     std::ofstream ofs(output_file);
     ofs << oss.str();
     ofs.close();
@@ -61,8 +63,8 @@ void dump_as_header_file(const QuantizedBuffer & quantized, const char * prefix,
 
 int main() 
 {
-    QuantizedBuffer quantized_fc1 = quantize_int8(fc1_weight);
-    QuantizedBuffer quantized_fc2 = quantize_int8(fc2_weight);
+    Tensor<int8_t> quantized_fc1 = quantize_int8(quantnn::view_of(fc1_weight, { 128, 784 }));
+    Tensor<int8_t> quantized_fc2 = quantize_int8(quantnn::view_of(fc2_weight, { 10, 128 }));
 
     dump_as_header_file(quantized_fc1, "fc1", "src/mlp/dynamic_quantization/quantized_fc1.h");
     dump_as_header_file(quantized_fc2, "fc2", "src/mlp/dynamic_quantization/quantized_fc2.h");
@@ -1,49 +1,61 @@
+#include <array>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <vector>
 
+#include "common/alloc_tracker.h"
+#include "common/tensor.h"
+#include "common/trace.h"
+
 #include "mnist_fc.h"
 #include "data_7.h"
 
+using quantnn::TensorRef;
 
 class MnistFC
 {
 public:
-    MnistFC(const std::vector<float> & fc1_weight, const std::vector<float> & fc1_bias, 
-            const std::vector<float> & fc2_weight, const std::vector<float> & fc2_bias);
+    MnistFC(const TensorRef<const float> & fc1_weight, const TensorRef<const float> & fc1_bias,
+            const TensorRef<const float> & fc2_weight, const TensorRef<const float> & fc2_bias);
 
-    int forward(const std::vector<float> & data);
-    void fc1(std::vector<float> & hidden, const std::vector<float> & data);
+    int forward(const TensorRef<const float> & data);
+    void fc1(std::vector<float> & hidden, const TensorRef<const float> & data);
     void relu(std::vector<float> & hidden);
     void fc2(std::vector<float> & output, const std::vector<float> & hidden);
 
 public:
-    const std::vector<float> & fc1_weight;
-    const std::vector<float> & fc1_bias;
-    const std::vector<float> & fc2_weight;
-    const std::vector<float> & fc2_bias;
+    // views of the arrays in mnist_fc.h
+    const TensorRef<const float> fc1_weight;
+    const TensorRef<const float> fc1_bias;
+    const TensorRef<const float> fc2_weight;
+    const TensorRef<const float> fc2_bias;
     
     int input_dim = 784;
     int hidden_dim = 128;
     int output_dim = 10;
+
+    // activations are kept across calls so that a warmed-up forward does not allocate
+    std::vector<float> hidden;
+    std::vector<float> output;
 };
 
 
-MnistFC::MnistFC(const std::vector<float> & fc1_weight, const std::vector<float> & fc1_bias,
-                 const std::vector<float> & fc2_weight, const std::vector<float> & fc2_bias) : 
-    fc1_weight{fc1_weight}, fc1_bias{fc1_bias}, fc2_weight{fc2_weight}, fc2_bias{fc2_bias} {}
+MnistFC::MnistFC(const TensorRef<const float> & fc1_weight, const TensorRef<const float> & fc1_bias,
+                 const TensorRef<const float> & fc2_weight, const TensorRef<const float> & fc2_bias) : 
+    fc1_weight{fc1_weight}, fc1_bias{fc1_bias}, fc2_weight{fc2_weight}, fc2_bias{fc2_bias},
+    hidden(hidden_dim), output(output_dim) {}
 
 
-int MnistFC::forward(const std::vector<float> & data)
+int MnistFC::forward(const TensorRef<const float> & data)
 {
+    QUANTNN_TRACE_SCOPE("forward");
+    QUANTNN_ALLOC_SCOPE("forward");
     // fc1 + relu
-    std::vector<float> hidden(hidden_dim);
     fc1(hidden, data);
     relu(hidden);
 
     // fc2 + relu
-    std::vector<float> output(output_dim);
     fc2(output, hidden);
 
     int max_index = 0;
@@ -61,8 +73,10 @@ int MnistFC::forward(const std::vector<float> & data)
 }
 
 
-void MnistFC::fc1(std::vector<float> & hidden, const std::vector<float> & data)
+void MnistFC::fc1(std::vector<float> & hidden, const TensorRef<const float> & data)
 {
+    QUANTNN_TRACE_SCOPE("fc1");
+    QUANTNN_ALLOC_SCOPE("fc1");
     for (int i = 0; i < hidden_dim; i++)
     {
         float value = 0;
@@ -77,6 +91,8 @@ void MnistFC::fc1(std::vector<float> & hidden, const std::vector<float> & data)
 
 void MnistFC::relu(std::vector<float> & hidden)
 {
+    QUANTNN_TRACE_SCOPE("relu");
+    QUANTNN_ALLOC_SCOPE("relu");
     for (int i = 0; i < hidden_dim; i++)
     {
         hidden[i] = std::max(0.0f, hidden[i]);
@@ -86,6 +102,8 @@ void MnistFC::relu(std::vector<float> & hidden)
 
 void MnistFC::fc2(std::vector<float> & output, const std::vector<float> & hidden)
 {
+    QUANTNN_TRACE_SCOPE("fc2");
+    QUANTNN_ALLOC_SCOPE("fc2");
     for (int i = 0; i < output_dim; i++)
     {
         float value = 0;
@@ -100,8 +118,20 @@ void MnistFC::fc2(std::vector<float> & output, const std::vector<float> & hidden
 
 int main(int argc, char * argv[])
 {
-    MnistFC model(fc1_weight, fc1_bias, fc2_weight, fc2_bias);
-    int out = model.forward(data);
+    MnistFC model(quantnn::view_of(fc1_weight, { 128, 784 }), quantnn::view_of(fc1_bias, { 128 }),
+                  quantnn::view_of(fc2_weight, { 10, 128 }), quantnn::view_of(fc2_bias, { 10 }));
+    const TensorRef<const float> image = quantnn::view_of(data, { 784 });
+#ifdef QUANTNN_TRACK_ALLOC
+    if (argc > 1 && std::string(argv[1]) == "--check-zero-alloc")
+    {
+        bool ok = quantnn::check_zero_alloc([&] { model.forward(image); });
+        QUANTNN_ALLOC_REPORT();
+        return ok ? 0 : 1;
+    }
+#endif
+    int out = model.forward(image);
     std::cout << "Prediction: " << out << std::endl;
+    QUANTNN_TRACE_REPORT("mlp_float32.trace.json");
+    QUANTNN_ALLOC_REPORT();
     return 0;
 }
@@ -1,9 +1,15 @@
+#include <array>
 #include <iostream>
 #include <vector>
 
+#include "common/tensor.h"
+
 #include "calibration_data.h"
 #include "mnist_fc.h"
 
+using quantnn::Tensor;
+using quantnn::TensorRef;
+
 struct Scale
 {
     float input_scale;
@@ -11,32 +17,27 @@ struct Scale
     float relu_scale;
 };
 
-float calculate_scale_int8(const std::vector<std::vector<float>> & data)
+// over every sample of a count x dim tensor
+float calculate_scale_int8(const TensorRef<const float> & data)
 {
     // calculate scale on input
     float min_val = 1e+5;
     float max_val = 1e-5;
-    for (int i = 0; i < data.size(); i++)
+    for (float value : data)
     {
-        for (int j = 0; j < data[i].size(); j++)
-        {
-            min_val = std::min(data[i][j], min_val);
-            max_val = std::max(data[i][j], max_val);
-        }
+        min_val = std::min(value, min_val);
+        max_val = std::max(value, max_val);
     }
     float scale = std::max(std::abs(max_val), std::abs(min_val)) / 127.0f;
     return scale;
 }
 
-float calculate_scale_uint8(const std::vector<std::vector<float>> & data)
+float calculate_scale_uint8(const TensorRef<const float> & data)
 {
     float max_val = 0;
-    for (int i = 0; i < data.size(); i++)
+    for (float value : data)
     {
-        for (int j = 0; j < data[i].size(); j++)
-        {
-            max_val = std::max(data[i][j], max_val);
-        }
+        max_val = std::max(value, max_val);
     }
     float scale = max_val / 255.0f;
     return scale;
@@ -45,53 +46,53 @@ float calculate_scale_uint8(const std::vector<std::vector<float>> & data)
 class MnistFC
 {
 public:
-    MnistFC(const std::vector<float> & fc1_weight, const std::vector<float> & fc1_bias,
-            const std::vector<float> & fc2_weight, const std::vector<float> & fc2_bias); 
+    MnistFC(const TensorRef<const float> & fc1_weight, const TensorRef<const float> & fc1_bias,
+            const TensorRef<const float> & fc2_weight, const TensorRef<const float> & fc2_bias);
 
-    Scale calibrate(const std::vector<std::vector<float>> & calibration_data);
-    void fc1(std::vector<float> & hidden, const std::vector<float> & data);
-    void relu(std::vector<float> & hidden);
+    Scale calibrate(const TensorRef<const float> & calibration_data);
+    void fc1(const TensorRef<float> & hidden, const TensorRef<const float> & data);
+    void relu(const TensorRef<float> & hidden);
     void fc2(std::vector<float> & output, const std::vector<float> & hidden);
 
 public:
-    const std::vector<float> & fc1_weight;
-    const std::vector<float> & fc1_bias;
-    const std::vector<float> & fc2_weight;
-    const std::vector<float> & fc2_bias;
+    const TensorRef<const float> fc1_weight;
+    const TensorRef<const float> fc1_bias;
+    const TensorRef<const float> fc2_weight;
+    const TensorRef<const float> fc2_bias;
     
     int input_dim = 784;
     int hidden_dim = 128;
     int output_dim = 10;
 };
 
-MnistFC::MnistFC(const std::vector<float> & fc1_weight, const std::vector<float> & fc1_bias,
-                 const std::vector<float> & fc2_weight, const std::vector<float> & fc2_bias) : 
+MnistFC::MnistFC(const TensorRef<const float> & fc1_weight, const TensorRef<const float> & fc1_bias,
+                 const TensorRef<const float> & fc2_weight, const TensorRef<const float> & fc2_bias) : 
     fc1_weight{fc1_weight}, fc1_bias{fc1_bias}, fc2_weight{fc2_weight}, fc2_bias{fc2_bias} {}
 
-Scale MnistFC::calibrate(const std::vector<std::vector<float>> & calibration_data)
+// calibration_data: count x input_dim, each row one sample
+Scale MnistFC::calibrate(const TensorRef<const float> & calibration_data)
 {
     float input_scale = calculate_scale_int8(calibration_data);
 
     // fc1 - int8 symmetric quantization
-    std::vector<std::vector<float>> hiddens (calibration_data.size());
-    for (int i = 0; i < calibration_data.size(); i++)
+    const int count = calibration_data.dim(0);
+    Tensor<float> hiddens ({ count, hidden_dim });
+    for (int i = 0; i < count; i++)
     {
-        std::vector<float> hidden(hidden_dim);
-        fc1(hidden, calibration_data[i]);
-        hiddens[i] = hidden;
+        fc1(hiddens.view().select(0, i), calibration_data.select(0, i));
     }
-    float fc1_scale = calculate_scale_int8(hiddens);
+    float fc1_scale = calculate_scale_int8(hiddens.view());
 
     // relu - uint8 asymmetric quantization
-    for (int i = 0; i < hiddens.size(); i++)
+    for (int i = 0; i < count; i++)
     {
-        relu(hiddens[i]);
+        relu(hiddens.view().select(0, i));
     }
-    float relu_scale = calculate_scale_uint8(hiddens);
+    float relu_scale = calculate_scale_uint8(hiddens.view());
     return Scale { input_scale, fc1_scale, relu_scale };
 }
 
-void MnistFC::fc1(std::vector<float> & hidden, const std::vector<float> & data)
+void MnistFC::fc1(const TensorRef<float> & hidden, const TensorRef<const float> & data)
 {
     for (int i = 0; i < hidden_dim; i++)
     {
@@ -104,7 +105,7 @@ void MnistFC::fc1(std::vector<float> & hidden, const std::vector<float> & data)
     }
 }
 
-void MnistFC::relu(std::vector<float> & hidden)
+void MnistFC::relu(const TensorRef<float> & hidden)
 {
     for (int i = 0; i < hidden_dim; i++)
     {
@@ -127,8 +128,9 @@ void MnistFC::fc2(std::vector<float> & output, const std::vector<float> & hidden
 
 int main(int argc, char * argv[])
 {
-    MnistFC model(fc1_weight, fc1_bias, fc2_weight, fc2_bias);
-    Scale model_scale = model.calibrate(calibration_data);
+    MnistFC model(quantnn::view_of(fc1_weight, { 128, 784 }), quantnn::view_of(fc1_bias, { 128 }),
+                  quantnn::view_of(fc2_weight, { 10, 128 }), quantnn::view_of(fc2_bias, { 10 }));
+    Scale model_scale = model.calibrate(quantnn::view_of(calibration_data, { calibration_count, 784 }));
 
     float input_scale = model_scale.input_scale;
     float fc1_scale = model_scale.fc1_scale;
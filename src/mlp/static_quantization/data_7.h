@@ -1 +1 @@
-const std::vector<float> data = { -0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.6449587345123291,1.930510401725769,1.5995763540267944,1.4977505207061768,0.33948105573654175,0.034003473818302155,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,2.4014549255371094,2.808758497238159,2.808758497238159,2.808758497238159,2.808758497238159,2.643291473388672,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,1.7395868301391602,0.23765520751476288,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.4285787343978882,1.0268056392669678,0.4922199249267578,1.0268056392669678,1.6504892110824585,2.4650962352752686,2.808758497238159,2.4396398067474365,2.808758497238159,2.808758497238159,2.808758497238159,2.757845640182495,2.4905526638031006,2.808758497238159,2.808758497238159,1.3577399253845215,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.20783297717571259,0.41585052013397217,-0.2460176944732666,0.4285787343978882,0.4285787343978882,0.4285787343978882,0.32675284147262573,-0.15692004561424255,2.5796501636505127,2.808758497238159,0.9249798059463501,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.6322304606437683,2.796030282974243,2.235987901687622,-0.19510474801063538,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.14419181644916534,2.5414655208587646,2.821486711502075,0.6322304606437683,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.2177293300628662,2.808758497238159,2.605106830596924,0.13582934439182281,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.32675284147262573,2.7451171875,2.808758497238159,0.36493754386901855,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.2686423063278198,2.808758497238159,1.955966830253601,-0.36057180166244507,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.30965885519981384,2.185075044631958,2.732388973236084,0.31402459740638733,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.179544448852539,2.808758497238159,1.8923256397247314,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.5304046273231506,2.770573854446411,2.630563259124756,0.3012963533401489,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.18237650394439697,2.3887267112731934,2.808758497238159,1.688673973083496,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.3860282599925995,2.159618616104126,2.808758497238159,2.3632702827453613,0.021275240927934647,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.05945993959903717,2.808758497238159,2.808758497238159,0.5558610558509827,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.029637714847922325,2.4269113540649414,2.808758497238159,1.0395338535308838,-0.4114847183227539,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.2686423063278198,2.808758497238159,2.808758497238159,0.23765520751476288,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.35220929980278015,2.656019687652588,2.808758497238159,2.808758497238159,0.23765520751476288,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.1159032583236694,2.808758497238159,2.808758497238159,2.3632702827453613,0.08491640537977219,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.1159032583236694,2.808758497238159,2.21053147315979,-0.19510474801063538,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923 };
+alignas(64) constexpr std::array<float, 784> data = { -0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.6449587345123291,1.930510401725769,1.5995763540267944,1.4977505207061768,0.33948105573654175,0.034003473818302155,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,2.4014549255371094,2.808758497238159,2.808758497238159,2.808758497238159,2.808758497238159,2.643291473388672,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,2.095977306365967,1.7395868301391602,0.23765520751476288,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.4285787343978882,1.0268056392669678,0.4922199249267578,1.0268056392669678,1.6504892110824585,2.4650962352752686,2.808758497238159,2.4396398067474365,2.808758497238159,2.808758497238159,2.808758497238159,2.757845640182495,2.4905526638031006,2.808758497238159,2.808758497238159,1.3577399253845215,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.20783297717571259,0.41585052013397217,-0.2460176944732666,0.4285787343978882,0.4285787343978882,0.4285787343978882,0.32675284147262573,-0.15692004561424255,2.5796501636505127,2.808758497238159,0.9249798059463501,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.6322304606437683,2.796030282974243,2.235987901687622,-0.19510474801063538,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.14419181644916534,2.5414655208587646,2.821486711502075,0.6322304606437683,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.2177293300628662,2.808758497238159,2.605106830596924,0.13582934439182281,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.32675284147262573,2.7451171875,2.808758497238159,0.36493754386901855,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.2686423063278198,2.808758497238159,1.955966830253601,-0.36057180166244507,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.30965885519981384,2.185075044631958,2.732388973236084,0.31402459740638733,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.179544448852539,2.808758497238159,1.8923256397247314,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.5304046273231506,2.770573854446411,2.630563259124756,0.3012963533401489,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.18237650394439697,2.3887267112731934,2.808758497238159,1.688673973083496,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.3860282599925995,2.159618616104126,2.808758497238159,2.3632702827453613,0.021275240927934647,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.05945993959903717,2.808758497238159,2.808758497238159,0.5558610558509827,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.029637714847922325,2.4269113540649414,2.808758497238159,1.0395338535308838,-0.4114847183227539,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.2686423063278198,2.808758497238159,2.808758497238159,0.23765520751476288,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,0.35220929980278015,2.656019687652588,2.808758497238159,2.808758497238159,0.23765520751476288,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.1159032583236694,2.808758497238159,2.808758497238159,2.3632702827453613,0.08491640537977219,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,1.1159032583236694,2.808758497238159,2.21053147315979,-0.19510474801063538,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923,-0.4242129623889923 };
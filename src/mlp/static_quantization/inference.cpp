@@ -1,9 +1,14 @@
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
 #include <vector>
 #include <cstdint>
 
+#include "common/alloc_tracker.h"
+#include "common/tensor.h"
+#include "common/trace.h"
+
 #include "data_7.h"
 
 #include "quantized_fc1.h"
@@ -15,98 +20,103 @@ float fc1_output_scale = 0.171222;
 float relu_output_scale = 0.0829648;
 
 // fc1/fc2 -> int8_t, relu -> uint8_t
-template<typename T>
-struct QuantizedBuffer
-{
-    std::vector<T> q;
-    float s;
-};
+using quantnn::QuantParams;
+using quantnn::Tensor;
+using quantnn::TensorRef;
 
 class MnistFC
 {
 public:
-    MnistFC(const QuantizedBuffer<int8_t> & qfc1, const std::vector<float> & fc1_bias,
-            const QuantizedBuffer<int8_t> & qfc2, const std::vector<float> & fc2_bias);
+    MnistFC(const TensorRef<const int8_t> & qfc1, const TensorRef<const float> & fc1_bias,
+            const TensorRef<const int8_t> & qfc2, const TensorRef<const float> & fc2_bias);
 
-    QuantizedBuffer<int8_t> quantize_int8(const std::vector<float> & data);
-    QuantizedBuffer<int8_t> fc1(QuantizedBuffer<int8_t> & qinput);
-    QuantizedBuffer<uint8_t> relu(QuantizedBuffer<int8_t> & hidden);
-    int fc2(QuantizedBuffer<uint8_t> & hidden);
+    Tensor<int8_t> quantize_int8(const TensorRef<const float> & data);
+    Tensor<int8_t> fc1(Tensor<int8_t> & qinput);
+    Tensor<uint8_t> relu(Tensor<int8_t> & hidden);
+    int fc2(Tensor<uint8_t> & hidden);
 
-    int forward_int8(const std::vector<float> & data);
+    int forward_int8(const TensorRef<const float> & data);
 
 public:
-    const QuantizedBuffer<int8_t> & qfc1;
-    const QuantizedBuffer<int8_t> & qfc2;
-    const std::vector<float> & fc1_bias;
-    const std::vector<float> & fc2_bias;
+    const TensorRef<const int8_t> qfc1;
+    const TensorRef<const int8_t> qfc2;
+    const TensorRef<const float> fc1_bias;
+    const TensorRef<const float> fc2_bias;
 
     int input_dim = 784;
     int hidden_dim = 128;
     int output_dim = 10;
 };
 
-MnistFC::MnistFC(const QuantizedBuffer<int8_t> & qfc1, const std::vector<float> & fc1_bias,
-                 const QuantizedBuffer<int8_t> & qfc2, const std::vector<float> & fc2_bias)
+MnistFC::MnistFC(const TensorRef<const int8_t> & qfc1, const TensorRef<const float> & fc1_bias,
+                 const TensorRef<const int8_t> & qfc2, const TensorRef<const float> & fc2_bias)
     : qfc1{qfc1}, fc1_bias{fc1_bias}, qfc2{qfc2}, fc2_bias{fc2_bias} {}
 
-QuantizedBuffer<int8_t> MnistFC::quantize_int8(const std::vector<float> & data)
+Tensor<int8_t> MnistFC::quantize_int8(const TensorRef<const float> & data)
 {
-    std::vector<int8_t> quantized (data.size());
-    for (int i = 0; i < data.size(); i++)
+    QUANTNN_TRACE_SCOPE("quantize_int8");
+    QUANTNN_ALLOC_SCOPE("quantize_int8");
+    Tensor<int8_t> quantized ({ static_cast<int>(data.numel()) }, QuantParams::per_tensor(input_scale));
+    for (int i = 0; i < data.numel(); i++)
     {
         float qval = std::clamp(std::round(data[i] / input_scale), -127.0f, 127.0f);
         quantized[i] = static_cast<int8_t>(qval);
     }
-    return QuantizedBuffer<int8_t> { quantized, input_scale };
+    return quantized;
 }
 
-QuantizedBuffer<int8_t> MnistFC::fc1(QuantizedBuffer<int8_t> & qinput)
+Tensor<int8_t> MnistFC::fc1(Tensor<int8_t> & qinput)
 {
+    QUANTNN_TRACE_SCOPE("fc1");
+    QUANTNN_ALLOC_SCOPE("fc1");
     // quantize fc1_bias
-    float scale = qinput.s * qfc1.s;
-    std::vector<int32_t> bias_int32 (fc1_bias.size());
-    for (int i = 0; i < fc1_bias.size(); i++)
+    float scale = qinput.quant().scale * qfc1.quant().scale;
+    std::vector<int32_t> bias_int32 (fc1_bias.numel());
+    for (int i = 0; i < fc1_bias.numel(); i++)
     {
         bias_int32[i] = static_cast<int32_t>(std::round(fc1_bias[i] / scale));
     }
 
     // int8 calculation
-    std::vector<int8_t> hidden (hidden_dim);
+    Tensor<int8_t> hidden ({ hidden_dim }, QuantParams::per_tensor(fc1_output_scale));
     for (int i = 0; i < hidden_dim; i++)
     {
         int32_t value = 0;
         for (int j = 0; j < input_dim; j++)
         {
-            value += static_cast<int32_t>(qfc1.q[i * input_dim + j]) * static_cast<int32_t>(qinput.q[j]);
+            value += static_cast<int32_t>(qfc1[i * input_dim + j]) * static_cast<int32_t>(qinput[j]);
         }
         value = value + bias_int32[i];
         float qval = std::round((value * scale) / fc1_output_scale);
         hidden[i] = static_cast<int8_t>(std::clamp(qval, -127.0f, 127.0f));
     }
 
-    return QuantizedBuffer<int8_t> { hidden, fc1_output_scale };
+    return hidden;
 }
 
-QuantizedBuffer<uint8_t> MnistFC::relu(QuantizedBuffer<int8_t> & hidden)
+Tensor<uint8_t> MnistFC::relu(Tensor<int8_t> & hidden)
 {
-    std::vector<uint8_t> relu_hidden (hidden.q.size());
-    for (int i = 0; i < hidden.q.size(); i++)
+    QUANTNN_TRACE_SCOPE("relu");
+    QUANTNN_ALLOC_SCOPE("relu");
+    Tensor<uint8_t> relu_hidden (hidden.shape(), QuantParams::per_tensor(relu_output_scale));
+    for (int i = 0; i < hidden.numel(); i++)
     {
-        float val = static_cast<float>(hidden.q[i]) * hidden.s;
+        float val = static_cast<float>(hidden[i]) * hidden.quant().scale;
         float qval = std::clamp(std::round(val / relu_output_scale), 0.0f, 255.0f);
         relu_hidden[i] = static_cast<uint8_t>(qval);
     }
 
-    return QuantizedBuffer<uint8_t> { relu_hidden, relu_output_scale };
+    return relu_hidden;
 }
 
-int MnistFC::fc2(QuantizedBuffer<uint8_t> & hidden)
+int MnistFC::fc2(Tensor<uint8_t> & hidden)
 {
+    QUANTNN_TRACE_SCOPE("fc2");
+    QUANTNN_ALLOC_SCOPE("fc2");
     // quantize fc2_bias
-    float scale = hidden.s * qfc2.s;
-    std::vector<int32_t> bias_int32 (fc2_bias.size());
-    for (int i = 0; i < fc2_bias.size(); i++)
+    float scale = hidden.quant().scale * qfc2.quant().scale;
+    std::vector<int32_t> bias_int32 (fc2_bias.numel());
+    for (int i = 0; i < fc2_bias.numel(); i++)
     {
         bias_int32[i] = static_cast<int32_t>(std::round(fc2_bias[i] / scale));
     }
@@ -118,7 +128,7 @@ int MnistFC::fc2(QuantizedBuffer<uint8_t> & hidden)
         int32_t value = 0;
         for (int j = 0; j < hidden_dim; j++)
         {
-            value += static_cast<int32_t>(qfc2.q[i * hidden_dim + j]) * static_cast<int32_t>(hidden.q[j]);
+            value += static_cast<int32_t>(qfc2[i * hidden_dim + j]) * static_cast<int32_t>(hidden[j]);
         }
         output[i] = value + bias_int32[i];
     }
@@ -129,21 +139,34 @@ int MnistFC::fc2(QuantizedBuffer<uint8_t> & hidden)
     return max_index;
 }
 
-int MnistFC::forward_int8(const std::vector<float> & data)
+int MnistFC::forward_int8(const TensorRef<const float> & data)
 {
-    QuantizedBuffer<int8_t> qinput = quantize_int8(data);
-    QuantizedBuffer<int8_t> hidden = fc1(qinput);
-    QuantizedBuffer<uint8_t> relu_hidden = relu(hidden);
+    QUANTNN_TRACE_SCOPE("forward_int8");
+    QUANTNN_ALLOC_SCOPE("forward_int8");
+    Tensor<int8_t> qinput = quantize_int8(data);
+    Tensor<int8_t> hidden = fc1(qinput);
+    Tensor<uint8_t> relu_hidden = relu(hidden);
     int prediction = fc2(relu_hidden);
     return prediction;
 }
 
 int main(int argc, char * argv [])
 {
-    QuantizedBuffer<int8_t> qfc1 { fc1_weight, fc1_scale };
-    QuantizedBuffer<int8_t> qfc2 { fc2_weight, fc2_scale };
-    MnistFC model(qfc1, fc1_bias, qfc2, fc2_bias);
-    int out = model.forward_int8(data);
+    TensorRef<const int8_t> qfc1 = quantnn::view_of(fc1_weight, { 128, 784 }, QuantParams::per_tensor(fc1_scale));
+    TensorRef<const int8_t> qfc2 = quantnn::view_of(fc2_weight, { 10, 128 }, QuantParams::per_tensor(fc2_scale));
+    MnistFC model(qfc1, quantnn::view_of(fc1_bias, { 128 }), qfc2, quantnn::view_of(fc2_bias, { 10 }));
+    const TensorRef<const float> image = quantnn::view_of(data, { 784 });
+#ifdef QUANTNN_TRACK_ALLOC
+    if (argc > 1 && std::string(argv[1]) == "--check-zero-alloc")
+    {
+        bool ok = quantnn::check_zero_alloc([&] { model.forward_int8(image); });
+        QUANTNN_ALLOC_REPORT();
+        return ok ? 0 : 1;
+    }
+#endif
+    int out = model.forward_int8(image);
     std::cout << "Prediction: " << out << std::endl;
+    QUANTNN_TRACE_REPORT("mlp_static_quantization.trace.json");
+    QUANTNN_ALLOC_REPORT();
     return 0;
 }
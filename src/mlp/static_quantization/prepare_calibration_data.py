@@ -9,14 +9,18 @@ def main():
     train_set = datasets.MNIST("../../pytorch/data", train=True, download=False, transform=transform)
     calibration_num = 1000
 
+    # one flat constexpr array of calibration_num x 784 values, read in place from .rodata
     data_str_list = []
+    value_num = 0
     for i in range(calibration_num):
         data = train_set[i][0].flatten().tolist()
-        data_str = ','.join([str(x) for x in data])
-        data_str_list.append("{{ {} }}".format(data_str))
+        data_str_list.append(','.join([str(x) for x in data]))
+        value_num += len(data)
 
-    calibration_data_str = ',\n'.join(data_str_list)
-    calibration_data_str = 'const std::vector<std::vector<float>> calibration_data = {{ {} }};\n'.format(calibration_data_str)
+    calibration_data_str = (
+        'constexpr int calibration_count = {};\n'
+        'alignas(64) constexpr std::array<float, {}> calibration_data = {{ {} }};\n'
+    ).format(calibration_num, value_num, ',\n'.join(data_str_list))
 
     with open('./calibration_data.h', 'w') as f:
         f.write(calibration_data_str)
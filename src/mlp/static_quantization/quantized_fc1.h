@@ -1,5 +1,5 @@
-const std::vector<int8_t> fc1_weight = { 2, 0, -5, 16, 4, -14, -7, -10, -10, 6, 6, -13, 9, -12, 15, -7, 13, 8, -4, 9, -12, -15, -11, -15, 10, -12, 9, 7, -8, 4, -4, -13, 4, 10, -13, 5, -10, -1, -8, 12, -19, 5, -6, 7, 1, -17, -1, -6, -18, -8, 3, 1, 0, -11, -10, 2, -9, 7, -3, -14, 15, -6, -8, 11, -22, 13, -2, -19, 4, -29, -12, -21, 19, -6, -6, 0, -9, -9, -11, -17, 3, -4, -16, -7, -15, 17, 9, 12, 7, -1, -14, -21, 7, 9, -11, 1, 16, 0, 7, 21, 10, 22, 16, 13, 3, -6, 1, -6, -25, 14, 13, -11, -15, -15, 12, 17, 13, 0, 9, 11, 18, 5, 18, 16, 33, 28, 26, 5, 27, 20, 31, 28, 14, 6, -22, -14, -22, -9, -13, -16, -7, 11, -13, 11, -8, 8, 13, 25, -8, 7, 5, 8, -8, -10, 0, -1, 19, 34, 22, 17, 19, -7, -10, -15, 0, -17, -2, 7, 14, 14, 12, 19, -2, 9, 36, -1, -1, 0, 2, -21, -19, -17, -26, -12, -8, -9, 2, 17, 19, 24, 18, 7, -11, -9, 8, 13, 2, -15, -8, 17, 11, 40, 27, 17, -8, -14, -17, -17, -24, -22, -41, -34, -12, -14, 20, 33, 39, -7, -14, 4, 3, -3, -8, -11, 13, 3, 16, 22, 5, 10, 12, -15, 2, 15, -12, 5, -18, 3, 0, -20, -7, 3, 18, 28, 9, 15, -3, -14, -23, -4, -14, 13, 15, -1, 14, 14, 9, 20, 14, -16, 3, -3, -4, 7, -12, -8, -13, -19, 11, 23, 23, 31, -5, -8, -11, -31, -26, 13, -8, -1, 8, 15, -12, 21, 18, 15, -18, -6, -30, -3, -7, -15, -8, -13, -25, 1, 26, 18, 12, 22, -16, -37, -21, -20, -21, 1, -13, 8, -7, -5, 17, 17, 0, -12, -3, -18, -30, -38, -23, -24, -18, -15, -29, -16, -2, 16, 17, -2, -21, -43, -50, -50, -40, 0, 0, 11, 2, -14, 0, 3, 4, -18, -19, -21, -14, -9, -2, -12, -1, 1, -38, -15, 8, 18, 0, -28, -44, -41, -22, -30, -31, -9, -12, 11, 6, -9, 17, 10, -13, -20, -12, -11, -30, -6, -23, 10, 7, -8, -23, -22, 16, -4, 1, -22, -9, -8, -5, -53, -27, 4, 12, -12, -1, -14, 2, 1, -2, 11, -14, -2, -20, -21, -19, -7, 16, -21, 5, 12, 5, 19, -2, -5, 11, -16, 1, -16, -19, -13, 7, -9, 9, 4, 19, 3, 5, 9, 6, 7, -2, 0, 11, -10, 9, 10, 2, -5, 6, -5, 6, -2, 7, 8, 14, 7, 1, 7, -1, 9, -13, -2, 10, 2, 19, 31, 10, 0, -15, 11, -15, -4, 0, 25, -2, 13, 4, 23, 26, 48, 54, 42, 23, 24, 14, -8, -5, 8, -15, 12, 2, 28, 27, 10, 22, 24, 1, 5, -9, -34, -22, 17, 4, 21, 23, 22, 51, 43, 24, 27, 7, 27, 15, 24, 18, -6, 12, -14, -13, 38, 52, 38, 22, -9, 8, -14, -26, -28, -11, 9, 9, 18, 28, 39, 11, 35, 29, 36, 22, 16, 6, 17, 7, -4, -18, -11, -9, 21, 21, 33, -10, -14, -11, -23, -15, -6, -24, 2, 0, -9, -8, 22, -7, 16, 7, 11, -14, 6, 2, -7, 18, 16, -9, -12, -14, 2, 23, -7, 9, -19, -7, -3, -6, -13, 0, 5, 0, -9, -10, 13, -12, -23, 6, -1, 7, 5, -15, 7, 6, 2, -11, 1, -5, 0, -2, -31, -4, -2, -22, -20, -19, 3, -2, 2, -7, -10, 4, 11, -14, 19, 4, 11, 18, 19, -7, -11, -12, -8, 10, -2, 3, 20, 16, -5, 0, -21, -22, 2, -3, -2, 0, -13, 1, 5, 0, 14, -14, -8, 15, 0, -5, 10, 5, 14, 1, 5, 8, -9, 17, 1, 10, 0, 18, 4, -3, -9, -8, -12, -3, -12, 14, -2, -2, 10, 3, 0, 4, -10, -12, -5, 9, -9, 3, 12, -6, 2, 3, 20, 1, 16, 6, 32, 35, 9, 4, 7, 5, 30, 37, 21, 26, 8, 12, -31, -38, -23, -15, -24, 13, -16, 9, -5, -2, -16, -4, 5, 1, -7, 2, 11, -4, -10, -5, 19, 26, 25, 17, -5, 17, 14, 9, -16, -8, -14, -14, 0, -8, 15, 16, 3, 7, 15, -4, -14, 16, 13, -18, -18, 6, -13, -16, -26, -13, -36, -42, -14, -33, -32, -29, -10, -2, -7, -3, 10, -9, 12, -1, -12, -9, 10, -1, -3, -9, -14, 10, 3, 14, -15, 4, -12, -18, 4, -6, 7, -13, -1, 6, 10, -15, 9, 14, -12, -5, -8, -10, -11, -9, -16, -13, 10, -11, 8, 17, 15, -10, -8, -17, 12, -14, -5, 11, 7, -2, -13, -7, 17, 4, -2, 11, 9, -16, -5, -16, 0, -11, 12, 3, 2, -10, -2, 3, 14, -10, 11, 16, 8, 5, 13, 0, 13, -16, -8, -2, 2, 8, 8, 4, 16, 6, -11, -5, 0, 9, -3, 8, 7, 13, 15, -13, -14, 5, 5, 5, -3, -10, -10, -7, -4, -4, 19, 2, 1, 10, 6, 15, -9, 13, -10, 12, 5, 11, 11, -14, -13, 9, 5, 15, 15, 12, -2, 2, 26, 1, -12, -15, -8, -19, 5, -22, -5, -9, -15, -10, -18, -6, 11, 12, 14, -1, -9, -9, -10, 7, -19, 15, -12, -13, 7, 0, -12, -13, -5, -1, -12, -8, 10, -13, -2, -10, -23, 2, -5, -12, -19, -16, 14, -1, 15, 13, 5, -14, -9, -12, 9, -8, -7, -14, -14, -38, -9, -29, 11, -9, 22, 5, -7, -9, -9, -28, 6, 6, -5, -10, 14, -3, 0, -16, 2, -10, -11, -8, -4, -30, -27, -32, -23, -36, -32, -4, -21, 0, 4, -12, 13, -4, -10, -13, -26, -6, -5, 2, 10, -16, 2, -6, -9, 11, -22, -6, -29, -15, -23, -43, -22, -23, -33, 1, -21, 2, 12, -8, 7, -7, -8, -3, -15, -28, -13, 14, 5, -16, -6, 7, -1, -30, -21, -34, -30, -46, -16, -15, 1, -30, -21, -20, -11, -10, -40, -4, -18, -21, -9, -31, -39, -23, -17, 0, -18, 1, 7, 5, -2, -22, -8, -44, -36, -41, -13, -3, -21, 8, 1, 3, -12, -18, -22, -13, 11, -17, -19, -21, -48, -41, -12, -24, -9, -8, 15, -18, -6, -6, -24, -14, -26, -5, 0, -6, 10, 23, 14, -25, -10, -9, 6, 3, 14, -19, -36, -42, -58, -43, -18, -3, 8, -5, -4, -23, -6, -15, -15, -3, -5, -6, -8, 7, 13, 37, -18, -23, -20, -18, -11, -10, 27, 1, -11, -17, -64, -67, -36, -19, -7, 10, -6, -4, -1, -36, -28, -28, -18, 5, 32, 25, 43, 27, 19, -18, -15, -20, 3, 7, 15, 10, 10, -8, -40, -40, -33, -11, -15, -5, -3, 13, -22, -19, -2, 12, 7, 33, 7, 41, 30, 32, 6, -18, -24, 13, 22, 34, 7, -1, -15, -16, -10, 15, 8, -15, -2, 17, 5, 14, -2, -6, 15, 9, 22, 23, 10, 21, 33, 19, -14, -6, 6, 40, 39, 15, 18, 3, 19, 25, 21, 9, 0, -2, 9, -4, 10, -17, 22, 11, 2, -3, 28, 5, 2, 33, 30, 14, -17, -22, 33, 35, 42, 10, 37, 10, 9, 20, 18, 21, 20, 13, -14, 1, 0, 6, -13, 13, 20, -2, 28, 16, 8, 30, 12, -3, -18, 19, 39, 45, 30, 46, 18, 24, 17, 17, 2, 32, 16, 12, 16, 12, -4, 15, -15, 1, 6, 12, 6, 4, 18, 17, 34, 6, -10, 25, 20, 46, 32, 50, 21, 22, 22, 11, -6, 15, 16, -6, 8, -16, -5, -1, -19, 16, -1, 4, 27, 1, 19, -2, 3, 8, -9, 23, 40, 38, 44, 10, 34, 6, 41, 7, 30, 24, 0, -4, 9, 15, 14, -12, -13, 21, 2, 17, 17, 8, -5, 7, -10, -8, -1, 31, 24, 35, 9, 10, 11, 1, 31, 29, 16, 20, 1, 12, -16, 6, -15, -6, 4, 20, 4, -12, -10, -5, -16, -10, -20, -26, -6, 0, -5, -18, 3, 11, -12, -10, 17, 8, 6, 7, 1, 0, -9, 3, -14, -10, 17, 23, 20, -10, -12, 2, -18, -19, -21, -27, -35, -45, -48, -28, -32, -33, -14, -8, 8, -1, 15, 9, 5, -8, -9, 7, -8, -1, 11, 15, -11, -27, -17, -16, -9, 14, -9, -25, -30, -22, -36, -20, -50, -40, -36, -19, -6, 4, -11, -3, 9, -1, 3, -11, -10, -12, -4, -14, -8, -10, -16, 0, -21, -19, -14, -26, -15, -25, -37, -19, -48, -26, -24, -46, -26, -8, -1, -1, -4, 5, -3, -13, -13, 10, -9, -1, 14, 14, -3, -27, -7, -32, -38, -16, -20, -35, -15, -34, -19, -24, -7, -7, 12, 3, -23, -1, 15, 2, -11, 12, -6, 10, 8, -11, 12, -17, -13, -11, -29, -3, -16, -22, -19, -9, -31, -27, -34, -33, -8, -12, 10, -19, -2, 5, -10, 17, -6, 5, 2, -13, -13, 8, 11, 11, -15, 5, -8, 9, -10, -21, 3, -2, -25, -12, -10, -6, -8, -10, -14, -14, -17, 10, -12, -17, -10, -8, 6, -12, -4, 15, 1, -1, -17, -18, -1, 15, -2, 11, -7, -7, 4, 10, 14, -8, 1, -17, 12, -5, -12, -17, 5, -6, 15, -4, 14, -6, 1, 13, -1, 10, 21, 14, -8, 7, -12, 18, 15, -9, 6, 6, -3, 14, -4, -7, -7, 2, -12, -11, -2, 4, 8, 18, 17, 10, 10, -4, -9, -10, -12, 2, 0, -10, -11, -9, -11, 18, -6, 13, 4, 2, -11, 10, 15, 12, -9, 3, -8, -5, -6, 4, 11, -5, -9, -8, 15, 17, 18, 8, -15, 1, 12, 8, -4, 8, 21, -15, 5, -8, -7, -7, -18, -5, 6, -4, 3, -3, 4, 4, 20, -10, 20, 13, -9, 5, 11, -4, -11, -7, -10, 3, -9, -28, -55, -64, -27, -58, -72, -25, -8, -20, -20, -18, 7, 6, 5, 18, -7, 13, -6, 7, -5, 16, -11, -3, -27, -40, -12, -9, 0, -8, -20, -28, -53, -63, -70, -62, -47, -40, -16, -10, -16, -19, 9, 19, 19, 22, 4, 12, 11, -22, -7, -9, -30, -60, -34, -50, -59, -4, -29, -25, -32, -55, -64, -64, -54, -32, -14, -36, -29, 3, -3, 12, -6, 0, -5, 4, 0, -8, -31, -57, -72, -52, -70, -54, -51, -8, -13, -8, -35, -50, -53, -42, -48, -46, 2, -4, -17, 4, 5, -9, 16, 8, 10, 7, -27, -36, -55, -61, -63, -47, -56, -33, -30, -12, -33, -7, -12, -42, -36, -36, -28, 2, -20, -4, -32, 9, 16, 7, 13, -4, -6, -15, -36, -40, -49, -46, -58, -54, -43, -25, 6, 7, -9, -14, 19, 20, -5, 5, 8, 24, 27, 22, 19, -12, -6, 1, 9, -11, -10, -30, -38, -41, -38, -39, -30, -13, -35, -25, 24, 29, 61, 40, 36, 45, 29, 16, 16, 7, 7, 40, 26, 13, -6, -5, 17, 7, -11, -13, -32, -44, -8, 11, -11, 8, -11, -11, 48, 55, 50, 52, 24, 19, 28, 29, 34, 6, 27, 75, 82, 20, 19, 2, 4, 14, -6, -35, -44, -13, 5, -2, -7, -18, -5, 21, 50, 50, 30, 38, -10, 16, -6, 15, 39, 30, 44, 53, 41, 26, -5, 12, 8, -13, 12, -16, -59, -21, 21, 18, 14, 2, 21, 43, 24, 25, 23, 10, -14, -53, -47, -40, -14, -23, -18, -17, 18, 37, 6, -3, -10, 18, 13, -23, -22, 5, 29, 34, 28, 23, 38, 36, 30, 21, -6, 2, -30, -51, -68, -73, -61, -24, -57, -8, 12, 26, 17, -5, -5, 11, 9, -11, 5, 20, 13, 31, 32, 23, 50, 9, 9, -9, -7, 22, -13, -56, -49, -43, -27, -11, -29, -7, -3, 19, 3, 8, 11, 10, 5, 10, 29, 9, 9, 11, 18, 23, 21, 18, 7, -8, -17, 26, 4, -17, -37, -53, -29, -20, 4, 1, 0, -5, 15, -9, -11, -9, 10, 0, 2, 12, -17, 1, 17, 17, 25, 34, 18, 5, -8, -11, -51, -23, -35, -33, -7, -9, -33, -14, 17, 2, 10, 10, 14, -3, 16, -30, 24, 15, -2, 7, 21, 8, 15, 26, 28, 26, 24, -36, -30, -18, -10, -21, -14, -10, -5, -6, -15, 23, 0, -6, -2, 7, -16, -30, 8, 0, 9, 9, 35, 33, 25, 16, 40, 28, -26, -47, -38, -23, -6, -14, -27, -10, 12, -11, 17, 6, -11, 0, 19, -2, -4, -36, -13, -29, -24, 8, 0, -10, 1, 1, 40, 6, -23, -28, -16, -12, -11, -37, -23, 16, 7, 30, 18, 18, -4, -3, 17, -4, 0, -34, -25, -18, -35, -12, -36, -23, -21, -32, -30, -14, -29, -18, -39, -30, -7, -22, -13, 28, 6, 18, -8, 16, 8, -12, 10, 16, -12, -4, -6, -33, -50, -34, -36, -52, -39, -38, -32, -14, -32, -47, -32, -6, -34, 8, -6, 14, 26, 34, -11, 18, 21, 18, -11, 8, 14, 5, -15, -15, -20, -9, -21, -48, -28, -38, -37, 2, -10, -29, -9, -10, -28, -5, -2, -7, 32, 27, 1, 14, 14, -4, 21, 4, 12, 2, 1, -27, -53, -17, 2, -13, -20, -5, -15, -4, -23, -2, 0, -4, 2, 21, -2, 12, 14, 31, -5, 23, -10, -1, -3, 16, 1, -12, -13, -46, -34, -27, -5, -27, -18, -29, -3, -22, -24, -39, 8, 1, 20, 8, 18, 15, 32, 9, -8, -4, 15, 18, -4, 14, 6, 2, 9, -12, -20, -26, -18, -62, -38, -44, -36, -19, 0, 9, 17, 26, 17, 18, 5, 11, 5, 26, -8, 8, 1, 22, 20, 2, 3, -9, 18, -11, 10, -24, -31, -24, 11, 30, -4, -10, -3, 21, -2, 10, 23, -3, 28, -3, 4, -7, 7, 1, 11, -9, 1, 6, 22, -5, -10, 13, 1, 10, 20, -5, 0, 20, 4, -4, -2, -7, -7, 18, 0, 9, 1, 0, 13, 14, -11, -9, 16, 16, -16, 0, -14, -1, -5, 8, -18, -11, -1, 4, 8, -18, 6, -1, -3, -12, -1, -4, 12, 9, -6, 15, -15, -18, 1, -8, -10, 9, 9, 4, -13, 15, 7, -15, -8, -5, -4, -4, -17, 11, -12, 2, -13, -11, 16, 1, 7, 12, -12, 6, -8, 11, 14, 0, -18, -5, 2, 4, -9, 15, -10, -7, 14, -18, 5, 0, 4, 1, -4, -2, 15, 21, -2, -15, -13, -8, -14, -12, 2, 11, -4, 0, -2, -2, 2, 5, -7, -3, 13, -7, 6, 12, 0, 30, 28, 35, 42, 44, 48, 44, 12, 4, -4, -18, 0, -12, -14, -26, 15, -8, 1, -5, -15, -16, 15, 15, 11, 3, 0, 24, 52, 36, 44, 43, 37, 51, 31, 47, 35, 26, -19, -26, -38, -26, -38, -3, 10, 11, -5, -7, -17, 0, -3, -2, 14, 22, 14, 1, 7, 11, 7, 21, 31, 18, 23, 23, 8, 0, 10, -27, -17, -12, -29, -22, -26, 10, 0, -16, -14, 12, -9, 21, 25, 12, -6, 14, 17, 24, 21, 5, 26, 15, -3, 0, -6, 15, -13, -6, -19, -29, -11, -33, -11, 12, 7, 12, -16, -13, 15, 29, 7, 18, 19, -15, 11, -9, -1, 2, 3, 25, 1, 13, 5, 15, -1, 2, -31, -1, -34, -28, -31, 2, 0, 8, -11, 3, -2, 35, -1, 16, 10, -29, -9, -28, -17, -34, -17, 36, 14, 9, 26, 6, 4, -7, -6, -2, -34, -55, -9, 10, 10, 14, -17, 16, -5, -8, -2, -26, -1, -30, -21, -41, -44, -14, -21, 7, 15, 33, 39, -4, 11, -9, -14, -22, -38, -40, -30, -13, -13, 6, 2, 16, 10, -16, -31, -29, -48, -39, -35, -39, -41, -14, -7, 22, 25, 8, 16, 14, 9, 2, -11, -25, -28, -13, 7, -10, 7, -1, -11, 5, 1, -6, -27, -62, -42, -31, -47, -38, 5, -21, -14, 18, 11, 10, -1, 6, -3, 10, -44, -32, -40, 0, -19, -16, -12, -15, -4, 10, -8, -27, -32, -28, -37, -18, -5, -5, 10, 8, -16, -3, 16, 4, -11, -13, -4, -9, -13, -22, -33, -14, -12, -13, 7, 2, -3, 11, -2, -18, -36, -31, -10, -5, 2, 16, -10, 8, 1, 1, 12, -14, 4, -28, -17, -39, -11, -41, -27, -14, 3, -6, -14, 16, -18, 11, -2, -19, -16, -8, -2, 27, 33, 11, 2, -24, 5, 34, -4, 3, -21, -34, -9, -14, -25, -30, -9, 7, -3, 2, -8, -8, 12, -15, -4, 30, 16, 9, 18, 22, 18, -9, -25, -42, 0, 30, -1, 3, -20, -11, -5, -13, -20, -22, 13, -8, -6, 14, -4, 0, -13, -10, 0, 30, 17, 15, -15, -23, -5, -11, -40, -20, -13, 10, -8, -22, -33, -13, 9, 0, -18, 22, 11, 26, 11, 8, -7, 10, -6, 17, 18, 40, -2, -1, -18, -2, -23, -6, -33, -38, -7, 4, 0, 12, -13, -3, -6, 4, -7, 8, 18, 8, 22, -12, -2, 2, 16, -12, 36, 22, 5, 14, -9, 10, 11, -4, -29, -21, -1, 5, 20, 32, 1, 21, 28, 11, 19, 18, 22, 10, 25, -4, -4, 13, -16, 1, 33, 21, 20, -1, 17, 18, 2, 18, -11, -11, 9, 37, 39, 30, 19, 8, 27, 29, 28, 43, 21, 27, -2, -5, -13, -15, -15, 1, 16, 13, 11, 19, 13, 11, 28, -5, 10, -8, -9, -3, 13, 33, 27, 28, 6, 9, 12, 14, 30, 7, 6, -2, -13, -6, -16, 2, 30, 0, -6, 6, -10, -5, 12, 2, 12, -14, -20, -2, 10, 2, 22, 23, 15, 13, 12, -1, 28, 27, 8, 11, 3, -4, -4, -1, 16, 27, 29, 11, -14, 12, 5, -1, -9, -33, -23, -7, -12, 13, 19, 41, 40, 41, 11, -11, -4, 10, -12, -8, -4, -16, 5, 0, 3, 17, 28, -10, 16, -6, 3, 5, 14, 7, -10, -8, -10, 11, -3, 10, 15, 7, -9, -14, 17, 6, -12, -13, 5, -16, -18, -10, 1, 16, -9, 0, -1, 3, -10, 12, -9, 3, 9, 14, -16, -6, -2, 4, 6, -13, -13, 0, 9, -10, -10, -16, -13, 12, 9, -2, -8, -4, 9, -7, 17, 0, 0, 7, -15, 4, 17, -14, -14, -30, -23, 3, 5, 12, -4, -19, 3, 3, 12, -2, 2, -9, 15, -11, 8, 0, -15, 2, -15, -2, -10, 2, -8, -5, 6, -11, 1, 0, 6, 2, 9, -14, 12, -9, 16, -3, 5, 11, -13, -9, -16, -15, 8, 14, 8, -10, 12, -7, 16, -5, 5, 2, 9, -8, 10, 0, -2, -5, -12, 5, 2, -8, -11, 2, -10, 15, 13, -11, 14, 14, -7, 13, -6, 16, -14, -3, 15, -16, -16, 8, -9, 9, 0, -1, 7, 16, 8, 14, -5, -3, -12, 8, -14, 13, 5, 15, 15, -13, 17, 3, 5, 11, -15, 6, -16, 13, 2, 15, -11, 1, 6, 7, 4, -5, -14, 9, -9, 13, -3, -12, 14, 4, 12, 6, -4, -12, -14, -16, -15, -9, -1, -4, 6, 2, 0, 17, -11, -15, 18, -1, -16, -2, -2, 11, -8, 0, -13, 0, 14, 13, 0, -17, -14, 4, -8, 14, -14, 3, -8, -3, 19, 15, 7, 20, 27, 10, 4, 16, 11, 22, -14, -9, -1, 1, -6, -10, -5, 11, -6, 9, -16, 0, -4, -3, 17, 3, 7, 10, -1, 27, 37, 33, 25, 34, 16, 19, 9, 10, 6, 24, 8, 9, -16, -3, 5, -4, 4, 14, 12, 7, 5, -14, 0, -1, 7, -7, -19, -1, 18, -7, 1, -4, 0, 13, 21, -5, 4, 24, 14, -7, -9, -7, 5, -4, -14, -3, -8, -5, 6, 1, 1, 1, -9, -20, -33, -35, -31, -30, -12, -5, 15, 18, 2, 1, 5, 3, -9, -10, 6, 2, 18, 9, -7, 5, 6, 0, -15, -1, -25, -46, -33, -40, -35, -9, -26, -12, -14, -10, 26, 13, 24, 19, -10, -2, -18, -11, 3, -16, -12, -5, -3, 7, -10, -7, 10, -27, -30, -9, -27, -10, -11, 9, 0, 0, 19, 5, -7, 22, 1, 15, -10, 1, 11, -12, 7, 5, -3, -5, 7, 1, 13, 0, -3, -22, -13, 7, -16, -12, 15, 2, 4, 0, -18, -33, -9, -34, 2, -11, 5, 26, 9, 24, 16, 1, -10, 1, -13, 10, 14, -2, -16, -21, -9, 17, 9, 21, 12, 5, 9, 10, -19, -33, -66, -57, -12, -1, 29, 32, 20, 29, 31, 14, -15, -14, -14, -1, 7, -16, -29, -3, 3, 9, 1, 30, 6, -6, -18, -25, -11, 1, -17, -27, -4, 23, 38, 31, 36, 26, 45, 36, 15, -2, 11, 16, -12, -4, -24, -7, 3, 7, 27, 17, 31, 8, -1, -30, 13, -2, 5, 3, 19, 17, 33, 31, 36, 47, 60, 26, 22, 16, -8, -5, -9, -17, 11, -1, -18, -5, 1, 4, 18, -13, -18, 9, 28, 30, 26, 30, 2, 0, 10, 1, 4, 39, 33, 15, 14, 16, 5, 1, -14, 2, -11, 5, -29, -31, -22, 24, -6, 27, 15, 19, 26, 31, 38, 14, 10, -21, -39, -31, -14, -17, -20, -9, 11, -10, 1, -5, -6, -14, -8, -6, -1, -7, -23, -10, -2, 24, 12, 31, 30, 38, 1, 18, -9, -18, -45, -55, -10, 2, 2, -10, 3, 9, 11, 10, -11, 15, -10, -22, -4, 1, -1, 8, 26, 47, 18, 28, 30, 14, -8, 14, -7, -32, -51, -64, -51, -23, 3, 4, 14, -3, -11, -17, 6, -16, 14, -23, -9, 11, 11, 11, 15, 16, 8, 20, 12, -25, -15, -2, 7, -43, -50, -39, -31, -21, 0, -17, 0, 16, 5, -8, -5, -14, -1, -22, -2, 16, 2, 25, 20, 10, 9, -6, -18, -30, -8, -8, 9, -16, -24, -32, -24, -16, 18, 4, -3, -4, 15, -2, -2, -12, 15, -8, 11, 10, 4, 17, 5, 18, -21, -38, -7, -11, -11, -2, 7, 3, -21, -11, 4, -6, 6, 5, 11, -18, 4, -1, -2, -10, -7, 6, 18, 10, 31, -6, 11, -24, -14, -17, -1, -18, 18, 17, 15, 8, -1, -18, 5, 0, -8, 5, 13, -12, 13, -12, -11, 2, -13, 20, 14, 4, 30, -7, -2, -27, -4, 5, -4, -9, -2, 1, -12, -3, -15, -5, 1, -14, 6, 3, 7, 4, 14, 4, -4, -11, -14, -3, -3, 15, -6, 0, 0, 1, 0, 24, 27, 28, -2, 8, 4, -10, -21, -17, -9, -14, -18, -4, 12, -5, -11, -7, -7, 3, 6, -2, -13, -7, -15, 21, -13, 6, 13, -10, 19, 10, 5, -9, 14, -5, 5, 10, 16, -11, 14, -12, 9, 2, 14, 11, -18, 10, -14, 7, -35, -12, 8, 2, 6, -1, 15, 19, 21, 11, 9, 11, 6, 19, 10, 10, -9, 0, -3, -9, 2, -4, -16, 8, -2, 6, 1, -25, -1, 13, 6, 18, 8, 10, 27, 18, 17, 54, 33, 51, 43, 13, 15, -3, 0, 0, 1, 7, -1, 8, -14, -1, 15, -1, 3, 0, 13, -5, 2, 11, 9, 2, 18, 31, 28, 36, 2, 23, 25, -2, 20, 8, -6, -1, 17, -6, -2, 16, 2, 16, -10, 16, -12, 12, 6, -9, -13, -4, 11, -17, -12, 12, -12, -8, -7, 7, 4, 1, 2, -15, -7, 8, -1, -5, -17, 10, -6, 14, 0, 12, 3, 12, -18, 2, -11, -19, -14, -6, -14, -6, -4, 11, -20, 0, -16, -9, -18, -15, -20, 9, 10, -14, 7, -4, -10, 1, 10, -9, -13, 0, 10, -13, -10, -14, -12, 6, 13, -6, 11, 5, -11, 1, 12, 1, -19, -14, 11, 8, -19, 14, -9, -10, -14, -11, -17, 4, 8, 5, -3, -9, -3, -9, -8, -3, 18, -3, 12, -10, -2, 9, -5, -13, -10, -4, -7, 16, 0, 2, 11, -18, -16, -1, -7, 0, -20, -19, -6, 9, -11, -5, 10, 0, 33, 5, 4, 27, 22, 8, 12, 0, 17, 26, 1, 0, 14, -5, -12, -8, -20, 4, 6, -2, -8, 2, -15, 4, 24, 18, 12, 7, 4, 18, -9, 18, 17, -2, 2, 27, 24, 24, 31, 13, -9, 17, -16, 9, 11, -12, -17, -6, -10, -13, -12, -12, 13, 5, 10, -5, -9, -27, 9, 15, 10, 18, 1, 22, 26, 24, 32, 35, 29, 5, 8, 0, 13, -12, 3, 9, 4, 23, 30, 18, 12, -7, -11, -42, -37, -8, -13, 8, -8, -44, -21, -44, -15, -25, 8, 35, 28, 45, 9, -13, 6, 6, -15, -19, 8, 4, 40, 17, 10, -26, -16, -46, -12, -17, 12, 6, -11, -32, -44, -27, -6, -19, -23, 21, 9, 20, 8, 8, 14, -3, -6, -5, -15, 3, -4, 3, -19, -15, -40, -41, -25, -4, -9, -14, -9, -14, -24, -18, -35, -9, 3, -1, 0, 20, 39, -11, 12, 14, -10, 8, -9, -8, -9, -9, -8, -36, -22, -20, -29, -20, 12, 0, -12, -1, -5, -21, -4, -2, 2, 9, -9, 12, 33, 1, 8, 13, -16, -21, 6, 6, -14, -42, -4, -34, -44, -25, -36, 13, 25, -9, -9, -14, -15, 3, -6, -31, -10, -3, -17, 24, 9, -11, -11, -4, -3, -5, -9, -14, -29, -22, -30, -20, -14, -13, -6, 27, 20, -21, 3, -9, -10, -14, -2, -42, -36, -25, -9, -19, 0, 4, -18, -11, -12, -25, -5, -15, -14, -13, -3, -9, 19, 12, 33, 47, 48, -18, -25, -6, -30, -25, -8, -23, -28, -17, -27, -24, -16, -11, 1, 14, -11, -10, -11, -23, -7, 6, 11, 23, 10, 29, 41, 30, 9, -17, -28, -25, 5, -7, -3, -24, -22, -5, 3, -16, -12, 2, 11, -10, -1, 3, -13, -9, -15, 20, 26, 22, 31, 29, 39, 28, -19, -29, -25, 1, 13, 22, -11, 9, -6, 12, 35, 26, -8, -8, 8, -8, 8, 15, 4, -2, 10, 18, -1, 23, 7, 17, 1, 2, -1, -18, -16, 1, 25, 28, 12, -1, 13, 30, 18, 41, 15, 5, -19, 10, -12, -12, 12, -5, 15, 9, 10, -17, -10, 9, -7, -15, 3, -11, -9, 26, 28, 52, 34, 30, 19, 19, 44, 23, 13, -19, -19, -6, -12, -5, -1, 14, 5, -2, 1, 5, -20, 4, -1, -32, -13, -17, 2, 24, 56, 19, 33, 26, 2, 4, 14, -2, -5, -3, 7, -18, -13, 11, 25, 19, 39, 9, -1, 11, 6, 2, -16, -9, -3, 1, 27, 44, 17, 29, 3, -17, 13, -5, -14, -4, -18, -17, 9, -9, -2, 6, 34, 42, 43, 26, 21, 10, 34, 41, 37, 38, 20, 22, 39, 16, 14, 10, -26, -18, -12, 1, -8, -11, -7, -2, -19, -9, -2, -17, 24, 31, 13, 9, 10, 36, 47, 38, 46, 41, 14, 10, 5, 0, -6, -4, 3, 0, 13, 5, -5, -20, 8, -6, 6, -20, -20, 8, 4, 1, 15, 9, 20, 23, 32, 7, 45, 22, 4, -2, 4, -13, 5, 1, 11, -12, 9, 13, -16, -22, -1, 8, -3, -18, 5, -14, -2, -2, 0, -13, 11, -14, 19, 10, 32, 33, 28, -10, -22, -17, -7, -12, 8, -22, -2, -18, -25, 2, -2, 1, -20, -1, 11, 5, 13, -6, 15, -18, -20, -2, 22, 2, 2, 7, -39, -40, -19, -32, -13, -24, -13, -16, 1, -19, -14, -16, 8, 2, 0, -6, -7, 8, 6, -1, -8, -30, -43, -46, -24, -32, -39, -23, -18, -6, -10, -28, -33, -2, -26, 6, -8, -13, -4, 4, 0, 3, -12, 1, -17, 9, -19, -5, -33, -40, -37, -45, -27, -41, -41, -33, -12, -20, -25, -15, -31, -21, -14, -13, -7, -9, 1, -12, 3, -20, -8, -16, -15, 10, 4, 3, 8, -14, -7, -10, -39, -34, -19, -38, -36, -19, -5, -20, -11, -39, -24, -12, -22, 5, -14, -17, -11, -15, -12, 4, 12, -14, -2, -4, -15, -4, -1, -7, -19, -9, -10, -3, -20, 1, 8, -13, 9, -9, -11, -4, -11, -5, -3, -10, -9, -14, 13, -3, 9, 11, 2, 8, -12, -2, -6, -1, 0, -6, -1, 3, -2, 1, 16, 4, 11, 12, 4, 21, 19, -8, 15, 14, 9, 17, -10, -11, -8, -3, -1, 4, 6, 8, -14, 19, 8, -1, 20, 20, 17, 3, -14, 5, 9, -4, 19, 9, 5, 13, 5, -3, 12, 0, 6, -6, -9, -4, 19, -9, 11, 19, 19, -8, -8, -19, -7, 0, -23, -18, -21, 3, -3, 11, 16, 12, 27, 8, -8, 11, 8, -10, 12, 16, -12, 18, 9, -12, 11, 11, 8, 4, 2, -10, -11, -34, -46, -14, -28, -12, -7, 9, -2, 33, 18, 18, 15, -1, -10, 0, -4, 9, 12, 18, 13, 13, -6, 14, 12, -26, -36, -48, -27, -44, -44, -12, -13, 2, -5, -28, 22, 7, 27, 19, 9, -10, 10, 3, -7, -5, 14, -2, 11, 3, 10, -4, -5, -16, -12, -33, -39, -19, -3, -8, -3, 18, 10, -9, 3, -18, -11, 0, 13, 15, -10, -6, 12, 7, 8, 11, 9, -1, 2, -7, -2, 3, -11, -14, 8, -9, 7, -4, 2, 9, 24, 11, -9, 3, 6, -1, 3, -1, -10, 10, 8, 5, -12, 15, 15, 16, -13, 1, 6, 23, 22, -3, 6, 0, -10, 19, 11, 18, 24, -1, 29, 29, -4, -16, -5, -9, -13, -1, 13, 14, 7, 5, -7, -11, -10, -7, 13, 26, 25, 8, -26, -24, -38, 8, 24, 21, 21, 34, 9, 10, -5, -29, -55, -18, -9, -4, -14, 20, -13, -2, 7, 21, -25, -12, 35, 26, 0, -7, -48, -59, -12, 25, 39, 42, 24, 10, 9, 4, -3, 0, -22, -21, -12, -12, -8, -10, 14, 12, 24, 8, -10, -20, 21, 4, -20, -37, -74, -62, 1, 18, 36, 19, 17, -5, -2, 1, 1, 17, 2, -7, 4, 11, 16, 8, 13, -14, 3, 20, -22, -27, -9, -24, -58, -71, -57, 11, 39, 30, 28, 23, 20, 9, 1, 5, -1, 10, -23, -10, -21, -5, -13, 5, -3, 0, 2, -21, -1, -21, 6, -28, -27, -14, 12, 62, 54, 49, 17, 27, 17, 19, -15, -1, 8, 6, -10, -17, -5, 9, 19, -7, -8, -2, 0, 1, -27, 2, -13, -16, -17, 29, 30, 42, 53, 33, 32, 16, 6, 8, 1, 16, -9, -27, -51, -23, -32, -17, 12, -11, 21, -9, 17, -10, -8, -50, -39, -23, 24, 25, 54, 68, 52, 31, 28, 31, 25, 3, 1, 3, 5, -35, -47, -54, -25, -11, 5, -10, -9, -4, -4, -8, -15, -75, -68, -60, -6, 30, 53, 63, 36, 47, 18, 10, 15, -18, 11, 1, 4, -20, -21, -35, -24, -18, -13, 15, -8, 22, -11, -4, -27, -81, -69, -75, -40, -8, 28, 33, 20, 13, 5, 15, 15, 14, -12, 7, -13, -44, -43, -17, -35, -1, 4, 14, 21, 13, -4, -13, -49, -72, -75, -63, -56, -43, -1, 2, 26, 35, 8, 22, 20, 2, -25, -40, -41, -50, -36, -14, -1, -16, -4, 18, 3, 19, 28, -3, -37, -43, -60, -45, -56, -52, -43, -16, 7, 5, 5, 1, -8, -13, -31, -33, -28, -18, -58, -18, -17, 3, 5, 17, -1, 17, 28, 11, -8, -26, -28, -32, -53, -50, -49, -46, -22, -12, 0, 2, -10, -27, -13, -58, -39, -36, -30, -33, 5, -7, -6, 16, 10, 15, 0, 23, 8, 26, 4, -9, -28, -20, -45, -34, -38, -6, -11, -10, -20, -8, -36, -27, -4, 1, -28, -9, -13, 10, 4, 16, 9, 4, -8, 25, 16, 18, 38, 22, -10, 13, -10, -10, -16, -15, -11, 0, -25, -5, -10, -34, -22, -24, -17, -17, 10, 19, 3, -13, 3, 6, -3, 29, 39, 34, 33, 44, 27, 12, 14, -1, -15, -3, 19, -8, -23, -23, -12, -22, -12, -12, -17, -18, -10, 17, 13, 1, -7, 4, 2, 38, 39, 41, 36, 12, 16, 28, 4, 3, 25, 0, -6, -24, -22, 3, -29, -29, -18, -7, -30, 9, -10, 4, 21, 2, -4, 8, 26, 26, 33, 27, 29, 26, 1, 26, 2, -21, -4, 16, 2, 0, -3, -13, -29, -22, -19, -13, 15, 1, -12, 6, -4, 0, 2, 5, 10, 19, 11, 21, 34, 46, 47, 30, 29, 14, 35, -1, -36, -19, -29, -1, -5, 21, 5, 11, 4, -6, 9, -12, 11, -2, -7, -12, 18, 14, 0, 18, 7, 1, 18, 4, 6, 2, -7, 5, -4, 6, -5, 5, -1, -3, 3, 17, 18, -1, -7, 16, -11, 17, 20, -6, 13, -11, -5, -1, -2, 6, 10, -2, -13, 15, 16, 6, -7, -13, 0, -5, 18, -4, 12, 3, 1, 12, 8, 20, -3, 1, -2, 6, 2, -19, 0, -19, -6, 5, -3, 1, -7, -20, -10, -15, -21, -22, -11, -25, -16, -19, 7, -10, -17, 0, -24, -17, -12, 2, -23, -1, -10, -13, -10, -8, -13, 3, 2, 1, 4, 1, -3, -23, 3, 8, 4, 7, 2, -12, -12, -3, -2, -15, -4, -27, -15, 6, -1, -10, -9, 0, -10, -20, -1, 10, 5, -1, 19, -10, 12, 7, -3, 22, -9, 20, 3, -19, 8, 3, -14, -10, -12, -1, -17, -27, -7, -14, 2, -16, -1, 9, -5, -14, 12, 19, 24, 37, 31, 4, 18, 23, 20, 15, 16, 19, 10, 7, 0, -17, -16, -12, -25, -10, -9, -1, -6, -8, 4, -5, 4, -8, 9, 19, 9, -5, -10, 23, 22, -2, 11, 4, 8, 14, 11, 9, -11, -11, -19, 3, -15, -24, -15, -7, -20, -16, -24, -20, -18, -16, 7, 7, -6, 12, -22, 14, -6, -1, 6, 0, 26, 27, 27, 7, 2, 4, -13, -8, -13, -24, -12, -21, -3, -24, -24, 0, -5, 9, 6, 17, -5, 2, -6, -21, -8, 4, -11, 1, 6, 20, -23, 5, -10, 7, 5, 8, -17, -20, -22, 4, -28, 7, -8, -12, 9, 30, 14, -1, 4, 12, -15, -5, -3, -4, -7, -1, -7, -15, -14, -6, -10, 23, 6, -15, 3, 0, 6, -19, -1, -1, -19, -8, 7, 17, 26, 22, 1, 1, 21, -14, -15, -16, -2, -19, -1, -11, -19, 8, 25, 14, 3, 14, -17, 1, 4, -11, -6, 4, 8, 1, -7, 16, 5, 29, 26, 13, -9, -19, -17, -38, -28, -33, -16, -2, -3, 1, 1, 33, 34, 10, -16, -21, -16, -15, -14, -11, 12, -1, 20, 21, 8, 27, 4, 16, 6, -14, -46, -43, -44, -19, -1, -13, 9, 13, 25, 47, 6, -12, -18, -2, 4, -16, 3, -4, -6, 16, 0, -5, -12, -15, -11, -7, 12, 1, -28, -26, -30, -34, -17, 7, -13, -3, 4, 42, 21, -12, -23, -10, -4, 3, -18, -3, 10, 12, 9, 10, -4, -3, 9, 12, -8, 10, -19, -21, -46, -23, -7, -6, -15, -27, -18, 17, -1, 3, -15, -22, -9, -20, -19, -21, 1, -10, -5, -3, -20, -4, 5, 1, 6, 11, -29, -9, -22, -13, -5, -23, -21, -16, 7, 13, 12, -15, 0, -22, -27, -15, -21, -16, -7, 11, 2, -19, -27, -12, 1, 3, 18, 5, 15, -16, -31, -4, -11, -22, -3, -5, -15, -5, 4, -18, -8, -19, -2, -13, -5, -35, 8, 1, -20, -21, -5, 4, 15, 14, 46, 10, -14, 8, -6, -25, -20, 6, -3, -2, -2, 11, 18, 2, -27, -25, -27, -14, -7, -24, -8, 7, -25, -13, -20, -11, 10, 37, 39, 24, 7, -1, -9, 2, 18, 0, 23, -5, 10, 10, 4, -10, -25, -10, -16, -26, 1, 5, 6, -2, -25, 9, -21, 13, -4, 5, 25, -23, -31, -14, -19, -3, 23, -7, 16, 25, 26, 10, 0, 5, -9, 5, -27, 7, -14, 5, 14, 37, -2, -4, -14, 5, 15, 12, 2, -14, -31, -21, -15, 6, -5, -5, 2, 8, 11, 27, 20, -27, 4, -11, -8, -13, 2, 9, 1, 29, 25, 19, 31, 0, 26, 6, 26, -22, -13, -14, -8, -1, -1, 26, 11, 39, 45, 20, 11, -5, -12, 0, -4, 8, 16, 3, 29, 10, 10, 6, 29, 28, 23, 21, 22, 5, 14, 9, 26, 10, 9, 27, 28, 18, 16, 5, -10, -7, -26, -13, 6, -21, -7, 22, 14, -3, 27, -1, 25, 23, 41, 10, 36, 0, 23, 2, 16, 29, 14, 20, 14, 23, 27, 0, 5, -7, -25, 4, -24, -3, -14, 8, -11, -6, -7, 14, 13, 9, 15, 19, 18, 3, 22, 27, 6, 27, 37, 21, 16, -2, -6, 6, 10, -4, 6, -27, -2, 4, -19, -14, -23, -32, -31, -16, -22, -21, -24, 8, -13, -10, 4, 10, 4, 27, 9, 21, 6, 25, 2, -13, -17, -26, -16, -10, -4, -26, 0, -24, -16, -23, -30, -34, -30, -8, -11, 5, 23, 23, 12, 21, 26, 7, 13, -15, -20, -16, 5, -13, -23, -24, -3, 0, 0, -21, -16, -25, -14, -21, -39, -19, -1, -2, 0, 10, 17, -5, 14, 35, 41, 0, 27, -19, 1, 2, -5, -11, -15, -24, 4, -26, -4, -27, -20, -25, -26, -16, -20, -2, -4, -32, -17, 9, -2, -31, 0, -27, -8, -6, 1, -1, -26, 4, -8, -20, 2, -26, -18, 1, -19, -1, -27, -26, -15, -3, -8, -9, -16, -20, -26, 3, 4, -17, 2, -4, -17, -26, -14, -27, -21, -13, -9, -13, 2, 0, -13, -3, -14, 7, 0, -11, 4, 9, -14, -14, -16, -4, 2, -1, -10, -3, -11, 13, -17, -6, 7, 8, 0, -12, 10, -1, 9, -4, 2, 6, -13, -3, -7, 11, 4, -21, 5, 8, -8, 9, 5, -6, -5, -10, 9, -17, 8, -7, 4, -20, -3, 3, 2, -14, -11, 2, -4, 9, -17, 11, -6, -17, -9, -5, -16, -12, 11, 6, 10, 13, -5, -4, -7, 5, -14, -4, 6, -11, 10, 0, -12, -9, 6, -7, -1, -20, -7, -6, -2, -19, 7, 2, -15, 7, 21, 15, 41, 24, 20, 20, 11, 7, 9, -5, 21, 10, -16, -20, 5, -17, -9, -2, -1, -3, 13, 10, -14, -19, 1, -3, -8, 22, 30, 26, 41, 6, 8, 3, -4, -12, -25, -9, -23, -8, -5, -12, -14, -8, 2, 1, -18, -6, -5, -5, -18, -17, 1, 2, 7, 45, 38, 44, 35, 16, 43, 11, 6, 32, 12, 1, -7, 13, 6, 22, -1, -2, -9, -18, 0, -6, -14, -4, -2, 13, 5, -4, 31, 32, 44, 29, 16, 38, 23, 46, 42, 40, 24, 30, 19, 10, 6, 13, -6, 17, 2, -11, -1, 2, -6, 14, 3, -3, 4, -6, 27, 26, 29, 17, 48, 43, 32, 69, 45, 62, 50, 60, 49, 29, 27, 19, -11, -11, 4, 3, -14, 7, -3, -3, 4, -3, -9, -28, -19, -12, -8, -4, -8, 4, 8, 51, 66, 32, 43, 20, 22, 16, 17, 21, -10, -6, -8, -1, 4, -20, -13, -15, 2, -20, -25, -26, -45, -28, -31, -36, -26, -18, -33, 7, 16, 18, 16, 15, -3, 7, 6, 6, -4, -6, 1, 0, 3, 0, 6, -3, 10, -9, -38, -25, -49, -27, -33, -50, -56, -67, -39, -72, -36, -8, -11, -1, -9, 13, -27, -31, -28, -14, -15, -17, -4, 5, 0, 5, -1, -17, -52, -35, -28, -34, -25, -29, -47, -43, -60, -76, -74, -41, -30, -28, -18, 6, -16, -17, -47, -9, -22, -1, -12, 11, 5, -4, -7, -13, -36, -21, -41, -23, -26, -10, -14, -42, -44, -30, -43, -28, -38, -8, -12, -5, -40, -30, -34, -38, -21, -5, 10, -15, -19, -11, -2, -16, -34, -34, -2, -14, 4, 15, -22, -18, -4, 1, -30, -3, -13, -16, -17, -29, -20, -22, -19, -10, -21, 10, -14, -21, -1, -4, 4, -7, -19, 4, 20, 11, 16, 13, -8, -13, 15, -11, 2, 1, -2, 10, -8, 7, -17, -24, -41, -13, -10, -15, 2, 0, 8, 2, -8, -3, -8, 28, 3, 7, 14, -2, 7, -16, -10, -6, 17, 2, 9, -1, -16, -24, -16, -54, -40, 3, 5, -16, -16, 6, 8, -6, 9, -11, 2, 4, 10, 14, 0, 28, 14, -3, 0, -9, -19, -14, -1, 7, -29, -26, -32, -23, -43, 0, 19, -9, 0, 9, 13, -9, 22, -2, 3, -22, -12, 18, -10, 22, -14, -12, -13, -9, -16, 5, 5, -9, -16, -33, -33, -27, -33, -8, 0, 15, -16, 10, 9, -10, 7, -8, -27, -2, 1, 16, -15, 1, -30, -30, -23, -24, 13, -5, 22, 5, -18, -31, -21, -18, -23, 10, 7, 2, -13, -12, 0, -19, -11, -4, -12, -14, 19, 10, 1, -14, -1, 6, 13, 4, 32, 34, 19, -15, 8, 12, 1, -25, -19, 0, 14, -9, -13, -7, -11, -6, -7, 14, 12, -18, 8, -5, 3, 15, 16, 23, 38, 44, 38, 22, 23, 12, 14, 10, 3, 18, -15, 9, -13, -14, -15, 5, -12, 5, -2, 15, 5, -27, 14, 1, -10, 25, 34, 53, 21, 38, 34, 43, 28, 8, 39, 28, 26, 28, 30, 26, 1, 14, 7, -13, 8, -13, 6, 1, -11, -16, 1, 7, 23, 27, 11, 28, 11, 16, 5, 19, 27, 10, 28, 19, 27, 25, 19, 16, -6, -17, -13, 13, 8, 6, -7, 8, 9, 28, 28, 18, 22, 27, 39, 23, 5, 15, -5, 7, 18, 10, 9, 8, 9, 17, 16, 0, 10, 11, -12, -15, -6, -2, -2, 16, 29, 8, 19, 6, 18, 8, 15, -3, -8, -2, 4, -22, 23, -12, 0, -16, -2, 1, -15, 19, -16, 1, -3, 0, -3, -6, 3, 9, 17, -10, 3, 16, 34, 11, 12, 15, 13, -9, 10, 6, 4, 18, -8, -5, -10, 1, 6, -15, -12, 1, -4, 2, -3, -20, -3, -9, -28, -10, 4, -6, 19, -4, 5, -5, 21, 21, 27, 28, -4, 8, 7, -10, 5, -9, -14, -12, -2, -5, -2, -20, 12, -12, -17, -20, 8, -13, -20, -1, 3, 11, -8, 13, -19, -20, 13, 10, -12, 5, 4, -19, -4, -19, -21, 6, -16, -11, -12, 23, 5, 20, 11, 3, 12, 1, 14, 15, 1, -10, 15, 12, -3, 18, 2, 7, -1, -4, 4, 5, 4, 3, -1, 18, -5, -5, 21, -8, 19, 5, -2, -10, 23, 20, 5, 14, 6, 22, 0, 0, 1, -3, 3, 4, -5, 5, 3, 16, -1, -2, 0, 19, 14, -2, 21, -7, 16, 10, 20, 0, 9, 22, 17, 2, 10, 5, 13, -12, -12, -12, -6, -4, 7, -10, -6, 2, 8, 2, -6, 4, -3, -6, -6, 14, -3, 4, -8, 20, 0, 20, 7, 8, -17, -24, -25, -8, -33, -16, -44, -39, -18, -35, 1, -13, -22, -8, -1, -5, 0, -7, 8, 14, 14, 1, -3, 15, 23, 0, 19, 8, -11, -8, -28, -34, -42, -51, -24, -15, -26, -29, -5, -2, 12, 6, 0, -14, -6, -12, 6, 20, 18, 11, -9, 11, 23, -1, -9, -24, -18, -29, -7, -28, -34, -21, -4, -1, -36, -21, -23, -8, 2, -12, 19, 10, 15, -13, 5, 18, 0, -4, 21, 14, 15, -6, -32, -7, -31, -23, 0, -27, -11, 6, -14, -2, -4, -3, -44, -11, -16, -2, 8, 4, -1, 20, 20, 4, 19, 3, 8, 9, 6, -19, -35, -7, -35, -7, -31, -21, 9, -6, 17, -5, 17, -15, -1, -10, -11, -1, 5, -10, -20, 3, -6, 18, -6, 5, 11, -21, 4, -18, -13, -28, -38, -17, -7, -20, 3, 16, -6, -15, -10, -21, -48, -46, -34, 5, -15, 2, 4, 13, 1, 8, 14, -1, -7, -8, -8, -43, -45, -32, -1, 9, -9, -11, 13, -13, -1, -8, 3, -2, -36, -37, -40, -25, -25, -8, 2, 5, -4, 5, -6, -9, 8, -5, -30, -26, -30, 13, 15, -5, 4, 4, -10, 5, 24, 7, 15, -19, -23, -51, -42, -4, -28, -19, 3, 5, 20, 4, 6, -21, -3, -25, -49, -42, 6, 7, -7, -5, 13, -10, -6, 20, 35, 23, 10, -3, -5, -19, -32, -26, -40, -8, -19, 1, 6, 0, -8, 6, 1, -27, -25, -27, 13, 25, 25, 28, 5, -7, 11, 22, 47, 23, 40, 13, -11, -30, -28, -37, -9, -18, 11, -11, 20, 19, 0, 16, -18, -6, -33, -23, 3, 26, 13, 11, -13, 17, 21, 36, 40, 53, 49, 31, 0, 1, -19, -8, -2, -16, -19, 14, 10, -10, 14, -3, 8, -17, -11, -7, -3, 36, 9, 30, 23, 22, 18, 28, 19, 25, 25, 32, 2, -40, -40, -33, -13, 1, 0, -3, 12, 20, 16, 11, 19, 17, -24, -30, 2, 3, 32, 16, 11, 17, 31, 7, 36, 55, 33, 15, -37, -68, -42, -8, -11, -23, 7, 2, 0, 24, -10, -1, 4, 2, -1, -35, -15, -5, 5, 3, 5, 25, 15, 27, 18, 11, 1, -37, -60, -48, -21, -30, -23, -10, 13, -13, -6, -6, -8, 9, 8, 6, -28, -25, -34, 0, -19, 13, 3, -2, 32, 32, 0, -15, -39, -48, -68, -41, -39, -42, -9, -23, 0, 14, -11, 7, 4, 5, -5, -14, -7, -35, -29, -15, -34, -9, -21, 0, 7, 14, -9, -36, -39, -60, -48, -44, -32, -27, -27, -1, 2, -2, 6, 21, 12, 17, 13, -22, -15, -37, -24, -33, -48, -23, -15, -32, -11, 10, -29, -43, -31, -54, -59, -51, -16, -30, -13, -14, 18, 0, -5, 15, 11, -12, -10, -8, 2, -11, -29, -29, -14, -26, -8, -28, -26, -27, -14, -9, -9, -20, -52, -34, -5, -30, -4, 15, -1, 8, 10, -5, -7, 9, 7, -5, 11, -33, -6, -32, -13, -9, -32, -40, -42, -10, -6, -12, -29, -15, -29, -25, -6, -29, -11, 1, -4, 8, -9, -9, 12, 14, -5, 9, -8, 4, -16, 3, -21, -6, -27, -15, -34, -34, -15, -20, -4, -4, -6, -19, -22, -15, 14, 1, 11, 5, 22, -1, 12, 7, 13, -19, 3, -1, -8, -10, -4, 7, -23, -1, -27, -19, -8, -1, 32, 1, -6, -6, 0, 1, -3, -9, -3, 16, 2, 2, -10, 5, -3, -6, -9, -6, 18, -2, -4, -17, -11, -37, -27, -23, -7, -3, 24, 32, 22, 19, 17, -5, 21, 20, -9, 23, 0, -6, 16, 8, 7, 1, -6, -2, -10, -3, 5, -26, -11, -44, -32, -8, 1, 28, -5, -8, -23, 6, 7, 11, 14, -6, 11, 8, 15, 18, 18, 15, 19, 15, 4, 17, 30, -1, 27, 6, 14, -2, -9, 24, 2, 18, 9, 8, -15, 18, 0, -10, -1, -2, 0, 22, -3, 6, 9, 15, 10, 15, 21, 2, 0, 19, 18, 2, 8, 6, -14, 20, 5, 13, -2, 5, 10, 5, 15, 19, 16, -6, -6, -6, 20, -3, -14, -8, -10, 5, -19, 6, -16, -1, -17, 6, -1, -14, 5, 7, -3, 2, -12, 8, -7, 9, 14, -9, 12, 13, 2, 13, 3, -17, -12, -16, 6, 10, -4, 16, -14, 10, -9, 1, -8, 15, 5, -2, 12, -17, -3, 10, -4, -7, -12, 4, 3, -4, 2, -4, 0, -2, 8, -3, -2, 0, 15, 11, 8, 15, -11, -11, -4, 9, -17, -21, -20, -18, -4, -19, 9, 8, 13, -17, -1, -6, -2, 6, -5, -18, -6, -14, 9, 6, -19, 5, -16, -6, -2, -8, -5, -14, -22, -23, -6, -25, -14, -10, -20, 9, 0, -9, -7, -3, -6, 9, -5, -15, 5, -5, -11, -8, 0, -16, -11, -19, -5, 6, -20, -18, -19, 1, -5, 10, 9, -1, -4, -12, -10, -13, -7, -13, -10, 7, -4, -6, 2, 12, 9, 4, 2, -13, 4, 14, 10, 0, -7, -5, 8, -10, 9, -10, 6, 3, -3, -8, 7, 14, 15, 24, 10, 2, -10, -6, -18, 5, 4, -2, 21, 25, 34, 13, -8, -11, 4, -6, -3, -20, 0, -22, -29, -5, -11, -13, -10, 7, 18, 43, 14, -3, 6, -9, 8, 10, 0, 1, 14, 14, 38, 27, 8, -13, -33, -2, 1, -7, -4, -2, -3, 18, -14, -2, 19, 26, 10, 43, 37, 0, 1, -17, -15, 4, 18, 8, 30, 36, 38, 21, -4, 6, -6, 1, -8, -4, 26, 17, 32, 5, 28, 20, 39, 34, 51, 42, 13, 3, -15, -1, -12, -10, 8, 12, 14, 14, 36, 12, 2, 2, 2, 9, 19, 26, 24, 45, 48, 29, 34, 33, 17, 44, 46, 19, 16, 27, -9, 14, -5, 15, 8, 26, 18, 32, 34, 33, 33, 18, -2, 31, -5, -1, -10, 6, -3, 24, 11, 32, 39, 17, 3, 9, 22, 25, -5, -1, -17, 15, -3, 28, 32, 16, 20, 18, 22, 11, -1, 8, -22, -50, -47, -37, -13, -22, -4, -27, -25, -27, -23, -13, 3, 9, 3, -2, 3, 12, -16, 8, 19, 23, 32, 34, 25, 22, 2, -11, -30, -42, -57, -50, -36, -21, -31, -36, -50, -63, -68, -12, 1, -4, -11, 12, -1, 11, -9, -11, 19, 22, 22, 17, 26, -7, -28, -31, -33, -44, -42, -43, -14, -15, -41, -30, -34, -46, -61, -22, -15, 2, -9, 10, 11, -7, 7, -5, 0, 16, 10, -1, 5, -8, -43, -64, -22, -11, -23, -48, -34, -45, -51, -38, -38, -20, -26, -29, -18, 15, 4, -7, -3, 9, -13, -2, -7, -21, -3, -4, -18, -47, -46, -55, -17, -5, -19, -17, -45, -57, -47, -60, -32, -55, -13, -20, -5, 14, -8, 8, 5, -10, -8, -29, -37, -38, -58, -48, -22, -63, -74, -38, 12, 12, 5, -19, -12, -42, -25, -40, -39, -30, 8, -7, -1, -12, -10, 8, 11, -13, -20, -10, -43, -48, -72, -61, -55, -45, -26, 0, 23, 30, -3, 11, -7, -25, -29, -34, -21, -18, 11, 10, -3, 3, -10, 12, 4, 1, -7, 3, -15, -50, -47, -70, -44, -37, 4, 33, 45, 21, -8, -1, -11, 8, -2, -29, -19, -4, 15, 30, -1, 10, 17, 11, 1, -3, 8, -5, -11, -23, -26, -39, -40, 2, 15, 49, 44, 36, 1, 18, 4, 6, 4, -6, 16, 4, 4, 26, -1, -10, 11, -1, 9, -19, -9, -13, 6, 0, -22, -11, -13, 6, 43, 45, 39, 22, 6, 23, 18, 5, 11, 16, 30, 36, 8, 13, -13, 13, -4, 16, -11, -4, 10, -17, -15, -25, -9, 1, 10, 22, 20, 31, 14, 20, 19, 13, 17, 40, 12, 39, 18, 39, 9, -4, -9, 10, -10, 16, -1, -11, 1, 8, -12, -8, 6, 4, 14, 7, 23, 10, 18, 47, 22, 22, 32, 19, 35, -2, 18, 29, 21, 16, 18, -16, -17, 14, 4, 2, 1, 5, 11, 18, 11, 1, 22, 2, 18, 29, 21, 39, 26, 9, 28, 8, 27, 4, 25, 7, 15, 0, -4, 12, -9, 6, 5, 7, -8, -10, -12, -21, -5, -10, -5, 4, -14, 8, 29, 16, 20, 4, 29, 37, 48, 0, 8, -6, -3, 9, -10, -3, -18, -6, -12, 14, -8, 7, -22, -21, -25, -34, -34, -29, -24, -2, 10, 23, 14, 14, 29, 13, 26, -3, -2, 6, 10, -10, 15, -5, 9, 6, 2, 16, 0, -8, -24, -6, -22, -9, -38, -23, -30, -3, -10, -30, -21, -33, -5, -21, -2, -21, -16, -16, -7, -3, 7, 6, -5, -5, -4, 11, -1, -3, -2, 9, -8, -1, -13, 14, 9, 8, -8, -6, 8, 11, 12, 0, -12, 6, 4, 8, 1, 0, 2, -13, -18, 2, -22, -18, -20, -20, 4, 1, -17, -11, -15, 3, -20, -20, -8, -11, -5, -22, -22, 3, -13, -3, -24, -9, -5, -9, 7, -21, 1, -12, -16, -2, -18, -2, 1, 5, 0, -15, -8, -12, -21, -2, -10, -16, 6, 4, -21, -22, 9, 0, -18, 7, -5, -10, 0, -24, 3, -6, -21, -20, -8, -9, -12, -15, -15, -11, -14, -7, 9, -5, 2, -12, -3, -2, -14, 1, 9, 0, -16, -14, 7, -14, 1, -6, 5, -10, -14, -9, 4, -5, -22, -20, -22, -16, 5, -8, -12, -9, 2, -24, 5, -21, 0, 9, 20, 4, -11, -12, -8, -18, -15, -16, 8, 1, -10, -12, -9, -15, 3, 5, 12, 9, -7, 9, 8, -6, -11, -25, -11, -15, -13, 5, -26, -1, -22, -29, -28, -17, -12, -18, 9, -2, 10, -24, 1, 12, 14, 12, 25, 15, 19, 1, 4, 18, 9, -23, -13, -19, -23, -10, -26, -27, -13, -30, -28, -23, 8, -7, -6, -19, -8, -1, 4, 6, 14, 28, 12, 12, 31, 28, 5, 35, 18, 0, 8, 18, 20, 24, 16, -5, -5, -15, -15, -4, 2, -10, 7, 0, 4, -13, 2, 6, 14, 21, 0, 20, 3, -3, 7, 19, 20, 36, 17, 27, 25, 3, 5, -10, -19, -29, -21, -9, -16, -17, -11, -8, 8, -9, -5, -4, 5, 3, 14, 18, 26, 19, 2, -9, 22, 11, 16, 31, 3, 3, 15, 6, -7, 2, -19, -7, -14, -23, -5, -8, -16, -6, 18, 6, 20, 12, 16, 10, 9, 12, 15, 13, 15, 6, 22, -1, 16, 2, -6, -11, 15, 4, -20, -17, -2, -14, -18, -19, -19, -15, 14, 8, 25, 33, 24, 35, 6, 7, -2, -8, 0, -6, 1, 9, 16, 21, -4, 3, -8, 3, 9, -6, 1, -6, -7, -16, -17, -12, 2, 32, 7, 7, 10, 23, 22, -5, -4, -9, 17, -9, 30, 18, 32, 23, 9, 18, 17, 6, 1, -1, 7, -7, -5, -13, 7, 4, 9, 2, 9, 15, -4, 23, -10, 15, 16, 3, 2, -6, 30, 31, 5, 17, 32, 2, -8, -4, -23, -36, -24, -14, 9, -19, -5, -8, 10, 11, 4, -10, 9, 21, 0, 19, -2, -1, 5, -3, 22, 1, 9, 24, 32, 25, 19, 5, -41, -27, -20, 1, -3, -10, -19, -11, 12, 11, -11, -19, 13, 3, 7, -8, 14, 5, -12, -5, -8, 17, -7, 21, 15, 45, 11, 2, -2, -32, -8, -27, -21, -1, 3, -11, -17, -14, -22, -20, -23, -7, 3, 8, 18, -17, -3, -16, -5, 10, 8, 3, 39, 46, 27, 5, 8, -13, -14, -10, 10, -8, -9, 0, -6, 2, -17, -34, -32, -5, -26, -6, 7, -16, 5, -33, -44, -14, 7, 6, 33, 14, -1, -7, -15, -9, -43, 0, -2, 0, -22, 5, 14, -13, -6, -8, -9, -14, -2, -14, -18, -16, -20, -31, -20, -17, 9, 8, 32, 11, 22, 0, 9, -32, -21, -7, 2, -9, -14, 7, -5, -14, -17, -4, -7, -19, -23, -5, 2, -13, -22, -36, -20, -4, 9, 17, 18, 23, 3, 11, -32, -41, -26, 5, -19, -20, -10, -17, 5, 11, 5, 6, -16, -3, -4, -26, -5, -28, -33, -29, -35, 8, 22, 3, 27, 4, -4, -16, -14, -24, -10, -15, -19, -6, 1, -6, 0, -9, 2, -2, -11, -7, -15, -29, -28, -45, -33, -26, -27, -3, 19, -13, 9, 22, -20, -25, -8, -28, 7, -23, -4, -19, -13, 7, -19, -12, -8, -18, -2, -29, -30, -24, -30, -10, -21, -12, -1, 15, -3, 9, -9, -14, -21, -33, -20, -18, 1, 7, -20, -21, -16, -15, -14, 7, -21, -30, -5, -5, -16, -27, -3, -12, -15, 13, 13, 20, 11, 8, 5, -10, -20, 2, -15, -10, -3, -1, -14, -3, -13, -21, 13, 1, 25, 25, -8, -5, 0, 2, 0, -6, 7, -4, 15, 8, 11, 5, -21, -4, -13, -2, -5, -1, -22, -14, -20, -10, -19, 7, 3, 3, 41, 29, 33, 30, 18, 27, 21, 21, 12, -1, 34, 11, 31, -4, 11, -9, 8, -8, -1, -2, 6, -16, -15, 5, 1, 10, 7, 2, 8, 13, 43, 23, 17, 28, 11, 23, 11, 8, 12, 39, 26, 38, 46, 28, 29, 1, 10, -3, -4, 3, -12, -6, 11, -3, -6, -17, -3, 7, -8, 2, 25, 18, 45, 32, 57, 41, 45, 30, 46, 46, 30, 14, -5, 13, 4, 8, -11, -12, 3, -11, -3, -23, 0, 3, 3, -10, -17, -1, 9, -4, -18, -20, -11, -13, 3, 3, 5, -13, -17, -12, 9, -21, -17, -17, -5, -2, 6, 4, -13, -15, -6, -10, -2, 2, 3, 15, -1, 11, 12, -5, 4, -5, 6, -3, 15, -7, 6, 1, 10, 15, -10, 16, 8, 7, -11, -13, -5, -12, 14, 7, 12, -16, 13, 16, 2, -15, -4, 13, 10, 15, 3, 17, 7, -13, 7, 11, 6, -15, 14, 7, 13, -14, -12, -13, 10, 7, 12, -6, 17, -11, -7, 0, 3, -3, -9, 15, 14, -7, 14, 22, 3, 21, 28, 2, -7, 11, 8, 11, -7, -15, 2, -9, 17, -10, 1, -12, -13, 7, 13, 6, -1, 3, 7, 17, 8, 18, 11, 28, 3, 12, 21, 38, 17, 16, -15, 10, -1, 14, 1, -10, 0, 16, 7, 13, 24, 12, 12, 14, 10, 14, 14, 14, 12, 10, 27, 16, -1, 26, -7, 7, -13, -2, -7, -5, -1, -13, -2, -1, 13, -7, 12, 2, 16, 5, -16, -25, 6, 10, 27, 10, -2, 4, 27, 28, 3, 0, -4, -17, -11, 18, 1, 0, 12, -5, -15, -13, -6, 9, -6, 3, -14, 2, -10, -24, -9, -10, 13, 2, 18, 0, 17, 19, -12, 7, -2, -13, -4, 14, 25, 24, 22, 4, -3, -6, 3, 0, 11, -7, -11, -28, -33, -17, -22, -25, -16, 11, 5, 15, 18, -2, -1, -2, 2, 8, -3, 21, 18, 24, 23, 7, 15, 17, 13, -2, -4, 1, -27, -36, -17, -14, 4, -6, 5, -14, 2, 15, 6, 7, -5, -16, -19, -9, 4, 4, 5, 29, 28, 9, 14, 10, 7, 10, 4, -1, -20, -6, 5, 2, -5, -12, -4, -22, 14, 14, 13, 15, -32, -22, -36, -28, -22, 15, 7, 39, 19, 3, 6, -2, 2, -2, 15, 11, -2, -11, -2, -15, 4, 5, -10, 10, 26, 37, 11, -7, -20, -6, -29, -6, -30, -21, -6, 32, 39, 23, -10, 16, 6, 10, -9, -3, -3, -27, -8, 5, -4, -1, 12, 17, 18, 35, 1, 20, -22, -22, -2, -11, -15, -14, -36, 3, 2, -8, 3, 18, 9, -2, 3, 6, 5, -22, -26, 8, 4, 3, 37, 28, 15, 30, 10, -24, -14, -8, -19, -29, -8, -38, -32, -29, 8, 0, 6, -1, -5, -12, 7, -1, -8, -9, -23, 8, -5, 7, 20, 23, 17, 6, -14, -25, 1, -20, -22, 11, 5, -29, -29, -7, -12, 15, 18, -12, 2, 11, -12, 8, -11, -16, -34, -36, -19, -26, -16, 1, 6, -12, -7, -16, -23, 5, -12, 2, 19, -20, -10, -1, -14, -16, 9, 17, -15, 19, -3, -9, -7, -41, -64, -65, -78, -44, -34, -7, 0, -6, -41, -9, 2, 9, 24, 11, 11, 18, 12, 0, -19, 13, -12, 8, 6, 3, 20, -4, 4, -18, -38, -74, -81, -68, -51, -34, -26, -19, -27, -4, -11, 10, 20, 13, 27, 11, -17, -14, -6, 5, 16, 6, 1, 7, 22, 2, 6, -4, -40, -59, -52, -58, -57, -65, -50, -10, -28, -21, 18, 4, 3, -3, 20, 5, -31, -32, -1, 12, -1, -12, -5, 16, 41, 40, 23, 15, -28, -15, -51, -61, -59, -67, -39, -6, 14, 7, 27, -2, 19, 15, 25, -13, -33, -12, -23, -5, 8, -15, -13, -1, 21, 36, 19, 17, -3, 17, -31, -39, -15, -3, 24, 19, 26, 26, 6, 40, -8, 10, -1, -14, -1, -17, -19, 15, -10, -14, 6, -4, 22, 15, 29, 45, 25, 38, 17, 8, 16, 46, 32, 45, 32, 23, 33, 30, -1, 12, -13, -18, 0, 6, 4, 15, 7, -14, -2, -4, 3, 15, 26, 21, 51, 45, 43, 52, 33, 41, 32, 33, 37, 18, 9, 2, 19, -10, -30, -37, -29, 3, -4, 13, -6, -6, -1, 3, 12, 39, 23, 2, 10, 21, 20, 28, 18, 1, 8, 16, -6, -6, 9, -15, -12, -5, -18, 4, -1, -12, 6, 1, 3, 0, 8, -1, -5, 9, 20, 1, -26, 12, 13, 35, 33, 26, 13, 11, 21, -9, -5, -12, -13, -7, -18, -11, 8, -8, -18, 2, 16, -15, -7, 18, 16, 3, 24, 17, -2, 9, 20, 19, -9, -8, -6, -20, -14, -20, -7, -23, -6, -10, 0, 3, -14, -10, 4, -15, -11, 3, -10, -11, 11, 6, 4, 22, 19, 14, 3, -3, -1, -7, 8, -2, 1, -12, 5, -8, -16, -17, 9, 10, 4, 14, -3, -4, 1, 12, -5, 5, 1, -5, 11, 0, -4, -2, 6, -11, 4, -14, 6, -8, 3, -9, 0, 6, 14, -6, 0, 5, -10, 5, -12, -13, 14, 13, 3, 8, 4, -8, 8, -4, -3, 0, 4, 7, -3, 11, 4, 16, -3, 14, 4, 14, 15, -1, -10, -6, 15, -13, 13, -15, 18, -8, -14, 2, -6, -9, -13, -14, 1, -6, 14, -17, -15, 3, 15, -13, 0, 1, 9, -8, 11, 13, 13, 5, -4, 11, -14, -5, 4, -3, -12, 6, -16, 7, -2, 12, -19, -20, -2, -16, 0, -5, 3, -9, 5, -15, -10, 0, 7, -12, 8, 3, 13, -9, -2, 4, 13, 0, -9, -7, -10, -4, -16, -6, -6, -7, 6, 7, -3, 0, -8, -14, -25, 5, -9, 2, -20, -20, 2, 2, 13, 0, 6, -9, 5, 4, -1, -13, -19, -17, -11, 7, -20, -13, -17, 15, -8, -5, 9, -13, -25, -21, 3, -4, -1, -9, 1, 0, -18, -8, -14, -7, 0, 15, 9, -14, 10, -18, -21, 6, -4, -22, -6, -20, -14, 5, 4, -17, -3, -16, -6, -25, -10, -43, -33, -23, -35, -8, -4, -14, -10, -8, 14, -9, -4, 0, 0, -15, -22, -5, -11, -21, -7, -6, -13, -14, -10, -3, -35, -21, -57, -30, -55, -35, -42, 1, -17, -10, 2, 15, -15, 2, 5, -3, 21, 24, -5, 23, 4, 14, 10, -17, -10, -12, -23, -30, -28, -49, -47, -43, -31, -1, -4, 8, 3, 10, -20, -1, -7, 13, 14, 9, 2, 1, 14, -3, 16, 16, -2, -13, -9, 4, -22, 7, 3, -4, 3, 0, 29, 23, 22, 20, 1, -13, -15, 11, -4, -8, 1, -20, -8, 12, 1, 15, 31, 12, 10, -5, -1, 5, 2, 7, 5, 28, 26, 45, 49, 19, 39, 34, 28, 9, -11, 15, 9, 2, 1, -12, -3, 5, 5, 9, 11, 20, 24, 32, 34, 47, 35, 43, 43, 39, 44, 10, 33, 39, 7, 33, 42, -3, 14, 13, 8, -13, -17, -13, -26, -7, -12, 7, -6, 37, 34, 39, 40, 13, 30, 15, 11, 18, 23, 38, 30, 20, 17, 36, 40, -1, 11, 14, -5, 17, 0, -23, -39, -37, -20, -4, -2, 6, 9, -5, -22, -27, -13, -7, -34, 7, -6, -22, 5, 3, -2, 2, 12, -9, -3, 12, -9, -17, 0, -52, -37, -60, -29, 0, -11, -2, 8, -15, -26, -34, -42, -31, -43, -23, -26, -54, -37, -51, -33, -32, 11, 2, 1, -18, -14, -5, -8, -53, -58, -50, -10, -8, 11, 31, -4, -14, -13, -6, -26, -32, -28, -6, -40, -56, -39, -48, -40, -21, 25, 11, -12, 14, 9, -2, -21, -10, -53, -22, -1, 6, 19, 11, -4, 8, -14, -7, 6, 1, 28, -15, -27, -47, -32, -27, -20, 5, 4, -4, -14, -18, 6, -6, -22, 5, -11, 13, 32, 19, 29, 23, 2, 4, 7, 5, 13, 31, 10, 13, -11, -33, -25, -27, -9, 21, 23, -10, -8, -17, 15, 8, -14, 14, 6, 43, 26, 24, 21, 16, 15, 0, 12, -11, 34, 34, 21, 16, 2, 5, 32, 11, 24, -4, 16, -2, -16, -10, 9, 1, 3, 27, 43, 37, 13, 25, 47, 35, 27, 8, 0, 9, 25, 10, 7, 12, -15, 13, -10, 14, 33, 0, 10, 5, 8, -3, -4, -10, -5, 23, 52, 40, 45, 15, 7, 26, -6, -7, -2, 11, 5, 11, 6, 9, 10, 6, 12, 11, 23, 21, 2, 15, -4, -14, -6, 13, 6, 17, 13, 8, 26, 18, -4, 5, -12, -12, -20, 2, -4, -2, -20, 7, 12, 22, -1, 16, 21, 8, 26, 18, -9, -1, 14, 10, -5, -18, 22, 15, 4, 5, -12, -31, -7, -20, -9, -8, -22, -25, -24, -14, -13, 16, 18, 13, 29, 27, 2, 11, 13, -2, -8, -2, 11, -6, 13, -12, -32, -30, -19, -39, -6, -23, -12, -30, -26, -4, -23, -4, -7, -12, 12, -12, 8, 22, 24, 3, 3, -18, -14, -17, -11, -9, -7, -32, -45, -24, -18, -8, -5, -16, -38, -20, -18, -20, -17, -9, -16, -30, -23, -18, 10, 25, -9, 11, 3, -10, -12, 14, 9, -5, 2, -11, -32, -21, -6, -9, 6, -13, -15, -20, -25, -24, -42, -24, -36, -15, -4, 13, 6, -2, 14, 16, -18, -2, 11, -16, 6, 13, -8, -5, -3, 4, 14, 0, -11, -12, -10, -22, -14, -14, -9, -16, -15, 3, 4, 15, -8, 8, 11, -7, 10, 5, -11, -1, -2, 11, -16, -22, -19, -18, -16, -10, 6, 11, -14, 3, 3, -2, 0, 11, 14, -16, 13, 2, -10, 19, -1, -2, 10, -10, 3, 12, -2, -5, -18, 4, -17, -16, -13, -1, 19, -6, 20, 13, 4, 11, -10, -7, 23, 16, 1, 9, -3, -9, 14, -10, 13, -16, 3, 9, -13, -10, 13, -6, 3, 8, -15, 16, -2, -8, 16, 6, -10, -3, 2, 13, -15, 13, 12, -4, -4, -16, -15, -12, -4, 9, 14, -13, -3, 4, -6, -2, -1, -17, -12, 2, 10, -5, -16, -16, -14, 7, 7, -6, 6, -15, -10, 15, 14, -10, -5, 7, 5, -9, 7, -7, -2, -11, 7, -14, 3, -10, 10, 2, 6, 18, 13, 9, -6, -2, -17, -8, -12, 2, -18, -4, 13, -8, -14, -18, 3, -16, -14, 8, -2, -2, 1, 12, 12, -10, 4, 22, 10, 22, 22, 18, 10, 26, 8, 13, 5, 3, -5, -4, 0, 5, -13, -18, -4, -3, -4, -11, 5, -13, 8, 20, -9, 20, -7, 13, 4, 12, 29, 27, 13, 19, 22, -9, 20, 14, -15, -13, -5, -6, -1, 10, -4, -4, 8, -17, -2, 13, 18, 7, 6, 9, 5, 2, 1, -8, 5, -18, -33, -7, -13, -17, -12, -1, -15, -8, -11, -2, 16, -3, -14, -6, 15, 10, -1, 14, 25, 18, 11, 28, 20, 1, -6, 5, -4, -6, -11, -10, -12, -25, -22, -11, -14, -23, -9, -4, 2, 4, -8, -14, 3, -15, 2, -1, 26, 12, 11, 8, 0, -2, 11, -16, -8, -26, -17, -5, 19, 0, -6, -7, -5, -34, -16, -6, -22, 6, -7, -16, 12, 17, -1, 28, 20, 14, 5, 15, 3, -19, 2, -13, -18, -30, -15, -20, -21, 8, 14, -1, 12, -23, -14, -28, 2, -3, -12, -18, -3, 22, 21, 39, 8, 8, 42, -3, 2, -3, -15, 7, -13, 10, 1, -14, -17, -2, -16, 2, 0, -20, -22, -29, -4, 2, -13, 8, 6, 21, 23, 19, 14, 26, 7, -5, 6, 0, -19, 1, -3, 26, -7, 16, -10, 2, -4, -1, 2, 18, -1, -13, -14, 8, 13, -3, 17, 26, 26, 38, 18, 22, 11, 24, 8, -5, 15, 12, -1, 20, 12, 0, -8, -15, 9, 20, 16, 22, 1, -9, -25, 6, -4, -14, 1, 31, 35, 22, 27, 4, 29, 9, 11, 29, 37, 9, -6, -1, 0, 4, -13, 18, -12, 0, 23, 7, -4, -17, -4, -17, -9, -13, 20, 28, 36, 20, 12, -15, 21, 11, 26, 7, 22, -5, -52, -21, -28, -11, -16, -15, -19, 20, 26, 31, -7, -5, 7, -25, -9, -13, -2, 21, 8, 0, 21, 13, 14, 11, 17, 1, -4, -30, -45, -30, -11, 1, 10, -2, 9, -1, 22, 1, 6, 1, -13, 11, 1, -3, 6, 14, 1, -13, 14, 0, -24, -13, -13, -6, -14, -43, -35, -3, 0, -3, 17, 24, 27, 22, 19, 22, 36, -4, -12, 0, 3, -9, -4, -11, -14, -36, 2, 7, 6, -15, -12, -52, -45, -66, -24, 40, 23, 11, 15, 25, 27, 21, 7, 7, 20, 0, -22, -11, -12, 11, -5, 1, -17, -19, -16, -1, -10, -36, -46, -75, -60, -37, 15, 41, 38, 28, 15, -1, 19, 23, 30, -13, -16, -6, -14, -5, -1, -14, -16, -7, 5, -15, 6, -26, -23, -46, -66, -111, -59, -24, 23, 52, 25, 41, 49, 27, 2, -3, 2, -14, -8, -17, -9, 3, -2, 13, -17, 3, -16, -5, 1, -21, -43, -52, -69, -91, -46, 28, 58, 52, 19, 36, 34, 24, 13, 5, -15, -16, -32, -22, -15, -12, 6, -6, -5, -9, -8, -22, -9, -27, -43, -23, -45, -40, -24, 49, 33, 21, 47, 21, 44, 27, 14, -6, -29, -32, -35, 5, 1, 0, 9, 1, -8, -3, 7, -11, -26, -40, -16, -30, -37, -18, -19, 45, 25, 43, 44, 29, 9, 2, -10, -9, -28, -20, -11, 4, 7, -2, 9, 12, -11, -15, -18, -35, -13, -6, -22, -23, -8, -30, -12, 22, 10, 23, 20, 19, 35, 9, 6, -19, -22, -30, -20, 5, 8, 13, -12, -15, -1, 10, 8, 0, 3, -25, -13, -25, -25, -13, -25, -20, -5, -11, 30, 2, 19, 16, 26, -12, -21, -23, -35, 3, -5, -12, -1, -9, -1, 12, 5, -15, -4, -1, -23, -27, -29, -47, -29, -16, -30, 8, 20, 8, 8, 13, 1, -19, -20, -26, -28, -5, 9, -17, 0, 2, 5, -1, -5, -7, 14, -8, -10, -17, -17, -38, -27, -9, -2, 22, 8, 29, 10, -2, 11, -10, -22, -15, -32, 6, -2, 15, 11, -3, -12, 8, 14, -2, 4, 9, 2, -5, -6, -24, -1, 10, 15, 19, 30, -4, 2, -11, 6, -1, -19, -21, 5, -8, -10, -3, -9, -8, -10, 4, -7, -3, -4, 1, -2, 2, 1, 1, 3, 0, 11, 4, 7, 28, 12, 13, 27, -16, -16, -16, -3, 11, -10, 16, -4, 4, -2, 2, -15, -16, 0, 13, 10, -3, -6, -9, 5, 11, 22, 25, -4, 21, -2, -5, 7, 13, 3, -8, 14, 9, -14, 8, -18, 2, -8, -17, -16, -4, -7, 1, 6, 8, 8, 0, 11, 3, -16, 11, 11, 9, 12, -3, 12, -6, 10, -19, -6, -20, -11, -16, 1, 1, -13, 2, 8, -12, 9, -13, 12, 0, -2, 11, 10, -11, -21, -20, -1, 6, 10, 8, 7, -10, -13, -11, -18, -12, -11, -11, 3, -11, 5, -3, -21, -1, 11, -18, -18, -7, 6, -11, 2, -18, -14, -18, -5, 7, -12, 4, -12, 0, -8, -7, -19, -21, 4, 4, -19, -17, -12, -8, -8, 5, -18, 11, 6, -12, 21, 4, 11, 16, 17, 32, 35, 5, 3, 5, 20, 2, -1, -21, -7, 1, -1, 10, 1, 6, -15, -11, -7, -14, -20, 9, -3, 7, 21, 31, 29, 31, -1, 14, 24, 13, 2, -3, -4, 13, 24, 19, 3, 4, 8, -16, 6, -21, -6, -21, 11, -22, -6, 16, 13, 17, 18, 34, -3, -5, 9, 5, 17, -1, 8, 19, 4, 13, -8, 22, 3, 6, 16, -5, 8, -20, 4, 0, -7, 12, 9, 10, 31, 27, 15, 6, 1, 15, 10, -5, 22, 9, 27, 22, 24, 27, 33, 8, -7, -5, 9, -6, -8, -20, 4, -3, -8, -16, 15, 20, -2, 2, 12, 20, 12, 7, 15, 27, 29, 20, 44, 50, 46, 44, 16, -13, -21, -14, 21, 15, 11, -7, -20, -17, -6, -6, 6, 1, 15, 0, 15, 5, 14, 22, 45, 47, 17, 27, -2, -5, -6, 2, -2, -14, -13, -16, -17, 12, -1, 3, 11, 3, 1, -16, -14, -12, 25, 13, 27, 19, 25, 25, 19, 12, -36, -52, -74, -55, -37, -47, -36, -3, -14, -5, -21, 2, -6, -14, -6, 7, 18, 5, 15, 2, 12, 12, 24, -7, 10, 0, 6, -29, -34, -76, -77, -30, -44, -28, -48, -34, -47, -35, -5, -1, -6, 7, -7, 14, 16, 19, -6, -12, -13, 5, -7, -1, 2, -7, 2, -22, -34, -34, -17, -6, -7, -50, -46, -34, -21, -9, -25, -10, -12, 4, -3, -9, -6, 4, -9, 23, -12, -2, -14, 0, -5, -3, -29, 1, -18, -1, -1, 6, -25, 2, -16, -13, -31, -10, -12, -16, -2, -21, -15, 0, -10, -23, -14, -17, 5, -15, -15, -28, -14, -17, -29, -9, -18, 2, 12, 9, -2, 18, 7, 6, -1, -22, -12, 8, -13, -21, 8, 10, -11, -27, -27, -19, -10, -2, -5, -8, -39, 0, -12, -12, -7, -9, 3, -20, 3, 4, 6, 2, 26, 6, -20, -5, -8, -18, 5, 6, 4, 3, -37, -18, -35, -26, -9, 3, -13, 3, 0, 8, 6, -22, -3, -16, 12, 25, 31, 8, 7, 23, 2, -20, 2, 8, 12, -4, -12, -6, -32, -60, -60, -42, -17, 7, -7, -9, 3, 7, -18, -31, -23, -16, 17, 26, 13, 26, 8, 9, 2, 3, 0, -7, -14, -10, -11, 5, -22, -49, -47, -64, -38, -39, -40, -31, -33, -16, -26, -8, -24, -12, 9, 21, 21, 19, 27, 14, -21, -15, -9, 3, -7, -16, -6, 0, -16, -37, -27, -57, -53, -62, -44, -85, -66, -11, 2, -2, -15, 14, -1, 19, 21, 24, 8, 24, -7, 2, -9, -20, 0, 1, 5, 5, -10, -16, -23, -27, -72, -58, -71, -72, -23, -19, 1, 7, 6, -4, 21, 12, 36, 15, 14, 5, 12, -11, 6, -7, -8, 4, 16, 16, -12, -19, -1, 2, -16, -26, -6, -19, -14, 17, 21, 14, 10, 2, 31, 28, 6, 10, 10, 5, 10, -5, -4, -9, -14, -15, 5, 5, 28, 4, 29, 6, 7, 4, 2, 36, 16, 23, 39, 5, 21, 24, 20, 15, 23, 9, 8, -10, -15, -17, 2, 9, -2, -19, -13, 11, 12, 25, 26, 7, 1, 19, 31, 12, 33, 28, 24, 24, 12, -1, 14, 20, -18, 13, 11, 12, 1, -22, -13, -7, -16, -5, 14, 19, 25, 46, 39, 25, 31, 42, 27, 19, 31, 14, 6, 6, 16, 18, -15, -12, -21, -18, -2, -21, 4, -19, -2, -4, -3, -7, 0, 21, 18, 30, 36, 38, 44, 51, 26, 44, 18, 6, 27, 9, 18, 25, -16, 0, -18, 3, 0, -2, -5, 4, -7, -20, 1, -8, 13, 8, 7, 16, 6, 14, 23, 3, 32, 32, 20, 4, 18, 30, -1, -16, -8, -16, 13, -1, -15, 15, -1, -18, -21, -10, -15, -2, -14, -7, -14, -9, -1, -9, -17, -13, 17, -15, 11, -7, 12, 4, 7, 1, 17, 10, -3, 12, -10, 5, -15, 5, 1, -20, 1, 6, -21, 13, -13, -21, -12, -17, 11, -9, -16, -4, -11, -12, -6, -14, -8, -4, 5, -13, 8, -6, -10, 4, 5, -10, -10, 3, -9, -16, -16, -24, -3, 4, -6, -25, 1, -18, -7, -18, -29, -19, -22, 1, 2, -3, -14, -5, -24, 4, -9, -8, -19, -7, 4, -6, -2, -10, -8, -27, -15, -2, -4, 3, -19, -28, -21, -31, -14, -4, -19, -10, -7, -19, -17, -24, -13, -4, -7, -22, -29, -15, -24, -12, 5, -24, -29, -10, -13, -30, -17, -31, 2, -13, -34, -5, -25, 1, -10, 8, -12, -14, -6, -7, -22, -29, -28, -21, 3, -24, -29, -6, -7, 1, -9, -24, -2, -2, 2, -15, -23, -26, -1, 7, -2, -13, -24, -18, -23, 0, -12, -19, -9, -11, -14, -28, -15, -7, -1, -13, -23, -16, -8, -11, 6, -6, 5, 9, 5, 25, 4, 33, 8, 22, 1, 9, 18, -14, 3, -17, -22, -13, -6, -15, -11, -4, -8, -27, -15, -13, -21, -4, -23, -5, -19, -20, -8, 12, 5, 34, 27, 13, 16, 25, -10, 3, -8, -2, 11, -16, -11, -28, -20, -18, -6, -29, -3, -9, -15, -1, -16, -20, -25, 7, 0, -1, 23, 10, -8, -7, 10, 1, 6, 3, 12, 2, -17, -10, -20, -24, 5, -11, -12, 1, -17, -11, -5, -13, -18, -12, 1, 8, 14, -1, 5, -2, 17, 9, 10, 14, 5, -17, 10, -10, -2, -9, -10, -14, -15, -5, -18, 0, -30, -4, -19, -14, -19, -15, -12, 9, -12, 13, -14, 14, 26, 16, -3, 8, -5, 1, 11, -13, -9, -18, 2, -14, -4, 9, -28, -20, 0, -5, -5, -24, -11, -1, -7, 9, -5, 0, 10, -4, -15, -11, -5, 0, -12, 7, 0, 2, 6, 13, 4, -7, -10, -14, -1, -11, -23, -32, -1, -19, 15, 32, 25, -6, -4, -9, -1, 6, -10, 14, 3, 14, -12, -13, 8, -12, -7, 8, -17, 6, 16, 5, -28, -24, -13, -8, -14, 12, 28, 5, 17, 15, -5, -9, -22, -12, -3, 11, -2, 8, -3, -17, 3, 9, -15, 5, 7, 12, -5, -12, -1, 4, 1, -25, -18, 5, 13, 10, -13, -10, 11, 0, -19, -20, 0, 4, 16, 9, -14, -11, 9, 9, 2, -21, -12, -23, 13, 3, 4, -2, -7, -28, -18, 7, -1, 1, -15, -17, 4, -21, -28, 13, 13, 4, 18, 16, 14, -4, 6, -4, 6, -6, -4, 1, 18, -15, -1, -3, -13, -23, -19, 6, -14, -21, 0, -23, -33, -16, 1, -8, 6, 33, 17, 11, 23, 5, -16, -2, -4, -19, -8, -25, 17, -1, -18, -24, -2, -24, -7, 18, -8, 10, -9, -24, -13, -30, -6, -6, 28, 28, 4, 30, 14, -27, -20, -25, -3, 0, -31, -8, -5, 10, -27, -18, -26, -25, 17, 1, -21, -13, -28, -24, -31, -8, 10, 8, 36, 21, 23, 22, -9, -5, -29, -15, -7, -7, -1, -3, 24, -7, -14, -6, -18, -1, 1, -10, -2, 4, 2, 4, -11, -23, 6, 19, 34, -3, 21, 3, -3, -30, -13, -9, -6, -5, -10, 17, 8, -10, -19, -3, 1, -10, -7, 17, 1, 10, -4, -10, -2, -15, 13, 1, 14, -1, 18, 18, -6, -1, 5, 8, 5, -8, -3, 18, 8, -9, -25, -28, -22, -31, -2, 16, 9, 23, 0, -14, 9, -8, -21, -23, -3, 17, 24, 10, -8, -7, 0, -7, -6, 28, 38, 7, -15, -3, -5, -10, -16, -6, -10, 22, 24, 6, 4, 0, 10, -17, -14, -21, -30, -7, -14, 5, 6, 11, 30, 33, 20, 28, 44, 3, -12, -27, -19, 4, -15, -13, -3, 4, 26, 6, -2, 7, 9, 5, -4, -40, -10, -3, -23, -12, 0, 31, 21, 18, 36, 26, 23, -2, 7, -15, -12, -22, -14, 1, 10, 22, 2, 24, 24, 10, 8, 9, -3, -7, -21, -20, -7, -16, 16, 6, -2, 12, 42, 30, 26, 10, -8, -1, -23, -4, -18, 3, 6, -9, 6, -4, 0, 26, 16, -13, -21, -13, -27, -3, -26, 4, 20, 35, 15, 22, 22, 20, 25, -7, -25, -27, -28, -16, -8, -7, -4, -35, -41, -41, -28, 3, 8, -15, 9, 4, -19, -23, -11, 15, 14, 25, 34, 8, 10, 1, -14, -23, -6, 2, 1, -10, -15, -9, -9, -15, -22, 0, -14, -22, -16, 9, -18, 20, 26, 30, 17, 6, 30, 1, 11, -1, 2, -24, -24, -12, -22, -20, -2, -15, -17, -10, -11, -16, -14, -13, -10, -16, 0, 9, -20, -1, -10, -5, -22, -19, -13, -26, -1, -6, 6, -25, -24, -1, -15, -28, -4, -17, -13, -17, 2, -23, -12, -23, -21, -2, -12, -4, -27, -7, -14, -19, -16, -6, -29, -28, -21, -27, 0, -15, -14, -30, 2, -7, -25, -21, -23, -29, -17, -5, -14, -2, -16, -10, -21, 0, 3, -14, -8, -8, 4, -6, -14, -27, 2, -15, -2, -4, -24, -27, -15, -4, -13, -23, -10, -6, -30, -21, -15, -16, -24, -25, -8, 2, 1, -20, -17, 0, -6, -30, -29, -5, -5, -14, 2, -24, -15, -12, -24, -2, -20, -26, -13, -7, -2, -5, -13, -24, -7, 0, 4, -27, -21, -4, -29, -2, -7, 2, 2, -5, -19, -22, -4, -30, -9, -20, -3, 1, -10, -22, -12, -12, -8, -27, -13, 3, -21, -27, -16, -1, -14, -10, -14, -7, 0, -7, 6, 8, -20, 7, -18, -20, -10, -14, -14, -20, -6, -29, -23, -11, 4, -8, -31, -26, -20, -19, -7, -3, 19, 11, -2, 27, 4, 12, 1, -7, -9, -5, -24, -23, -17, -17, 1, 1, -9, -24, -4, -5, 1, -30, -8, -25, -38, -19, -5, -15, 28, 14, 17, -1, -3, 6, 3, 4, 7, 25, 13, -11, -2, 9, -9, -5, -2, -16, -15, -19, -29, -20, -34, -35, -28, -24, -3, 21, 14, 9, 11, 26, 11, 26, 5, -1, 8, 18, -9, -15, -7, 3, 11, -25, -19, -1, -30, -31, -9, -11, -38, -11, -32, 19, -6, 20, 10, -3, 19, 29, 16, 36, -5, 2, -4, 23, 20, -4, -3, -19, 17, 5, -28, -31, -10, -27, -26, -29, -15, -16, -21, 8, 2, 11, 9, -4, 24, 22, 3, 26, -2, 9, 16, -12, 0, -5, 2, 27, 21, -13, -19, -21, -12, -17, -3, -17, -7, 3, 0, -2, -2, 14, 25, 18, 20, -3, -3, -3, -16, 6, -10, -21, -7, 10, -12, 9, 25, -5, -15, -13, -19, -24, -1, -22, 0, 16, 21, 36, 10, 16, 22, 1, 14, -1, 13, -16, -6, -25, -30, -17, -11, -22, -4, 37, 8, -13, -16, -13, -29, -20, -20, 3, 20, 35, 34, 10, -1, 15, 10, -20, 3, 36, 1, -3, -3, -20, 9, -2, -3, 2, 8, 36, 10, 3, -27, -3, -24, -5, -16, 3, 31, 19, 26, 14, 8, -33, -3, -20, 3, 35, 3, -7, 3, -24, 4, 1, 8, 14, 5, 3, -7, 7, -13, 3, -7, -21, -2, 5, 2, -10, -3, -2, -22, -37, -16, -11, 35, 10, 22, -4, -10, -36, -12, 9, 16, -12, -30, -17, -2, -1, -5, -21, -5, -12, -24, 11, -18, 3, 13, -10, -27, -32, 4, 12, 22, 4, 4, 6, -26, -10, -1, 2, -22, -4, -7, -27, -23, -6, -9, 4, 3, 0, -19, -10, -2, -7, -11, -10, 0, -7, -1, 10, 29, 20, 27, 5, -25, -24, -30, -14, -13, -20, -16, -6, -5, -10, 3, -24, -24, -31, 7, 10, -6, -12, -14, -29, -26, -27, -3, 25, 23, 23, 0, 5, 5, -12, -23, -3, -26, -2, -26, 0, 9, -18, -27, -30, -27, -6, -21, -18, 3, -4, -22, -25, -31, -1, 11, -5, 17, -2, 10, -1, -14, -30, -18, -20, -16, -22, -22, 4, 0, -27, -24, -27, -24, -19, -2, 7, -10, -3, -19, 8, -24, -3, 0, -22, -4, 13, -3, -12, 4, -5, 2, 5, -11, 1, 4, 0, -11, -29, -7, -10, -17, -6, -6, 8, 3, 0, 11, 0, 5, 18, -25, -22, -10, 2, 6, 0, 9, 7, 6, 15, 21, 19, 13, 24, 12, -27, -3, -16, -10, -10, 3, -9, 13, 15, 4, 8, 6, 13, -2, -19, -10, -12, 13, 19, 1, 5, 8, 20, 4, 47, 29, 27, 5, 0, -2, 0, -21, -28, -3, 20, 3, 22, 14, 15, 12, 3, 5, -21, -3, -11, 2, 13, 18, 28, 7, 30, 38, 28, 41, 11, -3, -31, -24, -10, -18, -12, -3, -5, -3, 3, 18, -2, 6, -3, -11, 7, 1, -14, -19, -9, 10, 4, 18, 3, 9, 26, 9, -11, 5, -28, -6, 1, -6, -10, 0, -22, -24, -4, -31, 19, 10, -5, -21, 12, -13, -11, -16, 2, -5, 2, 0, 19, 33, 17, 2, 14, -23, -19, -28, -1, -16, -12, -32, -13, -14, -16, -7, 6, -11, 2, 6, 13, 5, -16, 14, -1, 7, 17, 23, 28, 26, 10, 3, -9, -20, -1, 1, 0, -10, -15, -2, -26, -30, -16, -8, -18, 11, 9, -15, 7, 9, 24, 22, 16, 35, 30, 11, 29, -6, -2, -7, -22, -9, -21, -9, -23, -14, -4, -11, -19, -26, -12, 8, -20, 13, -16, 9, 5, -9, 20, 21, 3, 6, 14, 10, 1, -3, -25, -14, -29, 0, -2, -30, 1, -29, -27, -6, -17, 1, -6, -3, -28, -12, -13, -4, -4, -4, -18, -2, -15, -23, 5, -5, -8, -9, -1, 0, -25, -19, -27, -27, -4, -2, 5, -16, -15, 3, 10, -18, 8, -11, -7, 9, 6, -11, 5, 4, -5, 8, 2, 7, -9, 4, -15, 5, 3, 2, 6, 9, -12, 11, -9, 5, 8, -11, 1, -18, -10, -11, -5, -7, -2, -6, -9, -16, 8, -13, 3, 11, 2, 8, 3, 1, -10, 8, -20, -5, -4, -9, -9, -10, -18, -19, -15, -13, -20, -11, -5, 6, -18, 22, 21, 9, 0, 11, 14, 9, -18, 6, -8, -1, -5, -8, -7, -3, 8, 8, -18, -11, -11, 0, -13, -14, -12, -11, -18, -12, 10, 27, 26, 24, 34, 26, 11, 5, -5, 10, -24, -12, 3, -7, 5, -4, -11, -6, 6, 10, -4, -11, -23, -9, -22, 1, -12, -2, -12, 40, 7, 20, 15, 17, 20, -2, 3, -3, 4, -4, -11, 6, -6, -10, 8, -4, 8, -18, 2, 8, 5, -12, -4, -11, 14, 10, 26, 20, 32, 11, -18, -25, 1, 12, 0, -3, -3, -3, -10, 0, -1, 11, 3, 9, -8, 2, 7, 2, -12, -26, -27, -45, -15, 15, 22, 31, 12, -15, -23, -40, -15, -2, -12, 18, 4, -5, 1, -7, 3, -15, -6, -10, -6, -5, -3, 10, 11, 7, -27, 5, 10, 20, 28, 40, 15, -16, -18, -16, -3, -25, -10, -20, -4, 2, 0, 12, 10, -23, -18, 12, -18, 2, -3, -1, -25, -11, -25, -8, -6, 22, 39, 49, 57, 15, -8, -33, -25, -17, -6, 3, -11, 1, 13, 10, -16, -1, -13, 11, -2, 4, -4, -17, -11, -12, -22, -30, 6, 21, 53, 63, 38, -14, -52, -20, 4, 5, 0, 11, 10, 23, 25, -5, -10, -17, 11, -1, -7, -15, -20, -43, -26, -17, -24, 3, 0, 46, 71, 76, 36, -58, -55, 1, -1, 3, 3, 6, 19, 15, 7, -7, -12, 10, -9, -8, 2, -20, -25, -19, -25, -4, -18, -3, 13, 39, 48, 43, -55, -58, -37, -13, 20, -13, -2, -12, -14, -17, 9, -30, -8, -15, 8, -6, -17, -16, -39, -38, 23, 6, 5, 32, 53, 54, 52, -16, -54, -63, -27, -3, 2, -13, -14, -11, -10, 8, 12, -31, -2, 4, -7, 0, -15, -1, -40, -15, 14, 17, 18, 36, 36, 14, -2, -52, -60, -39, -25, -19, -19, -44, -24, -4, 7, 18, -5, -1, -5, 1, -21, -7, -7, 1, 0, 16, 23, 23, 28, 25, 25, -27, -29, -48, -28, -33, -21, -12, -32, -44, -19, -8, -13, 39, 15, -4, -18, -8, -22, -20, -6, -19, 1, 31, 4, 40, 17, -2, 2, -44, -34, -40, -31, -33, -35, -27, -40, -25, -13, 4, 17, 22, 28, -1, -16, 10, -22, -10, -16, -17, -11, 20, 4, 9, 16, 8, -31, -23, -44, -46, -25, -9, -26, -31, -29, -21, 13, 7, -5, 15, 11, -30, -10, 2, -18, -5, 1, 1, 4, -4, -19, -4, -1, -1, -9, -37, -41, -39, 7, 11, -32, -7, 5, 10, -3, 25, 4, 9, 17, -25, -25, -4, -11, -10, -17, -3, 4, -2, -17, -3, -15, 5, -21, -41, -40, -28, -4, 9, -6, 10, 26, 18, 9, 50, 34, 20, 11, 3, -4, -9, -16, -4, -10, 8, -4, 13, -2, -10, 15, 4, -11, 5, -12, 4, 12, 32, 23, 5, 18, 9, 37, 25, 38, 19, 16, -13, -12, 8, -2, -17, -23, 2, 7, 1, 7, 16, 18, 10, 12, 23, 52, 5, 31, 22, 21, 24, 19, 51, 26, 14, 8, -13, 4, 8, -21, -17, -22, -7, -13, -10, 10, 15, 4, 3, 30, 6, 20, 13, 22, 8, 16, 6, 17, 24, 43, 39, 33, 15, 13, -15, 1, 5, 12, 7, 9, -14, 9, 1, -18, -15, 5, -14, 20, -3, 0, -2, 9, -9, 7, 12, 21, 18, 12, 48, 8, 27, 9, -16, -23, 12, -4, -9, 3, -14, -14, 3, -11, 0, -12, -12, -2, 27, 26, 12, -2, -6, 20, -1, 0, 29, -9, 1, -11, -23, -27, -30, 3, -4, -1, 3, -2, -15, -4, -9, 2, -11, -1, -16, -8, 18, 13, 14, -12, -1, -10, -3, -17, 8, -3, 8, 0, -11, -20, 3, 7, 4, 6, -3, -6, -9, 3, -10, -8, -15, -19, -15, 9, 3, -26, -18, 1, -7, -19, -25, -26, -6, -2, 8, 11, 13, 16, -5, -6, 2, 10, 6, 0, -16, -11, -19, -4, -16, -11, -19, 9, -23, -25, -4, -23, -37, -46, -1, -20, -33, -1, 13, 5, -9, -7, -1, 8, 4, -20, -5, -18, -7, -17, 4, 8, -14, 7, -17, -7, 7, -2, 8, 7, -13, -2, 2, -16, -14, 6, 4, -17, -4, -21, 8, 0, 2, -10, -2, -23, -22, 1, 8, -18, -18, -1, 7, 5, 0, -13, -14, 6, 7, -6, -8, 3, -21, -5, -15, 5, -22, -16, 7, 7, -5, 1, -4, -3, -1, 7, -16, 1, -17, -13, -10, -13, 0, 2, -6, -9, -15, -11, -1, -4, 1, -19, -9, -23, -21, -19, -23, -6, -9, 1, -3, -6, -5, 3, -25, 4, 7, -19, 7, -16, -10, 2, 21, 13, 14, 15, 14, 2, 21, 8, 11, -2, -1, -13, 8, -13, -24, -14, -14, -20, -20, 6, -6, -12, -7, -2, 5, 6, 15, 26, 41, 43, 37, 26, 18, 4, 5, 33, 12, -3, 12, -4, 13, -21, -15, -8, 0, -15, -10, 4, -21, 8, 17, 5, 7, 28, 35, 31, 33, 23, 7, 11, 19, 28, 1, 20, 3, 10, -29, -13, -6, -25, 5, -9, -8, -5, -12, 5, 0, -4, -2, 0, -6, 17, 3, 1, -7, -9, 15, 3, 12, 5, 3, 1, 11, 3, -23, -29, -31, -27, 2, -17, -12, 2, -13, -15, 1, 2, -11, -6, 0, -9, 1, -4, 13, 16, 18, 7, -4, 13, 10, 18, -8, 6, -7, -35, -52, -36, -9, -16, -13, -17, 7, -1, -6, -6, -21, 6, 0, 12, -4, 5, 20, 28, 30, 25, 13, 0, 7, 1, -22, -20, -15, -40, -52, -33, -4, -25, -8, -15, 4, 5, 2, -3, -5, 8, 23, -2, 4, 19, 6, 0, 7, 5, -5, -7, -3, -29, -16, 9, -7, -20, -31, -28, -30, 1, 0, -9, -4, -23, 4, 4, 5, 12, 16, -2, -9, 10, 4, 11, -10, 16, 10, -12, -11, -13, 2, -12, -13, 0, -13, -41, -2, -15, -1, -7, -23, -23, 1, 9, 10, 9, -1, 16, 1, -25, -30, -33, -15, 17, -20, -43, -41, -13, 5, 2, 6, -3, 26, -27, -30, -16, -21, -8, -25, -4, 5, 4, 14, 3, -17, -16, -16, -18, -34, -7, 3, 2, -7, -6, 19, 19, 21, 17, 26, 11, 25, 11, 6, -11, -9, 8, -18, -19, -8, 22, 7, -15, 3, -11, 4, -14, -28, -43, 10, 38, 0, 2, 40, 12, 25, 0, 5, 32, 12, 19, 5, -9, -14, 5, -13, -19, -12, -19, -3, -8, 6, 3, -11, -25, -18, -27, 28, 31, 11, 42, 27, 9, -16, -4, -24, 16, 10, 18, 0, -1, -14, -2, -22, 8, 4, -31, -20, 10, 0, -9, -10, -20, -34, -7, 37, 24, 23, 26, 5, -26, -11, -7, -2, -4, 4, -22, -8, -23, -3, -26, -1, 4, -17, -16, -7, 9, 5, -4, -5, -32, 2, 1, 36, 20, 16, -7, -11, -19, 4, 3, -12, 4, -13, 6, 5, -1, -4, 6, 6, -19, -2, -12, 3, -8, -5, -5, 0, 9, 27, 9, 1, 9, -19, -15, -23, -16, 2, -8, 7, 7, 3, -10, 12, 2, 1, 2, -12, -4, -3, -17, 7, 9, -9, 11, -10, 6, 2, 15, -2, -2, -9, -17, -23, -1, -10, -5, -7, 17, 3, -1, -6, -20, -13, -26, -15, 6, 2, 3, 11, 23, 18, -3, -13, -8, 14, -16, -15, -16, -6, -11, -8, 1, 20, 3, -8, 3, 19, 9, -7, -13, -9, 7, -1, -24, 2, -4, 20, 17, 18, 12, -8, 3, 7, 9, -15, -1, 2, 12, 7, 6, 25, 11, 0, 24, 40, 5, -10, -3, -1, -3, 0, -10, 3, 11, 13, 33, 25, 2, 8, 18, -8, -2, 8, -1, 2, -1, 11, -4, 11, 21, 0, 23, -4, -5, -7, 8, -24, -10, -7, -10, -13, 1, 2, 3, 40, 4, 14, 0, 12, -3, 18, 24, -2, 6, 23, 16, 29, 27, -19, -1, 10, 12, -4, -11, 6, 7, -14, -21, -12, -10, -11, 1, -4, 0, 11, 11, -6, 4, 15, -7, -12, 12, 17, 7, -11, 12, 1, -9, 5, 0, 8, -7, -23, -15, -23, 7, 13, 8, -20, -18, -15, 10, -31, -33, 3, -10, -23, -10, 0, -10, -12, 9, 16, 0, -19, 15, 12, -5, -12, -1, 7, -4, 3, -14, -2, -14, -27, -9, 2, -7, -4, -6, -22, 7, -19, 0, 8, 36, 23, 9, 8, 10, -17, -17, 14, 1, -5, -3, 6, -15, -12, 8, 0, -7, 10, 4, 15, 24, 34, 17, 33, 43, 19, 16, 15, 36, 25, 32, 27, 3, -3, 2, 6, 7, 3, -9, 7, -10, -9, -22, -4, -15, -17, -18, -4, -1, 16, 11, 24, 40, 46, 51, 8, 14, 35, 38, 5, 3, 5, -18, -23, -16, 7, -20, -12, -22, -2, -22, -24, 6, 3, 7, -19, 8, -11, -7, 9, 2, 7, -15, 10, -18, 0, 6, -13, -1, -17, -8, -19, 3, -9, -8, -19, -7, 1, -16, 8, 3, -1, 9, 1, 3, -10, -7, 14, -11, -17, 9, 10, 11, -9, 7, 0, -13, 5, 14, -1, 3, 1, 11, 15, -4, 2, 15, -3, 10, -16, 9, -20, 2, -13, 10, 15, -1, 10, -10, 1, 14, -13, 5, -13, 14, 0, -14, -13, -13, -8, -3, -15, 10, -4, 8, 16, 1, 15, -12, -21, 0, -11, -17, -9, -16, -12, 1, -11, -25, -24, -7, -13, 2, 5, 1, -15, 11, 9, -7, -8, 0, 6, -16, -10, -11, 10, -18, -21, -15, -21, -23, -13, -49, -46, -32, -16, 0, 3, -3, 1, -10, -11, 6, -3, -18, -7, -2, 15, -16, 7, 12, -12, 10, -16, -15, 9, -15, -13, 7, -21, -32, -8, -24, -37, -10, 2, 8, 15, 23, 12, 13, -7, -8, -2, 16, 17, -10, -15, 10, -14, 8, -4, 26, 28, 5, 15, 16, -12, -28, -6, -15, -17, -29, 5, 9, 49, 36, 27, 15, 3, -12, 8, -17, 11, -8, -3, -15, -1, -10, 10, 17, 6, 0, 20, 2, 19, 36, 24, -11, -67, -84, -69, -2, 23, 44, 33, 40, 30, 2, -27, -5, 11, -17, 11, -15, 2, 18, 9, 14, -6, 15, -2, -6, 40, 45, 23, -19, -27, -82, -57, -2, 32, 31, 41, 38, 22, 11, 1, 5, -5, -13, 5, 18, 1, 19, -4, 4, -6, 10, 14, 8, 19, 51, 31, -3, -49, -49, -30, 21, 44, 29, -7, 6, 31, 1, -24, -2, -17, 17, 16, -1, 6, -7, -17, -1, -24, -4, -9, 20, 6, 13, 3, -43, -55, -78, 2, 40, 27, 28, 23, 33, 19, -15, -34, -4, 8, -11, 17, -7, -9, -24, -2, -25, -32, -29, 1, 11, 1, 13, 10, -45, -89, -57, 53, 45, 38, 14, 29, 1, 4, -20, -39, -6, 6, 0, -4, -16, 12, -31, -10, -24, -7, -21, -10, 9, 8, 30, -11, -59, -83, -41, 37, 27, 31, -5, 7, -13, -20, -3, -16, -7, -8, 9, -2, 8, -13, -21, -38, -2, -5, -16, -20, 11, 29, 27, -7, -59, -59, -16, 18, 23, 7, -6, 4, 19, -10, 7, -8, 2, -8, 14, 7, 7, 6, -22, -36, -13, -7, 9, -1, 29, 26, 12, -18, -55, -45, -1, 20, 29, 4, -8, -15, -6, -17, 26, 7, 3, 4, 12, -16, 0, -12, -5, -10, 15, 11, 25, 1, 10, 24, 3, -38, -46, -16, -1, 34, 7, -1, 12, -6, 5, -12, 10, 0, 9, 7, -13, 8, 11, 9, 2, -8, 20, 30, 22, 2, 0, 11, -15, -35, -34, -6, 21, 4, 13, 30, 9, 11, 18, 5, -16, -11, -2, 1, -16, 6, -9, 4, 14, 1, 16, 12, 32, 8, -15, -16, -10, -16, 12, -1, 19, 32, 25, 12, 13, 18, 11, 16, 8, 17, 18, -10, 9, 11, 15, -7, 27, 26, 32, 20, 32, -4, -24, -31, -19, -3, -3, 18, 11, 7, 2, 10, 2, 10, 0, 15, 6, 17, 4, -6, -9, -15, 12, 1, 6, 25, 16, 18, 3, -26, -39, -28, -2, 6, 14, 1, 10, -22, -6, -23, -30, 11, -3, -1, 15, -11, 16, -6, 14, 12, -5, 12, 8, 24, 36, 17, 5, 6, -14, 4, -12, 10, 2, -13, -15, -14, -21, -31, -7, 12, 31, 0, -1, -19, 18, 10, 17, -14, -14, 4, 7, 16, 21, 20, -3, -8, -7, -3, 16, 8, 2, -14, 8, -11, -10, -4, 8, 19, 3, -18, -13, 4, 14, 16, -1, -10, 0, 18, 8, 3, 14, 10, 22, 1, 20, 7, 12, 10, 2, -4, -23, -17, -27, -7, 4, 1, 14, 3, -26, -5, -1, 15, -14, -4, 1, -6, 1, 37, 47, 14, 21, 35, 4, 5, 26, -7, -12, -5, -12, -27, -13, 17, 11, 2, 4, -6, 12, 13, 2, -11, 5, 15, 4, 1, -8, -15, 10, 25, 27, 24, 9, 7, 1, 4, 4, -10, -6, 10, -14, -11, -18, 7, -24, -16, 11, -9, -15, -7, 1, -3, 13, 3, -5, -27, 7, -7, -1, -13, 10, 20, 12, 16, 6, -3, 5, -8, -13, -33, -30, -17, -19, -4, 2, -7, 12, -13, 16, 4, -12, -4, -14, -4, -18, -39, -20, -27, -19, -19, 8, 10, 0, 0, 23, -4, -40, -41, -19, -25, -23, 9, -18, -10, 14, -4, 1, 16, -1, -11, -5, 6, -1, 1, -16, -15, -26, -47, -21, -31, -12, -9, -17, -23, -25, -25, 0, -9, 1, -6, -9, -1, 15, -9, 9, -8, -15, 0, 8, 12, -17, -1, 12, -16, 2, 5, -14, -10, 13, -18, 12, -4, -12, -11, -18, -1, 10, 11, 12, 12, 2, -2, 2, 13, 4, -10, 2, 6, -4, -3, 14, 0, 7, 9, 12, -5, 12, -1, -8, -7, 11, 9, -1, 10, 3, 18, -1, 6, 8, -12, 1, -4, -10, 9, 11, -9, -9, 4, 14, -12, 10, -3, 4, 2, -9, 19, 8, 7, -5, 12, 0, 2, -5, 9, -7, 1, 5, 3, 11, 22, 16, -13, 2, -4, -10, 12, -13, 11, -15, -2, 9, 1, -12, -9, -5, 17, -14, 5, 5, -9, -7, -13, -5, 16, 0, 4, 12, 8, -4, 16, -4, 5, 7, -9, 2, -5, -3, 3, -17, -7, -26, -32, -20, -1, -16, 10, 13, 3, 10, 20, 0, 20, -6, 10, -7, -1, 11, 1, 6, 13, -12, -5, -1, 5, -9, -18, -16, -21, -26, -20, -19, -26, -19, -10, 9, -11, 18, 8, -2, 0, 4, 14, 15, 15, -4, 6, 6, 5, 7, -4, 12, 0, -24, 3, -6, -23, -23, -22, -22, -10, 0, -10, -6, -7, 9, 3, 1, 15, 17, 13, 4, 9, 17, 9, 4, 20, -3, -13, -7, -8, -3, 10, 4, -14, -10, -6, -2, -25, -21, -3, -4, 4, 16, 11, -10, -8, -7, 12, 10, 6, -3, 8, 9, 4, 9, -7, 5, -5, -5, -21, 8, 2, 1, -2, -34, -13, -19, 5, -4, 8, -10, 11, 5, -15, 9, -12, 11, -5, -7, -1, 12, -7, -1, 10, 0, 4, 11, -15, -6, -11, 0, -27, -22, -28, -12, 20, 3, -7, 5, -18, -2, 2, 18, 21, -10, 8, 12, 12, 17, -7, -24, 14, 13, 10, -10, -19, -26, 4, -20, -20, 4, 6, 14, 10, -1, 14, -14, -29, -27, -12, -8, 16, 15, 2, -2, 1, -7, -17, -8, -1, -7, -3, 9, 11, -27, -7, -28, -14, -10, -3, 5, 2, 1, 5, -29, -33, -41, -27, -5, 14, 6, -7, 7, 8, -12, -24, -3, -8, 23, 27, 17, -2, -2, -6, 0, 0, 11, 6, -2, -10, -15, 2, -3, -8, -27, -35, 16, 20, 0, -11, -5, 16, -7, 6, 4, 3, 4, 19, 22, 15, 5, 2, 3, 19, 6, 17, 28, -4, 7, 12, -10, -24, -19, -18, -16, 2, 20, -12, -8, 21, 2, -12, -5, 14, 4, 8, 0, -24, -17, 5, 10, 31, 18, 28, 16, 24, 7, -12, -15, -16, -12, -21, 8, -3, -3, -1, -8, 16, -1, 5, 9, -4, 5, -1, -5, -22, 11, 30, 11, 14, 31, 30, -4, 19, -8, 5, -12, -30, -1, -10, -15, 11, -7, -3, -6, 3, -4, -7, -25, -7, -29, -18, -42, -9, 21, 34, 8, 37, 41, 26, 7, -22, -12, -9, -1, -12, -36, -7, -10, -6, 8, 0, 8, 4, 5, -2, -36, -10, -8, -26, -44, 3, 1, 34, 13, 34, 7, -16, -29, -7, -19, -3, -27, -31, -34, -21, -4, -10, 18, 13, 12, 9, -27, -25, -21, -36, -45, -32, -10, -1, 5, 2, 19, 23, 8, -3, -28, -11, -28, -27, -35, -22, -19, 3, -12, 9, 15, 18, 7, 0, -25, -15, -41, -12, -31, -16, -23, 3, 12, 22, 6, 4, -6, -13, -19, -9, -22, -2, -38, -16, -17, -9, 18, 13, 7, 9, -3, -2, -2, -36, -9, -8, -6, -12, -30, -15, 6, 7, 27, -4, 5, 1, -3, -22, -11, -18, -6, -38, -26, -4, -8, 4, -5, 21, 8, 1, -22, -7, -32, -14, -18, -1, -11, -32, 3, 7, 17, 24, -7, 4, -11, 3, -3, -26, -7, -5, -6, -19, -2, -1, 15, 14, -9, -12, 2, -9, -15, -17, -14, -24, 1, -10, -6, -10, 23, 24, -10, -5, -7, -1, -23, -16, -2, -3, -9, -4, -10, -5, 14, -2, 1, -3, 10, 19, 7, 14, -7, 6, -20, -27, -16, -8, 17, 5, 17, -6, -19, -15, -19, -13, -7, -18, -10, 16, 4, 8, -5, 16, 16, 8, -11, 7, 22, -11, 7, 8, -13, -14, 12, 4, 27, 21, -4, 15, 10, 1, 11, -9, 5, -20, 6, 12, 17, -3, 15, -9, -9, 6, 5, 8, 7, -1, -1, 3, 5, 16, -12, -12, 4, 25, 13, -1, 14, 21, -10, -12, 15, -5, 0, 0, -5, 14, 10, 15, -5, 1, -12, 13, 6, -9, 7, -24, 2, 6, -3, 6, 4, -1, -8, -24, 6, 3, -18, -6, 9, -4, 20, 19, 14, 11, -11, -3, 10, 8, 8, -11, -7, -9, -5, -12, -2, -19, -28, -18, -10, 7, 2, -7, 0, 2, 4, -5, 8, -13, 1, 3, -10, -9, 16, -4, 21, 0, -11, 2, 19, 21, 5, 6, 21, 8, 19, 16, 17, 4, -4, 2, -10, -11, 7, 1, 4, -8, 2, -12, -4, 7, 8, 19, -7, 1, 19, 16, -1, 17, -10, 0, 0, 22, 7, 11, -11, 11, 15, -6, -1, 13, -11, 9, 18, -4, -5, 10, 16, -5, -8, -3, 13, 22, -3, -5, 15, 20, 19, 14, 14, -4, 1, 10, 12, -5, 21, 14, 8, -13, -10, 16, 13, 17, 9, 21, -5, 5, -1, -9, 17, 3, -4, -12, -9, -12, 9, 6, 16, 14, -5, 0, 3, 11, -6, 5, 7, -12, -19, -2, 8, 3, 15, 14, -6, 14, 7, 6, 17, -1, 3, 2, 21, 2, 0, -16, -2, 7, 9, 22, 0, -11, 8, -19, -7, -16, 15, 11, 10, -3, -8, 14, -8, -6, 9, 22, -2, 22, -11, 19, 2, 15, -16, -6, -38, -11, -9, 14, 23, 1, -2, 0, 0, 23, -6, -10, 1, 4, -19, 2, -3, 5, 2, 11, 20, 5, 12, -4, 2, -7, 10, 7, 9, 0, -7, 12, 37, 33, 14, -7, 4, -25, -13, 12, 8, 5, -1, 8, -15, 3, 13, -4, -3, -9, -4, -2, 29, 30, 23, 6, 5, 29, -1, 13, 46, 8, 5, -2, 3, 12, -9, -2, 2, -14, -6, -7, 10, -8, -6, 12, 11, -1, -17, 6, 11, 21, 2, 18, 25, 4, 17, 12, 29, 26, 27, 38, 8, 10, 10, 7, -19, -9, -36, -10, 12, 19, 3, 19, 12, 22, -24, 6, 12, 15, 21, 21, 9, 7, -11, -9, 45, 46, 13, 24, 29, -5, -4, -11, -23, -15, -14, -17, -7, 5, 13, -5, 12, -14, -6, 1, 8, 0, 27, 15, -22, -6, -4, 2, 31, 38, 32, 11, 23, -2, 1, -40, -23, -40, -9, -12, -9, 19, 17, -9, -9, 17, -22, -20, -14, -17, -24, -20, -33, -30, -28, -6, 22, 37, 10, 36, 8, -4, -11, -26, -20, -28, -26, -16, -15, -11, 12, 12, 21, -7, -25, -42, -16, -27, -5, -14, -36, -16, -34, -7, 19, 38, 8, 20, 30, -12, -40, -53, -46, -33, -29, 8, -6, -4, 11, 15, 6, 1, 3, -29, -34, -25, -21, -27, -22, -40, -25, -29, -10, -2, 7, 2, -3, -13, -37, -41, -31, -37, -1, 7, 20, -10, -8, 20, 22, 14, -17, -12, -28, -19, -6, -21, -24, -37, -36, -38, -23, -4, 33, 35, -7, -22, -66, -27, -30, -21, 6, 18, 16, -3, 16, -10, 6, 5, -3, -12, -32, -16, -5, -15, -27, -4, -14, -12, 0, 19, 25, 28, 15, -10, -27, -36, 5, -6, -2, -3, -8, 10, 11, 10, -8, 16, -8, 0, -18, 4, -8, -11, -2, -20, -17, 0, 2, 14, 12, 34, -3, -48, -23, -2, -9, -12, 3, -2, 20, 8, -11, 4, -6, 10, -14, 1, 9, 14, 14, -2, 6, -10, 6, -14, 24, 28, 39, 16, -37, -47, -36, -5, -12, -25, 15, 4, 20, 8, -9, 18, -10, 10, 12, -15, 0, 20, 22, -5, -2, -7, 12, 13, 14, 40, 7, -22, -21, -47, 9, -16, 14, 19, 19, 19, -1, 22, -7, 4, -4, -10, 0, -1, -14, 7, 7, 32, 0, 23, 6, 30, 46, 21, -2, -30, -9, 3, 4, 7, 21, 16, 16, 23, -3, 12, 19, 18, 23, 15, -3, -3, -11, 4, 14, 18, 23, 29, 33, 38, 40, 8, -9, -28, -26, -3, 23, 29, 29, 23, 36, 25, 20, -7, 21, 6, -4, 5, 22, 8, 4, -10, -6, 18, 15, 24, 28, 31, 36, -14, -36, -16, -30, -8, 5, 9, 0, 2, 31, 20, -5, -9, 18, 16, 12, 6, 8, 24, 11, -19, -6, 5, 16, 17, 28, -1, 26, -7, -10, -40, -27, -12, 10, 10, 13, 3, 27, -5, -9, -6, 9, -1, -10, 4, 19, 36, 8, 17, 11, 20, 10, -3, -13, 9, -9, 0, -9, -22, -19, -9, 5, -4, 16, 16, 1, 25, 2, 16, 0, 7, 0, 8, -11, 14, 31, 24, -9, -17, 7, -7, -18, -3, -6, -22, -15, -47, -57, -58, -39, -4, -7, -12, -4, 2, 0, 8, 18, 19, 2, 3, 9, 36, 12, 9, -16, -12, -25, -32, -17, -3, -29, -20, -48, -30, -32, -29, -10, -12, -12, -12, -9, -6, 7, 21, 21, -8, 12, 1, 8, 24, -3, -15, 7, 28, -24, -5, 11, 7, -24, -10, -43, -17, -35, -26, -16, 4, 18, -1, -11, 13, -1, 15, 1, -3, 14, 6, 7, -4, -11, 20, 24, 17, 5, 14, 2, 22, 16, 23, -3, 8, 7, -3, 7, 5, 17, 18, 22, -5, 8, 2, 15, 4, -3, -10, 12, 5, -7, 4, 4, -6, 24, 12, 17, 0, -1, 11, -4, 10, -5, 7, -6, 0, -8, 9, 6, 20, 0, -6, -11, 0, -18, 11, -3, 10, 10, 12, 10, -3, 8, -12, -6, -6, 12, -3, -12, -5, -1, 11, -20, 11, -16, 10, -10, -4, 9, 1, -4, -5, -5, -19, -7, 3, 3, -9, -15, 2, -22, -12, 0, -11, -10, -1, -1, -6, -2, -7, 5, -9, -6, -9, 9, -7, -21, 6, 5, -4, -2, 9, -16, 9, 6, -13, 4, 4, 3, -13, -12, -3, -10, 13, 9, 20, 10, -2, 1, -5, -8, -7, 5, 3, 8, -20, 2, 4, -1, -10, -11, -20, -5, -23, -20, -17, 1, -2, 7, -26, -11, 15, 27, 39, 40, 27, 29, -4, -15, -18, 5, -8, -18, -7, -1, 0, -6, -20, -9, 4, -22, -20, -12, -30, -25, -27, -5, 8, 23, 17, 8, -2, 15, 32, 8, 20, 4, 11, 18, -8, 2, -17, 3, -1, 0, -1, 3, -2, -28, -36, -46, -26, -24, -28, -10, -4, -18, -17, -33, 3, -13, 20, 6, 7, 15, 13, 7, 7, -5, -11, 1, -1, 9, -5, 5, -24, -44, -43, -49, -54, -22, -13, -8, 5, -17, -18, -25, -12, 16, 21, 45, 19, 9, 8, 27, 16, -19, -18, 2, -1, -2, 12, 0, -38, -23, -34, -39, -29, 1, -11, 13, 6, -6, 5, 2, 15, 24, 31, 37, 4, 13, 29, 14, -20, 0, -20, -12, -9, 0, -4, -5, -22, -42, -36, -24, -38, -21, -15, 0, -6, 26, 26, 13, 45, 26, 6, 19, 34, 29, 10, 9, -13, -4, -3, 12, -1, 6, 7, -23, -12, -29, -36, -34, -48, -11, -9, 2, 8, 27, 22, 27, 30, 24, 25, 25, 25, 30, 35, 37, 37, 9, -17, -7, 10, 0, 0, -4, -31, -18, -45, -44, -67, -30, -39, -3, 20, 20, 40, 38, 16, -2, 20, 19, 35, 34, 27, 42, 16, 0, 8, -10, -4, 11, -2, 27, -14, -35, -22, -60, -31, -18, -25, -17, 22, 22, 20, 13, 18, 18, 4, 15, -2, 18, 5, 22, 0, -3, 11, 12, -7, 16, -2, 2, -16, -41, -28, -49, -19, -24, -22, -23, 27, 27, 34, -1, -6, 16, -41, -29, -48, -21, -38, -33, 16, 9, -13, 0, 0, -12, 12, -6, -20, -39, -45, -26, -22, -14, -34, -46, 5, 3, 2, -23, -18, -19, -39, -20, -61, -63, -33, -29, -27, -15, -6, 5, -7, -18, 15, 18, -21, -6, -33, -7, -16, -6, -39, -8, -5, 3, -9, -26, -26, 7, -8, -21, -35, -63, -70, -40, -26, -25, -14, 8, -20, -7, 4, 11, 16, 20, 6, -18, -39, -10, -32, -9, 3, 4, -2, -15, -8, 9, -4, -7, -50, -68, -46, -35, -25, 4, -8, -20, 8, 5, -19, 25, 4, 1, -15, -28, -31, -37, -9, -13, 11, -7, 0, -20, -4, 29, 4, -3, -98, -80, -85, -55, -13, -1, 6, -18, 10, -19, -7, 13, 30, 9, -4, -9, -19, -16, -22, -11, -5, 14, 26, 12, 24, 50, 24, -25, -94, -89, -66, -22, -20, -3, 6, 13, -4, -17, -15, -3, 9, 18, 18, 0, -15, -13, -12, 1, 4, 15, 16, 41, 49, 28, 11, -50, -97, -91, -40, -16, -1, 8, 2, -17, -2, 5, -8, -12, 13, 20, 26, 14, 12, -9, -13, 21, 9, 20, 24, 16, 28, 38, -16, -60, -93, -88, -41, -34, -1, -7, 8, 9, 6, -10, -21, -7, 24, 7, 27, 33, 12, -9, -14, 9, 19, 19, 14, 16, 19, 2, -46, -101, -82, -66, -35, -3, 3, -7, -8, -2, -9, -6, -6, -14, 20, 30, 24, -1, 1, 10, 14, 1, 26, 3, 12, -16, 6, -35, -77, -83, -72, -60, -18, -1, -19, -5, -13, 5, 3, 0, -26, -6, 4, 18, 8, 2, -2, -7, 11, 13, 0, 4, -2, -1, -27, -82, -77, -66, -56, -35, -1, 0, 4, -10, -9, -2, 8, 10, 10, 10, -1, 13, 0, -7, 7, 9, 10, -3, -4, -6, -20, -43, -73, -88, -58, -41, -25, -18, -28, -20, -8, 5, 5, -17, 3, 4, -2, 23, 18, 6, 15, 5, 14, -1, 17, 21, 38, 1, -23, -28, -42, -60, -57, -31, -44, -37, -19, -4, 5, -7, -10, 4, -2, -17, 14, 13, -14, 19, 20, 45, 51, 29, 31, 46, 15, -22, -3, 15, 13, 16, 5, -13, -22, 8, -24, 3, 3, -12, -16, 2, 12, 4, -16, -4, -7, -5, -1, -1, -3, 13, 5, -1, 3, 23, 34, 19, 38, 24, 11, -6, 4, 3, -15, -18, -3, -1, 7, 5, 9, -3, -8, 2, -5, 1, 7, -19, 3, 2, -4, -19, 12, -15, 12, 16, 6, 7, -7, -3, 8, -12, 7, 2, -20, -13, 11, 6, 6, 6, 1, -13, 0, -23, 6, 1, -21, -18, 7, -14, -19, 1, -11, -21, -16, -3, 4, -18, 5, 2, -16, 3, -10, -5, -15, -16, -14, 7, -7, 6, -24, -13, -21, -21, -17, -18, -4, -15, 7, -7, -5, 0, -9, -8, -10, -22, 0, -11, -19, -10, -23, -10, 0, 5, 0, -1, 4, -12, -20, 8, -10, 9, -10, 10, -11, -5, 16, 1, 20, 0, 19, 16, -2, -12, -19, -20, 8, 0, 4, -15, -12, -14, -3, 3, -14, 0, 6, -23, -8, -6, 13, -3, -8, 0, 38, -3, 35, 15, 15, 2, 9, 8, -3, -10, -15, -7, -5, -19, -9, -21, -1, -8, -6, 2, -7, -17, -6, 8, -5, 26, 7, 25, -3, 9, 3, 17, 33, 12, 38, 20, 3, 19, 10, -5, 9, -8, 4, -14, -18, -21, -3, -22, -14, -12, -21, -22, -18, -8, -10, -7, -10, -16, 15, -6, 3, 17, 36, 47, 43, 15, 15, 6, 14, -18, -13, -2, -16, 6, -16, -22, -32, -36, -40, -36, -28, -19, -36, -12, -8, -17, 1, 3, 1, -3, 10, 16, 20, 15, 24, 15, -5, 4, -16, -10, 9, 6, -17, -33, -50, -46, -45, -11, -16, -32, -17, -10, -19, -2, -3, -19, -36, -9, -1, -6, -7, 14, 3, 23, 7, -18, -6, -19, -19, -26, -26, -22, -54, -25, -12, -11, -10, 0, -7, 20, -1, 1, -4, 7, 3, -2, 2, -2, 1, 20, 31, 19, 26, 9, 1, -5, -17, -12, -25, -18, -40, -6, -17, -5, -5, -11, -3, 19, 2, 0, 8, -11, 0, -30, -14, -22, -3, -9, 17, 26, 35, 6, -2, -6, -11, -9, 2, -9, -17, -13, -2, -5, 2, 6, 18, 3, 10, 4, 14, -28, -20, -33, -23, -3, -11, 3, 11, 33, 28, -7, 6, -9, -24, -18, -12, -20, -3, 4, 12, -5, -12, -6, -22, -11, 21, 4, -11, -22, -32, -21, -12, -17, -13, -18, 26, 13, 22, -13, 3, 1, -11, 3, -23, -24, -1, 10, -5, -18, 3, -10, -22, 9, 26, 7, -1, -31, -3, -7, -23, 2, -10, -13, 4, 14, 10, -14, 8, 9, -15, -18, -13, -31, -9, 7, -8, -22, -18, -34, 11, 41, 26, 20, -11, -45, -28, -8, -15, -7, -38, -30, -15, 4, 5, 5, -4, -1, -22, -18, 8, -25, -8, -21, -13, -16, 8, -8, 10, 18, 21, 0, 8, -25, -25, -30, -28, -21, -31, -29, 4, -11, 4, -17, -20, -4, -22, -3, 4, -18, -20, -16, -16, -11, 0, -10, 21, 20, 34, 14, 9, -31, -22, -25, -19, -37, -29, -26, -10, 17, 11, -8, -6, -21, -2, -10, 14, -9, 2, -21, -9, -11, -15, 17, 35, 25, 1, 5, -1, -14, -6, -19, -18, -23, -15, -18, 9, 19, 16, -9, 5, 5, 0, -18, 5, 9, -9, 4, -13, -14, -19, 13, 4, -8, -8, 8, 1, -14, -11, -9, -18, -3, -17, -20, 3, -10, 2, 3, 1, -24, 4, 3, 9, 18, -1, 23, 5, -1, 15, -8, -3, 9, 2, -1, 0, -6, 0, 17, 8, 15, -9, 1, -6, 31, 18, -17, -11, -14, -13, -13, -4, -3, 18, 10, -1, -3, 2, 3, 4, 11, 14, -3, 18, 41, 40, 14, 36, 26, 27, 29, 23, -4, -3, -10, -12, 4, -23, 11, -13, 2, 27, 16, 8, 19, 28, 17, 24, 29, 12, 26, 44, 14, 41, 56, 23, 31, 37, 47, 23, 10, -15, -3, -24, -21, -22, -11, 0, 17, 21, 21, 42, 16, 22, 19, 14, 23, 38, 49, 42, 18, 33, 51, 27, 37, 19, 23, 15, 7, -4, -17, -17, -21, 9, -20, -11, 18, 24, 8, 11, 3, 23, 4, 4, 13, 15, 3, 12, 2, 31, 37, 12, 4, -2, -8, 13, -3, -11, 9, -18, -24, -8, -7, -19, -5, -9, -24, -33, 12, 23, 5, -12, -7, 14, 9, 2, 19, -15, 9, -5, -23, -7, -16, -6, -21, -9, -9, -23, -2, 5, 6, -11, -2, -41, -33, -31, -24, 4, -5, -24, -14, -10, -19, -20, -10, -10, -14, 5, -21, -26, -4, -17, 4, 9, 2, 0, -22, 4, -17, -7, -34, -43, -12, -19, -30, -21, -18, -13, -17, -24, -31, -23, -20, -27, -14, -15, -31, -2, 8, -9, -15, -11, 3, -23, -4, -18, -25, -5, -5, -17, -10, -19, -20, -30, -17, -9, -4, -35, -26, -26, -16, -31, -33, -9, -11, -21, -3, 6, -10, -8, 7, 7, -1, 6, 1, -15, -10, 2, 6, -14, 0, -20, -19, -19, -10, -22, -10, 0, -12, -2, -14, -13, -15, 1, -18, -23, 9, -13, -21, -24, -13, -7, -12, 2, -15, 8, -3, 9, -9, -2, -11, -3, -17, 2, 9, -2, -7, 16, -14, 10, -1, 14, -14, 9, -6, -14, 16, -9, 15, -15, -12, -6, -12, 16, -12, 11, -14, 12, -5, 9, -9, -4, 15, -7, 9, -9, 11, -14, 17, 8, -14, 12, -4, 4, -9, -1, -10, -7, 0, -11, -3, -15, -14, -15, 7, 5, 21, 17, 2, 26, -1, 0, 5, 10, 4, 10, 10, -10, 5, 18, 6, -5, 6, -17, -7, -6, -16, -13, -12, 10, -15, 12, -20, 7, -1, -3, 2, 17, 25, 27, 3, 22, 38, 37, 19, 11, 18, -5, -8, -15, -10, -4, 7, -11, -11, -4, -3, 7, -16, -6, -44, -11, -30, -7, -5, -13, -7, 3, 7, 27, 32, 28, 39, 33, 1, 29, 7, -12, 16, 9, 7, 0, -3, -2, 3, -41, -21, -45, -34, -8, -6, 0, -13, 22, 3, 23, 32, 44, 59, 33, 47, 38, 28, 32, -5, -12, -14, -6, 4, -15, 7, -22, -20, -44, -39, -34, -20, -24, 0, -6, -5, 26, 47, 36, 60, 57, 38, 65, 47, 52, 25, 33, 38, 14, 4, -7, 0, 4, -2, -25, -42, -16, -31, -9, 9, -10, -3, 25, 0, 38, 38, 58, 42, 12, 34, 34, 6, 11, 13, -9, -7, 9, -3, 10, -1, 14, 14, -19, -15, -12, -34, -29, 9, 11, 8, 21, 26, 7, 0, 16, 2, -12, -40, -40, -33, -41, -28, -42, -33, 3, 2, 12, -13, -15, -11, -12, -13, -7, -21, -21, 8, 2, 30, 19, 14, 4, -45, -72, -83, -76, -80, -68, -77, -64, -81, -47, -39, 1, -17, 13, 10, -6, -7, -21, -16, -23, -7, -5, 3, -6, 17, -9, -10, -38, -72, -86, -75, -65, -83, -77, -79, -83, -97, -55, -42, 0, -18, 11, 0, 10, -8, -3, -21, 8, 14, 8, 3, -9, -15, 5, -26, -37, -53, -49, -33, -39, -12, -32, -67, -52, -73, -30, -29, -16, -12, -5, 1, -14, 11, 13, -17, -23, -10, -1, -4, -13, -26, -16, -3, -10, -47, -20, -26, 12, 10, -4, -13, -51, -55, -25, -25, -3, -16, 15, -17, 8, 15, 5, -5, -14, -17, -9, -19, -15, -11, 16, 2, -21, -16, -7, -28, 11, -5, 27, -4, -33, -24, -10, 3, 13, 18, -14, -1, 10, 16, 10, -25, -31, -4, 5, -22, -23, 22, 19, 1, 11, 5, 7, -4, -15, 0, 7, 7, -12, -11, -2, 5, 22, -12, 1, -12, 5, -20, -13, -20, -3, 0, 29, 17, -13, -2, 17, 4, 19, -6, 3, 2, -16, 11, 1, -10, -2, -35, -8, 44, 27, 14, -16, -14, 2, -16, 2, -24, 3, -3, -11, 10, -22, 3, 37, 34, 11, -9, -15, -21, -8, -17, -2, 4, -2, -15, 13, 25, 34, 19, -8, -8, -3, -6, -12, 10, 10, 13, -19, -8, -21, 42, 31, 34, -13, 2, -1, -13, -10, -11, -16, -15, 7, 0, -3, 7, 11, 2, 7, -8, 7, 9, -23, 16, 7, 9, 6, -21, -21, 8, 14, 19, -8, -10, -19, -5, -25, -36, -6, -19, -22, -5, -25, 16, 28, -11, 17, 5, 15, 8, 8, 6, 3, 14, -11, -13, -20, 18, 41, 16, -9, -12, -14, -25, -9, -21, -16, 7, -19, -14, -24, 1, -1, -4, -17, 16, -17, 12, 0, 22, 15, 11, 4, -1, 12, 20, 40, 47, 7, 27, 14, -8, -17, 9, 5, 11, 20, 14, 22, 23, 16, 8, -18, 7, 11, 12, 17, 0, 17, 0, 6, -9, 29, 31, 21, 29, 14, 14, -2, 14, 7, 12, 31, 33, 42, 40, 27, 37, 20, -15, 1, -8, -2, 13, 13, 0, -2, -9, 8, 6, -8, 12, 21, 9, 8, 12, 18, 11, 3, -3, 16, 13, 9, 21, 18, -2, 13, -15, 15, 9, -12, -8, -4, 7, 13, -14, -34, -6, -5, 1, 1, 14, -8, 19, 18, 20, -5, 21, 31, 10, 6, 7, 14, 22, 18, 1, -15, -16, -16, -9, 5, -7, 13, -7, -20, -28, -20, -36, -27, 2, 0, 10, 12, 15, 10, 23, 35, 15, 7, -2, 4, 15, -1, 15, -10, -10, 2, 7, 1, 13, -9, 5, -12, -2, 1, -24, -13, -15, 2, 2, 21, 30, 25, 29, 27, 20, 14, 6, -4, 5, -9, 15, -5, -8, -6, -9, -3, 11, -12, 6, 3, -10, 15, -10, -12, 0, 25, 9, 6, -9, -7, 23, 9, 25, -5, -14, -6, 0, 4, -10, -2, 5, 4, 11, -2, 15, -10, -15, -5, -2, -17, -7, 0, 16, -13, -8, 4, 16, 10, -13, 6, -8, 6, 6, -14, 12, 7, 1, -7, 1, -1, 11, -9, -16, 5, -19, 3, 9, 7, -17, 2, 2, 12, 10, 9, 2, 0, 2, 11, -9, -3, 1, 10, -20, 2, 14, -2, 9, -19, -13, 7, 8, -11, 4, 0, 9, -11, -9, -17, 11, 4, -10, -16, -9, 3, 2, -13, 6, -15, -5, 13, -10, -16, 8, -15, -4, -18, -17, 12, 2, 9, -7, -13, 14, -6, -8, -3, 18, -2, 6, 9, -13, -1, 20, 8, -14, 0, -3, -13, 14, 13, 9, -12, 13, 1, -18, 4, -6, 2, -12, -8, -3, -15, -14, 0, -14, -15, -7, 14, -7, 1, 5, 35, 21, 28, -4, -5, -1, 1, 8, 8, -4, 0, 7, -2, -17, -3, -7, -29, -23, -37, -29, -34, -18, -30, -22, -23, -39, -11, -2, 15, 3, 8, 30, 17, 6, 4, 1, 2, -11, 8, 4, -8, 10, 8, -26, -14, -18, -24, -11, -6, -20, -21, -8, -29, -40, -23, -21, -20, -21, -4, 17, 24, 8, 5, 3, -2, 12, 9, -16, 7, 10, 11, 2, -5, -4, -30, -1, -20, -16, -5, -1, -9, 5, -17, -20, -18, -10, -1, 31, 13, 11, 3, -7, -5, -17, 13, -17, 5, -23, 7, -27, -11, -13, -14, -13, 5, 17, -1, 9, 16, -6, 25, 8, 11, 10, 14, 2, 10, -5, -7, 5, -6, -5, -1, -17, -14, -5, -18, -10, -16, -4, 6, 11, 13, -17, -3, 0, -1, 8, 20, 20, -7, -1, 0, 7, -2, -4, -12, 5, 5, 9, -11, -10, 3, -14, -6, -5, -5, 14, 12, 19, 15, 2, 18, 13, 4, 4, -2, -2, 7, -17, -23, -12, -28, -16, -7, -18, 6, -5, 12, 4, -18, -19, -11, -24, 5, -14, 13, 13, 2, 15, -3, -19, -8, -4, 13, -6, -14, -6, -5, -7, -21, 0, -8, -11, -2, 1, 3, -5, 11, 1, -15, 11, -13, 3, -1, 6, 31, 27, -3, -13, 9, 9, -11, -7, 10, -12, -16, -23, -12, -8, -25, -7, 8, -12, 6, 5, 9, 7, -30, 16, 8, 10, 14, 6, 32, 25, 8, 7, -17, -18, 9, 14, -11, -20, -25, -11, -7, -18, -7, 8, -8, -19, 12, -12, 7, 14, 8, 16, 13, 9, 11, 11, 27, 6, -21, -9, -25, -9, 1, 4, 18, 9, 15, 5, -3, -24, -27, -10, 11, -11, -4, 1, 1, 7, 1, -8, 21, 16, 28, -2, 22, 4, -14, -24, 4, 10, 13, 16, 20, 35, 20, 20, -9, -19, -5, -2, -2, -9, 12, -8, 1, -6, 0, -3, 8, 20, 21, 4, 27, -8, -9, -39, -8, 14, 8, 17, 10, 5, 3, -3, -13, -30, -28, -9, -15, -17, -6, 2, 3, -23, 18, -12, 6, 23, 7, 21, -3, 2, -16, -11, -5, 9, 36, 17, 27, 25, 5, 12, -16, -41, -21, -24, 2, 1, -3, -7, -4, 5, -5, -6, 10, 21, -3, -2, -8, -3, -25, -16, -16, 27, 31, 41, 5, 12, 13, -24, -38, -15, -8, -1, 7, 12, 9, -2, -3, -13, -5, 18, 21, 9, -6, -11, -17, -9, -25, -15, 21, 24, 22, 32, 14, -10, -2, -7, -19, -35, -27, 1, 6, 14, -10, -7, -5, 3, 0, -13, -10, 12, -17, -12, -1, -3, -2, 20, 12, 8, 13, 17, -15, -15, -22, -23, -33, -20, -25, 2, -10, -5, -10, 6, -6, -19, 3, -41, -16, -8, -2, -6, -19, 15, 10, 1, -1, -4, -10, -22, -21, -18, -49, -35, -29, -22, -5, -4, -17, -3, -6, -6, -19, 3, 0, -33, -18, -8, -9, 9, 0, 9, 5, -4, -7, -3, -18, -26, -44, -34, -26, -3, -22, -5, -2, 12, 8, -15, -14, 9, 6, -28, -15, -47, -6, -11, -5, -2, 12, 18, -11, 6, -1, -25, -37, -30, -49, -36, -23, -1, -21, -16, -6, -12, -17, -8, -9, 13, 0, -18, -7, -5, 5, -3, 1, 8, 16, -6, -13, 5, -4, -30, -7, -19, -13, -25, -15, 8, 2, -12, -14, -15, -3, 10, 12, -18, 3, -7, 7, -6, 5, 19, 2, 8, 8, -13, 8, -18, -6, -4, 6, -23, -27, -6, -18, 10, -4, 1, -7, 2, 14, -2, 9, -3, 15, 2, 20, 8, 16, -14, 18, 17, 20, 16, 17, 20, 21, 1, 8, -4, 9, -6, 22, -1, -5, 9, -1, 11, 12, 10, -9, 5, -15, -4, 12, 16, -6, 15, 9, 7, 13, 33, 23, 34, 14, 29, 13, 23, -9, 12, 19, 5, 15, -9, -16, -6, 1, 3, 4, -7, -19, -15, 7, 0, 5, 8, 11, -6, -14, 15, -9, -8, 15, 0, -13, -10, 12, 3, 2, -15, -7, -17, -19, -2, 14, -2, 18, 13, 11, 10, 4, 0, -8, 15, 11, -10, 17, 1, -10, -12, -11, -10, -9, 14, 1, 15, -12, -12, -6, 0, 8, 21, -11, 15, 18, 14, 11, -11, -2, 14, 11, 20, -10, 0, 5, -11, 17, 11, 0, 15, 7, -7, 10, -10, -3, -2, 21, 10, -7, 6, -1, 1, 1, -9, 21, 19, 2, 4, 4, 11, 2, 14, -3, 4, -3, -7, 0, -13, -11, -8, 21, 12, 17, -3, 6, 11, -11, -10, 16, -13, 7, -10, -12, 13, -1, 5, 17, -9, 5, 18, -6, -7, 7, 9, 19, 4, 16, 9, -7, 2, 4, -1, -3, 8, 5, 5, 20, 13, 2, 7, 7, 0, -8, -12, 11, 10, 6, -10, 0, -5, 3, 8, 3, 13, -7, 9, 11, 8, -2, -11, 14, -13, -6, 15, 13, 9, 15, 10, -1, -6, 16, -9, -1, -13, 10, 14, 3, 20, -7, 5, 3, -8, -11, 2, -9, 8, 18, 20, 19, 8, 21, 17, -12, -12, 0, -1, 4, -1, 16, 3, 17, 3, 19, 7, 12, -7, 9, -5, 7, 14, 19, -3, -9, -1, 9, -11, 2, -8, 5, 4, -6, 7, -7, -1, 11, 4, 14, 14, -13, -11, -10, -4, -6, 6, 2, -2, 0, 3, -15, -20, -3, 15, 13, 6, 11, -8, 3, -13, -11, 14, 3, -10, 10, 6, 11, 8, -5, 13, -7, -15, -5, -14, -13, -9, 11, 0, -6, -21, -14, 13, -8, -11, 19, -1, 0, 0, 16, 16, 13, 16, -4, 18, 9, -8, -9, -1, -5, -7, 4, -16, 12, -19, -13, 8, -18, 0, -8, 5, 6, 0, -3, 21, 14, 11, -7, 20, -6, 21, -12, 10, -13, -20, -8, -2, 12, -7, -5, 4, 1, -3, -16, 11, -16, 13, -2, 13, -11, 6, -3, -1, -5, -12, -2, 15, -8, 7, 2, -10, 7, 8, -13, -5, 9, -16, -13, -21, -8, 3, 1, 1, 7, 9, -17, 6, -9, 13, 0, 5, 1, -12, 13, 10, -9, -12, 16, 9, 15, 9, 4, -5, 6, -8, -9, -7, -4, 19, -2, -20, 10, -4, -18, 6, 11, -6, -10, -13, 13, 14, 6, 20, -5, 12, -4, 9, 10, -20, 5, 11, -13, 1, -13, 4, -13, -11, 19, -16, 7, -2, 8, -1, -3, 19, 11, 18, -7, 18, 20, 2, -10, 10, 18, 19, -1, 11, 4, -12, -5, 8, -1, -13, -8, -4, -8, -11, -3, -1, -14, 14, 10, 17, -2, -4, 18, -7, 20, -3, -8, 18, 10, -11, -6, -10, 7, -16, -8, -5, 4, 0, -4, 15, 3, 1, -10, 9, -9, 2, -2, -9, 16, 0, -4, 12, 14, 3, 7, 12, -3, 19, -5, -9, -5, -7, 14, 7, -8, -1, -12, -16, -3, 7, 3, -9, -21, -7, -3, 14, -10, 10, -9, 20, 0, 12, 8, -13, 1, 3, 10, 14, 13, 7, 2, -9, 6, 1, -6, 5, -8, -6, -21, -6, -9, -7, 15, 16, -2, 13, 3, -9, -8, 6, 2, 6, 19, 7, 8, -3, -9, 0, 9, 19, 3, 6, 6, 7, -10, 6, 1, -2, 10, 18, 1, 12, 1, 14, 13, -5, 2, -6, 13, 12, 8, 4, 2, 3, 11, 19, -9, -5, 10, -3, -12, -14, 6, -1, -3, -12, 0, 3, 8, -12, 14, 10, 14, -5, -5, 10, -4, 21, 3, -2, -8, 10, -8, -12, -7, -5, 1, -8, -8, 10, -5, 11, 1, 0, -11, 3, 16, -10, -11, 9, 5, 13, 8, 13, -7, 5, -1, -8, 10, 16, -5, -5, -11, 14, 10, -3, 1, -7, -18, 10, 0, 12, 7, -13, -2, -11, -12, 12, 15, 16, 14, 0, 14, 4, 5, -11, -13, 7, 21, -12, -7, -14, 7, -6, -9, -19, -15, -12, -13, -14, 8, -1, 20, -7, -3, 3, 8, -5, 7, 17, -13, 8, 1, 8, -4, -3, 8, 10, 11, -14, -1, 11, -8, -6, -14, -8, 4, 8, 4, 10, -1, -10, -12, -7, 12, 2, 11, 12, -5, 17, -5, 11, 7, 15, -12, 2, -2, -3, -16, -18, 10, 3, 1, -7, -4, 2, 18, 3, 8, 21, 15, 7, 20, 17, 0, 17, 15, -9, 10, -4, -11, 17, 16, 12, 1, -2, 8, -11, 5, 6, 11, 10, 11, 1, 15, -5, -9, 19, 8, 8, 13, -13, -6, 4, 12, 6, 10, -8, 2, 16, 7, -7, 0, -4, 13, 0, 11, 5, 10, -2, -8, 11, 15, 6, -10, -2, 15, 2, -1, 8, -7, 7, 1, 17, 11, -10, 4, 7, 0, 7, -8, 14, -13, 13, -1, 2, 11, 4, 1, 5, 20, -13, 5, 9, 3, 3, 14, -10, 5, -19, -11, 5, 6, -21, -11, -22, -2, 9, -15, 1, 7, -8, 11, -3, -8, -3, -23, -16, -3, -20, -5, 7, -16, 3, -11, -17, 4, -3, -9, -13, -14, -22, 6, 9, -18, 4, 8, -20, -4, -21, 3, 2, 7, -12, -12, 12, -11, -5, -17, -15, 9, -6, -1, -23, -11, -5, 6, -8, -19, -20, 5, -17, -8, -10, 11, -12, -8, 3, -1, -4, 15, 7, -14, -5, 8, 8, -14, -9, -20, 6, -14, -22, -18, 8, -12, -8, -4, -10, -15, -2, 0, 1, 13, 14, 3, 20, 9, 29, 4, 0, 1, -9, 2, -7, -17, 0, 13, -10, 5, -1, -24, -12, 1, -11, 2, -21, 11, -1, 3, 22, 27, 10, 11, 31, 5, 6, 20, 28, 12, 3, -11, 6, -13, -14, 5, -16, 0, 10, -2, 2, 2, 3, 1, -14, 6, -6, 11, 9, 23, 6, 3, 8, 10, 7, -3, 3, 20, 15, 7, 0, -6, -28, -2, 9, -8, 11, 1, -23, -18, -21, 6, -14, 4, 13, 15, 19, 1, 14, -10, -2, -12, -15, 9, -13, 0, -6, -18, 8, -19, -10, 2, -14, 8, -22, 3, 7, -1, -17, -22, 0, 3, 4, 19, 7, 9, 7, 6, 0, 0, -15, -1, -1, -3, -20, 5, -15, -10, 10, -13, -12, -17, -11, 7, -14, -4, 1, 11, 21, 28, 15, 18, 16, 1, 18, -11, -11, -1, -9, -31, -12, -4, -15, -3, 13, 5, 4, 2, -22, -26, -8, -11, 1, -20, -18, 1, -1, 23, 0, 9, -1, 1, -11, -29, -2, -30, -3, -25, -12, -1, -2, 18, 33, 32, 6, -21, -19, -23, -22, 8, -3, 8, -18, -13, 8, 13, 29, 16, 2, -21, 2, -1, 2, -8, 3, -27, -9, -1, 11, 11, 11, 17, -7, 8, -6, -36, -4, -7, -10, 1, 7, 3, 16, 6, -12, -1, -14, 16, -6, -11, 17, 20, -6, 4, -4, 0, -4, 25, 14, -12, -6, 1, 0, -2, -6, -20, 6, -15, 2, -3, -10, -10, -29, 6, -10, 14, 6, 11, 12, 20, -2, 13, 4, 23, -1, -5, -10, -10, 8, 28, 20, 17, -19, -13, -5, 8, 4, -11, -13, -24, -6, -35, 9, -16, -3, 5, 29, 23, 0, 17, 18, 13, -10, -8, 2, 11, -3, 32, 6, -8, -1, 9, 10, 10, -21, -13, -30, -18, -3, -4, -22, -4, -5, 6, 1, 13, 35, 29, 25, 17, -26, -20, -18, -7, 2, 0, -21, 7, 9, -15, -6, -19, -9, 4, -31, -28, -7, -9, 2, 2, -7, 14, 8, 14, 33, 15, 10, -20, -30, 1, -15, -15, 8, -23, 1, 9, -11, -7, 5, -7, 8, 7, -14, -21, 0, 5, -14, 10, -6, 5, 10, 7, 20, -2, 20, -14, -34, 8, -26, 9, -10, 12, 15, -1, -13, 8, 10, -21, -21, -10, -3, 3, -11, -13, 18, 28, -3, 15, 7, 25, 0, -2, 4, -13, -22, -17, -19, -13, 7, 7, -9, -7, 10, -9, 1, 7, -11, -9, -11, -5, 5, -1, 13, 3, 9, 1, 17, 22, 17, -5, -5, -9, 12, -17, 3, 6, 9, 12, -17, 8, -7, 6, 4, 5, -22, -21, -1, -22, -6, 6, -8, 2, 22, 10, 10, 20, 0, 7, 4, 13, -7, -8, 0, 3, 5, 29, -26, 7, -10, -16, 8, 4, -6, -18, -14, -37, -10, 19, 14, 10, 34, 24, 23, 6, -4, -1, -4, 2, -7, 5, 29, 36, 16, -7, -18, 1, -11, -16, 6, 2, 11, 0, 9, -4, 17, 6, -8, 1, 3, 6, 8, 14, 14, 11, 5, 29, 17, 12, 18, 9, 19, 1, -3, -28, -6, -5, -6, -8, -18, 0, -8, 6, -4, 4, 8, 0, 19, 19, 24, 23, -8, 7, 5, -2, 15, 26, 2, 3, 13, 8, -24, -17, -21, -19, -13, -10, -23, -14, 2, 3, -6, -9, -11, -2, 8, -5, 12, 15, 6, 12, -7, -12, 20, 15, 14, 14, 20, -13, -24, 2, -10, -8, 10, -4, -10, -15, -19, -5, -23, -4, 8, -12, 1, 23, 22, 11, 16, 8, -3, -20, 0, 3, -5, 6, -3, -9, -13, 6, -17, 1, -1, 7, -6, -13, -4, -7, -18, -7, 4, -2, 4, -15, 10, 6, -6, 14, -6, 9, -23, -21, -4, -10, -24, -28, -19, -19, -18, -12, -19, -9, -11, -21, 2, -11, -4, -14, -3, 5, -27, -26, -34, -16, -24, -31, -26, -13, -18, -15, -23, -28, 8, -3, -5, -3, -12, -18, 10, -10, -2, -8, -22, -3, -9, 4, -9, 2, 3, 0, -4, -18, -14, -15, -1, -16, -10, -9, -12, -19, 6, -12, 7, -14, 4, 4, -14, -5, -7, -2, -21, 1, -4, 12, 14, -7, 0, -2, -8, 0, -17, -17, 5, -4, -12, 3, 0, 10, 7, -7, 1, 7, 3, -5, -1, -11, 0, -14, 9, 9, -19, -7, 10, 3, 0, -10, 6, -17, -8, 11, -9, -3, 7, 3, 4, -1, -17, -4, -14, 2, -1, -18, 9, -9, -12, -8, -2, -8, 8, -6, -16, -2, -15, -9, 2, 0, 3, -11, -26, -24, -8, -11, -12, 4, -2, -16, -11, -5, 12, 2, -4, -5, -19, -7, -2, 9, 6, -24, -13, -28, -31, -23, -41, -10, 14, -15, 24, 42, 33, -7, -12, -15, -24, -14, 4, -18, -19, 2, -9, -18, 4, -20, 8, 0, -8, 1, -1, -8, -6, -29, -13, -7, -23, -10, 6, 36, 38, 49, 36, -21, -9, -18, 4, 7, -20, -17, 12, -12, -16, -22, -8, 5, -12, 0, 0, -6, -5, -18, -33, -30, -11, 5, 11, 9, 42, 43, 77, 39, 8, 6, -11, -19, -18, 7, -3, 13, -9, -12, -22, 11, 5, -2, -31, 1, -9, -21, -3, -18, -35, 2, -26, 6, 32, 32, 81, 65, 58, 10, -16, -7, 7, 8, 0, -4, -1, 1, -25, -22, -15, -2, -4, 13, -17, 13, 9, 8, -25, -25, -30, -14, -5, 47, 81, 68, 52, 40, 24, -7, -11, 8, -8, 8, 4, -13, 10, -13, -12, -7, -1, 19, 31, 52, 31, -12, -14, -58, -63, -76, -14, 74, 71, 92, 93, 58, 8, -17, 2, 7, -7, -11, -8, 13, -18, 7, 17, 28, 38, 40, 35, 37, -3, -31, -53, -84, -74, -63, -9, 98, 98, 84, 79, 49, 2, -27, 0, 0, -18, 9, -16, -2, -24, -2, 36, 28, 22, 30, 12, 9, -12, -44, -69, -74, -100, -51, 36, 83, 82, 92, 88, 71, -13, -44, -23, -16, -7, -19, -15, -16, 5, 14, 12, 41, 41, 15, 1, -8, -47, -53, -73, -64, -80, -33, 26, 71, 70, 45, 69, 3, -10, -25, -32, 11, -4, 1, 8, -9, -19, -2, 32, 2, 12, -4, -10, -36, -42, -62, -46, -36, -56, 0, 53, 51, 37, 35, 39, 1, -14, -22, -5, 7, -19, 7, 8, -2, -7, -4, 22, 11, -7, -12, -35, -26, -37, -52, -39, -39, -46, 8, 38, 52, 22, 26, 29, -2, -4, -10, -21, -16, -10, -18, -4, -8, 7, 35, 21, 24, -4, 9, -7, -18, -14, 2, 5, -11, -30, 20, 26, 32, 34, 2, -2, -17, 0, -1, 0, -15, -8, 5, 8, -4, -8, 21, 14, 4, 16, -13, -28, -19, -32, -2, -20, -27, -24, 6, 26, 33, 12, -13, 18, -8, -5, 5, -16, 14, -6, 7, -13, -16, 18, 8, 21, 11, 12, -31, -23, -51, -21, 6, 2, 0, 6, 6, 22, 8, 0, 10, -17, -15, -27, -17, 11, -14, -7, -6, -6, -17, 35, 15, 26, 16, -7, -37, -41, -8, 7, 8, -7, 12, 11, 19, 26, -8, -19, -15, -13, -17, -24, -24, 2, -5, -1, 11, -17, -12, -6, 13, 8, 19, 13, -19, -43, 2, -9, 5, 6, 11, 4, 11, 2, 16, -31, -13, -23, -23, -33, 4, 5, 6, 3, -19, 11, 15, 2, 0, 34, 30, 39, 24, 1, 19, 21, 24, -5, 18, -2, 33, -6, -21, -43, -19, -19, -7, -6, -19, -11, 10, -17, 5, 15, 25, 10, 10, 1, 20, 9, 8, 2, -8, 12, -15, 9, 27, 4, -2, 0, 3, 1, -11, -19, -21, 2, -19, 4, -21, 13, -13, 12, 18, 7, -3, 19, 28, 24, 6, -1, 7, -5, -9, -28, -25, -4, 6, -10, -11, 13, 3, 6, -2, -3, -4, -6, -14, 13, 12, -6, -6, -5, -14, 20, 28, 28, 3, 14, 4, 10, 2, -15, 1, -22, -27, -9, 15, 13, 4, -13, -18, -4, -23, 9, 6, 1, -16, -16, 11, -34, -11, 41, 54, 27, -4, -20, 13, -9, -2, 0, -8, -28, -39, -36, -9, 4, 4, -22, 3, -9, 14, 5, 1, -11, -15, -5, 11, 11, 21, 34, 13, 2, -5, -5, 1, 4, -27, -18, -27, -17, -41, -49, -23, -17, 4, -28, -1, -5, 1, 6, -9, -2, 11, 0, 2, -8, 11, 26, 7, -8, 0, 15, 3, 7, -14, -18, -11, -20, -52, -40, -28, -8, -26, -33, -17, -19, -8, -7, 0, 5, 8, -9, -21, -5, 14, 9, 10, -4, 18, -8, -26, -8, 7, -3, -8, -12, -37, -33, -31, -11, -3, 7, 0, -3, -12, 6, -16, 1, -14, 11, 12, 5, 1, -12, 7, -15, 7, -19, -6, 5, -11, 4, 0, -6, -12, -21, 1, 14, 12, -11, 7, -3, -20, -15, -19, -11, -12, -16, -3, -4, -1, 15, -8, -9, -2, 4, -11, 9, 1, 2, 5, 8, -17, -6, 7, 8, 8, -3, 16, 7, 7, 1, -11, -12, 10, 16, 7, -9, 4, -7, -13, 8, 16, 15, -1, -8, -9, 1, 13, -12, -1, 3, -8, -8, 10, 1, 3, 6, 12, -4, 11, -10, -9, 7, -3, 18, -4, 15, 8, 21, -10, 6, 18, 13, 10, 26, 5, 11, -7, 11, 3, -2, -17, 4, 6, -10, -3, 0, -15, 3, -9, 10, -15, -4, 8, 16, 15, -3, 27, -1, 25, 13, 23, 37, 38, 0, -17, -16, -29, -34, 0, 19, 0, -1, 2, 3, 17, 11, 13, -17, 15, 18, -11, -10, -12, 29, 21, 21, 15, 18, 35, 30, 8, 0, 12, 4, 1, -21, -11, -9, -19, -19, -17, -17, 17, 15, -1, 6, 13, 1, -10, -13, -2, -4, 11, 11, 3, 28, 17, 6, 22, -11, -26, -1, 2, -17, -12, -20, -35, -38, 2, -1, 3, 3, 17, 16, 11, 10, -9, -3, -6, 3, -10, 2, -6, 29, 14, 12, 13, -11, -14, -7, -1, 7, -17, -15, -36, -32, 4, -16, 11, -4, 3, -13, 1, -15, 6, -2, 1, -7, 14, -7, 31, 32, 4, 10, -25, -23, -35, -2, -21, -14, -24, -32, -23, -3, 1, -5, 16, 9, -14, 9, -15, 16, -11, 2, 12, 15, 2, 12, 33, 27, 4, -12, -28, -21, -9, -17, 8, 6, 9, -26, -25, -4, -5, -10, 12, -5, -7, -4, -13, 8, 16, 11, 4, -5, 26, 17, 50, 16, 2, -23, -34, -11, -13, -4, 2, 35, 4, -36, -5, -6, -15, -4, 17, -3, 0, -15, 4, 8, 24, -1, 24, -1, 15, 25, 31, -13, -42, -52, -6, -28, -19, 16, 22, 18, -5, 2, 10, -2, -23, -18, 11, -15, 6, 12, -13, 14, 16, 28, -4, 14, 27, 33, -10, -40, -55, -65, -30, 18, 10, 2, 8, 24, -2, 2, 16, 22, -23, -9, 0, 9, -17, -18, -2, 9, 22, 29, -5, 2, 6, 6, -30, -77, -71, -40, -18, 12, 11, -10, 5, -3, 17, 20, 43, 23, 4, -7, -4, 3, -5, -14, 3, 46, 15, 32, 19, 19, 25, 0, -42, -105, -74, -37, -14, -6, -12, 19, 5, 3, 16, 21, 32, 27, 7, -19, -13, -7, 5, -9, 18, 34, 35, 22, 33, 41, 3, 7, -40, -89, -76, -36, 12, -7, -15, 18, 4, 2, 10, 36, 46, 46, -11, -11, -9, 14, -14, -10, -15, 10, 55, 26, 47, 26, 27, 21, -48, -50, -47, -15, 1, -30, -19, -20, 16, 22, 25, 16, 42, 25, 10, -16, 10, 7, -14, -14, -15, -2, 44, 38, 35, 45, 21, 47, 9, -15, -14, 29, -8, -32, -33, -24, 19, 29, 7, 44, 26, 13, 1, -2, 4, 14, -11, 12, -6, -18, 47, 16, 50, 46, 39, 39, 61, 31, 10, 12, -10, -15, -5, -3, 5, 24, 10, 47, 18, 24, -6, -8, 7, 1, 6, -13, 7, -18, -2, 27, 25, 44, 33, 35, 34, 32, 13, 9, -24, -10, -18, 9, 7, 19, 19, 24, 8, 1, -7, -17, -6, 16, 7, -4, 5, -27, -13, 12, 15, 17, 48, 34, 44, 12, 19, -8, -4, -30, -6, 7, 10, 20, 24, 12, 18, 14, -21, -6, 7, 13, 14, -3, -20, -36, -12, -8, 16, 9, 29, 16, 27, 19, -6, 13, 1, -6, 6, 18, 35, 12, 13, 6, 0, 7, 3, -4, 10, 0, 13, -8, -27, -16, -25, -47, -3, -26, -7, 5, -1, 5, 18, 19, -4, 13, -8, 6, 9, 16, 1, 0, -19, 0, -1, -15, -2, 11, 7, -17, -5, -7, -52, -59, -33, -51, -21, -31, -19, -7, 19, 10, 27, 32, -2, -12, 6, 5, 2, -20, -15, 0, -12, 15, -1, 15, 13, 12, 1, -1, -28, -37, -35, -67, -69, -45, -19, -25, -6, 22, 27, 9, 11, 11, -4, 5, -9, 1, 14, 8, -10, -3, 0, -13, 11, -3, -3, -4, -16, 3, -8, -14, -29, 10, -20, -5, -10, -8, -16, -37, -24, -7, 2, 2, 19, 7, 4, 4, -4, -16, -15, 14, 8, 3, 3, -13, -4, 13, 4, 9, -4, -1, 9, -28, -20, -34, -17, -42, -22, -24, 14, 17, 18, -3, 19, 7, 7, 5, -7, 2, 15, 0, -14, -3, -1, -1, 4, -5, -4, -12, -8, -2, -24, -8, -27, -22, -5, -27, -6, 2, 15, 5, -9, 1, -9, -9, -14, -17, 13, 7, 17, 13, -14, 12, 11, -13, -1, 14, -13, -7, -8, -3, 2, -12, -12, -9, -11, 20, -9, 4, 7, 0, -15, 13, -16, -6, -8, -10, -12, -6, -16, -3, -13, -2, -21, -12, -1, -15, 10, -20, 8, -17, -6, -18, -2, 6, 5, -4, 2, 3, -14, -13, 2, 5, 4, -14, 10, 10, -2, 5, 5, 11, 6, -5, 15, 11, -15, 2, 6, -10, -10, 6, -10, -15, -4, -5, -8, -20, 0, 5, -5, 6, -11, 0, -6, -10, 12, 3, 8, 10, -6, 18, 21, 12, -7, 0, 1, 7, 18, 11, 19, 1, 12, 0, -15, -2, -16, -6, 13, -10, -7, 4, -7, 6, 2, 1, -6, 3, 4, 8, -3, -3, -2, 4, 3, -6, 5, 8, 35, 32, 16, -6, 16, -12, 8, -1, 12, -8, -6, 1, 9, -20, -20, -11, -14, -7, 11, -10, 17, -2, 4, 9, -1, 21, 18, 17, 36, 29, 19, 30, 7, -1, 12, -5, 8, -1, 2, -11, -8, -2, -22, 9, -2, 24, 37, 27, 31, 33, 22, 27, 28, 34, 30, 37, 27, 34, 30, 40, 15, 26, 12, -20, -18, -4, -8, -11, -6, -14, 3, 9, 27, 23, 16, 32, 42, 51, 59, 74, 61, 52, 31, 49, 34, 42, 15, 6, 16, -5, -7, -18, 12, -17, -10, 5, 3, -17, -24, 8, 19, 45, 33, 24, 42, 47, 61, 27, 11, -5, -9, -5, -18, -7, 5, 1, -44, -4, 10, 8, -4, -3, -17, -5, -17, -26, -4, 15, 11, 20, 23, 34, 32, 13, -20, -19, -32, -42, -71, -49, -45, -46, -50, -33, -52, -54, -25, -10, -1, 5, 12, -9, -4, -8, -9, -2, -3, -2, -16, 3, -9, -34, -61, -54, -52, -66, -64, -69, -80, -75, -72, -63, -46, -33, -14, 5, 12, 9, 1, 1, -12, 10, -3, 0, 8, -10, -1, -30, -27, -65, -38, -40, -44, -18, -10, -35, -39, -45, -37, -58, -39, -16, -9, -6, 6, 12, -10, -19, 2, -1, 11, 14, -29, -18, -23, -27, -35, -42, -27, -7, 22, 31, 29, 22, 23, 7, -5, -26, -9, -27, -7, -5, -17, -15, -7, -5, 12, 12, 3, 6, -24, -28, -23, -28, -48, -48, -18, 1, 32, 30, 29, 38, 27, 20, 17, 9, -8, -22, -20, -21, -19, 12, -12, -11, -3, 15, -5, -17, 2, -19, -2, -22, -10, -22, -8, -2, 22, 7, 28, 24, 21, 14, 12, 10, -21, -9, -6, -9, -7, -21, 8, 11, 8, 16, -46, 0, -1, -1, 3, -8, -21, -40, -13, 1, -7, 13, 17, 12, 19, 38, 15, 7, -23, -1, -24, 7, 6, 8, -1, 11, -12, -2, -29, 9, -8, -3, 10, -10, -17, -38, -6, 2, 13, 24, 28, 28, 1, 29, 24, -15, -10, 23, 16, 11, -16, -1, -2, 6, -10, 0, -23, -5, -29, -23, -18, -32, -9, -34, -20, 7, 22, 18, 18, 9, 1, 5, -2, 5, 2, 27, 32, 15, 10, 2, 11, -12, 15, -13, -8, 16, -42, -2, -30, -11, 1, -12, 9, -3, 29, 12, 8, 1, 13, -13, -2, -11, -6, 12, 34, -4, 12, 2, 6, 11, -6, 17, 27, 25, 2, -7, -20, -18, 3, 14, -3, 8, 18, 10, 1, -5, 6, 2, 10, -19, -8, 30, 35, 9, -6, -20, -11, -14, 14, 27, 29, 32, 23, 39, -1, 16, 9, 20, 36, 9, 20, 4, -2, 2, 4, 13, -5, -2, 11, 13, 6, -7, 6, -16, -15, 13, 6, 17, 22, 7, 14, 22, 26, 31, 41, 25, 9, -1, 19, 24, -3, -14, -13, -28, -5, -19, 4, 14, 2, 10, 9, 11, 8, 6, 3, 10, 33, 36, 28, 16, 15, 30, 9, 7, -12, 11, 1, -2, 0, 7, -5, -4, -11, 11, 20, 12, 1, -4, -17, -18, -18, -19, -17, 2, 15, 25, 12, 29, 19, 17, -2, -12, -8, -10, -18, 12, -22, -13, -14, 9, -4, -3, 22, 17, 0, 1, -6, -20, 9, -10, -1, -1, 16, 17, 4, 22, 6, 11, -31, -37, -28, -7, -11, 5, -5, -9, -12, 6, 18, 19, 11, 9, 15, -2, -19, -17, -12, -17, -21, -21, 15, 13, 29, -17, -3, -33, -41, -13, -15, -20, -8, -22, 7, 19, 27, 25, 31, 32, 17, -13, -6, -18, -2, -7, 11, -17, -7, -8, 6, 7, 10, 7, 0, -43, -29, -10, -1, 13, -4, 18, 24, 20, 18, 40, 17, 14, 1, 15, -3, -15, 7, -21, -7, -2, -17, -14, 8, 15, -9, 7, -5, -7, -8, 0, 9, -3, -9, 20, 12, 6, 12, 27, -6, 9, 14, 6, 1, -20, -14, -10, -19, -3, -21, 5, 5, 13, 4, -1, 12, 10, 13, -16, -12, 6, 7, -17, -2, 8, 8, -8, -5, 4, -22, 7, -14, 11, -7, 14, -20, 9, 11, -6, -8, -18, -16, 7, 8, 13, -7, -1, 10, -10, -10, 7, -9, 13, -3, 2, -12, 6, 13, 4, 0, 2, 12, -6, 10, 3, -9, -13, -8, 0, 3, 12, -9, 11, -6, 3, 4, 2, 13, -6, 18, 2, 9, -14, -13, -2, 3, 11, 11, -9, -14, -6, -19, -8, 5, -3, -6, 10, 13, 12, 12, 0, -8, 3, 2, 16, 14, 11, 7, -2, 19, 7, 13, 1, -12, 14, 5, -4, 14, -11, -9, -11, -13, -19, -18, 6, 3, 9, 7, -16, -8, -13, -5, 16, 15, 17, -1, 24, 0, 12, 0, 21, -4, 17, -6, -5, -13, 7, -7, -8, -17, -3, -4, -14, -29, -21, -24, -17, -39, -31, -2, 13, 6, 1, 22, 21, 2, 11, 20, 5, 3, -6, 3, 6, 4, 6, -14, 2, -21, -20, -40, -19, -18, -24, -3, -3, -26, 1, 19, 9, -2, 17, 4, 4, 9, 25, 30, -12, -9, -6, -12, 6, -17, 4, 8, -3, -22, -17, -38, -20, -11, -20, -9, -12, 10, 17, -9, 10, -3, 1, -3, 2, 14, -5, 4, 12, 20, -1, 24, -13, -15, -6, -1, -6, -31, -38, -41, -28, -16, -23, 4, 7, 3, 21, -6, -20, 4, -6, 4, 27, 17, 13, 3, 5, 23, 21, 10, -5, -14, -19, -6, -7, -9, -22, -30, -3, -4, 0, 11, 10, 26, 1, -10, 7, 3, -1, -8, -15, 16, 19, 25, 16, 30, 39, 6, -6, 8, -11, 13, -9, -25, -21, -20, -38, -28, -18, 24, 15, 18, 17, 11, -19, -37, -15, -9, -22, 7, 6, 19, -9, 26, 44, 23, 14, 5, 8, -4, 9, -30, -10, -18, -42, 7, 10, 30, 30, 17, -7, 7, -16, -19, -5, -6, -4, -27, -13, -6, 5, 28, 41, 16, -10, 8, 11, -14, 3, -1, -28, -4, -3, 18, -10, 24, 5, 14, 22, 16, 7, -27, -28, -29, -8, -28, 2, -1, 13, 26, 20, -12, 1, -5, 12, -7, -19, -16, -4, -3, 6, 27, -11, 14, -10, -4, 16, 5, -26, -7, -6, -13, -24, -34, -4, 22, 0, 39, 35, -8, 6, 9, -19, 9, 10, 4, -2, -7, 19, 23, 6, 7, 19, 17, 30, -7, -4, -5, 5, -4, -9, -12, 13, 19, 10, 17, 16, -15, -9, -11, -2, -1, -17, -21, -25, -5, 23, -3, 5, 27, 23, 38, 18, 16, -12, -9, -3, 2, -19, -15, -8, 6, 12, 4, 2, -11, 8, -15, -5, -5, -16, 6, -11, -14, -1, 5, 23, 33, 39, 17, 10, 8, -9, -2, 0, -24, -7, -4, 7, -12, -18, 4, -23, 2, 6, 4, -14, -16, 5, -27, -28, 10, -5, 33, 18, 42, 42, 33, 13, -9, 5, -17, -4, -10, 2, -20, 11, -6, -21, -6, -8, 3, -5, 9, -14, -1, -22, -36, -31, 0, -1, 12, 28, 19, 11, 20, 29, -8, 16, 3, -20, -14, -17, -2, 20, 14, -17, -21, 3, 4, -14, -1, 13, -16, -21, -35, -4, -11, 23, 22, 17, 19, 29, 3, 10, 14, -15, -5, -7, -22, 8, 6, 17, -4, -15, -21, 6, -26, -17, -17, 13, 4, 2, -14, -7, -5, 7, 0, 2, 21, 17, 8, 9, 21, -11, -31, -29, -14, 5, 0, 9, -4, 0, -25, -14, -2, 8, -9, -15, -10, -14, -31, -15, -11, 0, 1, 15, 11, 21, 28, 25, 8, 13, -22, -12, -18, 4, -8, -27, -28, -18, -11, -18, -7, -21, -6, 2, -13, -10, -32, -14, 16, 10, -3, 1, 7, 30, 5, 28, 4, 23, 6, -11, -10, 2, 4, -6, -20, -16, -13, 2, -22, 13, 6, 4, -3, -1, 0, -12, 4, -2, -12, -7, 20, 33, 8, 15, 34, 32, 13, 4, -19, -7, -20, -36, -7, -22, -16, -25, -10, 11, 8, -4, 14, -19, -3, -23, 2, -5, -13, 17, -8, -6, 11, 24, 7, 27, 9, 4, -14, -24, -32, -34, -26, -13, -12, -5, -1, -1, 0, -9, 10, -18, -9, -20, -36, -21, -28, 6, -11, 4, -13, 0, 16, 17, 9, 19, -30, -29, -17, -12, -28, -24, -21, 2, -9, -11, -13, -13, 10, -3, -4, 7, -17, -39, -26, -45, -25, -4, 4, -1, -1, -17, 6, -5, -6, 8, -15, -17, -24, -9, -18, 1, -13, -2, 14, 10, -16, -8, 11, -11, -2, 2, -5, -1, -6, -6, -25, 0, -20, -7, -31, 1, 1, 4, -11, -10, 6, -11, -14, 7, -9, -3, -7, 4, 9, -18, -17, -11, -5, -13, 0, -13, 12, 4, -18, -21, -12, -17, -7, 6, -19, -11, -15, 10, 13, -18, -13, -12, -11, -15, 0, -24, 3, -5, -2, -22, 10, -11, 4, -13, -14, -7, 10, 3, -13, -19, -11, 2, 11, -20, -20, 11, -16, -10, -19, -5, -22, -15, -2, -8, -12, -4, 8, -4, -5, -17, 5, -18, -23, -5, -5, -23, 8, 9, -22, -21, -18, -1, 4, -10, -8, 4, -11, 11, 6, -14, -6, 7, -17, -10, 7, -18, 3, 6, -16, 5, -8, 4, -9, -18, 9, 9, -1, -7, -26, -27, -4, -14, 2, -6, 0, -9, -4, -8, -11, -18, 6, -20, -3, 9, -1, -17, -7, -16, 20, -2, 11, 24, -1, -7, -13, 7, 15, 0, -4, -14, 2, -13, 3, -7, 6, 7, 9, -7, -14, -6, -9, -10, 2, 18, 15, 8, 11, 16, 13, 9, 9, -1, -11, 6, 13, -15, -1, -8, -27, -27, -3, 8, -8, -24, 7, 6, -14, -14, 5, 5, -17, 21, 26, -5, 4, 19, 14, 22, 5, -2, -4, 23, 24, 8, 16, -13, -27, -25, -6, 3, -20, 2, -1, -5, -16, 0, -9, -5, 12, -3, 16, -8, 29, -4, 1, -14, 2, -4, 29, 19, 8, 21, -2, -6, -34, -34, -14, -34, -4, -8, -16, 2, -18, -4, -3, 14, 19, 17, 9, 10, -6, -6, -1, -6, 13, 1, 7, 17, -2, -7, -22, -13, -3, -5, -37, -5, 6, -13, 11, -21, 9, 5, -9, 22, 2, -5, -27, -22, -26, -22, -7, -10, -17, 4, 14, 16, 1, 4, 5, -13, -1, -2, -10, -45, -27, -23, -22, -21, -2, -12, -22, -12, 20, 5, 2, -4, -17, 0, -8, -27, -13, -4, -11, 6, -6, 20, 24, 6, -11, 8, -7, -35, -42, -16, 8, -16, -3, 3, -15, -1, -11, -11, -14, -15, 2, -6, -6, -17, -20, -29, -17, 12, 11, 21, 2, -2, -26, 4, -2, -37, -34, 1, -3, -16, 0, -29, -8, -14, 1, -6, -9, 2, -9, -20, -23, -28, -25, -31, -19, 11, 25, 22, 17, -3, 10, -24, -25, -35, -19, -15, 9, -5, 2, 2, -13, -24, -1, -17, -21, 5, 13, -8, -4, -18, -21, -24, -2, 17, 17, 9, 22, 18, -6, -10, -16, -13, -25, -19, -1, -23, 1, -20, -26, -11, -19, -2, -12, 14, 5, 4, 9, -4, -6, -8, -15, 25, 20, 21, 17, -2, -7, 3, 12, 11, 12, -17, 8, 6, 10, 4, 6, -2, -3, 4, 27, -9, -4, -15, 12, 26, 12, 14, 5, -2, 30, 12, 19, 5, -2, 10, 1, -4, -12, 11, 2, 1, -5, -24, -17, 22, 21, 22, -3, 5, 1, -4, 19, 0, 23, 2, -3, 33, 9, 8, -1, 5, 13, 15, -1, -5, 10, -14, -9, -18, -2, -5, -4, 7, 7, -6, -7, 8, -14, 19, 13, 26, -4, 6, 13, 8, 11, 28, -3, 4, -5, 1, 2, 9, 23, 8, -7, -20, -17, 13, 10, 19, -10, 11, -4, 7, -3, 9, 7, 31, -4, -3, -17, 12, 10, 20, -2, 1, 11, -3, 5, -26, 12, -13, 11, 5, 11, 9, 16, 19, 16, 13, 16, -3, -3, -10, -7, 22, 21, -5, 23, 27, 21, -8, -4, -9, 13, 15, 2, 10, 16, -8, 6, 8, -19, -16, 3, -2, 6, 12, 0, 10, 5, -4, 25, 18, 20, 1, -9, 10, 16, -5, -15, -10, 6, 17, 8, -23, -11, -1, -2, -13, -24, -20, 10, 6, -4, -2, 6, -1, -7, 10, -10, 10, -16, 12, 18, 8, -11, 6, -4, 0, 1, -9, -3, -6, -3, -17, -9, -17, 0, -17, -4, 8, -25, -11, 3, 10, -4, 5, 9, 8, -17, 10, -6, 19, 10, -4, -2, -12, 9, 23, 8, -2, -17, -18, -14, -22, 7, 0, 8, 2, -34, -3, -12, 5, -6, 18, 0, -4, -13, 1, -23, 8, -7, 6, 14, 17, 19, 16, 16, -2, -18, -23, -15, -21, -15, -4, 6, 13, -29, -11, 0, 9, -15, -13, -10, -4, -8, -6, -2, -5, -8, 9, 7, 17, 18, 15, -3, -17, -6, 9, -8, -19, -15, -7, 13, -16, -14, -6, 1, 13, -2, -7, -2, -13, -12, 1, -16, -7, 24, 18, 9, 16, 22, -2, 17, -10, 1, 7, -16, -9, -13, -5, -16, -16, -9, -4, 20, 16, 2, 12, -4, -9, -14, 12, -14, -4, -16, -11, -17, 11, -13, -19, 5, -18, -1, 8, -1, -3, -3, -1, -3, 5, 18, 4, 13, -18, -2, 2, -2, 10, 13, 0, -16, -22, -14, -3, -22, -21, -5, 5, -11, -11, 2, -4, 1, -14, -22, -10, 6, -15, 8, 8, 3, 10, -9, -6, -18, -23, -15, -2, -15, 0, -2, -15, -16, -17, -10, 5, -2, -22, -14, 8, -17, -3, -20, -1, -4, -14, -17, -1, 12, 5, -13, -20, -8, -2, 5, -2, 3, -2, -20, -5, -10, -7, -15, -17, 5, -16, -5, 10, -4, -11, 13, 8, 10, -18, 3, -11, 11, -11, 11, 10, -16, -5, -16, -16, -8, 4, 8, 7, -3, -2, -1, -10, 1, 4, -4, 8, -16, 7, 8, 4, -10, -13, 8, 6, 13, 13, -4, 3, 29, 23, -10, -2, -6, -14, 10, -6, 2, 16, 6, 0, -6, 11, -4, -19, 13, 13, -16, 2, 0, -12, -14, 6, -3, 21, 32, 31, 18, 24, 13, 17, -4, 10, -9, -17, -16, -27, -18, -8, -11, -14, 11, -8, 3, -20, -17, -15, 10, -10, -9, 11, 25, 23, 29, 16, -8, 15, 9, 8, 17, 27, 1, 15, -12, -13, -43, -17, -7, -18, -25, -16, -12, -13, 5, 2, 7, 0, -13, -15, 8, -3, -22, -14, -5, -11, -20, 4, 11, 31, 23, 21, 20, -3, 3, -6, -30, -34, -3, -15, -11, 0, -10, 0, 10, -2, -13, 1, -31, -22, -31, -7, -17, -8, -22, -7, -5, 10, 6, 33, 14, 18, 22, -3, -17, -38, -31, -3, -3, -19, -13, -8, -15, -4, -27, -20, -32, -16, -11, -7, -5, -21, -16, -8, -8, 3, 7, 35, 13, 13, 23, 10, -7, -33, -16, -20, 3, -5, -14, 13, 13, -1, -21, -32, -12, -10, 2, -7, -25, -28, -7, -7, 11, 35, 7, 28, 28, 13, 14, 4, -25, -15, -28, -5, -17, 5, 2, -13, -11, -4, -9, 5, -17, -25, 2, -1, -34, 1, -5, 15, 27, 16, 22, 14, 10, 21, -21, -16, -9, -15, -34, -4, -3, 7, 5, 0, -7, -3, -2, 26, 6, 3, -7, -5, 3, -7, -7, -12, -16, 3, -14, 1, 25, 28, -3, 12, 25, -8, -20, -22, -20, -11, 4, 9, -12, -9, 27, 5, -7, 20, -1, -16, 1, -14, -13, -17, -60, -60, -41, -28, 8, 16, 29, 29, 17, -12, -20, -33, -6, 11, 10, -20, -8, -10, -5, 30, 14, 14, -10, -6, -16, -2, -1, -42, -36, -47, -50, 0, 10, 31, 15, 41, 44, 19, -1, -4, -17, -16, -21, 2, -1, 7, 2, 36, 7, 14, 8, -5, -21, -23, -17, -35, -54, -43, -42, 23, 21, 18, 31, 30, 44, 22, 20, 3, 11, -11, -17, 8, -1, 10, 10, 33, 36, 41, 13, 10, 0, -12, -6, 4, -21, -40, -35, 28, 30, 49, 26, 41, 21, 30, 17, -10, -13, -19, 11, -16, -2, 3, 38, 44, 48, 70, 46, 21, 6, 11, -2, -3, 3, -34, 9, 23, 29, 20, 28, 1, 7, 38, 31, 13, -16, -6, -3, -14, -15, -3, 24, 24, 20, 20, 40, 34, 25, 4, 12, -6, -17, 0, 26, 35, 17, 23, 15, 0, 6, 11, 17, 23, -8, -1, 10, 5, -14, 10, 11, 1, 16, 34, 36, 54, 47, 16, 7, 4, -17, 17, 22, 19, 18, -8, -11, 3, -12, -16, 35, 9, -1, 11, -9, 5, -20, 2, -20, 16, 6, 23, 29, 25, 28, -3, 18, 9, 2, 11, 36, 27, 18, 2, 12, 15, -1, 9, 18, -18, -16, 12, 5, -8, -6, 16, 14, -12, 8, -1, 8, 40, 40, 30, 1, -9, 16, 10, 17, 26, -4, -10, -6, 3, -7, -27, 0, 2, -18, -1, -4, 7, -8, 27, 23, 4, 26, 1, 16, 16, 14, -4, -9, 10, -10, 10, 19, 8, 33, 13, 14, 12, 15, -9, -16, 11, 13, 3, -7, 10, 5, 17, 15, 5, 8, 17, -10, 6, -5, 12, 17, 5, -2, 26, 13, 7, 20, -18, 3, 9, -3, -2, 10, -11, 6, -15, -17, -8, -4, -12, 19, 2, 14, 6, 25, 19, 7, -1, 5, 5, 8, -1, 13, -8, -6, -8, -18, 13, 0, 14, 4, 3, 5, -6, -19, -7, -15, -5, -18, -22, -16, 5, 17, 2, -11, -7, -15, -7, -20, -28, -24, -14, -17, -9, 5, 7, 17, -3, -8, 8, -15, -1, -21, -20, 0, -15, -11, -19, -3, -9, -30, -22, -12, -4, -19, -26, -42, -15, -19, -18, -12, -14, -10, -12, 23, 16, 15, 0, 0, 8, 13, 5, 9, -20, -11, -14, 9, -25, -9, -23, -32, -26, -8, -20, -29, -32, -35, -17, 20, 16, 25, -5, -7, -7, -16, -15, -18, -1, -2, 1, -4, -5, -2, -2, -6, -3, 20, 15, 6, 2, 16, 16, -14, -6, -9, -15, 6, 25, -2, 4, -9, -13, -7, 10, 5, -15, -5, -9, -15, 6, 2, 0, -8, -17, -3, 1, 2, -12, 11, 9, -6, -10, 9, 13, 12, -2, 1, -8, -18, -19, -10, 4, 8, -11, 8, 12, -11, 11, -10, -19, -4, 7, -4, -11, 5, -1, -11, 6, 2, 3, -11, 4, 6, 13, -16, 0, -13, -5, 15, -5, -7, 5, -9, -4, -6, 11, -16, 9, -12, -16, -7, 8, 4, -7, 13, -3, 4, 4, 0, 11, -7, 10, 6, -13, 3, -9, -6, 4, -18, -11, 10, 14, 11, 10, -18, -2, -14, -16, -4, 15, 8, 6, 1, 2, 11, -7, 5, -19, -5, -7, -17, -2, 4, 8, -9, -9, -14, -3, 4, -18, -9, 10, -2, -12, 0, -14, -10, -1, 23, 4, 35, 41, 38, 32, 9, -3, -14, -29, -21, -6, 0, -25, -7, 10, -5, -1, 4, -17, 4, -19, -6, -13, -3, -10, 14, -16, 26, 19, 30, 54, 53, 27, 34, 1, -23, -37, -52, -45, -33, -38, -11, -20, -19, -8, -1, -4, -11, -2, -26, 9, -20, 23, 5, 13, 2, 16, 37, 36, 58, 66, 47, 29, 8, -5, -21, -37, -30, -24, 1, -13, -14, 0, 14, -9, -8, -10, -20, -14, -1, -8, 2, 17, 3, 8, 26, 13, 41, 45, 74, 58, 22, 10, 13, -3, -55, -51, -21, -12, -7, -16, 0, -15, -4, -6, 1, 10, -1, -5, 1, 8, -6, -1, 0, -4, 27, 61, 44, 78, 36, 29, 39, -7, -37, -32, -11, -25, 1, 5, 4, -15, 11, -7, -13, 7, -14, -2, -4, -28, -53, -55, -44, 2, 6, 51, 47, 45, 30, 48, 33, 27, -4, -24, -12, -4, -1, -13, 2, -13, 10, 10, -6, -15, -19, -22, -25, -30, -56, -47, -30, -32, -18, 14, 37, 37, 31, 31, 27, 18, 3, -15, -22, -28, -1, -17, 6, 15, 9, -8, -7, -1, -32, -44, -22, -53, -15, -28, -53, -67, -44, 8, 29, 30, 24, 39, 18, 33, 7, -28, -4, -21, 4, 5, 16, -8, -18, -21, -29, -12, -19, -36, -27, -5, -9, -48, -35, -61, -74, -62, -6, 29, 39, 40, 48, 28, 12, -7, -22, 6, -1, -4, 5, -7, -15, -25, -27, -24, -6, 0, -8, 21, -5, -30, -51, -55, -41, -45, -7, 24, 50, 39, 26, 14, -14, -24, -3, -17, 1, 8, 2, -15, -3, -16, -2, -11, 1, 4, 6, 2, -16, 0, -34, -22, -26, -22, 11, 9, 34, -1, 21, -18, -18, -17, -7, 9, 15, 5, 0, -4, -9, -12, -13, 23, 19, 2, -2, 14, -13, -16, -5, -22, 6, 2, 12, 33, 21, 11, -4, -32, -28, -40, -23, 12, -4, -5, -8, -20, 10, 4, 14, 16, 27, 28, 9, -6, -14, -14, -19, -19, -7, 22, 1, 10, -29, -32, -7, -16, -31, -17, -17, 0, -5, 2, -4, -10, -7, 5, 7, 26, 13, -10, 24, 11, -13, -5, -16, -17, -13, -8, 1, -37, -39, -47, -29, -39, -38, -33, -12, 5, -17, 6, 3, -14, -4, 21, 19, 14, -12, -15, 18, -5, -11, -12, -28, -17, -8, 2, 0, -18, -48, -45, -39, -14, -20, -6, -9, 9, 15, -11, -2, -13, 0, 9, -8, -21, -9, -2, -6, 4, 6, -10, -16, -22, -12, -25, -4, -27, -39, -48, -23, 6, -28, -8, -2, -7, -5, 5, -7, 11, -17, 8, -4, 1, 16, 27, 11, 24, -3, 1, 0, -1, -22, 9, -18, -14, -1, -23, -13, 9, 12, -19, 0, -10, 4, 4, -2, -18, 10, 19, 1, 16, 5, 11, 0, 5, 33, 31, 15, 9, 12, 21, 13, -1, 12, 5, 1, 9, 20, 8, 11, 8, -11, 12, -8, 6, 14, 17, 19, 0, -1, -7, 25, 23, 26, -7, 9, 7, 0, 8, 15, 18, -5, 3, -9, 5, 10, 20, 7, 1, -7, 0, -1, 1, 10, -10, 8, 38, 15, 35, 25, 7, 33, 30, 12, 16, 1, -4, -13, -3, 9, -13, -17, 11, 10, 24, 6, -14, 0, -8, -17, 10, 2, -20, -13, -2, 27, 28, 24, 54, 31, 31, 10, -3, -15, -6, 15, -14, -24, -40, 6, -3, 22, 4, 3, 6, -9, 10, -9, -6, -2, 2, 9, -4, -1, -2, 12, 16, 28, 53, 20, -6, -13, -17, 14, 9, 1, -31, -2, -2, -17, 14, -3, 5, -15, -4, 6, -4, 1, -9, -8, -13, -2, -19, -2, -5, 8, 0, -23, -29, -13, -22, -20, -30, 4, -2, -13, -21, 7, 2, 1, -12, 11, 4, -17, 2, 11, 0, -15, -1, 15, 19, 1, 8, 4, -16, -3, -1, 0, -11, -7, 20, 19, 7, 5, 2, 2, -19, -10, -3, 1, 15, 1, 5, 9, -5, 9, -7, 5, 2, 6, 12, -5, -4, -7, 10, -18, -18, 6, -10, -1, 13, -4, -8, 8, 9, -7, 5, 2, -5, 8, -5, 5, -16, -13, -12, 1, 14, -2, 9, 11, -8, 14, 15, 0, 13, 5, 1, 11, 10, 8, 12, -3, -12, -14, -1, 11, 10, -7, -3, 11, 4, -2, 7, 10, -16, 10, 16, 17, 9, -7, 13, -7, 0, -1, -3, -11, 8, 8, -10, -5, 2, -17, 13, 15, -14, -2, -17, 3, 4, -14, -11, -5, -11, 0, -9, -6, 12, 14, 16, 36, 14, 11, 3, 0, 18, 4, 6, -16, 9, 3, 16, -7, -2, -14, 15, -8, 2, 8, -3, -11, -11, -10, -12, -22, -8, 37, 25, 39, 32, 31, 24, 13, 11, -10, 16, -5, -5, 13, -9, 6, -11, 4, 7, 7, -10, 4, -26, -8, -1, -23, -10, -14, 19, 2, 40, 37, 15, 32, 33, 9, -2, 13, 7, 11, -9, -1, -14, -1, 1, -4, -6, 9, -6, -19, -16, -6, -3, 15, 16, 28, 14, 44, 45, 18, 10, 0, 1, 11, -1, -5, 7, 2, 14, 16, -17, 16, 10, 17, -17, 1, -2, -13, -36, -3, 10, -7, 19, 30, 47, 37, 45, 16, 14, 2, 0, -12, -15, -11, -5, -8, -6, -4, -8, -13, 15, -9, 13, -22, -18, -20, -12, -18, -5, 15, 30, 63, 58, 51, 34, 13, 6, -29, -8, -13, -9, -16, -34, -16, -9, 10, -4, -14, 3, 12, 2, -16, -45, -32, -16, -2, 24, 27, 43, 39, 35, 25, 20, -13, -15, -42, -13, -38, -1, -24, -48, -24, -26, -9, -9, -15, -3, 7, 5, -27, -9, -33, -3, 0, 20, 34, 35, 48, 32, -16, -24, -35, -55, -40, -35, -32, -35, -25, -42, -23, 13, 13, 12, -7, 2, 3, -2, -9, -21, 4, 1, 16, 33, 43, 41, 20, 1, -27, -40, -51, -20, -22, -19, -23, -27, -26, -43, -17, -11, -6, 1, -13, 17, -7, 4, 2, -11, -22, 14, 13, 16, 26, 4, -20, -30, -31, -55, -2, -9, 29, 8, -4, 4, 5, -4, 13, -2, -29, -5, 3, 6, -19, -21, 7, -13, 12, 31, 16, 6, -9, 16, -12, -42, -32, -13, 2, 5, 15, 11, 6, 5, 6, 20, 18, 5, -23, 9, -14, -9, -16, -12, -21, 23, 10, 19, 28, 3, 22, 13, -11, -33, -16, -26, -14, 3, 14, -9, 24, 18, -9, 15, 14, 2, 0, 0, 4, 2, 12, -6, -4, 22, 0, 10, 24, 9, 6, -1, -8, -5, -11, -24, -12, 17, 13, 2, 11, 26, 8, 14, 22, 26, -1, 3, -17, 9, -13, -12, -6, -18, 7, 7, 2, 1, 7, 8, -11, 5, -23, -32, -25, -7, -13, 22, 1, 1, 14, 9, 10, 5, -20, -10, -13, 16, -5, -3, -14, 5, -13, -8, -5, 2, 17, -3, 25, -16, -22, -22, -17, 1, -11, 3, 22, 22, 9, -4, 10, -13, -15, 1, 10, 12, -16, -19, 1, -7, 13, 3, -10, -7, -2, 23, 2, -22, -34, -21, 3, -1, 10, -1, 1, -1, 10, -14, -18, -9, -13, -16, 12, 15, -2, 3, 5, -3, -2, 7, 1, -20, 6, 16, -6, -18, -41, -29, -6, -4, 20, 7, 21, 0, 22, -8, -28, 9, -22, -9, 1, -16, -2, 1, 8, -15, -24, 0, -13, -2, -3, -3, -18, -37, -30, -22, 27, 27, 19, 8, 32, 38, -1, -6, 8, 4, 4, -5, 6, 5, -6, -1, 1, 14, 11, -5, -16, -11, -3, -1, -21, -29, -16, 6, 27, 31, 43, 15, 31, 29, -2, 1, 4, -4, 7, 7, 16, 0, 13, 5, 5, -11, 14, 12, -3, 1, -9, 12, -19, 5, -4, 16, 42, 48, 21, 18, 20, 30, 7, 6, -1, 20, -4, 2, 8, -13, 14, 4, 7, -7, -1, -32, -11, -3, -19, -1, -9, 14, 8, 25, 18, 36, 30, 12, 1, 12, -8, -13, 21, 16, 17, 9, -15, 7, -10, -7, 6, -21, -6, -30, -51, -23, -33, -35, -28, -9, 11, 26, 21, 40, 18, -1, 13, -14, 8, -3, -8, 0, -7, 5, 11, 13, 0, -4, 8, 6, -16, 0, -8, -10, -35, -12, -18, 7, 3, -5, 19, 3, 2, 17, -7, 10, 9, 22, 12, 2, 0, -5, 10, -12, 8, -8, 11, 10, -2, -14, -15, -21, -13, -12, -1, 7, 9, 9, -8, 3, 8, 10, 23, 18, 26, 27, 8, 8, -1, -5, 1, -10, 7, -14, -9, 12, -5, -14, 7, -1, 10, 16, -8, -11, 22, 19, 4, 4, 12, 26, 0, 21, -4, -8, 16, -16, -10, 15, 16, 14, 9, 13, 12, -6, 10, 14, 11, 7, 15, 2, -17, 13, 10, 14, -12, -3, 0, 13, 5, -16, 8, -15, -17, 6, -5, 12, -13, 8, 10, 19, 0, 22, 8, 8, -3, 26, 15, 25, 5, 17, 16, -5, 15, 18, 12, 9, 6, 0, 15, 26, 9, 3, 26, 16, 12, 11, 12, 8, 0, 15, -5, 17, 21, 7, 9, -2, 8, -5, -5, 17, -2, 10, 24, 6, -6, 18, 25, 9, 25, 13, -4, 18, 2, 22, -6, 26, 14, -4, -5, 9, 12, 10, 2, 10, 22, 2, 21, 18, -4, 13, 19, 25, 2, 32, 13, 0, 24, 18, 0, 18, 2, 2, 5, 7, -3, 26, -5, 7, 18, 11, 6, -9, -9, -5, -2, -2, -14, -10, 4, -2, 20, 21, 4, 14, 23, 0, 10, 0, 15, -3, 10, 24, 3, 15, 24, 18, 2, -2, 7, -31, -28, -51, -33, -35, -35, -27, -20, -14, -2, 0, 8, 30, 8, 20, 13, 6, 27, 3, 11, 17, 15, 20, 0, 15, -20, 5, 1, -20, -32, -31, -20, -7, -23, -35, -11, -16, 3, 13, 6, -3, 24, 11, -11, 10, 15, 5, 26, 26, 4, 24, -1, -10, -16, -20, -17, -22, -31, -26, -11, -10, 1, 9, 22, 20, -3, 17, 1, 7, -7, 13, -5, 2, 17, 2, 24, -3, 12, -3, -2, -13, -31, -14, -42, -36, -36, -24, 13, 25, 37, 38, 23, 31, 8, 13, 20, 12, -10, -19, 1, 9, 5, 19, 25, 10, 18, 15, -17, -8, -24, -22, -34, -44, -14, 6, 7, 17, 6, 4, 19, 3, -14, -3, -12, -1, -8, -9, 10, -4, 5, 16, -6, 18, 4, 1, -34, -36, -36, -45, -43, -3, -1, 30, 12, 36, 13, -18, -41, -35, -12, -49, -35, -18, -30, -4, -20, 19, 5, 26, -4, 19, 11, 9, -31, -61, -52, -35, -7, 2, 7, 27, 50, 33, 0, -9, -13, -15, -47, -51, -55, -49, -8, -15, -9, 14, 18, 19, 15, 19, -3, -5, -24, -56, -19, 13, -2, 19, 13, 44, 41, 9, 19, 3, -21, -6, -12, -26, -26, -25, -17, -14, -23, -17, 8, 16, -6, 14, 15, -3, -40, -42, -31, 17, -6, 31, 38, 65, 35, 30, 11, 0, -13, -12, 5, 9, -10, -27, -24, -28, -9, 13, 20, -5, 18, 12, 12, 2, -35, -32, -1, -13, 5, 23, 13, 44, 22, 17, 36, 30, 27, -7, -10, -12, -10, -30, -37, -24, -25, 15, 1, 0, -3, 23, 14, -13, -8, -24, 3, -1, -1, 25, 4, 23, 25, -7, 30, 20, 30, 27, -12, 6, -40, -41, -24, -11, -12, 0, 24, 16, -2, 15, 15, -3, -17, -36, -5, -10, -2, 30, 31, 23, -4, -8, 32, 45, 11, 17, 6, -13, -17, -5, -18, -32, -14, -1, 9, 18, 3, 19, 17, 4, -12, -35, -2, 14, 9, 16, 20, 7, -10, 21, 38, 43, 34, -25, -22, -23, -38, -10, -13, -29, -16, 15, 10, -5, -2, 6, -7, 13, -8, -31, -11, 6, 3, 50, 3, 0, -11, 14, 40, 16, -15, -29, -12, -35, -23, -15, -19, -11, -9, -3, -6, 2, -6, 19, -1, -6, -11, -17, -16, -46, -20, -14, 9, -2, 28, 26, 30, -22, -37, -47, -11, -23, -18, -14, 4, -6, 12, 24, 7, 9, 1, -10, -18, -7, 10, -13, -17, -42, -49, -27, -10, 23, 18, 29, 3, -13, -34, -39, -30, -23, -18, 0, -8, -8, 18, 15, -2, 13, 23, -4, 4, -12, -4, -2, -19, -37, -45, -17, -31, -10, 13, 13, 1, -23, -23, -37, -11, -25, 2, 3, 11, 12, 21, 13, 9, 13, 24, -5, -12, -15, -25, -6, -23, -2, -26, -4, -28, -8, 15, 5, -20, -29, -39, -7, -10, -7, -7, 5, -2, 6, -1, -6, 1, 8, -2, 22, 7, -9, -27, -22, -6, -21, 6, -5, -25, 4, 9, -6, -12, -20, 4, -32, -30, 3, 20, 3, 21, 7, 4, 2, 12, 20, 21, 24, 20, -1, -33, -17, -23, -11, -7, 11, 6, -8, -1, 4, -6, -10, -14, -10, -17, 8, 3, -7, 3, 7, 23, 12, 6, 23, 8, 25, -2, 18, 1, 1, -1, 1, -8, -5, -30, 1, -17, 13, -10, -10, 4, 3, -8, 10, 9, 8, 10, -3, 7, -2, 1, 15, 23, -7, 14, -2, 16, -10, -17, -10, 13, -15, -3, 17, 29, 16, 15, 19, 29, 22, 24, 3, 2, 17, 5, 0, -6, -1, 9, -7, 11, -2, 27, 21, 10, 31, 26, 8, 40, 39, 12, 26, 21, 62, 20, 47, 19, 33, 8, 17, 15, -5, 7, -7, 8, 19, 27, 13, -1, 21, 22, 3, 2, 21, 15, 5, 1, 14, 0, 23, -3, -1, 13, 10, -2, 3, 16, 23, 6, 0, 7, 15, 1, -2, 7, -14, -11, 10, -11, 4, -9, -17, 12, -5, 10, -20, 2, 4, -6, 15, -11, 7, 4, -8, -9, 13, 2, 4, -3, -8, -19, 1, -17, 1, 11, -16, -14, -1, -11, -4, 10, 0, 9, -9, 7, 9, -13, -19, -8, -5, -3, -15, 14, 2, -7, 2, -4, -13, -15, -11, 7, 2, -15, -5, 9, 11, -7, -1, 8, 14, -6, 4, -20, 8, 7, -27, -22, -7, 7, -20, 5, -13, -14, 9, -19, 12, -11, -11, -18, 8, 5, 13, -9, -12, -9, 12, 6, -1, 3, 9, -5, 0, 6, -1, 0, 13, -2, 12, -2, 23, -10, -11, -17, 6, -10, -18, -2, 12, -11, -11, 1, 12, 5, -5, -4, 13, 23, 12, 28, 33, 20, 2, 28, 3, 15, 23, 12, -22, -8, -22, -35, -5, 2, 14, -14, 9, 5, -3, -15, 6, -3, 1, -15, -3, 15, 24, 16, 2, 6, 14, 2, 23, 3, -1, -20, -13, -7, -4, -8, -5, 1, -13, -12, -6, -7, 14, 8, 14, 10, 22, -1, -1, 13, 6, 11, -8, 3, 18, -18, 11, 6, 5, 12, 13, -11, 16, 4, 14, -2, 5, 11, -6, 3, 7, -15, -4, -4, -3, 1, 10, -12, -12, 15, -13, -2, -1, -16, 3, 5, 8, 3, 0, 19, 3, -11, -9, 8, -12, -8, -9, -10, -2, -20, -2, -22, -14, -15, 12, -18, 5, 11, -15, 11, 8, 8, 13, 23, 4, 4, 9, 19, 8, 1, 12, 31, -2, -18, -19, -11, -4, 0, -4, 5, -6, 17, -10, -15, -10, -2, -9, 6, 4, 14, 28, 11, -10, -1, 6, 20, 21, 16, 50, 16, -1, 6, 9, -17, -1, 6, -21, -6, -23, 5, 21, -9, 3, -17, -1, 3, 17, 11, 39, 33, -5, -13, -14, 9, 16, 27, 37, 31, -5, -15, -14, 0, -16, -7, 1, -4, -5, 15, 3, -10, -11, 18, 14, 21, 26, 35, 4, 1, 6, -12, -25, -1, 19, 17, 14, 16, 11, 8, 2, 14, 4, -13, 8, 3, 4, -1, 16, 5, 16, 23, 34, 36, 13, 4, -5, -19, -8, -3, 9, 11, 8, -5, -4, -1, 18, 8, 1, 10, -3, -15, -4, 24, 16, 13, 23, -4, 31, 18, 41, 6, -1, -44, -38, -18, -12, 3, 13, 11, 19, 13, -14, -9, -6, -7, 2, 9, -19, -18, -8, 7, 2, 2, 1, 8, 4, 6, 25, -3, -37, -23, -35, -26, -11, 6, 16, 24, 4, 15, 5, -27, -18, 5, -13, 8, -7, 2, 28, 41, 6, -19, -17, -5, -6, 0, -13, -24, -37, -26, -21, -25, 17, 4, 23, 22, 5, 12, 45, -7, 0, 7, -6, 10, 14, -4, 8, 22, 13, -31, -47, -60, -54, -20, -24, -27, -43, -13, -17, -14, 30, 27, 29, -3, 17, 7, 15, -17, 13, 1, -4, 5, -11, -3, 39, 27, 3, -7, -54, -40, -66, -43, -39, -38, -54, 2, -19, 25, 24, 8, 2, -2, 18, 3, -20, -10, 9, 9, -8, -7, 13, 2, 4, 6, 17, 10, -3, -28, -15, -26, -50, -39, -12, -1, 27, 24, -10, 13, -17, 14, 1, -15, -17, -10, -7, -20, -16, -13, -10, 21, 2, 5, 3, 4, -2, -9, 7, 7, 19, 12, 26, 29, 18, 14, 19, -24, -15, -3, 20, -1, 2, -21, 0, 13, -15, -5, -3, 0, 18, 25, 12, 18, 13, 26, 36, 38, 32, 59, 34, 18, 1, 5, 11, -11, 0, -11, 15, 5, 2, -4, -17, 13, -17, -6, 7, 5, 2, 7, 26, 22, 28, 11, 38, 19, 39, 38, 27, 27, 22, -18, -6, -24, -1, 0, 16, -14, -2, -13, -7, -11, 13, -19, 11, 4, -1, 0, -14, 1, 21, 35, 24, 36, 25, 18, 2, 18, -3, -7, 9, 8, -10, -11, 10, -1, 0, 2, -19, 13, -5, 4, -5, 1, -3, -5, -10, -1, 5, 36, 21, 47, 10, 7, -9, 2, 19, -4, -23, -41, -38, -21, -22, 8, 16, 8, -7, -19, 14, 13, 0, 3, -9, -12, -4, 15, 4, -5, -2, -17, -11, -11, 1, -6, -11, 22, 7, -32, -19, -4, -6, 4, -13, -9, -10, 7, -15, -20, -6, 4, 10, 9, 1, 20, 8, -10, -29, -31, -25, -44, -32, -12, -13, -6, 5, 3, 18, 11, -6, 13, -12, -7, -17, -17, -5, 0, -15, 0, 7, 12, -13, -8, -1, -27, 11, 0, -8, -10, 14, 4, 11, -3, 8, -10, 15, -10, -20, 12, 9, -18, -7, 4, 0, 14, 9, -18, -12, -3, -12, -7, -7, -1, -2, -9, 1, -10, 11, -1, -24, -2, 12, -15, 7, -2, 9, 7, -15, -12, -13, 6, 13, 16, -4, -4, -17, 10, -6, -10, 16, -14, 1, -2, -6, -5, 13, -16, -8, 3, 0, -8, 15, -16, 4, -10, 7, 11, -10, 17, 17, -11, 2, -16, 15, 11, 11, -16, 11, -2, 1, -12, -15, 6, 2, -12, -9, -2, 13, -6, 12, 8, 12, 2, 7, 12, -6, -11, 2, -12, -7, 9, -1, -5, -2, 13, -14, -10, -9, -20, -4, -10, 7, 1, -13, 4, -12, -10, 3, 15, 15, -16, -15, -16, 10, 6, 13, -11, 10, 7, -15, -3, 13, -17, -8, -15, -25, -26, 2, -5, -27, -25, -17, -7, -15, -9, -14, -8, -17, -15, -4, 11, 15, -8, 15, 17, -1, 13, -15, 19, 16, 1, -8, -5, -24, -8, 6, -4, -41, -15, -25, -22, -18, -27, -11, -6, 11, -12, -6, -17, -15, 9, 11, -15, -7, 14, 10, 29, 25, 34, 16, 24, 1, 15, -1, 3, 9, 27, 16, -32, -27, -16, -23, -24, 11, -12, 3, -18, 1, 2, -7, -5, 13, -4, 19, 11, 15, 25, 27, 5, 14, 14, 1, 1, 2, -11, 1, -22, -20, -6, 2, -15, -9, 6, 0, 1, -1, 14, -7, 9, 17, 24, 5, 28, 22, 10, -5, 6, -13, -13, 7, -12, -8, -25, -35, -8, -24, -22, -21, -14, -19, -1, 1, -1, -3, -5, -4, 3, 9, 23, 2, 19, 8, -14, -20, -22, -13, -4, -4, -19, -26, -25, -19, -22, -18, -10, -10, -37, 1, 1, -12, 7, 3, -16, -2, 14, 0, 17, 14, 8, -19, -23, -48, -46, -41, -15, -13, -9, 13, 19, 21, 9, -13, -15, -30, -8, -19, -12, -25, -25, -1, 1, 9, 7, 16, 28, 7, -23, -34, -41, -36, -38, -18, -15, -3, 38, 16, 24, 23, 11, -9, -9, 8, -12, -2, -27, -32, -13, -1, -17, 8, -10, 11, 5, 1, -9, -17, -32, -20, -27, -7, 28, 31, 17, 12, 43, 19, -5, -2, 3, -12, -35, -20, -44, -27, -14, -13, 6, -7, 15, -1, 16, 2, -10, -33, -14, 10, 20, 24, 46, 36, 29, 3, 37, 20, 6, -7, -23, -10, -22, -24, -48, 1, -5, -13, -6, 12, 16, -2, 22, -3, -5, 1, 15, 17, 35, 45, 41, 9, -9, -6, 4, 2, 24, 22, -18, -9, 1, -6, -6, 7, 22, -7, 10, -10, -11, -6, 13, 10, 24, 4, 14, 24, 15, -1, 13, 8, -8, -3, 8, 3, 14, 32, 12, 19, 45, 18, 16, 26, 17, -13, 14, 8, 1, 10, 6, 9, 20, 6, 2, 2, 16, 5, 0, -2, -4, 20, 31, 23, 39, 1, 36, 19, 32, 60, 24, 3, -14, 17, -16, -15, -2, 6, -3, -11, 1, 16, 3, 24, 5, -17, -1, 9, 7, 31, 31, 23, 39, 42, 24, 35, 39, 36, 40, -5, -19, -15, -13, 11, 16, 10, -9, -11, 7, -18, 1, -28, -18, -11, -37, -30, 14, 29, 33, 19, -4, 21, 11, 0, 32, 29, 15, 19, 6, 6, -5, 8, 15, -11, -6, -5, -9, -24, -34, -15, -50, -35, -45, -28, 19, 6, 11, -18, -27, -25, -35, -21, 4, 3, -6, -19, 6, -7, 14, -7, 12, -13, -11, -11, -21, -18, -14, -41, -56, -65, -52, -38, -24, -6, 5, 0, -28, -48, -36, -19, -14, -23, -46, -22, 9, -11, 3, -15, 14, -17, -9, -28, -24, -33, -27, -39, -53, -36, -46, -29, -8, 8, -13, -26, -14, -38, -20, -18, -40, -18, -44, -18, 12, -7, -9, -7, -15, -8, -8, -17, -37, -13, -29, -24, -26, -25, -23, 1, 7, -15, -5, 2, -33, -3, -12, -44, -20, -40, -37, -11, -2, -7, 16, -9, 6, 12, 7, 4, 5, -24, 2, 6, 18, 16, 16, 5, -9, 2, -14, -32, -18, -15, -12, -13, -14, -35, -19, -3, -14, -6, -16, 15, -8, 6, -6, -3, -6, 4, 17, 17, 15, 31, 7, 17, -14, 8, -7, -25, -15, -20, 3, -32, -13, -22, -10, -18, -1, 0, 11, 14, -13, 10, -1, 0, -2, 15, 27, 18, 34, 28, 32, 6, -2, 14, -14, -14, -24, 1, -11, 0, -20, -22, -14, 11, 0, 3, 9, 16, 16, -1, -8, 6, -2, -4, 21, 0, 6, -6, 19, 24, 22, -16, -15, -14, -11, -29, -24, -30, -27, -15, -16, -12, 9, 4, -11, 16, 8, 16, 1, 12, -6, -5, 12, -16, 7, -16, -19, -31, -18, -43, -13, 1, -22, 4, -7, -17, -16, 5, 3, 14, 12, -1, 5, -11, -5, -14, 14, -11, 4, 5, -9, -10, 15, 1, -11, 7, 12, 1, -10, 16, 18, 15, 7, -13, 6, 1, 6, 12, -3, -11, 13, -1, 13, 9, 3, 6, 6, 6, -16, -14, 11, 7, 10, 1, -15, -10, 1, -10, 4, 5, 12, -10, -8, 7, -1, -12, -10, -19, -18, 1, -10, -2, 2, -11, 8, 6, -5, 0, -6, -17, 4, -27, -7, -9, -19, -25, -17, -11, 8, -17, 1, -16, 7, -18, -7, 9, -8, 10, -14, -15, -9, -4, -2, -9, -10, 3, 1, -23, -31, -19, -29, -31, -28, -4, -25, -19, -23, -16, -23, 2, 9, -3, 5, 11, 12, -12, 14, 8, -8, -1, -17, -21, -14, -31, -16, -14, -40, -37, -46, -46, -29, -49, -14, -10, -8, -26, 2, -13, -17, -5, -14, 13, -15, 1, -11, -19, 3, 3, -15, -27, -29, -9, -34, -58, -41, -36, -29, -30, -50, -34, -40, -15, -18, 0, 10, 14, -18, 5, -18, 9, -11, 13, -17, -15, -9, -13, -13, -10, -23, -10, -5, -22, -16, 1, -28, -26, -27, -7, -22, -7, 2, 8, 15, 1, -1, -8, 0, 10, -7, -10, 2, -5, 1, -21, 12, 6, 15, -17, -27, -1, -23, 1, -1, -11, -11, 15, -1, -5, 15, 29, 4, 8, 12, 8, -4, -20, -20, -3, 2, 2, 16, 2, -14, 9, -8, 1, -2, -19, -1, -17, -6, -6, -5, 13, -6, -11, 12, 15, 36, -1, -1, -4, 0, -2, 1, -5, 6, -11, -14, 9, 15, 19, 12, 0, -3, -13, 7, 2, 28, 11, 16, 7, -16, -6, 14, 4, 13, 11, 8, 18, 6, -4, 11, -10, 9, 7, -1, -22, 15, 3, 10, -6, -13, 17, 13, 34, 18, 36, 7, 13, -15, 15, 16, -2, 22, 0, -8, 6, 7, 3, 14, -10, -1, -10, -4, -28, 15, 12, 11, -1, 0, 9, 30, 3, -3, 16, 9, -4, 3, 12, 18, 3, 13, -12, -12, -19, -8, 8, -13, 7, 11, -16, 3, 2, 1, 4, 21, 27, 34, 18, 8, 9, -5, -32, 29, 16, -1, -6, -11, 19, 8, -15, -13, -13, 0, -5, -14, 11, -18, 15, 6, -2, 14, 24, 15, 24, 24, 22, -19, -12, -38, -23, 5, 19, 13, 8, 0, 1, -12, -24, -18, -14, 6, 10, -5, 4, -8, -10, -4, 13, 12, 3, 8, 13, -10, 8, -27, -31, -12, -18, 5, 1, 1, 2, -6, 11, -5, -27, -31, -27, 21, -3, -11, -4, -4, 3, 8, 33, 21, 0, 3, 18, -4, -1, -25, -34, -29, 1, 27, 24, 21, 4, 37, -2, -30, -30, -26, -35, 2, -16, 13, -5, 12, 9, 6, 17, -10, 22, -20, -10, -28, -17, -44, -13, 11, 18, 11, 36, 39, 21, -10, -14, -34, -10, -9, -23, -23, 7, 11, -8, 6, -10, -15, 6, 14, 13, 8, 14, -16, -2, -2, 15, 10, 6, 13, 21, 10, 29, -7, -2, 1, -5, -24, -32, 13, -1, -11, -13, -18, -2, -18, -5, -8, -3, 21, 11, -23, -5, 1, 25, 20, 6, 12, 13, 4, -9, -8, 1, -1, -2, -28, -8, -4, -6, 4, -16, 13, 10, 9, 5, -4, -14, -17, -19, -19, -27, -16, 7, 13, 17, 8, -15, 0, -25, -14, -5, -35, -43, -20, 5, -7, -9, -12, -5, -9, -13, -3, -4, -1, -39, -34, -7, -33, -25, -42, -23, 10, 20, -6, -7, -14, -14, -7, -11, -23, -48, -22, 15, 2, -17, 0, -10, -12, -15, -9, -25, -28, -47, -32, -39, -33, -24, -45, -23, -29, 2, 8, -19, -7, -20, -33, -40, -16, -24, 4, 9, 0, -10, -9, -10, -12, -18, -20, -29, -8, -22, -20, -8, -32, -11, -28, -11, -15, -18, -8, 6, -8, -19, -29, -23, 6, -22, -12, -7, 2, -19, -16, -2, -8, -21, -5, -20, -18, -26, -8, -25, 7, -11, -25, -19, -13, -6, -3, -18, -12, -3, 16, 20, 13, 15, -5, 15, -11, 9, 3, -4, -15, -16, -7, -24, -12, 9, 16, -6, -16, -10, 1, -18, -21, -22, -5, 9, 17, -3, 6, 36, 7, 19, -21, 3, 0, 6, -16, 4, -19, -8, -20, -21, -3, -9, 13, -15, 4, 1, -6, -8, -8, -14, 3, -9, -11, 11, 3, 5, -4, 10, 3, -5, -12, -4, -9, -1, -15, -1, 4, 12, -4, -9, -11, -9, 15, 13, -7, 2, 7, 14, 14, 17, 13, -5, -17, -9, -11, -21, -23, -17, 9, -9, -6, 2, 8, -11, 5, -2, 6, 14, -7, 8, 19, 9, 6, -6, 16, 34, 27, 12, -5, -13, 4, -6, -12, -9, 3, -1, -6, -7, -12, 12, -7, -9, -4, 2, 1, -8, 9, 2, -4, 1, -3, 14, -18, -8, 15, 4, 0, -10, -9, -6, 11, -11, -18, -21, -5, -15, 4, 5, -10, -17, -11, -17, 1, -9, 11, -19, 13, 3, -6, -11, -14, -13, 3, -2, 8, 0, 10, -18, -15, -10, -6, 0, -3, 6, -19, -4, -1, -7, 13, -8, -18, 1, -14, 9, -6, 0, -1, -12, -11, 7, 4, -12, -11, 6, 4, -17, 2, -7, -12, -12, 0, -19, 11, -11, -19, -2, 8, -19, 5, 9, 12, -1, -15, -15, -2, 19, 13, 27, 5, -11, -15, -5, 8, -3, -13, -4, 7, -1, -15, -11, -9, 6, -20, -15, -3, -6, -8, -10, 10, 19, 18, 1, 10, 12, 11, 33, 9, 8, 26, 8, -2, -23, 2, -12, -9, 12, -8, 13, -18, -5, -19, -6, -9, -8, -5, 20, 1, 44, 41, 16, 23, 17, 2, 13, 11, 9, 4, 18, 11, 16, -18, -6, -31, -14, -17, -13, -10, 10, -9, 6, 9, 11, 23, 25, 13, 20, 9, -9, -26, -26, -10, 8, 16, 5, 12, 13, 24, 3, 11, -14, -13, 0, 0, -20, -9, -19, -20, -6, -9, 17, 5, 2, 3, -4, -15, -24, -40, -19, 0, 7, 19, 3, 22, -2, -1, -5, 5, 10, 2, -8, 2, -2, -6, -5, -1, 10, -7, 15, 31, 11, -3, 4, -19, -21, -38, -37, -30, 1, -1, -4, -7, -16, 6, 1, 1, 2, -18, -12, -16, -22, 6, 14, -17, -1, -10, 32, 11, 4, 12, -5, 7, -22, -7, -10, 12, 14, 8, 17, 14, 10, 9, -7, -20, -15, -11, -23, -9, -11, -16, -8, 9, -4, 14, 9, 26, -12, 16, 0, 9, -5, -40, -3, -16, 13, 14, 38, 7, 4, 0, -15, 1, -4, -25, -25, -27, 3, -16, -7, -5, -17, 12, 23, -14, -5, 7, -8, -13, -27, -35, -22, 13, 7, 17, 17, 29, -7, 12, 1, -11, -13, -10, -40, -26, 4, -3, 0, 14, 3, 13, -5, -13, 3, -8, -2, -8, -37, -37, -33, 20, 18, 10, 3, -7, -21, 2, 4, -7, -25, -18, -16, -20, 9, 5, -13, 9, -9, 4, -11, -5, -23, -13, -18, -11, -35, -40, 16, 34, 32, 16, -6, -2, -27, 4, -2, -17, -26, -21, 32, -4, 6, -17, -16, -16, -17, -4, -43, -21, 2, -43, -19, -12, -29, 1, 11, 39, 33, 18, 8, -26, 5, -3, -17, 4, -19, 24, 3, 20, -10, -19, -14, -13, -10, -28, -28, -18, -19, -26, -22, -6, -10, 5, 30, 29, 35, -2, 3, 0, -18, 1, -22, 5, 3, 9, -4, 15, -7, -16, -14, 14, -3, -5, -5, -20, -5, -27, -4, -17, -17, 17, 15, 32, 30, 11, -2, -9, -23, -16, -17, -1, 0, 27, 32, 21, -7, 12, 1, -16, 10, 16, 22, -4, -18, 26, -5, 2, 15, 23, 17, 40, 30, -1, -6, -4, -13, 18, 14, 2, 17, 14, 22, 31, 5, -4, 1, 9, -12, 20, 18, 1, -17, 7, 28, 14, 12, 36, 37, 12, 25, -10, -19, -19, -4, 10, -2, 22, 32, 37, 14, 10, -11, 3, -15, 7, 12, 8, 26, 11, -11, 14, 3, 14, -2, 12, 21, 27, 0, -8, 10, 3, 14, 5, 0, 19, 38, 39, 21, 16, 5, -16, -4, -7, -2, 21, 13, -3, -10, 26, 12, 22, 27, 17, -11, -2, 9, 38, 29, 18, 21, 0, 0, 28, 30, 17, -1, 13, -9, -10, -19, -7, -13, 30, 2, -24, 10, 48, 21, 33, 16, 18, 17, -5, 28, 6, 16, 36, 26, 34, 38, 39, 5, 1, -1, -4, 14, -18, 11, -15, -8, 1, -3, -21, 25, 24, 26, 11, 16, 12, -12, 13, 25, 6, 4, 10, 5, 5, 2, -14, 11, -1, -21, 10, -20, -4, -8, -17, 7, -4, 1, 24, 1, 23, 5, 18, -11, 11, -15, 9, -9, 13, 1, 16, 9, 22, -12, 5, -7, -26, -22, 6, -19, -7, -14, -21, -2, 8, 28, 0, 9, 29, 17, 5, 19, 19, 1, -4, 6, -1, -8, -5, 18, 6, 0, 4, -13, -24, 4, -17, 8, 0, 6, -8, 1, -12, 13, 10, -9, -7, 3, -2, -19, -11, 9, -17, 13, -7, 5, -5, -13, -13, -12, -5, -4, -23, 0, -8, -16, -11, 4, 0, 13, 10, -11, 2, 4, 0, 7, 13, -8, 14, 8, -1, -25, -1, -28, -4, -13, -7, -26, -31, -14, -8, 11, -13, -14, -2, -16, -6, -16, 12, -7, -22, -25, -6, -24, -19, -17, -7, -38, -29, -46, -21, -29, -10, -11, -21, -6, -24, 7, -3, -9, 2, -5, 2, -18, -9, -9, 8, -12, -5, -9, 12, 2, -19, 12, -14, -23, -12, -10, -25, -5, -10, -5, 10, -2, -1, -11, -15, -5, -16, 12, 4, 8, 4, 12, -7, 9, 4, 0, -16, -2, -5, -13, -5, -17, 13, -1, -16, -12, 8, -2, -8, -7, -5, -5, 1, -5, -8, 10, 13, 2, -13, 10, -3, 8, 6, -11, -12, -14, -19, 5, -16, -2, 11, 3, 10, -14, -13, 3, -4, 0, -14, 12, -5, 12, 12, 8, 0, -6, -9, 9, -6, 4, -9, -6, -1, 6, 1, 8, -21, 5, -7, -8, -13, 8, 10, -8, 1, -6, 1, -4, 10, 16, -6, -5, 7, -17, -8, -12, 3, -4, -10, -8, 6, -11, -9, -20, -28, -11, -15, -21, 14, 14, -6, -25, -37, -19, -13, 7, 12, 8, -20, 9, -12, -3, 8, 7, 1, 6, 0, 6, -1, 2, -19, -24, -8, -9, 6, 25, 21, 16, 37, 18, -5, 7, -17, -2, -22, -29, 13, -13, -7, 9, 16, 13, 5, 5, 2, -17, -24, -29, -31, -34, -12, -11, 20, 4, 27, 19, 13, 10, 16, 2, 1, -34, -29, -6, -20, 12, 13, 14, 3, 4, 6, 9, -20, -24, -9, -38, -26, -21, 3, 8, -6, 18, 23, 14, 11, 17, -9, -8, -9, -1, -8, -31, 9, 7, -5, -6, 14, -8, 13, 5, -24, -28, -25, -20, -14, 0, -6, 12, 7, -27, 18, -11, 8, 21, 15, 10, -7, 10, 9, 6, -17, 11, -2, -7, -17, 6, 3, -21, -1, -22, -4, -21, 4, 2, 1, 4, 7, -4, -10, -12, 5, 1, 8, 2, -7, 12, 5, 6, -12, 9, 12, -9, 8, -4, -14, 5, -24, -9, -16, -9, -2, 4, 3, -14, -15, -11, -24, 6, 15, 6, 18, 19, -3, 14, 19, 4, -19, -7, -13, 11, -10, -2, 3, -15, 0, 7, -6, 5, 10, -24, -1, -18, 3, -2, 2, -1, -17, 10, 3, 23, 29, 21, 26, 15, -4, 4, -10, -2, -13, 5, -8, -4, -16, -2, 29, -6, -15, -25, -38, -22, 10, 26, 24, -12, -22, -12, 0, 14, -4, 26, 25, 36, 12, -13, 13, -11, -7, -4, -19, -8, 1, 4, -5, -17, -18, -7, -25, -24, 23, 30, 5, 6, -6, 1, 17, 4, 19, 18, 27, 28, -11, -4, 15, -5, 1, -1, -23, -35, -7, -8, -23, -13, 4, -16, 3, -15, 24, 11, 29, -2, -21, -13, -18, 1, 15, 23, 26, 50, -3, 5, -10, -15, 16, 4, -3, -23, -7, -3, 9, 8, -4, -15, 23, 12, 29, 25, 7, 2, -1, 7, -18, 1, 12, 21, 18, 33, 1, -1, -4, 0, -18, -18, -11, -18, 4, 3, 21, 18, 13, 14, 13, 26, 11, 16, -22, -4, 0, -16, -25, 5, -4, 14, 20, 20, -11, -1, -16, -12, -7, -19, -25, -22, 7, 3, 29, 19, 29, 45, 18, 16, 11, -15, -12, -30, -16, -9, -37, -16, 1, 0, 10, 11, -7, -14, -15, 5, 2, -13, -5, -2, 8, 18, 29, 21, 42, 51, 36, 2, -11, -34, -27, -29, -49, -33, -10, -6, -1, -3, -6, 11, -6, -18, -4, -18, 12, -16, -2, 0, -8, 11, 26, 34, 48, 29, 20, 12, -6, -35, -62, -30, -17, -7, -12, -13, -10, -10, 22, 16, -16, 4, -4, -16, 11, -3, -24, -29, -8, -5, 23, 21, 19, 25, 17, 0, -36, -66, -45, -15, -30, -9, -21, -3, -4, 32, -3, 1, 13, -6, 16, -12, 4, -14, -25, -22, -16, 18, 32, 33, 20, 36, 3, 3, -46, -37, -22, -37, -17, -14, -16, -3, 19, 11, -12, 2, -6, 7, 16, -7, 8, 10, -21, -25, 16, 19, 43, 15, 9, 12, 17, -4, -2, -22, -14, -36, -21, -2, -1, 3, -22, 2, -10, -18, -4, -7, 1, 0, 10, -13, 4, 0, 21, 31, 15, 17, 24, 10, -3, -3, -10, 13, -8, -24, -8, -25, -4, -5, -26, -24, -7, 4, -10, -20, -8, -17, 9, 15, 5, -23, 8, -7, 28, 28, 21, 16, 25, 10, 13, 19, -7, 13, -7, -21, -10, -32, -20, -20, -10, 2, 3, 10, -18, -1, 14, -7, -2, -2, -36, -18, -33, -4, -4, -8, 14, 2, 23, 13, 13, 3, -24, 5, -14, -17, -8, -1, -5, 3, -19, 9, 15, -9, 8, -18, -2, -15, -12, -7, -10, -12, -23, -9, 7, -16, -12, -19, -12, -8, -26, -7, -23, -9, -11, -21, -24, -17, 14, 13, -9, 14, -10, -16, -18, 8, -2, -12, -17, -12, -13, -18, -14, -4, 1, -22, -27, -4, -7, 2, -5, 11, -9, -2, 12, -1, 12, -8, -14, 7, -2, -4, -10, 3, 4, -6, -6, -12, -3, 0, 12, -12, -3, -2, 5, -10, 5, -2, 5, 8, 11, 11, 15, -11, -4, 6, 9, 19, -9, 12, -3, 5, 0, -9, 19, 7, 20, 8, 18, 13, -1, 18, 22, -12, 1, -10, 0, -8, 1, -4, 16, 21, 8, -6, -9, 3, 17, 8, 17, -11, 17, 19, -10, 4, -7, 22, -3, -9, -7, -1, -8, 5, 17, -6, -6, 7, 9, -6, -8, 10, -9, -6, 5, 2, 18, 16, 10, 7, 16, 0, 1, -9, 21, 19, 20, 0, 18, -4, -7, 5, 19, 7, 21, 22, 9, -8, -5, 8, -4, 16, -11, 13, 22, 0, 10, 19, 11, 9, 1, 18, 22, -2, 7, -7, 9, 10, 6, 11, -5, -5, 12, 22, -1, 5, 17, -7, 10, 0, 14, -4, 11, -2, 23, 15, -6, 11, 1, 5, -13, 17, -14, -1, -6, -7, -4, 1, -10, -4, -7, 9, -10, 5, -10, 1, -8, 21, -5, 1, 8, 12, 14, 12, 1, -7, -11, -11, 7, 5, -15, -6, -17, -19, -9, 12, -1, -2, -21, 6, 4, -4, 9, 6, 3, 17, -6, -10, 12, -11, 5, 13, 19, -4, 14, -13, 12, -12, -14, 1, -11, -7, -5, -18, -15, -4, 9, 6, -3, 6, 11, 16, 0, -2, -3, -2, 17, 14, -6, 12, 12, 10, -6, -20, -15, 2, 8, -13, -8, 11, 10, 1, 11, -14, -5, -16, 9, 8, 9, 13, 7, 14, 10, 22, 8, -10, 1, -11, 2, -21, 13, 3, 6, 2, 4, 10, 1, -10, -20, -12, 5, 4, -12, -8, 2, 6, 0, -6, 18, -4, 20, -2, -12, -4, -6, -9, 11, 0, -11, 6, -17, -10, 2, 0, -13, -7, -6, 2, -11, -2, 3, -13, 8, 4, 11, 11, 8, 1, 11, 1, -11, -7, 6, 20, 4, -17, 18, 15, -8, -5, 11, 5, -9, 7, -20, -17, 3, -16, 2, 8, 12, 11, -9, 0, 15, 21, 21, 6, -11, 13, -3, 16, -9, -1, 14, -8, 9, 10, -11, -5, -11, -4, 2, 10, -8, 9, -3, -14, 7, 6, 3, 20, 4, 14, 1, 19, 3, 12, 11, -9, -12, 6, -4, 8, 0, -3, 2, 9, -17, 0, 11, -15, 11, 8, -11, 16, 8, -7, 17, 21, 0, -4, 22, 15, -11, -4, 5, 3, -6, 8, 8, -4, -1, -8, -5, -11, -13, 7, -17, 10, -6, -19, -4, 5, 7, -11, 4, 19, 0, -4, 18, -9, 2, 4, 14, 2, 17, 13, 19, -9, 5, -13, 15, -6, -5, -15, 8, 8, -2, 3, 20, -1, -9, 1, 7, 0, 21, 0, -8, 2, 14, 20, 4, -5, 5, 8, 12, 15, 0, 4, -12, -10, 7, -9, -5, -7, -8, 16, -5, 5, 14, 9, 13, 13, -5, -11, -9, 5, 16, 22, -4, -1, 7, -3, 9, -4, 2, 16, 4, -7, 5, -16, -12, -4, -12, -16, -13, -6, 18, 4, 11, -4, 22, 6, 9, 8, 12, 15, 22, -5, 7, 12, -10, 3, -4, -1, 9, -11, 9, -14, -3, 10, 7, 6, 15, 0, 18, -6, 8, -2, 16, -5, -10, 10, 12, 10, 19, -3, 18, 8, -5, -6, 2, -2, -2, 8, -5, 7, 4, -8, -12, 11, 10, 17, -15, -5, 1, -5, -11, 13, 22, -8, 1, -7, 11, 11, 16, 3, 4, -20, 9, 0, -14, -14, -8, 0, -1, -18, -18, -16, 8, 11, -13, -14, -14, -2, 5, 8, 12, 3, 15, 14, -10, -16, -12, 13, -17, -9, -13, -20, -1, 12, -5, -12, -5, 5, -11, -10, -2, -9, 4, 0, -1, 20, 11, -6, 0, 12, 1, 7, 21, -9, 13, 12, -1, 7, -18, 1, 8, 8, 10, 3, 3, 7, -8, -16, 17, -7, 13, -6, 9, 6, -3, 10, 12, 7, 16, -3, 14, 5, -7, 11, -17, -3, -9, 0, 14, 3, -8, -14, -19, 3, -18, -6, 8, -2, 3, -6, 13, 16, 6, 11, 16, 5, -10, -7, 19, -3, 2, -17, 0, -10, 5, 1, -11, -8, 7, -5, -15, 12, -8, 4, -12, 16, -2, -4, -5, 6, 17, 18, -5, -8, 15, 0, 10, -13, 18, -18, 13, 4, 7, 7, -6, 5, 8, 13, -2, -10, -16, 6, -3, 12, 12, 14, 18, 0, 15, 4, 16, -11, 0, 2, 3, 18, -10, -4, 12, 0, -18, 14, -16, -8, 2, 15, 3, 6, -10, -13, 14, -10, 11, 15, 14, 19, 22, 8, 18, 14, 13, 19, 19, -4, 0, 13, -2, -2, 14, -14, -2, 9, -6, 15, 17, -7, 0, 19, 8, 19, 4, 14, 14, 10, 16, 13, 7, 11, 4, 17, 22, 3, 8, -2, 20, -3, -7, 0, 20, 7, 6, 10, 21, -12, 9, 0, 0, 5, 4, -3, 19, 17, -10, 4, 18, 11, -9, 12, 18, 19, 19, 6, 15, 17, 13, 12, 12, -5, -2, -6, -14, -5, 14, 9, 4, 18, -6, 15, 9, -7, -9, -13, 0, -8, -2, 0, -4, -12, 9, 6, 8, 18, 7, 14, -10, 11, -12, -9, 19, -1, -4, 5, -11, -14, 11, -13, -13, -5, 5, 2, 0, -7, -11, 6, -5, -7, 7, 12, -6, -6, 9, 12, 8, 19, 12, -10, 12, 17, 10, 14, 0, 12, -8, -8, -5, -8, -9, 10, -2, -9, 11, 8, 17, 11, 1, 2, 0, -3, -8, 3, 12, 4, 9, -1, -13, -8, -5, -22, -32, -30, 0, -13, 7, 14, -9, 15, -9, -4, 10, -3, 0, -16, 8, -13, -17, 11, 10, -6, -12, 9, -5, 6, 8, 15, -7, -12, -6, 2, -29, -19, -14, -6, -8, 17, 8, -3, 2, -7, -13, -1, 7, -13, -10, 0, 5, -6, 8, 19, -4, 14, 2, 10, 4, 14, -13, 5, 17, -20, -7, -13, -13, -8, 3, 13, 4, -9, 8, 19, 11, 8, 10, 17, 15, 4, 3, 21, 24, 8, -8, -1, 14, 4, 6, 2, 1, 9, 2, -9, 7, -7, 3, -10, 1, -12, 9, 3, 23, 27, 26, 3, 6, 35, 24, 12, 18, 16, 17, -6, 1, 3, 4, 9, 17, 3, 13, -19, -22, -6, 9, -10, -8, 5, 11, 26, 17, 27, 12, 25, 17, 39, 8, 30, 39, 18, 13, 7, 17, -1, 13, 7, 8, 1, 11, -19, 1, -12, 2, -1, 20, 12, -9, 19, 7, 15, 8, 28, 36, 24, 17, 35, 29, 40, 25, 8, 15, -6, 0, 2, -9, -18, -10, -11, -13, 20, -14, 14, 2, 4, -5, 2, -15, -4, 6, -11, 7, 18, -9, -16, 4, 16, 11, 5, 3, -13, -3, 4, -6, -3, 4, -23, 6, 21, -13, -7, 12, -4, -2, -10, -6, 6, 22, -10, 0, -34, -36, -40, -49, -20, -16, -14, -11, -2, 9, 10, -15, -24, 1, 20, 19, -3, 4, -10, -6, 20, 9, -5, -35, -8, -3, -3, -34, -43, -53, -37, -35, -13, -12, 7, -20, -5, -29, -10, -1, -15, -1, 8, 8, -4, 9, 16, -6, -1, -5, -13, -23, -24, -35, -42, -28, -39, -29, -19, -23, -5, -15, -3, -4, -15, -25, -18, 6, -23, 7, 12, 16, 2, 6, 6, 3, -7, -15, -20, -28, -40, -39, -66, -35, -34, -23, -7, 23, 6, -1, -18, -19, -4, -1, -6, -14, 2, -11, 8, 30, 0, 11, 13, 18, -12, -24, -35, -44, -32, -59, -42, -23, -12, 15, 13, 7, -3, -3, -26, -14, -10, -9, -8, -16, -16, -12, 26, 8, -5, -11, 17, -10, 7, -2, -33, -44, -59, -47, -14, -7, 23, 55, 17, 12, -7, -16, 4, 4, -5, 0, -3, -13, -3, 22, 21, 34, 15, -9, 4, 5, 14, -12, -36, -40, -62, -15, 24, 48, 57, 23, 22, 15, -2, -21, 0, -10, 6, -16, 1, 2, 7, 0, 43, 19, -4, 17, -5, 10, 15, -15, -31, -41, -36, 1, 27, 28, 42, 16, 19, 16, -15, -14, -35, -11, -21, 0, 5, 8, 12, 31, 17, 13, 13, -1, -3, -3, 10, -13, -45, -36, -31, 36, 51, 33, 47, 20, 31, -2, -4, 0, 16, -6, -20, -4, -18, -8, -4, 20, 9, 13, 22, -1, -11, -11, 19, -11, -39, -45, -13, 12, 26, 29, 26, 22, 41, 11, 5, -1, -13, -15, 1, 7, -9, -13, -22, 21, 19, 11, -3, 10, -10, -10, 2, -7, -3, -32, 10, 0, 23, 31, 9, 14, 0, -1, 13, -1, -15, -17, -25, -9, -17, 2, 7, 0, -3, 16, 3, 5, -10, 17, 4, -20, -7, -5, 11, 6, 19, 14, 14, 6, 2, 1, 17, 2, -13, -26, -33, -9, -21, -14, -7, 16, 18, 8, -2, 6, 15, 19, -12, 4, 7, -16, 4, -4, -1, 5, 28, 21, 44, 17, 30, 14, 14, -33, -21, -7, -26, -20, 14, 11, -14, -3, -12, 10, 7, 5, 3, -20, -5, -30, -4, -28, -2, -4, -5, 22, 33, 8, 18, 5, 5, -12, -25, -4, -22, -27, -30, -9, 5, 20, 6, -1, -4, -10, 10, -4, 5, -27, -24, -14, -13, -14, -25, 0, -19, -24, 5, -8, -16, -7, -29, -31, -1, 6, 5, 6, 8, 16, -4, 14, 3, 5, 0, -4, -6, 0, -7, 18, 23, 10, -2, -25, -19, -20, -6, -6, 5, -1, 3, 10, 0, -18, -12, -5, -13, -2, -6, 8, 14, 19, 16, -5, 12, -5, 10, 2, -14, 17, 18, -8, -9, 4, 14, 0, 9, 6, 10, -7, 7, -4, -1, -13, 17, -11, -6, 11, -10, -16, 2, -13, 2, 7, -25, -17, -16, -24, -24, 6, 7, 5, 6, -12, -13, -12, 4, -15, 5, 4, -15, 4, -15, 5, 7, 6, -2, -7, 7, -24, -16, -19, 4, -18, 1, -10, -10, 0, -16, -5, -18, 1, 10, -1, -18, -22, 2, -22, 2, -7, -21, -6, -14, 5, -12, -14, -14, -17, -5, -19, 8, -26, -22, -27, 1, -23, -5, -12, -24, 5, 4, -23, -1, -11, 6, -13, -23, -13, -24, 1, -16, -12, -13, 4, -19, -11, 4, -1, -11, -10, -3, -13, -6, -13, -4, 12, -19, 10, -3, -16, -20, -11, -21, -26, -24, 1, 3, -19, -14, 0, -16, -24, -12, 5, 3, -7, -19, -23, -1, -8, -5, 3, -9, 8, 20, 24, 30, 11, 17, 10, -17, -23, -6, -2, -6, -16, 8, -18, -21, 8, -22, -24, -16, -10, -33, -14, -41, -11, -24, -1, 15, 24, 6, 8, 22, 16, 17, 0, 32, 28, 12, -18, -11, -13, -20, -12, 6, -17, -25, -27, -18, -11, -30, -27, -32, -22, -12, -8, 21, 10, -3, 17, 11, -3, 11, 2, 13, 0, 11, 16, -9, 1, -4, -2, -2, -4, -7, -4, -27, -22, -17, -18, 2, 10, 11, 2, 7, -2, 16, 12, 6, 4, 22, -6, 17, 8, 4, 10, -12, -13, -7, -19, -14, 9, -26, -19, -29, -4, -3, -11, -9, 7, -6, -8, 12, 6, 2, 15, 27, 8, 23, 2, 24, -5, 21, -1, 28, 4, 10, 6, 5, -16, 6, -12, -2, -23, -4, 8, 17, 0, 6, 20, 1, 2, 32, -4, -5, -4, -5, 15, 3, 6, 22, 21, 23, 10, 8, -18, 8, -1, -12, -29, 14, -1, 7, 13, 13, 1, -1, 4, 2, 2, 7, 9, -13, -26, -7, -7, -4, 28, 20, 15, 31, 18, 17, -10, 2, -9, -13, -6, 5, 18, 19, -3, 15, -18, -30, -19, 12, 2, 19, 0, 8, -32, -9, -28, 16, 8, 38, 49, 31, 20, -3, -21, -21, 4, -9, 0, 27, 32, 6, -6, -3, 6, -32, -42, -24, 23, 9, 18, 4, -24, -11, -16, -8, 17, 24, 7, 20, -10, -3, 7, -16, 1, -24, 3, -16, 15, 15, -2, 2, 6, -20, -19, 21, 19, -1, 11, -1, -17, -33, -8, -8, -13, -9, 11, -11, 14, -16, 3, -11, -22, -4, -10, 5, 3, -3, 5, -14, -27, -7, 0, -2, 18, 33, 16, -4, -19, -7, -16, -3, -1, -6, -12, -12, -10, 10, 6, -16, -9, -23, -12, -11, 8, -3, 10, 10, -1, -1, -8, 24, 15, 8, 11, 1, -27, -12, -34, -4, -3, -15, -12, 10, -17, 1, -21, -8, -12, 2, -3, -7, -10, -10, -4, -10, 12, 17, -5, -1, 23, 26, 5, -17, -7, -35, -33, -38, -6, -23, 12, -15, -6, -1, 9, -14, -19, -15, 0, -10, 4, -13, -17, -25, 14, -13, 12, -4, 4, 12, 7, -2, -35, -34, -16, -20, -29, 5, -5, 16, -14, -11, -12, 4, -14, -13, -14, -11, -6, 13, -27, -7, 17, 5, 9, 8, 1, 4, -4, -20, -16, -12, -1, 5, 5, 17, 26, 31, 1, -2, -12, -8, -14, 5, -17, -4, -6, -1, -5, 23, 4, -4, -8, -7, 12, -15, -12, -6, 5, 9, 5, 13, -7, 27, 37, 11, 3, -5, -1, 1, -7, -17, 4, 5, 17, 16, -2, 31, 12, 19, 5, 1, -17, -19, -9, 6, 14, 27, 1, 22, 29, 37, 14, 18, 14, 0, -11, -8, -7, 5, 1, 13, 13, 59, 25, 6, 0, 13, -1, -10, 1, -11, -16, 9, -1, 13, 0, 5, 5, 1, 1, -14, -1, -14, -16, 6, -11, 3, -4, 20, 33, 43, 34, 11, 14, 4, 0, -20, 13, 23, -12, 5, 14, 1, 18, 18, 10, 11, 21, -11, -12, -7, -22, 4, -1, -9, -13, -20, -19, -1, 11, 24, 5, -1, 4, 6, 25, 18, 1, 26, -4, 2, 0, 21, -8, 8, 22, -3, 6, -24, 3, 0, -2, -7, -3, -36, -18, -47, -15, -24, -11, -8, -3, 35, 12, 16, 23, 22, -13, 30, 2, 11, 0, -9, 5, 7, -11, -16, -6, -11, -6, 3, -24, -14, -37, -5, -7, -15, -21, -25, -28, 1, 11, -2, 16, 21, 13, 4, 9, -16, 10, -10, 0, -4, -24, -21, -15, -10, 4, -24, -24, -14, -12, -27, -17, -7, -14, -22, -2, 12, 6, -6, -4, -19, -16, -17, -20, 1, -7, -2, -15, -23, 9, -19, -23, -19, 5, -15, 4, -22, -8, -15, -20, -10, -25, -4, -14, -16, 2, -18, -9, -19, -12, -3, -23, 1, -25, -17, -18, 6, 9, -20, -22, 10, 10, -9, -7, -8, 11, 11, 6, 5, -1, -19, -11, 6, 2, 13, -15, -4, 12, -8, 11, -10, 10, -11, -1, -10, -10, 2, -15, -19, -16, -11, 9, 8, -4, -5, 14, 8, -16, -16, -18, -15, -16, 6, 0, -10, -18, 6, -6, 7, -1, 3, 1, -9, -19, 1, 15, -16, 3, 2, 13, -2, -19, 12, 13, -1, -12, -20, -21, 6, -4, 0, -15, -4, -15, -24, -16, -5, 4, -1, -11, -18, -8, -6, -17, -13, -16, 13, 10, -8, 6, -3, 8, -22, -15, -23, -5, -2, -10, 8, 4, 1, -21, -3, 0, -23, 0, 3, -18, 14, -16, 8, -10, -3, -13, 12, 0, -14, -8, 16, -13, -5, -13, -5, 19, 20, 3, 7, -20, -17, -9, -16, -4, -17, -41, -5, -19, 5, -18, 8, 0, 11, -9, -10, -2, 16, 13, 27, 10, 14, 1, -11, 24, 38, 9, 11, 2, 7, -26, -7, -10, -28, -43, -16, -3, 0, 8, -5, 13, -16, 2, -8, 9, 19, 10, -1, 0, -4, 35, 19, 16, 16, 27, 25, 4, 36, 13, 9, -16, -26, -8, -33, -36, -10, -7, 9, 9, -5, -2, 10, 2, 19, 4, 24, -5, 3, -8, 7, 18, -4, -2, 19, 14, 20, 9, 28, 14, 0, -31, -19, -13, -30, -18, 12, 13, 9, 9, 9, 17, 13, -12, 10, 18, 6, 18, -2, -11, -7, -1, -1, 21, 8, 11, 41, 11, 10, -18, 1, -11, -42, -13, -8, -13, 13, -5, -9, 29, 16, -2, 16, 14, 34, -3, -18, 0, -13, 20, 6, 35, 10, 35, 29, 35, 20, 5, 0, -9, -23, -18, -2, -5, -13, -14, -4, 17, 30, 27, 39, 24, -2, -5, 0, -26, -21, 2, -1, 19, 36, 26, 3, 11, 19, 16, -2, -17, -50, -25, -22, -5, -8, -4, 7, 19, 28, -1, 10, 19, -20, -7, 3, -15, -12, 3, 26, 38, 21, 24, 35, 25, 33, 13, 13, -18, -28, -20, -17, -11, -11, -14, -7, 29, 30, 9, -17, -11, -7, -21, -14, -8, -13, -7, 50, 31, 30, 10, 27, -6, 22, 6, -10, -13, -35, -22, -7, -3, -18, -10, -6, 10, 24, -17, 2, -6, 5, -20, -12, -27, -29, 4, 30, 22, 23, 32, 29, 16, -2, -14, 0, -21, -12, -19, 0, -14, 4, -15, 12, 9, 23, -38, -41, -43, -22, -8, -26, -9, -23, 5, 18, 26, 40, 30, 11, -2, -20, -4, -8, -15, -5, -14, 1, 9, 6, 2, 6, 15, 0, -36, -44, -51, -44, -11, -24, -7, -16, 9, 40, 38, 10, 34, 11, -15, -15, 7, 16, -3, -12, -11, -15, -2, -12, -18, -7, 9, -5, -34, -31, -19, -21, -6, -15, -24, 3, 5, 33, 0, 7, 23, -1, -17, -9, -12, -6, -20, -26, -26, -1, 3, 14, 6, 15, -3, 0, -35, -43, -17, -26, -33, -47, -38, 3, 5, 18, 23, 12, 17, -20, -13, -7, -1, -10, -1, -15, -24, 3, 9, -11, -10, -3, 8, -36, -35, -41, -34, -13, -17, -19, -41, -35, -19, 13, 6, -17, -17, -13, 6, -6, -8, -11, -38, -38, -8, -6, -18, -6, -13, -6, -16, -10, -25, -24, -19, -5, -33, -26, -28, -27, -3, 1, -11, 3, 2, -20, 0, -8, -1, -20, -38, -11, -12, 10, -9, -7, -18, 8, 10, -3, -15, 0, 0, 7, -16, -36, -51, -36, -1, -14, -29, -2, -6, -20, -6, -1, -12, -32, -24, -14, 10, -13, 0, -6, -10, 10, 14, 4, -4, -5, 12, -15, -12, -17, -3, -12, -24, -4, 2, -1, -24, -32, 5, -30, -31, -30, -37, -21, 14, -10, 4, 8, 13, 2, -17, -10, 1, 11, 12, 1, -10, 19, 2, -12, 2, -2, 9, -13, 6, -31, -18, -18, -38, -17, -2, -16, -11, 3, -15, -15, -6, -11, 9, -18, 10, -1, 12, -13, -10, 19, 18, 1, 14, -9, 4, 1, 4, 5, -19, -16, -20, -30, -4, -15, 12, -6, -5, 0, 10, 14, -7, 30, 28, 22, 23, 24, 14, 23, 7, -22, -1, -13, -7, 5, 6, -24, -12, 1, -11, 2, -22, 7, 3, -13, -4, 13, -2, 11, 6, -11, 9, 37, 33, 48, 42, 15, 32, 30, 13, 7, 13, -6, 3, 19, -1, -4, 5, -5, -12, -21, -17, -11, 9, -8, 5, -18, 12, -5, -8, -10, 25, 35, 23, 36, 22, 11, 18, 31, 32, 34, 28, 17, 9, 10, 11, -16, 1, 3, -3, 15, -13, -16, -16, -19, -1, 14, 9, 13, 1, 5, 12, 1, -8, -14, 2, 12, 4, 6, -5, 14, -8, -8, -4, -7, 10, -18, 12, 15, -5, -2, -20, -14, -22, -17, -8, -20, 1, -9, -9, 6, 3, 2, 7, -23, -11, -13, 9, 8, -11, 9, 11, -12, 8, 11, -4, -12, 2, -13, -21, -21, -20, -21, 6, -9, -9, -10, -4, -11, 6, -24, 8, -20, -16, -22, -8, -17, 6, -23, -23, -18, 5, 4, -13, -7, -18, -7, 10, -3, -20, 7, -22, -1, -2, -12, -17, -19, -23, 0, -20, -4, -1, -6, -5, -10, -16, -26, -20, -7, -11, -15, -11, -10, 7, -7, 6, -13, 5, 11, -16, -19, -11, -1, -21, -28, -14, 9, -3, -11, -1, -9, -17, 1, 8, 1, -7, -8, -3, 3, -7, 7, -2, 8, -22, -7, 0, -21, -9, 1, 6, -7, 13, 13, 15, 29, -3, 18, 8, 6, -9, 5, -22, -25, 2, -1, -22, -18, -11, -3, 4, -18, -1, -4, -6, -16, -12, 25, 1, 4, -8, 5, 15, 8, 5, 37, 18, 19, 3, 9, 13, 10, -18, -16, -10, -6, -3, -2, 10, -12, -19, 7, -17, 3, -13, 18, 15, 8, 14, 15, 6, 12, 34, 21, 5, 19, -5, 6, 19, 4, 7, -12, 4, 1, -16, -7, 8, -17, -22, -14, -9, -8, 11, -20, 5, -6, 8, 17, 6, 9, 24, 12, 24, 6, 19, 10, 5, -18, -4, -10, 12, 11, 12, -8, -21, -3, -25, 5, -26, 0, -20, -25, 7, -1, 10, 9, -11, 14, -11, 0, 22, 23, 2, 16, -6, -7, -4, 6, -1, 18, 29, -11, -6, -14, -17, -13, -15, -12, -25, 6, 13, -16, 5, -3, -6, -20, 15, 15, 20, 4, 16, 0, 8, 6, 4, -12, 5, 30, 9, -6, -1, -9, -2, -15, 7, 10, -22, 6, -11, -6, -20, -10, 9, 0, 13, 5, 18, 20, -1, -1, -1, -17, 2, 7, 26, 8, 25, 15, -10, -8, -6, -30, -25, -23, 0, -25, -17, -18, -20, -10, 5, 5, -6, 22, 30, 23, 29, 0, 8, 7, -20, -24, 9, 13, 8, 22, 8, -21, -22, -3, -11, -6, -1, 3, -9, -25, -20, 14, -3, 22, 22, 9, 7, 25, 23, 16, 26, 8, -17, -31, -22, 1, 8, 16, 7, -19, -18, -12, -4, 7, -12, -24, -13, 17, 4, -3, 13, 11, 21, 2, 27, 34, 32, 28, 22, 7, -6, -17, -17, -25, -17, -17, 11, 8, -6, -23, -14, 7, -13, 0, -5, 4, -7, -12, 7, 23, 20, 10, 31, 21, 8, 5, -20, -9, 2, -8, -30, -6, 3, -14, 11, -9, 0, -12, -20, -3, -18, -17, -17, 7, -16, 7, -1, 11, 7, 37, 8, 15, -1, 13, -9, -24, -31, -8, -8, 2, -8, -7, -22, -9, -20, 5, -5, 4, -6, -30, -51, -27, -13, -27, -16, 8, 4, 13, -14, -4, -6, -16, -3, -16, -24, -2, 21, -18, -23, 1, -20, -4, -4, 10, 3, -5, -5, -32, -30, -8, -7, -24, -31, -16, -20, -8, -7, 12, 7, -17, -4, -8, -22, 4, 12, -22, -15, 5, -17, -17, 6, -5, 12, -1, 1, 12, -23, -25, 0, -10, -12, -32, -23, -10, -1, 4, -12, 8, 9, -5, -12, 13, -20, -14, -11, -16, -11, 5, 9, -20, 9, 5, 12, 8, -8, -16, -32, -4, -12, -28, -19, 6, 9, 6, -9, 10, 10, 20, 20, -7, -9, -17, -9, -4, -8, -10, -11, -21, -14, 19, 32, 16, 10, -12, -1, -26, -5, -9, -17, -16, 8, -4, 10, 30, 31, 5, -12, 11, -22, -18, -15, 7, -21, -2, -10, -14, 1, 10, 23, 24, 8, 11, -8, -11, -10, -9, -1, 3, -10, 8, -6, 16, -4, 22, 0, 9, -28, -32, -12, -18, -11, -19, -16, 9, 10, -10, 8, 23, 10, 13, -2, -12, 18, -2, -10, -3, -7, 0, 5, 2, 23, 4, 7, 12, -15, 4, -5, -4, -6, -6, 5, -20, -2, 6, -11, 8, 13, -6, 22, 13, 22, 7, 24, 0, 23, 21, 2, 6, 22, 13, 8, -14, 16, -18, -4, 9, -22, -16, -13, 12, -8, 2, -5, -1, 19, 32, 31, 23, 33, 20, 37, 31, 11, 7, -1, 22, 21, 0, -4, 0, -10, 3, -8, 8, 11, 6, -5, 2, -6, -18, 7, -6, -7, -7, 17, 5, -4, -6, 1, 18, -12, 11, 4, 15, 0, 13, -4, -9, 8, -7, -12, -18, -15, -9, -15, -11, -17, -2, 1, 13, -11, -24, -6, -2, 7, 16, -7, -13, -14, -2, 4, -4, -14, 2, -1, 12, -13, -15, 11, -17, -10, 10, -2, -13, -21, -13, -1, -3, -1, -9, -3, -21, -16, -5, -20, -4, -4, -26, -24, -2, 7, 8, 4, -7, -20, -18, -8, -21, -14, -2, -7, -15, -7, 7, 11, 7, 5, -21, -18, 1, -14, -16, -3, 7, 6, -12, -20, -12, -12, 12, 3, -11, -18, -15, -9, 5, 9, -8, -5, 8, 8, -21, 9, -1, -11, -4, 6, -12, 6, -22, -8, 5, -9, -14, 0, -9, 2, 10, -5, -12, 4, 1, 10, -18, 2, -4, 7, 10, 12, 2, -12, -12, -13, -23, -14, -23, -14, -3, 16, 8, -6, -15, 3, 9, 13, 15, -12, 0, -14, -1, 3, -8, 12, -18, -19, -13, -4, -17, 10, -12, -18, -19, -14, -21, -19, -39, -9, -11, -5, -6, 1, -6, 10, 15, -5, 12, -2, -18, 10, -4, 11, 3, -12, -12, -3, 13, -5, -21, 8, -8, -6, -23, -9, -6, -4, 22, 9, 0, -5, -7, -10, 18, 32, 29, 14, 4, -10, 1, 10, 11, -9, -5, -3, -10, -15, -25, -28, -20, -27, -16, -3, 13, 12, 29, -4, -12, -8, 18, 4, 8, 20, 4, 13, -6, 1, 2, -4, -11, -17, -2, -16, -13, 1, -8, -12, 3, 4, -1, -7, 21, 0, -5, 8, -19, -18, 3, 19, 12, -17, 15, 24, 24, -16, -4, -9, -16, 7, -14, -23, -17, -1, -1, -7, -17, -16, 7, -20, 1, -5, 8, -1, -2, 1, -24, -25, 2, 12, -7, -9, 21, -3, 14, -17, -1, -16, 3, -23, -7, 7, 3, -24, 16, 6, -1, -21, 1, 8, -8, -7, -5, -16, -13, -21, -15, 1, -10, -10, -2, -7, 8, 1, -5, 7, -5, -32, -10, -27, 8, -10, -3, 5, -14, -16, -4, -30, -11, -1, -25, -36, -22, -3, 0, -23, -35, -23, -11, -15, -6, -15, -2, -2, -11, -36, -24, -33, -26, -4, 16, 13, 21, 1, 5, -22, -23, -6, -15, -10, -17, -22, -20, -21, -22, -14, -23, -2, -13, -9, -7, -3, -5, -23, -7, 0, -14, 9, 2, 22, 9, 21, 26, -10, 0, -8, 8, -8, -13, -33, -37, -30, -30, 3, -16, -7, 10, -4, -3, -20, -1, -4, -20, -17, 31, 3, 7, 2, 16, 20, 7, 3, 5, 36, 25, -2, -7, -7, -17, 12, -13, 11, 1, -29, -22, 9, -5, -2, -18, -20, -10, -2, 19, 22, 6, 2, 9, 0, 25, 30, 13, 41, 38, 6, 8, 10, 5, 18, 19, 22, -16, -31, 2, -13, -3, 2, 2, -7, -16, -3, 13, -5, 24, 20, 21, 3, 13, 23, 15, 23, 43, 8, 10, -3, -17, -7, -9, -20, -44, -14, -29, -2, 0, 9, -11, -11, -18, -2, -5, -3, 14, 22, 25, 33, 8, 20, 28, 25, 29, 20, 12, -10, -13, -27, 7, -15, -50, -13, 7, -11, -6, -6, -3, -17, -39, -11, -8, -7, 25, 1, 3, -2, 21, 5, 18, 29, 23, -5, -15, -38, -34, -19, -19, -9, -25, -17, -15, -11, -11, -2, -11, -18, -16, -29, 8, 10, -3, 14, 8, 11, 20, 5, 27, 33, 4, 3, -7, -27, -13, -29, -15, -27, -14, -13, -16, -21, -22, -9, -9, -4, -13, -29, -4, -15, -19, 10, 8, -9, 5, 8, 37, 26, 13, -8, 8, -18, -18, 0, -19, -8, -23, -3, -24, -7, -11, 2, 10, -15, -34, -21, -24, -24, -9, -22, -14, 17, 0, -11, 11, -3, 2, 2, -3, 13, -21, -1, -25, -14, -2, 6, -1, -14, -1, -21, -15, -29, -10, -26, -20, -10, -33, -21, -23, -26, -30, -14, -8, 17, 11, 13, 12, 4, 5, 6, -1, -10, 0, -21, -9, 4, -14, 3, 7, -24, -24, -8, -8, 4, -8, 2, 0, 9, -5, 10, 24, 23, 24, 4, 24, 14, 1, 22, -9, -9, -19, -21, 4, 3, -19, 10, -1, 3, 6, 3, 1, 2, -1, -12, -5, -14, 3, 15, -8, 12, 10, 3, 25, 19, 10, 23, -15, 12, 10, -20, -13, 4, -3, 11, -20, -17, -7, 0, -32, -22, -16, -29, -7, -21, -19, -17, 0, 3, 25, 4, 20, 35, 12, 17, 0, 10, 8, 3, -6, -11, -20, 5, -22, 8, -10, -19, -23, -19, 5, -2, 8, -9, -12, -33, -33, -18, 13, -16, -7, 15, 26, -1, -11, -12, -16, 12, -3, 3, 1, -3, 12, -16, -14, -10, -13, -6, 0, -5, -10, -20, -28, 4, -9, -31, -23, -19, -13, -17, 0, 6, -20, -5, -17, -17, 3, -8, -1, -2, -10, -20, -6, 9, -6, 4, 0, -5, -22, -25, -7, 2, -10, -13, -31, -16, -1, -11, 4, 10, -3, -21, 9, 9, -3, -20, 7, -12, -20, 3, -15, -20, 6, 8, -14, -4, -4, 5, 3, -10, -14, -8, -8, 4, 1, -1, -19, -9, -18, -17, 3, -21, -11, 9, 6, -4, 12, 12, 10, 5, -23, -8, 8, -5, 9, -10, -13, 6, -3, -16, -5, 5, -4, -22, -3, -10, 5, -5, 8, -5, -7, 1, -12, 3, 7, -14, -6, 4, -7, -10, -18, 1, -12, -16, 2, 8, -5, 1, -9, -1, -13, -8, -22, -9, -2, -8, 4, -20, 2, -1, -18, -8, 1, -17, 6, -15, -4, 10, -9, -14, -23, -17, -18, -30, -21, -17, -26, -18, -33, -3, 1, -9, -22, -8, 11, 8, 5, 11, -17, -20, -23, 9, 4, -4, -25, -2, -30, -30, -22, -23, -21, -52, -69, -68, -56, -40, -16, -13, 0, -16, -15, -16, -15, 5, 3, -16, -7, 6, -12, -4, -14, -8, -13, 10, 15, 6, -24, -48, -73, -88, -73, -61, -46, -9, -6, 0, -5, 0, -22, -10, -14, -12, -8, -2, 8, -2, -10, -7, 9, 11, 29, 18, 35, 52, 5, -27, -69, -60, -79, -44, -36, -15, -16, -19, -22, -12, -18, -23, -3, -24, -19, -24, 7, 2, -19, -3, -16, 8, 21, 21, 32, 34, 19, -16, -23, -36, -34, -31, 11, -7, 18, 15, -3, 13, 18, -8, -11, -38, -16, 7, -8, 9, -21, -21, -19, -24, -12, 18, -1, 4, -11, -31, -27, -37, -14, -16, 20, 19, -3, 11, 13, 3, 6, -16, -13, -31, -22, -11, -2, -12, 6, 4, -16, -9, 4, 13, 10, 4, -23, -21, -29, -31, -47, 5, 6, 29, 16, 35, 12, 16, 5, -26, -7, -18, -20, -15, -16, -10, -2, -18, -33, 3, 40, 23, 5, 18, 6, -23, -53, -79, -39, 8, 35, 27, 38, 15, 24, 9, -22, -51, -28, -20, -9, 0, 8, 6, -20, 1, -1, 1, 18, 21, 7, 29, 4, -30, -93, -82, -48, 38, 52, 29, 35, 41, 31, 34, 15, -32, -8, 4, -13, 11, 3, -8, -15, 13, 3, 4, 6, 3, 39, 20, -1, -43, -55, -21, 21, 60, 43, 42, 36, 37, 58, 47, 3, -30, -30, 1, -13, 5, 1, -1, 1, 21, 6, 4, 34, 36, 56, 13, -11, -37, -1, -16, 23, 38, 13, 14, 28, 11, 50, 61, 17, -9, -41, 8, -17, -20, -5, 3, -15, 12, 12, 8, 19, 48, 31, -5, -21, -47, -32, 7, 22, -2, 0, -8, 0, 7, 42, 42, 36, -9, -19, -1, -28, -3, -10, -4, -4, -1, 29, 1, 28, 25, 14, -8, -15, -32, -10, 3, 3, -27, -17, -14, -10, -24, 17, 17, 25, -7, -5, -15, -29, -5, -22, -7, 2, 6, 15, -24, 13, 10, 9, -8, -16, -14, 16, -12, -20, -16, -40, -38, -27, -47, 12, 10, 9, 5, -23, -36, -14, 8, 4, 10, -4, -18, -14, -13, -2, -9, 13, -5, -49, -36, 15, 4, -14, -46, -56, -53, -64, -26, 17, 22, 0, 10, -22, -8, 4, 4, -8, -4, -4, -22, 10, 3, -1, -11, -22, -18, -22, 9, 33, 38, -3, -63, -85, -51, -28, -14, 3, 22, 25, 4, 3, 3, -1, -2, 9, -22, 3, -20, -14, -4, -30, -30, -23, -8, -1, 42, 64, 25, -55, -102, -97, -56, -29, -14, 16, -4, -19, -6, -24, -10, -13, -6, -21, 3, 11, 4, -4, -32, -51, -31, -21, -7, 10, 35, 53, -10, -84, -120, -96, -53, -22, -16, -9, 5, -4, -53, 0, 16, -5, 7, 9, -21, -1, -26, -10, -37, -53, -50, -16, 3, 19, 53, 41, -37, -102, -125, -69, -54, -28, -10, 8, 14, 22, 4, -5, -12, -12, 11, 4, -20, -16, -4, -8, -16, -47, -13, -7, 28, 35, 22, 11, -48, -114, -112, -93, -40, -41, -1, 40, 43, 9, -1, 12, 8, -11, -20, -13, -6, 7, -18, -1, 12, -9, 18, 11, 10, 21, 1, -1, -21, -49, -67, -61, -18, 2, 36, 31, 27, 26, 14, -10, 14, 6, 5, 11, -21, -13, -5, 3, 35, 32, 36, 22, 31, 29, 34, 29, -8, -52, -65, -66, -22, -6, 33, 21, -3, -23, -6, -16, 1, -1, -6, -1, -12, -21, -11, 16, 11, 9, 13, 25, 51, 13, 15, 16, -26, -58, -88, -97, -44, -15, 0, -6, 5, 12, 14, -2, -14, -13, 6, -21, -11, -1, -6, 2, 9, -21, -22, -9, 7, -12, 5, -17, -36, -49, -37, -41, -20, 5, -25, -13, -9, 14, 15, 0, -18, -4, -1, -21, -4, 9, -3, -14, -5, -3, -3, -2, -27, -4, -21, -30, -11, -14, -22, 0, -4, 5, 0, 4, -8, 11, -9, 8, -5, -8, -15, 7, -20, -21, -22, -13, -6, -14, -15, -7, 9, -10, -4, -3, -11, -18, 9, -20, -8, -4, 2, 6, 12, 10, -8, -2, -3, 8, -9, 12, -12, 4, 14, 5, -7, 10, 10, 5, 13, -11, 1, 3, 6, -1, 8, -8, 11, 6, -20, 0, -7, 6, 13, 1, -13, -20, -17, -17, -7, -18, 6, -2, 12, 0, -11, 6, 11, -18, -13, 14, 9, -16, -17, 13, -4, -1, -8, -1, 11, -16, 12, -10, -6, 12, -5, 11, 7, 2, 9, -2, 12, -15, 12, -3, 6, 10, -4, 5, -9, -26, -14, -5, -8, -12, 4, -21, 4, -3, 5, 7, -15, 11, -3, -9, -1, 9, 11, -18, 2, 1, -31, 0, -25, -15, 6, -13, 30, 30, 31, 31, 24, -7, 1, -40, -35, 2, -2, -16, 10, 9, -6, 13, -1, -14, -17, -7, 4, 2, -35, -20, -7, -23, -4, 14, 28, 31, 16, 7, 22, -13, -4, -6, -19, 3, 4, -12, 0, -5, -18, -4, -7, 14, -9, 0, -27, -51, -32, -25, -13, 14, 32, 10, 42, 30, 17, 11, 15, 26, 31, 3, 5, 4, -6, -21, 2, 5, -1, -16, -11, -7, -10, -23, -46, -21, -21, -21, -19, 0, 21, 2, 14, 8, -2, 15, 33, 23, 10, 27, 24, 22, -10, -1, -7, -18, -2, -3, -10, 13, -7, -9, -8, -7, 3, -16, 0, 27, 18, 21, 33, 9, -5, 12, 22, 20, 30, 30, 13, 21, 36, 15, -20, -13, 11, 8, -6, -15, 7, 13, -13, 1, 3, 3, 15, 22, 12, -3, 8, 3, 2, 14, 14, 49, 66, 29, 33, 32, 43, 11, -3, -11, -7, 5, -3, -4, 13, 9, 2, -7, 0, -3, 11, 0, -9, 0, -6, -4, -20, -14, -15, 6, 33, 36, 35, 40, 59, 1, 8, -5, -20, -20, -12, -19, -1, -12, 15, 8, 7, 15, 13, 3, -4, -23, -51, -56, -52, -35, -21, -7, -11, 12, 16, 66, 53, 31, 14, 5, 2, 10, 8, -12, -13, -14, -9, 28, 14, 5, 32, 11, -12, -73, -92, -87, -53, -28, -36, -46, -34, -7, 10, 50, 47, 53, 9, -16, 2, -16, -8, -11, -5, 0, -1, 14, -15, 37, 15, 7, -56, -103, -87, -34, -38, -25, -44, -65, -74, -35, -14, 29, 40, 23, -3, 5, -7, -17, -12, -1, -5, 4, -2, -1, 14, 27, -2, -27, -77, -68, -39, -10, -31, -37, -69, -99, -91, -41, 10, 22, 11, 20, -4, 2, -13, -10, -17, -20, 6, -2, 25, 7, 32, -1, -24, -58, -67, -51, -1, 4, -15, -61, -106, -115, -55, 4, 8, -11, -27, -3, -10, 11, -20, -13, -4, -19, -18, 19, 25, 11, 17, -24, -44, -65, -42, -29, 12, -15, -22, -81, -92, -90, -33, 32, 29, -32, -17, -28, -18, -18, -9, -10, 10, 0, -18, 16, 48, 3, 3, -38, -24, -40, -37, -28, -4, -27, -65, -127, -113, -59, 22, 40, -5, -11, -26, -45, -7, -5, -1, 12, -14, -6, -12, 24, 15, -15, 6, -4, -31, -24, -19, 8, 3, -64, -113, -128, -82, -20, 32, 22, -26, 2, -28, -62, 20, 4, -9, -2, -18, -14, -9, -21, 2, -2, 18, 8, 24, -11, -16, -14, -33, -110, -128, -98, -5, 13, 2, 14, -8, -4, -38, -37, -1, -1, 4, 13, 8, -6, -22, -8, -4, 25, 29, 18, 35, 31, 12, -15, -50, -94, -64, -1, 22, 26, 5, -3, -1, 2, -53, -29, -22, -6, -4, -6, -18, -16, -3, -8, 13, 3, 6, 36, 19, 15, 17, 20, -5, -9, 10, 17, 11, 8, -22, -8, 4, -33, -58, -20, -13, -19, -7, -19, -7, -6, 12, -36, 25, 13, 23, 27, 13, 39, 11, 38, 13, 62, 66, 64, 38, 36, 28, -6, -18, -29, -8, 4, -4, 3, -3, -5, -8, 9, -9, -9, 4, 40, 4, 47, 25, 13, 24, 26, 52, 43, 54, 50, 60, 42, 52, 17, 18, 23, -6, 6, 0, 4, -12, 12, -20, 2, -22, -24, -11, 14, 19, 25, 4, 13, 31, 31, 41, 32, 57, 52, 73, 47, 54, 33, 26, 1, -8, -12, -16, 4, -15, -19, 4, 7, -15, -18, -13, 10, 0, 19, -5, 9, 18, 3, -2, 42, 34, 50, 33, 29, 38, 16, 10, 19, 0, 16, -5, -11, -9, -6, 2, 5, 1, 7, 13, -9, -15, -26, -20, -37, -36, -28, -55, -46, -44, -8, -29, -47, -4, -6, 8, -4, 11, 8, 6, 11, 12, -12, 8, -5, -13, -2, 6, -15, 6, -2, -3, -6, -2, -15, -27, 2, -9, -10, -16, -16, -7, -7, -4, -6, -9, -9, -11, -12, 6, -3, -17, -7, -10, -15, 14, 0, -5, -4, 1, -16, -15, -17, -11, -1, 3, -1, -6, -6, 12, -8, -3, 12, -20, -11, 8, -10, 14, -11, 4, -8, 5, -1, 17, -1, 5, 8, -9, -10, 11, 1, -13, -3, 4, -11, 5, 18, 13, -10, 11, -4, 4, -13, 7, 4, -7, -2, -8, -4, -6, 2, -8, -5, 1, -13, -11, 0, 5, 9, 7, 15, -7, 4, 1, 10, 2, -6, -5, -11, 10, 4, -3, 5, -14, 1, 2, -12, -2, 5, -3, 12, 9, 13, 20, 11, 14, -2, 8, 20, 11, 2, -5, 26, 24, 17, -5, -8, -7, 7, 9, -4, 9, -10, -7, 13, -6, 11, 5, -3, 12, 18, 9, -4, 0, 8, 12, 34, 8, -2, 2, 3, -6, 15, -15, -11, -12, 0, 5, 7, 3, 16, 8, 17, -11, 20, -1, -3, 25, 18, -3, -8, -7, 15, 16, 30, 6, 29, 11, -9, -20, -15, -13, -1, 0, -14, 9, -8, 2, 1, 6, -5, 13, 24, 13, 26, -1, -2, 0, -22, 5, -15, 7, 5, 18, 17, 6, -2, 11, -4, -25, -24, -11, -1, -9, 16, 15, -1, 11, 21, 1, 15, -6, 1, -14, -9, -11, 8, -12, 14, 6, 23, 28, 9, 12, 14, -2, -18, -10, -36, -29, -20, 8, 13, 12, -5, 3, -3, 21, 18, -12, -22, -9, -19, 11, -19, -15, 13, 1, 20, 18, 7, 29, 11, 2, 8, -12, -4, -6, -20, -4, 3, -1, 13, 19, 2, 21, 18, -1, -16, 2, -12, 19, -6, -20, 12, -1, -3, 14, 0, 23, 24, 14, -2, -14, -3, -17, -31, -7, -14, 12, -10, 13, 17, 18, 16, -13, -8, -6, 5, 11, 10, -5, -4, -5, -8, 9, 18, 22, 11, 29, 14, 21, 5, -32, -44, -12, -11, -11, -14, -3, 5, 27, 22, 15, -14, 10, 13, -11, -6, -19, -42, 11, 1, 2, 24, 35, 42, 10, 24, 24, -3, -14, -33, -30, 5, -7, -4, 12, 1, 5, -5, -10, -2, 17, -13, -11, -23, -4, 1, -2, 28, 1, 20, 41, 41, 19, 44, 30, 24, -7, -55, -38, -21, -8, 17, 3, 5, 3, 19, 15, -6, 1, 7, -1, -13, -3, -28, 7, 30, 28, 43, 49, 40, 28, 30, 29, 13, 23, -20, -31, -6, 6, -11, 18, 7, -1, 26, 15, -14, 2, -6, -3, -13, -14, -19, -7, 17, 20, 30, 14, 6, 1, 21, 9, 13, -5, -8, -26, 5, 17, 8, 15, 8, -11, 4, -18, -28, -25, 5, 5, 1, 25, 10, 4, 15, 25, 13, 20, 22, 20, 0, 4, -2, -8, -7, -26, 3, 8, 2, 6, -9, -10, -5, -33, -27, -45, -11, 15, 14, 18, 16, 12, 17, 11, 13, 20, 9, 3, 7, -5, -2, -19, -8, 1, -5, 2, 14, 0, -6, -1, -8, -31, -33, -30, 16, 32, 45, 23, 9, -4, 10, -9, 1, 10, -13, -5, -5, -8, -14, -32, -18, -8, 5, 17, 2, 20, 7, 1, -11, -44, -47, -33, 22, 17, 15, 4, 6, 5, 0, -7, -18, -16, 3, -2, 10, -18, 2, -11, -38, -25, 8, 1, -14, -5, 17, -3, -15, -23, -46, -34, 12, 12, 32, 15, 11, -3, -9, -11, -20, 20, -4, 23, -11, -23, -14, -54, -49, -15, 19, 18, 15, 9, 18, 13, -5, -9, -16, -29, -10, -11, 16, -12, 7, -5, -20, -19, 0, 13, 10, -7, -29, -10, -40, -46, -15, -17, 12, -6, -10, 7, 9, -12, -3, -7, -3, -24, -23, -19, 0, -10, 0, -16, -12, 5, -7, -28, -11, -2, -20, -12, -23, -49, -26, 8, -5, -4, 10, -11, 13, 1, -8, -8, -24, 1, 5, -26, 8, -13, 15, -1, 3, -14, -17, -9, -13, -27, -2, -33, -46, -21, -4, -7, -14, 15, -10, -4, -7, -16, 3, 1, -14, -10, -5, -8, -11, 16, 23, 1, 12, 6, -3, 5, -32, -14, -20, -12, -40, -7, -6, 8, 1, -1, -6, -10, 1, 10, 10, 15, 12, -7, -19, -13, 5, -6, 3, 9, -3, 13, -21, -18, -23, -20, -17, -19, -29, -10, 15, -5, 11, -9, -8, 11, -7, 9, 16, 11, 26, 30, -9, 8, 16, -2, -3, -5, -29, -6, -10, 5, -24, -7, 7, -15, 4, -6, 14, -16, 8, -6, -3, -1, -6, -5, 10, 31, 13, 18, 35, 49, 40, 16, 17, 25, 6, 1, 3, 3, -2, 9, 4, 5, -2, 2, 2, 0, 10, 12, 16, 3, -6, -5, 2, 11, -1, 8, 21, 40, 36, 14, 11, 31, 40, 28, 40, 28, 8, 17, 12, -4, 9, 16, 6, 2, -7, -13, 18, -13, 0, 4, -9, -6, 3, 11, 3, -12, -8, 10, 19, -1, 5, 15, 14, 2, 18, 2, -8, 7, -3, -13, 5, -7, 14, -8, -5, -18, -6, -19, -31, -12, -3, -27, -8, -30, -18, -13, -11, -32, -2, -25, -33, -21, -15, -3, -5, -2, -18, -9, -23, -28, -30, -30, -21, -2, -6, -30, -28, -22, -11, -32, -24, -8, -3, -2, -25, -25, -31, -32, -7, -24, -12, 0, -14, -8, -11, -3, -1, -14, -33, -31, -19, -23, -20, -13, -34, -15, -2, -2, -7, -27, -14, -24, -34, -10, -9, -44, -29, 0, -3, -3, -11, -18, -30, -23, -29, -7, -5, -33, -19, -10, -8, -16, -21, -14, -28, -33, -17, -25, 2, 2, -3, -16, -11, -14, 9, 12, 3, 7, 13, 6, 10, -24, -13, -16, -15, -16, -31, -20, -20, -28, -32, -37, -39, -19, -21, -10, -20, 16, -12, 3, -11, 7, 7, 6, 4, -9, 16, 25, -1, 1, 17, 10, -23, -20, -17, -1, -30, -13, -41, -27, -48, -41, -9, -22, 4, 42, 27, 9, 9, -11, 22, 13, 20, 7, 26, -7, 16, -9, 11, 12, -19, -34, -31, -22, -9, -14, -15, -31, -14, -18, 10, -7, -1, 27, 17, 8, -2, 8, 1, 7, -12, 15, -8, -7, 27, 16, 31, 16, 3, -18, -25, -31, -20, -37, -46, -23, -10, 8, 16, 28, 14, 26, 18, 7, 9, 13, 26, 23, 9, -4, -8, 13, 19, 33, 36, 30, -21, -6, -28, -8, -1, -36, -23, -9, -2, 6, 5, 18, 30, 25, 23, -9, -7, -10, -3, -9, -3, 6, 8, 24, 2, 21, 32, 14, -17, -3, -33, -5, -34, -12, -36, -14, 17, 20, 7, 31, 23, 2, -6, -13, -11, -13, -10, -20, 5, 11, 9, 26, 14, 31, 41, 36, -7, -25, 0, -9, -21, -17, -6, -11, 15, 33, 33, 22, 19, 16, 0, 3, -14, -16, -16, -23, -20, -6, 12, 2, 25, 37, 43, 21, -17, -13, -9, -3, -13, -7, -8, -12, 31, 28, 13, 14, 4, 11, 24, 4, -5, -27, -28, -15, -23, -15, -5, 12, 17, 17, 40, 30, 11, -4, -33, -23, -34, -4, -12, 21, 7, 35, 23, 23, 10, 21, 22, 9, 8, -14, -33, -38, -24, 6, -13, -9, 5, 0, -10, 4, 2, -26, -24, -21, -5, -20, -16, -6, -11, 22, 1, 12, 26, 26, 30, 8, 15, -6, -20, -26, 9, 0, 10, -22, -16, -3, -2, -10, -30, -11, 0, -29, -24, -9, -10, -2, -11, -2, 5, -3, 25, 39, 36, 31, 6, -11, -3, 2, 14, -13, 11, 1, -21, -6, -27, -36, -17, -25, -18, -3, -17, -15, -25, -22, 10, -22, 4, 16, 31, 31, 31, 15, -1, -4, -20, -3, 4, -15, -12, 3, -11, -26, -8, -27, -4, -17, -9, -20, -5, -23, -9, -15, -15, -36, -20, 10, 30, 2, 21, 1, -7, -30, -19, 0, 10, 0, 7, -17, 7, -7, -8, -9, -35, -5, -28, -25, -10, -31, -16, -6, 18, 13, 16, 28, 9, 12, 6, -5, -40, -4, 12, 14, 19, -9, 22, 3, -18, 6, 1, -40, -31, -6, -26, -27, -15, -34, -19, 34, 19, 1, 26, 23, 36, 33, 3, -17, -23, -15, 15, -2, -4, 9, 2, 0, 0, 19, 12, -31, -20, -22, -23, 0, 2, -29, -14, 36, 10, 13, -2, 9, 21, 4, 9, -18, -26, -17, -11, -4, 14, 13, 4, -5, 20, 3, -14, -21, -17, -25, -29, -11, -7, -23, -12, 35, 22, -6, 8, 23, 24, 18, 9, 7, -16, 17, 2, -12, 1, 4, -5, 3, 16, 16, -17, -13, -28, -27, -14, -18, -1, -33, -8, 2, 16, 7, 5, 9, 1, 14, 10, 16, -1, -5, 14, 16, 0, -13, 13, 13, 31, 23, -22, -26, -15, -30, -23, -27, -35, -34, 2, -20, 0, 12, 5, 4, 20, 24, 27, 27, 25, -2, 21, 18, 4, 4, 12, 14, 14, 16, 1, -16, -2, -29, -20, -8, -1, -22, 3, -25, -13, 6, 21, 13, 21, -4, -3, 6, -1, 6, -5, -10, -5, 1, 25, 17, -10, 3, 3, 2, -33, -27, -16, -9, -3, -30, -42, -32, -34, -4, 24, 22, 33, 44, 19, 39, 21, 23, 39, 10, 14, 22, 1, -18, -14, -4, -26, -11, -11, 0, -18, -24, -19, -32, -15, -17, -24, -30, -17, -23, 17, 21, 11, 4, 0, 25, 19, -4, -8, -18, -21, -21, 6, -23, -15, -17, -9, -8, -21, -26, -12, -29, -25, -6, -14, -20, -12, -32, -29, -30, -3, -14, -22, -30, -29, -29, -33, -26, -24, -17, -3, -21, -21, -7, -2, -12, -13, -4, -31, -13, -20, -13, -22, -1, -29, -23, -25, -33, -20, -33, -4, -35, -7, -16, -8, -26, -19, -7, -8, -26, -14, -25, -30, -19, 4, 9, -10, -24, -17, -5, 8, 2, -2, -16, -2, -6, -18, 7, -10, -3, 8, 10, -4, -2, -8, -14, 9, -5, -23, 4, -18, -8, 9, 3, -23, -10, -24, -15, -16, 6, -11, 11, -7, 10, 6, -15, -14, -3, -1, 11, 1, -8, -1, -12, 6, -13, 0, -16, 5, -14, -24, -22, 2, -8, -20, 7, 12, -7, 13, 4, 7, 5, 19, 16, 32, 13, 35, 0, 12, -7, -10, -5, 0, -11, -4, -7, -5, 1, 7, 5, 5, -14, -16, -20, 9, 2, 14, -3, 10, 25, 22, 18, -2, 4, 4, 13, -2, 23, 25, 19, -17, -6, -15, -23, -4, -22, 3, -22, -21, -4, -16, 2, -1, 13, 11, 14, 13, 0, -14, 7, -11, -40, -30, -13, -11, -28, -30, -19, -32, -19, 2, -18, 3, -23, -15, -22, 8, -3, -7, 2, 12, 9, 11, -10, 17, -8, -17, -15, -34, -20, -37, -62, -38, -46, -48, -34, -36, -32, -14, -18, -17, -5, -15, -11, -23, -9, -3, 0, 12, -15, -21, 8, 8, -7, -26, -13, -22, -44, -44, -30, -26, -51, -54, -44, -23, -44, -34, -30, -1, -9, 6, 6, -12, 2, 21, -4, 4, -10, -25, -10, -14, 5, -23, -11, 8, -13, -26, -53, -60, -46, -29, -49, -43, -33, -28, -11, -8, -2, -20, 8, 9, 0, 14, 3, -6, -37, -33, 7, -7, -17, 19, 34, 18, 0, -37, -57, -59, -48, -50, -56, -49, -35, -28, -15, -14, -10, -10, -11, -1, 18, 16, 15, -27, -8, 0, -4, 8, 4, 3, 29, 35, 35, -10, -66, -51, -57, -38, -18, -25, -46, -27, -14, -21, -16, -13, -3, -2, 6, 2, 7, -12, 11, 26, -18, -13, 20, 25, 50, 36, 5, -28, -24, -46, -29, -21, -22, -30, -19, -42, -19, 3, -15, 0, -18, 11, 21, 9, 7, -5, 14, -3, -5, 3, 17, 10, 54, 14, -16, -40, -13, 12, -31, -4, 1, -16, -25, -39, -14, -10, 9, -17, -9, -1, -10, 36, 9, 13, 27, -4, -2, 13, 5, -7, 19, 10, -15, -16, -6, 18, -8, 18, -7, -12, 7, -9, -11, -18, 6, 10, 6, -17, 13, 28, -4, 22, -10, 6, -20, 5, -9, -4, 10, 14, -23, 1, 2, 2, 12, -8, 1, 22, 20, 34, 1, 13, -8, 10, -19, -1, 18, 1, -5, -13, -25, -13, -3, 3, -10, -13, 5, -2, 4, -7, -19, -13, -1, 38, 16, 23, 37, 34, 16, 6, 7, -14, -14, -10, -11, -10, -21, -22, -22, -24, -7, -5, -22, -22, 18, 19, -10, -25, -7, -6, 17, 51, 31, 19, 35, 49, 15, -19, -1, -2, 1, -20, -1, -28, -34, -9, -12, -34, -2, -6, -11, -6, 15, 24, -16, -14, -17, 14, 29, 22, 26, 21, 32, 36, 29, -11, -16, 2, -4, -5, 9, -2, -30, -11, -24, -35, -10, 9, -1, -17, -3, -10, -2, -16, -25, -1, 36, 12, 38, 43, 39, -1, 16, 0, -16, -13, 10, -5, -5, -19, -32, -28, -29, -28, -12, -1, -1, 11, 8, -2, -18, -14, 23, 20, 12, 21, 32, 46, 16, -8, 17, -17, -20, -4, 4, -20, -8, -34, -37, -30, 0, -26, -18, 9, -5, 2, 7, 15, -5, 18, 20, 25, 0, -7, 25, 33, 1, 16, 16, 4, -24, 9, -1, -10, -16, -4, -4, -36, -22, -17, -11, 9, -15, -23, -3, 12, -8, 14, 10, 26, 22, 1, -20, -5, -11, 9, -16, -10, -17, -16, 10, -11, -10, 1, -47, -19, -16, 2, -11, -18, -2, -9, 6, -16, -23, -28, -20, 0, -15, -41, -26, -10, -23, 0, -1, -15, 0, -22, 6, -15, -16, -3, -30, -12, -21, -15, -19, -22, -33, -30, -22, -25, -3, -23, -24, -17, -12, -3, -32, -16, -30, -25, -4, 4, -6, 1, 4, -12, -13, -16, 2, -15, -34, -12, -22, -6, -22, -20, -35, -20, -26, -44, -29, -15, -9, -19, -20, -4, -22, -13, -18, 0, 9, 0, 5, 6, -3, 2, 13, 4, 0, -3, -40, -24, -31, -21, -15, -15, -30, -2, 12, -17, 6, -24, 7, -19, 6, -22, -17, 4, -23, -14, 3, -6, -3, -18, 7, -6, 2, 7, -5, -15, 3, 6, 21, 6, 15, 38, 41, 1, 13, 3, -3, -21, -16, -2, 9, -1, 9, -21, 4, -18, -14, -11, -9, 12, 6, -11, -5, 20, 5, 14, 26, -1, 3, 15, 28, 28, 16, 11, 7, 6, -3, -4, -10, -23, 0, -20, 5, -4, -7, -12, 6, 6, 2, 10, 3, 3, 5, -5, 8, -11, 1, 2, 14, 13, 7, -18, -5, -12, -16, 1, -12, -10, 1, -8, 1, -12, -6, -2, 2, -17, 14, -3, 6, 13, 5, -1, -16, 12, 15, -10, -9, 12, 3, -5, -17, 3, -18, -12, -3, 8, -2, 2, -11, -1, -14, 0, -8, -1, -1, -9, -12, -13, 9, 15, -13, -3, -16, -17, -2, -15, 14, -8, -10, -4, -9, -5, -9, 12, -11, -10, -3, 10, 1, 2, 14, -6, 4, 2, -10, -15, 11, 8, 18, 20, 22, 4, 23, 27, 26, 6, 2, -2, -12, -19, -17, -11, 10, 7, 3, 13, -7, -2, 12, -3, 6, -5, 11, -7, 3, -2, -2, -15, 12, 5, 17, 20, 3, -2, 4, 24, 14, 1, -19, 12, -2, 1, -7, -10, -14, 1, -21, -12, -15, -8, -19, 4, -18, -3, -8, -18, -16, -19, 0, 10, 1, 3, 30, 10, 8, 15, -8, 0, 11, -18, -8, -11, 1, -5, -20, -11, -10, 2, -10, -15, -9, 18, -14, -15, -12, -14, -2, -23, -3, -15, -10, -21, 25, 5, 1, -1, 6, 13, 7, -4, -11, 5, -23, -23, 5, -8, -3, 10, 14, 14, 10, 16, -9, -8, -7, -10, 3, -16, -14, -11, -10, -3, 5, -3, 11, 14, -2, 11, -4, -26, -34, -12, -6, 2, 11, 8, 11, 7, 5, -14, -14, 14, -2, -17, -5, -19, 1, -16, 6, -8, 5, 5, 4, 2, -4, -7, -2, -9, -15, -5, 1, 20, 20, -11, 3, -6, -21, -27, -19, -7, -3, -11, -31, -28, -6, -23, -20, 12, 8, 7, -2, 10, -5, -4, 3, -24, -1, 2, -11, -5, 22, 8, 19, 4, -55, -45, -44, -12, -33, -28, -12, -7, -6, -15, -20, -13, 1, -8, -5, -5, -17, -9, -19, -21, -7, 14, -3, 31, 26, 29, 12, -7, -59, -35, -16, -26, -8, -7, 1, -34, -9, -11, -20, -10, 1, -9, 12, 12, -21, 2, 0, 9, 11, -5, 31, 34, 31, 20, 28, 6, -5, -5, -27, -17, -7, 7, -7, 11, -10, 20, -11, -23, -17, -16, 6, -7, -16, -1, 2, -2, 26, 13, 5, 17, 16, 35, 42, 11, -24, -28, 2, 25, 19, -4, 22, 15, 15, 32, 7, -8, 0, -16, 3, -17, -15, 7, -1, 4, 2, -3, 2, 14, 30, 36, 17, -8, -10, -11, 18, 14, -8, 22, 28, 41, 45, 22, 13, -25, -23, 0, -8, -14, -19, 11, 11, 1, 14, 22, 25, 2, 20, 37, 40, -7, -12, -1, 0, 7, 4, 27, 29, 23, 17, 9, 2, -17, -25, -1, 1, 2, 14, 8, -7, 5, 3, 13, 25, 2, 3, 16, 17, 15, -13, 6, 14, 4, 23, 27, 12, -10, -21, 5, -29, -26, -7, -13, 5, -7, 12, 2, -20, -5, -11, -4, -6, 11, -16, -8, 3, 13, -4, 20, 9, 9, 8, 27, -10, 2, -3, -13, -43, -18, -19, 2, -2, 6, 5, 4, -30, -22, -16, 6, -5, 15, -1, -8, -8, 10, 0, -1, 27, 4, 11, 4, -20, -1, -1, -32, -12, -21, -23, 3, -18, -5, 5, -11, -18, -14, -19, -20, 5, -3, 10, 16, -12, 18, 8, 15, -1, 14, -11, -13, -14, -24, -7, -19, -36, -4, -25, 6, -15, 6, 2, -7, -18, -36, -32, -19, -8, -30, -27, 4, 0, 5, 0, 2, -4, -5, 0, -13, -17, -1, -15, -17, -11, -15, -24, -3, 9, -8, -18, -14, -16, -12, -32, -8, -13, -10, -35, -23, -1, -5, 14, 10, -6, -11, -23, -20, 0, -5, -28, -4, 2, -13, -4, -8, -16, -2, 3, -10, -30, -37, -12, -18, -34, 4, -14, 7, 10, 6, 28, 6, 4, 1, -1, -2, -28, -25, -22, 3, -17, 13, -21, 1, 11, -5, 7, 4, -3, -26, -10, -9, -6, -26, 8, -17, -18, 10, -10, 5, -9, 10, -21, 4, 2, -5, -2, -12, 4, 7, -3, -1, -14, 14, -13, -15, -13, -4, -29, -16, -32, -29, -19, -27, -25, 3, 5, 4, -15, 4, 11, 18, 27, 39, 25, -4, -11, -16, 0, -16, -15, 7, -16, -7, 1, -20, -2, -14, -1, -25, -26, -6, -2, -12, -22, -33, 10, -12, 7, 10, 22, 37, 20, 17, 7, -19, -19, 12, 12, -4, -18, -11, 6, -3, -4, 11, -21, -17, -26, -7, 2, 9, 3, 15, 23, 16, -14, 8, -13, -4, 18, 2, -18, -20, -9, 7, -9, 9, 13, 10, -13, 2, 11, -5, -9, -3, 14, 0, 3, 7, -6, -2, -3, -16, 3, 8, 5, -15, -16, 5, -3, -15, 13, -10, 2, -11, -16, -8, 1, -18, 8, 11, -5, 14, 11, 2, 7, -3, 2, -14, 14, -18, 9, -9, -14, 11, -2, -4, 11, -17, 6, 7, 2, -7, -13, -13, -1, -4, -25, -10, -19, -19, -8, -15, -23, -27, 1, -13, 5, -6, 3, -12, -17, -2, 2, -7, -13, -10, 1, -3, 3, -25, -18, -9, -8, -15, -27, -11, -28, -10, -25, -12, 1, -20, -3, -15, -10, -8, -26, -5, -5, -10, 0, -8, -20, -13, -10, -2, -1, -15, -6, -15, -8, -21, 0, -27, -2, 2, -4, -12, -3, -28, -1, -24, -10, -27, -3, -9, -7, -16, -15, -2, 0, -18, 1, -27, -5, -27, -5, -5, 3, -17, -1, -23, 4, -30, -15, -15, -28, 2, -32, -26, -20, 2, -12, -7, -14, -15, -16, -7, -1, -17, -10, -1, -18, -19, -16, -11, -29, -1, -15, -12, -2, -17, -30, -11, -23, -7, 10, -14, -21, -22, 4, -14, -12, -3, -1, 5, -5, -18, -21, -20, -28, -9, -12, -20, -20, -9, -22, -26, 6, 11, 13, -9, 6, 18, 8, 21, -6, -23, -19, -5, -13, -7, -4, -36, -26, -19, -20, 0, -16, -15, -4, -17, -15, -14, -32, -27, -6, -10, -10, 12, 26, 23, 15, 4, 8, 9, 37, 12, 12, -19, -1, -20, -12, -16, -16, -4, -8, -16, -2, -6, -10, -23, -6, -8, 17, 25, 17, 29, 1, 32, -2, 11, 28, 32, 40, 40, 10, 3, -5, -9, 0, 4, -5, -25, -11, -1, -7, -23, -2, -21, -8, 20, 36, 16, 2, 26, 18, 4, 1, 21, -5, 25, 30, 41, 7, 7, 28, 17, -14, 17, -21, -14, -2, 2, -4, 6, -17, -7, 8, 14, 27, 0, 27, 3, -6, -9, 13, 11, 10, 1, 15, 20, 9, 5, 30, 22, 22, 12, -15, -3, 5, -6, -8, -13, -19, 14, 2, 21, 17, 19, 8, 23, 16, 11, 1, -3, 4, 3, 2, 0, 30, 17, 22, 27, 24, -10, -5, -28, -1, -10, -10, -5, -14, 19, 27, 12, 10, 24, 14, 32, 16, 26, 0, 19, -7, 26, 12, 7, 15, 26, 12, 42, 37, 6, -15, -24, -6, -8, -20, 6, 5, 19, 16, 8, 11, 25, 12, 28, 35, 20, 5, 20, 19, 24, 5, -3, 18, 15, 39, 22, 16, -4, -27, 6, -29, -1, -22, -8, -6, 8, 28, 9, 22, 21, 28, 8, 14, 12, 8, -4, 29, 27, 22, 0, 26, 31, 23, 3, -8, -26, 1, -14, -9, -19, -13, -7, 7, -1, -4, -7, -23, 5, 2, -6, 31, -11, -5, -3, 13, 17, 9, 26, 30, 2, 0, -9, -3, -40, -13, -21, -13, -14, -10, -4, 2, -12, -18, -11, -5, 4, -3, 2, 17, 12, 3, 16, 8, 14, 31, 36, 11, 24, 6, 2, -5, -51, -26, -5, -24, -7, -9, -22, -6, -9, -25, 14, -1, 5, 0, 0, -8, 10, -14, 9, -8, 22, 15, 16, -5, 16, -3, -8, -35, -26, -24, -21, -26, -12, -2, -29, -23, -10, 8, -18, -5, 10, 29, 1, -3, 21, -6, 9, -7, 24, 12, 25, -11, 5, -1, -24, -29, -31, -43, -23, -28, -24, -11, -20, -25, -9, 0, -17, 1, -15, 24, 4, 15, 7, -4, 12, -11, 5, 5, -6, -6, -11, -22, -17, -34, -16, -29, -27, -4, -14, -12, -26, -37, -21, 6, 1, -27, -4, 17, 13, 0, 11, -20, -23, 1, -15, 5, -19, 2, -14, -7, -29, -30, -18, -37, -11, 0, 0, 3, -18, -33, -42, -13, -24, -13, -29, -15, -14, -27, 7, 2, -5, -25, -38, -15, -17, -2, -21, -14, -22, -32, -27, -13, -23, -24, -24, -28, -7, -32, -40, -9, -12, 6, -4, -21, -6, 3, 26, -1, 6, -16, 8, -5, -36, -20, -9, -38, -24, -37, -36, -13, -27, -16, -24, 0, -1, -9, -31, -16, -8, 6, -21, -9, 20, 3, 25, 6, 20, 1, -9, -17, -3, -20, -33, -26, -32, -21, -15, 2, -2, -7, -8, -20, 2, -32, -6, -23, -18, 16, 0, -8, -13, -5, 12, -1, 20, 20, 27, 4, -19, -21, -30, -17, -28, -18, -2, -12, -1, -7, -16, -14, -4, -2, -19, 11, -11, 15, 20, 11, 13, 26, 22, -1, 11, 21, 8, -21, -17, 11, -7, -30, -22, -28, -12, -18, -22, -26, -21, -9, -2, -23, 2, 8, 12, -7, 23, 23, 23, 21, 26, 13, 11, 20, 19, 27, -4, -6, 4, 6, -23, -9, -18, 4, -26, -28, 2, -26, -15, 4, -28, -20, 0, 1, -4, 13, -3, 27, 23, 28, 34, 15, 17, 6, -4, -4, 12, -13, -19, 4, -17, -5, -24, 5, -17, 0, 5, -7, -28, -10, -1, 6, -19, -12, -7, 3, -6, 7, 7, -1, -18, -21, 6, -20, 6, -13, 1, -12, -18, -21, -17, -15, -2, 8, 14, 9, -15, 11, 12, -7, -18, -7, -14, -2, -19, -3, 14, 10, -9, 5, -1, 5, 7, 7, -12, 2, -16, -14, 13, -16, -12, 5, -16, -1, 6, -1, 12, 0, 1, 0, 7, -18, 6, -7, -10, -2, -3, 8, -2, -14, -7, -13, 3, -6, -7, 13, 13, 3, -15, -8, 2, 2, 14, -7, 12, -14, -7, -4, 2, 2, 12, 18, 27, 27, 20, -2, 28, 16, 16, 10, 13, -15, 14, -5, 9, 2, 7, -6, -2, -19, -5, -1, 9, -1, 11, -14, -1, 3, -6, 12, 15, -2, -8, 1, 16, 20, 34, 21, 8, -9, 16, -12, 15, -6, -9, -1, 4, -5, -14, 9, 0, -12, -17, -20, -29, -20, -31, -22, 0, -27, -25, 8, -11, 10, 13, 7, 18, 29, 20, -2, 3, -3, 2, -12, -13, 3, -13, -21, -26, -27, -29, -21, 2, -24, 5, -9, 4, -22, -5, 7, -9, -18, -30, -6, -11, 25, -4, 8, -1, -11, -16, -3, 5, -24, -16, -12, -42, -10, -30, 3, -2, -4, 1, 14, 3, -1, -16, -2, -9, 7, -19, -18, -21, 3, 29, 8, 17, -3, 4, -1, -9, -12, -30, -11, -29, -16, -20, 11, 0, 13, 18, 14, -1, -8, 6, 0, -13, -15, -5, -17, -17, 11, 10, 20, 0, 11, 11, -17, -2, -21, -21, -31, -2, -28, 7, 4, 5, 6, 8, 3, -30, -12, -14, -18, -26, -1, -1, -3, -7, 5, 1, 12, 1, -10, -18, 1, 10, -19, -23, -3, -2, -7, -9, -15, -10, 11, 16, -34, -31, -31, -45, -22, -9, -13, -38, -24, -28, -33, 7, 7, -17, 1, 6, -13, 2, -20, -17, -28, -7, -3, 5, -3, 21, 11, 17, -19, -36, -29, -24, -10, -14, -10, -8, -37, -22, -7, 13, 4, 14, 13, -7, 12, -3, -23, -17, 2, -1, -6, 19, 9, 17, 18, 29, -7, -24, -6, 12, 3, 18, 0, -21, 5, -7, -19, -12, -7, -14, -15, -17, -10, 12, 9, -13, -8, 7, 0, 27, 16, 26, 14, 4, -10, -27, 20, 1, 4, 8, 20, -3, -7, -20, -13, -20, 2, -19, -5, 15, 7, -9, 5, 11, 0, 10, 24, 3, 22, 29, 10, 31, -12, -5, 0, 39, 12, 27, 17, 2, -2, -9, -10, -18, -17, -3, -17, 4, 0, -15, 10, 22, -8, -3, 28, 20, 6, 14, 8, -4, -19, -28, 15, 4, 17, 0, 16, 18, 15, -9, -10, -12, -1, -26, 12, 14, -4, 3, -20, 9, -3, 4, 25, 3, -7, 19, 17, 12, -33, -22, 4, 4, 17, 41, 17, 31, -4, 3, -22, -18, 3, -12, -4, -8, -7, -11, -18, -25, -13, -15, 5, 2, 11, 21, -3, -26, -33, -29, 18, 11, 12, 29, 30, 6, -23, -23, -10, -31, -19, -22, 4, -12, -6, 3, -22, 0, -14, 22, 19, 1, 8, 10, -8, -18, -26, 13, -3, 11, 5, 31, 24, 1, -30, -31, -10, -9, 7, -3, 0, 14, -14, -3, -30, -20, -20, 17, 8, 10, -12, -10, -4, 6, -6, 26, -16, 3, 0, -1, 22, 11, -14, -27, -30, -27, 4, -16, -13, -1, 3, -16, -19, -22, -3, -8, -2, -18, -9, -15, -2, -10, 20, 3, -13, -16, 7, -5, 11, -29, -35, -41, -25, -22, 6, -3, -16, 3, -9, 5, -4, -2, 5, -8, -40, -41, -12, -28, -19, 9, 0, -5, -13, 5, -11, -15, -18, -9, -48, -9, -28, -5, 15, -19, -14, 7, -18, -20, -3, -12, -7, -29, -17, 1, -19, -4, -23, 11, 12, -19, -15, -2, -7, -14, -36, -10, -12, 7, -7, 13, -7, 9, 0, 0, 14, -16, 3, -4, -18, -7, -4, -19, -22, 6, -21, 1, -13, -24, -25, -12, -21, -27, -24, -18, 3, -19, -6, 8, 7, 2, 0, -11, -2, -2, -9, -9, -21, -4, -24, -23, 3, 6, 5, -1, -9, -15, -22, -12, -11, -20, -7, 17, -8, 11, -9, -16, 8, 9, -15, 11, -5, 0, 2, -21, -4, -4, -11, -10, 15, 15, -10, 7, -2, -8, -19, 14, 11, -16, -5, 25, -3, 14, 11, -16, -3, -10, -17, -13, -9, 0, -16, -11, -6, -11, 11, -7, 5, 11, 18, 18, -1, 14, 15, -11, -5, -2, 12, 16, 19, 0, -6, 3, 5, 8, -5, -11, 13, 0, 0, 9, 7, -2, 18, 1, 24, 6, 24, 25, 4, 24, 4, -2, -10, -1, 5, 18, 13, 12, 11, -11, -7, -15, -3, -8, 5, 11, -3, -5, -1, 13, -3, -11, 6, -17, -4, -18, -7, 5, -12, -18, -8, -17, 2, 11, -1, 8, 2, 5, 8, -8, -16, -5, 5, -14, 16, 1, -7, 2, -11, 1, -2, -9, -15, -5, 3, -14, -14, -6, 0, 0, 4, 14, 13, -2, 12, 16, -6, 15, -2, -7, -3, -3, 5, -11, -10, 16, 14, 5, -8, 8, -15, -16, 11, -12, -12, 12, -13, -9, 9, -4, -16, -8, -10, -4, -8, -2, 14, 2, -1, -13, 9, 9, -14, -1, 13, -9, 21, 4, -3, 9, -25, -28, -13, 7, -7, 8, -11, -11, 16, -4, -5, -10, 14, -17, 6, -14, 14, -17, 3, 9, 3, 1, -14, 0, -6, 12, -6, -32, -35, -37, -19, -48, -24, -7, -12, -21, 2, 6, -16, -12, -5, -9, 0, -5, 11, -9, -14, -17, -2, 15, -12, 2, -2, -25, -30, -6, -22, -16, -34, -28, -20, -15, -19, -4, 3, -3, 8, -1, -7, 8, -15, -11, 5, 7, 16, 1, 7, -13, -11, -14, 13, -18, -26, -28, -18, 1, -23, 9, -21, -6, -21, -38, -8, -9, 15, -18, -6, -6, -12, -4, -17, -1, -4, 18, 21, 8, 15, 17, 1, 13, -14, -6, -23, -14, 3, 4, -19, -8, -17, -8, 7, -11, -2, 5, 4, -1, 0, 5, 0, 17, 18, -2, 31, 20, 3, 21, 0, 16, 2, 7, 15, -18, -16, -11, -7, -1, 2, -10, 7, 19, -6, -15, 14, 2, 1, 11, 2, -3, -1, 34, 35, 26, 25, 30, 16, 31, 22, 31, 16, 11, 19, 17, 17, 18, 24, 38, 21, 41, 34, 23, 7, -12, 7, -6, -3, 0, 26, 35, 28, 30, 37, 29, 27, 47, 54, 42, 55, 62, 20, 25, 5, 29, 20, 9, 31, 10, 8, 4, 33, 12, -4, -4, 10, 6, 12, 27, 54, 46, 56, 44, 46, 57, 67, 60, 74, 53, 53, 35, 10, 1, 6, 22, 13, 7, -31, -18, 24, 10, -2, 3, -1, 11, 13, 16, 32, 51, 31, 25, 37, 17, 14, 36, 12, -4, -23, -2, -9, 15, 8, -2, -4, -31, -38, -27, 7, 10, -2, 7, -9, 10, 10, -15, -14, -25, -15, -8, -19, -29, -27, -56, -59, -54, -38, -18, 4, -17, -16, -13, -47, -51, -27, -42, 9, -4, 13, 10, 3, 8, -22, -49, -31, -28, -30, -21, -50, -33, -40, -72, -46, -53, -41, -26, -10, -11, -33, -26, -23, -37, -40, -6, 7, 2, -4, -18, 11, 9, -18, -51, -42, -65, -60, -48, -35, -51, -49, -55, -46, -32, -27, -3, 13, 7, -13, -18, -12, -34, -13, 8, 20, 2, -4, -16, -6, 17, 6, -14, -59, -63, -52, -49, -31, -52, -47, -17, -6, -15, -9, -15, 2, 2, 9, 9, -3, -10, -1, 13, 13, 8, 12, 13, -14, 13, -1, -50, -42, -60, -26, -33, -25, -21, -13, -13, 0, 11, 7, 18, 16, 3, 20, 29, 36, 6, 18, 25, 25, 30, 14, 16, -1, -1, -8, -18, -48, -42, -26, -10, 8, -5, 1, -9, 8, -1, 0, 20, 18, 5, 11, 28, 5, 32, 14, 25, 53, 27, -7, 9, 10, 0, -3, -19, 5, 15, 23, 11, -15, 1, -18, -2, 19, 27, 19, -1, 8, 25, 6, 2, 12, 2, 12, 2, 5, 9, -7, -11, 7, -14, -8, 2, 3, 14, 4, 41, 2, 13, 18, 11, 26, 16, 22, 9, -8, -8, -19, -10, -11, 2, 3, -5, 17, 16, -12, 13, -1, -8, 0, 44, 8, 7, 20, 28, 17, 9, 20, 11, 12, 5, 19, 1, -13, -19, 6, -10, -20, -17, -13, 19, -8, -7, -8, 2, 5, 11, 23, 25, 24, 1, 15, 21, 19, 24, 17, 12, 15, 8, -6, -5, 3, 5, -13, -12, -28, -12, -6, -4, 1, -18, -12, 11, -3, 17, 9, 3, 30, 30, 7, 24, 21, 8, 13, 3, 4, -11, -4, 3, 26, 8, -9, -30, -3, -20, -6, 21, -1, 16, -18, -13, 13, -4, 11, 4, 7, 20, 25, 12, 10, -10, 21, -20, 1, -3, -8, 12, 3, 4, 15, 7, 11, -2, -14, 15, 2, 0, -2, -5, 6, -6, 6, 16, 10, 5, 6, -24, -9, -26, -18, -19, -18, 1, -6, -13, 21, 1, 5, -12, -11, -5, -5, -10, 8, 9, -17, -8, 11, 0, 15, 4, 3, 15, -10, -8, 7, 10, -4, 2, 0, 16, 27, 37, 14, 27, 13, 15, -18, -13, -3, 4, 14, -1, -5, -14, -14, 11, -12, -5, -9, -23, 9, -1, 5, 1, 5, 17, 1, 18, 29, 19, 14, 7, 21, -13, 14, -14, 4, -8, 9, 12, -17, 11, 12, -5, -17, 15, 12, -2, -5, 14, 11, 15, -1, -6, 16, 8, 2, -10, 15, 6, -2, -15, -6, -15, -16, 7, -16, 8, 11, -8, -17, -9, -14, -8, 7, -3, -16, -8, -19, 11, -11, -4, -2, -13, -1, -3, 8, 1, 7, -7, 12, 13, -8, -11, -12, -2, -14, 11, 13, 3, -5, -8, -2, -9, 11, -2, -1, -18, -8, -15, 0, -15, -19, 3, 6, 0, 6, -5, 3, 8, -18, -2, -18, -20, 0, -13, -3, -18, -17, -15, -14, -1, 12, 16, -5, -7, 4, -11, 16, -2, 15, 17, -15, -11, -2, -18, -2, -15, -6, -15, -3, 2, -8, -4, 0, 5, -5, 7, 7, -17, -8, -2, 18, 5, 5, 3, 23, 34, 2, -2, -13, -7, -6, -25, -23, -10, -5, -4, -4, 6, -2, -7, -3, -11, -2, -13, -2, 0, 10, 8, 24, 34, 32, 20, 6, -9, 9, 21, 5, -16, 9, 5, -27, -3, -16, -21, -17, 12, -20, -13, -3, -17, 0, 8, 10, 13, 30, 6, 26, 10, 11, -16, 9, 9, 2, 9, -3, 13, -14, 0, -12, -14, -4, 8, -1, -11, 9, 10, -8, 8, 3, 13, -16, 9, -10, -25, -37, -35, -13, -41, -31, 4, 1, 1, 7, 15, 6, 0, 3, -1, -25, -19, -2, 12, -5, 5, 9, 6, 1, 15, -18, -19, -2, -24, -25, -17, -29, -19, -25, 20, 1, 9, 2, -16, -6, 12, 30, 2, -32, -51, -20, 8, 1, 8, -6, -17, 9, -16, -17, -14, -48, -43, -37, -17, -31, -24, -8, -5, 16, -11, -21, -7, -11, 5, -1, -26, -17, -59, -26, 2, -19, 12, 4, -1, 12, -4, -38, -54, -51, -32, -38, -22, -44, -33, -16, -11, 2, -12, -44, -35, -16, 5, -11, -15, -38, -45, -19, -2, 1, 9, -9, -13, -6, -12, -11, -46, -48, -45, -41, -56, -42, -35, -29, -8, -3, -10, -28, -36, -7, 7, -10, -32, -54, -36, -16, 5, -4, -17, 11, 1, -3, -7, -40, -37, -42, -50, -36, -57, -60, -24, -18, -29, -16, -40, -52, -46, -4, 1, 6, -30, -40, -46, -7, -4, -2, -1, -10, -17, 4, -8, -26, -47, -41, -4, -23, -8, -23, -3, -3, -22, -23, -15, -52, -39, -3, -10, -13, -12, -16, -7, -18, 3, 2, 9, 10, 2, -6, -7, -21, -3, -2, 2, 0, 27, 31, 16, 31, -13, -13, -4, -36, -32, -21, -9, 2, -25, -21, 7, 28, 6, -10, 11, -7, 2, 17, -2, 2, 25, 14, 53, 56, 30, 47, 34, 25, -4, -15, -21, -15, -44, -27, -29, -17, 10, 26, 12, 14, 3, 0, -17, 10, -1, 14, 10, 9, 24, 16, 29, 61, 55, 23, 36, 42, 22, 3, -1, 5, -6, -4, -31, -4, -17, -2, 47, 30, 14, 4, 11, 11, -16, 23, 30, 36, 17, 19, 41, 52, 32, 21, 28, 20, 13, 3, 26, -7, 0, 16, 4, 37, 34, -1, 38, 33, 23, -6, -12, -1, -11, -5, 31, 35, 13, 31, 13, 40, 41, 17, 16, 29, -3, 21, 16, -13, 10, 8, 2, 43, 7, 16, 25, 35, 13, -4, -17, 11, 7, 19, 12, 27, 30, 28, 34, 19, 24, 0, 19, 1, 13, -6, -8, 27, 15, 5, 17, 11, 21, 26, 21, 11, 5, 15, -17, 10, -19, 17, 28, 3, -10, 24, 23, -2, 14, -6, -1, -2, -9, 1, 12, 14, 16, 6, 13, 27, 3, 11, 16, 5, 6, -1, -15, 10, -7, 1, 34, -3, -14, 22, 9, 12, -4, 3, -18, -29, -26, 6, 15, 2, 12, 8, 1, 20, -10, 0, -2, 14, 3, -12, -10, -1, -11, 16, 34, 8, 12, -13, -5, 6, -23, -9, -24, -31, -19, -1, -5, 22, 15, 32, 14, 28, -12, 19, 15, -9, -5, 2, 5, 11, -14, 2, 24, 8, -7, 2, -17, -27, 3, -14, -16, -32, -26, -3, 6, -15, 2, 7, -3, 0, 13, -5, -12, 0, -8, -16, -17, -10, 0, -7, -22, -1, -23, -41, -30, -25, -2, -21, -19, -12, -12, -27, -2, -24, -12, 9, 8, 0, -6, -18, -11, -13, 3, -2, -19, -9, 1, -1, -12, -9, -26, -21, -37, -21, -34, -27, -21, -25, -32, -28, -36, -14, -24, -5, -4, 13, 5, -5, 15, 15, -18, -2, -10, 5, 3, 5, -11, -6, 4, -19, -31, -45, -45, -19, -36, -52, -22, -14, -15, -12, -41, -53, -34, -16, -13, 7, -8, 3, -7, -2, -13, -17, -12, 12, -13, -11, -9, -8, -7, -5, 8, -12, 2, -10, -12, -15, -9, -22, -24, 8, -9, -13, -18, -5, -11, 13, -10, -2, 11, 7, 3, 1, -17, -9, -4, -7, 12, 12, -18, 14, -19, 3, -10, -10, -12, 13, -16, -13, -20, -13, 1, 13, -6, -5, -17, -3, 9, -8, -16, -16, -1, -16, 6, -11, -1, -15, -11, -5, 6, -19, 5, -15, -16, -6, -16, 0, -20, 6, -15, -5, -3, 10, 3, 4, 8, -21, 12, -20, -12, -17, 1, 4, -19, 3, -11, -10, -23, -4, 10, -24, 2, -11, 4, -4, -23, 9, -14, 7, 7, -11, -11, -5, 11, 0, -13, 8, 0, 11, 4, -19, -1, -7, -20, -11, -18, -18, -29, -30, -3, -1, -18, 8, -12, -2, -13, -10, 1, -2, -5, -17, -18, -10, -6, 1, -8, -12, 2, -25, -22, -27, -39, -37, -43, -53, -30, -26, -26, -3, -14, 3, -19, 3, 3, -20, 0, -17, 0, -16, -13, 4, -8, -18, -14, -23, -9, -7, -26, -32, -51, -57, -57, -61, -34, -53, -42, -31, -15, -22, -36, -17, -9, -7, -13, -12, -19, -13, -8, -8, -7, 6, 1, -5, -3, -16, 5, -13, -40, -7, -15, -41, -36, -28, -46, -42, -37, -33, -24, -10, -13, -6, -15, -11, 7, 8, 8, -11, -9, 15, 8, 0, -15, 3, 19, 5, 12, 30, 22, 2, 20, -3, 5, 4, 20, 17, 8, 3, -3, 16, -10, -5, 9, -20, 1, 4, 1, -2, 11, -11, 24, 14, 27, 42, 11, 26, 13, 36, 32, 28, 13, 10, 30, 1, 11, 13, -3, 3, 2, -11, 11, -20, -13, 13, 12, -4, -17, 19, -2, 29, 34, 9, 5, 27, 31, 26, 17, 14, 21, 18, 15, 7, 5, 26, 22, 2, -7, -19, -12, -16, 4, 7, 12, 25, 8, 23, 36, 4, 28, 28, 19, 28, 10, 25, 41, 20, 5, 19, -5, 5, 11, 6, 42, 16, -12, -7, -5, -4, -12, -13, -14, 4, 3, 27, 31, 7, 23, 33, 29, 5, 15, 40, 37, 20, 22, -12, 7, 1, 31, 26, 9, -21, -7, -15, -19, -17, -14, -5, 15, 8, 11, -2, 30, 5, 14, 22, 9, 13, 3, -3, 10, 22, 5, -2, -10, 1, 28, 1, -11, -18, -43, -15, -9, 9, 2, -11, 10, 4, 8, 19, -3, 25, 27, 8, 24, 9, -37, -32, -12, 31, 25, -16, 9, 4, 21, -12, 5, -42, -39, -21, -2, -21, -20, -5, 12, 15, -3, -14, 16, 12, -6, -20, -26, -33, -41, -8, -12, -9, 16, 10, 0, 5, 15, 17, -2, -22, -26, -12, 1, 0, 8, -14, -14, -3, -3, -24, -2, 7, 17, -24, -31, -6, -27, -13, 0, -14, -6, -12, 14, 36, 23, 19, 0, -12, 9, 6, -9, -7, 4, -14, 2, 13, -10, 0, 17, -1, -7, -20, 11, -21, -7, -31, -21, -12, -8, -3, 43, 14, 32, 38, 19, -7, 5, -23, -15, -9, -18, -7, -14, -14, 6, 9, 10, 17, 12, 27, -14, -7, 14, -22, -16, -8, -7, 15, 40, 39, 36, 17, 21, -15, -11, -5, -11, 0, -15, -17, -19, -15, -5, -11, -1, 31, 24, 20, 5, 16, 6, 2, -26, -6, 13, 3, 29, 13, 24, 5, 16, -7, 3, 3, -10, 8, -16, -10, -8, -4, 3, -20, -9, 5, 0, -6, -14, 6, -7, -5, -12, -27, 6, 16, 3, 18, -1, 30, 15, -23, -16, -9, -20, -21, 5, 7, -6, -11, 12, -6, -43, -22, -21, -41, -23, -45, -41, -19, -22, -22, -1, 3, -11, 15, 17, 16, -21, -16, -4, -7, -16, -15, -5, 2, -16, -21, -18, -36, -29, -64, -48, -26, -62, -52, -43, -22, -20, -37, -19, -3, -38, 5, -17, -10, -14, -28, -2, -10, -2, 5, -16, 5, 10, -22, -26, -21, -26, -45, -40, -30, -44, -21, -29, -20, -50, -4, -5, -34, -27, 5, -34, -16, -51, 2, 10, -12, 5, -9, -12, -11, 1, -24, -3, -31, -23, -34, -3, -8, -24, -17, -27, -32, -1, 7, 12, -20, -28, -36, -34, -39, -36, -16, 4, 9, -18, -21, -14, 10, -19, 9, 14, -7, 24, 2, 10, 6, -5, -6, -6, -7, -12, -12, -11, -21, -3, -32, -25, -35, -23, -15, -8, -5, -2, -7, -6, -11, -4, -4, -1, 25, 31, 13, 16, -4, 18, -6, -16, 8, 20, -5, 23, -1, -30, -15, 1, -5, -8, -13, -12, -8, -9, -6, -19, -8, 11, -14, -7, 9, 30, 12, 26, 8, 38, 41, 28, 29, 16, 12, 24, 24, 25, 26, 21, 6, -2, -8, 6, 2, 10, -10, -10, -13, -4, -14, 2, -20, 0, 10, 21, 33, 34, 16, 6, 46, 35, 45, 34, 34, 8, 16, 0, -9, -18, -21, 8, 3, -8, 7, 12, 9, 8, 4, 6, -9, -5, 7, -4, 1, -3, -8, 10, 0, -5, 8, 14, -12, -8, -1, 11, -9, 4, -9, 10, -14, -5, 12, 16, -4, 12, 2, 12, 13, -8, 6, 7, 20, -9, 8, -4, 18, 19, 0, 14, 4, 15, -1, 5, -7, 13, 3, 0, 9, 20, 19, 18, 17, 13, -6, 23, -7, -6, -5, -8, 17, -12, 13, -8, 4, 0, 7, -7, 18, -2, 12, -2, 19, 7, 8, 2, -3, 23, 23, 18, -5, -1, 2, 4, 3, -3, 10, 11, 22, -2, 8, 1, -1, -10, 0, 17, -14, 2, 1, -13, -9, 4, 10, -4, 1, -5, 15, 14, 3, 10, 10, 21, -9, 5, 6, 1, -9, -16, 17, -7, -19, -11, -25, -13, -29, -32, -27, -15, 1, -19, 10, 21, 1, 14, 21, 21, 16, 0, 20, -12, 19, 12, -7, 10, 7, -11, -1, 16, -15, -8, -23, -23, -17, -18, -39, -24, -9, -17, -1, -16, 14, 19, 20, 14, 12, 1, 10, 24, 11, 10, 16, 10, 23, 34, 27, 17, 18, 22, 5, 6, -24, -10, -29, -34, -24, -19, -21, -23, 7, 14, 16, 13, 7, -1, 14, 17, 7, 8, 27, 39, 34, 16, 25, 19, 12, -9, -20, 20, 2, -13, -18, -16, 0, -26, -20, -28, 15, 8, 22, 18, -9, 16, 6, 20, 21, 44, 16, 7, 31, 29, 17, 8, 12, -8, -2, -2, 25, 13, 5, -23, -23, -38, -24, -14, -25, 13, 20, 0, 16, 16, 16, 30, 11, 14, 15, 3, 25, 27, 15, 18, -1, 12, -1, 22, 34, 36, 19, -25, -22, -52, -25, -18, 5, 0, 2, 22, 4, -1, 21, 15, 5, 16, -10, 12, -6, -6, 10, 5, -11, -2, -6, 13, 41, 35, -5, -35, -57, -41, -42, -18, -11, 17, 12, -11, -10, 5, -3, -12, 7, 14, 3, -9, 12, -22, -15, -13, -18, -16, 17, 27, 47, 24, 2, -40, -52, -24, -15, -35, -2, -4, -5, -1, 13, -2, 10, -22, -10, -3, -29, -5, -21, -2, -7, -31, -27, -27, -24, 20, 7, 25, 4, -37, -28, -14, -24, -24, -2, 11, -7, 7, -6, 1, -5, -8, -14, -29, -20, -41, -37, -38, -14, -5, -19, -18, -3, 11, 17, 21, -35, -53, -36, -3, -32, -19, 26, 18, 14, 6, -1, 17, 14, -12, -16, -33, -41, -40, -39, -22, -8, -10, -9, -34, -4, 18, -4, 12, -22, -20, -4, 10, -1, 14, 20, 29, 5, -4, 7, 3, 1, -28, -33, -42, -36, -40, 3, 1, 15, 10, 2, -34, -8, 14, 23, 13, 2, -33, -5, -7, 6, 36, 31, 3, -5, -5, 11, 0, 10, -9, -33, -21, -20, -8, 7, 37, 4, -7, -20, -9, 13, 8, -2, -11, 15, 12, 8, 17, 15, 20, 18, 0, 18, -2, 20, 4, 13, -8, 1, -10, 8, -3, 32, 5, 13, -16, -1, -5, 19, 16, 27, -1, 25, 17, 5, 10, 10, 23, 22, 1, -9, 5, 7, 22, 1, -5, -21, -10, -5, 12, 2, -5, 17, -11, 15, 25, 9, 0, 13, 3, 16, -6, 20, 26, -3, 22, 24, 15, -9, -7, 23, 17, -8, 9, -34, -5, 3, -2, 2, 19, -2, 18, 4, 21, -4, 14, 10, -4, -9, 7, 2, -1, 13, 19, 28, 12, 20, -5, 15, 17, -10, -11, -10, -16, -14, -20, 15, 2, 22, 4, 0, 2, 17, -11, -22, -8, -15, -30, 0, -18, 8, -13, 29, 18, 4, 5, 19, 10, -6, 8, -17, -19, -19, -17, -11, 21, 21, 21, 19, 1, 0, 5, -41, -38, -38, -9, -26, -6, -3, 15, -8, -1, 12, -5, 9, -6, 0, -9, -28, -41, -25, -17, -26, 8, 15, 5, 4, 13, -18, 7, -14, -21, -6, -33, 1, 5, -5, 18, 2, 0, 2, 18, 16, -2, -13, -4, -19, -30, -4, -3, -3, 7, 18, -7, 22, 19, 8, -19, -10, -12, -28, -1, 0, -5, -12, 6, 11, -5, -6, -6, 15, -8, -16, -14, -10, 8, -5, 13, 4, 0, 18, 27, 7, 21, 2, -5, -27, -27, -19, -5, -5, 8, -17, 2, -8, 15, 11, 6, -3, -11, -6, -12, -6, 1, 0, -14, 5, -15, 1, 3, 4, 19, 6, -14, 7, -26, -11, -34, -29, -9, 5, 14, 20, 14, -6, 9, -1, -2, -7, 1, -7, -13, 19, 3, 2, -1, -6, -8, -18, 2, 6, -18, -9, -12, -35, -6, -19, -28, -8, 8, 5, 9, 17, 5, 11, -10, 22, 14, -14, 11, -9, 12, 14, 18, 6, 12, 6, -10, -3, -9, 14, -2, -3, -5, -13, 10, 14, 19, 22, -11, 5, 10, -7, 7, -2, 5, -8, 18, -11, 17, 18, 13, 5, 1, 8, 16, 14, 24, -8, 23, 23, 20, -11, 14, 8, 10, 4, -5, 11, 12, -18, -12, 6, -17, -4, 5, -4, -16, 2, -7, 6, -2, 12, 2, 0, 9, -20, 12, 11, -1, 11, -13, -18, -7, 4, -11, 3, -11, 9, 11, -3, -18, -6, -1, 5, 7, 5, 4, -6, 3, 2, -18, 2, 8, -3, 12, 4, -13, 16, 1, -17, 13, -17, 11, 6, 10, -13, -15, -20, 8, -10, -3, 17, 19, 13, 14, 18, 0, 20, 7, 36, 19, 3, 17, 13, 14, -5, -14, -2, -1, -15, 6, 12, 7, -16, -4, -19, -12, 9, -13, 18, 11, 8, 19, 17, 7, 29, 8, 13, 32, 14, 30, 30, -8, -3, -10, 12, -12, 8, -10, 13, 14, 9, 2, 7, 8, 14, 12, 13, 0, -1, 30, 17, 1, 20, 11, 16, 28, -2, -3, 32, 10, 19, -10, 0, 8, -5, -18, 8, 4, 10, -5, -5, -12, 10, -6, 20, 8, 12, -13, -7, -11, -1, 11, 14, 3, 0, 22, 8, 27, 4, 5, -2, 4, 7, -18, -9, -4, 6, 0, -20, 7, 7, 12, 13, 7, 3, 2, 10, 12, -17, 3, -1, -11, 8, 2, -3, 7, -12, 9, 5, 6, 17, -11, 10, -10, 8, -8, -20, -17, -31, -34, 8, -18, 1, 13, -7, -4, 11, -5, 8, -23, -9, -6, -14, -15, 4, -9, -30, -11, -7, 8, -10, 3, -6, -20, -20, -16, -15, -10, 9, -24, 4, 24, -1, 1, 0, 8, -16, -12, -25, -31, -12, -6, -1, 2, -24, -17, -13, 6, 2, 8, 6, 12, -15, -4, -2, 2, -13, 10, -6, 2, 4, -14, -20, 9, -5, -17, -13, -22, -2, 8, -14, 10, -20, -1, 10, -6, -16, -17, 12, -16, -1, -1, -26, -24, 11, -19, 3, -11, -19, -10, 0, 9, 12, -3, -21, -11, -17, -9, -1, -15, 3, 13, 22, -11, -10, -5, 12, -7, 14, -12, -25, -22, -23, -27, -21, -39, -46, -36, 2, -9, -1, -19, -19, 6, 9, -10, -4, -14, 27, 12, 6, 13, 15, 11, -12, 8, -18, -11, -24, -34, -2, -30, -20, -40, -48, -44, -1, 6, 1, 2, 0, -2, -20, 0, 8, -15, -14, 17, 6, -12, 8, 0, 6, 0, 4, -27, -36, -15, -15, -8, -6, -34, -43, -9, 29, 11, -2, -17, 3, -4, 12, 14, 17, -14, 0, 1, 16, -10, -12, 0, 3, 4, 8, -7, -33, 13, 5, -14, -1, -2, -21, 22, 54, 31, 36, -19, -12, 4, -10, 0, 12, -4, -14, -14, 19, 2, -1, 10, -10, 3, -5, -4, 9, 22, -19, -14, -13, -24, 12, 49, 59, 57, 33, 2, -26, 3, -12, -20, 7, -7, -10, 3, 19, 13, 6, -6, 6, -17, 18, -10, -11, 5, 9, 1, 5, -14, 11, 17, 20, 45, 6, 12, -6, -24, -23, -12, -20, 4, 21, 13, 26, 17, 15, 3, 4, 6, 15, 19, 13, 3, 6, -14, 3, -16, 12, 15, 33, 25, 16, -10, -16, 9, 0, -22, 6, -3, 9, 5, 31, -7, -17, -12, -4, 1, 2, 10, -4, -10, 9, 20, -8, -15, 15, 5, 25, 21, -6, 13, 11, 18, 11, -6, 7, 9, 24, 37, 5, 16, 15, -8, 1, 4, 7, 7, 5, 4, 34, 26, 27, -1, -2, -3, -6, 28, 27, 26, 42, 19, -3, 11, 11, 3, 36, 33, -3, 10, 3, 9, -18, 16, 15, -5, 2, 38, 42, 25, 23, 21, 26, 26, 15, 26, 17, 43, 46, 32, 10, 31, 10, 7, 4, 22, 0, -17, -13, -6, -5, 5, 25, 30, 10, 42, 29, 12, 23, 18, 12, 10, 15, 41, 37, 16, 10, 20, 16, 19, 19, 19, 10, 9, 5, 0, -11, -10, 7, 12, -14, 28, 37, 11, 10, 12, -1, 10, 8, 0, 22, 4, 9, 21, 6, -9, 7, 24, -7, -11, -7, -9, -12, -20, 5, -12, 2, -5, -12, -1, -7, -11, -19, -32, -19, -25, -35, 5, -6, -9, 3, -8, -14, -4, -10, 3, -6, -15, -13, 5, -15, 0, 6, -16, 13, -6, -3, -15, -3, -19, -29, -39, -38, -16, -20, -20, -20, -29, -24, -36, -4, -22, -2, -21, -22, -25, -20, 4, -18, 7, -18, -17, -3, -2, 3, 1, -24, -20, -16, -31, -1, -8, -18, -7, -42, -14, -13, -24, -16, -17, 4, -6, 7, -4, 4, -10, -13, 11, -20, -12, 2, 1, -9, -17, -15, 4, -6, -8, -1, -23, -26, -18, -14, -27, 1, -9, 2, -22, -21, 5, -6, 11, -1, 1, 0, 0, 10, 9, -15, -17, 9, 1, -18, 8, -8, -15, 12, -12, 0, 14, -2, -10, -10, -5, 11, -3, 5, 9, 7, -7, -9, -13, -12, -16, 14, 6, 2, -11, 2, 0, -4, 12, 2, -11, 11, -19, -7, 3, -8, -10, -5, -1, 4, -14, 8, 9, 8, 3, -1, -16, -18, -20, -11, 8, -4, 6, 11, 9, -9, -12, -3, 1, -19, -17, -11, -2, -12, 8, 14, -9, 2, 11, 10, -3, -5, 10, -18, 13, 4, -1, 13, -2, -6, -10, -10, -3, -19, -17, 7, 6, -1, 4, -13, -2, -16, 6, -4, 4, -12, -11, -6, -22, -3, 9, 10, -11, 2, 11, -8, -11, -15, -14, 9, -20, -12, -10, 13, -4, 0, 11, 27, 28, 1, 29, 9, -16, 7, -17, -22, -1, -23, -26, -22, 0, -3, -20, -2, 9, -14, -7, 9, -3, 3, -1, 30, 31, 26, 40, 38, 27, 37, 16, 20, 12, -22, -15, -3, -37, -38, -14, -14, -19, 4, -18, -18, -21, -20, -18, -5, 8, 17, 22, 23, -9, 16, 10, -8, 12, 23, 17, 11, 18, -7, 24, 11, -2, -23, -24, -25, -20, -3, 3, 7, -3, 0, -20, -14, 23, 25, 20, 18, -5, -11, 0, -2, 10, 11, 13, -4, -5, 7, 4, -8, -14, -26, -18, -30, -32, -6, 13, -3, 5, 9, -16, -9, 23, 28, 2, 19, 15, 3, -7, 3, -9, -17, 4, 7, -7, -5, -7, 4, -20, -38, -27, -45, -41, -5, 5, 2, 6, -17, 4, 14, 11, 30, -8, 10, 17, -12, 4, -30, 7, -10, -7, 2, 21, 4, -3, -12, -21, -30, -31, -33, -38, -8, -4, 3, -7, -3, 12, -4, 15, 25, 16, 1, 0, -22, -19, -15, -17, 11, 16, 21, 32, 4, 18, -20, -12, -34, -15, -22, -28, 0, 7, 4, 2, -10, -8, -9, -5, 2, -16, 0, -14, -30, -32, -3, 10, 18, 7, 10, 24, 17, 1, -16, -25, -41, -35, -11, -1, -17, -21, 3, 12, -19, -18, -5, -11, -18, -20, -19, -27, -28, -25, -15, 19, 20, 2, 18, 16, -5, 7, 8, -27, -53, -28, -4, 3, -6, 10, 0, 5, -2, -1, 4, -7, -14, -42, -42, -22, -32, -9, -13, 33, 7, 6, -13, -1, -14, -16, -10, -36, -47, -50, -23, 1, 13, -2, 0, 4, -15, -14, -4, -14, -15, -5, -30, -8, -7, -14, -28, 22, 22, 23, 0, -26, -12, 3, -12, -49, -30, -40, -10, -11, 14, 7, 5, -7, 5, 7, 4, -24, -30, -18, -10, 12, -9, -19, -44, -12, 14, 12, 0, -4, -33, -36, -25, -28, 2, -3, -12, 8, 4, -11, -8, -6, -11, 5, 0, -10, 0, -17, -4, -18, -28, -37, -33, -28, 24, 23, -6, 1, -22, -52, -14, -18, 3, -7, 5, -4, 4, 10, -1, 12, -12, 2, -4, 8, -9, -35, -27, -27, -30, -29, -41, -52, -4, 23, -4, -30, -36, -16, -9, 1, 19, 36, 25, 30, 2, 3, 2, -18, -11, -15, -5, 18, -25, -34, -37, -42, -48, -62, -64, -61, -28, -5, -19, 1, -20, 0, 20, 11, 5, 22, 32, -15, 5, 9, -6, -15, -1, -3, 11, -13, -3, -11, -10, -34, -52, -67, -60, -44, -18, -13, -16, 3, 6, 7, 15, -1, 6, 21, 8, -2, 9, 5, 3, -21, 10, -8, 20, -21, 6, -1, -10, -1, -15, -10, -28, -24, -10, 6, 12, 8, 23, 13, 8, 8, 33, 12, 5, -12, 5, 12, -2, 3, -3, 9, 15, 8, -25, 1, 0, 1, 5, 8, 11, 14, 4, 2, 4, 17, 31, 23, 19, 46, 28, 30, 19, 0, 10, 6, 2, -1, 9, 9, 12, 23, -19, -5, 26, 20, -8, 22, 3, -3, 12, -6, 1, 0, 25, 47, 33, 26, 19, 6, -3, 4, -1, -7, -8, 12, -20, 7, 14, 19, 1, -6, 23, 9, 14, 2, 24, 3, 2, 6, 0, 6, 39, 38, 37, 26, 24, -8, -14, -10, -18, -17, -5, 8, -16, 15, -10, 21, 27, 1, 3, 28, 29, 36, 4, 25, 6, 2, 34, 5, 33, 34, 30, 6, -6, -11, -14, -4, -14, -18, 7, -14, -3, -8, 11, -3, 19, 19, -6, -3, 30, 2, 23, 3, 25, 28, 13, 1, 29, -4, 10, -9, 4, 2, -11, 11, -1, -11, -6, -5, 11, 0, -10, -19, -11, -2, 6, -1, 9, -4, -9, -4, 7, 11, -1, 0, -28, -10, 3, -19, -1, 6, 0, 3, -14, -1, -12, -12, -12, -16, -3, -19, 7, -16, 7, -4, -9, -27, -21, -15, -40, -8, -6, 0, -10, -11, -24, -10, 12, 7, -3, -5, 10, 10, -21, -8, -2, -21, -16, 2, -10, 9, 12, -20, -10, -6, -5, -20, -18, 10, 6, -21, 6, -3, 8, 5, -19, -19, -2, 13, 12, -16, -3, 14, 16, -10, 10, -10, 4, 2, 12, -8, 1, -14, 16, 5, -16, -1, -14, -5, -2, -14, -16, -5, 15, -13, -12, -7, -4, 11, -8, 3, 7, 5, -8, 7, 11, 2, -15, 10, -3, 8, -11, -3, 6, 15, -13, -13, 16, -13, 6, -13, 1, -13, -11, -14, -2, 8, 9, -9, 7, 10, 13, -17, 12, 11, -3, 8, 16, -6, 11, -4, 14, -4, -4, 17, 5, 10, -9, -7, 3, -4, 7, 3, 1, -11, -11, -13, 2, -11, -14, 4, 0, 0, 7, 22, -13, 9, 4, 14, 10, 7, 22, 8, 10, 13, 20, 28, -10, 9, -7, -11, -17, 13, -12, 9, 15, -14, 10, 1, -6, 3, 18, -8, -5, -14, -2, -16, -32, -42, -2, -18, -15, -15, 13, 5, 4, 0, 7, -3, 6, 11, 6, 4, 7, 10, -1, -3, 17, -10, -9, -14, -8, 5, -30, -33, -28, -40, -5, -11, 1, 21, 10, 20, 27, 32, 13, 18, 6, 8, 6, -14, -11, 2, -3, -8, -6, 13, -10, 2, 24, 15, -8, -21, -13, -33, -23, 7, 15, 22, 12, 35, 10, 31, -3, 18, -19, -7, -2, -2, 17, 3, -13, 20, 19, 4, 11, -3, 18, 25, 12, 0, 3, 4, -8, 19, 40, 48, 24, 41, 15, 4, -17, -25, -16, 10, -13, -10, 14, -14, 4, 29, 17, -25, 23, 5, 22, 51, 44, 15, -9, -5, 14, 6, 41, 46, 9, 24, 5, 23, 1, -15, -7, 9, -1, -4, 0, -14, 24, 17, -4, 7, 32, 23, 17, 18, 4, 4, -48, -61, -19, 8, 32, -4, -9, -3, 5, 18, -11, -15, -10, -13, 15, -1, -2, -11, 3, 9, -7, 8, -6, 3, -13, -10, -18, -53, -94, -57, -17, 7, 18, 2, -18, -1, -20, -24, -30, -3, -11, -9, -14, 5, 14, -5, 7, -19, -23, -40, -52, -39, -77, -79, -85, -128, -99, -12, 2, 4, 2, -10, -7, -23, -13, -12, -6, -22, -5, 2, 1, -14, -10, 14, -14, -57, -54, -47, -76, -83, -92, -89, -105, -68, -15, 1, 31, 2, -12, 5, -25, -4, -5, -16, -27, -22, 14, -14, 12, 16, 1, 15, -16, -46, -80, -60, -103, -103, -96, -73, -12, 8, 28, 19, 14, 13, -7, -7, -21, 3, -4, -3, -19, -14, 9, 17, -4, 7, -15, 7, 1, -7, -42, -59, -41, -43, -13, -3, 22, 48, 20, 25, 18, 29, 14, 12, 12, 18, 7, -3, 10, 4, 14, 16, -11, -9, 17, 8, 5, -2, 13, -12, 1, 7, 7, 32, 54, 48, 35, 29, 24, -8, 4, 22, 30, 16, 14, -2, 17, 31, 1, -1, 8, 16, -11, -1, 7, 6, 21, 30, 40, 30, 35, 35, 35, 39, 30, 31, 20, -3, 1, 15, 24, 12, 27, -6, 19, 9, -1, -9, 16, -15, 3, 10, 16, 41, 12, 32, 18, 45, 18, 13, 33, 18, 13, 17, 3, 13, 12, 24, 2, -15, 9, 1, -7, -1, 20, 14, -8, 5, 10, -2, 46, 38, 38, 17, 2, -3, -3, -11, 11, 9, 24, 1, 12, 20, -1, 9, 4, 6, -12, -7, 4, 19, 22, 12, -14, -9, 6, 1, 25, 51, 12, 21, 5, 7, -2, -5, -3, 7, 7, 10, 9, 1, -7, 9, 13, 13, 2, -18, -18, -5, -6, -12, 10, 1, -4, 0, 42, 48, 18, 26, 7, 7, 6, -29, -26, -27, 4, 16, -5, 5, 6, 6, -14, -13, -17, -13, 1, -4, 16, 17, 13, -17, -1, 1, 7, 16, 3, -10, 8, -26, -20, -12, -14, 1, -24, 6, -3, 0, 13, 15, 15, 22, -12, -28, 0, 2, 9, 7, -12, -8, -9, -14, 2, 29, 5, -2, -9, -8, -32, -16, -9, -23, -1, -6, 8, 25, 12, -3, 19, 9, 4, -10, -16, -12, 1, 2, -1, 1, -11, 0, -3, 25, 35, 14, -1, -17, 3, -16, -19, 3, -15, -2, -13, 7, 26, 16, -23, -8, -15, -3, -3, -12, -3, -1, -7, -6, -1, 6, 10, 9, 29, 21, 25, 28, 8, 2, 8, 8, 16, 21, 7, 14, -4, -51, -32, -20, -17, -7, -9, -12, 16, 3, 4, -16, -4, 0, 14, -9, 18, 18, 7, 14, 20, 19, 1, 25, 11, -11, -2, -9, -34, -18, -41, -13, -34, -12, 2, 16, 4, 10, -12, 2, -16, 6, -9, -3, 1, -16, -4, -2, -11, 0, -1, -22, -10, 0, 2, -12, -18, -13, -19, 2, -22, -5, -13, -1, 10, -11, -8, 12, 17, 2, -8, -10, -6, 7, -4, 9, -10, -12, -5, 2, -2, -10, -4, 6, 12, 1, 15, -5, -16, -16, -3, -12, 1, -4, 11, -9, -11, 19, 18, 3, -6, 3, 10, 17, -10, 3, -6, -14, -6, -2, 12, 17, -4, -6, 12, 10, -10, -12, 18, 19, 2, 20, 5, 3, 11, 18, -13, -4, -14, 17, 16, -9, -14, -14, -5, 6, 1, 11, -14, -21, 4, 2, -4, 12, -12, -13, -13, 1, 17, 10, 18, 11, 19, 7, 18, -2, 11, -11, -6, 1, -1, 6, -23, -13, -28, -9, -14, -30, 6, -11, -5, -8, -3, -17, -2, 7, 13, 11, 19, -6, -11, -4, 0, -12, -9, 2, -14, -5, 4, -16, 2, -34, -29, -39, -33, -21, -10, -11, -8, -7, 5, 3, 0, -6, 19, 2, -7, -13, -2, -8, -12, -6, 3, 2, -1, -13, -23, -32, -16, -19, -7, -26, -14, -15, -19, -19, -44, -20, 5, 6, 20, 13, -10, -3, 14, 13, -14, 5, 15, -9, -15, -17, 5, -26, -14, 0, -8, 4, -14, -21, -18, -23, -30, -30, -28, -22, 2, 7, 9, 2, -12, 16, 19, -11, -7, 7, 13, -13, -8, -11, -27, -21, 1, 6, -4, -13, -19, 1, -22, -25, -16, -25, -30, -4, -10, 0, 14, 29, -6, -7, -2, -11, 7, 4, 4, -3, -11, -9, -8, 0, -3, 1, -10, 1, -9, -2, -17, -22, -16, -6, -11, 5, 18, 15, 18, 29, 9, 24, -9, -11, -5, -3, 13, -13, 0, -3, -23, -16, -8, -7, -20, -1, -21, 3, -1, -20, -13, -7, -23, 4, 13, 10, 31, 32, 23, 9, 12, 4, 6, -15, -22, -14, -30, -35, -27, -2, 13, -8, 4, 8, 8, -2, 4, 7, 11, -4, -26, -9, -9, -7, 22, 19, 25, 9, 1, -5, 4, -3, -11, -16, -29, -35, -7, 10, 16, 12, 4, 18, 7, -25, 4, 13, 7, -1, -28, -29, -11, -5, 9, 4, 32, 20, 2, 0, 7, -5, 2, -17, -25, -12, 17, 32, 6, 19, 28, -8, -5, -33, 16, 19, 2, 4, -27, -12, -20, 8, -5, -9, 3, 14, -11, 11, 9, -16, 0, -19, -46, 9, 7, 12, 15, 35, 25, -5, -6, 16, 30, 31, 12, 8, -19, -26, -19, 6, -13, 3, -11, 4, -6, 9, -3, 3, 0, 0, 7, -2, 22, 17, 12, 39, 35, 4, 3, 27, 17, 22, 38, 4, -18, -11, 0, -9, -8, -6, -15, -5, 3, 8, -14, -16, -11, 15, 21, -4, 21, 31, 24, 14, 21, 29, 20, 16, 16, 44, 46, 2, 18, -9, -9, -20, -12, -15, -17, 5, -4, -7, 6, -4, 12, 0, -16, 12, 22, 18, 14, 5, 27, 14, 14, 20, 23, 29, 35, -2, -21, -37, -27, -27, -24, -14, -16, -18, -14, -12, -4, -8, -13, -6, -6, -24, -2, 9, 3, 19, 24, -3, 28, 7, 25, 32, 12, -12, -44, -52, -11, -26, -36, -27, -10, -11, -3, -12, -12, -13, -2, -26, -17, -36, -55, -26, -24, -24, -35, -10, -3, 23, 9, 7, 9, -21, -61, -39, -20, -38, -17, -21, -8, -8, 6, -12, 12, -8, -15, -15, -26, -22, -32, -20, -36, -38, -35, -11, 3, -3, 17, -2, -25, -41, -37, -29, -30, -34, -31, -28, -23, -8, 11, 2, 4, -7, 2, 10, -3, -41, -43, -37, -18, -18, -30, -42, -32, -3, -15, 7, -24, -15, -35, -25, -27, -26, -38, -12, 0, -10, -10, 7, 16, 13, -21, -23, -25, -25, -29, -38, -23, -18, -16, -36, -17, -1, -16, 5, -18, -8, -41, -44, -31, -22, -7, -10, 1, 19, 1, -13, -1, -4, 11, -4, 2, -2, 1, 0, 1, -7, -13, -9, -10, -31, -26, 4, -4, -10, -54, -40, -32, -12, 5, -10, 1, -13, 11, 5, 11, -6, 5, -18, 1, 5, -5, 0, 20, 17, 2, 1, -4, -12, -7, -15, -6, -3, -27, -11, -26, 5, -6, 5, -13, 13, -4, 4, 11, -1, -12, -21, -16, 4, 18, 28, -3, 31, 20, -12, -12, -3, 7, -5, 18, -6, -11, 11, -16, 16, -5, 7, 1, 18, 2, 14, 13, -3, 5, 11, 0, -4, 9, -4, 27, 23, 2, 1, -24, 12, -10, 6, 8, 16, 17, 8, 9, 17, 3, 5, -4, 20, -9, -2, 1, 4, 1, 14, 12, -15, 8, -24, 10, 11, -7, -23, 6, -4, 10, 1, -16, 3, -7, -16, -6, 22, 6, -3, -10, 18, -3, -10, 0, 16, 0, -6, 1, 14, -9, -9, -21, -4, 9, 2, -6, -23, 7, 9, -19, -23, 4, 11, 1, -9, 18, -5, -6, 1, 2, 0, -4, -7, 10, -8, 18, 5, -5, -14, 5, 12, 9, -7, -9, -3, -6, 11, -5, -6, -13, -12, 15, 2, 11, 6, -9, -14, 6, -17, 6, -2, 5, -12, 9, 14, 10, -14, -16, 4, 7, -11, -17, 16, -9, 0, 14, 4, 14, -2, -16, -4, -15, -8, -8, -6, -3, 9, -17, -12, 1, -4, -5, -7, 16, 8, 6, -1, 11, 8, -3, -4, -12, -15, -6, -15, -5, 13, 7, -2, -11, -13, -8, 16, -4, -5, 14, -13, 3, 5, -2, -5, 3, -10, 18, -9, 1, 20, 0, -3, 17, 14, -12, 13, -11, 0, 4, 1, 3, -15, 8, 9, -7, 9, 9, 1, 0, 3, -1, 13, 0, 4, -8, -3, -22, -17, -8, -2, -15, -6, 6, -24, -15, -18, -13, -10, -8, 1, 5, 9, 4, 7, 14, -3, 3, -17, 10, -15, -7, 0, -20, -4, -4, -12, 16, 11, 12, -2, 27, -6, 10, 31, -17, -9, -17, 1, -16, -17, -13, 16, 13, 10, 10, -1, -27, -15, 4, 6, -1, 4, -12, 17, -10, 20, 26, -6, 29, 7, 14, 5, 1, -3, 3, 7, -15, 10, 1, -10, 3, 0, -7, 0, -27, -21, -6, -10, -28, -15, -10, 12, -16, 20, 20, 14, 3, -5, 3, 10, 4, 5, -10, -32, -22, -1, 4, -15, -1, -11, -19, -8, -35, -10, -24, -13, -15, -23, -4, -10, 14, 1, 14, -7, -4, -1, -18, -19, 9, 15, -7, -21, -15, 4, -5, 13, 12, 11, -6, -16, -10, -1, 4, -9, 3, -9, -4, -25, -2, 2, -16, 10, 13, -14, -7, -27, -10, -11, -13, 2, -10, -21, -11, 11, -14, -4, 3, -27, 2, -14, -2, 7, -14, 10, -9, -22, 4, 2, -22, -4, -22, -18, -13, -4, -12, -41, -20, -18, -33, -17, 4, -2, 1, -13, -28, -16, -18, -7, 0, -1, 22, -9, -11, 9, -12, -4, -26, -8, -20, 11, -17, -11, -13, -19, 10, -37, -21, 2, -9, 12, 5, -10, -22, -20, 12, -6, 13, 24, -1, 11, 12, -6, -29, -8, -25, 5, -3, 3, 3, 1, -10, 7, 8, -4, -23, -14, 7, 1, 12, 5, -23, -19, 8, 5, -1, 17, 6, 17, -8, 0, -7, -30, -6, -5, 8, 10, 24, 4, 18, -2, 31, 45, 5, -10, -18, -1, -12, 6, -16, -10, -4, 11, 6, 26, 26, 29, 29, 13, 11, -2, 33, 2, 2, 6, -4, 17, -2, 20, 27, 14, 11, -20, 5, 13, 4, 5, -17, 2, 24, 12, 15, 10, 31, 18, 19, 37, 18, 2, 0, 20, 19, 11, 8, -9, 5, -7, 4, -17, -16, -10, -14, 13, -15, 1, 12, -17, -11, 0, 26, 22, 2, 28, 42, 37, 23, 24, 10, 28, 11, 7, -12, -8, -11, -24, -14, 3, 12, -12, 8, 0, 5, -20, 0, -18, 10, -10, 14, 24, 31, 33, 41, 17, 16, 9, 24, 17, 2, -7, -32, -28, -26, 0, -5, -26, -12, -15, -7, -13, 12, -16, -24, -36, -20, -12, 11, -4, 26, 19, 31, 26, 20, 14, 19, 15, 4, -3, -7, 1, 0, -17, -22, -6, 0, 6, -17, 10, 12, 8, -26, -28, -29, -20, -2, 10, 25, 25, 25, 19, 31, 9, 5, -15, -8, -23, -15, 3, -26, -41, -29, -10, 9, -11, 4, 3, 1, 2, -24, -16, -38, -19, -5, 12, 29, 25, 21, 25, 9, -16, -2, -4, 1, -18, 5, -14, -2, -8, -9, -8, -18, -14, -14, -6, -17, -9, -26, -23, -25, -9, -20, -22, 0, 22, 25, 18, -6, 0, 10, -18, -15, 7, 2, 10, 6, -10, -21, -10, 6, -8, 5, 13, -5, -13, -6, -31, -4, -4, -22, 6, 10, 8, 16, 12, 3, -9, 14, -8, 12, -16, 8, -4, 9, 5, 10, 9, -19, 11, -8, 8, -13, 6, -2, 1, -20, -17, 8, 6, 8, -2, 18, 0, -5, 14, -20, -5, -5, 1, -4, -20, 15, 11, 5, 5, -15, 13, 5, 13, -13, 4, -20, -31, -28, -10, -5, -8, -2, -6, 5, -10, -13, 8, -1, -8, 17, 14, 3, 28, 23, 32, 19, 7, -20, -16, -9, -7, 4, 1, 0, -19, -30, -20, -30, -18, -12, -11, -32, -33, -35, -18, -13, 2, -14, 4, 9, 17, 11, 19, -1, -15, -8, 11, 2, 0, 10, 4, -13, -17, -30, -2, -27, -22, -10, -22, -8, -22, -22, -2, -1, -34, -20, -17, -3, 15, 0, -9, -6, 11, -3, 12, -10, -15, 14, 15, -12, 2, 8, 18, 14, -12, -18, -8, -27, 0, -12, -8, -7, -7, 4, -22, -13, -12, -2, -1, 4, -7, 12, -12, -7, -16, 13, -17, 16, -9, 11, -11, -1, -15, 2, -1, -17, -2, 1, -12, 1, -15, 9, 5, -1, 0, 10, 5, 2, 8, 14, -11, 3, 4, -4, 21, -2, 2, -11, -5, 9, 19, -6, 9, 9, -8, -6, 17, 21, -4, -4, -11, -2, -9, 18, 6, 11, 18, 13, -10, 7, -5, 21, -9, 19, 15, 12, 20, 16, -4, 16, -1, 7, -7, 19, 3, 7, -4, 14, -2, 22, -11, -7, 5, -9, 18, -6, 3, 9, -10, -7, 22, -1, -4, -6, 9, -5, -6, 3, 17, 5, 13, 29, 12, 19, 17, 27, 4, 17, 7, 5, 20, -5, -7, 13, 9, -2, -5, -7, 18, -2, 11, 21, -8, 19, 14, 8, 11, 17, -14, -2, -9, 10, -2, -9, 3, -11, 2, 9, -6, 14, 2, -7, 1, 19, -9, -2, -2, -1, -6, 13, 9, 6, 6, -1, 15, -13, 5, -1, -1, -20, -11, 14, -18, -4, 5, -13, -8, -12, -23, 2, 10, 8, 15, 11, -6, -6, -2, 16, 13, -1, -2, -15, -24, -21, -12, -19, 14, 11, -13, 5, 2, -1, 3, 3, 19, 14, -16, -21, -10, 13, -9, -11, -3, -10, 9, 8, -16, -14, -49, -37, -46, -10, -43, -3, -12, -17, -10, -21, -7, -4, -19, -11, 9, -8, -12, 3, -7, -5, 21, 18, -11, 1, 9, -1, -27, -24, -43, -30, -32, 3, -10, -28, -4, -4, -10, -17, -18, -21, -19, 0, -3, -1, -1, -24, -10, -6, -10, 15, -10, -3, 7, -19, -14, -1, -18, -16, -22, -8, -27, 4, 11, -10, -24, 1, -6, -7, -7, -14, -23, -35, -19, -5, -15, -13, -11, -7, -11, -2, -13, -4, -12, -23, -30, -39, -35, -7, -17, -9, 17, 22, -9, -12, -21, -2, -8, -23, -45, -27, -32, -31, -8, 4, 1, -6, -14, 10, -7, 5, -18, -22, -31, -38, -9, -17, -8, 9, 32, 19, 7, 6, -9, -11, -16, -7, -31, -45, -31, -38, -9, 7, 8, 15, -18, 2, -33, -1, -11, -25, -17, -47, -20, -39, 15, 1, 4, 13, -6, -4, -24, -21, -10, -4, -30, -11, -30, -28, -11, 18, 12, 2, -11, -6, -30, -19, -5, -25, -16, -21, 10, 14, 36, 29, 13, -15, 3, -20, -3, -27, -9, -5, 22, 6, -1, -23, -3, 3, -10, 1, 6, 2, -4, -26, -15, -1, -17, 40, 34, 18, 53, 11, 3, -13, -5, 0, -9, -18, -30, -6, 6, 13, 13, 8, 4, -7, -11, 16, -6, 17, -2, 10, -2, 3, 33, 41, 17, 29, 27, 19, 9, -6, -6, -21, -17, -23, 1, -18, 14, 28, 19, 27, 19, 5, 11, 0, -1, 19, -13, -2, 9, 12, 26, 39, 37, 45, 20, 19, 2, 7, -11, -21, -2, 4, -17, -4, -1, 6, 39, 16, 15, 1, 22, 12, 0, 1, -14, -6, 10, 3, 4, 19, 40, 35, 20, 25, 29, 7, -8, -3, 0, -4, 18, 26, 5, 2, 36, 36, 22, 8, 10, 10, -6, -8, -8, -14, 9, -8, 21, 13, 45, 28, 27, 17, 30, 5, 13, 12, 23, 2, 21, 33, 10, 16, 25, 12, 7, 4, 0, -4, -1, 12, 19, -20, -30, -10, 11, 12, 32, 29, 31, 33, 17, 23, 26, 24, 34, -3, -6, 16, 8, 24, 26, 26, 11, 12, 8, -2, -10, -5, 26, 6, -32, -11, 18, 19, 11, 32, 17, 17, 15, 36, 31, -2, 27, 23, -1, -6, 15, 24, 26, 17, -9, 20, -10, -1, -10, -4, 3, -11, 0, 2, -16, 18, 19, 6, 29, -6, 17, 14, 15, -6, 31, 19, 15, -3, 7, -6, -5, 19, 5, 18, -7, -8, 11, -5, 6, 6, -6, -6, -10, -5, -6, -10, 2, -21, 8, -21, -25, -2, 11, 21, -10, 7, -12, -4, 2, -9, -10, 8, 18, -11, -9, 13, -13, 3, -18, -22, -37, -9, -40, -28, -32, -23, -25, -29, -26, -9, 3, 4, -1, 5, -19, -25, -9, -6, -7, 17, 21, -9, -7, 14, 8, 14, 2, -25, -19, -6, -27, -30, -23, -6, -24, -29, -12, -16, 21, -6, 10, 10, -8, 7, 5, 7, -1, -3, 0, -12, 5, 15, 11, -21, -15, -24, -25, -23, -7, -38, -11, -27, -10, -28, -13, -26, -9, -5, -18, -11, -16, 4, 9, 4, 11, 7, 3, 17, 7, 3, -3, 12, -26, -3, -18, -35, -41, -9, -28, -24, -21, -13, -13, -15, -34, -40, -11, 5, -16, 14, -9, 17, 12, 22, -8, 6, 1, -1, 10, 8, 15, 1, 6, -10, -18, -6, -23, -14, -6, -25, -8, -7, 2, -15, -17, -10, -1, 16, 2, 10, 0, 0, 9, 4, 7, -6, 17, 13, 1, -13, -5, 12, -4, -1, 19, -6, 7, 4, -13, 9, 13, 8, 6, -12, 15, 12, -1, 17, 12, 16, -12, 9, -5, -14, -1, 14, 12, -8, -3, 8, 4, 14, 16, -4, -8, -17, -10, -15, 10, 13, -9, 7, -14, 12, -17, -17, -2, 5, 9, 3, 4, -15, -17, -10, 12, -1, -12, -2, 4, 18, 7, -4, 8, -12, -15, 4, 13, -3, 7, -11, -10, -10, 4, 3, -15, 7, 7, -7, 10, -6, -6, 3, -8, 20, 1, 20, 23, 24, 18, -4, 9, 24, 18, 19, -2, -7, 9, -3, 3, 10, -5, -4, -11, 11, 7, -5, -15, -18, 12, -16, -10, 2, -5, 13, 24, 4, 31, 14, 21, -10, 3, -16, 17, 5, 1, 17, 5, -10, 15, 15, 10, -5, -16, 11, 3, -3, 8, 0, -15, 11, 15, 37, 6, 1, -2, -16, 1, 6, 0, 16, 8, 9, 17, -9, -12, -19, 9, 2, 11, 13, 13, 2, 3, 12, -10, -17, -6, 8, 22, 29, 21, -8, 3, 4, -2, -19, 3, 6, -20, 4, 4, 2, -17, 5, -18, 9, 12, 4, 2, 10, 11, 8, 13, 16, 29, 17, 31, 2, -3, 3, 4, 9, 0, 1, 14, -5, -10, 0, -22, 12, -3, -14, -3, -5, 2, -3, 15, 16, -13, -7, 1, 8, 15, 30, 21, 16, 15, 21, -5, 7, -7, -7, -7, -4, -7, 12, -20, 0, -10, 11, -3, 15, 5, -12, 15, 0, 15, 15, 30, 30, 17, 22, 4, 4, 30, 13, -2, 8, 9, 11, 16, -9, -10, 0, 6, -3, 8, 12, 8, -9, 2, 15, -6, 4, -3, 6, 27, 26, 5, 5, 9, 2, -6, 8, -1, 22, 20, 4, -12, -12, -13, 6, -3, 9, 9, 16, -4, -8, 19, -3, -8, 15, 12, 5, 27, 12, 27, 8, 47, 14, 26, 1, -8, 10, -6, -3, -10, -2, -14, 18, 6, -18, 4, 22, 23, -16, -4, 16, 8, -11, 12, -21, 17, -1, 2, 53, 30, -1, 9, -7, -46, -39, -34, -23, 3, 5, -19, 1, -11, 10, 10, 12, 8, 9, 17, 3, -9, -8, 12, -4, -12, -13, -7, 3, -13, -4, -39, -50, -52, -49, -21, -9, -24, -21, 1, -19, -13, -14, -20, -2, 17, 31, -15, 1, -6, -14, -12, 7, -26, -37, -41, -38, -31, -15, -43, -28, -40, -19, -24, -2, -19, -12, -20, -30, -15, -19, -5, 8, 30, 22, -2, -7, 14, 14, 9, -3, -24, -47, -37, -40, -58, -53, -33, -31, -20, -10, -7, -10, -10, -30, -3, -23, -20, 4, 24, 3, 14, 27, 6, -7, 9, -14, -4, 7, -35, -20, -49, -32, -50, -48, -41, -28, 24, 29, 33, -2, -7, -20, -15, -1, -5, -11, -4, 24, 6, 18, -6, 8, -16, -10, 0, -8, -23, -36, -35, -57, -58, -42, 0, 16, 26, 30, 23, 18, -3, 6, -2, -2, 4, -2, -25, -6, 24, 9, -4, -5, -9, 10, 9, -4, -18, -31, -39, -33, -39, -11, 10, 28, 34, 45, 9, -2, 17, 3, 21, -4, -15, -11, -4, -15, 3, 27, 23, 10, -11, -12, 12, -15, -25, -30, -37, -21, -13, 19, 14, 20, 36, 41, 4, 9, 15, 13, 8, -5, -22, -10, -17, -9, -8, 14, -6, -16, 2, 16, -19, -24, -23, -28, -18, 4, 8, 20, 29, 39, 20, 13, 36, 13, 25, 3, 12, -13, -6, -15, -8, -17, 0, -9, -4, -12, -18, -15, -2, -7, -23, -33, -9, -5, 6, 19, 25, 33, 29, 32, 25, 35, 11, 1, -2, -6, -15, -5, -11, -6, -5, -2, 7, 7, -5, 14, 12, -13, -22, -17, -21, -2, 0, 26, 22, 12, 8, 27, 14, 22, 3, 17, 24, 9, 4, 4, 9, 10, 9, 4, -14, 1, 7, -17, -6, -11, -5, -16, -13, 22, 3, -8, 8, 9, 23, 19, 19, 5, -6, -10, 2, 14, -14, 20, -12, -12, 1, -14, -7, -5, -4, 12, -7, 8, -5, 5, -15, -11, -9, 1, -7, 10, 12, 2, -2, 12, 24, 5, 10, 11, 23, 19, 3, -6, -14, -13, 1, 5, -16, -9, -18, -17, -10, -14, -30, 0, -9, 16, -13, -12, 19, 9, 35, 30, 28, 4, 20, 3, 1, 11, -23, 3, -11, 7, 4, 5, 3, 16, 3, -2, -20, -11, -7, 3, -6, 7, -14, 16, 15, -10, -5, 27, 7, -10, 9, -11, 2, 1, 1, -8, -15, 8, -16, -4, 1, 14, -10, 3, -10, -21, 3, 1, -6, -10, -19, -13, 4, 3, 7, 9, -3, -16, 5, -9, -4, -22, 6, 5, 15, -3, 13, 5, -16, -5, -9, -2, 9, -14, -7, 6, 0, -14, -5, -10, -10, 4, 12, 10, 20, 18, 5, 14, 7, 14, -19, 0, 11, -18, 9, 13, -4, -5, 6, -9, 11, -9, 18, 11, -11, 14, 16, 13, 14, 11, 13, -9, -7, -10, 7, 7, 3, 0, 1, 13, -5, 18, -3, 6, -9, 21, -10, 14, 4, -9, 19, 1, 18, 13, -7, -8, -3, -9, 0, 8, -8, 0, 4, -11, -10, 15, -3, 1, -8, 20, 2, -5, 3, 6, 8, 23, -5, 15, -7, 14, 2, 6, 15, 16, 15, 12, 6, 14, 3, -10, 16, 18, -14, 6, 0, 0, 15, -1, 17, 15, 19, 2, 12, -6, 11, -8, 9, -2, -5, 5, -23, -18, -20, -17, -3, -19, -1, -15, -37, -10, 0, -22, -4, 18, 17, 7, 2, 18, 14, 18, 8, -8, 22, 21, 0, 16, 6, -10, -16, -12, -9, 1, 8, -5, -11, -27, -26, 3, -30, -20, -20, -23, -22, -1, -11, 22, 13, -1, 15, 3, 18, 8, 24, 9, -1, -5, 6, -23, -4, 11, 10, 17, -8, -24, -13, -35, -37, -33, -13, -10, -20, -14, 20, 3, -3, -11, 13, -1, -3, 7, 13, 14, -16, 9, 14, 23, 4, 8, 18, 0, 5, 18, -12, -38, -42, -19, -36, -39, -29, 6, 15, 12, -4, -4, 10, 26, 22, -18, 14, -7, 5, 27, 7, 20, 10, -4, 3, -10, -2, 13, 7, -28, -36, -62, -55, -26, -40, -26, 15, 16, 3, -2, 24, 13, 7, -9, -2, 26, 2, -4, 1, 9, 4, 21, 40, 33, 24, 27, 6, -42, -56, -54, -57, -33, -18, -17, 0, 11, 20, -6, 6, 23, -5, 23, 13, 5, -7, -6, -4, 2, 4, 13, 32, 61, 39, 32, -20, -35, -59, -56, -45, -30, -14, -1, -10, 9, 15, 2, -1, 14, 4, 3, -19, 9, -31, -20, -9, -13, -15, 27, 21, 61, 57, 10, -43, -74, -81, -40, -16, -42, -34, -1, 3, 21, 7, 8, 21, 5, -18, -3, -5, -20, -13, -13, -12, -12, -3, 16, 24, 42, 23, 8, -35, -58, -52, -47, -27, -19, -10, -18, -10, 14, -11, 23, 0, 5, -14, -18, -23, -14, -16, -13, -14, -24, 1, 6, 32, 21, 22, -2, -49, -76, -49, -22, -6, -4, 14, 20, -6, 24, 16, 21, 17, 5, -5, -6, -9, -15, -24, -8, -28, -15, -13, 5, 40, 40, 30, -10, -33, -53, 9, 22, 2, 1, 19, 21, 24, -4, 13, -11, 6, -1, -8, 9, -35, -25, -17, -6, -5, -1, -17, 17, 13, 37, 12, 8, -32, 1, 3, 19, 29, 36, 7, 5, -4, 9, -10, 1, 8, 6, -1, -6, -16, 9, 16, -2, -4, -5, -10, 14, 46, 16, 11, -28, -32, 4, 0, 9, 30, -1, 14, 13, 4, 14, 13, 5, 21, -9, 0, 7, 7, 17, -8, 5, -13, -13, 2, 36, 41, 32, 2, -40, -20, 9, 10, 20, 9, -11, 5, -2, 24, 3, 19, 18, -5, 18, 14, 2, -11, -12, -26, -15, -28, -5, 7, 13, 47, 35, -1, -30, -10, -16, -1, 3, -3, 14, 28, 4, 11, 5, -7, 22, 18, 1, -15, -14, -39, -36, -30, -26, -38, -6, 3, 30, 37, 20, -8, -19, 0, 0, 6, -1, 26, 11, -6, 21, -1, -9, -6, -8, 11, 2, -20, -37, -25, -35, -23, -32, -43, -24, -7, 23, 14, 15, -4, -24, -11, 18, 8, 11, -3, -3, -5, 19, 14, -6, 13, 12, 12, -11, 2, -35, -28, -12, -22, -42, -37, -31, 5, 4, 36, 1, 3, 12, -4, 1, -5, 8, -9, 0, 9, 14, -4, 22, 4, 23, 18, 11, -9, 4, -11, -5, -7, -33, -24, -43, -9, 8, 12, 18, 20, 7, 12, 7, -10, 7, 8, -10, -6, 20, 2, 17, 11, -4, -11, -4, -5, 33, 16, -9, -18, -1, -16, -46, -31, 3, 29, 10, -16, 4, 20, 22, 26, 4, -13, 3, 17, 15, 1, 9, 21, 4, -4, 19, 5, 6, 8, 7, -13, -13, -23, 0, 23, 31, 3, -5, 14, 23, 6, 8, -1, 6, -24, 10, 3, 19, 23, 8, 16, -8, -11, -4, -3, -2, 25, -11, -6, -31, -16, -11, 12, 7, 10, -8, -16, -6, 0, -12, 8, 13, -17, -4, -9, -6, 16, 16, 20, 5, 19, -10, 15, -10, 19, 13, -12, -14, -42, -32, -18, 5, -1, -36, -30, -14, -15, -28, 8, -20, 8, 4, 19, -7, 21, -4, 14, 5, 16, 21, 9, 0, 2, 7, 15, -8, -10, 10, -7, -24, 3, -13, -21, -6, 17, 0, 8, 12, 18, 3, -11, 4, 6, -5, 21, -2, -4, 17, 10, 20, 22, 6, 17, -11, 7, 21, 8, -3, 16, 6, 18, 19, 2, -3, 15, 18, 9, 2, 22, -1, 7, 1, -16, -14, -4, -15, -4, -8, 4, -3, -10, 8, 0, 15, 7, -3, -11, 9, -1, 10, -2, -9, -6, -11, 13, -19, 7, 9, -4, 8, -1, 0, -11, -4, -11, 9, 0, -6, -7, 12, 5, -11, -15, 6, -7, -7, -13, -8, -9, -10, -7, -1, -18, 5, 4, -20, -14, -20, -2, 5, -1, -3, -4, 14, 0, -12, -17, 6, -7, 13, 3, 4, -11, 16, 2, -10, 11, 22, 10, 5, 3, -1, -5, 10, 10, -8, 3, -3, -1, -14, -18, -1, 8, 12, 0, -5, -2, -7, -19, -16, -20, -23, 0, -14, 9, -21, -16, 11, 2, 17, 13, -11, 12, -20, -11, -19, -8, 9, -4, -1, -11, 5, -11, -13, -20, -14, -10, 22, -2, -9, -4, -29, -25, 4, 2, 22, 28, -4, 9, -6, -1, 6, -12, -2, -17, 12, 3, 22, 12, 1, 15, 13, -3, 2, 25, 11, 18, 26, 3, -11, -23, 9, 2, 2, -8, -1, 3, 12, 2, 5, 6, -6, -18, 0, 8, 14, -13, -5, 2, 27, -11, 13, 4, 12, -2, 13, -4, 3, -11, -10, -2, 15, -9, 21, 15, 3, -13, 7, 11, -17, -15, 12, 3, 1, -18, -12, -6, 15, -7, -2, -2, 6, 13, -12, -13, 0, -11, -5, 10, 20, 1, -3, -6, 8, -12, -14, 2, 8, 0, 11, -3, 3, -8, 4, -3, 20, -30, -10, 3, 0, -23, -17, -16, 3, 3, 7, -10, 8, -13, -20, 0, -18, -12, -9, -1, -19, 10, 7, 11, -17, 12, 21, 23, -4, -29, -12, 0, 9, -19, 1, -23, -15, 0, 26, 12, 15, -15, -34, -27, -13, 0, 4, 4, 9, -14, -2, 18, -15, -10, -6, -14, -16, 5, 7, 1, -13, 3, -6, 3, 5, 6, 19, 14, -16, -20, -23, -43, -23, -16, -3, 13, -4, -20, -14, 0, -3, -20, 10, 18, 30, 26, 26, 32, 11, -6, 32, 31, 20, 30, -1, 7, -9, 14, 0, -26, -23, -8, -6, 2, -19, -7, 3, -3, 6, 11, 11, 32, 26, 15, 39, 23, 5, -3, 53, 58, 31, 1, 2, -1, -4, 22, 18, 11, -2, -23, 6, -8, 4, -14, 9, -1, 0, 18, -10, 15, 10, 34, -2, -16, -7, 5, 33, 51, 35, 1, 21, -1, 27, 34, 26, -30, -7, 1, -5, 1, 0, -18, -9, 11, 13, 11, 4, 8, 16, -4, 14, 6, 6, 26, 22, 45, 38, 28, 16, 21, -2, -4, -22, -23, -25, -20, -4, 6, -3, -15, -9, -19, -4, 1, -1, 23, 14, 6, 20, 0, 12, 31, 10, 33, 11, 21, 17, 19, 6, 19, -14, -29, -12, -15, 4, 5, -19, -12, 0, -10, -24, 15, 23, 27, -2, -12, 20, 6, 9, 33, 22, 21, 22, 2, 2, 15, -25, -3, -11, -36, -17, -7, 4, -12, -18, -2, -29, -17, -17, -21, 27, 13, 18, -1, 14, 23, 22, 13, 1, -11, 3, -1, 4, 3, -9, -18, -34, -17, -11, 0, -2, 1, -10, -8, -20, -26, -22, 7, -2, 6, 9, -14, -8, 24, 42, 16, -12, -16, 17, 19, 9, 2, 8, -38, -30, -19, -4, -19, 5, -13, -16, 1, -16, -25, -3, -2, -10, -17, -11, -20, -1, -8, 0, -1, 3, -10, -7, -7, 20, -15, -26, -26, -30, -19, -23, -6, -19, 10, 14, -12, -31, -47, -18, 1, 2, 5, 0, -8, -18, -10, -10, -5, -9, -7, 8, 14, 2, 12, -16, -12, -33, -41, -4, 3, 15, 4, -16, -17, -23, -29, -38, 1, -15, 21, 21, 20, 5, -5, 14, 4, -2, 15, 3, 17, 8, 12, 3, -27, -44, -18, -26, -6, 8, 6, 0, -18, -11, -18, -9, -29, 9, -16, 22, -4, -1, 15, -11, -3, 21, 16, -8, 17, 0, 3, 6, -8, -25, -26, -5, -1, 5, -14, 4, -13, -20, 8, -8, 3, 18, -5, -10, -18, 2, -2, -18, 4, 8, -3, 21, 18, 28, -5, 12, -2, -14, -13, 2, -13, -3, -9, -3, 10, 8, 16, 0, 2, 6, 11, -11, -1, -9, -24, -28, -13, -26, 8, -19, -10, 9, -7, 15, -17, -1, -2, -8, -6, 10, 12, -7, -7, -16, 0, 11, 9, 2, 0, 27, 30, 11, -4, 10, 12, -18, -16, -1, 10, -20, 1, 10, -8, -8, -6, -19, -6, -20, 9, 9, 2, 5, 0, 0, 17, 0, 12, 5, -7, -6, 3, -5, -10, -15, -16, -7, -10, -12, -5, -5, -9, -8, 14, -4, -12, -5, 12, -13, -11, -20, 8, -10, 12, 4, -15, -2, 6, -11, -17, -1, 11, 0, 12, 15, -5, 15, 7, 12, 14, -1, 0, 2, -4, -5, 0, 2, 6, 12, -3, 7, -2, -6, 5, -3, -5, 6, 11, 1, 6, 8, -6, 12, 11, 22, -1, -11, 2, -4, -3, 7, 4, 10, 17, -1, 3, -2, 16, 9, 7, -1, 12, 5, 15, 4, 21, 6, 0, 8, -12, -7, 19, 16, 6, 14, 2, 4, -10, 22, 22, 12, -1, 18, 15, 4, 14, 12, 10, 3, 21, -10, 0, 14, -8, -7, 1, 7, -5, -13, 9, 5, 0, 6, 17, 15, 20, -3, 11, -8, 6, 4, 0, -2, -3, 3, 1, 10, 17, -3, 14, 14, -6, 13, -3, -9, 7, 1, 5, -23, 0, -2, 9, 6, 19, 16, 14, -6, 9, 12, 8, -2, 9, -6, -11, 19, 9, 6, -11, -14, 16, 2, -13, -23, -3, -22, 10, -14, -9, -9, 15, 16, 16, 22, -8, -5, 14, 2, 9, 20, -11, -3, 16, 19, 12, 10, 7, -3, -9, 5, -20, -4, -19, -12, -8, -11, -11, 13, -7, 15, -1, 12, -11, 15, -3, 4, -4, 21, -6, -2, 13, 14, 10, -13, 7, 4, -14, -5, 2, 13, -4, -10, 13, 12, -2, 21, 17, -8, 15, -3, 21, -3, 8, -3, 21, 19, -1, -12, -9, 14, 9, 0, 4, -19, -11, 12, -16, 3, -16, 18, -12, -10, -7, 9, 14, -6, 14, 9, -12, -1, 18, -1, 16, 9, -10, -3, -9, 1, -3, -6, -5, 11, -11, 5, -5, 1, -11, 15, -11, 0, 12, 1, 9, 15, -6, 12, -10, -9, 3, 16, 3, 18, -7, 4, -9, -2, 6, -13, -11, -5, 8, 2, 17, 19, 13, 22, 1, -9, 7, -11, 16, -3, 2, 12, 16, -8, -7, 9, -6, 8, 14, 11, 7, 13, -3, 0, -13, 5, 8, -8, -16, -1, -3, 19, -11, 10, 10, 9, 12, 16, 18, 3, 8, 5, -6, 20, 9, -3, 18, -11, 11, -2, 3, -7, 12, 10, -2, -21, 11, -5, 15, -10, -2, -7, -10, -5, -2, -8, 18, 5, 4, 4, -1, -6, -12, -1, 20, 2, -10, -12, 8, -17, -17, 10, -10, -5, 10, 9, 5, 4, -9, 2, 9, 0, 8, -5, -7, -3, -6, 9, 1, 10, 15, 13, 20, -13, -2, -7, -19, -14, -3, 5, 4, -14, -5, -18, -8, 5, -10, 1, 8, -20, -20, -3, 7, -9, -12, 5, 5, -11, 5, 6, 10, -2, 2, -21, -16, 0, 2, -14, 2, -2, 3, 4, -3, 12, 0, -12, -7, 3, -9, 0, -14, 21, -4, 21, 5, 10, -7, 14, 20, 16, -6, -20, -14, -11, 1, -14, 0, -8, 0, -3, -22, 8, 5, -4, -22, 7, 3, 10, 13, 1, 14, 11, -1, 1, 9, -11, -4, -14, 7, 11, 0, -4, 0, -10, 5, -6, 4, -21, 4, -8, 1, 1, -2, 6, 7, -16, 5, 13, 15, 10, 5, 0, -9, 1, 20, -14, 0, 1, -2, -7, -8, 11, 9, -12, 1, 0, -17, -13, -4, -4, 4, -5, 8, 1, 18, 22, -5, -3, -3, 1, 15, -5, 8, 7, 6, 7, -7, 11, 2, -21, 11, 2, -2, 6, 0, 12, -9, 4, -6, -15, 12, 17, 6, -2, 4, 17, 15, 16, -7, -7, -11, 14, 19, 12, 8, -11, 11, 6, -12, -19, 7, 7, 7, -4, 10, -12, 8, -4, 10, 1, 13, 8, -1, -5, -9, -12, 19, 5, 0, 15, -10, 10, 3, 14, -12, -18, -7, 0, 0, -7, -11, -16, -12, -2, 14, 3, -11, -3, -3, -1, -1, 14, 11, 4, 13, 0, -9, -4, -6, 18, -3, 16, -8, 8, -9, 11, 12, 11, 5, -17, 10, 16, -9, 17, 10, 11, 23, -10, -10, 13, 2, -6, 18, 6, 18, 18, 5, -9, 20, 2, -10, 1, -10, -3, 5, 14, -5, -10, -5, 5, 9, -5, 22, 16, 8, -8, 14, 19, -12, -4, 7, -9, -5, -1, 19, -8, 8, 5, 13, -5, -10, 5, 2, 6, -6, -4, 12, 7, 21, 20, 4, -10, 22, 11, 16, 4, 19, 20, -6, 12, -9, 13, 11, 5, -6, 1, 4, -5, -9, 6, -7, 14, -6, -3, 3, -11, -9, 3, 2, 12, 10, 4, 15, -5, 22, -5, -9, 20, 21, -5, 1, 12, -5, 11, -5, -8, 4, 16, -1, 6, 7, -3, 19, -8, -12, 9, 16, -7, -6, -1, 19, -4, 9, 0, 3, -7, 11, 4, 20, 1, 7, 12, 5, 0, -5, 8, -7, 7, -8, 5, 16, 17, 5, 0, 7, -7, 13, -5, 3, -9, 6, 16, 12, 15, 21, 22, 17, -4, 13, -1, 10, -5, 20, -9, -4, -11, 15, 6, 20, -7, -8, 21, 10, -10, 0, 16, 14, 14, -1, -11, -3, 9, 7, -16, -21, -8, -22, 5, 2, -11, -13, -2, -13, -17, -11, 12, -20, -5, 8, -13, -22, 5, -4, -6, 7, -9, -21, -21, -4, -9, -11, -4, -22, 1, -13, -19, 11, 7, 11, -16, -6, 2, -7, 12, 7, -8, 11, 9, -14, -2, -9, -20, 11, -8, -16, -11, -19, 1, 1, -6, -2, -8, -19, 0, -11, -13, -18, -13, 6, 8, 5, 9, 1, -2, -21, 9, -12, -13, 10, 8, -9, -6, -1, 7, -10, 10, -4, -5, 11, -10, -3, 9, 9, 13, -1, -5, -1, 6, 5, -10, 3, -8, 13, -20, 1, -4, 10, -5, 3, -15, -10, 2, -5, 3, -2, -9, -8, -6, 22, 49, 64, 46, 41, 39, 6, 27, 18, 12, 7, 2, 4, 23, -6, 7, -18, -5, -10, -4, -8, -11, -14, 8, 0, -14, -1, 27, 68, 61, 44, 40, -11, -10, -15, -23, -14, -9, -24, -5, -15, -9, -17, -17, -10, -23, -15, 0, 6, 4, 8, -1, -17, 5, 5, 32, 31, 43, 8, -20, -29, -57, -41, -14, 9, -3, 3, 4, -1, -17, -20, 4, 9, 3, -10, -18, 0, -2, -11, -14, -7, 25, 21, 21, 51, 23, 25, -33, -50, -53, -28, -15, -8, 26, 23, 13, -4, 37, 18, 6, -7, -1, -18, -16, 4, -15, 9, -8, 29, 43, 44, 27, 48, 52, 23, -20, -71, -41, -41, 6, 18, 23, 19, -4, 4, 7, 3, 22, -4, -2, -8, 8, 7, 3, -3, 10, 40, 21, 43, 35, 64, 60, 46, -28, -60, -78, -37, -16, 13, 13, 2, -10, 33, 15, 11, 3, 7, 9, 0, 2, -20, -2, -15, -15, 16, 38, 12, 47, 60, 99, 46, -49, -86, -100, -25, 7, 0, -2, -4, -1, 5, 28, 6, 5, 43, 15, -1, -10, 8, 10, 16, 8, -8, 25, 9, 45, 85, 109, 48, -53, -94, -73, -5, 12, -3, -8, 12, -18, 6, 20, 15, 35, 26, 11, 7, -4, -21, -18, -1, -6, -6, 39, 26, 42, 64, 84, -11, -69, -105, -47, -23, -6, 25, -3, 8, -3, -7, -1, 1, 6, 16, 16, -20, -12, -17, 1, 14, -6, 13, 32, 35, 33, 42, 55, -10, -62, -79, -24, -29, -3, 3, 1, 10, -10, -23, -1, 7, 34, 20, 8, 4, -22, 3, -13, -4, -8, -6, 28, 34, 38, 33, 44, -11, -27, -36, -14, -21, -11, -18, 15, -6, -16, -35, -29, 9, 38, 20, 13, -9, -16, 2, -20, -15, -13, 6, 15, 18, 31, 17, 35, 9, 31, -21, -16, -33, -36, -17, -6, -2, -12, -14, -18, 22, 25, 16, 13, 12, 3, -2, -2, 7, -10, -25, -5, 29, 39, 29, 33, 13, 5, -34, -13, -46, -27, 10, -11, -14, 5, 19, 7, 49, 61, 23, 38, -17, -24, -14, -18, 9, -13, -9, 23, -2, 13, 21, 9, 9, -31, -53, -36, -17, -14, 18, 19, -7, -3, 22, 34, 34, 53, 39, -14, 9, -2, 5, -1, 12, -30, -2, -8, 4, 1, 17, 3, -11, -33, -25, -15, -18, -17, 6, 11, 13, -4, 45, 37, 47, 3, 23, -21, -5, 9, 6, -12, -7, -14, -3, -19, 27, -8, 32, 9, -10, -8, -35, -21, 0, -2, -3, 20, -1, -12, 19, 51, 15, 20, 23, 1, 8, -9, -1, 5, -12, -10, -8, -7, -22, 13, -9, 14, 9, -31, -23, -11, 12, 22, 7, 37, 17, 15, 35, 30, 18, 6, -36, -3, 7, 7, -7, -16, -1, 1, -10, -18, -13, -17, 0, 20, 14, -3, -17, -1, 2, 22, 39, 35, 19, 30, 46, 27, 21, -3, -9, 7, -18, 7, -16, -12, -13, -3, -5, -16, -19, -9, -15, -2, -25, -34, -36, -34, 7, 22, 43, 52, 47, 38, 40, 26, -8, -13, -9, -7, -17, -22, 6, -22, -10, 0, 0, -17, -22, -24, -13, -23, -31, -43, -43, -36, -11, 34, 48, 30, 34, 33, 20, -4, -27, -41, -38, 5, 13, -6, 7, -11, -18, 12, 10, -12, -18, -2, -13, -6, -17, -14, -23, -33, 3, 15, 25, 26, 11, 27, 14, -11, -19, -37, -22, -1, 0, -14, -17, -3, -17, 3, -17, -16, 8, 8, -14, 2, -30, -18, -14, -1, -10, 12, 25, 20, 3, -26, -15, -7, -19, -4, 0, 7, -21, 7, -18, -5, -19, -4, -20, -13, -1, -3, 6, -17, -20, -16, -8, -16, -2, -25, -25, 3, -27, -4, -28, -6, -14, -20, -7, -13, -6, -19, -20, 10, -4, 10, -16, -1, 2, 2, -18, -12, 6, -11, 12, -13, 9, -19, 4, -15, -10, -6, -12, -19, 9, -18, 2, -21, -19, -9, 0, -25, -23, -4, -26, -1, -25, 3, -24, -16, 3, -22, -20, -12, -23, 6, 0, -1, 6, 2, 2, 8, -20, -5, -23, 6, -27, -13, -3, -22, -10, -7, -23, -6, -8, -10, -18, 1, -22, -25, 3, -17, -19, -12, -11, -6, -22, -21, -12, 7, -22, -15, -10, -11, -20, -8, -15, 1, -22, -12, -6, -15, -19, -7, -24, -1, -12, -7, -18, -16, -6, -30, -33, -26, 0, -26, 3, -4, -22, -3, 0, -26, -24, -15, -14, -18, -13, -4, -23, 3, 6, -25, 11, 17, -9, 4, 5, 16, 24, -13, 10, -7, -20, -4, -25, -9, -7, -10, -10, 4, -5, -23, 6, -23, -23, 7, 7, -4, -10, -16, 18, 14, 8, 36, 36, 7, 12, 3, 19, 24, 8, -22, -22, -24, -17, -16, 7, -2, -15, -21, -22, 6, -11, -26, -23, -5, -15, -3, -11, 15, 5, 26, 10, -2, 22, 22, -6, 16, 16, 29, 9, -10, -13, -23, -18, -12, -1, -24, -21, 0, -3, -8, 0, -19, 5, -2, 5, -1, -8, 15, 2, 4, 7, 23, 10, 13, 0, 1, -11, 13, -15, -14, -12, 5, -28, 6, -10, -20, -13, -20, 18, 12, 0, -11, 3, 20, 4, 1, 14, 11, -11, 29, 24, 16, 23, 12, -8, 1, 1, -8, 4, -5, 1, -21, -18, -6, -5, 6, -10, 5, 11, 18, -5, 21, 15, 9, 7, -1, 9, 4, -4, 25, 5, 8, 8, 16, -4, -14, -17, -5, -16, -17, -20, -11, -9, -19, -1, -11, 4, 8, 9, 5, 3, -10, -6, 6, -3, 4, 5, 30, 26, 5, 11, 20, 23, 0, 0, -1, -7, -21, -12, -3, -6, -4, 6, -4, 3, 8, 4, 2, -6, -14, 10, -25, -20, 3, 1, 14, 4, 9, 26, -6, 8, 5, 12, -16, 2, -15, -14, -27, -23, -7, -25, 3, -2, 20, 14, 20, -2, 8, 12, 10, -19, -12, -9, 1, 16, 17, 0, 15, 4, 10, 4, -20, -13, -5, -21, -11, -30, -15, 2, 9, -9, 0, -24, 8, 11, 17, 9, 0, -11, -16, 4, 3, -10, 5, -6, -7, 19, 14, 44, -13, -22, 1, 1, -12, -12, -17, 1, 12, 9, -4, -17, 21, 25, 17, 25, 14, -8, 13, 8, -7, 27, 27, 9, 20, -3, 33, 15, 13, -9, -4, -10, 5, -12, -6, -30, 5, -11, 12, -7, -6, 27, 31, 22, 29, 3, 4, 7, 3, 22, 2, -15, 18, -7, 21, 14, -7, -4, -13, -4, 1, -14, -27, -26, -9, -1, -6, 27, 5, 11, 12, 33, 11, 18, 12, 12, 10, 4, 20, -7, 4, 10, -2, 17, 7, 2, -23, -9, -6, -15, -18, 12, 12, 13, 2, 6, 20, 6, 24, 23, 13, -10, 0, 4, 18, -4, -6, -12, -4, 11, 8, 7, -7, -3, 1, -8, -8, 0, -11, -13, -4, -6, 11, 1, 9, 35, 24, 37, 4, -1, -22, 10, 23, -2, -5, -1, 8, 7, 12, 6, -16, -5, -9, -22, -6, -11, 9, 2, -8, 0, 3, 13, 24, 21, 42, 32, 4, -21, -28, -2, -12, 10, -6, 11, -5, 15, 27, -19, -3, -5, -8, -25, -25, -19, -21, 1, 18, 3, 13, 24, 0, 40, 13, 30, 9, -3, -5, 2, -2, -3, -13, -16, 17, 24, 1, -8, 0, -10, -27, -18, -12, -16, -17, 0, 5, 15, 1, 16, 22, 12, 19, 13, -5, -12, -13, -15, -18, -15, -19, 15, 16, -9, 7, -20, -11, -26, 6, -2, -1, -23, 0, -2, -1, 17, 13, 7, 27, 24, 24, 16, 19, 16, 17, 16, -12, -5, -4, -4, -16, 23, 7, -17, -22, -16, -2, -23, 2, -10, -1, -17, -31, -10, 10, -3, -6, 6, 13, 27, 4, 21, 5, 19, 17, -2, -13, -6, 8, 3, -7, -21, -18, 1, -14, -16, -9, -13, 9, 4, -22, -4, 17, -3, 15, 21, 11, -1, 7, 4, 6, 14, 10, 9, 21, 15, -6, -9, 12, -24, -7, -25, -1, -19, -14, 5, 0, -13, -7, -2, 8, -3, -1, -4, 12, 17, 27, 5, 5, 35, -13, 3, 1, 9, 0, 8, -4, 3, -22, -27, -10, -9, 7, -22, -8, -25, -22, -22, -3, -31, 4, 21, 5, -3, -11, 18, 13, -9, -20, -18, 2, -13, -3, -2, -18, -28, -2, -21, -18, -24, -25, -19, -11, 1, -16, 5, 3, 4, -35, -8, -7, -21, -9, -32, -10, -30, -26, -10, -5, -13, -24, -10, -15, -18, 2, -10, -18, -16, -23, -23, 1, -15, -10, -15, 4, -3, -2, -11, 7, -16, -3, -22, 3, 0, -17, -26, -10, -3, -25, -26, -15, -17, -10, -21, -23, -2, 16, 4, 1, 9, -9, -3, -11, 14, 14, -5, -1, 16, 13, 1, -6, -9, -1, 13, 9, -1, -1, 16, 8, -8, 10, 8, -12, -5, 4, 10, 6, -11, -7, -9, 9, -6, -5, -2, -15, 0, -14, -2, -11, -2, -13, 5, -12, 2, -8, 5, -15, -7, -15, 3, 0, 17, -14, -15, 1, -13, 5, 1, 8, 6, 4, -20, 8, -6, -4, 5, -9, 0, 12, -12, -5, 1, -11, 10, 3, 1, 7, -9, -6, -4, 9, 7, 11, -16, 11, -15, 11, -1, 9, 1, -5, 4, 6, 8, -6, 9, -2, -13, -21, -25, -13, -14, -10, 10, 12, -2, -6, -3, -15, 11, 14, 11, 15, -10, -7, -7, 0, 8, -2, 25, 1, 22, 11, 1, 4, 22, -1, -1, -2, -21, -18, 10, -6, -11, 5, -8, -9, -15, -1, -1, -17, 8, 17, -4, -17, -11, 0, -10, 12, 9, -5, 27, -5, 19, 19, 11, -9, 0, -28, 4, 1, -3, 18, -10, 12, 4, 8, 6, -5, 13, 1, -12, -7, 17, 2, -8, -5, 9, -1, -2, 12, -14, -3, -6, 21, 13, -14, -10, 12, -6, 15, -3, 2, 11, 10, 15, 25, 21, -7, 12, 19, 13, 24, -2, -3, -14, -28, -36, 1, 21, -2, 26, 7, 9, 4, 6, 9, 1, -12, 0, -14, 2, 0, -7, 19, 16, 6, 17, 21, 7, 16, 22, 7, -27, -8, -10, -2, 29, 9, 7, 8, 7, 7, -11, -9, -12, -8, -4, 2, -5, 14, 20, 7, 16, 9, 20, 12, 6, 20, 13, -9, -21, -29, -1, 11, 10, 31, 5, 8, -2, -14, -6, -14, 20, 13, 17, 17, -8, 5, 9, 5, 3, 24, 7, -12, -8, -11, -2, -28, -19, 0, 29, 28, 20, 22, 2, -11, -23, -29, -13, -22, 12, 19, 0, 17, 16, -4, -11, 11, -25, 7, 3, -10, -2, -5, -18, -21, 0, 22, 9, 2, -6, -6, 6, -1, -16, -19, -7, -2, 11, 14, 2, -2, 6, -8, -3, -19, -30, -42, -20, -42, -22, -29, 0, -8, -20, 18, 19, 12, 5, -10, 6, 8, 1, -1, 16, 16, 18, -8, 13, 11, 14, 6, -40, -60, -45, -51, -44, -47, -34, -3, 6, 19, -8, 18, 26, 8, -5, 7, -12, 17, -10, -1, 26, 44, 23, 14, -13, 17, 3, 6, -32, -52, -37, -47, -53, -40, -3, 7, 26, 10, 12, 12, 15, 1, -8, -14, -20, 3, -8, 12, -2, 8, 27, 11, -12, 14, -12, 12, -19, -38, -34, -48, -22, 7, -11, 21, 31, 39, 12, 9, -7, 12, 13, 5, 1, 15, 8, -13, 26, 24, 1, 0, 16, -8, 0, -7, -20, -12, 2, 3, 16, 15, 8, 25, 34, 33, 33, -4, 15, 5, -6, -12, -16, 10, 8, -13, -2, 35, 3, 8, -13, 8, -11, 4, 4, -1, 7, 31, 21, 33, 29, 33, 42, 29, -4, 8, -5, -23, -21, -26, 0, -4, -5, 5, 28, 21, 14, -14, 4, 4, 7, -6, -7, 30, 7, 35, 17, 28, 18, 27, 37, -5, 1, -2, -3, -13, -25, -1, -29, -14, 6, 12, 19, 20, 5, 15, -3, 7, 15, 9, 8, 21, 0, 15, 22, 34, 10, 0, 2, -18, -26, 1, -7, -7, -28, 0, -25, -25, 16, 16, 13, 5, 15, 19, 13, 8, -3, 8, 16, -6, 23, 7, 30, 5, 14, 12, 6, -32, -19, -18, -26, -7, -18, 0, -1, -18, -3, 10, 24, 11, -11, 5, -11, 11, 4, 10, 31, 7, 26, 9, -3, 4, 6, -2, -7, -16, -26, -7, -6, -9, -14, -8, -9, -14, 2, 30, -9, 1, 5, -3, 7, -4, -8, 17, 6, 7, 29, 36, 8, 16, 23, 25, 10, -11, -15, -29, -24, -33, -18, 8, -21, 17, 19, -4, -7, 5, 17, 1, -9, 18, -2, 11, -6, -8, 30, 23, 3, 27, 20, 15, 0, 19, -8, -16, -14, -17, -3, 12, 3, 11, 5, 9, -19, -3, 10, -7, -9, -12, -12, -10, 1, -24, -9, -5, 4, -2, -7, 23, 13, 19, 18, 12, -12, -25, -21, -13, -22, -22, -1, -2, -14, -3, -15, 5, -4, -5, 5, -10, 15, 1, 4, -20, -27, -24, 11, 15, -5, -4, 4, 15, -8, -23, -25, -38, -31, -32, -5, -1, -12, 17, 6, 4, 18, 17, -1, 9, -12, -15, -10, -1, -14, -17, -13, -9, -11, -22, -33, -7, -8, -24, -24, -14, -15, -8, -4, 1, -6, -2, -16, 16, 9, -11, 3, -9, 18, -5, 9, 15, 14, -5, 3, 3, 12, 12, 4, -7, 17, 18, -1, -4, -2, -6, -14, 11, -14, 3, 7, -3, 9, -18, -10, -11, 9, 6, -18, 11, -4, -6, 12, -6, -10, -14, -7, 0, -9, -6, -14, 8, 7, -2, 8, -8, -20, -11, -20, -6, -8, -13, 6, 3, -3, -22, 7, 8, 12, -8, 10, 11, 14, -20, -13, -8, -15, -6, -19, 8, 7, -17, -5, 6, 5, -1, -16, 9, -18, -17, -3, 6, -1, -20, 0, 7, -18, -7, -10, 17, 22, -5, 19, -8, -13, 14, -3, 2, -4, -11, -20, 6, 8, 0, 10, -2, 8, 9, -8, -7, 1, -11, -6, -17, 3, 8, 31, 32, 23, 19, 26, -2, 12, 17, -13, -6, 10, -10, -6, 2, 5, 5, 6, -10, -3, -12, -3, 10, -15, 9, -1, 8, 24, 16, 19, 19, 20, -5, -14, -2, -19, -9, -15, -10, -8, 0, -14, -28, -17, -8, 12, -9, -21, 5, -20, 10, -17, -20, 9, 11, 39, 20, 30, 21, -10, 15, -12, -13, 7, -7, 3, 5, -12, -10, 8, -21, -17, 5, -9, 3, -11, -14, 12, -5, -14, -7, 34, 28, 34, 24, 17, 30, -3, 8, 13, 10, 20, 8, -3, -5, -2, 25, 0, -7, 3, 1, 2, -10, -20, -17, 5, -2, -10, 3, 15, 36, 39, 46, 46, 33, 41, 43, 13, 34, 25, 33, 34, 19, 20, -2, 13, -26, -21, -27, -14, 2, 4, -20, -14, -3, 5, 5, 19, 16, 28, 29, 19, 20, 20, 21, 50, 42, 18, 27, 10, 13, 26, -13, -8, -2, -17, 0, -17, -5, -12, 9, -12, -13, 4, -12, -13, -7, 1, 13, 1, 9, 20, 2, 3, 26, 33, 9, 31, 7, -4, 12, 1, -13, -28, -17, -15, -18, -13, 11, -11, -8, -14, -29, -29, -34, -37, -42, -14, -51, -43, -14, -1, -27, 5, 1, -10, -17, 10, -19, -7, -6, -26, -24, 2, -7, -3, -2, -1, -5, -11, -55, -51, -38, -48, -35, -47, -44, -54, -37, -65, -30, -51, -7, -8, 4, -8, 9, -6, -21, -22, -10, 5, -6, 1, -20, -4, -8, -41, -43, -35, -49, -18, -16, -10, -33, -18, -45, -39, -31, -28, -21, -26, -15, -24, -34, -7, -4, -16, 2, -10, 4, -20, -20, 8, -4, -28, -49, -36, -30, -6, -22, 6, -5, -5, -25, -18, -41, -33, -37, -37, -28, -30, -1, -5, -2, 7, -5, -2, 4, 12, 2, -12, -20, -16, -41, -8, -5, 5, 9, 3, -2, 13, -10, -13, -24, -30, -33, -37, -10, -15, -2, -12, 7, 21, -4, -1, -19, -13, -10, -10, -21, -26, 4, -12, 21, 22, 7, 11, 8, 1, -22, -31, -29, -19, -1, 0, -15, -4, -16, 2, 16, 43, 15, -15, -13, 12, 2, -21, 2, -3, 5, -1, 0, 27, 31, 4, -20, 1, -19, -19, -24, -20, 1, -1, 10, -3, -12, -4, 21, 25, 5, -7, 11, 4, -6, -18, -11, -12, -3, -21, -16, -4, -7, 0, -32, -18, -35, -25, -7, -16, 15, 2, 6, -15, 0, -7, -10, 9, 1, -11, 2, -19, -21, -8, -13, 12, 1, 1, 6, 13, -16, -7, -42, -45, -23, -24, -1, 0, 2, 10, -15, -18, 15, 23, 1, 0, 14, 3, -2, 7, 6, -22, -9, -3, -16, 1, 13, 7, 10, 0, 8, -5, -4, -11, 5, 10, -10, -23, -16, -5, 15, -4, -5, 4, 10, -8, 11, -5, 12, -14, 11, 23, -17, -2, -13, 1, 9, 8, 22, 17, -1, 16, 0, 4, 5, -1, -20, -1, -8, 3, 2, -21, -17, 14, -16, 5, -6, -4, 10, -9, 1, -22, 8, 3, -8, 21, 22, 30, 21, 28, 17, 18, -1, 4, -4, -4, 0, -13, -3, -6, -15, -3, -19, 1, -4, -19, -7, -21, -7, 19, 8, 9, 13, 14, 19, 38, 20, 6, 17, 8, -10, 4, -5, -30, -26, 2, -14, -10, 10, -9, -1, 3, -14, -16, -7, -5, 13, -5, 31, 10, 0, 34, 10, 9, -6, -2, -8, -7, -4, 9, -16, -3, -18, 8, 6, -9, -17, 1, -19, 11, -4, -7, 6, -6, 27, 23, 20, -10, -1, -5, -15, 8, 8, 11, 21, -4, 25, -12, -5, -9, -19, -2, -11, 11, 3, 7, 0, -8, -18, 4, -20, 15, 8, 1, 12, 18, 22, -9, 16, 8, -6, -7, 8, 13, 5, -20, 2, -4, -8, 10, 5, -10, -2, 1, -3, -8, 6, -19, -4, 3, -24, -25, -1, -1, 13, -5, 5, -14, 17, 0, 8, 32, 2, 24, 13, -19, 12, -2, 0, 6, -9, 3, -17, -1, -15, -18, -19, -17, 3, -6, -5, -15, 1, -12, -8, -3, -18, 0, 12, -14, -17, -19, -11, -11, 5, 10, -12, -18, -21, 6, -3, -15, -14, -9, -22, 6, -8, -14, -3, 8, -14, 10, -13, -20, -11, -16, -9, -20, -1, -15, -9, -5, 10, -5, -15, 6, -5, -11, -1, 6, 12, -4, -5, -15, 7, -21, -5, 0, -16, -1, 5, -11, -5, -3, -2, -8, -18, -10, 0, -3, -7, -8, -2, -9, -9, -11, -10, -20, -14, 2, -4, -6, -6, -16, -3, -16, 9, -16, 7, -12, -24, -16, -16, 13, 1, 11, 9, 12, -22, -4, -8, -4, -7, -22, 7, -5, -8, -7, 5, -3, 7, -4, 7, 4, -19, -28, -20, -22, -20, -1, 3, -3, -4, 10, 14, 24, 9, 3, 7, -10, -9, -20, -1, 3, -1, -10, 12, -15, 6, 8, -17, -26, -34, -9, -23, -34, -30, -19, 8, -19, -2, 11, 21, -5, 20, -2, 0, -5, -10, 11, 7, -21, -17, 4, 11, -7, 9, 3, -34, -19, -20, -16, -8, -6, 3, -28, -20, -19, -35, -11, 0, -20, -11, -12, 6, -4, 4, 9, 4, -5, -20, -3, 10, -11, -23, -10, -26, -38, -27, -10, -14, -21, -19, 0, -26, -17, 10, 17, -4, 6, 12, -1, 9, -17, 9, -19, 4, -16, 9, -7, 3, -26, -40, -15, -15, -20, -38, -30, -9, -9, -6, 14, 29, 20, 30, 29, 14, 21, 16, 20, 23, 12, -2, 8, -12, -21, -21, -16, -12, -26, -22, -17, -16, -17, -26, -16, -3, 4, 22, 9, 14, 21, 26, 31, 18, 31, 16, -1, 7, 5, -5, -19, 11, 8, 4, -5, 0, -28, -9, -35, -35, -20, -2, -13, -11, 0, 18, 3, 27, 15, 15, 14, 0, 9, -2, 21, 17, 35, 7, 8, 3, -3, 9, 14, -7, -21, -7, -15, -1, 5, -4, -19, 4, 9, 34, 27, 19, 15, 6, 20, 25, 13, 10, 5, 13, 30, 7, 4, -8, 8, 10, -16, -1, 12, 1, 8, 16, -15, -3, -7, 7, 3, 28, 37, 43, -1, 1, 22, 4, 33, 7, 32, 2, 21, 10, 15, -18, -14, -12, -1, 14, 10, -8, 26, 19, 5, -2, 0, -8, -32, 2, 26, 17, -5, 16, -3, 15, -2, -11, -2, -7, -15, 14, 15, 11, -6, -10, 3, 10, 5, 2, 10, 10, 2, -19, -15, -2, -23, 8, 22, 3, -9, -22, -4, 17, 10, -11, -3, -25, -15, -20, 3, -13, -3, -15, -15, 9, 10, 19, 23, 21, -7, -4, -19, -13, -27, -5, -11, 2, -19, -28, -15, -7, 11, 3, -4, -11, -18, -23, -1, 6, -17, -12, -4, -11, -5, 36, 11, 11, -5, -10, -29, -32, -2, -18, -27, -23, -21, -12, 14, 7, 6, -17, 2, -24, -27, -31, 3, -3, -22, -11, -23, 3, -1, 17, 1, -11, -15, -13, -4, -18, -32, -40, -25, -32, -15, -10, -11, -13, -7, -42, -29, -31, -17, -19, -23, 3, -8, 9, -12, -3, -12, 10, 5, -2, -20, -4, -35, -34, -40, -25, -20, -4, -2, 4, -1, -15, -11, -24, -30, -6, -15, -18, 9, 12, -6, -10, -21, 0, 6, 26, 29, -6, 18, -6, -27, -21, -20, -8, 13, 25, -11, 0, -8, -19, -35, -29, -36, -39, -35, -4, 10, 8, -5, 3, 4, -8, 6, 3, 12, 10, 21, -2, -15, -10, -16, 4, 11, -10, -20, -3, -31, -13, -20, -14, -20, -6, 6, 3, 5, -5, 11, -15, 11, -27, -12, 5, 25, 11, 21, 5, -21, -7, 18, 12, 10, -17, -32, -37, -42, -49, -48, -16, -21, -23, -25, -8, -9, 5, -7, 0, -12, -9, -6, -1, 21, -9, -2, -15, -3, 10, 7, -2, 3, -9, -50, -33, -47, -31, -36, -20, -20, 0, -12, -12, -17, 11, -12, 12, -1, -12, -25, -15, 7, 12, -7, 20, -15, 3, -3, -12, 3, -20, -52, -43, -26, -32, -27, 4, 6, -9, -10, -24, -10, 7, -21, -9, -23, 1, -2, -4, -7, 0, -3, -18, -8, 6, -11, -4, -19, -34, -51, -53, -31, -17, -14, -10, -16, -7, -12, -11, -16, 0, 6, 7, 8, -9, -2, 23, 8, 3, 11, -11, 19, -5, 0, -6, -25, -37, -50, -38, -16, -7, -1, -20, -12, 9, -16, -24, -17, -15, 6, 6, -8, 9, 6, -8, -13, 23, 18, 40, 26, 5, 13, 1, 14, 8, -2, 6, 15, 0, 18, -3, 0, -6, 0, -20, 9, -20, -9, -3, 1, -3, -11, -13, -2, -13, 22, 23, 21, 12, 19, 38, 59, 23, 36, 11, 30, 5, -1, 19, 1, -22, -16, 11, -22, 2, -17, -19, -10, -8, -18, -21, -5, 4, 11, -14, 2, -10, -6, 13, 10, -18, -15, 4, 9, -10, -18, -8, -2, -7, 4, -12, 11, -6, -3, -10, -19, 1, -4, -4, -8, 3, 11, -15, 0, 2, 7, 9, -12, 12, 2, 0, 12, -6, -11, -2, -12, -20, -12, -13, 0, 13, 3, -16, -20, 10, 4, 1, 3, -10, -18, -9, -6, -16, 15, 10, 10, -18, 17, -11, 13, 6, -4, -16, -15, -1, -6, 1, -20, 9, -19, 8, 11, -17, 0, -20, 10, -9, -11, 15, 11, 27, 26, 16, 10, 16, -7, -10, 6, 7, -12, 17, -8, 11, -18, -8, -13, -4, -1, 8, -14, 12, -6, -3, -2, -10, 5, 21, 16, 18, 6, 9, 11, -13, 17, 6, -17, -24, -30, -9, 3, 14, 14, -5, -12, -4, 12, -4, -1, -17, 9, 11, 11, 10, 13, 23, 13, 21, -10, 8, 3, -6, 19, 24, 21, -2, -1, -13, -6, -20, -27, -13, -11, 9, -17, -14, -8, 5, 6, -8, -12, -22, 6, -23, -1, -10, -10, 5, -4, 6, 2, 27, 39, 6, 13, 5, -18, -10, -20, 3, -8, 9, 3, -21, 5, -1, 9, -21, -18, -28, -36, -48, -24, -20, -29, -5, -6, -5, -1, 2, 4, -8, -22, -9, -5, -6, -3, 0, -15, 10, 3, 2, 10, -1, 7, -4, -8, -39, -37, -45, -36, -10, -32, -3, -10, -30, -18, -7, -2, 1, -29, -19, 3, -35, -11, 2, -1, -18, -2, -9, -10, -11, -18, -12, -25, -19, -31, -32, -27, -2, 13, -10, 1, -8, 0, -3, -5, -18, -18, -9, -21, -18, -35, -32, -18, -19, -10, -18, -5, -5, -7, -31, -9, -27, -33, -30, -6, 2, 17, 13, -11, -8, 10, 15, -8, -25, -6, -4, -29, -34, -18, -43, -24, 7, 5, -7, 0, -2, -19, -1, -7, -4, -21, -25, -2, 5, 19, -21, -25, -26, -4, 12, 5, -19, 5, -14, -10, -7, -40, -17, -17, -13, 4, -16, -4, -16, -28, -4, -13, 10, 8, -14, -16, -2, -18, -30, -48, -27, -15, -31, -9, -13, -11, -9, -1, -19, -14, -24, -18, -19, -13, -5, -7, -16, -27, -6, -16, -9, 3, 1, -17, 7, -9, -9, -19, -23, -18, -36, -13, 3, 2, -2, -3, 15, 32, 0, -20, 0, 4, 8, -22, -11, -31, -9, 19, 23, 20, 12, 19, 9, -2, -16, -25, -35, -15, -20, -3, -8, -18, 10, 12, 34, 39, 2, 17, -9, -4, -2, -9, 10, 4, 20, 16, 38, 41, 16, 19, 42, 21, -12, -35, -15, -24, -6, -6, 10, -7, 13, 12, 26, 33, 30, 8, 12, -6, -15, -12, 11, -15, 3, 0, 12, 20, 14, 13, 47, 25, 32, -19, -7, 14, 5, -2, 9, 14, -7, 23, 8, 20, 27, 20, -2, -4, 9, -12, 11, 6, 13, 26, 6, 24, 27, 31, 33, 23, 11, 17, -2, 19, 34, 3, 0, -2, 35, 23, 8, 35, 53, 5, 7, -6, -7, -4, -13, -6, 17, -1, 14, 27, 12, 31, 30, 15, 3, -2, 21, 9, 26, 27, 22, -4, 17, 10, -1, 29, 40, 9, 10, 3, -7, -10, 1, 1, 2, -12, 27, 4, 31, 24, 4, 25, -16, 5, 16, 36, 11, 18, 8, 2, 6, 19, 35, 27, 30, 8, -4, 8, 9, 1, 11, -7, -15, -11, 6, -4, 26, 16, 28, 23, -14, 13, 5, 17, 15, 28, 13, 12, 36, 36, 13, 3, 1, -9, -8, 2, 5, -10, -9, 18, 23, -4, 25, 5, 24, 0, 13, 23, -8, 15, 1, 21, -3, 28, 16, 30, 33, 9, 8, 8, 16, 11, 2, 11, -14, 1, 4, 23, 1, 0, 18, 25, 17, 27, 21, 12, 16, -2, 2, -6, 1, -3, 23, -8, 16, 30, 23, 0, 2, -16, -17, -20, -7, 14, 2, 7, 1, -11, -11, 8, 28, 1, 9, 11, -9, -27, 5, -14, -12, -10, 6, -24, 12, 11, -13, -8, 5, -1, -17, -17, 7, -10, 2, -16, -16, -28, -11, 0, -17, 9, -2, 1, -9, -20, -27, -6, -15, -8, -41, -7, -17, 13, -16, -5, 1, -13, 2, 0, 2, -19, -11, -26, -29, -15, -18, -38, -31, -12, -42, -11, -42, -14, -7, -31, -19, -14, -25, -30, -21, -13, -11, -18, -14, -18, 5, -2, 13, -5, -4, 4, -22, -14, -18, -19, -49, -47, -48, -30, -25, -15, -43, -12, -29, -48, -21, -21, -34, -5, -14, 9, -9, 11, 6, -10, -1, 3, -7, -1, -4, 7, 6, -2, -6, -12, -17, -14, -5, -22, -8, -10, -24, -15, -3, -6, -11, -5, -15, -6, 9, -5, 14, -5, -17, -17, -2, 11, 2, -5, 6, -21, 3, 1, -8, 13, 9, -22, -16, -22, -16, 4, 6, 8, -16, -18, 5, 1, 9, 10, -1, 9, -17, 1, -17, -2, -2, -17, 6, 4, -5, 11, 0, -15, -2, -10, -17, 4, 5, 14, 13, -7, 3, 12, -1, 7, -12, 7, -17, 3, 14, -7, 15, -14, 13, 13, -1, -14, -12, 4, 3, 8, -4, 13, -15, 6, -8, 10, -15, -12, -11, -12, 7, -1, 14, -7, 15, -16, -15, -15, -1, -4, 16, 14, -15, 15, -17, 9, -18, -16, -9, 14, 22, 19, -12, 11, 9, 2, -19, 11, -13, 4, 2, -3, -9, 6, 14, -6, 11, -3, 3, 9, -7, -18, 1, -20, -23, -44, -28, -19, -24, -13, -27, 2, -25, -20, -13, 15, 7, -16, -7, 1, -7, -16, 9, 16, 13, -11, -7, -5, -19, 3, -25, -17, -19, -20, -37, -29, -30, -12, 15, -5, 22, 3, 8, 15, 5, -16, 10, -12, 9, -4, 6, -15, -13, -4, -10, -3, -6, -9, -3, -8, -32, -23, -12, -14, 1, -15, 7, 19, 14, 34, 6, 7, 1, -8, -11, -1, -7, -7, 10, 4, -12, -12, -25, -11, -28, -18, -31, 0, -28, -25, -28, -14, 7, 27, 7, 9, 11, 36, 24, 15, -8, -7, -16, -12, 4, -8, -11, -1, 1, -20, -37, -13, -21, -24, -29, -6, -33, 4, 3, 10, 22, 30, 7, 23, 20, 30, 34, -8, -5, -11, 5, 8, 3, 9, -9, 4, 4, -18, -19, -4, -6, -21, -21, -26, -11, 22, 7, 25, 15, -5, -25, -11, 7, -18, 17, 3, 10, 14, 5, -14, 11, 4, -14, 0, -15, -28, -14, -16, -43, -38, -34, -15, 6, 9, 14, 9, 18, -19, -23, -20, -33, -24, -23, -8, 2, 2, 10, 3, 0, -17, -5, -13, -27, -17, -23, -32, -27, -6, -17, 14, 13, 24, 23, 41, 19, 3, -17, -18, -37, -29, -4, -8, -11, 10, -13, 4, -12, 17, 10, -17, -14, 7, 12, -10, -20, 7, 21, 19, 29, 23, 8, 27, 34, 20, 3, -4, -32, 0, -20, -4, -18, 1, -7, 2, 16, 6, 5, -8, -12, 29, 8, -6, 9, 19, 23, 3, -2, -7, 3, 21, 5, 9, -11, -9, -26, 7, -5, -17, -17, -3, 15, 13, -6, 11, -9, 14, -6, -1, -19, -2, -8, 15, 2, -19, -31, -41, -12, 35, 29, 30, 16, -12, -14, -4, 5, -3, -4, -29, -15, 14, -13, -8, -15, 13, -8, -3, 0, -3, -8, 8, -4, -7, -19, -32, 27, 29, 13, 39, -2, -19, -34, 0, -9, -5, -31, -31, -11, -12, -7, 1, -17, 15, 9, -13, -16, 9, 9, 1, -23, -31, -18, 2, 35, 29, 37, 43, 6, -34, -30, -24, -14, -20, -15, -33, 0, 3, -12, -6, -18, -15, -9, -26, -8, 8, 14, 5, -20, 4, -7, 22, 29, 29, 31, 28, -29, -46, -33, -39, -41, -2, -4, -4, -11, -15, -13, -13, -7, -17, -22, 2, -22, -10, -8, 12, -20, 12, 19, -1, 19, 44, 20, -3, -55, -46, -28, -23, -2, -28, -30, 9, -12, -8, -4, 11, -13, 5, 9, -31, -17, -13, -2, -11, -5, 9, 17, 27, 6, 18, -1, -46, -29, -10, -15, -16, -2, 2, -15, 7, 18, -10, 9, 14, 2, -10, 2, -28, -27, -13, -20, -17, -13, 19, 7, 30, 21, -1, -6, -5, -15, -29, -24, -22, -20, -5, 0, 4, 1, 12, 1, 0, 15, 2, -22, -16, -35, -33, -28, -8, -21, 9, -3, 28, 21, 6, 9, -6, -15, -1, -9, -20, -18, -16, -9, 14, 13, -13, -6, -12, -13, -8, -15, 1, -7, -6, -22, -18, 14, 11, -9, -2, -2, -7, -15, 8, -5, -6, -3, 14, -4, -7, 0, 13, 18, -3, -13, -14, -11, -6, -6, 14, 14, -15, -24, 4, -11, -10, -18, -33, -16, 7, -2, -1, 8, -5, -5, -1, 22, 1, 13, 1, 4, -9, -15, 7, -8, 16, -24, 4, 7, 4, -29, -6, -22, -31, -19, -11, 5, 3, -1, 26, -4, -6, -2, 16, 6, 21, 0, 9, -4, 4, -17, -7, 5, 5, -19, -16, -2, -18, -15, -8, -35, -32, -23, -45, -47, -44, -12, 8, -6, -5, 16, 8, 8, 15, 20, -8, 4, -7, 9, 14, 15, -2, 8, -19, 11, 8, 7, -7, -30, -17, -1, -9, -23, 1, -19, -17, 2, 19, -2, 11, 6, 17, 2, -13, 4, -11, -8, -10, 12, -15, 11, -6, -5, 7, 9, 8, 32, 7, 29, 16, 21, 29, 11, 6, -3, 5, 12, 9, -2, 4, -8, 9, 16, 3, -13, 11, 4, -3, -8, -15, 15, 1, -12, 4, -12, -16, 18, -14, -14, -5, -7, 8, -7, 8, 18, -6, -5, -5, 5, 9, 9, 0, 5, 15, -16, -16, -13, -15, 16, -11, 5, 7, -18, -10, -9, 15, 13, 2, -4, -18, -16, -11, -13, -9, 4, -11, 14, 7, 15, 8, -6, 11, 3, 0, -5, -8, -12, 10, -9, 2, -10, -18, -18, -16, -15, 6, -5, 12, -10, -5, -4, -17, -9, 13, -14, 2, -11, 8, 15, -8, 1, -7, 12, 6, 12, -9, -15, 6, -11, 6, 3, -12, -4, -14, 1, 9, -11, -3, -19, 0, -20, -5, -6, -13, -9, 8, 3, -2, 13, -14, -1, 9, 17, 15, -2, 17, 11, 5, 10, -4, 3, 5, -17, -25, -16, -22, -33, -15, -23, -3, 4, -19, 2, -10, -14, -15, -14, 2, 13, -5, 10, -3, -1, 3, 6, 13, 33, 31, 21, 10, 7, -20, -10, -24, -42, -49, -20, -18, -30, -10, -5, -9, -7, -5, 0, -10, 2, -3, 9, 15, 19, 9, 31, 18, 12, 13, 30, -3, 16, 11, -6, 4, -8, -31, -29, -47, -31, -28, -14, -1, 4, 1, -3, -14, 14, -5, -13, -3, 8, 14, 24, 26, 10, 18, 25, 7, 10, 31, 12, 22, -5, -42, -27, -37, -45, -30, -20, -2, -13, 0, 12, 10, 6, 5, 4, -7, -7, 14, 9, 11, 21, 2, 25, 10, 16, 3, 33, 11, -1, -9, -21, -24, -15, -18, 3, -19, -10, 14, -3, 9, 2, -13, 9, 10, -23, -11, 0, 7, -15, 19, 20, 21, 30, 15, 27, 27, 4, 20, -21, -3, -20, -37, -21, 11, -9, -3, -19, 7, -16, 5, -5, -5, -13, -7, -26, -2, 2, 12, -4, 4, 41, 38, 17, 25, 23, 28, -2, -14, -14, -28, -10, -21, -7, -4, 0, 2, -5, 7, -18, -9, -6, 5, -14, -11, -17, -17, -4, -9, 1, 5, 15, 34, 20, 13, -10, 6, -10, -11, -1, -18, 10, 11, -3, -13, 10, -2, -17, 14, -2, -15, -5, -17, -8, -23, 5, -11, 0, 23, 25, 12, -1, 20, 25, 5, -4, -17, -2, 15, -1, -1, 7, -11, 8, 12, 10, -18, -9, -7, -6, -9, -33, -32, 13, 24, 22, -3, 17, 23, 18, 31, -7, 2, 0, -20, 7, -13, 2, 4, -2, -4, 4, 3, -17, -18, -3, 1, -3, -14, -10, 6, -5, 17, 13, -3, 28, 13, 2, 10, 17, 6, -14, -15, -3, 10, 5, -7, 5, 4, -13, 11, -15, -3, -1, -3, 16, -5, 12, -12, -10, -7, -4, -14, 13, 30, 9, 11, -10, -11, -28, -13, -15, -7, 0, -1, 14, -8, -2, 9, 22, 6, 2, 5, -7, -2, 8, 21, 13, -25, -8, -6, -4, 27, 29, 1, 0, 12, -2, -11, -15, -9, -12, -17, 13, -12, -5, 25, 12, -13, 8, 11, 21, 22, 4, 21, -21, -10, -9, 11, 28, 21, -9, 1, -16, 16, -5, -19, -9, -10, -17, 0, -1, -3, 25, 14, -14, 2, 16, 7, 2, -9, 1, -10, 7, -39, -8, -10, -4, 1, 19, 1, -23, -14, -9, -20, -14, -3, 1, -9, 11, 18, 19, 22, 7, 5, 11, 16, -6, -9, -8, -12, -28, -5, -8, 8, 5, 0, -7, 11, -16, -3, 9, -27, -18, 15, 12, 6, 14, -12, 16, 21, -2, 9, 3, -6, -3, -25, -2, -14, -33, -33, -17, -6, 1, 5, 1, 4, 2, 12, -22, -22, -3, 8, 9, -16, 5, -14, 22, 7, 17, -9, -15, 11, -8, -29, -37, -37, -27, -12, -29, 6, 9, 6, -8, 9, 18, -18, 3, 7, 14, 7, 14, 1, 16, 2, -9, -2, -11, -9, -7, -13, -25, -22, -8, -27, -12, -5, -12, -11, 7, -1, 1, -6, 7, 6, 3, 0, 12, 16, 4, -15, -7, 4, -4, -12, -18, 6, -19, 12, 0, -8, 6, 17, -1, 8, -3, 13, -16, -14, 6, -17, -30, 7, -16, 6, 13, 7, 1, 8, -15, 14, 13, -9, 5, -13, 6, 10, 0, 4, 1, 22, 7, 14, 9, 16, 14, 7, -1, 8, 7, 18, 22, 2, -12, -3, 4, 8, -10, -14, 10, 2, 1, 9, 40, 12, 5, 16, -2, 20, 18, 12, 2, 22, 1, 12, 1, 16, 9, 4, -2, -13, -6, -4, -14, -12, -1, 4, -9, -11, 22, 9, 27, 30, 16, 37, 21, 32, 35, 3, 21, 29, 11, 10, 22, 28, 19, -4, -16, -9, -1, 11, 1, 4, 6, 13, -8, 8, 10, 2, 18, 26, 2, 4, 17, 7, 13, 19, 15, 18, 33, 3, -3, 17, 5, 17, -7, 8, -13, -16, 0, 10, 3, 9, 8, -12, 16, 9, -9, 3, 14, 11, -4, -14, 10, 15, -16, 10, 4, 2, 12, 15, 8, 9, -15, -17, 13, 0, -11, -9, 7, 6, 6, 14, 13, 2, -2, -12, -16, -17, -14, -6, 13, 0, 9, -9, -2, -12, 1, -12, -4, 8, -16, -7, -10, 5, -7, 8, -6, 3, 2, -7, 16, 16, 16, 7, -12, 0, 14, 0, -3, 8, 15, 10, -9, -2, -17, -10, 5, 16, 9, 15, -16, -16, 4, -9, 16, 8, -7, 15, 9, 8, 6, -18, 5, -15, -9, -15, 3, -2, 10, -16, -2, -4, -18, -4, -7, -6, -16, 11, 11, -16, 4, -2, 4, 1, -12, -8, 13, -3, -8, -2, 2, -15, 15, -12, -17, 10, 7, 23, 23, -5, 6, 0, 0, -19, 10, 4, -13, 16, -14, -2, -13, -14, -8, 18, -6, -2, 14, -13, -9, 4, 24, -8, 2, -15, 33, 3, 14, 9, -2, 20, -2, 7, -12, 4, 11, 0, 10, 11, 5, -12, 3, 20, -7, -2, 3, 0, 14, -9, -10, -24, -20, 14, 24, 23, -4, 5, 26, -1, -13, -6, 7, 8, -12, 16, 9, 5, 14, 6, -7, 15, -2, 4, -10, -11, -14, 15, -17, -11, 7, 2, -14, -2, 13, 7, -5, -11, 3, 18, -3, -4, -6, -10, 12, -2, 6, -5, 10, 5, 12, 17, 12, 2, -4, 11, -17, -15, -8, -8, -12, 13, 11, -10, -11, 9, -2, 13, -3, -11, -14, -5, -11, -13, 6, 15, 16, 12, 1, -4, -14, -25, -19, -12, -5, 15, 19, 25, 10, 28, 18, 13, 6, 6, -21, 20, -9, -5, 9, -5, -14, 16, 9, -11, 19, 27, 13, 1, 10, 4, -16, -13, -1, -6, 26, 39, 36, 20, 13, -1, -9, -3, -8, 8, 13, 8, 14, -16, 12, -16, -13, 6, 7, 15, -12, -23, 1, -4, 7, -23, 3, -18, 12, 36, 14, 24, 17, -4, 3, 11, 14, 23, 6, -2, -5, 15, 12, 5, 15, -10, 5, 4, -1, -16, 5, -19, 12, 5, 2, 8, 25, 5, -6, -4, -6, -11, 7, -24, -6, 6, -14, 4, 16, 3, 14, -16, -14, 6, 2, 14, -13, 2, -3, -13, 16, 8, 16, 23, 10, 10, 2, -13, 11, -11, -17, -18, -8, -18, -12, -3, -3, -12, 3, -3, -1, -3, -4, -5, -4, 18, 10, 1, 18, -3, 3, -7, -25, -20, -17, -31, -12, 17, -29, -30, 3, -20, -19, 6, -9, -11, 0, -13, 3, 11, -8, 1, 9, 23, -4, 31, 6, -3, -8, -35, -16, -8, -1, -2, -6, -7, 11, 19, 16, 21, 32, 23, -15, 5, -1, 15, -8, -14, 6, -7, 30, 22, -5, 12, -8, -33, -16, 3, -35, -13, -16, -28, 3, 4, 20, 12, 15, 5, 34, 24, -19, -5, 7, -16, 13, 15, 15, 22, 15, 3, 16, -24, -38, -13, -5, -17, -12, 1, -16, -26, -16, -8, 11, 4, 15, 24, 38, 26, -11, 9, -8, -10, 14, 8, 1, 15, 18, -5, 5, -9, -33, -37, -8, -11, -21, -4, -20, -4, 22, -5, 15, -3, 5, 31, 12, 3, -20, 0, 7, 11, -8, 1, 28, 18, 26, -10, -17, -15, -34, -14, -35, -11, -5, -16, -9, 4, 9, 18, 12, 17, 13, 5, 4, -17, 10, -14, -15, -16, 7, 0, 12, 2, 0, 1, 19, 2, -13, -6, -20, -13, -4, 15, 2, 28, 6, 5, -2, -13, -7, -7, -13, 8, -8, -10, 0, -4, 0, -1, 18, 25, 15, 8, 26, 7, 19, 7, 5, 14, 27, 29, 24, 17, -6, 4, -20, 7, 8, -22, -12, 8, -7, 13, -5, -14, -7, -7, -2, 4, -5, 18, 11, 18, 11, -1, 15, 29, 10, 9, -1, 17, 10, 0, -4, -11, -15, -31, -33, -28, -18, 1, -1, 4, 2, 0, -2, 5, 3, 6, -17, 4, 7, 10, 4, 13, 9, 12, 35, 11, 19, 13, 10, -11, -30, -12, -11, -16, 11, 5, -1, -2, -10, 14, 16, 4, 16, 15, 6, -21, -5, -1, 14, 10, -1, 33, 4, -2, 9, -19, -5, -39, -14, -24, -17, -12, -15, -14, 12, -17, -17, 11, -1, 11, 26, 29, 12, 11, 4, -8, 6, 12, 38, 31, -1, 10, -6, -2, -30, -41, -36, -12, 6, 3, -10, -5, 11, -15, 15, 4, -7, 17, 2, 23, 29, 10, 30, 18, -1, 19, 2, -17, -19, -17, -19, 0, -21, -16, 0, -4, -14, -9, -7, 9, 5, 3, 16, -1, -17, -11, -7, -9, -5, -13, -18, -17, 5, -5, -17, -20, 10, -12, 9, -7, 8, -4, 6, 9, 11, 4, 15, -10, 10, -5, -6, -14, 10, 1, 15, 8, 10, 7, -17, -1, -4, -13, -9, -10, 13, 10, -7, -11, 13, 7, -15, -10, 1, -6, 10, 5, 10, -17, -10, 12, 4, -11, 12, 5, 2, -3, 13, -2, -13, -16, -16, 3, 4, -16, 1, 6, -8, -15, -3, 13, -9, 3, 6, 10, -4, 15, 14, -10, -13, -7, -1, -13, -5, -3, -5, 3, -18, 1, 0, 7, 6, 11, -8, 13, 1, 15, -18, -7, 14, 10, 6, -7, 7, 11, 8, 12, -5, 12, 12, 14, -1, 16, 8, 11, 17, 12, -2, -8, 14, 12, 4, -6, 2, -15, -10, -14, 14, -18, -8, -7, 9, -19, -3, -4, 5, 9, -18, -17, -10, 28, 33, 33, 24, 22, 13, 8, 23, 13, 6, 23, -5, 10, -2, -9, -2, -8, 5, 5, -17, -9, -13, -19, -7, -2, 7, -3, -8, -6, 22, 4, 19, 22, 2, 14, 2, -12, 19, 16, 7, 6, -9, -7, -10, -13, -18, 14, -17, -17, 11, 8, -12, 13, -1, -10, 12, -1, 15, 6, 3, 19, 24, 5, 3, 24, 23, 20, 20, 1, 11, 11, -5, -2, 6, -16, -19, -8, -5, 12, -13, 6, 15, -6, 13, 19, 23, 1, 11, 16, 36, 8, 46, 45, 27, 18, 23, 9, 6, -10, -18, 4, -5, -13, 2, 0, -7, -7, 7, 5, -14, -3, 2, 19, -4, 16, 24, 28, 47, 45, 47, 51, 26, 30, 10, 21, 7, 17, 11, 2, 18, -19, -3, -5, -2, -11, -1, -1, -15, 13, 0, 7, -4, 12, 7, 38, 27, 35, 5, 30, -10, 6, 30, 8, 34, 27, 28, -8, -3, 16, -1, 10, -15, 11, 7, -2, 17, -14, -8, 17, 13, -17, -2, -13, -34, -45, -32, -23, -14, 0, 28, 5, 5, 32, 32, 2, 15, 14, -12, 12, -5, 6, 2, 8, 7, 0, -22, 0, -24, -5, -17, -47, -59, -55, -37, -17, -13, 17, 10, 4, 1, 22, 28, 2, -1, -5, -4, -18, 2, 0, -20, -2, -12, -19, -15, 6, -2, -44, -50, -54, -74, -37, -24, -27, 2, 3, -3, 9, 20, 20, 1, 10, 4, -17, -4, -9, -14, 1, -6, -23, -8, -28, -12, -2, -3, -32, -30, -20, -21, -30, -25, 1, -1, 0, 5, 11, 22, 7, -21, -7, 13, -6, 2, -1, 9, 0, 10, -33, -26, -9, -27, -25, -9, -5, -5, -23, -3, 1, -2, -2, -15, -11, 6, 6, -6, -22, -16, 0, 11, -6, 14, 14, -6, 9, 12, -39, -38, 9, -17, -12, -14, -35, -11, -18, 23, 25, 11, 15, -6, -22, -26, -25, -19, 0, -26, -12, -18, 7, -10, -12, -16, -16, 11, -11, 4, 1, -16, -11, -13, -12, -4, 17, 25, 17, 26, 11, -23, -40, -26, -31, -34, -24, -35, -8, 9, -17, 11, -8, 14, -10, 5, -5, 10, 10, -10, -1, -12, -3, 22, 11, 24, 17, 22, 19, -15, -14, -43, -45, -24, -7, -16, 8, 12, -8, -1, -11, 5, -18, 22, 11, 18, 19, 6, 15, 7, 3, 26, 27, 30, 13, 17, 17, 16, -22, -28, -16, -24, -24, -11, -1, 10, -2, -17, -12, 13, 10, -3, 24, 23, 10, 0, -9, 8, 15, 25, 5, 10, 3, -4, 15, 9, 21, -6, -18, -20, -25, -6, 3, 6, -5, 1, 3, 0, 8, 12, 33, 28, 12, 21, -3, 17, -8, -3, 17, 12, 3, 9, -2, 11, 18, -7, -4, -24, 0, -14, -12, 16, 10, -12, 12, -15, -17, -1, 33, 36, 17, 28, 7, 1, -10, -1, -6, 0, 6, 11, 7, -8, -9, 12, -3, 11, 8, 19, 21, -7, 7, 2, -7, 5, 17, 17, -4, 8, 26, 13, 14, -6, -6, -18, -5, -5, -22, -20, 2, 6, 7, 11, 7, 12, 17, 2, 18, -3, 15, 13, -14, 12, 16, -7, 11, -6, 13, 27, -9, 7, -5, 15, 11, -13, 4, 3, -4, 28, 32, 26, 21, 24, 26, 13, 9, -8, -4, 9, -4, -4, -13, -17, -10, -16, -12, 1, 15, 13, -22, -18, 1, 4, 4, 14, 41, 21, 22, 43, 34, 42, 44, 19, -2, 0, 11, -1, -9, -4, -2, 7, -8, 5, 4, -4, 1, 16, 11, 15, 10, 9, 27, 55, 30, 36, 23, 33, 37, 31, 2, -2, -7, -8, -8, -13, 5, -3, 9, 9, -21, -3, -17, 15, 0, 16, 10, 22, 38, 24, 42, 36, 39, 23, 29, 8, -5, 1, 4, -15, -12, 5, -18, -15, -3, 12, -10, 1, -15, -5, -5, -11, 21, 16, 19, 12, 4, -10, 1, -10, -3, -7, -9, 6, -4, 12, -13, 8, -18, -3, 4, -17, 12, 13, 3, 7, -8, 12, -14, -10, -16, -5, -3, 2, -1, -14, -16, -5, 13, -16, -9, -18, -9, -14, -10, -17, 12, -10, 11, 5, 7, 0, 1, -4, -23, -15, -4, 4, -1, 8, -5, 7, -12, -20, -9, -11, -10, -23, -24, 2, -20, -23, -3, 8, -13, 3, -13, -18, -2, -7, 2, 2, 8, -9, -16, 3, -3, -23, -5, -16, -12, -22, -21, -3, -18, -2, 4, 4, -11, -3, -18, 11, -21, -2, 2, -15, -19, -1, 4, -4, -7, 9, -13, -5, -5, -12, 8, -2, -9, -11, -3, 9, -11, 15, 6, 0, -7, -8, -23, 0, -1, -24, -18, -18, 8, 4, -24, -5, -19, -16, 4, -12, -12, 1, 2, -19, -4, 7, -11, -9, -2, 12, 25, 13, -9, 6, -12, 3, -9, -22, -4, 8, -12, 10, -10, -16, 3, 7, -9, -24, -4, -21, -9, -20, -15, 1, 14, 25, 3, -12, 6, 4, -2, 9, -14, -24, -2, -19, 6, -3, -5, -21, 4, -1, -25, -2, -17, -21, -25, -20, -32, -12, -5, -7, -18, -28, -12, -17, -26, -22, -8, -6, -5, -14, -25, -16, -11, 7, 6, -4, 1, -6, 0, -19, -12, -8, -17, -17, -33, -8, -6, -9, -1, -22, 1, 6, 22, 19, 13, 1, 4, -5, 19, -10, 6, -16, 5, -18, 7, 1, -8, -22, -24, -28, -32, -26, -13, -10, -2, -13, 5, 4, 28, 12, 17, 30, 29, 28, 14, 22, -4, -1, -11, -20, 5, -5, 10, 3, -31, -9, -12, -21, -16, -20, 8, 10, 15, 8, 27, 14, 29, 21, 29, 10, 31, 36, 39, 37, 22, 18, 14, 8, -9, 8, 7, -7, -1, -24, -18, -1, -23, -8, 7, 28, 32, 15, 9, 24, 15, 25, 1, 10, 4, 14, 26, 36, 40, 10, -10, -4, -18, 11, -6, 12, 14, -24, -9, -22, -1, 1, 29, 8, 9, 20, 37, 30, 14, 22, -9, 15, 25, 12, 28, 23, 49, 19, 11, 6, 0, 0, 16, -7, 7, -22, 2, -4, 9, 7, -11, 11, 9, 40, 18, 42, 31, -4, 21, -12, 18, -2, 27, 48, 23, 23, 12, -17, -18, 4, 8, 4, 2, 13, -19, -15, -3, -23, -16, -6, -27, 13, 10, 26, -11, 1, 8, 0, -10, -27, 7, 16, -14, 1, 7, -6, -22, -20, -1, 11, 7, 6, -1, -15, -23, -26, -14, -36, -26, -7, 27, 4, -18, -31, -17, -31, -13, -11, 3, -21, -31, -23, -1, -4, -22, -12, 10, 4, -14, -14, 4, -18, -28, -13, -21, -19, -27, -16, 7, -9, -11, -11, 0, 2, 17, 2, -2, -23, -18, -24, -10, -19, 7, 6, -14, -16, -12, -4, 7, 5, -25, -19, -15, -19, -5, -14, -23, -29, -13, -4, -7, -11, 3, -3, -28, -5, 1, -6, -20, 3, -22, 9, -4, -8, -9, -2, 14, -3, -5, -4, -12, -22, -33, -39, -33, -15, -21, -6, -7, -15, 1, -29, -15, -31, -24, -10, -24, -24, -18, -10, -11, 8, 13, 21, 15, 19, -4, -17, -10, -23, -30, -25, -9, -6, -1, -9, -3, -4, -4, -21, -46, -43, -14, -31, 8, 7, -16, -5, -19, -13, 4, -16, 11, -7, -9, -6, -19, -20, -36, -7, -1, -2, -25, 10, 27, 20, 18, -29, -24, -28, -40, -24, -23, 1, 4, 1, 2, -23, 1, 7, 13, 4, 7, 10, -11, -32, -28, 13, -15, -7, -14, 18, 4, 9, 1, -21, -21, -16, -14, -8, 1, -14, -16, 0, -9, -10, -8, -3, 16, 11, 19, -13, 6, -12, -13, -9, 10, -16, -15, 15, 11, 0, -31, -32, -12, -25, -7, -24, 9, -2, 4, -8, -10, -10, -2, 6, 17, 16, 1, 7, -1, -5, 21, 6, 7, 1, -3, 6, 15, -11, -14, -37, -14, -20, -5, -15, -13, 8, -5, -23, 5, -24, -15, 2, 23, 16, -11, -1, -1, 7, 10, -16, 16, 3, -1, -19, -10, -20, -23, -40, -19, -4, 4, -15, -12, -2, -24, -13, 3, -18, -9, 6, 19, -13, -14, -25, -10, 6, 7, -13, 0, 1, -5, -12, -43, -32, -18, -31, -16, -5, -14, -1, -19, 1, -8, 3, -7, -1, -7, 3, -2, 20, 12, 4, 9, -3, 32, 4, -3, 23, 6, -2, -36, -11, -22, -23, -5, -13, 8, -21, 5, 2, 5, -18, 8, 2, 5, -20, -10, 7, 35, 15, 20, 33, 17, 19, 0, 17, 27, 23, 18, 24, 5, 0, -17, 3, 5, -18, -22, -15, 8, 9, -9, -18, -15, -1, 3, 0, -9, 18, 12, 24, 31, 26, 41, 25, 41, 16, 11, 4, 16, 4, 4, -20, -22, -22, -21, 10, 7, 9, 5, 6, -4, 4, -16, -14, 8, -15, -12, -13, -21, -10, 13, 4, -4, 1, -16, -14, -20, 10, -8, -22, -2, 3, -22, -20, -9, -13, -1, 9, -9, -8, 0, 5, -15, -2, -1, 11, 0, 1, -17, -15, 2, -17, 0, -13, -9, 10, 8, -18, 0, -13, -4, -12, -11, -14, 12, 5, 9, 0, 8, 9, 5, 11, -12, -5, -19, -6, 6, 15, -15, -9, -3, 6, 9, 15, 15, -4, -5, 10, 11, 12, -11, -5, -8, -7, -15, 0, -11, -7, 4, 2, -16, 2, -14, -24, -5, -18, -21, 6, 10, -6, 7, -10, -17, 14, 4, -13, 4, 1, -17, 6, 5, 8, -10, -3, -9, 1, -5, 6, -5, -10, -1, -9, -12, -6, -2, -6, 5, 10, -2, -11, -18, -19, -6, -9, 4, -15, -5, -15, -16, -14, -11, -16, -15, 7, 2, -7, 9, 3, 10, 5, -6, -4, -3, 10, 17, -12, -11, 10, -1, 2, 8, 14, 7, 15, 10, 15, 8, -1, -7, -36, -18, -20, -3, -2, 30, 30, 21, 34, 36, 13, 22, 4, 24, 15, 4, 23, 21, 5, -9, -5, -6, 0, -17, -3, 15, -13, -29, -29, -20, 4, -5, 31, 23, 41, 50, 70, 53, 31, 6, 1, -15, 4, -9, 5, 7, 4, -12, 0, 16, -1, -7, 2, 10, -18, -2, 1, -9, 8, 26, 3, 35, 39, 58, 36, 32, 3, 10, -18, -8, -13, -21, -10, 17, 3, -5, 9, -5, -4, 14, -17, 3, -23, -18, 6, 2, -12, 25, 31, 35, 46, 17, -11, 17, 13, 1, -5, -1, 1, 6, -9, -21, 3, 7, -1, -4, -6, -19, 11, -22, -11, -30, -3, 17, 13, 5, 32, 31, 3, -20, -2, 3, -3, -2, 29, 20, -20, -16, 1, -14, 2, 22, 26, 12, -9, -17, -5, 6, -20, 5, 3, 34, 36, 21, 18, -14, -4, -10, -43, -18, -4, 12, 5, 8, -11, -13, 7, -8, 4, 8, 26, -12, -7, -9, -5, 3, -8, -13, 31, 49, 29, 27, 13, -6, -22, -36, -39, -25, 1, -6, 7, 8, -8, -7, -2, 1, -19, -7, 8, 5, 8, 5, -4, 5, 15, -7, 8, 8, -2, 15, -25, -1, -36, -33, -20, -18, -34, -11, -16, 0, 23, 33, 3, -13, 1, -5, -13, 5, -5, -2, -17, -21, -2, 26, 12, -3, 18, -16, -18, -9, -14, 1, 1, -23, -38, -25, -14, 1, 21, 32, -4, 16, -13, -6, -1, 0, 15, -12, -1, 1, -10, -8, -27, 0, -4, 8, -6, -10, 0, -2, -12, -4, -21, -30, -23, -13, 16, 31, 2, 5, -26, -25, -16, -5, -8, 10, -7, 10, 6, -3, -17, -1, 0, -15, 7, -7, -18, -26, -27, -25, -29, -23, -8, -15, 18, 3, 0, -10, -9, 7, -14, 11, -15, -4, 6, -10, 13, 23, -9, -6, -23, -22, -28, -11, 6, 6, -3, -13, -44, -33, -5, -4, -10, 6, -2, -4, -23, 9, 19, 21, -7, -13, -4, 9, 6, 22, 5, 9, -14, -25, -15, -4, -17, 7, -12, -34, -36, 0, 7, -7, -1, -16, -32, -24, -7, -9, 27, 2, 15, -7, 13, -2, 0, 35, 8, 11, -20, -9, -8, 3, 14, -23, -31, -17, -9, -9, 17, 13, -18, -3, -28, -14, 4, 8, 26, 1, 13, -16, -2, 11, 6, 11, 11, -4, -5, 9, -6, -18, 7, -1, -4, -18, 0, 9, 15, 15, -6, 13, -10, 9, -3, 7, 1, 14, -1, -18, -6, 0, 8, 31, 22, 16, -3, 12, 7, 1, 16, 13, -5, 17, 27, 42, 17, 21, -2, 16, 2, 2, 12, 35, 5, -15, -12, -19, -6, 15, -3, 25, 17, -4, 15, 7, -6, -5, 17, 8, 2, 9, 35, 40, 32, 28, 11, 24, 15, 1, 34, 11, 1, -4, -10, 7, 13, -2, 1, 18, 16, 16, 18, 19, 28, 32, 18, 31, 36, 34, 28, 42, 13, 28, -7, 24, 18, 6, 38, 2, -7, 7, -13, 1, 0, -4, 1, -5, -15, -14, 0, 3, 1, 23, 37, 25, 21, 32, 25, 17, 10, -5, 22, 7, 40, 28, 11, 2, -12, 8, 4, -6, -6, -1, 1, -4, 1, -12, -30, -3, -9, 11, -3, 23, 19, 31, 34, 33, 23, 28, 21, 19, 30, 12, 13, -1, -13, -18, -15, 6, -17, -10, -16, -1, -13, 6, -22, -9, -13, -45, -43, -30, -38, -18, -9, 22, 32, 16, 6, 44, 13, 1, 16, 17, 12, -7, 4, -12, 12, -3, -15, 6, 1, -5, -5, -5, 6, 9, 7, -17, -11, 14, -12, -4, 18, -1, -4, 13, -8, -8, 8, -2, 2, 8, -19, 10, 16, -15, -6, 13, -4, 4, -4, -1, 13, 2, -18, -8, -13, -9, 11, -11, -10, 4, 4, -2, 10, -12, -2, -13, -9, 11, 4, 7, -3, 15, -7, 12, -16, -17, 5, 1, 8, 1, 9, -2, 15, -15, 8, -2, -1, 10, -1, 9, 16, 3, 14, -7, -14, 12, 17, 2, -13, 3, 2, 7, -10, 3, 14, -5, -7, 4, -13, -12, -9, 12, 6, -17, -14, 11, -10, -14, -9, 1, -6, -10, 3, 10, 12, -16, -16, -1, 13, 13, 2, 18, 0, -9, 1, -4, -4, 18, -10, 10, -21, -20, 1, 15, 24, -4, 1, 22, -3, -13, -3, 8, 1, 7, -13, -17, 8, 5, 8, 9, 6, 1, -7, -7, 18, 12, -20, -18, -1, -24, 20, 1, 8, 13, 30, 4, -5, -6, 11, 8, 10, 14, -1, 10, 6, 1, -9, -2, -11, -6, 22, 19, -7, -23, -11, -13, 16, 1, 4, 28, 25, 34, 39, 21, 19, -9, 1, 16, 17, -9, -8, 10, -12, -8, -16, -12, -8, 4, 5, 2, -33, -9, -8, -2, -20, 9, 9, 5, 37, 27, 30, 10, 20, 5, 4, -1, 1, -13, -10, 12, 10, 7, 0, 14, 8, 24, -20, -20, -5, -10, -23, -31, -38, -31, -3, -20, 13, 26, 32, 25, 29, 38, -7, -12, 6, -4, 5, 9, -12, -3, 29, 11, -4, 10, -7, -1, -13, -14, -24, -25, -19, -34, 1, 4, -7, -3, -7, 3, 50, 40, 6, -9, -13, -14, -8, 9, 1, -7, 26, -9, -14, -1, 20, -11, -1, 4, 5, -29, -39, -10, 18, 11, -4, 10, 15, -2, 27, 8, 2, -7, 12, 11, 3, -3, -11, 9, -17, 6, 12, 10, -9, 7, -1, -21, -12, -2, -18, -6, 7, 17, 12, 13, 11, 7, 25, 13, 11, 10, -1, 8, -6, 9, -9, -1, -4, -29, -14, -20, -10, -18, -13, -20, 5, 7, -5, 5, 31, 0, 0, -17, 6, 13, 3, 35, 10, 9, 4, -8, 14, -7, -8, 5, -24, -4, 9, 10, 11, 3, -22, 6, 3, 2, 23, -1, 18, 12, -20, -1, -15, 14, 19, 9, -4, 12, 14, -1, -1, 6, -5, -8, -22, 16, -2, -6, 9, 8, 8, 4, 24, 32, 29, 22, -2, 13, -26, -31, 8, 7, 40, 44, -14, -12, -5, 3, -17, -6, -19, -23, 4, 17, 0, 18, 25, 26, 24, 33, 11, 2, 12, 19, 8, -7, -2, -18, -24, 5, 11, 0, -21, -30, 10, 14, -10, -2, 1, -23, -13, 8, 14, 24, 39, 4, 9, 14, 3, -10, 7, -23, -16, 14, -15, -10, 5, 11, 10, -6, -3, 0, -6, 12, 8, -9, -3, 1, 10, -17, -6, 11, 13, 19, 28, 2, -25, 8, -20, -17, -19, -13, -8, -5, 2, 24, 14, -12, -18, -26, 3, -15, 8, 2, -25, -12, -2, -1, 12, 24, 12, 17, 15, 8, -33, -8, -14, -2, -27, 14, 4, 12, -13, -3, 5, -2, -19, -22, -2, 13, -16, -4, -11, 5, -4, 19, 14, 5, 20, 30, -1, -20, -2, -21, -22, 12, 5, -14, 0, -11, 4, 14, 27, -20, -27, -26, -17, -11, -1, 11, -17, 7, 2, 12, 5, 2, 22, 21, 18, -3, 8, -20, 8, 5, 4, -14, 5, 1, -14, -9, 18, -19, -10, -21, -5, -1, -5, 7, 2, 0, 16, 26, 18, 32, 23, 16, 35, 15, -14, -1, 18, 0, -4, 5, 2, -3, -10, -8, -24, -4, 0, 2, 4, 8, -2, -17, 5, -14, -8, 2, 14, 33, 21, 42, 25, 50, 19, 34, 22, -9, 5, 15, 2, -1, -1, -33, -10, -26, 3, -11, 5, 8, -6, 10, -16, -18, -6, -8, 33, 17, 33, 8, 35, 31, 24, 13, 7, -4, 0, -3, -18, -6, -21, -16, -23, -29, 12, -9, 8, 13, -9, -12, -22, -24, 0, -14, 1, -5, 4, 20, 29, 17, 27, 37, 46, 14, 9, 6, 4, -23, -15, -15, -24, -4, -11, 1, -14, 11, -17, 6, -16, -6, -25, -16, -7, -15, -13, -17, 16, 6, 34, 34, 25, -12, -24, -14, 1, -24, -19, -28, -18, 5, -15, 0, 13, -5, -5, 2, -9, 12, -7, -21, -26, -6, -5, -1, -6, 16, 4, -2, 7, -6, -30, -16, -11, -8, -26, -17, -18, 12, 5, 2, -3, 15, -15, 4, 5, -21, -10, 3, -7, -10, -21, -3, 1, -14, -42, -43, -20, -5, -20, -16, 5, -11, 1, 16, -1, 6, 13, -8, -5, -17, 9, 11, 4, 5, -18, -24, -25, -17, -30, -30, -17, -17, -22, -32, -26, -9, -4, -4, -21, -17, -10, 10, -12, 13, 9, -14, 2, -7, 12, 14, 6, 2, 10, -14, 10, -1, -16, -12, -5, -15, -12, -12, 10, 5, 0, 3, -18, 12, -7, 13, -13, 10, 0, 11, -13, -14, 12, -11, 0, 4, 10, -10, -2, -8, -10, 4, 6, -16, 5, -10, 13, -16, -3, 9, 2, 5, -2, 12, 11, -2, -10, -12, 12, -3, 1, 6, 8, -10, -2, -12, 13, 6, -2, -9, 15, 15, -5, -10, 14, -5, 3, -16, 15, 3, 0, -6, 8, 7, 0, 8, -1, -12, -2, 7, -10, 15, -9, -17, -2, -8, -2, -20, 1, 0, -6, 17, -1, -6, 12, -9, 12, -16, 9, -10, 16, 6, -14, -9, 16, 11, -15, -14, -8, 11, 8, -16, -1, -23, 0, -23, -28, -16, 16, 14, -12, 3, -14, -8, -18, 2, -8, 15, -5, -4, -17, -8, -18, -4, -4, -15, 11, 4, 2, -26, -12, -22, -20, -9, 15, 23, 27, -7, -9, 14, -10, -15, 13, 11, -2, 0, 15, -11, 17, 5, -6, -10, -7, -11, -9, -3, -28, -3, -9, 0, -9, 2, -15, 14, 2, -17, -26, -23, -33, 1, -6, 21, 15, 8, 18, -14, -4, 10, -8, -3, -4, 15, 6, -9, 16, -24, -26, -34, -29, -14, 2, 7, -17, -18, -37, -46, -11, -16, 5, 17, 7, 28, 23, 7, 4, -2, 15, 9, 2, -11, -8, -12, -9, 10, -2, -28, 1, -9, 1, -17, -33, -56, -44, -36, -28, 11, 17, -10, 5, 16, 11, -18, 7, 11, -10, 1, 4, 2, 23, 32, 3, -1, -9, -5, 12, 11, 4, 19, -23, -26, -39, -27, -8, 4, -4, -5, -15, 10, 10, -12, 8, 2, 0, -13, -8, 1, 6, 4, 18, -9, 1, -21, -6, -2, 9, 26, 10, -18, -13, -18, -11, 22, 3, 6, 14, 25, 16, 1, -20, -19, -1, -17, -9, 11, 13, 24, 24, -9, 2, 2, 11, 7, 37, 35, 11, -20, -13, -19, 21, 16, 10, 13, 12, 2, 2, -6, -13, -11, -17, -1, -2, 7, -7, 22, 0, 7, -3, -11, 5, 27, 28, 43, -4, -36, -29, 2, 6, 31, 9, 7, -13, 1, 2, -8, 0, -16, 4, -1, 1, 16, 17, 12, -12, 0, 24, 33, 21, 28, 40, 11, -19, -37, -35, 7, 27, 7, 11, 0, 1, 0, 3, -8, -19, 4, 0, 1, 10, -4, 5, -19, 18, 27, 6, 23, 25, 40, 28, 2, -36, -45, -11, 6, 24, 12, -18, 4, 12, -2, 21, -11, -15, 1, 8, 6, -11, 1, 11, 5, 21, 6, 29, 13, 36, 32, -10, -34, -40, -36, -35, -7, 4, 18, 9, -2, -4, 15, 12, 2, -16, -5, -1, 5, -1, 6, 8, 13, 17, 24, 10, 32, 28, -18, -62, -49, -62, -24, 8, -16, -8, 12, 11, 16, -11, 10, 6, -14, -29, -8, -15, 6, -9, 16, 17, 6, 13, 29, 48, 22, 7, -46, -73, -83, -73, 0, 23, 3, -18, -7, -4, -20, 3, 0, -9, -10, -12, -3, 9, -5, -17, -14, -22, 17, 13, 6, 12, -13, -38, -59, -59, -101, -52, 2, 33, 12, -6, 10, -20, -23, -22, -13, -25, -33, -11, 6, -2, -3, 10, -8, -7, -1, -1, -18, -16, -8, -42, -50, -88, -71, -2, 16, 20, -1, 7, -6, 1, 11, 8, -27, -34, -31, -5, 2, -4, 5, 6, -16, -3, 15, 10, -2, -29, -10, -27, -61, -59, -39, -10, 2, 5, 21, 20, 5, 0, -23, -27, -30, -46, -23, 3, 0, -9, -11, -7, 10, -10, -24, -16, 2, -19, -8, -34, -38, -28, -3, -5, 0, 27, 24, 5, 16, -4, -17, -12, -53, -21, 1, -10, 2, 3, -17, 11, 14, -18, -6, 9, -6, -17, -15, -28, -29, -5, -16, 5, 16, 24, 10, 23, 24, 15, -12, -10, -39, -21, -15, 5, -17, 5, 11, -10, -9, -3, -13, 19, 7, -15, -11, -13, 9, -13, 3, 7, -15, 3, 10, 8, 35, 8, 18, -11, -39, -5, 3, -19, -16, -18, 0, 7, 2, 1, -21, -7, 11, -19, -23, -4, -22, -19, -14, -6, -14, 2, 3, 15, 20, 12, 5, -9, -38, -17, -15, -6, 16, -18, -12, 10, -4, -16, 0, 10, -6, 8, -23, -22, 0, -15, -6, -17, -12, -9, 3, -7, -4, -16, -23, -24, -6, -21, -17, 3, -9, -16, 12, -4, 4, 9, -3, -6, 6, -10, 3, 6, -9, 0, -11, -13, -9, 4, -12, -6, 7, -7, -18, 6, -17, 2, 11, -10, -12, 1, 15, 3, 7, 9, -5, -17, 7, -6, -9, -1, -23, 3, -21, 4, -40, -12, -8, -14, -5, -7, -9, -1, -11, 13, 12, -12, 9, 16, -8, 8, -17, 1, -6, 0, 4, -9, -1, 15, 11, 3, 1, 7, 6, -9, 0, 3, 14, -5, 5, 0, -5, -14, -5, 13, -16, -11, 2, 20, 12, 21, 17, -2, -9, -3, 0, -4, 24, -6, 3, 17, 7, 5, 3, 3, -8, 18, 21, -3, 6, 11, 8, -3, 0, 3, 20, 21, 16, 23, 25, 24, 20, 12, 16, -7, 17, 26, 9, 18, 23, 22, 17, 5, -7, 12, 13, 21, 2, -4, -8, 21, 1, 4, 14, -2, 1, -2, 18, 5, -2, 21, 0, 23, 14, 34, 26, 12, 4, 6, 25, 13, 8, 0, 29, 15, 16, -2, 10, 18, -9, -2, 9, -4, -3, -7, 19, 17, -4, 1, 17, -2, -3, -15, -15, 2, 22, -4, 11, 8, -15, -6, 21, -5, 9, 29, 16, 9, 6, -3, 21, 12, 22, -2, 15, 25, 23, 5, 7, 5, -11, -8, 3, 13, -10, 10, 16, 5, -20, 5, 3, -4, 15, 9, 15, 16, 19, 18, -9, 15, 20, 15, 5, 18, 12, 22, 14, -3, 1, -8, 10, -2, 6, 28, 19, -10, -11, -9, -5, -1, -16, -10, -10, -14, -3, 6, -9, 14, 2, 12, 11, 14, 7, -5, -15, 4, -12, -2, -9, -16, -15, -1, 4, 17, -1, -15, -19, -10, -16, -16, -20, -2, 1, 12, 18, 2, 7, -8, 6, 5, -16, -19, -12, 20, 9, 5, -21, -13, -6, 0, 2, -5, 18, 4, -7, -31, -30, -27, -24, -10, 5, 24, 2, 5, 16, -1, 18, -15, 3, 4, -10, -1, -5, -20, -32, -38, -15, 21, 1, 26, -6, -19, -31, -47, -21, -25, -33, -10, 18, 18, -2, 14, -13, 7, 6, 11, -9, -11, 6, -25, -14, -31, -25, -7, -3, 44, 32, 12, 5, -41, -19, -44, -42, -32, -31, -31, -5, 7, -2, 19, 19, -1, -2, -18, -16, 2, -7, -25, -24, -15, -30, -10, 21, 59, 37, -6, -28, -21, -32, -35, -42, -30, -44, -33, 12, 22, 5, 7, -9, -8, 2, -26, -3, -28, -28, -29, -7, -20, -8, 23, 39, 38, 35, -14, -39, -38, -6, -16, -11, -17, -29, -33, -12, 7, 0, 5, 17, 1, 2, 4, -18, -7, 16, 2, 0, -12, 22, 29, 27, 8, -7, -12, -45, 1, 2, -6, 15, 21, -14, -11, -11, 4, -3, 7, 16, 18, -18, -11, 11, -10, -1, 25, 6, 10, 34, 17, 28, 34, 16, -4, 10, 12, 26, 42, 22, 27, -7, -21, -17, 4, 23, 17, -1, -4, -4, -15, 17, 18, 20, 5, 20, -3, 7, 7, 13, 26, 3, 14, 2, 47, 45, 45, 15, 7, -5, 3, -6, 10, 19, 22, 9, 2, -13, 5, 12, 19, 34, 2, -20, -11, 17, 35, 18, 26, 5, -17, -8, 20, 19, 29, 1, 2, -16, -1, -5, 21, 6, 15, -3, 7, -16, -4, 14, 5, 15, 7, -29, 11, -8, 36, 38, 23, -14, -21, -18, -18, -3, 8, 14, 8, 10, 9, 6, 15, -1, 1, 5, 2, 3, -16, -9, -3, -16, -15, -18, -11, -11, 25, 40, -10, -23, -24, -5, -25, -1, 8, -6, -8, -21, -11, -13, -9, 0, 8, 6, -8, -8, -29, -15, -23, -15, -17, -16, -17, 9, 23, 22, 21, 3, 1, -1, -5, -1, -3, 4, -4, -9, 9, 21, -6, 18, 7, 15, -10, -7, -10, -21, -26, -34, -51, -29, 1, -3, 15, 8, 27, 10, 6, 19, -13, -6, -23, -14, -5, -23, -13, 21, 21, -2, 19, 9, 22, -22, -7, -11, -2, -15, -39, -30, -23, 11, 9, 41, 14, 22, 17, 39, -18, -4, -3, -9, -12, -23, -16, 11, -2, -5, 7, 6, 26, -5, -14, -16, 1, -9, -7, -27, 5, -4, 0, 17, 25, 29, 25, -1, 1, -10, -35, -17, -16, 2, -11, -9, -7, 10, 11, 1, 16, -7, 29, 1, 5, 2, -20, -9, -9, -22, -18, 2, 6, 2, 6, -5, -13, -2, -26, -18, -28, -3, 17, 16, 13, 4, 16, 5, -6, 21, 10, 12, -15, -30, 8, 7, -1, 8, 26, -15, -4, 1, 12, 14, 3, -6, -12, 0, 9, -10, 12, 14, -8, -4, 4, 11, -8, -3, 6, -10, -1, -16, -15, 7, -3, 12, -3, -8, -11, -6, -11, 9, 14, 16, 16, 20, 16, -2, -9, 6, 21, 2, -2, 22, -6, -2, 0, -13, -22, -21, -19, -7, -11, -19, -15, -9, -12, -23, -27, -3, -3, 3, 14, 2, -2, 14, 8, 23, 15, 0, -6, 16, 2, 19, -1, 0, 3, -17, -16, -2, -13, -32, -16, -43, -14, -39, -22, -16, -13, -14, 4, 21, 0, 16, 22, -4, 18, -7, 9, -9, 19, 13, 22, -8, 13, -3, -10, 16, 6, -8, 15, 2, 10, 13, -3, 10, 23, 4, 9, 22, 9, -8, 0, 6, 15, -16, -17, 0, -5, -3, -11, -7, 2, 9, -15, -4, 1, 2, 11, -19, -10, 8, -8, 9, -14, -15, -2, -18, -14, -13, -12, 4, 8, 6, -16, 2, 8, -21, -3, -8, 10, -18, -4, -2, -20, 1, -18, 12, -17, 6, -1, -18, 3, -10, -20, -20, -19, -4, -18, 3, -15, 1, 9, -13, -19, -13, -21, 3, -7, -3, 6, -1, 7, -16, -13, -26, -8, -23, 1, -4, -26, -14, -2, -21, -16, 13, 12, -14, -15, -11, 6, -12, -11, 6, -13, -15, -22, -7, -30, -15, -10, -20, -8, 0, -26, -10, -17, -22, -15, -20, -36, -22, -2, -1, -6, -17, -2, 9, -11, 6, -13, -14, -5, -18, -22, -15, -50, -29, -57, -37, -42, -15, -5, -2, -5, -2, -29, -26, -31, -22, -31, -6, -20, 2, 1, -17, 8, -4, -2, 8, -13, -13, -38, -51, -39, -16, -31, -29, 2, -14, -6, 4, -12, -7, -11, -15, -20, -15, -36, -26, -23, -1, 9, -21, 4, -5, 1, -14, -19, -23, -17, -37, -48, -17, 3, -4, -22, -21, -11, -22, -20, 2, -3, 1, -5, -8, -9, -34, -17, -23, -6, -14, 3, 4, -10, -10, -11, -29, -1, -10, -12, -17, -22, 3, -4, -17, -15, -16, 5, 17, -15, -8, 3, 19, 3, 7, -19, -26, -14, -7, -13, 5, 18, -10, -14, -21, -18, -30, -31, -14, -3, 20, 3, -1, 8, -11, 22, 16, 24, -5, 0, 19, 45, 19, 0, 9, 4, -14, 3, -1, 6, 21, 8, 11, -5, -30, 10, 11, -21, 21, 6, 14, -2, 5, 4, 22, 15, 0, 21, 29, 11, 36, 7, -4, -12, -19, -1, 26, 7, 25, 7, 17, -4, -31, -5, -5, 20, 22, 46, 29, 12, 22, 8, 9, 24, 13, 21, 15, 23, 32, -4, -1, -15, 9, 11, 1, 21, 9, -9, 16, 24, 14, 16, 15, 16, 5, 42, 43, 1, 11, 15, 26, 3, 22, 34, 40, 22, 44, 2, -5, -11, 5, 1, 22, 11, 13, 4, 22, 18, 8, 19, 9, -5, -12, 6, 6, -6, 0, 14, 8, 4, 2, 16, 28, 39, 42, -2, 4, 0, -16, 0, 4, 2, 12, 7, 3, -5, 0, 2, -5, 4, 1, -13, 0, -3, -18, -14, 12, 11, -2, 2, 13, 21, 19, 17, 8, -12, 0, 5, 0, -7, -17, 0, 8, 0, -27, 9, 9, 9, -24, -34, -38, -35, 3, -12, 4, 5, 3, -14, 6, 20, 22, 10, 2, 11, -13, 6, -17, -8, -35, -19, -11, 11, 11, 5, 23, -6, -23, -15, -24, -41, -22, -9, 19, 9, 15, 14, -6, -2, 20, 4, -15, 6, -7, -11, 10, 1, -17, -20, -12, 7, 32, 26, 9, -5, -11, -49, -52, -36, -37, -12, 2, 1, -10, -19, 3, 8, 14, -6, -6, -11, -17, -2, 3, -1, -7, 13, 14, 21, 17, 24, 32, 25, -15, -38, -31, -38, -20, -32, -24, -18, -14, -10, -1, -12, 26, -3, -11, -10, 2, 9, -19, -18, -24, -9, -6, 27, 21, 14, 8, 16, -40, -58, -65, -27, -24, -36, -21, -11, -19, -24, -19, -2, 1, -15, -10, 5, -1, -8, 2, -28, 3, 2, 22, 17, 35, 14, 17, -14, -33, -38, -23, -35, -19, -27, -8, -26, -30, -6, -13, -27, -20, -6, -19, -3, 11, -14, -22, -18, -29, 4, 20, 29, 33, -7, 0, -16, -34, -27, -43, -37, -44, -18, -19, -33, -16, -6, -18, -32, -15, -8, -1, 6, 11, 8, -17, -17, -19, 17, 29, 17, -2, -12, 10, 1, -40, -38, -25, -28, -20, -21, -15, -27, -32, -27, -17, -25, -16, -5, 5, 5, -5, 11, -22, -31, -23, 20, 56, 48, 17, 3, 24, 14, -12, -14, -12, -34, -20, -17, -34, -16, -29, -11, -15, -1, -2, -18, 11, -18, -14, -13, 10, -1, 6, -2, 15, 15, 21, 32, 30, 27, 31, 23, 10, -20, -21, -21, 1, -4, -28, -10, -20, -20, 9, -7, -9, -12, 13, -12, 3, -8, -2, -20, -12, -7, 4, 20, 26, 8, 21, 35, 5, 1, 18, 11, 15, 4, -16, 2, -7, -5, -5, 13, 10, -16, -1, 10, -14, 13, -4, -39, -26, 1, -31, -20, -5, -7, 3, -4, -9, 4, -9, 17, 2, 25, -19, -3, 9, -7, -12, -4, -12, -14, -13, 9, -14, 12, -15, -11, -27, -19, -11, -21, -26, 0, -22, -3, -8, -12, 18, 8, 20, -1, -14, 9, -10, -21, 8, -17, -18, -11, -11, -13, 9, -8, 2, 1, 10, -7, -1, 5, 4, 0, 3, 11, 5, -13, -12, -10, -12, 11, -1, 14, -14, -2, 12, -4, -4, -8, -15, 8, -13, -15, -6, 13, -5, 0, -4, -12, -10, 0, 14, 7, 16, -13, -10, 12, 3, -15, -14, -16, 3, -16, 13, -11, 5, -13, 8, 4, -10, -3, -13, 14, -4, -8, -4, 16, 6, -16, -9, 8, -5, -10, -12, -11, 1, -9, -6, -3, 11, -13, 8, -11, -13, 6, 11, -5, 7, 5, 12, 11, -9, -12, 2, -4, -14, 8, 8, 6, 10, 8, -3, 5, 14, 14, 21, 11, 11, 14, -15, -13, -5, 10, 12, 12, -16, 11, 6, -1, -6, 8, -7, -16, 3, 7, -25, 4, 4, 7, -7, -11, 16, -9, 15, 11, -8, 0, 13, 8, 12, 8, 16, 4, 12, -17, -15, 6, -6, -12, -26, -12, -40, -11, -24, -11, -22, -5, -30, -4, 4, 6, -1, 5, 9, 0, -11, 6, 5, 8, -16, 4, -15, -11, -7, 5, -20, -5, 8, -4, 1, -14, -17, -9, 10, 6, -4, -32, -1, -9, -5, -4, -15, 12, 2, -12, -14, -16, 2, 7, -8, 13, -3, 8, 2, 14, 3, -13, -11, -11, -8, -17, 2, -2, -21, -4, -17, -32, -17, 4, -11, -25, -26, -26, 15, 13, -9, -17, -15, 0, 0, -13, -19, -4, -18, -8, -6, 16, -3, -3, -25, 1, -6, 7, -20, -8, -17, -21, -13, -23, 5, 8, 15, 16, 1, -1, 12, -5, 11, 16, 1, -21, 11, -6, -5, 12, -6, 0, -4, -21, 9, 11, -3, 9, -9, -17, -23, -16, -14, -16, -4, -1, -4, -15, 10, 15, 1, 19, -10, 8, -17, -8, 13, -9, 2, 6, -13, -16, 3, 11, -5, 19, -11, -4, -23, -21, -4, -14, 5, -4, -18, 6, -10, -9, -6, -16, -8, -1, 12, 10, -6, 4, -1, -6, -21, -8, -9, 1, 4, 0, 18, 2, -25, -9, -23, -29, -7, -5, -1, -16, 12, -15, -2, -36, -21, 2, -3, 3, 3, 20, -2, -25, -24, -17, -11, 7, 21, 20, 8, 8, 13, -30, -37, -30, -21, 12, 8, -17, 2, 5, -28, -28, 10, 2, 27, 19, 7, 17, -2, 2, -14, -1, 10, 30, 30, 24, 6, 15, 13, 17, -6, -34, -4, 15, 13, 7, -17, -9, -7, 8, -7, 17, 21, 1, 14, 51, -7, -2, -12, -23, -6, 4, 1, 10, -7, 14, 4, 3, 8, -16, -7, 4, 16, -7, -8, -19, -8, -11, -1, 2, 17, 14, 13, 47, 8, -2, -22, -21, 1, 6, 35, 38, 24, 12, 9, 5, -16, -31, -9, 10, 8, -10, 0, 1, -9, -4, 14, 1, -4, 13, 30, 42, -9, -9, -49, -27, 2, 29, 42, 21, 14, -3, 18, 12, -4, 0, -17, -12, -10, -5, -18, -14, -19, -4, 15, 13, 10, 17, 4, 17, -27, -36, -43, 10, 6, 43, 44, 37, 30, -7, 12, -25, -9, -15, 6, -14, -1, 10, -20, -27, -9, 1, 1, -4, 28, 31, 25, 4, -30, -31, -17, 11, 30, 39, 28, 29, 8, -12, -5, -9, -23, -10, 7, -17, 10, 5, -12, 0, -7, -19, -6, -6, 6, -8, 16, -10, -8, -27, 3, 10, 1, 11, 14, 1, -18, -20, -29, -52, -17, 6, -11, 4, -3, 7, -3, -23, -23, -29, -22, -12, -21, -12, -24, 19, 10, 2, 18, -5, 15, 7, 12, -15, -34, -36, -22, -37, -31, -6, 13, -5, -5, 15, -15, -14, -21, 2, -39, -45, -17, -32, -21, 10, 24, 16, 4, -16, -6, -3, -30, -24, -30, -37, -47, -13, -11, -21, 12, -7, -13, 13, -5, 1, -17, -27, -18, -21, -5, -27, -6, 1, 6, -7, -1, -25, 4, -27, -15, -15, -20, -15, -36, -33, -9, -21, 17, -14, -4, -17, -7, -24, -37, -12, -3, -11, 6, -7, -7, 12, 9, 16, -3, 7, -15, -10, -35, -24, -18, -25, -13, -9, 2, -1, 12, 2, 4, 6, 0, -4, -28, -22, -27, -14, 3, -6, -6, -2, -2, -20, 1, 10, -2, -22, -25, -9, -19, -23, -25, -26, 2, -4, 12, -6, -6, 15, 11, 3, -9, -10, -1, -11, -21, 6, -22, -2, -6, -4, -32, -1, 15, -1, 3, -21, 11, -11, -4, -13, 2, -5, 8, 5, 8, -13, 8, 11, 0, 18, -17, 8, -12, -5, 10, 16, -10, -19, -1, 1, -7, 0, 11, -25, -19, -8, -20, -15, -9, -14, -8, 16, -16, 0, -5, 13, 4, -9, -3, 15, -7, -4, 28, 9, 2, 12, 30, 15, -8, -11, -2, -15, -5, 4, -8, 7, 13, 1, -4, 6, 8, -8, 0, 14, 6, 11, -7, 7, -5, -9, 2, -4, -7, 9, 10, -3, -12, -2, 1, -12, -12, 6, 6, 9, -15, -7, 5, 14, 4, 17, 11, 10, 3, 4, 11, 1, 4, -2, 13, 3, 7, -8, -9, 14, -6, -2, -6, -12, 16, 9, -16, 2, -3, -8, -10, 0, 4, 0, 6, -9, 5, -9, 14, 16, 12, 4, 6, -8, 11, -15, 8, 10, 19, -8, 10, 10, 1, -7, 8, 9, 15, -14, 0, 18, -9, 7, -7, -12, 10, -3, 0, -14, 16, 13, -1, -7, 13, 11, 22, 17, 40, 11, -6, 4, -19, -13, 11, 5, 3, -14, 4, 12, 7, 6, -11, -11, 16, -8, -8, -11, 10, 22, 20, 11, 39, 27, 66, 58, 64, 56, 49, 21, 17, -23, -24, -8, -23, 17, 11, 12, 5, -13, 9, -8, 9, 10, 19, 14, 22, 4, 25, 25, 26, 14, 55, 76, 63, 74, 65, 36, 31, -5, -12, -30, -33, -23, -15, 1, 1, 9, 17, 0, 2, -14, -9, -6, 3, 5, 1, -10, -10, 13, 22, 35, 51, 31, 57, 48, 23, 21, 21, -18, -40, -21, -15, -14, 1, 8, 4, 14, 5, 6, 2, -21, -13, 10, -3, -16, 2, -1, 20, 28, 38, 35, 59, 34, 31, 20, -3, -29, -19, -8, -15, -11, 11, 9, -8, 8, -6, 7, -7, -10, -9, -5, 6, -20, -34, -38, -1, -12, 16, 27, 23, 33, 15, 13, -2, -13, -21, -7, -12, -10, 5, 18, 2, -15, -16, -12, 9, 2, 5, -4, -23, -34, -34, -41, -47, -14, 17, 26, 18, 33, 25, -11, 15, -8, -30, -22, 17, -9, 16, 5, 0, -2, -16, -29, 0, -24, 3, -35, -29, -27, -37, -84, -75, -19, 20, 30, 22, 19, 27, 12, 3, -29, -41, 6, 1, -6, 3, 11, 13, 14, -5, -17, 5, -28, -31, -41, -33, -49, -53, -67, -81, 12, 44, 49, 40, 10, 8, 7, -11, -11, -28, 0, -10, -2, -10, 0, 6, -4, -22, -9, -23, -17, -38, -37, -25, -16, -39, -38, -29, 9, 21, 45, 32, 37, 30, -6, -18, -27, -20, 2, -7, -7, 15, 17, 4, 7, -15, -24, -37, -14, -25, 2, 5, 9, -11, -11, 23, 17, 31, 17, 37, 19, 1, -27, -41, -34, -6, 14, 15, -14, 18, 4, -15, -10, -9, -8, -10, -9, -14, 2, 11, 24, 10, 2, 9, 12, 13, 11, 6, 3, -1, -16, -11, -17, -18, 0, -14, 14, 18, -8, 8, 21, -3, -7, 18, -1, 0, -11, 13, -8, -1, 1, -8, -3, 6, 27, 25, -6, -5, -23, -20, -3, 3, -13, 2, 3, -12, -6, -13, 11, 23, 28, 8, 10, -32, -12, -30, -25, -44, -38, -18, -9, 7, 9, -17, -5, -8, -30, -32, -18, -15, 7, 16, 4, 10, 17, -3, 38, 20, 21, -14, -20, -50, -31, -27, -35, -48, -29, -18, -9, 5, -3, 0, 11, -2, -37, -38, -11, -2, 2, 4, -6, 8, -6, 6, 31, 32, 9, -1, -14, -21, -31, -39, -20, -17, -8, -13, -4, 6, -15, 1, 2, -44, -14, -28, -38, -8, 12, 20, -4, 14, 5, 15, 47, 16, 10, 5, 15, 7, 0, 12, 15, 8, 20, 25, -1, -11, -6, 15, -8, -10, -29, -28, -19, -16, 4, -12, -7, 8, -14, 12, 10, 11, 10, 15, 8, 26, 26, 35, 52, 47, 66, 16, 13, 16, 4, 11, -16, -31, -39, -17, 13, 21, -6, 8, -7, 10, -6, 0, 30, 3, 15, 32, 17, 20, 43, 34, 58, 35, 39, 25, 11, 28, 28, -1, -1, 0, -10, 14, 2, 7, 22, -12, -10, 6, -2, 11, 12, 13, 18, 8, 10, 33, 25, 31, 23, 13, -13, 16, -10, 2, 23, 3, 7, 9, 1, 0, 6, 13, 14, -8, -3, -12, -6, -10, 27, 35, 34, 13, 10, 13, 9, 14, -17, -13, -24, 3, 4, 11, 16, 8, 39, 11, 15, 18, 13, -8, 18, 2, -5, -13, 12, -3, 7, 31, 27, 19, 10, 10, 17, 18, -15, -10, -25, -8, 3, -4, 21, 32, 28, 2, 17, -6, 0, 19, 18, 18, -10, 1, 12, -13, 3, 7, 22, 11, 28, -9, -3, -4, -35, -23, -9, -28, 10, 28, 22, 18, 12, 13, 8, 18, -5, 16, 9, 7, -8, 18, 7, 6, -15, 8, 14, 10, 0, -7, -2, -35, -13, -18, -21, -4, -1, 9, -8, 13, -9, -14, 2, 2, 6, 12, -12, -10, 7, 1, -11, 4, -12, 12, -2, -11, 16, -5, 9, -7, 5, 9, 15, -12, -4, -9, 9, -2, -12, -1, 17, -15, -13, 2, 3, 0, 14, 5, -14, -4, 16, 4, 15, -9, 0, 4, -7, 17, 8, -5, 17, -5, 9, -15, -4, 12, -10, 10, -4, -4, -11, -12, 0, 16, 18, -12, -8, -2, -18, 5, -14, 5, -11, -8, -18, -9, -8, -21, 5, 5, -9, -5, -13, 5, 1, 6, 6, 8, -8, -14, 10, 5, 8, 9, -9, -6, 5, -3, -16, -22, -21, -2, -12, -16, -13, -2, 8, -22, -19, -19, 1, -6, 6, 7, -1, -7, -18, -17, -23, -9, -20, 0, 10, 5, -16, -21, -3, 4, 2, -16, 5, -6, 6, 12, 3, 14, -2, -8, 2, -5, 11, -16, -10, 16, -5, -5, 9, 10, -8, 8, -24, -19, 3, -18, -6, 13, -8, 23, 18, -1, 14, 28, 21, 11, 25, 18, 16, 17, 12, 32, 15, -1, 10, -10, -20, 3, -15, -10, -15, -6, -17, -16, -4, 4, 9, 15, 6, 31, 18, 10, -2, 1, -6, 31, 27, 5, 7, 4, 16, 20, 4, 7, 13, -15, -7, -20, -5, 8, 12, 18, 26, 35, 36, 22, 19, -2, -7, 2, -14, -12, 8, 27, 20, 26, 38, 16, 16, -8, 20, 11, 5, -3, 7, -6, -22, -16, 15, 16, 5, 12, 7, -2, 9, 16, -1, 6, 13, -4, -7, 13, 8, -15, 4, -4, -13, -21, 0, 1, -11, -13, -8, -16, 1, -20, -10, 30, 19, -7, 1, 21, 14, 6, 1, -4, 0, 1, -23, -33, -17, -30, -36, -29, -6, -28, -14, -18, 7, -15, 2, -22, -18, -6, -13, 32, -6, 5, 10, -7, 8, 7, -13, -16, -1, -21, -49, -37, -32, -16, -11, -8, -35, -19, -30, -22, -4, -17, -14, 3, -4, -18, 7, 30, 10, 7, -3, -2, -11, -32, -13, -23, -12, -18, -43, -24, -22, -34, -2, -7, -15, -3, -8, -34, -4, 7, -10, -3, -16, 9, -6, 23, -20, -24, -30, -32, -26, -35, -21, -40, -26, 2, -9, -3, 8, 6, -4, 7, -18, -2, -10, -13, -12, -9, -19, -19, 2, -1, -15, 17, -25, -24, -27, -30, -13, -2, -1, -1, 28, 32, 15, 8, -11, 5, 10, -18, -15, -24, 5, -10, 0, -10, -6, 9, -8, 2, 3, -7, -11, -20, -22, -17, -16, -13, 5, 27, 24, 31, 20, 16, -11, 2, -25, -14, 2, -14, -18, -27, -1, -11, -6, -22, -19, 3, 16, -21, -22, -23, -16, 21, 4, 11, -12, 1, 45, 24, 18, 1, -2, 2, -19, -11, -5, -16, -5, -15, -9, -15, 0, -9, 7, 8, -2, -19, -20, 14, -12, 20, 15, -10, 8, -4, 36, 36, 3, 17, -5, -14, 2, -8, 2, -11, 1, 8, -12, 3, -22, -9, -8, -4, 15, -9, -23, 18, 20, 2, -14, -21, 1, 2, 25, 36, 8, -9, 7, 21, 23, -6, 0, 11, -4, 16, 16, 2, -21, -7, -1, -21, 12, 0, 2, 22, 16, -10, 10, -20, 9, 6, 26, 8, -9, -6, 0, 4, 29, 37, 32, 26, 4, 11, 4, -11, -15, 10, -11, -2, -3, -12, -8, 20, -12, -7, -14, -40, -24, -5, 10, -28, -29, -3, 0, 12, 25, 9, 24, 17, 21, 24, 19, -5, 10, -15, -7, -8, 21, 21, 14, 3, 12, -7, -15, -31, -13, -20, -27, -43, -18, -9, 8, 3, 9, 42, 18, 41, 23, 1, 18, -5, -14, -11, -17, -21, 0, 1, 6, 26, 20, 19, 17, -3, -1, -4, -12, -6, 7, 12, 21, 6, 27, 16, 27, 31, 39, 18, -14, 7, 4, -23, -13, 14, 2, 8, 18, 10, 41, 20, 27, 11, 26, 1, 0, -4, 24, 16, 18, -1, 24, 27, 14, 37, 31, -10, 8, 6, -5, 5, -4, 16, 14, 1, 3, 14, 29, 25, 32, 26, 16, 36, 19, 29, 12, 19, -2, 25, 19, 37, -1, 26, 3, 7, -7, 0, -22, -1, 2, 2, 8, 5, -3, 7, -2, 9, -11, 20, 12, 19, 13, -5, 9, 13, 16, 1, 0, -1, 10, -15, 5, -9, -13, -23, -5, -4, 5, -2, -4, 29, -12, 0, -3, -24, -6, -12, 1, -4, -24, -27, 5, -18, -12, 5, -10, 13, -24, -11, -3, 0, -17, 9, -8, -10, 4, 11, 5, -6, -16, -13, -13, -9, -10, -17, -26, 4, 4, -7, -22, -25, -17, -12, -17, -8, -10, -29, -18, -7, 5, -23, -17, -12, -11, -18, -23, 5, -10, -17, -13, -19, 11, -2, 14, 17, 3, -6, -3, -1, 0, -4, -19, -30, -13, -15, -22, -1, -3, -6, 8, -3, -4, -24, -13, 1, 9, -8, -1, -6, -25, -20, -7, -5, -23, -24, -24, -17, -19, -12, -2, 4, -14, -1, -4, 7, 8, -5, -10, -18, 8, -7, -11, 5, -21, -7, -12, -6, -24, -16, -15, 6, 4, -10, -11, -14, -23, -20, 3, -6, -2, -13, -17, -21, -19, 9, -8, -1, -6, 0, 1, 12, 17, 3, 20, 14, -10, -9, 9, 8, 1, -8, -4, 14, 11, 11, -7, -4, 0, -8, -4, 21, 7, 17, 8, 2, 19, -5, 7, 14, 8, 22, 1, 0, 5, -5, -3, 17, 14, -11, 16, -2, -1, 22, 19, 7, 17, 6, 6, 5, -4, 11, 12, 0, 13, 13, 19, 1, 9, 17, -1, 8, 13, 2, 19, 2, 8, -3, -5, 11, 18, 15, 9, 10, 5, 20, 20, -3, -9, -10, 16, -12, -12, 1, 21, 15, -12, -3, -13, -5, -29, -26, -18, -43, -59, -30, -12, -30, 15, 30, 37, 32, 38, 44, 23, -8, 12, 13, 17, -8, -11, 20, 15, 12, 10, -2, 5, -40, -21, -44, -54, -47, -46, -38, -20, -6, -19, 12, 32, 25, 30, 14, 38, 27, 15, -4, 13, 19, 2, -4, 19, 12, 8, -2, -13, -31, -37, -47, -51, -50, -45, -25, -12, -39, 13, 21, 17, 26, 5, 18, 42, 13, 26, 13, 5, 21, 2, 18, 13, 8, -16, -20, -11, -30, -57, -73, -61, -33, -16, 2, 24, 2, 19, 40, 31, 54, 20, 24, 27, 26, 21, 23, 22, 8, -2, -5, 11, 12, -25, -8, -36, -38, -52, -62, -55, -3, 7, 13, 22, 43, 29, 38, 23, 50, 48, 40, 44, 34, 11, -7, 13, -2, -6, -13, -11, -17, -16, -32, -34, -39, -62, -54, -22, 18, 19, 29, 26, 26, 6, 18, 5, 9, 25, 4, 5, 20, 19, 4, -4, -11, -4, 2, -11, -5, -14, -45, -48, -49, -62, -27, 36, 30, 51, 32, -11, -5, -20, -8, -2, -11, 15, -8, 14, 55, 49, 30, -11, 4, 15, -2, 6, 0, -23, -43, -54, -52, -38, 21, 22, 45, 25, 18, -12, -44, -14, -22, -20, -34, -18, 5, 34, 57, 20, 19, 18, 12, 8, 11, 3, -17, -38, -70, -77, -55, -30, 11, 21, 41, 18, 24, -13, -32, -22, -11, -29, -35, -27, -11, 31, 33, 18, 19, 14, 20, 15, 10, 1, -14, -25, -51, -44, -42, -16, 22, 18, 24, 27, 22, 27, -15, -16, -33, -45, -19, -47, -18, -10, -6, -18, 11, 9, -11, 7, -1, 13, -16, -37, -53, -29, 12, 4, 13, 16, 41, 40, 13, 28, -6, -14, -45, -25, -33, -46, -61, -36, -41, -22, 7, 10, 21, 1, 18, 9, -4, -26, -32, -18, -17, -9, -9, 22, 11, 34, 24, 19, 11, -20, -46, -41, -34, -43, -57, -56, -37, -27, -21, -10, 12, 0, -6, 8, -7, -18, -22, -19, -20, -2, 8, 9, 2, 25, 25, -2, -1, 11, -19, -32, -15, -56, -59, -43, -37, -5, -3, 15, 2, 1, -2, -4, -4, -10, -16, -9, -16, -33, -3, 12, 2, -5, -5, 16, -6, -4, -6, -31, -29, -69, -55, -29, -25, -31, -22, 3, 7, 12, -11, -12, 9, -6, -6, 16, -20, -10, 14, -13, -13, -7, -22, 23, 14, 20, -1, -41, -52, -52, -35, -21, -33, -25, -20, -8, 10, 0, -1, -9, -27, -2, 12, 20, 5, 2, -8, 19, -1, -18, 16, 33, 33, 6, -11, -42, -63, -59, -49, -37, -40, -12, 7, 6, -6, 7, 2, -38, -34, -7, 16, 14, 5, -5, 25, 11, 11, -2, -7, 35, 37, 16, 0, -46, -38, -46, -30, -28, -8, -9, 1, 12, 13, 3, -1, -35, -52, -30, -12, -18, 8, 14, 2, 23, 5, 6, 0, 17, 9, 3, -31, -54, -60, -50, -45, -4, 6, -1, 5, 8, -12, 17, -6, -29, -18, -33, -11, -1, 5, 6, 10, -1, 30, 31, 4, 12, -12, 2, -25, -50, -59, -35, -37, -12, 6, 2, 2, 13, -9, 13, 4, -16, 7, -30, -36, -8, -17, 15, 5, 25, 34, 25, 21, 21, -12, -12, -55, -48, -39, -11, -2, 16, -8, 11, -2, 8, 7, -8, 3, 7, -18, -26, -24, -13, -4, 17, 13, -2, 28, 5, 2, 9, -4, -32, -57, -27, -32, -3, 0, -5, -11, -12, 3, -7, 14, 7, 21, -3, -9, -8, -33, 7, 10, -7, 14, 0, 28, 28, 11, 23, 28, -34, -22, -29, -7, -2, -8, 9, -7, 11, -1, 9, 0, 16, 2, 2, -1, -6, -13, 1, -7, -9, 4, -7, 3, 5, 26, 5, 38, 23, -6, 10, 20, 8, 2, 20, 12, 2, -12, -4, -1, 3, 3, -6, 18, -3, 19, 23, -8, 1, 15, 13, 17, 25, 26, 28, 6, 29, 24, -7, 20, -3, 6, 22, 18, 8, -2, 17, -12, -12, 8, -12, -9, 15, -11, 10, 0, -10, -12, 16, 12, 1, -3, 17, 20, 16, -5, 9, 20, 19, 13, 2, 18, -8, -8, -5, -21, -6, 6, -3, 9, -15, 4, -21, 10, 8, 8, -10, -7, 7, 9, 0, -8, -12, -2, -14, 0, -7, -13, -16, -3, -9, -7, -22, -23, -4, 4, 7, -18, -6, -13, -13, -9, -6, -6, -20, -7, 7, -18, -1, -21, 5, 3, -3, -18, -8, -2, -7, 0, -16, 2, 0, 7, -6, -12, -7, -7, -11, -15, 4, 0, -11, 0, -17, -26, -36, -38, -16, -21, -21, -7, -14, -15, -7, -17, 8, -14, -3, -17, 8, -13, -5, -1, 3, -1, 6, -10, 9, -7, -21, -5, 9, 9, -15, 3, 12, 14, 16, -19, -6, 3, -14, -4, -22, 9, -6, -20, -4, -11, -18, -9, -14, 1, -6, 3, -14, 6, -1, 13, 34, 2, -18, 5, 4, 6, 9, 14, 1, -12, -22, -11, -15, 12, -18, -8, 4, 7, -6, -12, 8, -15, 5, -15, 11, 21, 6, 13, 15, -4, -2, 3, -25, -26, 3, -4, 2, -15, -31, -8, -42, -11, 13, 6, 3, 1, 3, -14, 12, 11, -3, -9, 14, 28, 14, 20, 25, -2, 7, 14, 0, 18, -7, -5, 3, -9, -2, -16, -9, -22, 2, 7, -2, -14, 11, -3, -1, -16, -11, 20, 6, 10, 30, 7, 12, 27, 1, 25, 15, 1, 14, 9, -4, 17, -15, 21, 17, 13, -13, -15, -2, -14, 0, -14, 7, -4, 4, -1, 8, 13, 9, 31, 11, 20, 19, 25, 29, 29, 7, 8, 7, 2, 0, 29, 16, 23, 24, -9, 9, -9, -1, -5, -4, -6, -1, 25, 9, 30, 11, 17, 23, 24, -4, 20, 23, 27, 40, 6, 6, 25, 11, 39, 20, 33, 26, 1, 6, -16, -6, 10, 7, 16, 22, 25, 10, 9, 31, 4, 23, 19, -5, 29, -1, 35, 17, 11, -10, 36, 11, 23, 19, 19, 25, 19, -9, -3, -2, -15, 5, -4, 16, 28, 2, 14, 12, 4, -4, 9, 10, 6, 16, -6, 26, 25, 14, 1, 11, -4, 8, -6, 7, -14, 5, -4, -11, -9, 18, -9, 11, 3, 21, -15, -21, 12, 19, -2, 21, 11, -7, 5, -4, 10, 1, -11, -4, -14, 3, -11, -9, 17, 10, -12, -19, -16, -4, 12, 16, 4, -8, -14, 7, 7, 14, -4, 10, 4, -21, -36, -14, -6, 2, 20, -16, -26, -23, -11, -13, -18, 3, -2, -19, 3, 12, -12, 6, 17, 1, -3, -22, -3, 6, -10, -16, -11, -27, -18, -11, 23, -6, 30, -4, -5, 11, 17, -13, -22, -3, -17, -10, -3, -9, -8, 8, 6, -5, -21, -28, 1, -2, -5, 0, -17, -20, -18, -13, 22, 34, 39, 29, 28, 13, 15, -12, 0, 8, -20, -9, 1, -12, -1, 4, -31, -33, -16, -15, -34, -35, -21, -32, -31, -9, -27, 8, 19, 16, 16, 27, 10, 30, -5, -1, -1, -5, -22, -20, -4, -12, 14, 18, 10, -21, -14, -16, -26, -18, 4, -9, -29, -29, -14, 23, 20, 10, 25, 11, 1, 29, 7, -23, 5, 0, -23, 10, -21, -6, 13, 0, 4, 0, 6, -19, 6, -20, -27, -22, -15, -6, -9, -2, 16, 22, 23, 10, 10, 15, -2, -12, -4, -8, -1, -15, 5, 3, 8, 4, 17, 5, 11, -18, -14, -13, -6, -24, -11, -22, 8, 4, 8, 20, 14, 0, -14, -17, -17, -8, -6, -23, -21, -20, 1, 10, -1, 39, 24, -1, 7, 17, 3, -16, -7, -15, -28, -29, 3, 11, -17, -13, -13, -1, 9, 5, -1, -23, -12, 9, 3, 6, -13, -9, -17, 21, 21, -13, 3, -7, -15, -2, -22, -19, -1, -6, -9, 9, -11, -29, -14, -30, 1, -5, -7, -21, -12, 10, 7, -19, -13, -17, -26, 1, -13, 6, 5, -5, -18, 6, -3, -5, 9, 13, 2, -8, -20, -13, -39, -27, 6, -6, 5, -19, -14, -19, -21, 5, -1, 11, -6, 13, 28, 14, 5, 17, 6, 31, 11, 17, 16, 24, 25, -1, -28, -46, -25, -37, -7, -3, 8, -13, -22, 6, -18, -23, 9, -2, 0, 19, 11, 26, 21, 2, 22, 13, 40, 36, 31, 32, 20, 20, -14, -16, -25, 0, 3, -13, 2, 3, -8, -17, 10, -16, -16, -7, -11, 0, 16, 14, 3, 7, 25, 48, 44, 49, 29, 36, 36, 32, 17, 20, 11, 16, 6, -4, -2, -10, -15, 9, 4, -10, -18, -16, -5, -18, -15, -14, 14, 13, -10, 3, 17, 34, 25, 28, 28, 23, 2, 3, 6, -13, -1, -6, 5, -21, -6, 11, -13, -1, -12, -12, -5, -7, -5, 9, 2, -9, 1, -8, -8, -6, -17, -1, -4, 9, -15, -4, -7, -11, -21, -16, -20, 9, -16, 12, -3, 8, 5, 10, 11, 11, 1, -15, -3, 11, -19, -10, -18, 3, 0, -18, -10, -5, -10, -5, -17, -5, -21, -8, -19, -13, 7, -9, 11, -15, -17, 12, -22, -21, -4, -16, -9, -22, -6, 9, -5, -12, 0, -11, -13, -16, 9, -7, -6, -13, -1, -22, -12, -22, 4, 0, -6, 6, -2, -22, 4, -16, -12, -8, -16, -19, -12, -5, -1, -16, -21, -4, -6, 2, -9, 7, -26, -26, -16, -8, -18, -22, 9, -16, 7, -22, 0, -1, -7, -13, 2, -21, -1, -9, -13, -22, -17, -31, -28, 9, 1, 13, 15, -14, 13, 5, 2, -23, 4, 11, -14, -6, 3, 1, -11, 6, 4, 10, 0, -16, -20, 12, 19, 35, 23, 22, 15, 14, 12, 6, 24, -3, 12, 15, 4, 18, -7, -7, -23, -9, 1, -2, -2, 10, 4, -4, -11, -1, -4, 14, 5, 13, -3, -3, -10, 5, 2, 23, 17, 30, 30, 11, 20, 9, 24, -13, -17, -9, -20, 3, 0, -3, -6, 24, 26, 20, -1, 1, 14, -9, 1, -4, -29, -44, -14, -16, 11, 8, -5, 22, 23, 34, 9, 0, -8, 7, -23, -5, -10, -19, -10, 13, 20, 12, 18, 22, -8, -11, -29, -12, -26, -48, -25, -5, 8, 7, -1, -8, 10, 12, 23, 4, -16, -9, 3, 2, 9, -16, -6, -1, 23, 4, -8, 11, 17, 3, -19, -3, -32, -31, -32, 0, 1, 6, -9, 16, 12, 7, 47, 28, 0, -1, -16, -19, -8, 4, 7, 12, -5, 8, -1, 8, -10, -13, -9, -32, -31, -32, -28, -13, -8, -2, 1, 9, -1, 10, 12, 31, -13, 10, 1, -16, 2, 0, -17, 13, 6, 1, -1, -5, 3, 5, -15, -25, -55, -22, -4, -10, -14, -19, -8, -16, -11, -6, 23, 13, 2, -19, -4, 10, -1, -26, -20, -6, 0, -8, 12, -2, -12, -10, -9, -28, -24, -28, -1, -30, -8, -13, -18, -31, -48, -11, 8, 14, 17, -5, 4, 10, -16, -11, -20, -23, 4, -2, -20, -2, 21, 26, 9, -7, -20, -11, -22, -13, -22, -21, 5, -30, -22, -33, -19, -21, -22, -8, -14, -19, 0, 2, -7, 3, 9, -8, 20, 5, 8, 9, 18, -1, -3, 15, -13, 0, 2, 3, -22, -11, -32, -47, -47, -20, -1, -13, 0, 10, 1, -15, 9, 6, 3, 26, -4, -11, 17, 0, 11, 23, 21, 19, 12, -15, 6, -6, -19, -4, -33, -6, -3, 5, 0, 4, 2, 0, -6, 8, 15, 13, 12, -1, 0, 17, 4, -16, 11, 30, 8, 18, 0, -9, -7, -12, -31, -28, -17, -22, 5, 0, -19, 11, -6, -13, 8, -5, -22, -5, 2, -7, -11, 1, -36, -18, 3, 35, 11, 3, 16, -4, -14, 20, 8, 9, -15, 0, -10, -2, 9, 5, -7, -10, -21, 4, 21, 13, 16, 5, -8, -20, -41, -19, -2, 7, -2, -10, 13, 12, 24, -3, -1, 10, -15, 3, -12, -2, 7, 1, -6, -11, 5, 7, 15, 26, 21, 1, -3, -27, -22, -9, 3, -15, -5, -9, 7, 12, -15, 17, 14, 2, 5, -3, -6, 3, 2, -18, -15, -12, -8, 22, 5, 36, 17, -13, -1, -1, -16, -25, -27, 4, 4, 1, 26, 7, 9, 15, 11, 5, 23, -1, 0, -12, -17, -13, -17, -9, -4, -3, 17, 19, 25, -7, -12, -5, -22, -22, -10, -8, -15, -11, 21, 13, 6, 3, 22, 34, 29, 21, 2, -3, 4, 11, -5, -15, -17, -10, 30, 5, 28, 11, -12, -17, -24, 5, -13, -28, -7, -4, 20, 1, 22, 29, 24, 16, 19, 27, -19, -16, -1, 4, 2, -7, -6, 7, 22, 23, 22, 11, 6, -1, -10, -22, -6, -1, -1, 5, 2, 14, 9, 13, 37, 48, 29, 19, -7, -15, -17, -19, -20, 6, -1, -11, -10, -10, -3, -3, 31, 29, 16, 25, 0, 19, 10, 13, 17, 0, 8, 15, 39, 10, -4, -11, -11, -6, -6, -15, -23, -12, 3, -13, -22, -23, -1, -1, 14, -1, 10, -1, 18, 29, 19, 21, -6, 3, 18, 24, 5, 3, -2, -18, -9, -14, 1, 9, -10, -13, -11, -10, 1, -33, -27, -18, -16, -3, 2, -21, 2, 0, -18, -9, -29, -8, -23, -22, -36, -17, 11, 5, -15, -19, 11, -19, -10, 8, 1, -5, -22, -14, -22, -20, -31, -35, -29, -32, -36, -41, -32, -38, -34, -24, -19, -26, -15, -3, -13, -2, -2, -21, 6, 2, 2, -14, -2, -6, -8, -3, 7, -6, -11, -21, -16, -9, -15, -2, 1, -19, -4, -24, -8, -22, -7, -3, -9, -22, -1, -22, 8, -3, 5, 12, -2, -18, -5, 16, 8, -17, 14, 2, -14, -12, 0, -16, -15, 10, 1, 10, -7, -10, -4, -11, 8, -12, 15, 13, -11, -16, 5, -6, 12, 0, -5, -14, 1, 5, 10, -4, -1, -1, 18, 12, 15, -10, -10, 17, -2, -2, -12, -18, -18, 12, 11, -18, -15, -7, 16, 1, 11, -1, 7, 7, 4, -13, -3, 2, 2, 22, -5, -2, -4, 23, 32, 17, 23, 7, 9, -10, -3, 7, -17, -18, -13, -11, -2, -5, 8, -15, 8, 14, -12, -10, 0, 1, -3, 3, 14, 22, 3, 21, 15, -1, 23, 3, 30, -4, -7, 4, -4, -16, -14, -9, -1, 13, 14, 5, 2, -7, 4, -11, -23, -10, -21, -5, -23, -1, 3, 17, -8, -15, -30, -2, -3, 12, 4, 6, 3, -12, 13, 10, -13, 6, 13, 9, -5, -18, -9, -28, -3, 4, 23, -9, 7, -3, -23, -4, -26, -34, -16, -26, -14, -31, 7, 29, 25, 26, 1, 0, -14, -1, 11, -17, -15, 0, -11, -2, 1, 13, 11, -8, 2, 8, -11, 2, -21, -33, -31, -10, -10, -5, 12, 2, 22, 8, 16, 12, 5, -12, 8, 0, -6, 13, 7, -15, -11, 9, -6, 16, -1, -5, 11, -1, -13, -8, -19, 5, 5, 19, 13, 17, 26, 28, 23, -16, -11, -15, -10, 1, -25, -22, -29, -25, -2, -3, -10, 16, -21, -15, -29, -9, -29, -10, -17, -18, 5, 30, 14, -3, 29, 18, 24, -15, 11, -7, 5, -27, -30, -22, -4, 10, 9, 1, 12, 9, 15, 2, -28, -24, -25, -32, -15, -22, -9, 3, 17, 0, 40, 42, 0, -13, -1, 15, -1, -31, -19, -35, -10, 24, 21, 16, -9, 8, -18, -26, -47, -53, -61, -32, -13, -7, -3, 18, -15, 3, 4, 24, 16, -15, 12, 10, 2, -20, -36, -15, -5, 27, 34, 1, -6, -3, -3, -2, -20, -1, -29, -31, -4, -9, 9, 20, 3, -22, 5, 12, 13, -12, 3, 0, -5, -15, -10, -16, -9, 27, 40, 25, 33, 18, 35, 30, 11, 19, 1, -17, -41, -9, 0, -17, -2, -15, -27, 4, 2, 4, 7, 0, -9, -16, -13, -20, 20, 33, 30, 17, 29, 39, 31, 45, 35, 31, 6, -16, -32, -17, -30, 0, 2, -22, -18, -31, 4, -3, 2, 2, 8, -21, -14, -14, 25, 15, 43, 48, 49, 45, 19, 39, 42, 19, 16, 20, -3, -22, -13, -19, -6, 9, 1, -33, -15, -6, 11, -5, -9, -16, -25, -21, -33, 2, 17, 17, 47, 39, 47, 16, 8, 18, -6, -19, -9, -4, -25, -4, 14, -2, -5, -6, -18, 16, -16, 8, 4, -12, -7, -55, -74, -48, -29, -31, -23, 37, 18, -11, -7, -5, -17, 0, -9, -5, -13, -3, 15, 28, -2, 8, -7, -1, 3, 13, 3, 4, -21, -43, -62, -71, -42, -44, -55, -33, -45, -62, -16, -24, -11, -7, -5, -12, -18, -15, 19, 21, 3, -10, -20, -4, 3, 9, 1, -2, 7, -17, -34, -29, -56, -51, -67, -82, -64, -55, -24, -1, -5, 8, -6, -11, 11, -8, -1, -1, 9, -18, -6, -11, 7, -6, -5, 18, 3, -7, -6, -14, -35, -37, -26, -35, -50, -18, 8, 3, 14, 5, -13, 12, 12, -7, 18, 1, 21, 8, 0, -7, -15, 13, 9, -9, 7, -13, -13, -11, -10, -10, -23, 5, -10, 1, 22, 5, 16, 20, 4, 16, -14, -12, 9, 20, -6, 2, 4, 2, -18, 15, -11, 17, 22, -4, -11, 2, 16, 12, 9, 4, 15, 18, 19, 11, -11, 15, 15, 2, 6, 10, 26, 6, 9, 16, 16, 6, -1, 5, 11, -13, 20, -18, -3, 22, 15, 15, 6, 15, 19, 11, 2, -5, 13, 6, -11, -11, 1, 2, -2, 0, 7, -8, 13, 10, 3, 14, -9, -3, 26, 16, 20, 23, 26, 49, 45, 26, 26, -1, -7, 9, -15, -14, -9, -10, -16, -9, -9, 7, -12, -7, 14, 9, -7, 5, -7, 2, -5, 14, 29, 15, 46, 38, 56, 36, 31, 32, 25, 2, -18, -21, -19, -3, 11, 6, 21, 25, 8, -12, 12, 9, 9, 9, -5, 12, -8, 18, 4, 16, 1, -2, -10, 5, 3, 7, -13, 7, -13, -21, -10, -17, -10, 22, 16, 15, -7, -2, 0, 13, -5, 1, -9, -4, -13, -7, 3, -5, 3, -9, -13, 13, -4, -4, 5, 10, -17, 12, 6, -6, -15, -7, -15, 12, -17, -18, -14, 0, 14, 5, -12, 10, 7, -3, 8, -6, -18, -12, -11, 3, -13, -18, 14, -14, -13, -12, -8, -13, 0, -21, -11, 15, 0, -8, 7, -2, -16, 11, -15, -10, -4, -7, -4, -6, -16, 8, -10, 1, 4, 2, -19, 12, -5, -5, -15, -7, -7, -11, 6, -17, -14, -5, 7, -5, -11, 6, -3, 10, -18, -18, 9, -12, -6, -12, -3, 10, 5, 3, -2, 4, -19, -11, -14, -20, -4, 11, 0, 2, 9, 9, 0, -19, -19, 10, 6, -8, -2, 2, 2, 5, -1, -22, -11, -7, 1, 1, -10, -14, -5, -18, 8, -15, 14, -6, -1, -20, -17, 13, -13, 3, 8, 6, -2, -5, -18, -20, -8, -24, -25, -18, -4, -4, -33, -9, -28, -21, -4, -7, -5, -7, 0, -12, -7, -11, 13, -4, 8, -14, 4, -12, 0, -20, -7, 2, -1, -3, -12, -24, -10, -4, -28, -17, -47, -35, -20, -45, -24, -12, -24, -20, 7, -21, 2, -13, 7, -13, -10, -5, 9, 10, -5, 7, 3, 12, -21, -18, -16, -36, -24, -25, -32, -19, -20, -28, -17, -30, -9, -36, -33, -22, -12, 5, 2, -1, 13, 0, -11, -13, -12, -8, -1, -23, -15, -23, -25, -29, -37, -21, -15, -13, 2, -29, -2, -36, -13, -18, -26, -8, -6, -9, 5, -12, -18, 8, -3, 5, -9, -21, 0, -5, 10, 4, 7, -15, 20, 14, -6, -14, 10, 9, -7, -19, 5, -9, 6, -9, -16, -15, -1, 8, -3, -20, 0, 6, 5, -19, -10, 10, 12, 13, 28, 16, 6, 16, 18, 12, -11, -5, 3, -25, 1, 19, 10, -17, -16, 4, -24, 6, -11, 3, -10, 7, -10, -8, 7, 29, 29, 30, 31, 38, 28, 26, 14, 12, 8, -7, 3, -8, 0, -6, 16, 16, -6, 1, -5, 1, -8, 4, 1, -5, 15, 14, 32, 39, 36, 8, 31, 15, 34, 25, 22, 17, -12, 1, -22, 5, -5, 19, -8, -20, -20, -4, 1, 14, 7, 3, 15, 22, 3, -1, 28, 15, 20, 6, 12, 12, -1, -19, 7, 3, -26, -15, 10, -22, -2, -3, 17, -5, -39, -16, -15, -4, -16, 11, 14, 4, 6, 0, 26, 29, 5, 11, 2, -15, -34, -24, 15, 0, -6, 17, -6, -1, 15, -14, 13, -14, -48, 4, 11, 2, 8, 10, 10, 5, 15, -17, -14, 10, -5, -28, -19, -46, -32, -15, 34, 28, 4, 24, -2, -4, 5, 13, -13, -38, -46, 6, -1, -18, -1, -8, -12, 3, 2, -26, -5, -4, 7, 4, -10, -26, -5, 0, 8, 42, 35, 11, 23, 13, 5, 5, -16, -32, -35, -13, 7, -14, 13, -2, -11, 1, -14, -24, 5, -12, 9, -8, 11, 11, 10, 6, 23, 3, 24, 16, 8, 32, 17, 19, 0, -18, -32, -10, -20, -7, 13, 2, -21, -2, 2, 8, 9, -4, 4, 13, 7, 1, 6, -1, -20, -2, 10, 11, 1, 20, 0, 10, 2, -1, -26, -6, 7, 12, -10, -17, -9, -20, -9, -11, 8, 6, -6, -19, -11, -33, -4, -38, -12, 2, -2, 22, 8, -1, 9, -17, -14, -7, -9, -5, 4, -2, 10, 6, -4, -20, -6, -14, -18, -10, -16, -39, -41, -38, -49, -49, -36, -27, -12, 15, -22, -18, -1, -12, -3, -22, -12, -15, 4, -10, -12, -5, 0, -1, -26, -29, -40, -47, -51, -37, -41, -46, -67, -60, -9, -7, -7, 2, -18, -2, 3, -13, -21, -32, -17, -17, -5, -8, 9, -13, -17, 9, -21, -5, -27, -27, -45, -32, -45, -72, -74, -20, -9, 1, -27, -29, -18, 5, -12, -12, -21, -23, 1, -2, 4, 5, 6, -7, 6, -1, -6, -24, -4, -34, -24, -25, -37, -18, -23, -25, -14, -2, 4, -31, -12, -5, -15, -15, -15, -19, -4, -9, 7, -8, 6, 13, 9, -15, 2, -10, -23, -20, -2, 1, 15, 16, -16, -3, 3, 8, -13, -12, -7, -31, -4, -7, 2, 3, -15, -14, -16, 11, 2, 3, 11, -4, 2, 6, 9, 23, -8, 2, 4, -1, -2, -19, -5, -5, -8, -2, -37, -18, -18, -32, 5, 8, -6, -11, -10, -9, 12, 8, -4, -14, 8, 44, 28, 36, 12, 12, 0, 2, -21, -24, -12, -22, 9, 12, -27, -41, -20, 17, 9, -10, 10, -20, -14, -4, -11, 1, -6, -9, -11, 22, 28, 25, 32, 22, 30, 26, 40, 22, 30, 10, 19, -6, 15, 1, 5, -6, -12, -14, -7, 2, -13, -20, 10, 8, -9, -7, 1, -14, 20, -11, 18, 38, 41, 36, 12, 35, 42, 37, 23, 10, 29, 3, 3, 11, 8, -2, -7, -4, -4, -13, -18, 5, -6, -13, 0, -13, 6, 8, -1, 15, -15, 0, 3, -5, -9, 15, 7, 15, 3, 12, -6, 5, -13, 11, -13, 1, 3, -3, -1, 17, -10, 20, -2, 1, -11, 7, 2, 10, 3, 21, 8, 19, 11, 16, 2, 17, 5, 9, -11, 4, -7, -1, -3, -9, -8, 19, -9, 16, 9, 7, 6, 17, -11, 6, 4, 11, 7, -2, 2, 7, -1, 18, 14, -4, -7, 18, -4, 13, 3, 2, 13, -8, 10, 19, -13, -11, 9, -1, 14, -12, 21, 1, 20, 18, 7, 15, 25, 12, -2, -7, 19, 13, -1, 24, -3, 17, 17, 9, 6, -2, -8, -3, 0, -1, 10, 3, -4, 4, 9, 3, -15, -11, -11, -5, 20, 22, -4, -12, -14, 5, 5, 18, 26, 10, 25, 18, 2, 6, 15, 3, 13, 1, -3, -2, -5, -18, -23, -15, -15, -21, 5, 12, -9, 0, -23, -15, -9, 11, 1, 10, 15, 37, 29, 43, 13, -7, 0, 3, -3, 12, 14, -11, -17, -24, -24, -42, -38, -34, -31, 14, 4, 9, -20, -19, -22, 3, -9, 0, 19, 4, 21, 32, 34, 3, 1, 22, -6, -9, -5, 8, -17, -5, -52, -28, -17, -26, -22, 5, 10, -14, -15, 2, 6, -2, 2, 40, 23, 29, 26, 26, 33, 19, 7, 7, 0, -14, -7, -19, -27, -38, -38, -44, -12, -8, 14, -3, -15, 8, 1, 9, 19, 38, 44, 34, 53, 45, 42, 42, 36, 21, 9, -13, -7, 2, 1, -12, -21, -25, -27, -36, -5, 1, 0, 20, 10, 7, 4, 16, 13, -2, 9, 16, 11, 49, 23, 36, 41, 33, 27, 15, 11, 16, 16, -14, -36, -19, -17, -25, 20, 3, 12, 17, 3, -28, -41, -40, -23, -36, -24, -28, -19, 7, -5, -3, 49, 23, -4, -2, 6, 5, 7, -3, -16, -20, -25, 13, 3, 37, 34, 31, -8, -15, -31, -33, -60, -49, -66, -58, -51, -46, -19, -14, 25, 38, 20, -4, -9, -1, -7, -1, -9, 0, -17, 27, 20, 28, 18, 22, 24, 5, -25, -21, -36, -34, -33, -49, -48, -35, -29, -29, -12, 14, 3, -12, -10, 12, 15, -19, -6, -18, 12, 2, 26, 19, 21, 23, 24, 16, -21, -9, -12, -16, -47, -50, -35, -47, -31, -46, -12, 8, -7, 6, 20, 4, -3, -15, -12, 0, -16, 17, 15, 14, 11, 12, 41, 39, 18, -1, 5, -10, -5, 0, -5, -42, -18, -28, -25, -17, 14, -7, -8, -13, 10, 10, -18, -1, -3, 24, 24, 16, 28, 23, 28, 15, 24, 11, 2, -3, 0, 16, -2, -17, -20, -43, -34, -13, 8, 13, 3, 8, -8, -16, -14, -36, -11, -30, 5, 25, 18, 25, 30, 13, 15, 4, 18, -12, 7, 3, 11, -21, -6, -33, -19, -9, -10, 9, 13, 1, 12, -9, -25, -34, -25, -42, 0, -28, -4, 20, 32, 15, 12, 2, -5, -18, 5, -6, -1, -28, -17, -5, -28, -4, -16, 10, -8, 9, -6, 7, -12, -20, 3, -14, -26, -19, -3, 21, -5, -12, -6, 5, 4, 6, -3, -5, -8, -14, -24, -1, -1, -24, 5, 9, -7, -9, 17, -13, 3, -15, -5, 1, -4, 7, 19, 0, 3, 17, -12, -5, 6, 5, -14, 22, 0, -21, -24, -4, 0, 3, 2, 2, 11, 13, 2, -11, -5, -4, 19, -14, 2, -3, 0, 17, 30, -9, 0, 10, 1, -17, -7, -6, 12, 0, 2, -11, 15, -12, -14, 17, 8, 3, 19, -17, -4, -16, -13, -1, 10, -6, -1, -3, 4, -12, 4, 10, -12, -4, 24, 14, -2, -19, -1, -11, 14, -4, 17, -14, -6, -10, -11, -18, -1, 7, -32, 5, 0, 14, 3, -4, 12, -6, -1, 19, 3, -1, 19, 0, 17, 3, 17, -6, -6, 23, 20, -6, 15, 16, 2, 14, 11, 0, -41, -12, 2, 8, 5, 13, 14, 9, -4, -2, 13, 16, 23, 6, -11, -5, -6, 0, 4, -3, 16, -2, 6, -1, -2, -6, -4, 0, -13, -20, -6, 4, 0, -3, 16, 6, 11, 7, 21, 20, -10, 11, 1, -14, -10, 19, 7, 18, 1, 3, 0, 17, 1, 2, 12, -22, -3, 2, -7, 9, 26, 20, 13, 26, 42, 26, 13, 3, -1, 0, 6, -6, 17, -2, 15, 4, -14, -12, 2, 14, -5, 1, 14, 2, -5, -11, -3, 19, 24, 16, 32, 46, 27, 30, 45, 31, 7, 13, 15, 18, 12, 6, 2, 12, -4, 6, 4, -3, 10, 14, -5, -4, 21, -1, 3, 6, 3, 31, 16, 0, 26, 14, 7, 4, 10, 3, -11, -6, 4, -1, -1, 19, 20, 4, -4, 14, 18, 6, 20, -11, 18, 16, 19, 18, -11, -9, -4, 18, 21, -2, 7, -3, -12, 9, 20, -4, 13, -12, -4, 9, -10, -11, 13, -8, -3, 3, -17, 12, -18, -14, -5, -13, 13, -11, -2, 10, 5, 0, -21, 6, -17, -8, -14, -13, 8, 10, 5, 5, 3, 3, -4, -14, -3, 6, -15, 6, 4, 7, -17, -7, 0, -18, 1, -3, -5, -9, 4, 4, -19, 0, 6, 4, 5, -15, 2, -16, -10, 3, -2, -13, -13, 12, -9, -15, 8, -10, -7, -9, 7, -30, -33, -20, -3, 0, -13, -20, 4, -14, -14, -6, -9, -19, -14, 13, -3, -6, -6, 11, -5, -16, 0, -15, -23, -12, -18, -27, -6, -14, -26, -20, -15, -28, -19, -27, -30, -18, -21, -27, 2, -12, -14, 2, 5, 11, 0, -19, 13, -4, -3, 10, -15, 12, 16, -7, 10, 16, 12, 26, 23, 0, -11, -10, -19, 1, 6, -24, -9, -1, -3, 4, 10, 6, -10, -11, -6, -11, 10, 5, 13, -5, 2, 2, 17, -3, 1, 26, 6, 19, 13, -8, 11, 3, 14, 15, 2, -3, -6, -16, 3, -12, -7, 4, -10, -4, -2, 6, -8, -10, 1, -9, 9, -1, 12, 3, -8, -6, -5, -9, -6, 4, -21, -25, 16, 25, -16, -18, 9, -11, -6, -1, -9, -22, 7, 1, 9, -14, -26, -20, -9, -3, -4, 10, -13, -4, -6, 0, 26, 3, 12, 1, 17, 38, 0, 22, 11, -17, 11, -14, 5, -11, -1, -24, -23, -18, -19, -27, -15, -13, 1, 6, -2, -10, -1, 4, 13, 4, -11, 2, -14, 1, 25, 22, -17, 0, -6, -17, -10, -25, -14, -5, -1, -15, 0, 2, -2, -8, -20, 27, -12, -33, -16, 19, 16, 31, 24, 5, -21, 7, 15, -21, 5, 11, 10, 10, -10, -26, -13, 19, 10, -18, -18, 10, 4, -11, 15, -5, -41, -56, -51, 2, 6, 3, -2, -20, -3, 11, -16, -13, -12, 7, 6, -15, -10, -19, -6, 0, 13, 11, -17, -3, -3, -19, 6, -33, -44, -46, -58, -18, 22, 31, 2, -7, -11, 7, 11, -4, -9, -8, -11, 5, -13, -25, -19, 14, 28, 27, 0, -7, -5, -7, 6, -7, -35, -67, -53, -26, 8, 14, 22, 30, 23, -7, 2, -10, -6, 8, -15, 6, -22, -26, -8, -3, 4, 41, 42, 17, -12, 12, 10, -6, -18, -45, -36, 3, 27, 27, 52, 60, 30, 6, -7, 8, 12, -5, -7, -9, -5, -7, 15, 33, 15, 18, 40, 21, 20, 31, 30, -2, -33, -32, 2, 11, 29, 40, 36, 15, 1, -19, 7, 16, -5, 13, -4, -2, -6, 25, 11, -9, 10, 25, 66, 53, 35, 49, 20, -23, -12, -3, 16, 25, 43, 48, 19, -21, -23, -22, -31, -6, -11, -12, -5, 8, -22, 13, -10, -10, 36, 16, 56, 61, 36, 15, 6, 1, -30, -1, 45, 64, 45, 28, 8, 30, 3, -11, -17, 17, 22, -6, -3, -3, -20, -19, 2, 20, 46, 40, 51, 57, 17, -18, -8, -27, 3, 34, 31, 11, 17, 2, 8, 20, 1, -2, -23, 22, 7, -5, 1, 7, -1, -13, -6, 17, 55, 45, 51, 23, -15, -33, -35, -28, 8, 10, 29, 20, 14, -3, -14, -3, -21, -22, 10, -17, 13, -10, -6, -12, 2, -15, 0, 16, 61, 71, 63, 4, -46, -62, -55, -44, -11, 8, 36, -1, 43, 16, 9, -7, 0, 26, -8, -21, -5, 11, -14, 5, -2, 14, -8, 30, 40, 63, 25, 13, -30, -52, -36, -37, 1, 19, 33, 17, 3, 24, 16, 22, 26, 23, 7, -13, -11, 3, -1, 12, 17, 18, 14, 32, 40, 57, 22, -4, -19, -38, -6, -13, 15, -5, 7, 8, 3, 6, 21, 6, 41, 8, 5, -16, 2, 5, -19, 7, 16, 3, 5, 55, 71, 60, 36, 31, 21, 10, 2, -26, -36, -42, -32, -36, -24, 4, 26, 43, 24, 18, 2, 6, -12, 0, 9, 10, 12, -15, -16, 12, 34, 22, 35, 19, -13, 10, -10, -18, -39, -49, -40, -41, -27, 7, 4, 34, 31, 1, 7, -3, -2, 7, -4, 4, -8, -3, -12, -24, -11, 2, 36, 4, 10, 4, -2, 0, -20, -12, -34, -54, -39, -10, -28, -5, -6, 0, -10, -16, -1, -14, -9, -4, -1, -9, -28, -12, 3, -16, -17, -27, 7, -18, -8, -5, 16, -13, -12, -47, -45, -54, -9, -18, -32, 0, -6, -10, 13, 2, 8, -14, 11, -14, -7, 18, 18, -7, -7, -5, 1, -13, -9, -10, 16, -23, -17, -41, -29, -37, -11, -25, -2, -8, 9, -3, -18, -15, -14, 2, 9, -10, -16, -18, -16, 12, 4, 2, -20, -20, -8, -9, -19, -22, 9, -10, -18, 5, -16, 5, -7, -5, -4, 7, -2, -13, 4, 1, -5, -19, 6, -2, 7, -7, -5, -6, 1, 5, -17, -25, 4, -22, -22, -11, 4, -26, -8, -13, 7, 2, -20, -1, -11, -20, 8, -5, -21, -23, -1, 6, -3, -1, 9, -10, -6, -9, -9, -19, -10, -11, -13, -3, -12, -9, -22, 7, 3, -4, -1, 0, -25, -16, -13, -2, -1, -10, -4, -19, -18, -24, 12, -9, 11, -6, -10, 2, 2, -1, 0, 7, -13, 5, -2, -14, -24, -24, -8, 8, -19, -8, 1, 1, -13, -12, -10, -17, 9, 17, 16, 7, 29, 20, 14, 13, 35, 28, 12, 6, 19, 19, 14, -2, 1, 5, -7, -20, -5, 0, -16, -24, -3, -18, -21, -7, 11, 33, 28, 11, 34, 33, 10, 18, 5, -9, -1, -4, 18, -8, -19, -21, -2, -19, -7, -8, -25, -1, 8, -18, -1, -8, 14, -12, 7, 6, 10, -9, 9, 4, 4, -7, 5, -10, -1, -9, 10, 23, -6, -17, -25, -23, -19, -17, -23, 3, -7, -7, -13, 8, -14, -5, -14, 11, 10, -5, 12, 17, 7, 20, 9, 7, 22, 20, -1, -8, 5, -26, -32, -42, -34, 3, -18, -11, -6, -23, -1, -9, 1, -13, -8, 6, 13, -11, -13, 8, 24, -1, 32, 27, 0, -7, -4, -19, -13, -19, -46, -50, -34, -9, -13, -14, -8, -19, -18, -11, -16, -27, -18, -20, -1, -23, 10, -5, -7, 6, 15, -7, -6, -12, -17, -16, -20, -20, -3, -42, -44, -24, 1, -20, -10, 5, -6, -1, 4, 5, -4, -1, 14, 1, 6, 2, -21, 4, 1, 16, 19, -8, 4, 18, 6, 9, -10, -15, -7, 0, -19, -26, 7, -3, -17, 2, -16, -9, 19, 18, 4, -13, -14, -9, -23, -25, 0, -8, 17, 12, 6, 2, 20, -16, -16, 13, -10, -7, -7, -23, -1, -16, -4, -7, 5, -9, 2, 11, 1, -25, -25, -21, -32, 5, 5, 20, -10, 14, 10, 0, 30, 19, 10, -3, 18, -11, -23, 4, -7, -6, -25, -1, 5, 16, -8, -13, -30, -13, -16, -27, -20, 1, 12, 14, 11, -8, 20, -1, 13, 9, 1, -2, 15, 5, -17, 5, -22, -22, -30, -12, 3, -2, -1, -17, -15, -11, -20, -22, 3, 27, 31, 4, 15, 7, 9, -14, -11, -1, -18, 6, -1, -23, 3, -24, -14, -16, -2, -12, -31, -10, -19, -7, -10, -9, -8, -22, 10, 37, 22, 24, 11, -23, -10, -37, -25, 9, -12, -20, -16, 2, -19, -25, -14, -12, 1, -9, 12, -1, -2, -15, -19, -28, -7, -8, 8, 20, 22, -3, 15, -9, -2, 7, -9, 6, -17, -3, 6, 14, -6, 0, 6, -24, 3, -4, 26, -7, -7, -32, -31, -18, 10, -5, 12, 3, -9, -19, -7, 8, -1, 17, -13, 12, 1, 30, 15, 22, -11, -13, 0, -17, 8, 5, 27, 10, 4, -12, -17, -22, -20, -10, -17, -31, -41, -6, -3, 13, -1, 23, -8, 3, -9, -3, 7, -4, 12, -3, -24, 5, 6, 24, 7, 1, 10, 13, 1, -24, -14, -16, -18, -11, -21, 4, 19, 11, 14, 15, -5, 14, 2, 18, 14, 19, -5, -1, -10, 0, 5, 26, 8, 13, -2, 6, 20, -1, 20, -10, -4, 2, -20, 3, 11, 19, -2, 25, 9, 20, 21, 12, 20, 13, 7, -21, 7, -16, 8, 10, 14, 6, 26, 20, -2, 7, -7, -13, -3, 10, -8, -3, 6, 1, 20, 24, 11, 16, 17, 5, 11, -12, -19, -8, -2, -3, -8, 14, 16, -2, 6, 18, -4, 12, 18, 6, -4, 9, 2, 11, -7, 22, 15, 20, 15, 18, 8, 27, -8, -9, 7, -2, 0, 0, 11, 1, -4, 11, 14, 11, 14, -3, 11, 10, 19, 16, 4, 5, 3, 17, 23, 11, 9, 11, 31, 13, 14, 0, -26, 1, -9, -20, -8, 17, 0, -14, -10, 10, -6, 9, 18, 7, -12, 4, 4, -15, -22, 9, 18, 21, 4, 27, 21, 7, 10, -11, -5, 1, -24, -12, 3, -4, -12, -21, -5, -8, 17, -15, 7, 3, -9, -27, -5, -1, 12, 8, 13, 0, 26, -3, -4, 16, 4, -10, -3, -2, -10, -12, 7, -11, -14, -15, 20, 27, 31, 9, 19, 14, 15, 5, -5, 4, 23, 12, 9, 24, 18, -9, -6, 2, -21, -18, -17, -10, 5, -10, 6, 4, -9, 6, -8, 15, 1, 19, 14, 14, 22, 27, 21, 15, 6, 3, -9, 0, -11, 18, -16, -7, -6, -8, 8, -20, -11, -7, -5, -15, -14, -19, -7, -20, -12, -27, -19, -23, 2, -24, -21, -22, -8, -9, 2, -8, -14, 4, -7, -6, -9, -12, -16, 0, -16, 6, 17, -14, -17, -8, -16, -2, 15, -4, 5, -1, 13, 15, 13, -12, 8, 9, 2, 12, -6, -6, -8, -12, 14, 10, 3, -1, -8, -2, 8, -17, 5, 7, -7, 10, 1, 16, -18, 9, -8, 3, 13, 5, -5, 8, 11, 3, 16, 7, 10, -7, -7, 4, -16, -14, 17, 14, 12, -15, 3, 3, 4, -4, -15, -7, -21, -17, 4, -20, -4, -15, 8, -24, -5, -8, 12, -11, 14, 10, 12, -9, -5, -17, 11, -10, -14, 7, 15, 12, 3, -14, -1, -18, -8, 1, -10, 2, -19, -38, -20, -7, -32, -33, -36, -5, 3, -9, -12, -7, -5, -13, -5, 13, 4, -3, -3, -14, -6, -8, 21, 23, 21, 16, 6, 18, -7, -39, -28, -32, -44, -38, -37, -41, -22, -8, -15, 9, -14, -6, 17, -15, 10, 5, -7, 7, 6, 1, 18, 2, 1, 24, 35, 37, 6, 24, -19, -37, -25, -52, -30, -18, -43, -16, -13, 11, -5, 15, 2, -6, -1, 17, -4, 13, 15, -4, -9, 3, 24, 9, 18, 36, 17, 23, 31, 3, -10, -50, -35, -37, -28, -30, -39, -19, -6, -4, -4, 3, 16, 23, 9, -7, 4, 13, 5, 11, -8, -4, 25, 29, 9, 40, 39, 23, 8, -15, -48, -30, -50, -11, -33, -5, -17, -8, 11, -2, 0, 22, 7, 4, 20, -3, 1, 9, 20, -1, 9, 30, 15, 42, 31, 8, 5, -9, -31, -66, -51, -23, -26, -24, 6, 2, -5, 8, -13, 4, 27, 21, 13, 2, 0, 13, -10, -28, -8, 24, 40, 60, 31, 35, 36, -1, 7, -55, -57, -38, -33, -1, -15, 9, 0, -10, 0, 31, 24, 24, 18, 11, 10, -5, -10, 4, -4, -3, 27, 23, 34, 21, 14, 10, -11, -34, -49, -47, -47, -6, 13, -8, 1, -14, -7, 29, 10, 10, 0, 6, -7, -17, -6, 13, 8, -5, 40, 32, 32, 24, 32, 20, 2, -42, -45, -41, -47, -3, 5, -3, 4, 11, -5, 2, 8, -11, -30, -17, -5, 4, -16, -26, -23, -18, 36, 54, 40, 47, 40, 7, 3, -27, -47, -24, -35, 15, -7, 18, 14, -10, 0, -6, 16, -28, -26, -1, 5, -24, -23, -18, -6, 13, 33, 39, 52, 32, 24, 3, -35, -37, -21, -35, -17, 24, 7, 16, -13, 2, -1, 0, 0, -37, -25, -7, -7, -30, -34, -5, -27, 8, 17, 35, 28, 23, 6, -20, -2, -25, -6, -26, -2, 8, -1, -1, -12, -16, 12, -3, -2, -21, -41, -34, -15, -8, -4, -6, -26, 23, 24, 7, 13, 14, 1, -34, -21, 4, 3, -1, -19, 6, -4, -14, -14, 5, 5, -6, -12, -34, -33, -14, -12, -16, 3, 0, 0, 13, 23, 15, 34, 9, -15, -29, -21, -3, 5, -9, -13, 6, 11, 18, -15, 17, -15, 6, -16, -27, -23, -17, 12, -11, -19, -10, -1, 15, 4, 19, 1, -10, -19, -4, -25, -4, 13, -5, 9, 11, -9, -7, 1, -15, -7, -4, 8, -25, -31, -25, -10, 5, -20, -22, -7, 5, 16, -3, -1, -23, -16, 5, -3, -8, 21, 11, 2, -2, 13, 0, -3, -10, -5, -10, -17, -28, -26, 5, -26, -27, -21, -48, -26, 9, -22, -21, 2, -17, -2, 11, -4, -3, 2, -13, -19, -6, 17, 2, 3, -2, -13, -8, -2, -24, -25, -2, -3, 4, -12, -19, -20, -18, -2, -26, -25, -3, -2, 10, -5, 10, -3, -7, -10, 5, 11, 8, -9, -11, 5, 13, -16, -37, -20, -21, -10, -1, 6, -24, -3, -25, -22, 2, -14, 2, -9, 3, 15, -7, -8, 0, 13, 13, -6, 14, -2, -5, 2, 10, 4, -17, -24, -14, 7, -4, 3, 12, 2, -11, -13, -15, -12, -29, -27, -7, 22, 7, 1, 12, -6, 8, -9, 7, 9, 10, 16, 8, -14, -11, -10, 8, 9, -11, -17, -4, -2, 8, -4, 1, -25, 7, -5, 21, 17, -2, 0, -14, 4, -6, 9, -15, 13, 9, 17, -16, 16, 1, 19, 8, -12, -20, -21, -19, -32, -16, -5, -10, -9, -15, -12, 13, -6, 16, 12, -11, -2, -11, -10, 11, -16, 2, -9, 14, -3, 3, 6, 15, 24, 14, 20, 14, 23, 6, -1, -8, -14, 6, -6, 19, 24, 0, -13, -26, -12, -5, 2, -4, 1, -3, 3, -7, 6, 19, 3, 12, 7, 18, 41, 30, 20, 19, 28, 26, 29, 35, 29, -1, 11, 8, -9, 15, -15, -1, 5, 12, 6, 6, -11, 0, 9, 17, 14, 9, 19, 16, -10, -3, 2, -9, -1, -8, 0, 15, 19, 12, -2, -13, -13, -15, -1, -17, 12, -15, 12, -15, 2, -1, -18, 0, -18, -18, -16, 4, -2, 12, 13, 1, 13, -13, 10, -15, -2, 13, -17, -1, 7, 6, 6, 10, 13, 11, 6, -5, 9, -9, -9, -17, 14, 14, -5, 7, 12, -15, 1, -14, -18, -3, -4, 7, -5, 5, 14, -11, 14, 3, -7, 9, -9, -15, 11, -7, 2, -12, -19, 1, 10, 12, -9, -20, -12, 6, 2, 3, -29, -10, -10, -9, 6, -8, -5, 11, 13, -4, 0, 0, -14, -17, -12, -14, 0, -6, -18, -9, -10, -24, 0, -6, 1, -32, -21, -2, -6, -27, -13, 0, -24, -2, -10, -5, 5, 9, -17, 7, -1, 9, -17, -4, 9, 13, 12, -22, -2, -34, -34, -35, -33, -29, -47, -17, -43, -40, -37, -11, -14, -16, -16, -16, -27, -9, 0, -1, 4, -3, -5, -1, 9, -11, -21, -23, -23, -7, -24, -18, -26, -35, -39, -20, -45, -20, -38, -25, -2, -24, -38, -14, -35, -52, -9, -3, -12, -2, 8, 4, -3, 7, -5, 8, 0, -2, -26, -16, -7, -5, -13, -39, -36, -22, -10, 9, 13, 22, 6, 2, -3, -42, -42, -12, -10, 13, -16, 4, 11, -7, 1, 6, 14, 1, -24, -9, -9, 3, 14, -5, 10, 0, 6, 10, 7, 2, 18, 20, 11, 18, 7, -9, -9, -12, -12, -1, -8, 18, -20, -1, 4, 24, 19, 5, 5, -8, 30, 28, 35, 20, 10, 24, 6, 6, 16, 26, 3, 42, 37, -20, -2, 5, 9, -1, 12, -3, 1, -1, 20, 17, 13, 15, -2, 20, 10, 16, 48, 21, 2, 0, 12, -1, 30, 25, 5, 15, 34, -6, -13, -9, -15, -16, -7, 9, 27, 18, 12, 24, 19, 19, 23, 16, 30, 37, 66, 46, 28, 22, 28, 18, -3, 4, 1, 35, 27, 13, 4, -3, -9, -4, 30, 23, 5, -4, 17, 24, 0, -9, 26, 40, 35, 39, 30, -12, 12, -5, -1, 15, 6, 0, 22, 33, 55, -6, -3, 2, 10, 11, 13, 5, -3, 21, 21, 12, 9, 8, 1, 8, -9, -6, 3, 1, -7, -26, 9, -18, -5, -3, 13, 39, 27, 6, 13, -2, 11, -10, 8, 13, 5, 17, 20, 6, 6, -5, -12, -20, -18, -6, -24, -17, -39, -26, -7, 0, -2, 10, 6, 22, 13, -8, -17, 5, 7, -9, -9, -8, -3, 22, -13, 0, -12, 2, 17, 7, -15, -21, -25, -32, -29, -32, -24, -4, -13, -5, 5, 33, 17, 13, 0, -18, -15, 4, -12, -10, -25, 15, 5, 10, 3, -9, 1, 16, 4, -20, -8, -32, -18, -13, 5, -10, 12, 27, 20, 36, 25, 4, 3, -8, 0, -18, -2, -26, -6, 6, -3, 7, 18, 5, 29, -19, -13, -48, -25, -14, -19, 8, 6, -17, -6, 12, -2, 3, 8, -4, 2, -3, 7, 12, -13, -24, 2, -5, -1, 26, 33, 7, 2, -10, -26, -28, -26, -21, -18, 2, 5, -7, 8, -10, 14, -20, 7, -18, -3, 4, -12, -4, -9, -36, -15, -3, 13, 27, 30, 26, -2, -37, -63, -21, -16, 5, -14, 16, -24, -27, -13, 0, 6, -16, 2, 4, 5, 8, -1, -16, 4, -34, -14, -12, -10, 21, 21, 5, -11, -24, -29, -34, -7, -24, -29, 6, -19, -14, -6, -34, -19, -4, -9, -14, 2, 0, -19, 2, -20, -21, -8, 5, -1, -1, 4, -2, 6, -13, -11, -11, -12, -27, -22, -38, -26, -16, -22, -27, -6, 7, -2, -1, -19, 12, 3, 6, -15, -4, -26, 10, 32, 21, -6, 17, 16, -7, -19, -36, -24, -19, -7, -42, -43, -28, -39, -13, -15, -24, 7, 6, -17, -7, -10, 7, -21, -29, -15, -17, 13, 22, 28, 34, -1, 18, 18, 12, -6, -1, 4, -5, -16, -23, -32, -26, -23, -8, -8, 11, -17, 2, 4, 13, -17, -12, -4, -8, 20, 27, 6, 13, 30, 21, 27, 30, -11, -7, -7, 2, -24, -25, -42, -38, 1, -5, 10, -19, 2, -9, -7, -4, -4, -14, -23, -2, -20, -22, 3, 24, 20, 23, 22, 14, 3, 21, 15, 2, 9, -11, 4, -14, -5, -2, -13, -20, -2, -2, -15, -13, 10, -13, 14, -14, -28, -6, -1, -19, -7, 2, 13, 16, 8, 14, 39, 27, 31, 27, -2, -8, -4, -1, 4, -10, -16, -3, 11, 6, -15, -19, -3, -22, -23, -7, 30, 1, 26, 21, 3, 29, 37, 19, 21, 40, 13, 28, 21, 3, 2, -12, 15, -16, 8, -19, -17, -4, -17, -11, -15, 1, -7, 11, -9, 5, 13, 3, -13, 5, 20, -10, -10, -10, 19, -8, -6, 9, -6, 15, 4, -19, -9, -16, 19, 16, 16, 10, 6, 19, -6, 6, 10, -6, 13, 18, -2, -11, -13, -14, 11, 7, 1, 19, -14, -10, 17, 19, 6, 1, -11, -13, -12, 16, 2, 8, 4, 6, -13, 4, 17, 9, -4, -10, 21, 10, 21, -12, 11, -10, -6, 17, 3, 5, 9, -6, 18, -5, 4, 5, -1, 1, 3, 11, 0, -9, 5, 7, 11, -10, 4, -7, -5, 7, -7, 11, -1, 7, -2, -6, 11, -14, -12, 18, -13, 4, 1, 13, -3, 17, -12, 20, 19, 2, -3, -10, -8, -1, -6, 5, -6, 4, -26, -21, -23, -42, -25, -5, -26, -1, -14, 7, 9, 6, -2, -4, 19, 16, 4, 0, 11, 24, 4, 8, 11, -7, -2, -23, -5, -21, -36, -39, -33, -40, -48, -15, -12, -10, -26, -7, 7, -11, -11, -4, -6, 14, -11, 6, -3, -8, 11, 20, -5, -14, -10, 16, 21, 10, -11, -15, -29, -38, -25, -16, -14, -7, -24, -22, -2, 1, 5, -11, -12, -3, 19, -3, 12, -12, 8, -2, 18, 8, 14, 12, 12, 15, 2, 9, 26, 1, -39, -29, -22, -19, -31, -22, -5, 8, 8, 0, 19, -2, -1, 25, 14, -5, -13, 5, -6, 16, -12, -6, 3, 26, 16, 31, 0, -4, -17, -19, -30, -25, -27, -34, -22, 0, 11, 2, 4, 17, 1, 3, 7, 5, 0, 33, 4, 17, 31, 11, 7, 33, 44, 14, 3, 16, -4, -28, -34, -25, -34, -14, -24, -25, -10, 8, -6, 7, 22, 21, 4, 31, 3, 32, 24, 1, 8, 9, 19, 38, 31, 9, 6, 28, 0, -7, -46, -41, -31, -24, -22, -2, 5, -2, -2, -1, 9, -3, 21, 35, 21, 34, 9, 12, 23, 16, -14, 20, 37, 23, 12, 34, 24, 1, -32, -42, -36, -32, -31, -33, -9, -3, 16, 10, 16, 24, 31, 44, 30, 6, 2, -4, 10, 3, -21, 9, 20, 14, 30, 15, 23, 14, -19, -19, -51, -51, -18, -6, -3, -6, 14, 7, 3, 11, 36, 20, 16, -2, -12, -17, -13, -16, -39, -45, 18, 34, 12, 34, 35, 16, -14, -32, -43, -30, -14, -15, -3, 5, -13, 10, 14, 19, 0, -5, -22, -7, -21, -12, -29, -14, -45, -24, -16, 16, 16, 29, 25, 13, -38, -42, -38, -17, -3, 16, 10, 21, -5, 13, -9, -7, -17, -19, -43, -46, -39, -46, -20, -15, -15, -21, 15, 7, 14, 24, 28, 4, -20, -37, -10, 22, 22, 7, 3, 12, 11, 11, 0, 11, -1, -42, -21, -41, -24, -14, -25, -16, -11, -14, 18, 16, 17, 3, -1, -8, -31, -34, -8, 2, 7, 28, 8, 13, -6, 2, 4, 2, -1, -34, -33, -41, -27, -16, -14, -9, -5, 22, 17, 27, 24, 9, -7, -36, -10, -33, -34, -17, -6, 29, 19, -10, -11, 16, 9, -6, 7, -39, -29, -68, -74, -17, 13, 30, 15, 5, 19, -1, -14, -18, -19, -25, 2, -11, -1, -31, 11, 24, 10, 20, 3, -7, -3, -22, -18, -42, -49, -84, -94, -18, 34, 18, 33, -1, 24, -2, -7, -2, -11, -34, -3, -16, 4, -17, -12, 21, -9, 6, -14, 5, -1, -4, -10, -31, -47, -61, -82, 0, 36, 25, 8, 35, 0, -7, -17, -19, -11, -9, -19, -34, -19, 6, 5, 7, -5, 12, 15, -10, -3, -13, -15, -26, -41, -26, -61, 0, 23, 40, 32, 29, 35, 8, -11, -19, 0, 11, 9, -24, -9, -2, 14, 20, 21, 12, -5, -3, 12, -9, -30, -39, -40, -31, -15, -5, -6, 11, 21, 10, 5, 18, -2, 9, -20, -13, 3, -17, -5, -11, 3, 20, 4, -11, 0, -10, 4, -13, -14, -4, -35, -10, -12, -17, 1, -20, 7, -2, -1, 13, 14, -6, -1, 4, -1, -7, -15, 3, 3, -3, -7, 3, 18, 20, -9, -8, -27, -4, 2, -26, -8, -6, -23, -2, 2, -11, 7, 12, -7, -5, 19, -5, 10, 25, 1, 13, -7, -9, -10, -6, -14, -14, -12, -20, 3, 17, -22, -11, -27, -29, -50, -28, -3, -35, -17, 13, -5, -24, -2, -6, 12, 4, -6, -13, -6, 12, -12, 10, 12, 13, 0, -3, -4, -5, 6, -9, 10, -10, -22, -20, -19, -3, 5, 12, 7, -13, -4, 16, -6, 13, 8, 3, -9, 8, -1, -4, -2, 18, -14, -1, -15, 11, 7, 4, 18, 18, 13, -4, 12, 9, 37, 27, 34, 7, 38, 27, 9, 16, -9, -7, 0, -6, 17, 12, -7, 5, 8, -3, 14, 16, 0, -12, 12, 15, 9, -1, -3, 15, 6, 11, 22, -4, 13, 17, 11, 1, 6, 13, -8, -2, 6, 1, -1, -23, -14, -15, -6, -13, 10, -9, -20, -20, -7, 6, 10, -13, -3, -3, -17, -18, 11, -20, -9, -16, 2, -5, -17, -4, 4, -2, -13, -19, -13, -15, 2, 10, -13, -16, -23, -11, -20, -9, -10, 6, -24, -4, 2, 9, -3, -19, -8, -17, 4, -23, -18, -4, -8, -7, -24, -22, -16, -4, -1, 3, -11, 1, -20, 2, -9, -2, -5, -33, -8, -5, -20, -22, -20, -23, -25, -19, 1, -16, -14, 3, -4, -11, 0, -5, -3, 2, -22, -7, 3, -13, -3, -11, -26, -32, -2, -14, 1, -1, -11, -5, -12, -10, -16, -10, -23, 1, 1, -19, 7, -7, -23, -14, -4, -10, -18, -28, -26, -31, -14, -19, -20, 1, -6, -13, 5, -2, -15, 4, 12, 3, -11, 14, 12, 1, 6, -18, -19, 9, 1, -12, -4, 0, -5, -1, -24, -10, 10, 2, -2, 5, 27, 0, 14, 6, -2, 9, -6, -17, 3, -2, -4, -18, 10, 0, -15, 7, -15, -7, -23, 1, -25, 3, 16, 12, 16, 22, 21, 17, 37, 37, 12, 18, -8, 30, 6, 9, 13, 7, 15, 1, -1, 10, -14, 8, 3, -10, -19, -19, -20, 4, 10, 31, 0, 9, 26, 4, 15, -6, -11, 16, 7, 18, 34, 13, 4, 7, 13, 26, 24, 26, 6, 8, -1, 1, 10, -17, -32, 3, 3, 2, 16, 18, 13, 26, 3, -5, 0, 13, 40, 22, 6, 10, 17, -1, 16, 17, 30, 22, -5, 3, -8, -21, -8, 0, -5, 0, 10, -9, 14, 26, 18, -2, 14, 18, 8, -11, 26, 4, 27, 28, 27, 30, -2, 13, 53, 19, 6, 8, 3, 11, 6, 13, -5, 4, 15, -5, 11, 19, 16, 2, 12, 18, 3, 10, 19, 4, -3, 7, 19, 8, 14, 4, 33, 18, 8, 10, -12, -2, -6, 8, 11, -7, 7, 14, -4, 12, 11, 12, 27, 10, 6, -7, 8, 14, -6, 12, 22, 3, 0, -2, 8, -13, 13, -20, -6, -13, 5, 0, 3, -13, 15, 8, 6, 15, 25, 32, 24, 15, 2, -11, -8, -18, 22, 26, 27, 22, 20, 16, 13, 4, 15, -10, -4, -16, -5, 4, 5, 9, 6, 24, -9, 0, 20, 39, 0, -34, -15, -8, -6, -19, 2, 1, 17, 17, -5, 7, -16, 1, -11, 9, -11, -5, 8, -8, -4, -1, 10, 13, -13, 23, 26, 15, 9, -14, -29, -8, -28, 1, 46, 39, 7, -6, 18, 9, 5, -6, -5, -14, 8, -2, 5, -25, -18, 17, -4, 0, -5, 28, 19, -13, -17, -26, -3, -28, -16, 28, 43, 22, 9, 8, 24, 27, 1, -25, -5, -18, 10, -10, -6, -19, 4, 4, -4, 13, 9, -11, -13, -20, -5, 0, -14, 7, -10, 45, 26, 9, 36, -6, 24, 11, -30, -44, -10, 0, -17, -5, 7, -6, -11, 18, 18, 16, 9, 24, -25, 7, -3, -20, -21, -2, 27, 11, 2, -8, 5, 26, 21, -6, -3, -14, -6, -5, -10, -10, -14, -1, 11, 2, -1, 4, 17, 2, -12, 15, -1, -8, -5, 0, 1, 11, -4, 14, -4, 0, 8, -17, -3, -30, 3, -12, -1, 12, 2, -25, -2, 9, 0, -2, 9, -1, 6, 7, -21, 0, -4, -20, -22, -7, 4, 11, -2, -23, -25, -21, 1, -2, 2, -11, 1, -3, 2, 2, -14, 24, 15, 9, 21, 6, -4, 11, -14, 11, -18, 8, -3, 11, -14, -29, -32, -34, -20, -35, -15, -20, -24, -13, -9, -1, 1, -13, -27, 5, 13, 16, -14, -13, -13, 7, -1, 10, -9, -9, -19, -18, -24, -14, -21, -41, -22, -5, 0, -1, -20, -13, -6, -17, -10, -27, -30, -33, 11, 4, 4, -8, 14, -1, 21, 9, 18, 8, 8, -12, -20, -22, -32, -34, -17, 1, -22, -12, 11, -6, -23, 4, -21, 7, -6, -21, 16, 14, 22, 26, 14, 28, 24, 12, 15, 2, 23, 9, -23, -19, -29, -25, -5, -22, -25, 3, -8, -6, 6, -7, -8, -13, -16, -5, 6, 23, 7, 19, 36, 26, 31, 41, 25, 40, 15, 9, -18, -18, -25, -17, -33, -20, -20, -11, -3, -11, -2, -18, 2, -12, 3, -10, 0, 0, -12, 8, 18, 21, 10, 14, 6, 4, 23, 1, 7, -10, -30, -15, -20, -2, 9, -10, 8, 5, -19, -7, -8, -23, 6, 1, -3, 8, 9, -3, -14, 11, 1, -12, -22, -18, -9, -17, -3, 2, -26, -9, -19, -10, 11, -6, -4, -3, -12, 7, -19, 6, 6, -17, -14, -23, 1, -7, -12, 9, 7, -17, -14, 5, -7, -13, -12, 1, -14, -22, 9, 4, 9, 5, -19, 8, -17, -16, -25, -4, -13, -4, -14, 4, -4, -20, 2, -20, -28, -7, -7, -9, -18, -9, -18, 6, -23, -8, -28, -23, -28, -25, -19, -12, -5, -18, -27, 0, -10, -2, 1, -16, -19, 1, -18, 1, 0, -1, -8, -30, -22, 1, -22, -22, -28, -19, 4, -22, -10, -7, -28, -19, -11, 5, -5, -5, -26, -14, 4, -18, -20, -3, -9, -21, -41, -31, -24, -25, -41, -28, -25, -23, -15, -27, -20, -32, -28, -8, 2, -20, -1, -15, -27, -25, -27, -15, -16, -34, -29, -14, -18, -3, -22, -5, -21, -16, -28, 5, 6, -26, 13, -11, 1, -13, -26, -27, 0, -18, -2, -26, -12, 1, -22, -4, -6, -19, -27, 8, -7, 16, 25, 5, 18, 7, -3, 0, -2, -17, -16, 3, 7, 6, 7, -2, -2, -25, -3, -20, 0, 2, -8, -23, -21, -7, 4, 26, 11, 38, 20, 23, 18, 11, 12, 18, 5, 1, 17, 27, 30, 0, 14, -12, -3, -15, 2, 4, -11, -22, -30, -17, -8, 3, 16, 19, 8, 9, 26, 30, 27, 23, 13, 18, 19, 15, -8, 19, 30, 37, 19, -6, 10, -27, 4, -5, -8, -4, -18, 25, 4, 6, 15, 13, 6, 12, -6, 10, 4, -8, 3, 23, 22, 9, 10, -1, 4, 21, 16, 25, -8, 0, 6, -24, 4, -1, -32, 6, 11, -5, 9, 9, -7, -7, -10, -6, 0, -3, -7, 17, 17, 3, 0, 13, 8, 7, 55, 30, 16, -14, -19, -3, -23, -11, -25, 3, -2, -12, -8, -9, -2, 12, 15, 8, -28, -23, 9, 16, 22, 23, 4, -2, -5, 17, 36, 27, 8, -9, 6, -10, -8, -18, -13, -23, 0, -5, 5, 8, 5, -1, 28, -3, -38, -3, -19, -6, 21, -3, -19, 10, 9, 11, 39, 1, -3, -4, -25, -23, -22, -25, -13, -8, -3, 21, -4, 0, 15, -2, 27, 0, -29, -12, 5, -12, -10, -9, -28, -6, -4, -11, -7, 19, 14, -8, -2, -17, -34, -30, -27, -9, 25, -9, -14, 13, 26, 20, 8, 26, -11, -14, 4, -4, -8, 1, -1, 0, -26, -4, -13, -9, -10, -24, -26, -3, -11, -27, -3, 2, 9, 24, 14, 13, 2, 29, 22, 29, -14, -6, -18, -1, 26, 26, 11, 8, -5, -12, -33, -24, 3, -27, -11, -10, -29, -20, -13, -7, -7, 17, 19, -2, 16, 14, 19, 8, 13, 1, 3, 30, 7, 6, -8, -9, -28, -19, -29, -26, -1, -1, 3, -2, -15, -28, -1, 5, 4, 20, 6, 13, -2, 11, 34, 1, -14, -15, 12, -1, 16, 10, 0, 1, 7, -18, -12, -30, 3, -28, -8, -24, -10, -16, 9, 18, -9, -1, -9, 24, 12, 32, 41, -2, 2, 6, 13, 30, 28, 4, -9, 1, -9, 26, -24, -4, -27, -11, 5, -26, 1, -24, -1, -6, 6, -7, -8, 5, 16, 10, -9, 11, -13, -14, 39, 26, 3, 1, 8, 16, -7, 21, -21, -44, -5, 0, -22, -18, -11, -12, 21, 18, 12, 22, 15, 22, 1, 13, 16, 13, -18, -13, 14, -10, -13, 5, -10, 0, 6, 10, -30, -18, -19, -15, 6, -15, -28, 1, -1, 20, 35, -6, 7, -11, -2, 12, -11, 13, -14, 7, 10, 8, 16, 6, 15, 23, -6, -20, -16, -9, -25, -17, -10, -14, 0, -22, 18, 40, 14, 10, -5, 13, -11, -2, -19, -10, -16, -4, -9, 11, 0, -17, -9, 20, 1, 10, -30, -25, -5, -3, -14, -18, 1, -28, -3, -2, 11, 2, 12, 9, 9, -10, -22, -16, 13, 4, 2, -1, -12, 2, -11, 18, 6, -13, -27, -13, -25, 1, -8, -21, -18, -25, -4, -31, -6, 12, -7, 1, -8, 28, 14, 9, 15, -2, -13, 8, 14, 7, 16, 21, 11, -2, -8, -17, 1, -3, -9, -8, -27, -10, -14, -19, -30, 6, 9, 23, 28, 31, 24, 13, 4, 26, 19, 18, 15, 23, 14, 17, 3, 3, -21, -1, -18, -13, 3, -2, -18, -9, -2, -12, -31, 2, 17, 13, 20, 34, 27, 21, 46, 20, 40, 11, -10, -1, 16, -10, -6, -9, -6, -24, -29, -5, -5, 0, -2, -4, -9, -16, -6, -2, -28, -13, 6, 6, -27, 11, -19, -5, 2, 3, -17, -8, -7, -9, -21, 8, -25, -11, -20, -27, -2, 2, 4, -4, -1, -8, -9, -10, -16, -17, -24, -16, 0, -31, -33, -38, -27, -42, -39, -40, -15, -36, 0, -19, -14, -15, 4, -10, -3, -26, -17, -11, -10, -15, -20, -15, -26, -19, -10, 4, -23, -33, -8, -7, -31, -13, -2, -17, -30, -13, -1, -6, -17, 3, 4, -1, 6, -14, 6, 5, 8, 6, -17, 9, -13, -19, 7, -5, 10, -14, 12, 2, -6, -11, 5, -3, -21, 0, -1, 5, 12, -2, 5, -8, -18, -17, 0, 2, 5, 6, 7, 3, -1, -22, 1, -15, 0, -21, -14, 1, -18, -13, -15, 4, -12, -15, -7, 8, -13, -1, 4, -2, -15, 5, -13, -12, -15, 1, 8, -24, -13, -16, -17, -20, -32, -10, -2, -18, -9, -5, -3, -6, 10, -16, -9, 7, -11, -8, 1, -16, -2, -13, -21, -16, 9, 2, -15, -9, -13, -16, -16, -6, -29, -22, -20, -28, -32, 2, -6, -12, -9, -9, -26, -10, -15, -12, -14, 5, -7, -15, -17, -17, 9, 0, 9, -2, -3, -30, -18, -2, -2, -33, -17, -22, -17, -4, 0, 4, -23, -13, -17, -3, -6, -19, 8, -5, -16, 0, -12, 8, -8, 1, -3, 6, 13, -7, 13, 17, -17, -16, -1, -8, -8, 4, 6, -23, -20, -2, -5, -1, -21, -1, 4, 7, -6, 3, 2, 13, 0, 36, 15, 6, 13, 30, 23, 3, 6, -2, -16, -17, -6, 15, -7, 2, -1, -12, -5, 24, 1, -19, -1, 11, -9, -3, -9, 7, 10, 35, 8, 7, 1, 22, 5, 12, -1, -8, -15, -1, -19, -6, -4, -11, -8, -17, 9, 25, 5, -8, -4, 9, 3, -17, -11, 18, -3, 16, 17, -2, 4, 13, -2, -13, 1, -11, -11, -13, -24, 5, -10, -7, 7, -11, 29, 5, 39, 14, -7, -10, 3, 10, 7, 5, 8, 5, -20, -3, 20, -10, -26, -3, 0, -14, -28, -8, 14, 27, 18, -17, -11, 25, 28, 11, 4, 9, -10, 10, 0, -9, 10, 9, -2, -20, -34, -14, 6, -19, -12, -4, -27, -25, -21, 13, 12, 21, -16, -21, 10, 9, -7, 1, 9, 3, -3, -2, 11, 4, 1, 8, 1, -5, -32, -15, 5, -2, -4, -8, 10, -29, -32, 10, 19, -4, -5, -23, -29, -26, -22, -21, -10, -1, -18, 2, -5, -19, -7, -8, -2, -26, 6, -10, -1, 14, 18, 24, 24, -8, 10, -16, -9, -18, 6, -25, -7, -4, -37, -35, -6, 8, -18, -12, -19, 4, -16, -3, 0, -17, 4, 20, 25, 24, 29, 34, 17, 22, -13, -9, -5, -1, 18, -18, 0, 4, -14, -35, -33, -22, -18, 2, -10, -15, -12, -4, -5, -8, -14, 15, 9, 20, 14, 10, 9, -2, 8, 26, -7, 4, 3, 13, 0, 19, 0, -23, -15, -13, 8, -14, -10, 9, -2, -12, 5, 8, -9, 6, 23, 8, 24, 23, 36, 34, 8, 37, 20, 9, -7, 17, 10, 22, 42, 18, -25, -8, -16, -6, -10, 11, 7, -14, -5, -22, -16, -15, 4, 27, 11, -5, 19, 8, -1, 12, 10, 13, 29, 7, 6, 9, 16, 21, -20, -25, -8, -15, -20, -6, -1, -4, 5, -40, -29, -29, -31, -26, -7, -1, 12, -3, -6, 21, 5, 14, 12, 4, -17, 14, 6, -8, -15, -6, -24, 8, -14, 3, -14, 2, -4, -32, -20, -41, -43, -43, -25, -19, -8, -7, 7, 1, 11, 0, 12, -21, -2, 3, -6, -27, -22, -5, -14, -20, -8, 2, 7, 8, 10, -9, -17, -46, -57, -56, -37, -36, -25, -43, -26, -9, -4, -4, 2, -19, -11, 1, -2, -8, -8, -16, 7, 4, 1, -8, 3, -1, 12, -12, -3, -28, -40, -29, -47, -46, -30, -49, -39, -25, 0, -14, 11, -2, -8, -3, -7, -12, -7, 5, -1, -21, -7, -12, 14, 12, -2, -9, 14, -17, -4, -17, -35, -27, -33, -33, -31, 11, -6, -4, 10, 11, 10, 1, -20, -8, -14, 9, -11, 8, -17, -13, -14, 14, 13, 0, 29, 21, -1, -1, -13, 7, -21, -24, -3, -21, -9, -4, 10, 15, -8, -18, 7, 4, 9, 1, -20, -4, -9, 5, 2, 15, 7, 30, 33, 33, 34, 7, 36, 7, 19, 19, 25, 16, 4, -7, 10, 1, 9, -25, -33, -10, 0, -18, -10, 1, 4, 4, -10, 6, -4, 4, 25, 50, 33, 23, 29, 29, 31, 27, 10, 18, 9, 14, -1, 8, -13, -5, 9, -5, 4, 6, -2, -15, -17, 3, -19, 8, 8, 20, 7, 10, 27, 8, 33, 27, 1, 29, 7, 8, 2, -2, 1, -24, -19, -20, -2, 11, -13, -7, 1, 3, -20, -16, -5, 11, -16, -6, -7, 1, -22, -18, -15, -7, -28, -7, -26, -35, -32, -16, -40, -12, -6, -3, -8, -21, 2, -18, -14, -13, 4, -10, 7, -11, -12, -6, -2, -18, -1, 11, -4, -23, -18, -21, -15, 1, -8, -4, -19, -8, -3, 6, -5, -6, 1, -11, -11, 2, 2, 2, 1, -16, -10, -2, -1, -24, -7, 5, -2, 8, 1, -24, -24, -22, 2, 0, -2, -19, -17, -5, 2, 5, 8, -21, -10, 8, -24, 10, 8, -15, -21, -3, -24, -3, -7, 2, -24, -6, -12, 0, -14, -20, -23, -24, -14, -16, -6, -13, -4, 0, -7, -21, -20, 4, -14, -2, -3, 1, -17, -22, -2, -8, -22, -19, 1, 9, -15, 9, -9, -1, -21, 2, -8, -17, 1, -15, 1, 1, -9, 8, -21, -15, 7, 1, -10, -17, -4, -20, 7, -1, -2, 14, 22, 17, 24, 14, 30, 7, 13, 0, -4, 10, -8, -3, -15, -10, -4, 6, -25, 2, 4, -15, -17, 5, -21, 13, -2, 7, 34, 18, 19, 0, 7, 25, -2, 13, 17, 16, 15, 1, 7, -5, -27, -24, -28, 8, -21, -11, 3, -6, -13, 3, 15, 16, 9, 28, 13, 2, -5, 7, 15, -10, -10, 3, 15, 4, 3, 10, -1, -6, -4, -9, -15, 4, 1, 2, -9, -4, 2, -2, 20, -1, -4, 3, 8, 5, 4, -10, 12, 9, 13, -13, -13, 0, -6, -3, -16, -28, -5, -23, 2, -4, -20, -15, -22, 0, -21, -5, 24, 30, 0, 17, -5, 4, -25, 1, -19, -8, -6, 12, 1, -33, -2, -12, -26, -23, -14, -25, -12, -32, -10, 5, -22, 8, -1, -12, 16, -3, 7, 21, -19, -15, -23, -16, -16, 2, 6, -8, -19, -20, -18, -5, -19, 1, -5, -23, -27, -19, 5, -16, -4, -13, 2, -4, 7, 2, -13, -14, 13, -15, -24, -2, -1, -17, 2, -17, 8, 6, 22, 9, 8, 1, 1, -31, -31, -41, -25, -3, -24, -25, -31, -20, 15, -11, 2, -11, 3, -12, -5, -23, 4, -21, -1, 4, 18, 31, 19, -2, -14, -15, -9, -20, -26, -16, -2, -23, -2, -5, -6, -14, -10, 9, 0, -17, 9, -7, -2, -14, -2, -24, 8, 7, 16, 7, 8, 13, -8, -24, -15, -20, -26, -30, -18, -8, -17, -1, -7, -16, 1, -23, -26, -10, -19, -18, 10, -12, 1, -2, 7, 23, 19, 30, 22, -3, 3, -4, -20, -15, 0, -8, 4, -11, 1, -12, -22, -5, -34, -5, 3, -18, -6, -10, -33, 8, 17, 33, 31, 23, 29, 8, 22, -16, -26, -32, 0, -4, 0, -10, -3, -6, 4, 9, -11, -20, -30, -27, -16, -12, -7, -1, -10, -14, -1, 5, 31, 18, 21, -1, 4, -3, -41, -18, -12, -25, -24, 8, -5, -21, -9, 6, -6, 8, -9, -10, 0, -28, -24, -12, -20, 3, 17, 29, 40, 23, 32, 4, -10, -16, -8, 2, -18, -2, 5, 9, -14, 3, -7, -10, -14, 12, 16, 0, -2, 9, -22, -6, 5, -1, 19, 10, 15, 2, -14, -9, 12, 14, -13, 4, 22, 4, 28, 2, -14, -16, 4, -19, -8, 16, 22, -17, -14, 28, 18, 0, -11, 1, 1, 26, 0, 8, -11, 6, 11, 16, 11, 24, 21, 9, 0, 0, -11, -22, -10, 1, -20, 1, 1, 27, 6, 2, 8, 6, 3, -8, 1, 8, 7, -12, -3, 1, 21, 19, -4, 26, 5, 5, -2, -6, -15, 0, 8, -3, -19, 10, -9, 12, 28, 25, -14, 15, -10, 13, 0, -9, 6, 3, 0, 25, 12, 13, 2, 24, 10, 16, -9, -8, -9, -22, -9, 8, -4, 17, 6, 17, 10, 18, 2, 11, -3, -2, -3, -20, 15, 4, 24, 16, 18, 0, 19, 26, 1, 15, 1, -6, 6, -12, -21, 8, 0, 9, 21, -4, 11, 25, 11, 1, 12, 12, -1, 3, 14, 18, 2, 27, 28, 37, 9, 0, 7, -6, -3, -17, 7, -17, -18, -5, -7, 3, 22, 11, -14, -1, -11, 10, -8, 10, 4, 1, -8, -1, 7, -6, 4, 28, 23, 25, 14, -6, 0, -3, -23, -6, -16, -8, 9, 6, -4, 10, -6, 1, -9, -8, 5, 5, 5, -20, -17, -3, -3, -3, 52, 22, 28, 16, 7, 2, 4, -2, -13, -23, 4, 7, -4, -1, 15, -2, -2, -12, 4, -26, -21, -17, -20, -23, 3, -18, 4, 9, 5, 4, 13, 11, 1, -12, -16, 11, -22, -11, -20, -13, -15, 3, -18, -12, -2, -10, 19, 17, -1, -9, 7, 9, 17, -1, -16, -19, 3, -10, -6, 2, -14, -24, 4, 9, 1, -5, -14, -21, 3, 9, -15, -8, -1, -14, -1, -22, -21, 10, -9, -25, -11, -31, -4, -5, -1, -18, 5, -11, -14, -6, -14, 4, 3, 1, 7, -3, 4, -1, 4, -22, -18, -12, -3, -17, -24, -2, 3, -25, 1, -24, 0, -7, -7, 3, -4, -14, -19, -15, 9, -24, 4, 9, -1, -14, -13, 9, -12, -5, -11, 5, -19, -12, -8, 2, -6, 8, -10, -14, -7, -10, -3, 3, 4, -19, -11, 12, 2, -16, 6, 8, -21, -20, 9, -17, 1, 9, 3, -9, 15, 8, -3, 10, -5, -17, -10, 7, -1, -1, -8, 5, -11, -16, -14, -5, -11, -18, 10, -19, -2, -11, 1, 2, -19, -14, -6, 8, 12, 8, 12, 7, 5, 6, -3, 7, -5, -3, 15, 22, 6, -10, -3, -5, 6, -14, -18, 4, -11, 12, 7, -19, 10, -9, -8, -8, 0, 40, 27, 11, 24, 31, 7, 24, 21, -4, 2, 18, 1, 19, -4, 13, -3, -16, -18, 8, -7, 0, -6, 6, -23, 0, 15, 1, -11, 31, 17, 21, -2, 13, 17, 14, 1, 17, 7, -4, -15, -8, -2, -4, -14, 2, 10, -7, 4, -16, -9, -7, -11, -19, -21, -3, 11, -2, 19, 10, 3, -9, -18, -26, -9, -9, -2, 7, 9, 8, -15, -5, 1, -8, -2, 7, -12, -10, 10, -21, 5, 4, -7, 2, 20, -15, -18, -27, -2, -14, -5, -22, -26, -15, -12, -18, -27, 0, 4, -11, -24, 10, -3, 4, -18, -3, -12, -11, -6, -22, -10, 4, -3, -12, -23, 5, -22, -6, -19, -20, -44, -23, -37, -19, -29, 0, -16, -25, -9, 11, -10, -15, 11, -9, 11, -23, -3, -7, -14, -12, 8, 14, -6, -11, -3, 6, -20, -21, -33, -4, -34, -27, -21, -22, -11, -11, -30, -17, -8, -5, 10, -12, 12, -20, -21, 11, -20, -14, -11, -8, -25, -6, -21, -23, -14, -8, 9, -7, -8, -31, -19, -3, -23, -28, 4, 7, 11, -8, 5, -10, 15, -21, -22, -10, 3, -1, -12, -5, -20, -3, -9, -23, 0, 3, 9, -12, 1, -20, 9, 8, -15, 15, 12, 3, -20, 8, 5, -5, -14, -5, -27, -20, -29, -15, -23, -5, -19, -37, -23, -21, -29, -16, -4, -22, -6, -3, -7, 21, 15, 25, -1, -9, 1, 6, 5, 12, -4, -4, -35, -26, -21, -24, -18, -35, -21, -7, -4, 3, -14, -10, -28, -16, -3, -16, -24, -4, 10, -9, 27, 7, -21, 11, 4, -17, -11, -2, -28, -46, -40, -10, -20, -14, -4, 15, 20, -12, 6, -1, -14, -4, -26, 6, 0, 2, 8, 15, 46, 26, -6, -2, 4, -12, 11, -14, -30, -16, -12, -11, 1, 32, 20, 38, 24, -9, -26, -20, -23, -12, -12, 2, 7, 18, 16, 21, 40, 14, 11, 8, 0, 1, 6, 5, -21, -15, 15, 15, 7, 10, 44, 46, 7, 12, -6, -18, 3, -12, 3, 6, -13, 12, 18, 33, 30, 16, -10, -5, 8, 6, -3, 19, 8, 21, 16, -4, 13, 6, 23, 40, 5, 3, -9, 8, 5, 12, 16, 12, 0, 23, 26, 31, 25, 33, 24, 5, 6, -19, -3, -3, -4, 19, 10, -11, 19, 9, 27, 7, -14, -19, -10, 8, 0, 14, 33, 3, -7, 25, 4, 22, 23, 23, 17, 9, 2, 9, -12, 2, 23, 15, -1, 22, 7, -8, 5, 9, 6, 14, 0, 10, 29, 25, 10, -8, 18, 0, 25, 28, 14, 15, -17, -10, -18, -15, -13, 7, 10, 9, 14, 8, -4, 10, 13, 12, 0, 22, 17, 19, 7, 20, 14, 6, 24, 18, 30, 6, 22, 26, 5, -2, 0, -18, 9, 3, 8, 27, -16, 10, 3, 5, 21, 26, 32, 17, 25, 19, -8, -10, 21, 16, 1, 17, 0, -1, -13, 10, -12, -5, 12, -18, 6, -2, 18, -7, -19, 15, -4, 14, 23, 5, 32, 5, -4, -13, -4, -5, -15, -16, 2, -11, 17, 2, -10, 8, -15, -6, -21, 6, -8, -15, -4, 12, -7, 15, 6, 16, 20, 10, -6, 5, -34, -8, -11, -27, -12, -16, -7, 2, -15, -11, -20, 3, 8, -1, -19, -20, 8, 8, 11, -13, -9, -20, -22, 6, -18, -25, 4, -8, -10, -30, -38, -36, -34, -46, -33, -21, -5, -25, -1, 9, 4, 13, 1, 13, -17, -11, -12, -22, -20, -2, -24, -20, -38, -25, -35, -11, -14, -39, -40, -34, -39, -42, -36, -12, -28, -21, 7, 10, 3, -1, 11, -7, -10, 10, 8, -4, -28, -18, -19, -14, -31, -39, -21, -49, -49, -21, -28, -32, -15, -33, -7, 3, 5, 2, 5, -11, -6, -10, -21, 7, -6, -5, -20, -17, -4, -18, -1, 11, -1, -5, -19, -18, -22, 6, -17, -9, 7, 5, -17, 2, -12, 12, 2, -13, 13, -20, -16, 3, -1, 13, 12, 9, -7, -14, -18, 6, -16, 13, -20, -9, -13, 13, 13, 5, -19, 6, -19, 4, 11, 7, 9, -18, 3, -17, -9, 0, -19, -10, -15, -16, 11, -3, -21, 8, 8, -8, 12, 4, -14, -3, 6, -13, -20, 2, 2, 0, 5, -17, 1, -9, -8, -19, 2, 5, 10, -12, 2, -15, 13, 0, 11, 4, -15, 9, 2, -9, -18, -6, 0, -22, 0, -22, -13, 8, 13, 11, 1, -11, 7, -5, -10, -2, 7, 2, 12, 0, -19, 2, 4, 9, -2, 1, -9, -4, 9, 5, 9, -10, -24, -5, 3, 7, 7, -14, -4, -15, 7, -8, -18, -13, 5, -9, -9, -4, 6, -2, -10, 13, 4, 14, 16, 0, -2, -9, -15, 15, 7, -6, 9, -11, 0, -25, -13, -19, -14, -18, -14, -9, -15, -6, 9, -10, 14, 18, 31, 37, 32, 23, 41, 47, 43, 43, 32, 4, 7, 19, -19, -13, -24, -36, 6, 12, 4, 9, -8, -18, -20, -10, 12, 22, 7, 14, 9, -11, 22, 1, 21, 2, 15, 13, 17, 19, 13, 5, 29, 13, 0, -34, 0, -10, -21, -21, -10, 4, -19, 7, -3, 14, 23, -10, 14, 21, 7, 3, 10, 20, -6, 23, 14, -3, 5, 7, 7, 24, -10, -5, -18, 1, 7, 2, -11, 7, -9, -17, 20, 13, 14, -1, -10, -4, -16, -2, 11, 19, 21, 5, 9, 11, 26, 20, -14, 13, 18, -3, 0, 2, -6, -6, -3, -15, 8, -7, 9, 7, 17, -3, -3, -3, -19, -5, 15, 3, -2, 11, 2, 19, 12, -4, 18, 8, -3, -9, -13, 6, -15, -5, -20, -19, -2, -14, 30, 3, 2, -12, -7, 13, -20, -1, 1, -8, 10, 24, 1, 34, 4, 27, 4, -7, 23, 26, -11, 10, -17, -16, -9, -22, -11, 0, 1, -2, -15, -27, -13, 6, 0, 2, -18, 29, 15, -3, -12, 31, 7, 21, 22, 23, 23, 9, 6, -15, 1, -7, 5, 5, -22, 4, 15, -28, -38, -10, -17, -2, -24, 5, 4, 25, -7, 5, -10, 1, 20, 9, 5, 2, -15, -8, -9, 9, -10, -20, -17, -21, -5, 2, -21, -13, -6, -10, -14, -4, -6, -34, -8, -4, 19, 9, 15, -12, -4, -6, -10, -14, -29, -32, 8, -13, -11, 2, -19, -9, 8, -9, -12, -41, -21, -2, -20, -26, -35, -40, 9, -5, -3, 4, -8, 7, -14, 7, -12, -41, -42, -26, -13, -4, -18, -6, 12, -16, 6, -20, -2, -9, -18, -20, -3, -27, -17, -15, 5, 23, 29, 6, -21, -10, -32, -24, -15, -38, -54, -44, -27, -1, -7, 11, 9, -11, -15, 7, -17, -23, -26, -10, -19, -14, -21, -25, 16, 25, 40, -17, 2, -13, -45, -11, -8, -13, -33, -11, -16, 0, 11, 9, -6, -20, -3, 11, 22, -5, -42, -25, 3, 6, 5, -10, -10, 22, 24, -29, -12, -36, -37, 3, -7, -11, -6, 7, 11, 3, -3, -16, -15, -11, -15, 25, 8, -3, -22, -12, -32, -4, -16, -32, -23, -6, -30, -37, -23, -19, -28, -3, 2, 2, 2, 12, -12, -10, -4, -16, -22, -3, -19, 24, 2, -2, 4, -4, -1, -21, -15, -35, -19, -27, -10, -12, 0, 14, -4, 1, -16, 5, 25, 16, 2, -18, 5, -10, -5, 11, -14, -8, 9, 12, 18, -4, -6, -5, -24, -25, -42, -6, -15, -11, 12, 26, 21, 27, -5, 34, 24, 18, 2, -17, 5, 5, 6, -16, 10, 22, 3, 13, 21, -1, 21, -8, 8, -23, -29, 8, 9, 19, 39, 20, 17, 40, 34, 22, 10, 17, -18, 10, -4, -20, 9, 9, 14, 19, 3, 20, 9, 15, 1, -8, -2, -10, -11, 11, 23, 26, 20, 11, 24, 44, 20, 7, 17, -2, -9, -20, -9, -21, -6, 9, -4, 19, 13, 6, 21, 16, 24, 15, 16, 11, 8, 19, 9, 8, 0, 36, 40, 35, 21, 12, -16, 1, 6, 4, 7, -6, -15, -7, 5, 0, 24, -5, 11, 33, 21, 22, 0, 34, 31, 9, 34, 32, 33, 26, 33, -4, -4, -10, -10, -8, 0, -7, 0, -6, -4, -6, -19, 6, -13, 9, -5, 13, 30, 38, 28, 31, 39, 19, 29, 17, 40, 9, 22, 16, -19, -21, 3, 3, -21, -21, 7, -2, 5, -13, -3, 5, -5, -4, 1, 6, 15, 14, -7, -18, 19, 4, -4, -14, 2, -1, -7, -3, -6, -11, 4, 9, -16, -8, -10, -2, 1, -19, -2, -2, 0, 1, 1, -8, 7, 1, -15, 12, -19, -18, -1, 1, -18, -4, -6, 2, -1, 6, -3, -9, -12, -7, -13, 4, -19, 3, 8, -9, 5, 4, 9, 9, -10, -5, -18, 5, 1, 7, -1, 9, -4, -19, -9, -6, -21, -15, -5, 0, -14, 10, 7, 6, -11, -7, 13, 7, 4, -10, 0, 14, -1, 9, -15, -14, -12, 14, 4, 10, -3, 3, -16, -8, 12, -8, -10, -4, 9, -1, 16, -7, -15, 6, -4, 1, -2, 15, -5, 13, 0, -2, -8, 8, 11, 1, -17, -13, 0, 7, -2, 8, 17, -2, -8, 14, 14, 6, 8, -14, -15, 7, -13, -15, 0, -10, -4, 7, 31, 35, 27, 49, 27, 3, 14, 16, 22, 20, 30, -5, -6, 24, 21, 17, 0, -5, -15, -4, -8, 6, -11, 4, 16, 10, -3, 5, 29, 43, 39, 30, 21, 40, 20, 9, 9, 25, -12, -2, -10, -4, -2, -4, 21, 0, 10, -15, -6, -7, 14, -13, -14, 9, 28, 33, 24, 12, 13, 8, 18, -13, 15, -16, -27, -17, -15, -18, -49, -51, -41, -24, -6, -11, 4, 18, 16, -3, 6, -7, 21, 6, 11, 35, 37, 47, 42, 20, 19, 5, 3, -17, -11, -69, -82, -61, -47, -46, -42, -26, -12, 2, -9, 1, 10, 16, 1, 7, 1, 12, 12, 41, 40, 18, 31, 30, 16, -3, -18, -16, -28, -43, -59, -51, -29, -42, -35, -13, -14, -2, -12, 17, 9, 0, -10, -7, 6, -3, -9, 1, 17, 19, 17, 19, 10, -13, -5, -11, -38, -34, -47, -37, -49, -43, -52, -24, -17, 2, -2, 4, 12, -6, 8, 5, 15, -9, 2, -25, 5, -7, -27, -28, -48, -58, -50, -53, -39, -43, -44, -55, -5, -8, -19, -21, -29, -25, -14, 0, -15, 12, -15, 11, 3, -25, -50, -33, -33, -44, -36, -42, -70, -91, -74, -55, -40, -37, -39, -32, 8, 12, -6, -28, -13, -33, -7, 7, 5, -8, -10, -21, -20, -26, -29, -28, -23, -51, -41, -74, -87, -85, -51, -16, 30, 2, -17, 7, -3, 6, 18, -2, -5, -17, -12, 1, 15, -4, 16, -4, 5, -29, -52, -17, -44, -34, -71, -55, -60, -11, 22, 19, 24, 10, 3, 5, 29, 51, 18, 22, 3, -20, -11, -4, 10, -2, -8, 19, 6, -15, -27, -40, -1, -33, -35, -26, -5, 26, 61, 55, 47, 21, 11, 36, 45, 24, 7, 17, 10, -6, 2, 10, 6, 11, 6, 1, 11, -4, -3, -10, -1, -34, -2, 14, 46, 64, 48, 39, 39, 1, 35, 48, 30, 5, -1, 51, 44, 2, -1, -9, -1, 12, 4, 4, 6, 7, 7, -10, -2, 12, 11, 29, 59, 49, 39, 37, 47, 20, 30, 47, 14, 30, 22, 59, 32, 15, 17, -11, 14, -12, 2, -9, -14, -2, 31, 19, 9, 6, 11, 28, 44, 32, 38, 32, 40, 13, 27, 39, 14, 30, 21, 25, 45, 23, -9, 1, -7, -16, 11, 10, 23, 39, 58, 12, -10, -16, -3, 13, 24, 22, 42, 6, 13, -4, 8, 20, 12, 33, 15, 19, 20, 45, -1, -5, 14, 5, 12, 22, 28, 34, 43, 4, -3, -2, 10, 32, 35, 18, 20, 18, 20, 11, 21, 6, -7, 3, 22, 3, 26, 51, 8, 10, 7, -15, 16, 17, 30, 1, -5, 22, 8, 1, 10, 20, 25, 18, 32, -3, 23, 37, 37, 22, 6, -14, -10, 1, 28, 40, 2, 13, 8, 9, -1, 16, 24, 15, 17, 7, -10, 3, 10, 36, 26, 32, 20, 29, 18, 10, 10, -22, -30, 0, -12, 8, -13, 14, 9, -18, 3, 10, -7, 27, -4, 10, -30, -4, -7, -14, 9, 8, 21, 28, 25, -1, 6, -2, -22, -40, -43, -23, -62, -52, -11, -3, -13, 2, -4, 3, 7, 23, 1, -16, -39, -40, -10, -32, -7, -14, -5, -2, -5, -1, 2, -38, -27, -31, -56, -37, -54, -43, -38, -5, -11, 2, 13, 16, 14, -16, 4, -23, -58, -36, -25, 6, 7, -26, -31, -28, -35, -41, -29, -55, -70, -60, -41, -46, -52, -34, -25, -18, -2, -13, -7, 11, 4, -5, -16, -16, -17, 6, -26, -16, -4, -26, -29, -36, -31, -25, -57, -58, -64, -52, -27, -22, -16, -22, -7, 4, 10, -5, -6, -9, 13, -15, 13, -1, -3, 0, 19, -16, -16, 4, -6, -7, -7, -49, -46, -27, -63, -60, -35, 4, -29, -23, -6, 1, -5, -15, -16, 5, -13, 7, -1, -13, 12, 10, -21, -7, 0, -4, -6, 10, -6, 2, -13, -11, -24, -39, -9, -26, -12, -8, -13, -6, -11, -15, 7, -8, -1, 4, -14, 10, -14, -9, -1, -11, -11, -19, -10, 7, -1, 9, -14, -6, -13, -20, 6, -2, -3, -12, -11, -2, -5, -2, -6, 14, 2, 5, 4, -17, 13, -17, -9, 0, 6, 2, 5, -1, -15, -5, 3, 14, -2, 15, -6, -13, -2, 16, 5, -3, 0, -5, -14, -3, 1, -19, -10, 5, -13, 13, 5, 7, -11, -13, 7, -3, 11, 14, 5, 7, -9, 7, -3, 0, 7, -13, 10, 15, -5, -19, 15, 11, -11, 9, -17, 2, -14, -8, -12, -2, -3, -10, -12, -1, 15, 8, 17, 11, 6, -3, -10, -10, -4, 11, -7, 5, -15, 2, 8, -19, -4, -14, 10, 8, -16, -2, 2, 10, -8, -10, 2, 1, 6, -2, 6, 2, 6, 0, 8, 2, -3, -11, 8, -3, 1, 1, 7, -3, -1, -11, 6, -2, 0, 1, -22, -16, -8, -35, -30, 6, -8, -3, -13, 4, -31, -20, -4, -26, -1, -2, -13, -1, -7, 11, -6, -9, 3, -6, -5, -23, -6, -4, -9, -34, -26, -16, -43, -8, -28, 1, -24, -11, -25, -17, -15, -32, -9, -13, -2, 1, -15, -6, 12, 13, 13, 3, 4, -4, -4, -2, -12, -5, -10, -24, -8, -7, -2, -4, -13, -12, -13, -9, -18, -16, -24, -25, -12, 15, -1, -12, 6, 6, 5, -3, -11, -12, -7, -16, -20, -17, -20, -22, 1, 15, 17, 15, 15, 30, 26, 7, -12, -1, -5, -39, -21, -2, -18, 5, -9, 2, 16, 4, 16, -4, 7, -5, -36, -9, -9, -22, 20, 22, 4, 42, 31, 30, 46, 21, 39, 32, 16, 4, -3, -21, -9, -18, -10, -5, 1, -2, 3, 21, 2, 12, 15, 13, 17, -12, 21, 0, 37, 46, 46, 28, 43, 36, 10, 33, 3, 2, -2, -24, 8, 11, -12, -11, -1, 16, 9, 21, 9, 12, -11, -1, 13, 15, 31, 10, 30, 24, 29, 12, 36, 24, 14, 1, 17, 7, -3, -18, 3, -8, 8, 11, -10, 4, 1, 24, 13, -5, 0, -1, -1, 17, -5, 33, 34, 23, 38, 2, 35, 6, 4, 13, 36, 39, 13, -16, -14, 15, -8, -3, 16, 20, -5, -29, -4, 20, 10, -11, -2, -6, -6, -1, 0, -13, -22, 19, 16, 10, 32, 14, 36, 40, 37, -1, -2, -7, 9, -6, 15, 8, -12, -6, -13, -13, -4, 1, -5, -12, -49, -52, -14, -27, -2, -10, -2, -7, 1, 11, 17, 39, 8, 3, -16, -14, 1, -16, 15, -3, -3, -14, 10, -11, 7, 3, 7, -30, -32, -54, -21, -21, -18, -7, -7, -16, -6, 8, 5, 3, 9, -10, -14, 8, -13, 9, -6, 7, -4, -9, -8, -12, -2, -9, -9, -21, -8, -43, -22, -20, -21, 1, 2, 9, 8, 6, -15, 4, -1, -19, -7, 3, 11, -9, -2, 2, 1, 15, -1, 0, -15, 5, -6, -20, -37, -24, -24, -13, -14, -2, -1, 4, 3, -3, 2, -22, -14, -19, -19, 5, 2, -7, 13, -33, -2, -5, 4, -1, 14, 7, -5, 5, -33, -50, -54, -17, -11, -5, -14, -25, -31, -11, -8, -20, -12, 5, 5, -5, -8, -5, -19, -11, -9, -13, -5, 1, 17, 12, 17, -23, -37, -28, -38, -7, -12, -13, -14, -19, -14, -28, 0, -21, -2, -14, 7, -5, 4, 1, -1, -32, -6, -21, 8, 15, 12, 23, -2, -8, -20, -28, -3, -13, -24, -20, -2, -31, -13, 4, -23, -22, 1, -10, 11, -14, 3, -12, -10, -26, -28, -18, 5, -1, 11, -9, 7, -2, -15, -14, -24, -23, -14, 3, -32, -26, -19, -17, 1, -2, 3, 13, 7, 13, 1, 15, -13, -30, -2, -9, 0, 14, 8, -19, -5, 2, -1, 5, -25, -15, -11, -14, -26, -11, -38, -7, -31, -24, -10, -6, 10, -18, 8, -6, -17, -18, -12, -5, 18, 7, 13, -2, 11, -2, 12, -16, -13, -7, -21, -17, -10, -34, -24, -15, -31, -25, 6, 0, -7, 11, 8, -1, -6, -8, -18, 5, 38, 19, 8, 27, -8, -6, 13, 18, -8, -7, 6, -28, -24, -46, -54, -14, -35, -23, -9, 6, -5, 14, -11, -12, 0, -26, -13, -8, 14, 38, 18, 35, 23, 9, 14, 20, 4, 15, -6, 4, -21, -39, -57, -17, -29, 0, -8, -4, 4, 8, -1, -14, 7, -19, -13, -7, 16, -14, -8, 8, 24, 6, 17, 41, 26, 34, -2, 7, -25, -1, -7, 4, -18, -20, -13, 14, -17, -13, -7, -7, -9, 15, 9, 4, 0, -12, 19, 8, 14, 12, 5, 10, 0, 19, 14, 15, 10, 16, 17, -8, -2, -15, 14, 2, 15, 3, 11, -18, -18, 1, 9, 5, -5, -8, -1, 25, 2, 3, 4, 26, 21, 24, 40, 6, 32, 22, 9, -1, -8, 2, 8, 3, -8, 14, 7, -10, 13, -8, 3, -14, -3, -11, -3, -10, -15, 9, -1, -9, 21, 8, 8, -13, 17, -13, -15, 16, 10, 4, -10, -19, -6, -16, 10, -19, -14, 8, -14, 3, -12, -6, -10, 12, 3, 2, 9, -10, -18, -4, -20, -13, -15, 7, -3, 13, 2, -3, 13, -9, -15, -12, -10, -2, 3, 10, -13, -2, -16, -11, -1, -4, -9, -15, -19, -12, 1, -14, -25, -12, -16, -16, -5, 6, -1, -14, -13, 7, -5, 3, 3, 7, -15, 7, -20, 2, -22, -23, 1, -1, -21, -19, -14, -36, -5, -33, -21, 1, -25, -6, -11, -7, -4, 5, 3, 10, -3, 12, 5, -11, 8, 4, -11, -16, -19, -9, -9, -39, -41, -32, -48, -53, -24, -39, -19, -5, -17, -21, -10, -15, -3, 10, -11, 6, 6, 0, -9, -11, -2, 3, -19, -27, -27, -13, -37, -59, -36, -27, -63, -34, -37, -41, -34, -11, -9, -16, -8, 12, 9, -2, 2, -18, 2, -3, -12, 12, -9, 8, -14, -4, -17, -37, -29, -47, -47, -49, -19, -29, -15, -27, -17, -20, -8, -21, -11, -21, -13, 3, -9, 9, -17, -10, -2, -21, -18, 4, 3, 2, -12, -21, -19, -15, -2, -11, 5, 8, 12, 16, -1, 8, 7, 3, 23, -1, 0, -14, -3, -1, 3, 10, 1, -14, -15, -14, 14, -12, 16, 23, 13, 2, 28, 20, 36, 40, 40, 36, 26, 28, 7, 25, 22, 8, 4, -13, 5, -24, 4, -12, 7, -9, 7, 14, 19, -12, 3, 12, 27, 33, 39, 33, 39, 19, 5, 22, 21, 9, 4, 8, 8, 10, 25, 11, -5, 6, 8, 0, 0, -8, -6, 16, 9, 28, 49, 29, 36, 20, 13, 24, 12, 0, -18, 1, -8, 3, 17, -3, 14, 41, 38, 7, 11, 8, -13, -17, -14, 2, 3, 21, 20, 2, 22, 22, 31, 8, 1, -26, -27, -53, -62, -42, -11, -12, 15, 14, 17, 31, 21, 2, 9, 6, -11, -9, -3, -14, -21, 21, -1, 21, 12, 17, 28, 8, -10, -36, -48, -48, -60, -15, 8, 14, 13, -4, 13, 28, 18, 13, 5, 1, -16, 12, 8, 3, 8, -5, 3, 10, 15, 1, -6, -13, -14, -48, -35, -53, -22, -6, 16, 17, 7, 21, 39, 13, -9, -13, -27, -11, -8, -15, 8, 0, -11, 3, 27, 6, 21, 30, 25, -6, -3, -1, 0, 2, 13, 11, 0, 27, -2, 15, 23, 7, -8, -18, -30, -13, -19, -18, -17, -8, 5, 5, 32, -1, -8, 18, 41, 26, 26, 36, 31, 34, 27, 17, 22, 7, 7, 2, 29, 2, -24, -2, -7, 0, -4, -17, 7, 6, -9, 14, -9, -16, 2, -8, 44, 26, 58, 50, 46, 47, 36, 16, 12, 10, 8, -8, 6, 2, 10, -8, -31, -37, -18, -16, -13, -6, 13, 14, -13, -6, -13, -7, 29, 28, 35, 42, 56, 43, 36, 32, 14, 23, 15, -2, -17, -20, -18, 5, -31, -13, 8, -22, 11, -17, 7, -5, 2, -20, -7, -13, 4, -16, 9, -5, 24, 40, 15, 31, 18, 9, 20, -8, -20, 6, -1, -24, -24, -7, 3, -4, 8, -16, 13, 8, 6, -34, -17, -26, -35, -29, -24, -4, -27, 9, -7, 10, 3, -5, -17, -12, 7, 4, -10, -44, -19, -17, 13, -16, -6, 3, 2, 23, 1, -29, -22, -33, -44, -33, -25, -34, -16, -33, -11, -21, 16, -7, -9, -15, -8, -17, -32, -42, -37, -11, 5, -7, 12, -15, 0, 2, -7, -4, -4, -26, -30, -46, -40, -39, -50, -27, -1, -22, -11, -12, -3, -25, 3, -4, -28, -4, 3, -12, 8, 9, 13, -14, 13, -5, -6, 9, 0, -19, -28, -12, -30, -22, -10, -41, -17, -24, -5, -34, -34, -3, -10, -9, -3, 6, -13, 8, 11, 11, 3, 6, -6, 17, 6, 14, -21, 0, -25, -29, -19, -16, -27, -15, -17, -15, -35, -11, -21, -8, -16, -1, 4, 11, -4, 12, -21, -21, -17, -12, 8, -11, 10, 13, 31, 19, 13, -4, 5, -13, -36, -5, -17, -19, -25, -21, 5, -8, 7, -15, -6, -15, 2, 10, -4, -12, 6, -19, -3, 16, 23, 21, 32, 27, 7, 23, 18, -3, 9, 9, -5, 22, 12, 3, -1, 15, 6, -7, 14, -14, -17, 3, 0, -18, -4, 10, -7, -11, -8, 18, 30, 47, 32, 45, 45, 44, 19, 32, 18, 26, 0, 25, 25, 8, 5, 22, -2, 1, -2, 5, -5, -14, 6, 13, 2, 9, 11, -1, 1, 9, 25, 36, 18, 12, 27, 22, 36, 29, 13, 31, 16, 6, 2, -4, -6, -17, -2, 1, 1, -13, -16, 9, -14, -2, -18, 7, -19, 5, 3, 6, -20, -18, 0, -14, -14, 14, 10, -13, 11, -2, 9, -18, -16, -21, -13, -20, 0, -21, -8, -8, -3, -7, 2, 10, 0, 1, -2, -9, -4, 2, 1, -13, 18, 14, -4, -7, 6, 20, 8, -11, 8, 10, 19, 12, 16, -8, 2, 15, -5, -1, 15, 15, -4, 13, -13, 14, 0, -11, 14, 18, 18, 8, -1, 3, 20, 17, -10, 10, -7, 13, -5, 15, -12, 8, 3, 11, -2, 16, 21, -5, -2, 6, 17, 13, 11, -9, 10, -10, -10, 14, 10, -4, 2, -14, -14, 6, -12, 15, -10, 8, 7, 2, -11, 17, -1, 21, -11, 18, -6, 3, -3, -2, 1, -2, -10, -18, 1, 5, -1, -11, 8, -2, -15, -2, 2, 6, -4, -1, 19, 9, 16, 1, -7, -12, 0, -2, 11, -14, -16, -4, -11, -3, 2, 4, 4, 17, 4, 5, 8, 6, 30, 16, 15, 13, -7, 11, 14, -3, 11, 1, 13, -11, -10, -2, 20, 15, 11, -5, -13, -16, -28, -14, 11, 30, 17, -8, -11, 16, -5, 5, 13, -14, 1, 13, -8, 5, 13, -5, 18, 15, -5, 11, 6, -8, 0, -18, -14, 2, -4, 5, -5, 12, 20, 2, -21, 0, -4, 18, -9, -1, -22, 12, 4, -6, 4, -7, -10, -12, -4, -1, -4, -10, -3, 5, -5, -5, -20, -12, 3, 29, 15, -14, -4, -5, -10, -14, -10, -13, 0, -5, 22, 8, 3, -7, 7, 0, 10, 21, 3, 5, -6, 0, 19, -8, 8, 17, 0, 22, -8, -4, -9, 4, -6, -14, -24, -33, -26, 20, -5, -5, 6, 13, -7, 7, 15, 11, -4, -9, 2, 6, 11, -3, 8, 2, 12, -1, 4, -1, 1, -13, -3, -12, -23, -10, -3, 6, -1, 16, 17, 13, 14, 4, 14, -8, -15, -23, -11, 15, 33, 11, -2, -1, 4, 12, 2, 30, 7, 9, -22, -8, -27, -51, -26, -4, 4, 4, 9, 12, 14, 1, -24, -32, -12, 16, 16, 7, 42, 2, 5, -2, 12, 19, 8, 10, -10, 13, 7, -18, -32, -32, -8, -29, -7, -3, -13, 14, 9, -1, -16, -11, -10, 12, 13, 35, -6, -13, 0, 9, 30, 19, 40, 36, 9, 10, -19, -23, -10, -15, 0, -16, 10, 0, -4, 15, -11, 17, -15, -6, -18, -8, 15, -4, -10, -1, 6, 25, 13, 22, 34, 8, -6, -8, -21, -31, 4, -20, -28, -4, 5, 3, 21, -12, 8, 10, 11, -26, -25, -18, -13, -18, -31, -24, 10, 34, 46, 37, 20, 26, -12, -37, -65, -24, -29, -9, -4, 15, -1, 17, -4, -4, -9, 5, -16, -14, -22, -30, -55, -46, -43, -19, 8, 12, 14, 44, 18, -11, -41, -32, -40, -56, -45, -26, -26, 5, -5, 2, 4, 16, -7, 11, -8, -10, -48, -49, -54, -25, -31, -20, 6, 1, 16, 17, 22, -15, -30, -40, -40, -45, -39, -5, -10, 11, 12, -2, 9, 13, 10, -1, -2, -45, -58, -78, -42, -23, 17, 5, 22, 8, 21, 26, 10, -12, -14, -32, -25, -14, -12, 2, -19, -18, 20, 19, 8, -5, 2, 9, -12, -27, -75, -60, -58, 12, 2, -10, -8, 18, 25, 25, 10, -20, -10, -22, 10, -17, -20, -32, 9, 15, -5, 16, 21, 8, 15, -13, -25, -46, -38, -30, -23, 5, 18, 6, 1, 14, -7, -1, 6, 10, 15, -15, 12, -26, -10, -8, -3, 14, 1, -12, 11, 11, 15, -2, -28, -57, -26, -36, -8, 6, 31, 8, 3, 16, 24, -2, -1, 1, -1, -6, -18, -12, -13, -5, -1, 17, 15, 15, -12, -5, 3, -6, 6, -35, -28, -1, -23, -18, -9, 1, -13, -3, 24, -1, 4, 7, -15, 0, -18, 7, -14, -20, 15, 1, 11, 6, -10, 9, 18, 0, 11, 17, -23, -13, -18, -4, -17, -9, -4, -2, 6, 13, -11, -14, 12, -26, 4, 3, 7, 14, 4, 1, 18, 16, 4, 0, 3, -15, -22, -21, -16, -14, -7, -8, -28, -23, 17, 20, 6, 8, 31, 13, 1, 9, -11, -6, -10, 14, 11, 5, 13, -10, 15, 17, 16, -14, -3, -6, -25, -12, -32, -10, -25, -8, 15, 10, -12, 0, -2, -5, 6, 39, 20, 12, -17, -11, -6, 6, 0, -6, 6, -11, -5, 21, -2, -8, -21, -28, 1, -3, -2, -26, -20, -21, 9, -20, 0, -13, 9, -5, -14, -18, -4, -9, 5, 7, 19, 20, 15, -11, -1, 9, 7, -5, 11, 18, 23, 13, 0, 9, -12, -23, -23, 5, 8, -11, 14, 13, 7, -3, 17, 3, -9, 2, 3, 9, -1, -13, 11, 3, -1, -12, 4, -3, -9, 10, -1, 19, 11, 9, 16, -8, -4, 14, 0, 10, -10, -7, 11, -13, 20, -5, 16, -10, 10, 4, 7, -19, -20, -5, 3, 14, -10, 13, -10, 6, 13, -13, -14, -20, -7, -13, 4, 9, -18, 10, 13, -6, -11, 4, -19, 9, 8, -6, -19, -8, 5, 11, 3, -12, -11, -17, -6, -15, -9, 0, -16, -13, 2, 6, -4, -4, 8, 8, 13, -10, -15, -12, -12, -6, 12, -17, -7, -7, -8, -16, 8, -14, 12, 13, -15, -11, -3, -16, -21, -17, 8, -12, -23, 0, -8, -19, 0, -8, 15, 9, -10, -10, 4, -9, -5, -17, 3, 8, -14, -3, 14, 22, 41, 45, 19, 17, -7, -28, -29, -24, -21, -27, -20, -14, -16, 2, 12, 0, -5, 1, -2, -13, 0, 0, 7, 10, 22, 32, 13, 23, 19, 15, 18, 14, -13, -18, -45, -60, -41, -30, -24, -16, -8, -15, 1, -1, -14, 0, 7, -19, -6, 1, 7, 28, 17, 15, 8, 23, 21, 13, 24, -5, -12, -14, -21, -29, -37, -21, -40, -34, -22, -23, -29, -15, 0, 0, 0, 3, 1, -3, 9, 7, 23, 17, 17, 27, 20, 39, 19, 40, 43, 31, 23, -6, -28, -40, -67, -35, -36, -34, -6, -22, -14, 6, 13, 14, 9, 22, 19, 6, 28, -12, -5, 30, 19, 46, 45, 56, 63, 53, 48, -8, -21, -60, -54, -60, -55, -49, -28, -24, -16, 10, -5, 7, 9, -12, 22, 7, -9, 1, 21, 12, 34, 19, 26, 48, 38, 27, 45, 26, 10, -5, -62, -59, -34, -57, -37, -8, -14, -16, -4, 1, 5, 11, 23, 1, 14, -11, 6, 17, 22, -11, 32, 32, 55, 35, 39, 32, 9, 1, -36, -63, -49, -56, -13, -15, 5, 13, -1, -16, 7, 16, -18, 22, 11, 2, 8, -9, -2, 1, -6, 13, 33, 21, 37, 15, 15, 7, -10, -51, -50, -16, -3, 12, 13, 4, 6, 9, -3, -3, 15, 7, 13, 11, -8, -33, -40, -19, -19, -28, -14, -4, 2, 22, 29, 34, -6, -44, -30, -35, -21, 0, -14, -13, -16, 1, 0, -14, -12, -25, -11, -12, -28, -13, -21, -42, -36, -25, -3, 20, 0, 21, 30, -1, -25, -42, -63, -31, -31, -1, 15, 9, 6, 0, 3, 7, -25, -31, -28, -5, 0, -26, -15, -50, -40, -12, -11, 4, 2, 28, 26, -29, -42, -42, -37, -24, -21, 14, 17, 2, -12, -16, 5, -10, -21, -37, -32, -4, -15, -5, -22, -34, -31, -7, -11, 9, -4, 12, -4, -27, -27, -35, -39, -37, -6, -15, -8, 7, 12, -13, -16, -6, -20, -35, -7, -11, -3, -8, -15, -10, -11, 2, -1, 3, -4, 3, -16, -32, -31, -16, -19, -5, -7, 15, 21, -14, 5, 1, 4, -4, 2, -14, -23, -12, -9, 13, 3, 1, -11, -17, -17, -20, -10, -16, -26, -12, -2, 2, 3, 20, 8, 14, 24, 16, 7, 2, 1, -3, -4, -5, -9, -16, -21, -4, 4, -17, -15, -31, -10, -15, -12, -15, -18, -34, -6, 20, 2, -8, 19, 44, 3, -11, -15, 9, 12, 9, 6, -3, -18, -18, 5, -1, -11, -14, -39, -23, 11, -12, 12, -10, -3, 16, 20, 15, 42, 29, 22, 39, 1, 16, -17, -17, -21, -1, -7, -3, -39, -6, 4, -18, -1, 2, 9, 12, -1, -4, 6, -5, 20, 5, 4, 32, 36, 22, 18, 30, 16, -2, -16, -8, 10, -17, -23, -12, -34, -8, -6, 16, 3, 17, -7, 22, 7, 12, 3, 6, -7, 23, 39, 36, 0, 29, 10, 16, -9, -9, 13, -18, 6, -5, 12, -9, -20, -6, -15, 13, 10, -5, -7, 12, 7, 11, 5, -24, 2, 25, -1, 17, 11, 4, 6, -10, 5, 10, -3, -18, 0, -5, -1, 3, 21, -3, 16, 11, 1, -3, -10, -6, 4, -7, 4, -6, -5, 20, 9, 10, 3, 23, 3, -2, 8, -18, -5, -18, 3, 16, 13, 14, 3, 16, -3, 8, 12, 5, 35, 5, 9, 11, -10, 3, -6, -10, -2, 7, -6, 0, 15, 0, 3, 1, -12, -16, 0, -10, -15, 1, -1, -6, -26, -21, -7, -1, 19, -12, 4, 3, 10, 19, -2, 14, -7, 1, -15, 15, 3, -14, -5, -2, 8, -8, -12, -11, 9, 11, 6, 18, -2, -12, -3, 0, 19, 30, 2, 19, 15, 25, 31, 17, 8, 7, -3, -14, 4, -14, -12, 2, -11, -1, -6, 3, 3, 2, -2, 14, 2, 19, 12, 39, 25, 47, 28, 15, 20, 25, 34, 2, 16, 7, 4, 12, -18, 9, -8, -6, 13, -1, -3, -19, 5, 13, 0, 13, -9, 3, 4, -3, -8, 10, 8, 14, 11, -7, -1, 9, 6, 14, 2, -3, -16, -9, 9, 4, -4, 21, -6, 18, 0, 5, 4, 3, -9, 6, 3, 5, -4, -2, 19, 11, 13, 20, 16, 18, 17, -9, -11, 11, 7, 7, 15, -1, -8, 15, 22, 18, -1, 6, 14, 9, 1, 4, 0, 11, 15, 23, -2, 16, 13, -2, -2, -2, -8, 9, -3, 21, 18, 13, 10, 18, 6, 5, 12, -5, 18, 13, 13, 9, 20, -4, 23, 29, 34, 9, 30, 8, 3, 6, 17, 8, 30, 16, 1, 18, -9, -8, -3, 9, 21, 2, 7, -8, 1, 10, 4, 12, -3, 5, 5, 29, 29, 33, 11, 28, 9, 17, 2, 1, 8, 11, 23, -3, 10, 8, -1, 21, 10, 6, -12, 15, 6, 5, 13, 0, 17, -20, -18, 0, -16, 9, -12, -16, -5, -19, -4, 3, 1, -5, -16, -6, -30, -8, -2, 10, 2, 1, -6, -2, 4, 31, 37, 6, -10, -18, -25, -11, -11, 20, 6, 1, 15, -18, -8, -21, -36, -40, -41, -21, -35, 4, -13, 8, 17, 11, 6, 21, 12, -9, -12, -15, 9, 5, -2, 1, -16, -8, 5, 30, 10, -6, -17, -41, -50, -50, -31, -22, -25, -17, -5, 12, 2, 12, 19, 21, 42, 17, 3, -16, -6, -6, -11, -13, 6, 14, 41, 18, 22, -24, -19, -31, -49, -60, -22, -39, -13, -19, 11, 6, 8, -2, 6, 10, 28, 15, -17, 1, -27, -17, -25, -12, -22, 8, 24, 51, 23, -16, -58, -56, -62, -51, -21, -46, -19, -7, 1, -11, -2, -3, 24, 24, 31, 10, -13, 3, -36, -46, -41, -22, -3, 28, 71, 58, 4, -50, -63, -39, -45, -35, -24, -38, -13, -30, 2, 14, 7, -4, 3, 8, 15, -24, -23, -25, -62, -58, -29, 12, 31, 63, 63, 12, -34, -64, -38, -44, -24, -38, -7, -47, -18, -25, -7, 12, -10, -11, 2, 15, -3, -26, -52, -31, -65, -28, 18, 28, 34, 55, 56, -19, -77, -64, -35, -36, -1, 0, -22, -19, -57, -26, -21, -12, 7, 22, 23, 6, 6, -27, -33, -33, -35, 21, 33, 59, 43, 27, 2, -50, -28, -42, -5, 10, -19, -11, -16, -1, -43, -41, -9, 18, -1, 5, 20, 15, -6, -13, -18, -35, -14, 36, 57, 20, 24, 13, -11, -46, -14, -6, 5, 12, 22, 6, -4, 15, -29, -18, -13, 4, 0, 21, -8, -6, -11, 0, -31, -20, 6, 21, 51, 24, -6, -30, -14, -43, -17, -20, -5, 24, 33, 40, 5, -2, -11, -2, -15, 3, 17, 15, -1, 9, 6, -18, -14, -17, 14, 46, 40, 14, 12, -7, -5, -14, 2, -1, 10, 27, 27, 27, 40, -5, -25, -16, -21, 16, 13, 13, 9, -10, 0, -11, -9, -10, 8, 30, 30, 47, -12, 5, -23, -24, -9, -15, 16, 10, 4, 5, 38, 21, -15, -20, -2, 12, -4, 10, 12, 11, -11, -19, -38, -25, -11, 36, 40, 22, 5, 20, -21, -20, -7, 2, 6, -2, 19, 24, 35, 18, 3, 0, 3, 16, 11, 15, -12, 17, 6, -30, -28, -40, -19, 22, 24, 25, 8, 24, -20, -16, 11, 16, 24, 17, 4, 19, 28, -9, -40, -20, 0, 12, -12, -1, 10, -5, -29, -40, -22, -14, -11, 2, 0, 2, 26, 1, 12, 5, -1, -12, 19, 17, -4, 21, 12, -15, -23, 8, -3, 5, -3, 7, 14, -17, -33, -33, -16, 7, -30, -12, 11, 11, 22, -8, 9, 11, 13, -11, 1, -12, 2, -10, 5, -12, -5, 1, -3, 13, 5, 0, 2, 13, -38, -39, -34, -31, -21, -28, -23, -22, -12, 5, 6, 17, 13, -5, 13, -7, -1, -6, -25, 2, -4, 1, 12, 4, -7, 15, 12, -5, -15, -24, -37, -42, -12, -29, -10, -22, 10, 0, 15, 6, -7, -21, 19, -7, -5, -20, 11, -16, -2, 15, 9, 17, 0, 22, -12, 4, -15, -18, -32, -20, -21, -9, 6, 9, -9, -10, -5, 17, 14, -6, 26, -1, -19, -10, -24, -2, 9, 9, 14, 5, -8, -3, 0, -4, 8, 23, -4, -9, -3, -12, -5, 12, -18, 10, 6, 15, 7, 37, -20, -22, -29, -18, 9, 8, 12, -4, -7, -9, 15, 19, 15, -6, 8, -4, 11, 33, 21, 30, 24, 23, 15, 13, 18, 38, 19, -10, 1, 17, -9, 8, -5, 1, -6, 14, 16, -8, 14, -5, -5, 0, 14, 20, 4, 3, 8, 20, 14, 18, -16, 10, -2, 27, 10, 16, -6, -7, 11, 17, 6, 0, 6, 6, 18, 6, 10, 14, 5, 18, 15, -8, 4, 4, -1, 6, -8, 0, 21, 4, 11, 1, 4, 10, -2, 20, 20, 2, -1, 6, 20, 5, 0, -4, -9, 4, -6, -15, -18, -14, 12, -7, -10, 2, -17, 12, 3, -6, 5, -14, -6, 9, -7, 10, -16, -16, 2, 2, -4, -4, -16, -1, -4, 12, -18, 10, 1, -15, 4, 3, 15, 0, -17, -11, -11, -5, 14, 8, 11, -11, 9, -6, 9, -18, -13, -7, 3, 0, -18, 3, 11, 9, -3, -10, 2, 6, 15, -2, 20, -4, 5, -5, 6, 8, 15, -1, 14, -8, 13, -1, -13, 1, 11, -1, -4, -17, 9, -7, -12, -11, -11, 5, -11, 5, -6, -6, 7, 9, 28, 30, 18, 24, 2, -10, 1, -4, -11, -15, 4, 8, 0, -17, 10, 7, -4, -2, -19, 13, 13, 11, 17, 4, 3, 24, 37, 9, 26, 21, -9, 7, -26, -11, -23, -7, -13, -27, -19, -27, -23, -18, 8, 2, 2, -15, 10, -18, 13, -6, -7, -11, 15, 1, 24, 0, 25, -1, 10, -5, 7, -2, -18, -3, -35, -15, -35, -36, -24, -18, -6, -17, -11, 2, -3, -14, 10, -5, 16, -6, -8, 16, 3, 25, 23, -7, 23, 5, 31, 36, 31, -6, 8, -10, -5, -23, -11, -41, -36, -6, -13, -4, -13, 4, 12, 17, -3, 0, 20, 4, 22, 2, 6, 9, 43, 19, 38, 25, 30, 14, -21, -18, -10, 5, -2, -18, -32, -13, -20, 8, -4, -3, 3, 3, 26, 9, -9, 23, 23, 20, 23, 30, 46, 28, 42, 34, -8, 21, 7, 8, -8, -18, 12, -24, -41, -14, 3, -1, -18, -5, 19, 6, 27, 2, 1, 8, 20, 7, 21, -1, 11, -5, 10, -11, 4, 0, 19, 4, 5, -14, 13, -20, -16, -32, 3, -17, 2, 5, -4, 9, 7, 6, 34, 20, -9, 14, 8, -2, -48, -26, -31, -7, 5, 15, 10, 0, 26, 18, 13, -11, -5, 2, 4, 9, 15, 4, 17, -1, 7, 1, -3, -14, 5, -22, -34, -46, -54, -59, -41, -12, -3, 23, 30, 21, 29, 0, 20, 13, -6, -16, -17, 1, 7, -17, 17, -17, -26, -24, -15, -16, -39, -37, -21, -52, -47, -44, -12, -4, 12, 22, -3, 1, 1, -6, -7, -3, 12, 6, -11, 12, -12, -6, -8, -8, -8, -30, -32, -35, -15, -27, -38, -56, -30, -11, 4, 1, -2, 16, 8, -4, -18, -15, -20, -11, -10, -4, -10, 16, -9, -13, -17, -1, -30, -26, -26, -24, -19, -9, -15, 0, -12, -9, -6, 11, 31, -1, 22, 5, 15, 13, -18, -20, 12, 5, 11, -3, 10, 10, 1, 8, -7, -5, -15, -5, -11, -12, 6, 2, 7, -10, 18, 10, -9, -7, -2, 11, 1, 11, -16, -11, 3, 7, -7, -2, -7, 10, 14, 0, -15, -12, 7, -1, -18, -25, -16, -9, 0, 3, 0, 1, 2, -5, 15, 19, 6, 15, 6, 10, 1, 28, 18, -9, -17, 15, 17, 2, 21, 4, -12, -4, 2, -6, -11, -11, -2, 20, -5, -11, -2, -6, -7, -9, -21, 4, -12, -6, 24, 16, 12, 3, -7, -10, 2, 34, 10, 17, -9, -17, 10, -3, -12, 14, 15, 12, -6, 13, 2, 10, 11, 17, 0, 3, -13, -10, 12, 1, 2, -3, -9, 11, 11, -2, 3, 20, 8, -2, -10, -7, -3, 20, -2, 13, 9, 4, -3, 11, 12, 12, -10, -17, -7, -4, -8, 16, -8, -2, -15, -16, 11, 25, 19, 26, -4, 27, 1, 9, 4, -12, -8, -10, -6, 12, -2, -4, -8, -9, -19, -11, -26, -12, -13, 10, 7, 14, 2, 3, 7, 20, 6, -14, 3, 8, 2, 6, -5, -11, 18, 4, -5, 1, 11, -11, 11, 7, 0, -28, -21, 3, 2, 2, 5, -3, 13, 13, -6, 0, 10, -6, 6, -13, 3, 2, -1, -13, -11, -5, -18, 7, 15, -18, 0, -4, -9, 1, 10, 10, 13, -10, -9, 6, -13, 11, -10, 9, 21, 20, 29, 24, 4, -14, -23, -14, -24, -4, -22, -3, -11, -8, 6, -11, 0, -18, 1, 13, 2, 12, -8, -6, -13, 7, -10, 1, 12, 7, 35, 15, -9, -20, -5, -5, -17, -26, -3, 4, -5, 3, -23, -3, -16, -1, -11, 2, 0, -12, -11, 0, -5, 12, 15, 5, -10, 3, 24, 12, 34, 24, 28, 7, 15, 6, 21, 12, 5, 21, 14, 16, -5, -13, -14, -7, 0, 5, -6, 12, 8, 0, -14, -4, -10, -18, 2, -4, 1, 1, 2, 19, -11, 23, 32, 36, 33, 25, 34, 27, 0, 12, -17, 8, -2, 13, -16, 8, -1, -11, 13, -9, 13, 5, 11, -9, -3, 6, -6, 10, -3, -3, 17, -11, 8, 12, -1, -8, 13, -12, -16, -7, 2, -3, 15, 5, -25, -13, -18, -7, -6, 0, -4, -6, -24, 3, -28, 3, -21, -24, -2, -19, -18, -5, -2, -10, -12, 2, -17, -3, 1, -10, -11, -28, -3, -15, 0, -27, 3, -25, -13, -27, -20, 1, -3, -9, -7, -14, -4, -4, -33, -11, -3, -24, -5, -12, -27, -17, -8, 3, -27, -19, -29, -20, -20, -2, -29, -19, -2, -11, 1, -2, -3, -23, -7, -8, -5, -10, -31, -28, -1, -23, -6, -28, -14, -13, -15, -15, 2, -5, -7, -8, -7, -14, -2, -16, -10, -23, -28, -20, -1, -1, -6, -28, -25, -8, -4, 2, 15, 0, 10, 0, -1, 6, -24, -20, -20, -22, -29, -20, -28, 2, -12, -18, -30, -5, 2, -12, 9, 7, 22, -6, 16, 6, -10, 11, 1, 10, -13, 19, -5, -10, -6, 0, -19, -8, -13, -11, -9, -10, -26, -17, -18, -2, 13, 4, 19, 5, 9, 17, 0, -16, 14, 15, 12, -11, -1, 9, 25, 3, 3, 6, -3, -28, 0, -10, -23, -1, -8, -13, -22, 18, 4, 22, 10, 2, 19, -9, 17, 12, 3, 10, -19, -9, -7, -16, 13, 12, 22, -4, -15, -17, -17, -3, -22, -4, -5, 2, 18, 16, 15, 26, -9, 10, 7, -5, 0, -7, -3, -16, -11, -2, -9, 1, 7, 30, 37, 17, -11, -9, -29, -11, -28, -29, -14, 22, -8, 0, 30, 18, 22, 21, -9, -22, -12, -33, -12, -24, -9, -23, 14, 4, 22, 21, 42, 14, 2, -15, -15, -14, -28, -26, -1, -12, -15, 7, -4, 21, 14, 23, 8, -11, -30, -40, 1, -20, -25, -11, 8, 28, 7, 27, 1, 22, 11, -27, -4, 0, -16, -11, 0, -12, 2, 3, 5, 4, 5, 23, 0, -31, -15, -11, -32, -15, -31, 2, 7, 13, -13, 1, 20, 10, 4, -28, -29, 3, -4, -10, -23, 20, -2, -11, 7, 36, 14, 5, 34, -10, -25, -19, 3, 9, -1, -2, -16, -36, -16, -11, -22, 10, -5, -17, -20, 2, -12, -23, -24, 13, -22, 6, 11, 13, 18, 17, 27, 16, 8, 1, 11, -19, -5, 13, -3, -15, -33, -42, -14, 7, -14, -14, -3, -20, -19, -24, -36, -6, -21, 3, 0, -4, 21, 13, 39, 29, -1, 0, 20, 7, 2, 13, 2, -11, -17, -34, -30, -25, -3, -13, -1, -16, 0, -22, -9, -12, -8, -21, 3, 19, 19, 12, -2, 26, 19, 17, 6, 7, 21, 19, 2, -5, -24, -4, -34, -11, 0, -21, -5, -13, -20, -8, 10, -6, 17, -18, 5, 15, 5, 4, 18, 10, 12, 27, 32, 23, -7, 19, 0, 2, -12, -9, -16, -15, -25, -6, -28, -6, 1, 3, -4, -10, 0, 0, -16, -4, -16, 0, 15, 30, 11, 13, 1, 10, 16, -2, 21, 16, 1, 6, -14, -2, -1, 0, 4, -10, -11, -18, -8, 1, 30, -8, 8, -17, -21, 0, 13, 6, 14, 13, 27, 18, 16, 7, 10, 9, 11, 19, -5, -5, -22, -17, -24, -13, -5, -16, 4, 26, 19, 16, 4, -21, -20, 20, 39, 3, -6, 16, 5, 16, -1, 11, 23, -8, -7, -4, 1, -28, -28, -28, -16, -13, -26, -18, -3, 12, 3, 10, 11, -6, 9, 19, -1, 10, 15, -10, 7, -11, 1, -20, 3, 9, -13, -5, -23, -17, -25, 0, -3, -16, -11, -4, 5, -6, 4, -9, -9, 3, 12, -6, 14, -8, -9, -4, -7, -5, -2, -13, 15, -4, 6, 11, -29, -15, -26, 2, -21, -19, 3, 6, -8, -13, -11, -22, -1, -10, -15, 12, 12, 13, -6, -3, 8, -5, 12, -14, -8, 13, 2, -6, -5, -15, -13, -2, -16, -27, -7, -8, -14, -15, -19, -28, 1, -17, -2, 14, -9, -6, 1, -2, 15, 5, 19, 11, -7, 6, 16, 11, -22, -10, -11, -27, -2, -8, 0, 0, 3, -18, -27, -20, 12, 20, 1, 10, 3, -2, -10, -5, 7, 8, 26, 6, 28, 4, 6, 8, -6, 4, -2, -22, -11, -4, -6, -3, -12, -21, -18, -6, 2, 36, 7, 42, 28, 25, 36, 12, 36, -14, 4, 0, 0, -1, -2, -2, 4, -13, -23, -12, -17, -30, -29, -4, -7, -31, -17, -15, -13, -14, 22, 20, 10, 12, 16, -1, 15, 16, 2, -23, -10, -9, -3, 4, -2, -1, -5, -9, -13, -11, 1, -10, -4, -27, -29, -20, -18, -41, -20, -25, -5, -35, -23, -13, -32, -32, -41, -39, -11, -7, -28, -8, -17, -7, -19, -17, -4, -15, -6, -18, -21, -10, -10, -3, -26, -16, 1, -18, -3, -18, -27, 1, -21, -2, -1, -32, -1, -20, -29, -5, 1, -26, -5, -12, 3, -17, 5, 6, 5, -17, -3, -17, -8, -14, 1, 0, -1, -19, -8, -3, 1, -10, -13, 0, -23, -21, 4, -12, 5, -7, -17, -11, 3, -21, -17, -19, 8, -5, 7, -17, -13, -16, -24, -1, -24, 5, 2, -8, -11, -5, 2, -25, -3, -4, 5, 4, -13, 1, -17, -15, -18, -24, -24, 8, -15, -6, -9, -18, -10, 3, -30, -24, -25, -18, -24, -9, -8, -26, 2, -20, -18, 3, -1, -21, -16, -9, -16, -19, -21, -19, -10, -26, -4, -7, -27, -9, -16, -11, -33, -23, -21, -18, -19, -11, -6, -25, 8, -17, 11, -6, 12, -19, -3, 1, -17, -1, -14, -23, -15, 3, -20, -26, -14, -23, -12, -28, 4, -6, -12, -15, 8, -2, -10, 5, -21, -18, 8, 7, 4, -5, -8, 6, -22, -25, -4, -7, -8, 5, -27, -24, -21, -31, -30, 11, -14, 1, 9, 7, 8, -14, 21, -2, -2, 9, 5, 0, 12, 8, 11, 13, -2, -8, 2, -22, -19, -21, -7, -10, -6, -12, 1, 17, 0, 32, 26, 2, -12, 6, -17, 3, -1, 22, 1, 12, 11, 13, 19, 23, 9, 2, -12, -20, -4, -15, -13, -22, -26, 11, 29, 12, 19, 32, 11, -21, -7, -24, -24, -7, 10, -9, -3, 22, 3, 18, 14, 35, 15, 0, -11, 3, -16, -28, -31, 8, -13, 10, 12, 4, 14, 23, 1, 1, -32, -7, -25, -16, -8, -12, 16, 27, 30, 29, 48, 36, 0, 8, 5, -24, 1, -5, -14, 0, 3, -1, 4, 16, -7, 14, 1, -16, -30, -39, -25, -6, 9, -10, -9, 6, 3, 35, 49, 47, -5, -2, -9, -11, -7, -18, -21, -3, 7, -3, 19, 33, 13, 25, 5, -21, -37, -16, -41, -28, -27, 2, -29, -13, 18, 5, 20, 21, 13, -11, -24, -15, -17, -8, 2, -1, 8, 17, 9, 0, 18, 0, 31, 21, -1, 0, -11, -25, -19, -15, -31, -33, -30, 13, 25, 28, 17, -23, -11, -21, -18, -17, -25, 7, 17, 8, 23, 19, 14, 25, 38, 24, 14, 27, 4, 1, -16, -17, 7, -10, -4, -6, -9, -8, -3, 3, -5, 6, -7, -9, -20, -3, 8, 4, 0, 22, 14, 26, 27, 14, 1, 24, 6, 15, 12, -11, 19, -22, -12, -19, -44, -28, -24, -12, -10, -21, -5, -27, 0, -5, 0, 16, 16, 3, 33, 9, 21, -4, 4, 30, 30, 17, 23, 21, -19, -23, -23, -15, -20, -9, 0, -21, -10, -12, -6, -21, -7, -25, -14, -22, 22, -2, 4, 15, 2, 25, 28, -7, 17, 24, 20, -6, -32, -32, 2, -22, -24, -35, -7, -18, -25, -18, -18, 2, -39, -37, -21, -12, -6, 6, -6, 6, 9, 22, 27, 1, 31, -2, -14, 4, -12, -29, -14, -12, -16, -8, -21, -13, -3, -17, -20, -14, -20, -5, 0, -29, -14, 6, -5, -10, -8, -7, 28, 14, 18, 8, 4, -10, -18, -14, -29, 3, 2, -12, -7, 0, -5, -21, -8, -17, -8, -2, -8, -9, -6, -28, -15, 4, 7, 0, 16, 0, -10, -30, -4, -4, -10, 1, -7, 1, -1, -12, -5, 2, -6, -11, -3, 2, 0, -23, 3, -15, -21, -7, -35, -19, -5, -13, -10, 10, -15, -30, -10, -12, -7, -13, -14, -26, 6, -7, -12, 1, -17, -4, -18, -7, -10, -27, -30, -26, -26, -10, -15, -26, -29, -16, -23, 5, -6, 9, 10, 2, -2, -26, 8, -8, -2, -23, -14, -21, -14, -21, -18, -11, -27, -12, -9, 5, -25, -12, -4, -14, -25, -14, -6, -2, -13, 20, 0, 11, 26, -9, 7, 0, -15, -17, 7, -15, -20, -15, 4, 0, 1, -27, 3, -18, -3, -5, -9, 16, 2, 2, 15, 4, 10, -2, 2, 22, 9, -7, 0, -1, 11, 10, -8, 2, -15, -12, 1, -20, -6, -4, -25, -15, -6, -3, 9, -9, 9, 15, 29, 3, 19, 17, -4, 30, 19, 24, 0, -19, -9, -14, -7, 6, 4, -6, -25, -19, 0, -7, -5, -16, -5, 44, 14, 39, 35, 41, 22, 6, 10, 4, 5, 2, 4, -10, -6, -22, 0, -6, 8, -7, 1, 0, -10, 1, -25, -30, -33, 0, -19, -2, 2, -4, -10, 17, 6, 15, -11, -7, -11, -18, -6, 8, -9, 8, -10, 3, -20, -7, -15, -1, -14, 5, -1, -25, -14, -13, -21, -9, -31, -22, -30, -34, -16, -21, -14, -17, -30, -27, 1, -17, -23, -2, -21, -24, -6, -13, -3, -21, -12, 7, -1, 0, -5, -2, -18, -16, -3, -24, -12, -16, -23, -15, -18, -14, -26, 0, 6, -23, -22, 7, -7, -7, -2, 8, -15, -8, -17, 6, 15, -1, -7, -7, 10, 5, 2, -15, -1, 2, 17, -13, -11, 15, 1, -12, 11, 12, -13, 15, -11, 8, 14, -6, 12, 5, 10, -16, -13, 9, 13, 15, 12, 6, -6, -3, 16, 8, -12, 13, -3, -15, 1, -5, 4, 6, -10, 0, -13, -16, -8, 4, 1, 3, -4, 3, 17, -4, -8, 18, -8, -7, 11, 20, 20, 7, 26, 10, 0, -3, -1, 10, 25, 9, 22, -5, -11, 3, -15, -8, -9, 17, -10, 10, -12, -2, -3, 6, -2, -3, 1, 16, -7, 8, 5, -4, -3, 4, 10, 23, -1, -4, 3, 4, -7, -10, 10, 14, -16, -14, 11, -11, 19, 22, 25, 12, 13, 14, -7, -9, -16, -9, -6, 11, 2, 7, 16, 10, 29, 9, -5, -3, -25, -24, -8, 12, -15, -2, 8, 9, 25, 27, 26, 23, 4, -12, -11, -11, -11, 14, 17, 40, 49, 10, 14, -6, 6, 3, -18, 8, -7, -4, 1, 7, 12, 7, -15, 10, 15, 14, 30, 8, 12, 16, -26, -25, -19, -36, 15, 28, 33, 24, -12, -18, -35, -16, -14, -25, -32, 1, -2, -8, -3, -11, 18, 1, 27, 28, -4, 5, -19, -6, -22, -24, -19, -28, 12, 5, 24, 25, -15, -24, -37, -18, -34, -20, -12, -7, 7, -2, -8, -9, 8, -4, 32, 13, 7, 12, -21, -34, -28, -26, -20, -22, -10, 2, 27, 19, -13, -34, -49, -57, -30, -26, -16, -3, -14, -13, 13, 1, 10, 1, 26, 6, -6, 1, -7, -24, -15, -32, -37, -25, 16, 30, 44, -7, -36, -33, -54, -57, -49, -22, -27, -7, 2, -4, 1, 0, -14, -13, 1, -5, -26, -13, -32, -8, -36, -24, -20, 1, 13, 33, 29, -7, -14, -29, -50, -52, -22, -25, -27, -9, -16, 14, 0, -12, 3, -21, -3, -21, -43, -11, -33, -14, -32, -37, -3, 15, 37, 37, -5, -37, -47, -32, -31, -22, -28, -6, -38, -2, 6, 16, -11, 4, -4, 1, -10, -40, -32, -21, -1, -9, -15, -16, 6, 40, 21, 8, 2, -53, -59, -18, -26, -5, 4, 18, 4, 10, 10, -4, -8, 3, 8, -15, -23, -35, -23, -14, 11, -8, 3, -9, 28, 14, 12, 9, -9, -17, -20, -16, 9, 22, -11, 27, 29, 13, 11, -2, -8, -14, 12, 1, -22, -11, -19, -9, 15, 16, 1, 16, 35, 36, 38, 26, 9, -30, -13, 3, 10, 3, 4, 12, 7, 1, 3, 3, 9, -8, -16, -10, -11, -22, 5, 19, 23, 14, 14, 19, 45, 42, 39, 5, -2, -24, -1, 20, 10, 9, 35, 15, -4, 5, -4, 11, -7, -5, 3, 11, 4, -6, 42, 29, 22, 51, 7, 37, 9, 21, 41, 17, 11, 12, 10, 24, 18, 30, 18, 29, 12, 21, 0, 8, 5, -1, 0, 16, 5, 7, 24, 43, 13, 5, 25, 20, 8, 28, 30, -12, 6, 11, 16, 18, 2, 14, 38, 35, 15, 14, 15, -11, -14, -5, 2, -2, 9, -14, -2, 2, 7, 21, 2, -1, 13, 1, -20, 10, 1, -2, 39, 14, 21, 16, 10, 6, 10, 20, 2, -15, -14, -2, -5, -4, 1, -23, -16, 1, 4, 5, -9, -25, -27, -8, -16, 14, 16, 9, 20, 19, 18, 18, 22, -3, -2, 7, 5, 3, 13, -3, 13, 0, -20, -7, 11, 19, 15, 1, -14, 10, -24, -2, 5, 35, 10, 28, 20, 17, 34, 21, -20, -10, 1, -22, 2, -5, -1, -3, 2, -8, 6, -3, -4, -7, -5, 17, -2, -20, 9, -9, 29, 13, 14, 45, 21, 18, -15, -8, -23, -32, -16, -5, -10, -16, 14, -4, 15, 17, 1, 12, -4, -2, -10, -11, 14, 15, -12, 13, 7, 5, 10, 14, -14, 7, -1, 1, -14, -8, -23, -17, 13, 1, 14, -15, -14, 10, 2, -11, -10, -18, 4, -1, 11, -1, -5, 13, 3, 12, -3, 3, 1, -22, 0, -23, -20, -9, -23, 6, -15, 4, 14, 12, 17, 2, 2, -6, 5, 12, -6, -19, 3, -16, -14, -26, -10, -6, -8, -5, -37, -12, -17, -4, 1, 4, 12, -8, 14, 3, 13, 14, 8, -5, 5, 14, 2, -6, -8, -25, -30, -10, -14, -22, -16, -32, -19, -11, -37, -17, -10, -13, -19, -8, 4, 16, 10, 16, 11, -13, -13, 3, 8, 5, -17, 13, -11, 4, -16, -22, -26, -22, -35, -30, -30, -35, -10, -23, 1, -10, -16, -13, 13, 3, 13, -9, 10, -4, 2, 8, -15, 7, -3, -7, -2, 12, 1, 1, 9, 12, 1, 8, 17, 2, -11, 4, 3, -11, 12, 2, -9, -1, -4, 12, 15, 6, -4, -18, -3, 9, 15, 9, 12, -1, 0, -14, 14, -13, 7, -13, -4, -17, 9, 1, -11, -5, 11, -3, -8, 3, 0, 8, -13, 12, 9, 1, 12, -5, -2, -5, 14, 3, -12, 10, 2, 13, 4, 14, -3, -6, -9, 4, -1, -7, 2, 8, -4, 14, -3, 5, -11, 4, 10, -18, -4, -17, -14, 11, 17, 19, 4, -6, 10, 2, 9, -5, 16, 15, 5, -9, 5, 7, 15, -5, -3, -8, 11, -9, -4, -16, 3, -8, -15, -20, -14, -17, 7, 0, -4, 23, -2, 22, -17, 7, 14, -15, 7, -3, 4, -5, -8, 0, -8, 1, -1, -5, 0, -2, -4, 15, -8, 9, 1, -7, 4, 13, -16, 5, -22, -19, -32, -13, 1, -15, -14, -8, -1, -9, -2, -11, -26, -10, 7, 10, 7, 8, 13, 1, 9, -7, -5, 17, -3, 2, -2, -26, -17, -15, -15, -12, -1, 1, -6, -4, -29, -33, -32, -25, -4, -12, -14, -14, 15, 13, -13, 8, 8, 11, 17, 24, -2, -12, 8, 4, 9, -6, 1, 5, 1, -7, 4, -4, -26, -3, -5, -29, -38, -3, -24, -14, -2, -2, 6, 16, -7, 20, 18, 9, 20, 15, 3, -5, -1, 4, -29, -25, -3, 23, -7, -6, -13, -9, -12, -10, -14, 2, -2, 8, -4, 10, 6, 7, -5, 22, 16, -14, 17, 6, -5, -13, -26, 0, -11, 3, 6, -13, 0, -16, 11, -9, -36, -28, -34, -7, -8, -9, 8, 9, -12, 2, 5, 28, 1, -6, 10, -5, 19, 11, -8, -7, 10, -5, 15, 18, -3, 29, 9, -15, -9, -31, -13, -17, 0, -12, 5, -8, 11, 9, 3, 3, -2, -9, -1, -16, 6, -14, -16, -10, -4, -27, -5, 11, 38, 11, 13, 15, 1, 0, -20, -25, -29, -12, -8, -1, -5, -17, -22, -19, -1, 19, 5, 23, 17, -13, -17, -10, -18, -10, -21, -18, 20, 38, 3, 30, 5, -11, -38, -48, -13, 13, -17, 2, 1, 8, 6, -26, -13, 2, 22, 20, 15, -5, 7, -13, -33, -14, -33, 13, 31, 27, 6, 19, 15, -9, -7, -16, -16, -2, 14, -13, -10, -10, 6, -13, -9, 9, 20, 17, 16, 2, -7, -18, -31, -14, -28, 3, -1, 28, 20, 9, 4, 25, 15, 5, -1, -1, 2, -1, -17, -7, -25, 0, -6, 30, 14, 21, 30, 9, -1, -26, -16, -11, -18, 16, 32, 43, 13, 3, 31, 32, 16, -12, 4, -9, 5, -8, -18, -18, -22, -2, 2, 5, 15, 1, 33, 16, -15, -1, -25, -21, -3, 49, 39, 48, 27, 28, -3, -3, 3, 10, 9, -1, -4, -16, -19, -18, -18, -13, 13, 13, 25, 28, 7, 16, -16, -41, -8, 30, 40, 44, 49, 20, 29, 26, 2, 4, -11, 3, 18, -17, -13, -8, -10, -13, -1, 13, -5, -10, 25, 6, 14, -17, -47, -35, 3, 19, 41, 32, 29, 32, 32, 24, 17, -20, -7, 11, 18, 16, 15, 15, -16, -29, -12, -20, 10, -3, 12, 7, -4, -3, -22, -26, -3, 16, 26, 39, 42, 6, 6, -7, 10, -12, 19, 18, -5, -6, -6, -1, 11, -24, 1, -6, 6, -9, -8, -6, -11, -21, -12, 5, -6, 17, 19, 6, 8, 9, 3, 2, -18, -5, -7, -3, -13, -14, -17, -2, 3, 0, -4, 8, -13, -10, 1, -4, -2, 17, -10, -9, -8, -19, -3, -26, -14, -38, -43, -38, -9, 0, -12, -9, 7, 2, -4, -7, -13, -7, -11, 6, 4, -24, -4, -6, 11, 4, 2, -8, -17, 1, 2, -36, -24, -44, -46, -39, -36, -16, 7, -16, -1, 10, -16, -7, 5, -10, -23, -3, 16, 5, 15, 20, 8, 5, 13, -24, -18, 7, -4, -14, -23, -21, -36, -20, -8, -14, 11, 0, -5, 13, -4, -17, -18, -19, -22, -23, 20, 13, 19, 10, -11, -14, 11, -19, -1, -13, 3, 14, -26, -16, -25, -28, -4, -37, -1, -19, -3, -11, -19, 5, 14, -20, -2, -17, -2, -3, 6, 3, -8, -28, -25, -25, -1, 7, -4, 0, 7, -13, -32, -3, -27, -5, 10, -10, 14, -7, -6, 11, 6, -7, -4, 13, -10, -6, 8, -17, -26, -28, -10, -44, -25, -18, -1, 4, 0, -4, -6, -9, -4, 1, 5, -1, -12, 9, -13, -9, 4, 1, -3, -19, -5, -1, -4, 11, 21, 18, 13, 7, 17, 22, 20, 16, -3, -5, -12, 8, 13, -1, -7, -7, -13, -1, -19, 7, -17, 9, -5, 8, 8, 8, 7, -5, -9, -17, -13, 10, -13, -1, 12, 8, 7, -3, -3, 7, 11, 14, -5, 11, 13, 1, -2, -2, 0, -11, -18, 11, -15, -1, -11, 9, 4, 0, 9, 10, 1, 1, -10, -3, -10, -3, -10, 13, 10, 13, -14, 0, -19, 4, 11, 13, -9, 7, 0, 13, -18, 10, 5, 1, 10, 5, 11, 4, 1, -9, -14, -14, 7, 13, 10, 5, 1, -18, -18, 12, 1, -12, 0, 11, -6, -18, -13, -20, -8, 11, -12, -7, -4, -9, 4, -3, 12, 13, 11, 27, 8, 24, -4, 13, -17, -16, 8, -16, -19, 10, 7, 12, 5, -9, 1, 4, 1, 8, -14, -3, 10, -7, -15, 10, 7, -2, 11, 7, 10, 14, 23, 13, 23, 16, 12, -3, 2, -12, -12, 4, -16, 11, 13, -5, -12, -20, -8, 13, -10, 7, 2, -9, 12, 11, 24, 2, 19, 6, 23, 11, 14, 9, -9, 8, 1, -13, 2, 7, -7, 12, -3, -4, -20, -24, -10, 10, 22, -21, 1, 3, 14, 2, 18, 17, 13, 2, 3, 6, 35, 33, 16, 19, 10, 12, -2, -14, 12, -20, 7, -25, -28, -2, 18, 10, -1, -24, -24, -20, -33, -30, -42, -61, -51, -25, -25, -27, 8, 38, 37, -5, 3, 15, 12, -9, -13, -13, -21, -5, -1, 3, 24, -7, 22, 20, -34, -34, -34, -19, -42, -36, -45, -47, -42, -12, 15, 26, 23, 24, -10, -18, -2, 10, 9, -8, -31, 1, -28, 7, 8, 39, 0, -6, -17, -21, -49, -21, -44, -24, -28, -49, -5, -1, 6, 23, 34, 17, -14, 10, -16, 12, -8, -9, -25, -29, -31, -8, -5, -9, 17, 4, 4, -12, -43, -45, -24, -5, -32, -18, -25, 0, -14, -2, 14, -1, -10, 6, -1, 2, 10, -14, -14, -27, -45, -13, 18, 5, 10, -8, -11, -20, -42, -33, -15, -15, -8, 2, 1, -4, -3, -20, 11, -4, -12, -19, -1, -8, -20, -27, -24, -24, -12, -7, -1, 17, 4, 4, 7, -8, -49, -27, 6, -8, -14, -11, -16, -6, 2, -17, 20, -13, -3, -20, -19, -4, -4, -17, -37, -27, -24, -21, -16, 14, 7, 19, 23, 6, -47, -13, -1, -12, -4, -17, 7, 10, 13, 17, 5, 13, -9, -16, -12, -13, -14, -21, -21, -16, -15, -20, -16, -1, 23, 13, 44, 8, -41, -28, -9, -16, -13, 12, 22, -13, -2, 9, 7, -10, -13, -20, 7, -5, -12, -8, -38, 4, -18, 10, 1, 19, 27, 38, 21, -12, -27, -10, -20, -18, 2, -11, 2, 3, 12, 20, 1, -8, -11, -4, 9, -5, 14, 14, -1, -9, -20, 21, 10, 14, 8, 34, 37, -6, -1, 13, -13, 2, -12, -14, -11, 14, 7, 15, 0, 7, -21, -9, -2, -19, -6, 12, -13, -20, 15, -1, -5, 18, 0, 32, 20, 9, 23, 28, 7, -2, 1, 18, 24, 18, -5, 22, -10, 12, -17, -12, -15, -3, -18, -16, -24, 0, 12, 4, 7, 16, 8, 4, 12, 13, 14, -5, 3, -16, -2, 14, 3, 8, 8, 16, -6, -10, -13, -2, 1, -14, 6, -15, 12, 2, 19, 7, 10, -14, 8, 12, 33, 36, 14, 9, 21, 5, 12, 9, 3, -6, -17, -11, -6, 0, -9, -8, -2, 13, -8, -2, -16, -3, 12, -1, -5, -1, 29, 25, 39, 15, 12, 28, -12, -5, -16, -19, -6, -3, -15, 1, -25, 1, -18, -20, 1, -14, -6, -6, -13, -8, -16, -26, 11, 32, 11, 34, 36, 19, 13, -2, -11, 16, 16, -13, 21, 12, -18, -30, 1, -17, 0, 13, 0, 5, -5, 11, 3, -8, -21, -33, 2, 28, 41, 37, 12, 34, 10, 8, -7, 6, -9, 12, 27, 26, -11, -13, 0, -10, -9, -11, 12, -19, -3, 9, 10, -12, -37, -18, -19, -20, 12, 31, 19, 25, 19, 14, 26, 13, -8, 20, -11, -3, -15, -26, -26, 1, 13, 4, 2, 7, -20, 10, -22, -20, -40, -50, -25, -30, -10, 9, -12, -2, 5, 19, 6, -18, -19, 0, -14, -28, 1, -31, -18, 3, 6, -3, 2, -11, -17, -13, -12, -21, -23, -61, -56, -7, -26, -33, -11, -1, 1, 1, -3, -32, -22, -27, -27, -36, -19, 3, 3, 7, -8, 6, 3, 12, 3, 12, -3, -23, -12, -25, -39, -49, -24, -32, -20, -35, -38, -3, -2, -34, -12, -39, -14, -7, 7, -22, -18, -2, 1, 10, 2, 8, 1, -10, -10, 1, -19, -21, -23, -39, -31, -28, -43, -32, -48, -17, -39, -19, -35, -33, -16, -7, -12, 10, -10, 5, -2, 6, -6, 7, -20, 3, 1, -9, -2, -22, 2, -8, -8, -11, -1, 9, 4, -1, -22, 0, 1, 11, 6, -22, -3, -5, 10, -8, 10, 8, -6, 20, 2, -1, -10, -7, 21, 7, -1, 3, 3, 15, 8, -7, 6, 11, 11, 24, 15, 15, 7, -6, 10, -9, 5, -5, 14, 7, 14, 16, 0, 13, 19, 1, 22, -3, -10, 16, 20, -7, -5, 16, 1, 9, 13, 6, -1, 19, -8, -6, 16, -7, 3, -5, 1, -7, 0, -4, 0, -5, 21, -9, 2, 7, 5, 7, -7, 19, 13, 29, 8, 34, 20, 7, 11, 3, -11, 2, 17, -5, 20, 14, 19, 15, 15, 19, 21, -1, -5, 21, 5, 4, 0, 8, 21, 8, 22, 36, 33, 38, 12, -7, -3, 4, -28, -5, 1, -16, 10, -4, 13, 5, 14, 22, -3, -5, 18, -3, -4, 1, 17, 6, 14, -5, -4, 0, -6, 10, 33, 18, 14, 21, 21, 9, -14, -20, -22, -12, -11, 8, -4, 9, -4, 2, 16, -5, 6, -29, -25, -18, -23, -20, -37, -46, -52, -28, -3, 41, 28, 16, -5, 38, 24, 13, 2, -22, -12, 4, -6, 9, 17, -2, 16, -10, -20, -21, -49, -34, -28, -25, -34, -29, -40, -32, 8, 46, 44, 12, 14, -3, 2, 10, -4, 5, 6, 14, -10, 16, -4, 8, -8, -16, -14, -29, -34, -10, 16, 6, -22, -15, -39, -12, 12, 54, 52, 52, 19, 25, 15, -28, -38, -15, -6, -1, 3, 5, 20, 4, -8, -10, -8, -15, -12, 0, 14, 15, -21, -43, -61, -42, 37, 64, 41, 23, -13, -23, -4, -10, -32, 6, -12, -4, 17, -8, -2, 8, -13, -12, -24, -20, 2, 25, 11, 17, 0, -70, -83, 2, 57, 56, 7, -2, -43, -37, 2, -12, -28, -16, 1, 5, 9, -5, 20, 8, 13, 22, 4, 2, 8, 10, 10, 7, -10, -73, -49, 16, 64, 40, 22, -7, -42, -25, -37, -14, -23, 5, 14, 21, -7, 9, 16, -5, -1, 24, 22, 19, 0, 30, 20, 3, -34, -63, -22, 33, 66, 21, 22, -31, -15, -8, -32, -18, -25, 5, -7, 10, 15, 22, -10, -5, 18, 11, 1, -14, 18, -7, -26, -33, -25, -47, -21, 30, 54, 36, 6, -24, -22, 2, 6, -7, -5, 21, 6, 14, 3, -6, 9, 7, 9, -7, -11, -26, 0, -5, -32, -23, -7, -12, 18, 9, 46, 19, 3, -5, 25, 6, 3, 0, 33, 26, 32, 4, 8, -4, 16, 5, 3, -5, -38, -40, -26, -40, -35, 22, 30, 4, 12, 23, 34, 27, 6, 1, 14, 5, -14, -4, 22, 26, 24, 12, 4, -5, 17, -3, -3, -17, -33, -26, -41, -24, 22, 47, 53, 43, 23, 20, 16, -5, -21, -10, -30, -40, -2, 14, 1, -2, -5, 3, 10, 8, 7, 9, -31, -40, -18, -45, -31, 8, 49, 61, 34, 20, -1, -5, -13, -37, -63, -31, -61, -39, -42, -19, -15, 14, 8, 23, 16, 9, 22, -11, -21, -15, -10, -36, 11, 40, 45, 64, 25, 16, -8, -16, -55, -59, -53, -39, -51, -22, -39, -23, 35, 22, -4, 9, 11, -10, 9, 6, 4, -36, -33, 5, 32, 57, 79, 48, 48, -3, -31, -48, -40, -17, -18, 0, -9, 5, -8, 16, 12, 23, 17, 21, 13, -7, -10, 21, 41, -1, -4, 21, 23, 74, 44, 46, 2, -11, -52, -50, -29, -15, -3, 1, 7, 9, 33, 14, 19, 30, 0, -3, 9, 11, 9, 31, 25, 6, 7, 36, 48, 27, 22, 12, -14, -17, -32, -45, 0, 20, -3, 18, 6, 21, 10, 25, 28, 15, 0, -7, 6, -5, 3, 20, 39, 41, 0, 18, 22, -3, -3, -13, -8, -4, -28, -27, -2, 25, 18, 24, 47, 9, 4, 19, 14, 2, -1, 19, -7, 15, 22, 1, 19, 61, 47, 17, 0, -15, -32, -6, -22, 7, -6, -10, -1, 1, 17, 32, 33, 34, 6, -12, -1, -9, 19, 8, -8, 20, -5, -19, 10, 17, 17, 7, -7, -11, -5, 17, 13, 25, 1, -29, -25, -15, 6, 19, 20, -3, 2, -21, -12, -4, 21, 20, 18, 18, 16, -19, -17, -18, -21, -30, -25, -30, -23, 5, 33, 43, 3, -6, -25, -24, -15, -9, -9, 13, 5, -15, 20, 13, -4, 11, 2, 15, 18, -8, 9, -16, -6, -10, -17, -14, -10, 2, 36, 25, 10, 8, -22, -20, -41, -45, -21, -32, 1, 4, -10, 18, 23, 11, -10, -1, 19, 4, -6, 4, 18, 8, -14, -17, -12, 5, -7, 3, -14, -34, -9, -7, -20, -20, 2, -21, 3, 17, 20, 6, -10, 2, -9, 15, -5, -2, 23, 8, -6, 20, 20, 20, -10, 13, 7, -4, -1, 6, 21, 22, 9, -1, 19, -8, -12, 10, -10, -7, 16, 11, 6, 18, 5, -6, -12, 18, -12, 13, 12, 17, 14, 10, -10, -16, 3, 5, -9, 13, -13, 15, 2, 2, -7, -1, 3, -15, -9, 13, 11, -5, -11, 16, -15, 15, 14, 15, 6, 3, 7, -8, -15, -11, -6, -3, 8, 8, 15, 15, -5, -7, -3, -12, 5, 8, 5, 12, 0, -10, 16, 11, 2, -7, -3, 17, 11, 14, 13, 14, 10, 8, -1, 7, -4, 18, -1, -1, 9, 0, 2, 5, -3, 15, 0, -15, -1, -6, -6, -2, 2, -3, -12, 3, 4, -15, -1, -5, -24, -28, -12, 2, -2, -9, -26, -19, -20, -16, -9, -8, 17, -14, -5, 9, -12, 13, -9, 9, 18, 0, 12, 15, 8, 1, -4, -12, -7, -11, -41, -32, -11, -22, -20, 9, 12, 11, 4, 14, 2, -10, 11, 12, -13, 13, 15, -7, 14, -8, 21, 17, 39, 23, -7, -12, -7, -27, -7, -10, -7, -20, -40, -31, -4, 6, -11, 16, 5, -3, 0, -8, -4, -2, -7, 2, 15, 22, 31, 34, 23, 8, 3, -6, 20, -13, -24, -7, -32, 4, -27, -33, -4, -11, -3, 30, -5, -17, -4, -10, 5, 4, 19, 19, -3, 4, 4, 38, 30, 39, 10, 3, -8, -26, -29, -29, -19, 4, -6, -18, 7, -2, 9, -3, -18, -14, -7, -8, -8, 8, 8, 19, 14, 26, 38, 27, 12, 26, 6, -7, -24, -33, -20, -22, -27, -15, -14, -25, -2, -8, 7, -2, -15, -16, -5, -13, 15, 9, 5, -11, 9, 12, 24, 27, 1, 18, 17, 15, -7, -34, 2, 8, -5, 2, -8, -22, 11, -5, -12, 4, 2, -19, -15, 2, -7, -4, 12, -16, 1, -2, 18, 12, 4, 2, 22, -8, -33, -6, -30, -5, 14, 19, 23, 0, -6, 0, 2, -16, -11, -3, -14, -14, -8, -3, 18, 18, 12, -10, -15, 3, -9, 1, 32, -1, -23, -26, -22, 17, 17, 25, -6, 9, -18, -25, -15, -18, -14, -31, -9, -3, 10, 2, 17, 13, -8, -1, -19, 4, 13, 20, -3, -11, 2, -15, -39, 7, 15, 7, -5, -5, 9, 18, -12, -20, -22, -26, 9, -8, -5, -15, 14, 1, -17, 2, 27, 14, 23, -8, 13, -18, -23, -20, -12, 19, 27, 9, 26, -4, 11, 41, 23, -16, -19, -4, -4, -5, 18, -5, -3, 8, 19, 16, 31, 24, 13, 1, -7, -7, -13, -24, 10, 16, 36, 27, 6, 27, 32, 11, 24, 11, 3, -10, -2, -4, 16, -2, -3, -7, -4, 11, 20, 10, 4, -29, -23, -39, -33, -26, 20, 23, 21, 19, 17, 28, 5, 12, 27, 14, -34, -16, -14, -14, 8, -4, 10, 11, -1, 21, 23, 5, 4, -7, -51, -54, -20, 4, 37, 31, 31, 7, 21, 25, 21, 3, -17, -13, -28, -17, -21, 7, -4, -12, 15, 8, -5, -8, -15, 11, -31, -54, -50, -58, -12, 10, 27, 19, 25, 8, 27, -21, 11, -11, -23, -17, -8, 14, 0, -8, -5, -8, -9, -12, 2, -6, -16, -40, -46, -71, -69, -40, 22, 31, 41, 37, 17, 1, 3, -20, -11, -36, -17, -21, -10, 5, -12, -14, -13, -5, 13, -20, -5, -37, -26, -16, -27, -71, -82, -4, 9, 39, 19, 12, 4, 13, 2, -12, -14, -53, -53, -51, -13, -20, -16, -3, -5, 3, 15, -19, -17, -17, -32, -24, -41, -55, -47, 10, 16, 34, 30, 13, 37, 11, -5, -2, -43, -22, -55, -36, -29, -9, -6, 15, -1, 14, 6, -11, -20, -34, -26, -45, -31, -15, -24, -1, 3, 2, 33, 25, 4, -1, 14, 5, -22, -13, -30, -14, -21, -2, -2, 17, 2, 4, 1, -9, -17, -20, -11, -18, -13, -19, -4, -16, 9, 0, 0, 13, 10, -3, -4, -1, -15, -3, -14, -7, 5, -6, -11, 13, 6, -10, -4, 0, 2, -1, -18, -22, -20, -22, -24, -27, -9, -6, -6, 3, 16, 0, 6, 9, -9, 22, 6, -29, 7, 14, 5, -10, -7, -14, -10, -14, -8, 12, -4, -31, -38, -11, -17, 1, -9, -9, -20, 3, 5, -15, -6, -9, -3, 15, -5, -20, -1, 14, 6, 7, 13, 9, 16, 2, 3, 8, -9, -27, -19, 0, -27, 9, -31, -7, -12, -24, -8, -9, -13, -20, -5, -17, -10, -10, 10, 2, 12, 18, 17, -13, -6, 6, 13, -16, -16, -4, -13, 5, 7, -31, -32, -31, -34, -13, -26, -27, -2, -24, -13, 2, 10, 12, 1, -2, 10, 8, -16, 8, -6, -10, -10, 13, 11, -9, -3, -9, -13, -16, 14, 4, -6, 12, -7, 15, 17, -14, 9, -6, -5, 12, 0, 17, -5, 6, 11, 8, -1, 13, -10, 5, 2, 3, -12, 0, -11, -4, 6, -11, -12, -11, -19, -7, -8, -3, -14, 13, -15, -4, -10, 4, -14, -8, -6, 11, -13, 9, 11, 0, 12, 0, -1, -13, -11, 15, 8, 4, -12, 8, -14, 11, -10, -1, -10, 11, -3, 0, 12, -3, -1, -2, -7, 14, 13, 8, 2, -13, -13, 9, 3, -17, 3, -11, 3, 4, -1, 0, 2, 28, 14, 25, 1, -14, 4, -15, 11, 12, -14, 3, 6, -3, 13, -1, -10, -16, -9, -16, -19, 3, -23, -42, -38, -34, 0, 0, 22, 9, 16, 32, 41, 26, 1, 9, 8, 14, 11, -8, -5, 12, -4, 5, -5, 9, 8, -18, -26, -29, 9, -4, -38, -27, -21, 2, 17, 20, 18, 26, 21, 43, 37, 34, 25, -13, -12, 2, -7, 11, -12, -6, 0, -17, -5, -16, 10, 17, 0, -29, -19, -27, -7, 2, 21, 30, 21, 14, 23, 13, 15, 33, 12, -9, -6, -16, 15, 11, -2, -10, -13, 23, 14, 4, 19, -7, 2, -10, -13, -21, -18, -10, 15, 24, 10, 39, 3, 10, 5, 36, 33, 5, 6, -7, 5, -1, -14, 13, 12, -1, 15, 20, -11, 1, -2, -2, 1, -14, -2, 1, 30, 30, 17, 13, 26, 26, 3, 24, 21, 9, 6, 13, -6, -1, -16, 1, -8, -16, 1, 2, 17, 4, -4, -2, 15, 16, -7, -5, -9, 7, -16, -7, 11, -1, -7, 8, 6, 11, -4, -1, -11, -8, -1, -1, -3, -23, -23, -9, 21, 9, -8, 15, 29, 16, -12, -25, -44, -40, -60, -48, -45, -37, -20, -47, -24, -6, -7, -6, -16, -15, 4, 10, 16, -23, -29, -9, 16, 4, 14, 10, 50, 20, -43, -36, -56, -30, -61, -65, -50, -66, -74, -72, -55, -20, -8, -16, -12, 12, 6, 0, 18, 14, -15, -5, -18, 15, 30, 38, 18, -25, -41, -36, 6, -10, -29, -54, -61, -56, -69, -82, -42, -9, -9, -10, -2, -15, 18, -3, -7, -6, -3, 11, -7, 1, 35, 19, -12, -36, -50, 2, 0, 6, -14, -6, -24, -19, -39, -58, -41, -23, 3, -7, -11, -3, -5, 1, 3, 22, 5, -3, -9, -8, -7, -13, -8, -46, -17, 0, 22, -2, -15, -19, 25, 6, -9, -13, -43, -38, -17, 10, -18, -13, 9, -8, 5, 19, 27, 7, -5, 0, -15, -5, -46, -30, -10, 10, 20, 10, 17, 22, 46, 35, 24, 21, -27, -24, -28, -2, -3, 10, 3, 11, 8, 21, 6, 1, -8, 15, 12, -14, -17, -11, -11, 25, 25, 25, 36, 21, 22, 38, 37, 11, 6, -28, -22, 9, 6, 12, 11, -5, -2, 17, -1, 30, 11, -7, -12, -14, -24, -34, -14, 12, -1, 18, 33, 19, 19, 36, 29, 12, -2, -17, -27, 9, 7, 12, 0, 12, 16, -3, 7, 19, 10, 6, -21, -38, -64, -50, -3, 33, 2, 21, 19, 37, 23, 27, -11, 12, -6, -39, -1, -11, -16, -12, -9, -10, -16, 7, 14, -4, 19, 10, -42, -40, -79, -94, 12, 12, 32, 12, 12, 30, 31, 36, 1, -10, 9, 0, 9, -5, -1, -1, -5, 6, -6, -7, -9, -13, 1, -20, -38, -37, -65, -93, -7, 18, 13, 27, 17, 32, 18, 17, -18, -7, 20, -19, -17, -16, 11, -14, 8, -6, -14, -32, -15, -17, 21, 4, 1, -33, -61, -47, 5, 7, 44, 46, 27, 45, 24, -5, -2, 0, -11, 10, -17, 7, 9, 4, -10, -11, 14, -24, -9, 3, 9, 12, 10, -4, -27, -19, 19, 50, 52, 26, 48, 32, 12, 15, 17, -17, 9, 1, 14, 1, -20, -2, 1, -1, -2, -12, -29, -6, -1, 3, 1, -29, -28, 7, 4, 44, 16, 29, 45, 56, 39, 18, -8, -1, -6, 13, 4, 9, -3, 12, -4, 11, 15, 4, -11, -28, -27, -26, -33, -22, 0, -8, 9, 33, 41, 28, 18, 12, 21, -7, -24, -5, -5, -9, 0, 12, -12, -3, 12, -14, -4, 10, 17, 14, -4, -20, -24, -30, -6, 18, 17, 43, 51, 35, 27, 22, 3, -11, -6, -12, -22, -11, 7, 13, -4, -18, 1, -16, -15, 7, -3, -14, 7, -6, -12, -5, 14, 6, 15, 18, 4, 8, -7, -12, -4, -3, -7, 3, -2, 2, -3, 6, -16, 2, -14, 11, 10, 12, 3, 10, 5, -11, -11, -1, -6, -4, -20, -8, -13, -21, -20, -9, -12, -9, -4, -3, -6, -6, -8, -1, -17, 5, 1, 0, -14, -16, -12, -12, -1, -9, 11, -14, 15, 0, -20, -7, 9, 15, 1, -9, 12, -5, -1, 8, 5, 4, -18, -1, 3, -5, 7, -10, 12, -14, 12, -9, -17, 7, 4, 13, -11, -18, -13, -6, -7, 3, -13, -14, 4, 1, 5, -12, -20, -6, 11, -18, -1, 4, -13, 12, 14, 1, -14, -12, 9, -13, -14, -19, -19, 9, -6, -5, 15, -14, 13, 2, 3, 8, 7, -2, -1, 8, 11, 0, 13, 2, -7, -6, 4, 13, -13, -16, 13, 1, 19, -3, 3, -4, 22, 7, 2, 28, 26, 30, 26, 19, 15, -3, -7, -6, -9, -13, -17, -8, 7, 7, -7, 6, 3, -5, -1, 6, 6, 27, 10, -14, 15, 10, 12, 13, 16, 26, 16, 5, 25, 16, -11, -7, 6, -13, 11, -12, 4, 6, 2, 10, -3, 12, 24, 15, 17, 26, 25, -15, -4, 6, 21, 21, 19, 23, 11, 21, 24, 1, 25, -15, -11, 11, -11, -2, -9, -9, 10, 6, 21, 10, -18, -18, -5, -4, 5, 17, 18, 26, 24, 27, 31, 32, 49, 20, 40, 6, 8, -6, 6, -7, -17, -9, 3, 6, -11, -9, -11, 5, 7, -7, 21, 21, 8, 28, 7, 8, 42, 35, 42, 33, 31, 23, 19, 7, 10, 6, 6, 11, -7, -3, 8, 2, -2, -7, 9, 5, 21, 10, 8, 10, 26, 30, 27, 37, 29, 14, 22, 10, 19, 4, -1, 2, 4, 3, 6, -18, -16, 14, -22, 6, -13, 8, 3, -2, 33, 23, 5, -8, 14, -8, -2, 10, 11, -20, -27, -18, -19, -2, -11, -17, 4, 0, -3, -5, 7, -9, -9, 19, 14, 4, 11, 41, 28, 16, 7, -14, -13, 2, -26, -51, -41, -63, -50, -37, -49, -31, -6, -22, -29, -7, -10, -15, -6, 11, -11, 1, -5, 20, 27, 14, 14, 10, 1, -13, 3, -13, -32, -76, -44, -35, -41, -15, -42, -13, -25, -30, -46, -9, -2, 13, -8, 6, 12, -4, 29, 1, 10, 5, -11, -2, 3, 10, 9, 2, -3, -18, -6, 21, 0, -8, -21, -23, -42, -23, -26, -10, -7, -2, -17, -10, -15, -2, 12, -10, 3, -13, -7, 0, 8, -1, 4, 22, 29, 37, 6, 32, 4, -18, -24, -13, -26, -21, -44, -10, -9, -4, 2, -16, -7, -16, -21, -28, -24, 5, 0, 7, 14, -6, 20, 18, 37, 23, 26, 25, 15, -21, -26, -24, -17, -25, -17, -20, 7, -7, -1, -9, -8, 9, -13, -50, -20, -3, -7, 16, 10, -2, 13, 20, 28, 1, 21, -2, -10, -18, -18, 5, -21, 7, -2, 0, 3, -5, 5, -7, -10, -2, -34, -46, -13, -22, -29, 4, -3, 2, 46, 20, 0, -17, -11, -14, 14, 12, 21, 29, 9, 13, -6, -9, 3, -7, -1, 3, 2, 9, -3, -47, -31, -30, -25, -15, 3, 40, 12, 13, -13, -14, 2, -9, -6, 18, 27, 22, 44, 22, 15, -18, -8, -19, -19, -9, -14, 9, -4, -27, -37, -32, -49, -59, -58, -7, -12, -24, -17, -14, -36, -5, 11, 29, 16, 37, 33, 19, -3, 0, 4, -16, 5, -6, 5, 6, 26, -33, -7, -56, -70, -82, -64, -80, -50, -53, -36, -15, -3, 23, 1, 23, 17, 29, 24, 18, -17, -15, -20, 13, 2, 7, -4, 30, 21, 0, 12, 3, -6, -27, -60, -66, -58, -46, -28, -31, -10, 13, 13, 33, 5, 30, 35, 25, 18, 3, -7, 13, 5, -18, 2, 15, 14, 23, 29, 4, 9, 13, -19, -16, -5, 0, -14, -16, -3, -6, 26, 26, 23, 17, 35, 19, -14, -3, 7, -18, 4, 9, -4, 5, 31, 8, 2, 15, 5, 12, 17, 20, 32, 15, 10, 2, 20, 13, -9, 6, 34, 8, -1, 0, 7, 1, 2, 13, 14, -11, 13, 28, 7, 5, 27, 21, 23, 31, 42, 36, 30, 15, 15, 27, 28, 0, 22, 9, 11, 22, 27, 4, 7, -3, -17, 2, -9, -15, 5, 20, 26, 52, 35, 45, 33, 12, 40, 28, 23, 16, 21, 19, 13, 23, -5, -16, 5, 0, -14, -5, -1, 7, -6, -15, -10, -15, 12, 0, 5, 11, 43, 42, 50, 39, 25, 42, 38, 9, 18, 41, 37, -5, 3, -18, 4, 12, 17, 10, 11, -10, 2, -7, -15, 2, 10, -2, -1, 18, 30, 23, 45, 56, 59, 34, 36, 46, 37, 43, 18, 29, -14, 24, 17, 11, -1, -7, 14, 7, -16, 8, -12, -10, 4, -3, -5, 1, -10, 12, -1, 0, 28, 19, 24, 11, 32, 3, 24, 4, -3, -4, 12, -11, 12, 11, -6, 14, -14, 1, -14, 2, 0, 0, 6, -12, 6, -1, -5, 13, -15, -3, -4, 11, -2, -13, -17, -8, -9, -17, -17, 13, -16, 3, -15, 0, 3, -13, -9, 11, 15, 9, 3, 4, 10, 1, -5, -15, 14, 5, 9, -14, -11, -6, -11, 4, -1, 14, -18, 4, 11, -16, 9, 1, -17, 1, -9, -16, -16, -5, 15, 15, 9, -14, 5, 16, -9, 1, -7, -12, 13, -2, -15, -8, -9, 2, -18, -15, -1, -4, 0, -19, 2, -15, -10, 1, 13, 0, 9, 0, 15, 4, -11, 5, -18, 8, 2, -3, -6, -12, 13, 15, 15, 13, -4, -16, -6, 7, 3, -16, -10, -4, 4, 4, 13, 2, 11, -3, -13, 6, 7, -7, -15, -10, -29, -24, -29, 8, -19, -26, -15, -6, -11, 21, -2, -12, -13, -11, -11, 10, 1, 15, 5, 8, -19, -10, -17, -22, -8, 5, -29, -3, -28, -25, -18, -7, 9, 21, -1, -6, 1, -9, 16, 21, 8, 0, 15, -9, -8, -15, 5, -19, 1, -6, 9, 11, -11, -14, -23, 8, -3, 7, -1, -10, -4, -23, -32, -23, -8, -7, 28, 1, 15, 19, -7, 4, -2, -17, -18, -5, 2, 4, -2, 1, -5, -8, 0, -6, 15, -17, -10, -21, -36, -4, -12, 3, 5, 31, 8, 22, 8, 2, 10, 4, -10, 7, -15, 15, -4, 10, 4, 9, 11, -10, 24, -1, 24, -1, -4, -12, -9, 21, 22, 20, 28, 21, 30, 9, 27, 14, -5, -11, -14, 17, 18, 6, 8, 17, 13, 12, 18, 6, 25, 10, 21, 33, 16, 24, 28, 21, 22, 34, 31, 21, 11, 29, 11, 38, 13, 5, -6, 3, 17, 10, 17, 12, 29, 15, 22, 23, 22, 41, 42, 38, 37, 35, 12, 37, 15, -6, 0, 8, 23, 10, 22, 30, 27, -14, -17, 6, -10, 19, -5, 28, 16, 17, 17, 1, 25, 31, 29, 65, 21, 28, -3, -10, 9, -16, 11, 9, -24, -17, 23, 22, 13, 15, -9, 8, -5, 6, -7, 17, -5, 1, -8, -2, -4, 12, 7, 36, 24, 12, -6, -14, -18, -32, -19, -23, -36, -42, -7, -3, 21, -15, -8, -8, 0, 4, -13, -2, -27, -5, -12, -8, -17, -44, -55, -51, -26, -21, -49, -40, -10, -20, -21, -34, -37, -36, -10, -13, 9, 15, -3, 0, 10, 2, -30, -23, 0, -17, -24, 1, -35, -26, -65, -61, -8, -42, -13, -3, -23, -21, -28, -23, -37, -21, -20, -1, -2, -16, 3, -17, 8, -22, -28, -13, -36, -34, -8, -37, -38, -22, -36, -26, -11, -22, -13, -12, -15, -7, -17, -33, -17, -23, -23, -20, 6, -10, -10, 3, 7, -19, -16, -29, -15, -17, -30, -6, -10, -37, -17, -1, 4, -8, -25, -6, -25, -19, 4, -16, -22, -26, -19, 9, 13, -10, -15, 14, 0, 12, -20, -17, -31, -28, -10, -27, -24, -14, -24, -1, 12, 2, -18, -6, -11, -27, -11, -8, -17, -6, 10, 18, 5, -6, -4, -3, 1, -15, -25, -20, -43, -46, -30, -14, -26, 1, 0, 29, 3, 32, -9, -16, -19, -17, 1, -8, -17, -27, 3, 8, 12, -11, 1, 11, -2, -3, -12, -26, -11, -9, -7, -5, -13, 7, 25, 26, 18, 3, 9, 14, -6, -15, -17, -20, -16, -12, 12, -7, -12, -2, -8, -7, -10, 15, 6, -25, -16, 11, 15, 40, 0, 8, 15, 25, 0, 35, 9, 15, 15, 2, 8, -16, -34, -4, 13, 2, 17, 11, 15, 8, -10, 12, -6, 8, 6, 17, 27, 2, 11, 5, 18, 15, 32, 11, 19, 20, 12, -3, -3, 9, 7, 11, 16, -15, -6, -8, -9, 11, 16, 7, 23, 21, 25, 11, 9, 27, 8, 13, 18, 10, 20, 4, 21, 18, 26, 14, 23, 0, 2, 0, 17, 14, 8, 9, -6, 4, -2, 8, 1, 21, 14, 8, 12, 17, -18, 2, 12, 23, 8, 24, 6, 9, 8, -3, 9, -5, 9, 3, -15, -3, 11, -11, -11, -17, -2, 8, 8, 2, 25, 13, -14, 9, 19, 14, 5, 4, 9, 8, -1, 16, -8, 15, -3, -6, -12, 13, -17, 8, -1, -10, 12, -12, -9, -20, -17, 3, -20, 5, 1, 27, 19, 15, 9, 10, 21, 4, 8, 5, 26, 7, -9, -15, -17, 10, -6, 14, -4, 3, -9, -8, -18, 14, 1, -28, -21, -4, 18, 12, -13, 20, 37, 18, 26, 3, 28, 19, 29, 25, 12, 8, 5, -11, -6, -14, -11, 12, -15, -9, 9, -11, -10, -5, -12, -20, 12, 12, 2, 16, 14, -6, -10, 29, 8, 15, -4, 19, -1, 5, -15, 7, -6, 5, -17, 0, 8, 16, 3, -11, -3, -1, -2, -4, -13, -9, 5, 5, 4, -8, -4, -14, -8, 18, 2, 4, -8, 1, 16, -5, 0, -2, -14, 12, 7, 8, -2, -7, -3, 13, -1, 6, -13, 15, -1, -9, -11, 1, -5, 10, -1, 14, -4, 9, -3, -10, 0, 14, -14, 1, -17, -15, 14, 1, -15, -11, 9, -16, -12, 16, -15, -14, -16, 3, 1, 6, -11, -11, 7, -14, -8, 0, 4, -8, -8, 11, -6, -2, 13, 11, 14, 8, 13, 6, 5, 5, -10, 18, 9, 3, 22, -1, 29, 8, 10, 29, 12, -4, 17, 1, 4, 5, -5, 19, 14, -9, -19, 1, 5, -9, -1, 6, -2, 3, -5, -3, 19, 2, -6, -1, 5, 11, 10, -3, -6, -22, 5, -3, 7, 2, 24, 6, 17, 14, 2, -14, 1, 2, -8, -6, -2, 12, -6, 14, -11, -17, -12, 6, 4, -13, 4, -16, -23, -13, 2, 13, 0, -4, 9, 24, 7, 1, -2, -19, -1, 13, 0, 14, -4, 4, 0, -9, -24, -6, 5, -21, -8, -12, -33, -30, -12, 6, 28, 25, 4, -1, 20, 8, -7, 6, -18, -11, -5, 6, -12, -1, 11, -16, -17, -19, -14, -25, -16, 5, -14, -34, -14, -36, -36, -21, 16, 17, 24, 14, -24, 7, 1, -3, -7, 9, 15, -5, 11, -9, 10, -31, -39, -33, -38, -29, -7, 1, -4, 2, -6, -8, -30, 11, 20, -4, 20, 22, 13, -2, -3, -16, -3, -3, 0, 12, 12, 1, 2, -24, -43, -52, -47, -41, -22, -10, -11, -2, -21, -1, -19, -2, -4, 14, 13, 28, 8, -11, -12, -1, -7, -13, 13, -7, -3, -19, -8, -39, -27, -39, -12, -3, 9, 8, -1, -4, -3, 12, 7, -6, 10, -1, 3, 0, -18, -38, -29, -21, -23, 13, -1, -12, -3, 7, -8, -12, -9, -15, -20, -8, 9, 9, 6, -2, -11, -32, -7, 8, -18, -14, -25, -25, -37, -17, -35, -19, -21, 2, -9, -11, -10, 6, -21, 13, 10, -2, 6, -8, 2, 0, -1, -25, -50, -23, 1, -11, 6, -9, 3, -29, -39, -17, -35, -38, -11, -9, 2, -5, -10, 7, -3, 0, 11, -4, -6, 1, -19, -19, -22, -20, -15, -22, -28, 9, 5, -10, -22, -12, -11, -13, -30, -36, -20, 13, 5, 2, -4, -12, 6, 12, 22, 26, 28, -6, 0, -30, -19, -24, -2, -4, -5, -1, 4, -12, -6, -13, 12, 11, -5, -14, -17, -13, -14, -7, 10, -7, 4, 7, 13, 31, 34, 22, -18, -43, -9, -18, -12, -9, 22, 12, -1, -2, 6, 4, 24, 5, 1, -7, -5, 12, 13, -7, -4, 19, 15, 20, 36, 37, 43, 22, 26, -12, -8, -10, -3, 22, 12, -1, 0, 6, -5, 16, -2, 3, -12, 19, 1, 3, 5, -6, -16, 15, 11, 30, 38, 32, 57, 51, 49, 31, 23, 4, 19, 5, 9, 18, 3, 4, -9, 19, 0, 4, -7, 7, 12, -12, -7, -5, 6, -13, -32, 11, 35, 43, 45, 36, 48, 55, 35, 16, 3, 31, 28, 9, 5, 9, -14, -13, -7, -12, -21, 4, 12, -5, -17, -2, -13, -6, -3, -14, -12, 41, 39, 36, 46, 45, 28, 36, 38, 43, 13, 7, 15, 13, -9, 14, 19, -6, 4, 18, -16, 11, -8, -6, -12, 8, -13, -26, -13, 25, 31, 14, 15, 32, 8, 15, -1, 35, 21, 37, 28, 26, 2, 29, 26, 4, -9, 13, 1, -6, 13, 7, -18, 4, -11, -2, -17, 2, 0, 23, 18, 5, 16, 6, 18, 34, 45, 41, 34, 42, 16, 9, 21, 29, -1, 14, -18, -1, 12, 9, 16, -11, -18, 2, -15, -12, 14, 8, 0, 6, -11, -3, 8, 21, 35, 40, 45, 32, 12, 11, 44, 26, 5, -1, -9, 10, 7, 13, -15, 10, 7, 13, -5, -16, -3, 2, -27, -18, -26, -13, -9, -16, 10, 4, -1, 18, 24, 29, 5, 8, -12, 1, -7, 13, -18, 4, 12, -15, -1, -8, -12, -21, -17, -17, -9, -28, -18, -19, -19, 3, -4, -10, 11, 23, 0, 6, 14, -8, 3, -7, -15, -14, -11, 1, -1, -12, -12, -8, -2, -25, -15, -19, -36, -13, -30, -38, -33, -40, -27, -40, -21, -11, 12, -2, 24, 19, 17, 16, 11, 8, 2, -5, -9, 8, -1, -11, 2, -17, -20, -20, -8, -21, 1, 7, -25, -10, -19, -22, -23, 19, 16, 12, 6, -6, -3, 14, -15, -19, 9, 6, 1, 1, 5, 13, 23, 12, -3, 11, 6, 14, 34, 0, 14, 6, 2, 2, -8, -14, 4, 1, -15, -3, 3, -2, 0, 11, -12, -8, 14, 2, 8, 12, -9, -17, -4, 8, 15, 8, -4, -17, 9, -11, 12, -11, 9, -17, -1, -14, -14, -16, 11, 11, 2, 1, 16, -8, -14, 12, 7, 12, 0, 8, 10, -7, -8, 4, 7, -17, 15, -17, -8, -10, 7, 2, -6, 9, 6, 5, 17, 15, 2, 6, -7, -5, 7, -5, 12, -16, 6, 10, -8, 11, -6, 14, -21, 8, -18, -13, -10, 4, 11, -13, -7, -18, -12, 10, 13, -13, -13, 15, -5, -13, 3, 5, 16, -7, 9, 9, 4, -1, -14, -21, -32, -28, -36, -39, -26, -28, -1, -8, -5, -6, -20, -19, -14, -6, -2, -6, 6, 6, -2, 1, -4, -12, -16, -19, -11, -13, -24, -14, -17, -18, -40, -43, -38, -41, -55, -58, -34, -20, -28, -20, 0, 12, 2, -7, 6, 1, -9, -16, 12, -10, -5, -27, -11, -3, -35, -4, -48, -44, -34, -39, -43, -34, -33, -59, -34, -18, -16, -3, -12, -14, -5, 12, 9, 11, 13, 9, 8, 7, -22, -3, -1, -14, -34, -12, -49, -44, -37, -39, -27, -31, -12, -44, -42, -28, -13, -24, -31, 6, -12, -4, 14, 1, 2, 11, 0, -12, -6, -20, -10, -20, -17, -23, -28, -3, -15, -13, -27, 2, -14, -12, -23, -11, -16, -28, -6, -4, 3, -12, 1, -5, 1, 6, 13, 5, 17, 9, 2, 13, 16, 5, 11, 29, 18, 7, 28, 0, 19, 14, -10, -2, -1, -7, -16, -14, 5, -3, 9, 12, 2, 2, -12, 5, 27, 9, -6, 18, 20, 9, 29, 14, 47, 38, 13, 29, -2, 19, -11, -17, 16, -4, -7, 0, -6, -5, 13, -1, -5, 28, -6, 21, 29, -8, 11, 7, 35, 39, 23, 36, 29, 48, 47, 15, 22, 22, -4, -17, -23, -14, 12, 11, 0, -7, 13, 2, 3, 28, -2, 6, 19, 14, 6, 3, 15, 42, 47, 40, 41, 38, 40, 19, 32, 23, 2, -36, -18, -1, 2, 17, 15, 11, 12, -3, -3, 4, 5, 0, 2, 2, 15, 12, 21, 19, 6, 27, 24, 7, 27, 10, 23, 28, 10, -19, -29, 0, -7, 7, 20, 2, 13, 17, 9, 21, 9, -19, -3, -4, 7, 12, 5, -4, -13, -11, 8, 4, -20, 0, 22, 31, -3, -28, -34, -10, -24, 13, 6, 0, 3, 10, -3, -6, 15, -12, -17, 31, 25, -16, -11, 12, 13, 2, -20, -15, -3, -8, 32, 20, -5, -32, 0, -21, 24, 20, 26, 19, -13, 10, 15, 12, -3, -18, 15, 33, -3, -8, 17, 9, 13, 14, -3, -14, 0, 25, 38, 14, 26, -21, -1, 12, 24, 5, 0, -16, -4, -2, 3, -10, 18, -6, 8, 2, 11, 10, 1, -6, 14, -5, -15, -13, 4, 29, 20, 0, 34, 11, 10, 25, 35, 10, 8, -11, -14, 5, 1, 10, 23, -1, 7, 32, 30, 14, 7, 9, -3, -29, -17, 9, 22, 43, 21, 8, 14, -2, 28, 19, 32, 17, 8, 9, -10, -5, 4, 7, 10, 5, 22, -2, 4, 13, 19, 9, -16, -9, -12, 10, 6, 32, 24, -9, 19, 1, 42, 9, 26, 12, 17, -3, -14, 2, 17, 12, -10, -5, -2, -9, 9, -10, 5, -17, -27, -31, -1, 13, 4, 4, 11, -5, 19, 8, 20, 5, 8, 5, -1, 14, -13, 15, 0, -5, -6, -16, -19, -34, -39, -19, -18, -29, -6, -8, -16, 3, -21, -5, -18, 20, 11, 11, 11, 13, 5, -9, 14, -5, 13, 8, 7, 4, 3, -5, -38, -50, -29, -23, -39, -8, -7, -13, -22, -29, -5, -9, -16, -9, 14, -8, 9, -11, 0, 12, -8, 8, -8, 5, 15, 6, -3, -19, -32, -16, -19, -45, -16, -18, -10, -7, -27, -30, -16, -45, -41, -23, -45, -16, -22, -2, 14, 15, -4, -11, 16, -5, 12, -5, -21, -4, -4, -19, 1, -12, -21, -26, -2, -23, -28, -7, -21, -26, -39, -69, -39, -26, -13, 5, 10, -5, -17, 0, -14, 9, -16, -12, -17, 20, 14, 35, -6, -2, 11, 3, -11, -44, -13, -19, -22, -22, -69, -71, -61, -32, 1, 14, 15, 18, -16, 6, 17, -10, -4, -1, -2, 33, 14, 5, 15, -4, 8, 1, -14, -11, -7, -15, -26, -30, -26, -38, -3, 7, 18, 3, 4, -10, -2, 10, 15, -15, 11, -11, 14, 31, 10, 2, 3, 19, 5, 18, 17, 2, 8, 18, 3, -8, 9, 12, 5, 17, 16, 8, -12, -11, -16, -5, -3, -16, 15, -10, -8, -9, 14, 18, 25, 29, 19, -1, 35, 7, 30, 10, 27, 18, 10, 10, 13, 13, -11, 10, 6, 7, 4, 8, -1, 8, 2, 4, 9, -5, -12, 6, -3, 14, 6, 11, 5, 10, 11, 1, -7, 14, 9, 5, -8, 3, 1, -10, -9, -14, -13, 0, -11, -17, 7, -23, -2, -3, -4, -7, -14, 8, 1, 5, -24, -12, -15, -17, 6, -14, -4, 7, -4, -8, -8, -7, -6, -10, -1, -10, -13, -16, -17, -3, -17, -20, -13, -21, -15, -2, -22, -8, -26, -9, -8, 0, 10, 5, -20, 1, 2, -19, 4, -5, -9, -19, 9, -3, -24, -11, -24, -15, -22, -14, -21, 1, -23, -2, -19, -24, 0, -10, -12, -39, -25, -7, -30, -23, -31, -6, -10, -3, -1, -10, -25, -19, -24, -16, -17, 5, -13, -17, -19, -10, -13, -12, 10, -4, 4, -3, 6, -14, -7, 6, -6, -8, -12, -31, -26, -9, 3, 7, -23, -22, -9, -4, -18, -12, 5, 8, -17, 16, -2, 7, 28, 18, 30, 18, 9, 21, 28, 22, 15, -10, -25, -20, -4, -35, -3, -10, 0, -5, -23, -21, -19, 4, -10, -6, -18, -16, -11, -4, 21, 27, 17, 5, 22, 3, 7, 22, 21, 23, 11, -6, -24, -25, 4, -13, -5, 0, -12, 3, -24, 7, -13, -2, -11, -11, -4, -4, -4, 5, 1, 6, 12, 6, 25, -5, -3, 8, 11, 3, -5, 4, 0, -14, -8, -22, 8, 7, -17, -14, 11, -10, 3, -19, 9, 11, 14, -7, 10, 16, 12, 6, 24, 15, 6, 17, -17, 3, 4, 29, -5, -3, 4, -20, -22, -24, 0, 8, 14, -3, -15, 4, -8, 10, 0, -24, 6, -1, -12, 13, 37, 28, 25, 14, 18, 8, -3, 6, 3, 11, 2, -23, -17, -11, -17, -15, -16, 2, -15, -10, -14, 19, -13, -8, -19, 1, -15, -2, 14, 11, 3, 9, 8, 15, 19, 23, 30, 10, 3, -23, 3, -17, 3, -13, -5, -17, -18, -7, -2, 0, 11, -16, -15, -35, -14, -22, -25, 4, 28, -8, 24, 22, 0, 37, 24, -13, 0, 8, -3, -24, -16, -3, -26, -23, 1, 20, 18, 25, 22, 4, -16, -35, -23, -36, -17, -2, -8, 11, 22, -2, 14, 28, 38, 19, 0, -19, 3, 3, -29, -23, -25, 3, -6, -3, 9, 3, 0, -7, 21, 23, -3, -23, -39, -24, -14, 23, 24, 1, 17, 23, 5, 12, 6, -23, -20, -7, -26, -17, -28, -17, 18, 17, 15, 14, 6, 26, 24, 46, 21, -10, -12, -21, 22, 8, 14, 12, -1, 17, 18, 9, 16, -17, -7, -17, 4, 1, -25, 15, -4, 30, 14, 19, 31, 33, 27, 26, -2, -18, -7, 9, 14, -23, 3, 11, 11, -4, -3, 19, -10, 9, 3, 5, -19, -2, 4, 0, 17, 8, -3, 27, 24, 3, 33, 17, -4, -6, -22, -21, 9, -18, 12, 5, 14, 22, 19, 19, -1, 6, -25, 9, -20, -14, 1, -3, 21, -7, -2, 9, 34, 36, 28, 11, -11, -10, -17, 0, -20, -10, -15, 10, -6, 6, 26, -11, -1, 7, -10, 8, -4, -5, 1, 4, 24, 18, -1, 11, 21, 33, 30, 1, -40, -36, 16, -7, -28, -14, -5, -6, 20, 3, -8, -1, -4, -7, -11, 5, -13, 8, 21, 0, 18, 19, 9, 8, 41, 27, -17, -36, -49, -30, 20, -1, -23, -2, -15, 1, 9, 0, 3, -7, 7, 0, -13, -5, 8, 14, -2, 3, -4, 14, 16, -1, 22, -11, -4, -21, -38, -14, 16, 13, -2, 6, 3, 8, 11, 9, 4, -5, -11, -15, -4, -19, 2, 7, -3, 7, 18, 21, 13, -6, 19, 4, -20, -7, -24, 18, 6, 7, -13, -3, 9, 5, 10, 8, -16, -2, 1, -15, -9, 1, -18, 17, -7, -16, 15, 7, 10, 9, -3, 14, -1, 16, -17, 8, -3, -5, -21, 3, -1, 12, 0, 1, 1, -16, -12, 6, -1, -25, 10, 15, 7, 3, -2, 19, 10, 2, -6, 0, -2, 18, -2, 20, 15, 12, 15, 13, -10, 11, 5, 7, -2, -1, 1, 6, 4, -3, -15, 10, 11, -12, -23, 13, 7, 28, 21, 25, 6, 32, 18, 30, 24, 12, 32, 9, 2, -4, 4, 2, 8, -18, -5, 6, -13, 9, -1, -12, -11, -20, -9, -6, 1, 5, 27, 22, 34, 44, 45, 18, 41, 21, 21, 7, 8, 10, 3, 15, -3, -17, 0, -23, -2, -22, -3, -7, -8, -18, 0, -19, -27, -19, 3, 1, -21, 11, -4, -8, 15, 12, 4, 5, -10, -14, 0, 8, -14, 4, -17, 0, -1, -22, 7, 1, -19, -2, -23, 4, -16, 2, -4, -20, 6, -3, -15, -20, -31, -26, -7, -26, -10, 1, 3, -3, -11, -14, 2, -13, -1, -21, 3, -2, -2, -17, -1, -9, -10, 8, -8, -3, 4, 3, -28, -8, 4, 3, 7, 1, 3, -5, -4, -15, -25, -19, 6, 6, 7, -5, -18, -8, 9, -9, -18, -10, 0, -5, -9, 6, 8, -13, 9, -9, 8, 1, 3, 10, 13, 4, 12, -7, 10, -9, 9, 0, -15, -9, -7, -6, 0, 7, -2, -9, -3, -1, -14, -15, -3, -9, -1, -18, 3, 12, 13, -6, -3, -10, 11, 9, -14, 3, 5, -4, 9, 4, -18, 5, 14, -2, -8, 8, -17, 9, 4, 3, 1, -2, -5, -16, 8, -10, 5, -23, 6, 7, -14, -13, -9, -15, -12, 10, -17, -11, -11, 5, -8, 10, -1, -9, 10, -6, 1, 25, 12, 3, 21, 6, 10, 5, 2, 10, 1, -2, -17, -9, -2, -2, -7, 9, -14, -16, 0, 7, 0, 4, -7, 15, 4, 25, 37, 39, 46, 41, 11, 23, 28, 19, 33, 25, -2, -12, -15, -22, -3, 15, -11, -18, 1, -6, -15, -2, 11, 17, 7, 30, 13, 29, 7, 36, 21, 19, 8, 23, 29, 10, 32, 8, -5, 2, -10, -27, -17, 1, -9, -2, -1, -1, -8, 16, -7, 38, 32, 6, 15, 21, 23, -2, 19, 21, 22, 6, 22, 1, 15, 19, 8, -2, -15, -18, 8, -10, -16, 7, -15, -12, -1, -9, 25, 33, 15, 8, 0, -11, -14, 3, -10, -17, -3, -17, 3, -3, 11, 0, -9, -8, -20, -15, -23, -24, 7, -7, -10, -12, 8, 5, 7, 37, 28, 19, -14, 5, -29, -15, -14, -16, 9, -15, 13, 17, 5, 27, -1, -7, -24, -6, -18, -6, -15, -12, 12, -4, 15, -1, 15, 36, 1, 1, -4, -37, -43, -52, -3, -7, -23, -1, 4, 25, 38, 10, 11, -19, -30, -29, -32, -10, -2, 4, -10, 6, 11, -9, 0, 10, -10, -25, -8, -32, -32, -40, -3, -2, -7, -30, 27, 40, 22, 33, 0, -33, -33, -20, -26, -16, -17, -10, -2, 14, 5, -14, -15, -17, -35, -24, -26, -6, -13, 11, 7, -20, -22, -14, 1, 19, 41, 13, -18, -49, -51, -23, -25, -5, -11, -1, 3, -14, -19, 12, -22, -48, -21, -16, -4, -4, 8, 23, 1, -14, -1, -19, 22, 24, 36, 19, -34, -26, -42, -38, -32, -5, 6, -6, 14, 12, -13, 2, -28, -34, -46, -32, -7, -10, 2, -8, 5, 3, -15, -17, 14, 9, 27, -10, -27, -28, -26, -43, -19, -16, -1, -14, -2, -4, -14, 0, -5, -35, -28, 14, -17, -1, -20, -18, 5, 13, 2, 0, -5, 17, 0, 0, -26, -19, -18, -8, -13, 0, 4, -2, 5, -10, -12, 11, 19, -3, 21, -3, -10, -2, -31, -12, -14, -6, 9, -10, 26, 24, -1, -10, -14, -26, -15, -6, 18, -9, -11, -9, 3, 14, -11, 5, 25, 28, -11, -16, -25, -12, -55, -58, -37, 2, -13, 7, -15, 3, -13, -9, 4, -10, 26, 0, 5, 6, -4, -2, 12, -3, 14, 0, 31, 34, -11, -1, -21, -28, -35, -48, -9, -2, -13, -17, -3, 18, 17, 19, -14, 12, 10, 21, -2, 2, -4, 11, 14, 0, 0, 35, 28, 21, 8, -3, -5, 2, -7, -2, -19, 3, -12, -1, 21, 20, 5, 9, 14, 3, 30, 31, 8, 5, 1, 13, -8, 14, 3, 15, 26, 35, 21, 12, 13, 6, -11, 0, 4, 13, -8, 27, 21, 24, 17, 19, 7, 3, 0, 18, 1, 8, 6, 10, -11, -16, -17, 19, 32, -4, 5, 4, 24, 15, -4, -7, 13, 15, -3, -9, 6, 23, 15, -9, 18, -3, -14, 3, -12, -11, -8, -10, 3, -3, 1, 8, -9, 1, -15, 13, -4, -6, 3, 14, -9, 1, 9, 19, 6, 6, 14, -7, 12, 0, 5, 5, 16, 5, 11, -8, 9, -2, 13, 20, 12, 6, 11, 16, 16, -15, 23, 1, 5, 10, -13, -14, -11, 12, 16, 24, -3, 19, 16, 0, 21, 5, 12, 10, 12, 11, -3, 16, 27, 11, 0, 25, 7, 13, 21, 23, -1, 2, 10, -10, -12, 8, 36, 20, 9, 19, -4, -8, -7, -7, 7, 4, 15, 3, 2, -5, 2, 16, 31, 14, 3, 12, 7, 4, -22, 0, 11, 9, 13, 4, 29, 3, -3, 13, -7, 0, -1, 14, -15, -17, 2, 1, -2, -17, 14, -8, -7, 1, -2, 7, 9, 22, 14, 23, 5, 8, -18, -19, -17, -18, 6, -4, 1, 14, 7, -3, -4, -4, 2, 13, 8, -7, 11, -2, -10, -14, -21, -7, -1, -11, -5, -21, -22, -10, -3, -2, -6, 8, -6, -9, -16, -4, 3, 2, -11, -2, 6, -13, 8, 5, -14, 2, 1, -6, 2, 1, 1, 4, 3, 8, -16, -2, -13, -17, 10, -2, -16, -2, 11, -10, 10, 11, -3, -9 };
+alignas(64) constexpr std::array<int8_t, 100352> fc1_weight = { 2, 0, -5, 16, 4, -14, -7, -10, -10, 6, 6, -13, 9, -12, 15, -7, 13, 8, -4, 9, -12, -15, -11, -15, 10, -12, 9, 7, -8, 4, -4, -13, 4, 10, -13, 5, -10, -1, -8, 12, -19, 5, -6, 7, 1, -17, -1, -6, -18, -8, 3, 1, 0, -11, -10, 2, -9, 7, -3, -14, 15, -6, -8, 11, -22, 13, -2, -19, 4, -29, -12, -21, 19, -6, -6, 0, -9, -9, -11, -17, 3, -4, -16, -7, -15, 17, 9, 12, 7, -1, -14, -21, 7, 9, -11, 1, 16, 0, 7, 21, 10, 22, 16, 13, 3, -6, 1, -6, -25, 14, 13, -11, -15, -15, 12, 17, 13, 0, 9, 11, 18, 5, 18, 16, 33, 28, 26, 5, 27, 20, 31, 28, 14, 6, -22, -14, -22, -9, -13, -16, -7, 11, -13, 11, -8, 8, 13, 25, -8, 7, 5, 8, -8, -10, 0, -1, 19, 34, 22, 17, 19, -7, -10, -15, 0, -17, -2, 7, 14, 14, 12, 19, -2, 9, 36, -1, -1, 0, 2, -21, -19, -17, -26, -12, -8, -9, 2, 17, 19, 24, 18, 7, -11, -9, 8, 13, 2, -15, -8, 17, 11, 40, 27, 17, -8, -14, -17, -17, -24, -22, -41, -34, -12, -14, 20, 33, 39, -7, -14, 4, 3, -3, -8, -11, 13, 3, 16, 22, 5, 10, 12, -15, 2, 15, -12, 5, -18, 3, 0, -20, -7, 3, 18, 28, 9, 15, -3, -14, -23, -4, -14, 13, 15, -1, 14, 14, 9, 20, 14, -16, 3, -3, -4, 7, -12, -8, -13, -19, 11, 23, 23, 31, -5, -8, -11, -31, -26, 13, -8, -1, 8, 15, -12, 21, 18, 15, -18, -6, -30, -3, -7, -15, -8, -13, -25, 1, 26, 18, 12, 22, -16, -37, -21, -20, -21, 1, -13, 8, -7, -5, 17, 17, 0, -12, -3, -18, -30, -38, -23, -24, -18, -15, -29, -16, -2, 16, 17, -2, -21, -43, -50, -50, -40, 0, 0, 11, 2, -14, 0, 3, 4, -18, -19, -21, -14, -9, -2, -12, -1, 1, -38, -15, 8, 18, 0, -28, -44, -41, -22, -30, -31, -9, -12, 11, 6, -9, 17, 10, -13, -20, -12, -11, -30, -6, -23, 10, 7, -8, -23, -22, 16, -4, 1, -22, -9, -8, -5, -53, -27, 4, 12, -12, -1, -14, 2, 1, -2, 11, -14, -2, -20, -21, -19, -7, 16, -21, 5, 12, 5, 19, -2, -5, 11, -16, 1, -16, -19, -13, 7, -9, 9, 4, 19, 3, 5, 9, 6, 7, -2, 0, 11, -10, 9, 10, 2, -5, 6, -5, 6, -2, 7, 8, 14, 7, 1, 7, -1, 9, -13, -2, 10, 2, 19, 31, 10, 0, -15, 11, -15, -4, 0, 25, -2, 13, 4, 23, 26, 48, 54, 42, 23, 24, 14, -8, -5, 8, -15, 12, 2, 28, 27, 10, 22, 24, 1, 5, -9, -34, -22, 17, 4, 21, 23, 22, 51, 43, 24, 27, 7, 27, 15, 24, 18, -6, 12, -14, -13, 38, 52, 38, 22, -9, 8, -14, -26, -28, -11, 9, 9, 18, 28, 39, 11, 35, 29, 36, 22, 16, 6, 17, 7, -4, -18, -11, -9, 21, 21, 33, -10, -14, -11, -23, -15, -6, -24, 2, 0, -9, -8, 22, -7, 16, 7, 11, -14, 6, 2, -7, 18, 16, -9, -12, -14, 2, 23, -7, 9, -19, -7, -3, -6, -13, 0, 5, 0, -9, -10, 13, -12, -23, 6, -1, 7, 5, -15, 7, 6, 2, -11, 1, -5, 0, -2, -31, -4, -2, -22, -20, -19, 3, -2, 2, -7, -10, 4, 11, -14, 19, 4, 11, 18, 19, -7, -11, -12, -8, 10, -2, 3, 20, 16, -5, 0, -21, -22, 2, -3, -2, 0, -13, 1, 5, 0, 14, -14, -8, 15, 0, -5, 10, 5, 14, 1, 5, 8, -9, 17, 1, 10, 0, 18, 4, -3, -9, -8, -12, -3, -12, 14, -2, -2, 10, 3, 0, 4, -10, -12, -5, 9, -9, 3, 12, -6, 2, 3, 20, 1, 16, 6, 32, 35, 9, 4, 7, 5, 30, 37, 21, 26, 8, 12, -31, -38, -23, -15, -24, 13, -16, 9, -5, -2, -16, -4, 5, 1, -7, 2, 11, -4, -10, -5, 19, 26, 25, 17, -5, 17, 14, 9, -16, -8, -14, -14, 0, -8, 15, 16, 3, 7, 15, -4, -14, 16, 13, -18, -18, 6, -13, -16, -26, -13, -36, -42, -14, -33, -32, -29, -10, -2, -7, -3, 10, -9, 12, -1, -12, -9, 10, -1, -3, -9, -14, 10, 3, 14, -15, 4, -12, -18, 4, -6, 7, -13, -1, 6, 10, -15, 9, 14, -12, -5, -8, -10, -11, -9, -16, -13, 10, -11, 8, 17, 15, -10, -8, -17, 12, -14, -5, 11, 7, -2, -13, -7, 17, 4, -2, 11, 9, -16, -5, -16, 0, -11, 12, 3, 2, -10, -2, 3, 14, -10, 11, 16, 8, 5, 13, 0, 13, -16, -8, -2, 2, 8, 8, 4, 16, 6, -11, -5, 0, 9, -3, 8, 7, 13, 15, -13, -14, 5, 5, 5, -3, -10, -10, -7, -4, -4, 19, 2, 1, 10, 6, 15, -9, 13, -10, 12, 5, 11, 11, -14, -13, 9, 5, 15, 15, 12, -2, 2, 26, 1, -12, -15, -8, -19, 5, -22, -5, -9, -15, -10, -18, -6, 11, 12, 14, -1, -9, -9, -10, 7, -19, 15, -12, -13, 7, 0, -12, -13, -5, -1, -12, -8, 10, -13, -2, -10, -23, 2, -5, -12, -19, -16, 14, -1, 15, 13, 5, -14, -9, -12, 9, -8, -7, -14, -14, -38, -9, -29, 11, -9, 22, 5, -7, -9, -9, -28, 6, 6, -5, -10, 14, -3, 0, -16, 2, -10, -11, -8, -4, -30, -27, -32, -23, -36, -32, -4, -21, 0, 4, -12, 13, -4, -10, -13, -26, -6, -5, 2, 10, -16, 2, -6, -9, 11, -22, -6, -29, -15, -23, -43, -22, -23, -33, 1, -21, 2, 12, -8, 7, -7, -8, -3, -15, -28, -13, 14, 5, -16, -6, 7, -1, -30, -21, -34, -30, -46, -16, -15, 1, -30, -21, -20, -11, -10, -40, -4, -18, -21, -9, -31, -39, -23, -17, 0, -18, 1, 7, 5, -2, -22, -8, -44, -36, -41, -13, -3, -21, 8, 1, 3, -12, -18, -22, -13, 11, -17, -19, -21, -48, -41, -12, -24, -9, -8, 15, -18, -6, -6, -24, -14, -26, -5, 0, -6, 10, 23, 14, -25, -10, -9, 6, 3, 14, -19, -36, -42, -58, -43, -18, -3, 8, -5, -4, -23, -6, -15, -15, -3, -5, -6, -8, 7, 13, 37, -18, -23, -20, -18, -11, -10, 27, 1, -11, -17, -64, -67, -36, -19, -7, 10, -6, -4, -1, -36, -28, -28, -18, 5, 32, 25, 43, 27, 19, -18, -15, -20, 3, 7, 15, 10, 10, -8, -40, -40, -33, -11, -15, -5, -3, 13, -22, -19, -2, 12, 7, 33, 7, 41, 30, 32, 6, -18, -24, 13, 22, 34, 7, -1, -15, -16, -10, 15, 8, -15, -2, 17, 5, 14, -2, -6, 15, 9, 22, 23, 10, 21, 33, 19, -14, -6, 6, 40, 39, 15, 18, 3, 19, 25, 21, 9, 0, -2, 9, -4, 10, -17, 22, 11, 2, -3, 28, 5, 2, 33, 30, 14, -17, -22, 33, 35, 42, 10, 37, 10, 9, 20, 18, 21, 20, 13, -14, 1, 0, 6, -13, 13, 20, -2, 28, 16, 8, 30, 12, -3, -18, 19, 39, 45, 30, 46, 18, 24, 17, 17, 2, 32, 16, 12, 16, 12, -4, 15, -15, 1, 6, 12, 6, 4, 18, 17, 34, 6, -10, 25, 20, 46, 32, 50, 21, 22, 22, 11, -6, 15, 16, -6, 8, -16, -5, -1, -19, 16, -1, 4, 27, 1, 19, -2, 3, 8, -9, 23, 40, 38, 44, 10, 34, 6, 41, 7, 30, 24, 0, -4, 9, 15, 14, -12, -13, 21, 2, 17, 17, 8, -5, 7, -10, -8, -1, 31, 24, 35, 9, 10, 11, 1, 31, 29, 16, 20, 1, 12, -16, 6, -15, -6, 4, 20, 4, -12, -10, -5, -16, -10, -20, -26, -6, 0, -5, -18, 3, 11, -12, -10, 17, 8, 6, 7, 1, 0, -9, 3, -14, -10, 17, 23, 20, -10, -12, 2, -18, -19, -21, -27, -35, -45, -48, -28, -32, -33, -14, -8, 8, -1, 15, 9, 5, -8, -9, 7, -8, -1, 11, 15, -11, -27, -17, -16, -9, 14, -9, -25, -30, -22, -36, -20, -50, -40, -36, -19, -6, 4, -11, -3, 9, -1, 3, -11, -10, -12, -4, -14, -8, -10, -16, 0, -21, -19, -14, -26, -15, -25, -37, -19, -48, -26, -24, -46, -26, -8, -1, -1, -4, 5, -3, -13, -13, 10, -9, -1, 14, 14, -3, -27, -7, -32, -38, -16, -20, -35, -15, -34, -19, -24, -7, -7, 12, 3, -23, -1, 15, 2, -11, 12, -6, 10, 8, -11, 12, -17, -13, -11, -29, -3, -16, -22, -19, -9, -31, -27, -34, -33, -8, -12, 10, -19, -2, 5, -10, 17, -6, 5, 2, -13, -13, 8, 11, 11, -15, 5, -8, 9, -10, -21, 3, -2, -25, -12, -10, -6, -8, -10, -14, -14, -17, 10, -12, -17, -10, -8, 6, -12, -4, 15, 1, -1, -17, -18, -1, 15, -2, 11, -7, -7, 4, 10, 14, -8, 1, -17, 12, -5, -12, -17, 5, -6, 15, -4, 14, -6, 1, 13, -1, 10, 21, 14, -8, 7, -12, 18, 15, -9, 6, 6, -3, 14, -4, -7, -7, 2, -12, -11, -2, 4, 8, 18, 17, 10, 10, -4, -9, -10, -12, 2, 0, -10, -11, -9, -11, 18, -6, 13, 4, 2, -11, 10, 15, 12, -9, 3, -8, -5, -6, 4, 11, -5, -9, -8, 15, 17, 18, 8, -15, 1, 12, 8, -4, 8, 21, -15, 5, -8, -7, -7, -18, -5, 6, -4, 3, -3, 4, 4, 20, -10, 20, 13, -9, 5, 11, -4, -11, -7, -10, 3, -9, -28, -55, -64, -27, -58, -72, -25, -8, -20, -20, -18, 7, 6, 5, 18, -7, 13, -6, 7, -5, 16, -11, -3, -27, -40, -12, -9, 0, -8, -20, -28, -53, -63, -70, -62, -47, -40, -16, -10, -16, -19, 9, 19, 19, 22, 4, 12, 11, -22, -7, -9, -30, -60, -34, -50, -59, -4, -29, -25, -32, -55, -64, -64, -54, -32, -14, -36, -29, 3, -3, 12, -6, 0, -5, 4, 0, -8, -31, -57, -72, -52, -70, -54, -51, -8, -13, -8, -35, -50, -53, -42, -48, -46, 2, -4, -17, 4, 5, -9, 16, 8, 10, 7, -27, -36, -55, -61, -63, -47, -56, -33, -30, -12, -33, -7, -12, -42, -36, -36, -28, 2, -20, -4, -32, 9, 16, 7, 13, -4, -6, -15, -36, -40, -49, -46, -58, -54, -43, -25, 6, 7, -9, -14, 19, 20, -5, 5, 8, 24, 27, 22, 19, -12, -6, 1, 9, -11, -10, -30, -38, -41, -38, -39, -30, -13, -35, -25, 24, 29, 61, 40, 36, 45, 29, 16, 16, 7, 7, 40, 26, 13, -6, -5, 17, 7, -11, -13, -32, -44, -8, 11, -11, 8, -11, -11, 48, 55, 50, 52, 24, 19, 28, 29, 34, 6, 27, 75, 82, 20, 19, 2, 4, 14, -6, -35, -44, -13, 5, -2, -7, -18, -5, 21, 50, 50, 30, 38, -10, 16, -6, 15, 39, 30, 44, 53, 41, 26, -5, 12, 8, -13, 12, -16, -59, -21, 21, 18, 14, 2, 21, 43, 24, 25, 23, 10, -14, -53, -47, -40, -14, -23, -18, -17, 18, 37, 6, -3, -10, 18, 13, -23, -22, 5, 29, 34, 28, 23, 38, 36, 30, 21, -6, 2, -30, -51, -68, -73, -61, -24, -57, -8, 12, 26, 17, -5, -5, 11, 9, -11, 5, 20, 13, 31, 32, 23, 50, 9, 9, -9, -7, 22, -13, -56, -49, -43, -27, -11, -29, -7, -3, 19, 3, 8, 11, 10, 5, 10, 29, 9, 9, 11, 18, 23, 21, 18, 7, -8, -17, 26, 4, -17, -37, -53, -29, -20, 4, 1, 0, -5, 15, -9, -11, -9, 10, 0, 2, 12, -17, 1, 17, 17, 25, 34, 18, 5, -8, -11, -51, -23, -35, -33, -7, -9, -33, -14, 17, 2, 10, 10, 14, -3, 16, -30, 24, 15, -2, 7, 21, 8, 15, 26, 28, 26, 24, -36, -30, -18, -10, -21, -14, -10, -5, -6, -15, 23, 0, -6, -2, 7, -16, -30, 8, 0, 9, 9, 35, 33, 25, 16, 40, 28, -26, -47, -38, -23, -6, -14, -27, -10, 12, -11, 17, 6, -11, 0, 19, -2, -4, -36, -13, -29, -24, 8, 0, -10, 1, 1, 40, 6, -23, -28, -16, -12, -11, -37, -23, 16, 7, 30, 18, 18, -4, -3, 17, -4, 0, -34, -25, -18, -35, -12, -36, -23, -21, -32, -30, -14, -29, -18, -39, -30, -7, -22, -13, 28, 6, 18, -8, 16, 8, -12, 10, 16, -12, -4, -6, -33, -50, -34, -36, -52, -39, -38, -32, -14, -32, -47, -32, -6, -34, 8, -6, 14, 26, 34, -11, 18, 21, 18, -11, 8, 14, 5, -15, -15, -20, -9, -21, -48, -28, -38, -37, 2, -10, -29, -9, -10, -28, -5, -2, -7, 32, 27, 1, 14, 14, -4, 21, 4, 12, 2, 1, -27, -53, -17, 2, -13, -20, -5, -15, -4, -23, -2, 0, -4, 2, 21, -2, 12, 14, 31, -5, 23, -10, -1, -3, 16, 1, -12, -13, -46, -34, -27, -5, -27, -18, -29, -3, -22, -24, -39, 8, 1, 20, 8, 18, 15, 32, 9, -8, -4, 15, 18, -4, 14, 6, 2, 9, -12, -20, -26, -18, -62, -38, -44, -36, -19, 0, 9, 17, 26, 17, 18, 5, 11, 5, 26, -8, 8, 1, 22, 20, 2, 3, -9, 18, -11, 10, -24, -31, -24, 11, 30, -4, -10, -3, 21, -2, 10, 23, -3, 28, -3, 4, -7, 7, 1, 11, -9, 1, 6, 22, -5, -10, 13, 1, 10, 20, -5, 0, 20, 4, -4, -2, -7, -7, 18, 0, 9, 1, 0, 13, 14, -11, -9, 16, 16, -16, 0, -14, -1, -5, 8, -18, -11, -1, 4, 8, -18, 6, -1, -3, -12, -1, -4, 12, 9, -6, 15, -15, -18, 1, -8, -10, 9, 9, 4, -13, 15, 7, -15, -8, -5, -4, -4, -17, 11, -12, 2, -13, -11, 16, 1, 7, 12, -12, 6, -8, 11, 14, 0, -18, -5, 2, 4, -9, 15, -10, -7, 14, -18, 5, 0, 4, 1, -4, -2, 15, 21, -2, -15, -13, -8, -14, -12, 2, 11, -4, 0, -2, -2, 2, 5, -7, -3, 13, -7, 6, 12, 0, 30, 28, 35, 42, 44, 48, 44, 12, 4, -4, -18, 0, -12, -14, -26, 15, -8, 1, -5, -15, -16, 15, 15, 11, 3, 0, 24, 52, 36, 44, 43, 37, 51, 31, 47, 35, 26, -19, -26, -38, -26, -38, -3, 10, 11, -5, -7, -17, 0, -3, -2, 14, 22, 14, 1, 7, 11, 7, 21, 31, 18, 23, 23, 8, 0, 10, -27, -17, -12, -29, -22, -26, 10, 0, -16, -14, 12, -9, 21, 25, 12, -6, 14, 17, 24, 21, 5, 26, 15, -3, 0, -6, 15, -13, -6, -19, -29, -11, -33, -11, 12, 7, 12, -16, -13, 15, 29, 7, 18, 19, -15, 11, -9, -1, 2, 3, 25, 1, 13, 5, 15, -1, 2, -31, -1, -34, -28, -31, 2, 0, 8, -11, 3, -2, 35, -1, 16, 10, -29, -9, -28, -17, -34, -17, 36, 14, 9, 26, 6, 4, -7, -6, -2, -34, -55, -9, 10, 10, 14, -17, 16, -5, -8, -2, -26, -1, -30, -21, -41, -44, -14, -21, 7, 15, 33, 39, -4, 11, -9, -14, -22, -38, -40, -30, -13, -13, 6, 2, 16, 10, -16, -31, -29, -48, -39, -35, -39, -41, -14, -7, 22, 25, 8, 16, 14, 9, 2, -11, -25, -28, -13, 7, -10, 7, -1, -11, 5, 1, -6, -27, -62, -42, -31, -47, -38, 5, -21, -14, 18, 11, 10, -1, 6, -3, 10, -44, -32, -40, 0, -19, -16, -12, -15, -4, 10, -8, -27, -32, -28, -37, -18, -5, -5, 10, 8, -16, -3, 16, 4, -11, -13, -4, -9, -13, -22, -33, -14, -12, -13, 7, 2, -3, 11, -2, -18, -36, -31, -10, -5, 2, 16, -10, 8, 1, 1, 12, -14, 4, -28, -17, -39, -11, -41, -27, -14, 3, -6, -14, 16, -18, 11, -2, -19, -16, -8, -2, 27, 33, 11, 2, -24, 5, 34, -4, 3, -21, -34, -9, -14, -25, -30, -9, 7, -3, 2, -8, -8, 12, -15, -4, 30, 16, 9, 18, 22, 18, -9, -25, -42, 0, 30, -1, 3, -20, -11, -5, -13, -20, -22, 13, -8, -6, 14, -4, 0, -13, -10, 0, 30, 17, 15, -15, -23, -5, -11, -40, -20, -13, 10, -8, -22, -33, -13, 9, 0, -18, 22, 11, 26, 11, 8, -7, 10, -6, 17, 18, 40, -2, -1, -18, -2, -23, -6, -33, -38, -7, 4, 0, 12, -13, -3, -6, 4, -7, 8, 18, 8, 22, -12, -2, 2, 16, -12, 36, 22, 5, 14, -9, 10, 11, -4, -29, -21, -1, 5, 20, 32, 1, 21, 28, 11, 19, 18, 22, 10, 25, -4, -4, 13, -16, 1, 33, 21, 20, -1, 17, 18, 2, 18, -11, -11, 9, 37, 39, 30, 19, 8, 27, 29, 28, 43, 21, 27, -2, -5, -13, -15, -15, 1, 16, 13, 11, 19, 13, 11, 28, -5, 10, -8, -9, -3, 13, 33, 27, 28, 6, 9, 12, 14, 30, 7, 6, -2, -13, -6, -16, 2, 30, 0, -6, 6, -10, -5, 12, 2, 12, -14, -20, -2, 10, 2, 22, 23, 15, 13, 12, -1, 28, 27, 8, 11, 3, -4, -4, -1, 16, 27, 29, 11, -14, 12, 5, -1, -9, -33, -23, -7, -12, 13, 19, 41, 40, 41, 11, -11, -4, 10, -12, -8, -4, -16, 5, 0, 3, 17, 28, -10, 16, -6, 3, 5, 14, 7, -10, -8, -10, 11, -3, 10, 15, 7, -9, -14, 17, 6, -12, -13, 5, -16, -18, -10, 1, 16, -9, 0, -1, 3, -10, 12, -9, 3, 9, 14, -16, -6, -2, 4, 6, -13, -13, 0, 9, -10, -10, -16, -13, 12, 9, -2, -8, -4, 9, -7, 17, 0, 0, 7, -15, 4, 17, -14, -14, -30, -23, 3, 5, 12, -4, -19, 3, 3, 12, -2, 2, -9, 15, -11, 8, 0, -15, 2, -15, -2, -10, 2, -8, -5, 6, -11, 1, 0, 6, 2, 9, -14, 12, -9, 16, -3, 5, 11, -13, -9, -16, -15, 8, 14, 8, -10, 12, -7, 16, -5, 5, 2, 9, -8, 10, 0, -2, -5, -12, 5, 2, -8, -11, 2, -10, 15, 13, -11, 14, 14, -7, 13, -6, 16, -14, -3, 15, -16, -16, 8, -9, 9, 0, -1, 7, 16, 8, 14, -5, -3, -12, 8, -14, 13, 5, 15, 15, -13, 17, 3, 5, 11, -15, 6, -16, 13, 2, 15, -11, 1, 6, 7, 4, -5, -14, 9, -9, 13, -3, -12, 14, 4, 12, 6, -4, -12, -14, -16, -15, -9, -1, -4, 6, 2, 0, 17, -11, -15, 18, -1, -16, -2, -2, 11, -8, 0, -13, 0, 14, 13, 0, -17, -14, 4, -8, 14, -14, 3, -8, -3, 19, 15, 7, 20, 27, 10, 4, 16, 11, 22, -14, -9, -1, 1, -6, -10, -5, 11, -6, 9, -16, 0, -4, -3, 17, 3, 7, 10, -1, 27, 37, 33, 25, 34, 16, 19, 9, 10, 6, 24, 8, 9, -16, -3, 5, -4, 4, 14, 12, 7, 5, -14, 0, -1, 7, -7, -19, -1, 18, -7, 1, -4, 0, 13, 21, -5, 4, 24, 14, -7, -9, -7, 5, -4, -14, -3, -8, -5, 6, 1, 1, 1, -9, -20, -33, -35, -31, -30, -12, -5, 15, 18, 2, 1, 5, 3, -9, -10, 6, 2, 18, 9, -7, 5, 6, 0, -15, -1, -25, -46, -33, -40, -35, -9, -26, -12, -14, -10, 26, 13, 24, 19, -10, -2, -18, -11, 3, -16, -12, -5, -3, 7, -10, -7, 10, -27, -30, -9, -27, -10, -11, 9, 0, 0, 19, 5, -7, 22, 1, 15, -10, 1, 11, -12, 7, 5, -3, -5, 7, 1, 13, 0, -3, -22, -13, 7, -16, -12, 15, 2, 4, 0, -18, -33, -9, -34, 2, -11, 5, 26, 9, 24, 16, 1, -10, 1, -13, 10, 14, -2, -16, -21, -9, 17, 9, 21, 12, 5, 9, 10, -19, -33, -66, -57, -12, -1, 29, 32, 20, 29, 31, 14, -15, -14, -14, -1, 7, -16, -29, -3, 3, 9, 1, 30, 6, -6, -18, -25, -11, 1, -17, -27, -4, 23, 38, 31, 36, 26, 45, 36, 15, -2, 11, 16, -12, -4, -24, -7, 3, 7, 27, 17, 31, 8, -1, -30, 13, -2, 5, 3, 19, 17, 33, 31, 36, 47, 60, 26, 22, 16, -8, -5, -9, -17, 11, -1, -18, -5, 1, 4, 18, -13, -18, 9, 28, 30, 26, 30, 2, 0, 10, 1, 4, 39, 33, 15, 14, 16, 5, 1, -14, 2, -11, 5, -29, -31, -22, 24, -6, 27, 15, 19, 26, 31, 38, 14, 10, -21, -39, -31, -14, -17, -20, -9, 11, -10, 1, -5, -6, -14, -8, -6, -1, -7, -23, -10, -2, 24, 12, 31, 30, 38, 1, 18, -9, -18, -45, -55, -10, 2, 2, -10, 3, 9, 11, 10, -11, 15, -10, -22, -4, 1, -1, 8, 26, 47, 18, 28, 30, 14, -8, 14, -7, -32, -51, -64, -51, -23, 3, 4, 14, -3, -11, -17, 6, -16, 14, -23, -9, 11, 11, 11, 15, 16, 8, 20, 12, -25, -15, -2, 7, -43, -50, -39, -31, -21, 0, -17, 0, 16, 5, -8, -5, -14, -1, -22, -2, 16, 2, 25, 20, 10, 9, -6, -18, -30, -8, -8, 9, -16, -24, -32, -24, -16, 18, 4, -3, -4, 15, -2, -2, -12, 15, -8, 11, 10, 4, 17, 5, 18, -21, -38, -7, -11, -11, -2, 7, 3, -21, -11, 4, -6, 6, 5, 11, -18, 4, -1, -2, -10, -7, 6, 18, 10, 31, -6, 11, -24, -14, -17, -1, -18, 18, 17, 15, 8, -1, -18, 5, 0, -8, 5, 13, -12, 13, -12, -11, 2, -13, 20, 14, 4, 30, -7, -2, -27, -4, 5, -4, -9, -2, 1, -12, -3, -15, -5, 1, -14, 6, 3, 7, 4, 14, 4, -4, -11, -14, -3, -3, 15, -6, 0, 0, 1, 0, 24, 27, 28, -2, 8, 4, -10, -21, -17, -9, -14, -18, -4, 12, -5, -11, -7, -7, 3, 6, -2, -13, -7, -15, 21, -13, 6, 13, -10, 19, 10, 5, -9, 14, -5, 5, 10, 16, -11, 14, -12, 9, 2, 14, 11, -18, 10, -14, 7, -35, -12, 8, 2, 6, -1, 15, 19, 21, 11, 9, 11, 6, 19, 10, 10, -9, 0, -3, -9, 2, -4, -16, 8, -2, 6, 1, -25, -1, 13, 6, 18, 8, 10, 27, 18, 17, 54, 33, 51, 43, 13, 15, -3, 0, 0, 1, 7, -1, 8, -14, -1, 15, -1, 3, 0, 13, -5, 2, 11, 9, 2, 18, 31, 28, 36, 2, 23, 25, -2, 20, 8, -6, -1, 17, -6, -2, 16, 2, 16, -10, 16, -12, 12, 6, -9, -13, -4, 11, -17, -12, 12, -12, -8, -7, 7, 4, 1, 2, -15, -7, 8, -1, -5, -17, 10, -6, 14, 0, 12, 3, 12, -18, 2, -11, -19, -14, -6, -14, -6, -4, 11, -20, 0, -16, -9, -18, -15, -20, 9, 10, -14, 7, -4, -10, 1, 10, -9, -13, 0, 10, -13, -10, -14, -12, 6, 13, -6, 11, 5, -11, 1, 12, 1, -19, -14, 11, 8, -19, 14, -9, -10, -14, -11, -17, 4, 8, 5, -3, -9, -3, -9, -8, -3, 18, -3, 12, -10, -2, 9, -5, -13, -10, -4, -7, 16, 0, 2, 11, -18, -16, -1, -7, 0, -20, -19, -6, 9, -11, -5, 10, 0, 33, 5, 4, 27, 22, 8, 12, 0, 17, 26, 1, 0, 14, -5, -12, -8, -20, 4, 6, -2, -8, 2, -15, 4, 24, 18, 12, 7, 4, 18, -9, 18, 17, -2, 2, 27, 24, 24, 31, 13, -9, 17, -16, 9, 11, -12, -17, -6, -10, -13, -12, -12, 13, 5, 10, -5, -9, -27, 9, 15, 10, 18, 1, 22, 26, 24, 32, 35, 29, 5, 8, 0, 13, -12, 3, 9, 4, 23, 30, 18, 12, -7, -11, -42, -37, -8, -13, 8, -8, -44, -21, -44, -15, -25, 8, 35, 28, 45, 9, -13, 6, 6, -15, -19, 8, 4, 40, 17, 10, -26, -16, -46, -12, -17, 12, 6, -11, -32, -44, -27, -6, -19, -23, 21, 9, 20, 8, 8, 14, -3, -6, -5, -15, 3, -4, 3, -19, -15, -40, -41, -25, -4, -9, -14, -9, -14, -24, -18, -35, -9, 3, -1, 0, 20, 39, -11, 12, 14, -10, 8, -9, -8, -9, -9, -8, -36, -22, -20, -29, -20, 12, 0, -12, -1, -5, -21, -4, -2, 2, 9, -9, 12, 33, 1, 8, 13, -16, -21, 6, 6, -14, -42, -4, -34, -44, -25, -36, 13, 25, -9, -9, -14, -15, 3, -6, -31, -10, -3, -17, 24, 9, -11, -11, -4, -3, -5, -9, -14, -29, -22, -30, -20, -14, -13, -6, 27, 20, -21, 3, -9, -10, -14, -2, -42, -36, -25, -9, -19, 0, 4, -18, -11, -12, -25, -5, -15, -14, -13, -3, -9, 19, 12, 33, 47, 48, -18, -25, -6, -30, -25, -8, -23, -28, -17, -27, -24, -16, -11, 1, 14, -11, -10, -11, -23, -7, 6, 11, 23, 10, 29, 41, 30, 9, -17, -28, -25, 5, -7, -3, -24, -22, -5, 3, -16, -12, 2, 11, -10, -1, 3, -13, -9, -15, 20, 26, 22, 31, 29, 39, 28, -19, -29, -25, 1, 13, 22, -11, 9, -6, 12, 35, 26, -8, -8, 8, -8, 8, 15, 4, -2, 10, 18, -1, 23, 7, 17, 1, 2, -1, -18, -16, 1, 25, 28, 12, -1, 13, 30, 18, 41, 15, 5, -19, 10, -12, -12, 12, -5, 15, 9, 10, -17, -10, 9, -7, -15, 3, -11, -9, 26, 28, 52, 34, 30, 19, 19, 44, 23, 13, -19, -19, -6, -12, -5, -1, 14, 5, -2, 1, 5, -20, 4, -1, -32, -13, -17, 2, 24, 56, 19, 33, 26, 2, 4, 14, -2, -5, -3, 7, -18, -13, 11, 25, 19, 39, 9, -1, 11, 6, 2, -16, -9, -3, 1, 27, 44, 17, 29, 3, -17, 13, -5, -14, -4, -18, -17, 9, -9, -2, 6, 34, 42, 43, 26, 21, 10, 34, 41, 37, 38, 20, 22, 39, 16, 14, 10, -26, -18, -12, 1, -8, -11, -7, -2, -19, -9, -2, -17, 24, 31, 13, 9, 10, 36, 47, 38, 46, 41, 14, 10, 5, 0, -6, -4, 3, 0, 13, 5, -5, -20, 8, -6, 6, -20, -20, 8, 4, 1, 15, 9, 20, 23, 32, 7, 45, 22, 4, -2, 4, -13, 5, 1, 11, -12, 9, 13, -16, -22, -1, 8, -3, -18, 5, -14, -2, -2, 0, -13, 11, -14, 19, 10, 32, 33, 28, -10, -22, -17, -7, -12, 8, -22, -2, -18, -25, 2, -2, 1, -20, -1, 11, 5, 13, -6, 15, -18, -20, -2, 22, 2, 2, 7, -39, -40, -19, -32, -13, -24, -13, -16, 1, -19, -14, -16, 8, 2, 0, -6, -7, 8, 6, -1, -8, -30, -43, -46, -24, -32, -39, -23, -18, -6, -10, -28, -33, -2, -26, 6, -8, -13, -4, 4, 0, 3, -12, 1, -17, 9, -19, -5, -33, -40, -37, -45, -27, -41, -41, -33, -12, -20, -25, -15, -31, -21, -14, -13, -7, -9, 1, -12, 3, -20, -8, -16, -15, 10, 4, 3, 8, -14, -7, -10, -39, -34, -19, -38, -36, -19, -5, -20, -11, -39, -24, -12, -22, 5, -14, -17, -11, -15, -12, 4, 12, -14, -2, -4, -15, -4, -1, -7, -19, -9, -10, -3, -20, 1, 8, -13, 9, -9, -11, -4, -11, -5, -3, -10, -9, -14, 13, -3, 9, 11, 2, 8, -12, -2, -6, -1, 0, -6, -1, 3, -2, 1, 16, 4, 11, 12, 4, 21, 19, -8, 15, 14, 9, 17, -10, -11, -8, -3, -1, 4, 6, 8, -14, 19, 8, -1, 20, 20, 17, 3, -14, 5, 9, -4, 19, 9, 5, 13, 5, -3, 12, 0, 6, -6, -9, -4, 19, -9, 11, 19, 19, -8, -8, -19, -7, 0, -23, -18, -21, 3, -3, 11, 16, 12, 27, 8, -8, 11, 8, -10, 12, 16, -12, 18, 9, -12, 11, 11, 8, 4, 2, -10, -11, -34, -46, -14, -28, -12, -7, 9, -2, 33, 18, 18, 15, -1, -10, 0, -4, 9, 12, 18, 13, 13, -6, 14, 12, -26, -36, -48, -27, -44, -44, -12, -13, 2, -5, -28, 22, 7, 27, 19, 9, -10, 10, 3, -7, -5, 14, -2, 11, 3, 10, -4, -5, -16, -12, -33, -39, -19, -3, -8, -3, 18, 10, -9, 3, -18, -11, 0, 13, 15, -10, -6, 12, 7, 8, 11, 9, -1, 2, -7, -2, 3, -11, -14, 8, -9, 7, -4, 2, 9, 24, 11, -9, 3, 6, -1, 3, -1, -10, 10, 8, 5, -12, 15, 15, 16, -13, 1, 6, 23, 22, -3, 6, 0, -10, 19, 11, 18, 24, -1, 29, 29, -4, -16, -5, -9, -13, -1, 13, 14, 7, 5, -7, -11, -10, -7, 13, 26, 25, 8, -26, -24, -38, 8, 24, 21, 21, 34, 9, 10, -5, -29, -55, -18, -9, -4, -14, 20, -13, -2, 7, 21, -25, -12, 35, 26, 0, -7, -48, -59, -12, 25, 39, 42, 24, 10, 9, 4, -3, 0, -22, -21, -12, -12, -8, -10, 14, 12, 24, 8, -10, -20, 21, 4, -20, -37, -74, -62, 1, 18, 36, 19, 17, -5, -2, 1, 1, 17, 2, -7, 4, 11, 16, 8, 13, -14, 3, 20, -22, -27, -9, -24, -58, -71, -57, 11, 39, 30, 28, 23, 20, 9, 1, 5, -1, 10, -23, -10, -21, -5, -13, 5, -3, 0, 2, -21, -1, -21, 6, -28, -27, -14, 12, 62, 54, 49, 17, 27, 17, 19, -15, -1, 8, 6, -10, -17, -5, 9, 19, -7, -8, -2, 0, 1, -27, 2, -13, -16, -17, 29, 30, 42, 53, 33, 32, 16, 6, 8, 1, 16, -9, -27, -51, -23, -32, -17, 12, -11, 21, -9, 17, -10, -8, -50, -39, -23, 24, 25, 54, 68, 52, 31, 28, 31, 25, 3, 1, 3, 5, -35, -47, -54, -25, -11, 5, -10, -9, -4, -4, -8, -15, -75, -68, -60, -6, 30, 53, 63, 36, 47, 18, 10, 15, -18, 11, 1, 4, -20, -21, -35, -24, -18, -13, 15, -8, 22, -11, -4, -27, -81, -69, -75, -40, -8, 28, 33, 20, 13, 5, 15, 15, 14, -12, 7, -13, -44, -43, -17, -35, -1, 4, 14, 21, 13, -4, -13, -49, -72, -75, -63, -56, -43, -1, 2, 26, 35, 8, 22, 20, 2, -25, -40, -41, -50, -36, -14, -1, -16, -4, 18, 3, 19, 28, -3, -37, -43, -60, -45, -56, -52, -43, -16, 7, 5, 5, 1, -8, -13, -31, -33, -28, -18, -58, -18, -17, 3, 5, 17, -1, 17, 28, 11, -8, -26, -28, -32, -53, -50, -49, -46, -22, -12, 0, 2, -10, -27, -13, -58, -39, -36, -30, -33, 5, -7, -6, 16, 10, 15, 0, 23, 8, 26, 4, -9, -28, -20, -45, -34, -38, -6, -11, -10, -20, -8, -36, -27, -4, 1, -28, -9, -13, 10, 4, 16, 9, 4, -8, 25, 16, 18, 38, 22, -10, 13, -10, -10, -16, -15, -11, 0, -25, -5, -10, -34, -22, -24, -17, -17, 10, 19, 3, -13, 3, 6, -3, 29, 39, 34, 33, 44, 27, 12, 14, -1, -15, -3, 19, -8, -23, -23, -12, -22, -12, -12, -17, -18, -10, 17, 13, 1, -7, 4, 2, 38, 39, 41, 36, 12, 16, 28, 4, 3, 25, 0, -6, -24, -22, 3, -29, -29, -18, -7, -30, 9, -10, 4, 21, 2, -4, 8, 26, 26, 33, 27, 29, 26, 1, 26, 2, -21, -4, 16, 2, 0, -3, -13, -29, -22, -19, -13, 15, 1, -12, 6, -4, 0, 2, 5, 10, 19, 11, 21, 34, 46, 47, 30, 29, 14, 35, -1, -36, -19, -29, -1, -5, 21, 5, 11, 4, -6, 9, -12, 11, -2, -7, -12, 18, 14, 0, 18, 7, 1, 18, 4, 6, 2, -7, 5, -4, 6, -5, 5, -1, -3, 3, 17, 18, -1, -7, 16, -11, 17, 20, -6, 13, -11, -5, -1, -2, 6, 10, -2, -13, 15, 16, 6, -7, -13, 0, -5, 18, -4, 12, 3, 1, 12, 8, 20, -3, 1, -2, 6, 2, -19, 0, -19, -6, 5, -3, 1, -7, -20, -10, -15, -21, -22, -11, -25, -16, -19, 7, -10, -17, 0, -24, -17, -12, 2, -23, -1, -10, -13, -10, -8, -13, 3, 2, 1, 4, 1, -3, -23, 3, 8, 4, 7, 2, -12, -12, -3, -2, -15, -4, -27, -15, 6, -1, -10, -9, 0, -10, -20, -1, 10, 5, -1, 19, -10, 12, 7, -3, 22, -9, 20, 3, -19, 8, 3, -14, -10, -12, -1, -17, -27, -7, -14, 2, -16, -1, 9, -5, -14, 12, 19, 24, 37, 31, 4, 18, 23, 20, 15, 16, 19, 10, 7, 0, -17, -16, -12, -25, -10, -9, -1, -6, -8, 4, -5, 4, -8, 9, 19, 9, -5, -10, 23, 22, -2, 11, 4, 8, 14, 11, 9, -11, -11, -19, 3, -15, -24, -15, -7, -20, -16, -24, -20, -18, -16, 7, 7, -6, 12, -22, 14, -6, -1, 6, 0, 26, 27, 27, 7, 2, 4, -13, -8, -13, -24, -12, -21, -3, -24, -24, 0, -5, 9, 6, 17, -5, 2, -6, -21, -8, 4, -11, 1, 6, 20, -23, 5, -10, 7, 5, 8, -17, -20, -22, 4, -28, 7, -8, -12, 9, 30, 14, -1, 4, 12, -15, -5, -3, -4, -7, -1, -7, -15, -14, -6, -10, 23, 6, -15, 3, 0, 6, -19, -1, -1, -19, -8, 7, 17, 26, 22, 1, 1, 21, -14, -15, -16, -2, -19, -1, -11, -19, 8, 25, 14, 3, 14, -17, 1, 4, -11, -6, 4, 8, 1, -7, 16, 5, 29, 26, 13, -9, -19, -17, -38, -28, -33, -16, -2, -3, 1, 1, 33, 34, 10, -16, -21, -16, -15, -14, -11, 12, -1, 20, 21, 8, 27, 4, 16, 6, -14, -46, -43, -44, -19, -1, -13, 9, 13, 25, 47, 6, -12, -18, -2, 4, -16, 3, -4, -6, 16, 0, -5, -12, -15, -11, -7, 12, 1, -28, -26, -30, -34, -17, 7, -13, -3, 4, 42, 21, -12, -23, -10, -4, 3, -18, -3, 10, 12, 9, 10, -4, -3, 9, 12, -8, 10, -19, -21, -46, -23, -7, -6, -15, -27, -18, 17, -1, 3, -15, -22, -9, -20, -19, -21, 1, -10, -5, -3, -20, -4, 5, 1, 6, 11, -29, -9, -22, -13, -5, -23, -21, -16, 7, 13, 12, -15, 0, -22, -27, -15, -21, -16, -7, 11, 2, -19, -27, -12, 1, 3, 18, 5, 15, -16, -31, -4, -11, -22, -3, -5, -15, -5, 4, -18, -8, -19, -2, -13, -5, -35, 8, 1, -20, -21, -5, 4, 15, 14, 46, 10, -14, 8, -6, -25, -20, 6, -3, -2, -2, 11, 18, 2, -27, -25, -27, -14, -7, -24, -8, 7, -25, -13, -20, -11, 10, 37, 39, 24, 7, -1, -9, 2, 18, 0, 23, -5, 10, 10, 4, -10, -25, -10, -16, -26, 1, 5, 6, -2, -25, 9, -21, 13, -4, 5, 25, -23, -31, -14, -19, -3, 23, -7, 16, 25, 26, 10, 0, 5, -9, 5, -27, 7, -14, 5, 14, 37, -2, -4, -14, 5, 15, 12, 2, -14, -31, -21, -15, 6, -5, -5, 2, 8, 11, 27, 20, -27, 4, -11, -8, -13, 2, 9, 1, 29, 25, 19, 31, 0, 26, 6, 26, -22, -13, -14, -8, -1, -1, 26, 11, 39, 45, 20, 11, -5, -12, 0, -4, 8, 16, 3, 29, 10, 10, 6, 29, 28, 23, 21, 22, 5, 14, 9, 26, 10, 9, 27, 28, 18, 16, 5, -10, -7, -26, -13, 6, -21, -7, 22, 14, -3, 27, -1, 25, 23, 41, 10, 36, 0, 23, 2, 16, 29, 14, 20, 14, 23, 27, 0, 5, -7, -25, 4, -24, -3, -14, 8, -11, -6, -7, 14, 13, 9, 15, 19, 18, 3, 22, 27, 6, 27, 37, 21, 16, -2, -6, 6, 10, -4, 6, -27, -2, 4, -19, -14, -23, -32, -31, -16, -22, -21, -24, 8, -13, -10, 4, 10, 4, 27, 9, 21, 6, 25, 2, -13, -17, -26, -16, -10, -4, -26, 0, -24, -16, -23, -30, -34, -30, -8, -11, 5, 23, 23, 12, 21, 26, 7, 13, -15, -20, -16, 5, -13, -23, -24, -3, 0, 0, -21, -16, -25, -14, -21, -39, -19, -1, -2, 0, 10, 17, -5, 14, 35, 41, 0, 27, -19, 1, 2, -5, -11, -15, -24, 4, -26, -4, -27, -20, -25, -26, -16, -20, -2, -4, -32, -17, 9, -2, -31, 0, -27, -8, -6, 1, -1, -26, 4, -8, -20, 2, -26, -18, 1, -19, -1, -27, -26, -15, -3, -8, -9, -16, -20, -26, 3, 4, -17, 2, -4, -17, -26, -14, -27, -21, -13, -9, -13, 2, 0, -13, -3, -14, 7, 0, -11, 4, 9, -14, -14, -16, -4, 2, -1, -10, -3, -11, 13, -17, -6, 7, 8, 0, -12, 10, -1, 9, -4, 2, 6, -13, -3, -7, 11, 4, -21, 5, 8, -8, 9, 5, -6, -5, -10, 9, -17, 8, -7, 4, -20, -3, 3, 2, -14, -11, 2, -4, 9, -17, 11, -6, -17, -9, -5, -16, -12, 11, 6, 10, 13, -5, -4, -7, 5, -14, -4, 6, -11, 10, 0, -12, -9, 6, -7, -1, -20, -7, -6, -2, -19, 7, 2, -15, 7, 21, 15, 41, 24, 20, 20, 11, 7, 9, -5, 21, 10, -16, -20, 5, -17, -9, -2, -1, -3, 13, 10, -14, -19, 1, -3, -8, 22, 30, 26, 41, 6, 8, 3, -4, -12, -25, -9, -23, -8, -5, -12, -14, -8, 2, 1, -18, -6, -5, -5, -18, -17, 1, 2, 7, 45, 38, 44, 35, 16, 43, 11, 6, 32, 12, 1, -7, 13, 6, 22, -1, -2, -9, -18, 0, -6, -14, -4, -2, 13, 5, -4, 31, 32, 44, 29, 16, 38, 23, 46, 42, 40, 24, 30, 19, 10, 6, 13, -6, 17, 2, -11, -1, 2, -6, 14, 3, -3, 4, -6, 27, 26, 29, 17, 48, 43, 32, 69, 45, 62, 50, 60, 49, 29, 27, 19, -11, -11, 4, 3, -14, 7, -3, -3, 4, -3, -9, -28, -19, -12, -8, -4, -8, 4, 8, 51, 66, 32, 43, 20, 22, 16, 17, 21, -10, -6, -8, -1, 4, -20, -13, -15, 2, -20, -25, -26, -45, -28, -31, -36, -26, -18, -33, 7, 16, 18, 16, 15, -3, 7, 6, 6, -4, -6, 1, 0, 3, 0, 6, -3, 10, -9, -38, -25, -49, -27, -33, -50, -56, -67, -39, -72, -36, -8, -11, -1, -9, 13, -27, -31, -28, -14, -15, -17, -4, 5, 0, 5, -1, -17, -52, -35, -28, -34, -25, -29, -47, -43, -60, -76, -74, -41, -30, -28, -18, 6, -16, -17, -47, -9, -22, -1, -12, 11, 5, -4, -7, -13, -36, -21, -41, -23, -26, -10, -14, -42, -44, -30, -43, -28, -38, -8, -12, -5, -40, -30, -34, -38, -21, -5, 10, -15, -19, -11, -2, -16, -34, -34, -2, -14, 4, 15, -22, -18, -4, 1, -30, -3, -13, -16, -17, -29, -20, -22, -19, -10, -21, 10, -14, -21, -1, -4, 4, -7, -19, 4, 20, 11, 16, 13, -8, -13, 15, -11, 2, 1, -2, 10, -8, 7, -17, -24, -41, -13, -10, -15, 2, 0, 8, 2, -8, -3, -8, 28, 3, 7, 14, -2, 7, -16, -10, -6, 17, 2, 9, -1, -16, -24, -16, -54, -40, 3, 5, -16, -16, 6, 8, -6, 9, -11, 2, 4, 10, 14, 0, 28, 14, -3, 0, -9, -19, -14, -1, 7, -29, -26, -32, -23, -43, 0, 19, -9, 0, 9, 13, -9, 22, -2, 3, -22, -12, 18, -10, 22, -14, -12, -13, -9, -16, 5, 5, -9, -16, -33, -33, -27, -33, -8, 0, 15, -16, 10, 9, -10, 7, -8, -27, -2, 1, 16, -15, 1, -30, -30, -23, -24, 13, -5, 22, 5, -18, -31, -21, -18, -23, 10, 7, 2, -13, -12, 0, -19, -11, -4, -12, -14, 19, 10, 1, -14, -1, 6, 13, 4, 32, 34, 19, -15, 8, 12, 1, -25, -19, 0, 14, -9, -13, -7, -11, -6, -7, 14, 12, -18, 8, -5, 3, 15, 16, 23, 38, 44, 38, 22, 23, 12, 14, 10, 3, 18, -15, 9, -13, -14, -15, 5, -12, 5, -2, 15, 5, -27, 14, 1, -10, 25, 34, 53, 21, 38, 34, 43, 28, 8, 39, 28, 26, 28, 30, 26, 1, 14, 7, -13, 8, -13, 6, 1, -11, -16, 1, 7, 23, 27, 11, 28, 11, 16, 5, 19, 27, 10, 28, 19, 27, 25, 19, 16, -6, -17, -13, 13, 8, 6, -7, 8, 9, 28, 28, 18, 22, 27, 39, 23, 5, 15, -5, 7, 18, 10, 9, 8, 9, 17, 16, 0, 10, 11, -12, -15, -6, -2, -2, 16, 29, 8, 19, 6, 18, 8, 15, -3, -8, -2, 4, -22, 23, -12, 0, -16, -2, 1, -15, 19, -16, 1, -3, 0, -3, -6, 3, 9, 17, -10, 3, 16, 34, 11, 12, 15, 13, -9, 10, 6, 4, 18, -8, -5, -10, 1, 6, -15, -12, 1, -4, 2, -3, -20, -3, -9, -28, -10, 4, -6, 19, -4, 5, -5, 21, 21, 27, 28, -4, 8, 7, -10, 5, -9, -14, -12, -2, -5, -2, -20, 12, -12, -17, -20, 8, -13, -20, -1, 3, 11, -8, 13, -19, -20, 13, 10, -12, 5, 4, -19, -4, -19, -21, 6, -16, -11, -12, 23, 5, 20, 11, 3, 12, 1, 14, 15, 1, -10, 15, 12, -3, 18, 2, 7, -1, -4, 4, 5, 4, 3, -1, 18, -5, -5, 21, -8, 19, 5, -2, -10, 23, 20, 5, 14, 6, 22, 0, 0, 1, -3, 3, 4, -5, 5, 3, 16, -1, -2, 0, 19, 14, -2, 21, -7, 16, 10, 20, 0, 9, 22, 17, 2, 10, 5, 13, -12, -12, -12, -6, -4, 7, -10, -6, 2, 8, 2, -6, 4, -3, -6, -6, 14, -3, 4, -8, 20, 0, 20, 7, 8, -17, -24, -25, -8, -33, -16, -44, -39, -18, -35, 1, -13, -22, -8, -1, -5, 0, -7, 8, 14, 14, 1, -3, 15, 23, 0, 19, 8, -11, -8, -28, -34, -42, -51, -24, -15, -26, -29, -5, -2, 12, 6, 0, -14, -6, -12, 6, 20, 18, 11, -9, 11, 23, -1, -9, -24, -18, -29, -7, -28, -34, -21, -4, -1, -36, -21, -23, -8, 2, -12, 19, 10, 15, -13, 5, 18, 0, -4, 21, 14, 15, -6, -32, -7, -31, -23, 0, -27, -11, 6, -14, -2, -4, -3, -44, -11, -16, -2, 8, 4, -1, 20, 20, 4, 19, 3, 8, 9, 6, -19, -35, -7, -35, -7, -31, -21, 9, -6, 17, -5, 17, -15, -1, -10, -11, -1, 5, -10, -20, 3, -6, 18, -6, 5, 11, -21, 4, -18, -13, -28, -38, -17, -7, -20, 3, 16, -6, -15, -10, -21, -48, -46, -34, 5, -15, 2, 4, 13, 1, 8, 14, -1, -7, -8, -8, -43, -45, -32, -1, 9, -9, -11, 13, -13, -1, -8, 3, -2, -36, -37, -40, -25, -25, -8, 2, 5, -4, 5, -6, -9, 8, -5, -30, -26, -30, 13, 15, -5, 4, 4, -10, 5, 24, 7, 15, -19, -23, -51, -42, -4, -28, -19, 3, 5, 20, 4, 6, -21, -3, -25, -49, -42, 6, 7, -7, -5, 13, -10, -6, 20, 35, 23, 10, -3, -5, -19, -32, -26, -40, -8, -19, 1, 6, 0, -8, 6, 1, -27, -25, -27, 13, 25, 25, 28, 5, -7, 11, 22, 47, 23, 40, 13, -11, -30, -28, -37, -9, -18, 11, -11, 20, 19, 0, 16, -18, -6, -33, -23, 3, 26, 13, 11, -13, 17, 21, 36, 40, 53, 49, 31, 0, 1, -19, -8, -2, -16, -19, 14, 10, -10, 14, -3, 8, -17, -11, -7, -3, 36, 9, 30, 23, 22, 18, 28, 19, 25, 25, 32, 2, -40, -40, -33, -13, 1, 0, -3, 12, 20, 16, 11, 19, 17, -24, -30, 2, 3, 32, 16, 11, 17, 31, 7, 36, 55, 33, 15, -37, -68, -42, -8, -11, -23, 7, 2, 0, 24, -10, -1, 4, 2, -1, -35, -15, -5, 5, 3, 5, 25, 15, 27, 18, 11, 1, -37, -60, -48, -21, -30, -23, -10, 13, -13, -6, -6, -8, 9, 8, 6, -28, -25, -34, 0, -19, 13, 3, -2, 32, 32, 0, -15, -39, -48, -68, -41, -39, -42, -9, -23, 0, 14, -11, 7, 4, 5, -5, -14, -7, -35, -29, -15, -34, -9, -21, 0, 7, 14, -9, -36, -39, -60, -48, -44, -32, -27, -27, -1, 2, -2, 6, 21, 12, 17, 13, -22, -15, -37, -24, -33, -48, -23, -15, -32, -11, 10, -29, -43, -31, -54, -59, -51, -16, -30, -13, -14, 18, 0, -5, 15, 11, -12, -10, -8, 2, -11, -29, -29, -14, -26, -8, -28, -26, -27, -14, -9, -9, -20, -52, -34, -5, -30, -4, 15, -1, 8, 10, -5, -7, 9, 7, -5, 11, -33, -6, -32, -13, -9, -32, -40, -42, -10, -6, -12, -29, -15, -29, -25, -6, -29, -11, 1, -4, 8, -9, -9, 12, 14, -5, 9, -8, 4, -16, 3, -21, -6, -27, -15, -34, -34, -15, -20, -4, -4, -6, -19, -22, -15, 14, 1, 11, 5, 22, -1, 12, 7, 13, -19, 3, -1, -8, -10, -4, 7, -23, -1, -27, -19, -8, -1, 32, 1, -6, -6, 0, 1, -3, -9, -3, 16, 2, 2, -10, 5, -3, -6, -9, -6, 18, -2, -4, -17, -11, -37, -27, -23, -7, -3, 24, 32, 22, 19, 17, -5, 21, 20, -9, 23, 0, -6, 16, 8, 7, 1, -6, -2, -10, -3, 5, -26, -11, -44, -32, -8, 1, 28, -5, -8, -23, 6, 7, 11, 14, -6, 11, 8, 15, 18, 18, 15, 19, 15, 4, 17, 30, -1, 27, 6, 14, -2, -9, 24, 2, 18, 9, 8, -15, 18, 0, -10, -1, -2, 0, 22, -3, 6, 9, 15, 10, 15, 21, 2, 0, 19, 18, 2, 8, 6, -14, 20, 5, 13, -2, 5, 10, 5, 15, 19, 16, -6, -6, -6, 20, -3, -14, -8, -10, 5, -19, 6, -16, -1, -17, 6, -1, -14, 5, 7, -3, 2, -12, 8, -7, 9, 14, -9, 12, 13, 2, 13, 3, -17, -12, -16, 6, 10, -4, 16, -14, 10, -9, 1, -8, 15, 5, -2, 12, -17, -3, 10, -4, -7, -12, 4, 3, -4, 2, -4, 0, -2, 8, -3, -2, 0, 15, 11, 8, 15, -11, -11, -4, 9, -17, -21, -20, -18, -4, -19, 9, 8, 13, -17, -1, -6, -2, 6, -5, -18, -6, -14, 9, 6, -19, 5, -16, -6, -2, -8, -5, -14, -22, -23, -6, -25, -14, -10, -20, 9, 0, -9, -7, -3, -6, 9, -5, -15, 5, -5, -11, -8, 0, -16, -11, -19, -5, 6, -20, -18, -19, 1, -5, 10, 9, -1, -4, -12, -10, -13, -7, -13, -10, 7, -4, -6, 2, 12, 9, 4, 2, -13, 4, 14, 10, 0, -7, -5, 8, -10, 9, -10, 6, 3, -3, -8, 7, 14, 15, 24, 10, 2, -10, -6, -18, 5, 4, -2, 21, 25, 34, 13, -8, -11, 4, -6, -3, -20, 0, -22, -29, -5, -11, -13, -10, 7, 18, 43, 14, -3, 6, -9, 8, 10, 0, 1, 14, 14, 38, 27, 8, -13, -33, -2, 1, -7, -4, -2, -3, 18, -14, -2, 19, 26, 10, 43, 37, 0, 1, -17, -15, 4, 18, 8, 30, 36, 38, 21, -4, 6, -6, 1, -8, -4, 26, 17, 32, 5, 28, 20, 39, 34, 51, 42, 13, 3, -15, -1, -12, -10, 8, 12, 14, 14, 36, 12, 2, 2, 2, 9, 19, 26, 24, 45, 48, 29, 34, 33, 17, 44, 46, 19, 16, 27, -9, 14, -5, 15, 8, 26, 18, 32, 34, 33, 33, 18, -2, 31, -5, -1, -10, 6, -3, 24, 11, 32, 39, 17, 3, 9, 22, 25, -5, -1, -17, 15, -3, 28, 32, 16, 20, 18, 22, 11, -1, 8, -22, -50, -47, -37, -13, -22, -4, -27, -25, -27, -23, -13, 3, 9, 3, -2, 3, 12, -16, 8, 19, 23, 32, 34, 25, 22, 2, -11, -30, -42, -57, -50, -36, -21, -31, -36, -50, -63, -68, -12, 1, -4, -11, 12, -1, 11, -9, -11, 19, 22, 22, 17, 26, -7, -28, -31, -33, -44, -42, -43, -14, -15, -41, -30, -34, -46, -61, -22, -15, 2, -9, 10, 11, -7, 7, -5, 0, 16, 10, -1, 5, -8, -43, -64, -22, -11, -23, -48, -34, -45, -51, -38, -38, -20, -26, -29, -18, 15, 4, -7, -3, 9, -13, -2, -7, -21, -3, -4, -18, -47, -46, -55, -17, -5, -19, -17, -45, -57, -47, -60, -32, -55, -13, -20, -5, 14, -8, 8, 5, -10, -8, -29, -37, -38, -58, -48, -22, -63, -74, -38, 12, 12, 5, -19, -12, -42, -25, -40, -39, -30, 8, -7, -1, -12, -10, 8, 11, -13, -20, -10, -43, -48, -72, -61, -55, -45, -26, 0, 23, 30, -3, 11, -7, -25, -29, -34, -21, -18, 11, 10, -3, 3, -10, 12, 4, 1, -7, 3, -15, -50, -47, -70, -44, -37, 4, 33, 45, 21, -8, -1, -11, 8, -2, -29, -19, -4, 15, 30, -1, 10, 17, 11, 1, -3, 8, -5, -11, -23, -26, -39, -40, 2, 15, 49, 44, 36, 1, 18, 4, 6, 4, -6, 16, 4, 4, 26, -1, -10, 11, -1, 9, -19, -9, -13, 6, 0, -22, -11, -13, 6, 43, 45, 39, 22, 6, 23, 18, 5, 11, 16, 30, 36, 8, 13, -13, 13, -4, 16, -11, -4, 10, -17, -15, -25, -9, 1, 10, 22, 20, 31, 14, 20, 19, 13, 17, 40, 12, 39, 18, 39, 9, -4, -9, 10, -10, 16, -1, -11, 1, 8, -12, -8, 6, 4, 14, 7, 23, 10, 18, 47, 22, 22, 32, 19, 35, -2, 18, 29, 21, 16, 18, -16, -17, 14, 4, 2, 1, 5, 11, 18, 11, 1, 22, 2, 18, 29, 21, 39, 26, 9, 28, 8, 27, 4, 25, 7, 15, 0, -4, 12, -9, 6, 5, 7, -8, -10, -12, -21, -5, -10, -5, 4, -14, 8, 29, 16, 20, 4, 29, 37, 48, 0, 8, -6, -3, 9, -10, -3, -18, -6, -12, 14, -8, 7, -22, -21, -25, -34, -34, -29, -24, -2, 10, 23, 14, 14, 29, 13, 26, -3, -2, 6, 10, -10, 15, -5, 9, 6, 2, 16, 0, -8, -24, -6, -22, -9, -38, -23, -30, -3, -10, -30, -21, -33, -5, -21, -2, -21, -16, -16, -7, -3, 7, 6, -5, -5, -4, 11, -1, -3, -2, 9, -8, -1, -13, 14, 9, 8, -8, -6, 8, 11, 12, 0, -12, 6, 4, 8, 1, 0, 2, -13, -18, 2, -22, -18, -20, -20, 4, 1, -17, -11, -15, 3, -20, -20, -8, -11, -5, -22, -22, 3, -13, -3, -24, -9, -5, -9, 7, -21, 1, -12, -16, -2, -18, -2, 1, 5, 0, -15, -8, -12, -21, -2, -10, -16, 6, 4, -21, -22, 9, 0, -18, 7, -5, -10, 0, -24, 3, -6, -21, -20, -8, -9, -12, -15, -15, -11, -14, -7, 9, -5, 2, -12, -3, -2, -14, 1, 9, 0, -16, -14, 7, -14, 1, -6, 5, -10, -14, -9, 4, -5, -22, -20, -22, -16, 5, -8, -12, -9, 2, -24, 5, -21, 0, 9, 20, 4, -11, -12, -8, -18, -15, -16, 8, 1, -10, -12, -9, -15, 3, 5, 12, 9, -7, 9, 8, -6, -11, -25, -11, -15, -13, 5, -26, -1, -22, -29, -28, -17, -12, -18, 9, -2, 10, -24, 1, 12, 14, 12, 25, 15, 19, 1, 4, 18, 9, -23, -13, -19, -23, -10, -26, -27, -13, -30, -28, -23, 8, -7, -6, -19, -8, -1, 4, 6, 14, 28, 12, 12, 31, 28, 5, 35, 18, 0, 8, 18, 20, 24, 16, -5, -5, -15, -15, -4, 2, -10, 7, 0, 4, -13, 2, 6, 14, 21, 0, 20, 3, -3, 7, 19, 20, 36, 17, 27, 25, 3, 5, -10, -19, -29, -21, -9, -16, -17, -11, -8, 8, -9, -5, -4, 5, 3, 14, 18, 26, 19, 2, -9, 22, 11, 16, 31, 3, 3, 15, 6, -7, 2, -19, -7, -14, -23, -5, -8, -16, -6, 18, 6, 20, 12, 16, 10, 9, 12, 15, 13, 15, 6, 22, -1, 16, 2, -6, -11, 15, 4, -20, -17, -2, -14, -18, -19, -19, -15, 14, 8, 25, 33, 24, 35, 6, 7, -2, -8, 0, -6, 1, 9, 16, 21, -4, 3, -8, 3, 9, -6, 1, -6, -7, -16, -17, -12, 2, 32, 7, 7, 10, 23, 22, -5, -4, -9, 17, -9, 30, 18, 32, 23, 9, 18, 17, 6, 1, -1, 7, -7, -5, -13, 7, 4, 9, 2, 9, 15, -4, 23, -10, 15, 16, 3, 2, -6, 30, 31, 5, 17, 32, 2, -8, -4, -23, -36, -24, -14, 9, -19, -5, -8, 10, 11, 4, -10, 9, 21, 0, 19, -2, -1, 5, -3, 22, 1, 9, 24, 32, 25, 19, 5, -41, -27, -20, 1, -3, -10, -19, -11, 12, 11, -11, -19, 13, 3, 7, -8, 14, 5, -12, -5, -8, 17, -7, 21, 15, 45, 11, 2, -2, -32, -8, -27, -21, -1, 3, -11, -17, -14, -22, -20, -23, -7, 3, 8, 18, -17, -3, -16, -5, 10, 8, 3, 39, 46, 27, 5, 8, -13, -14, -10, 10, -8, -9, 0, -6, 2, -17, -34, -32, -5, -26, -6, 7, -16, 5, -33, -44, -14, 7, 6, 33, 14, -1, -7, -15, -9, -43, 0, -2, 0, -22, 5, 14, -13, -6, -8, -9, -14, -2, -14, -18, -16, -20, -31, -20, -17, 9, 8, 32, 11, 22, 0, 9, -32, -21, -7, 2, -9, -14, 7, -5, -14, -17, -4, -7, -19, -23, -5, 2, -13, -22, -36, -20, -4, 9, 17, 18, 23, 3, 11, -32, -41, -26, 5, -19, -20, -10, -17, 5, 11, 5, 6, -16, -3, -4, -26, -5, -28, -33, -29, -35, 8, 22, 3, 27, 4, -4, -16, -14, -24, -10, -15, -19, -6, 1, -6, 0, -9, 2, -2, -11, -7, -15, -29, -28, -45, -33, -26, -27, -3, 19, -13, 9, 22, -20, -25, -8, -28, 7, -23, -4, -19, -13, 7, -19, -12, -8, -18, -2, -29, -30, -24, -30, -10, -21, -12, -1, 15, -3, 9, -9, -14, -21, -33, -20, -18, 1, 7, -20, -21, -16, -15, -14, 7, -21, -30, -5, -5, -16, -27, -3, -12, -15, 13, 13, 20, 11, 8, 5, -10, -20, 2, -15, -10, -3, -1, -14, -3, -13, -21, 13, 1, 25, 25, -8, -5, 0, 2, 0, -6, 7, -4, 15, 8, 11, 5, -21, -4, -13, -2, -5, -1, -22, -14, -20, -10, -19, 7, 3, 3, 41, 29, 33, 30, 18, 27, 21, 21, 12, -1, 34, 11, 31, -4, 11, -9, 8, -8, -1, -2, 6, -16, -15, 5, 1, 10, 7, 2, 8, 13, 43, 23, 17, 28, 11, 23, 11, 8, 12, 39, 26, 38, 46, 28, 29, 1, 10, -3, -4, 3, -12, -6, 11, -3, -6, -17, -3, 7, -8, 2, 25, 18, 45, 32, 57, 41, 45, 30, 46, 46, 30, 14, -5, 13, 4, 8, -11, -12, 3, -11, -3, -23, 0, 3, 3, -10, -17, -1, 9, -4, -18, -20, -11, -13, 3, 3, 5, -13, -17, -12, 9, -21, -17, -17, -5, -2, 6, 4, -13, -15, -6, -10, -2, 2, 3, 15, -1, 11, 12, -5, 4, -5, 6, -3, 15, -7, 6, 1, 10, 15, -10, 16, 8, 7, -11, -13, -5, -12, 14, 7, 12, -16, 13, 16, 2, -15, -4, 13, 10, 15, 3, 17, 7, -13, 7, 11, 6, -15, 14, 7, 13, -14, -12, -13, 10, 7, 12, -6, 17, -11, -7, 0, 3, -3, -9, 15, 14, -7, 14, 22, 3, 21, 28, 2, -7, 11, 8, 11, -7, -15, 2, -9, 17, -10, 1, -12, -13, 7, 13, 6, -1, 3, 7, 17, 8, 18, 11, 28, 3, 12, 21, 38, 17, 16, -15, 10, -1, 14, 1, -10, 0, 16, 7, 13, 24, 12, 12, 14, 10, 14, 14, 14, 12, 10, 27, 16, -1, 26, -7, 7, -13, -2, -7, -5, -1, -13, -2, -1, 13, -7, 12, 2, 16, 5, -16, -25, 6, 10, 27, 10, -2, 4, 27, 28, 3, 0, -4, -17, -11, 18, 1, 0, 12, -5, -15, -13, -6, 9, -6, 3, -14, 2, -10, -24, -9, -10, 13, 2, 18, 0, 17, 19, -12, 7, -2, -13, -4, 14, 25, 24, 22, 4, -3, -6, 3, 0, 11, -7, -11, -28, -33, -17, -22, -25, -16, 11, 5, 15, 18, -2, -1, -2, 2, 8, -3, 21, 18, 24, 23, 7, 15, 17, 13, -2, -4, 1, -27, -36, -17, -14, 4, -6, 5, -14, 2, 15, 6, 7, -5, -16, -19, -9, 4, 4, 5, 29, 28, 9, 14, 10, 7, 10, 4, -1, -20, -6, 5, 2, -5, -12, -4, -22, 14, 14, 13, 15, -32, -22, -36, -28, -22, 15, 7, 39, 19, 3, 6, -2, 2, -2, 15, 11, -2, -11, -2, -15, 4, 5, -10, 10, 26, 37, 11, -7, -20, -6, -29, -6, -30, -21, -6, 32, 39, 23, -10, 16, 6, 10, -9, -3, -3, -27, -8, 5, -4, -1, 12, 17, 18, 35, 1, 20, -22, -22, -2, -11, -15, -14, -36, 3, 2, -8, 3, 18, 9, -2, 3, 6, 5, -22, -26, 8, 4, 3, 37, 28, 15, 30, 10, -24, -14, -8, -19, -29, -8, -38, -32, -29, 8, 0, 6, -1, -5, -12, 7, -1, -8, -9, -23, 8, -5, 7, 20, 23, 17, 6, -14, -25, 1, -20, -22, 11, 5, -29, -29, -7, -12, 15, 18, -12, 2, 11, -12, 8, -11, -16, -34, -36, -19, -26, -16, 1, 6, -12, -7, -16, -23, 5, -12, 2, 19, -20, -10, -1, -14, -16, 9, 17, -15, 19, -3, -9, -7, -41, -64, -65, -78, -44, -34, -7, 0, -6, -41, -9, 2, 9, 24, 11, 11, 18, 12, 0, -19, 13, -12, 8, 6, 3, 20, -4, 4, -18, -38, -74, -81, -68, -51, -34, -26, -19, -27, -4, -11, 10, 20, 13, 27, 11, -17, -14, -6, 5, 16, 6, 1, 7, 22, 2, 6, -4, -40, -59, -52, -58, -57, -65, -50, -10, -28, -21, 18, 4, 3, -3, 20, 5, -31, -32, -1, 12, -1, -12, -5, 16, 41, 40, 23, 15, -28, -15, -51, -61, -59, -67, -39, -6, 14, 7, 27, -2, 19, 15, 25, -13, -33, -12, -23, -5, 8, -15, -13, -1, 21, 36, 19, 17, -3, 17, -31, -39, -15, -3, 24, 19, 26, 26, 6, 40, -8, 10, -1, -14, -1, -17, -19, 15, -10, -14, 6, -4, 22, 15, 29, 45, 25, 38, 17, 8, 16, 46, 32, 45, 32, 23, 33, 30, -1, 12, -13, -18, 0, 6, 4, 15, 7, -14, -2, -4, 3, 15, 26, 21, 51, 45, 43, 52, 33, 41, 32, 33, 37, 18, 9, 2, 19, -10, -30, -37, -29, 3, -4, 13, -6, -6, -1, 3, 12, 39, 23, 2, 10, 21, 20, 28, 18, 1, 8, 16, -6, -6, 9, -15, -12, -5, -18, 4, -1, -12, 6, 1, 3, 0, 8, -1, -5, 9, 20, 1, -26, 12, 13, 35, 33, 26, 13, 11, 21, -9, -5, -12, -13, -7, -18, -11, 8, -8, -18, 2, 16, -15, -7, 18, 16, 3, 24, 17, -2, 9, 20, 19, -9, -8, -6, -20, -14, -20, -7, -23, -6, -10, 0, 3, -14, -10, 4, -15, -11, 3, -10, -11, 11, 6, 4, 22, 19, 14, 3, -3, -1, -7, 8, -2, 1, -12, 5, -8, -16, -17, 9, 10, 4, 14, -3, -4, 1, 12, -5, 5, 1, -5, 11, 0, -4, -2, 6, -11, 4, -14, 6, -8, 3, -9, 0, 6, 14, -6, 0, 5, -10, 5, -12, -13, 14, 13, 3, 8, 4, -8, 8, -4, -3, 0, 4, 7, -3, 11, 4, 16, -3, 14, 4, 14, 15, -1, -10, -6, 15, -13, 13, -15, 18, -8, -14, 2, -6, -9, -13, -14, 1, -6, 14, -17, -15, 3, 15, -13, 0, 1, 9, -8, 11, 13, 13, 5, -4, 11, -14, -5, 4, -3, -12, 6, -16, 7, -2, 12, -19, -20, -2, -16, 0, -5, 3, -9, 5, -15, -10, 0, 7, -12, 8, 3, 13, -9, -2, 4, 13, 0, -9, -7, -10, -4, -16, -6, -6, -7, 6, 7, -3, 0, -8, -14, -25, 5, -9, 2, -20, -20, 2, 2, 13, 0, 6, -9, 5, 4, -1, -13, -19, -17, -11, 7, -20, -13, -17, 15, -8, -5, 9, -13, -25, -21, 3, -4, -1, -9, 1, 0, -18, -8, -14, -7, 0, 15, 9, -14, 10, -18, -21, 6, -4, -22, -6, -20, -14, 5, 4, -17, -3, -16, -6, -25, -10, -43, -33, -23, -35, -8, -4, -14, -10, -8, 14, -9, -4, 0, 0, -15, -22, -5, -11, -21, -7, -6, -13, -14, -10, -3, -35, -21, -57, -30, -55, -35, -42, 1, -17, -10, 2, 15, -15, 2, 5, -3, 21, 24, -5, 23, 4, 14, 10, -17, -10, -12, -23, -30, -28, -49, -47, -43, -31, -1, -4, 8, 3, 10, -20, -1, -7, 13, 14, 9, 2, 1, 14, -3, 16, 16, -2, -13, -9, 4, -22, 7, 3, -4, 3, 0, 29, 23, 22, 20, 1, -13, -15, 11, -4, -8, 1, -20, -8, 12, 1, 15, 31, 12, 10, -5, -1, 5, 2, 7, 5, 28, 26, 45, 49, 19, 39, 34, 28, 9, -11, 15, 9, 2, 1, -12, -3, 5, 5, 9, 11, 20, 24, 32, 34, 47, 35, 43, 43, 39, 44, 10, 33, 39, 7, 33, 42, -3, 14, 13, 8, -13, -17, -13, -26, -7, -12, 7, -6, 37, 34, 39, 40, 13, 30, 15, 11, 18, 23, 38, 30, 20, 17, 36, 40, -1, 11, 14, -5, 17, 0, -23, -39, -37, -20, -4, -2, 6, 9, -5, -22, -27, -13, -7, -34, 7, -6, -22, 5, 3, -2, 2, 12, -9, -3, 12, -9, -17, 0, -52, -37, -60, -29, 0, -11, -2, 8, -15, -26, -34, -42, -31, -43, -23, -26, -54, -37, -51, -33, -32, 11, 2, 1, -18, -14, -5, -8, -53, -58, -50, -10, -8, 11, 31, -4, -14, -13, -6, -26, -32, -28, -6, -40, -56, -39, -48, -40, -21, 25, 11, -12, 14, 9, -2, -21, -10, -53, -22, -1, 6, 19, 11, -4, 8, -14, -7, 6, 1, 28, -15, -27, -47, -32, -27, -20, 5, 4, -4, -14, -18, 6, -6, -22, 5, -11, 13, 32, 19, 29, 23, 2, 4, 7, 5, 13, 31, 10, 13, -11, -33, -25, -27, -9, 21, 23, -10, -8, -17, 15, 8, -14, 14, 6, 43, 26, 24, 21, 16, 15, 0, 12, -11, 34, 34, 21, 16, 2, 5, 32, 11, 24, -4, 16, -2, -16, -10, 9, 1, 3, 27, 43, 37, 13, 25, 47, 35, 27, 8, 0, 9, 25, 10, 7, 12, -15, 13, -10, 14, 33, 0, 10, 5, 8, -3, -4, -10, -5, 23, 52, 40, 45, 15, 7, 26, -6, -7, -2, 11, 5, 11, 6, 9, 10, 6, 12, 11, 23, 21, 2, 15, -4, -14, -6, 13, 6, 17, 13, 8, 26, 18, -4, 5, -12, -12, -20, 2, -4, -2, -20, 7, 12, 22, -1, 16, 21, 8, 26, 18, -9, -1, 14, 10, -5, -18, 22, 15, 4, 5, -12, -31, -7, -20, -9, -8, -22, -25, -24, -14, -13, 16, 18, 13, 29, 27, 2, 11, 13, -2, -8, -2, 11, -6, 13, -12, -32, -30, -19, -39, -6, -23, -12, -30, -26, -4, -23, -4, -7, -12, 12, -12, 8, 22, 24, 3, 3, -18, -14, -17, -11, -9, -7, -32, -45, -24, -18, -8, -5, -16, -38, -20, -18, -20, -17, -9, -16, -30, -23, -18, 10, 25, -9, 11, 3, -10, -12, 14, 9, -5, 2, -11, -32, -21, -6, -9, 6, -13, -15, -20, -25, -24, -42, -24, -36, -15, -4, 13, 6, -2, 14, 16, -18, -2, 11, -16, 6, 13, -8, -5, -3, 4, 14, 0, -11, -12, -10, -22, -14, -14, -9, -16, -15, 3, 4, 15, -8, 8, 11, -7, 10, 5, -11, -1, -2, 11, -16, -22, -19, -18, -16, -10, 6, 11, -14, 3, 3, -2, 0, 11, 14, -16, 13, 2, -10, 19, -1, -2, 10, -10, 3, 12, -2, -5, -18, 4, -17, -16, -13, -1, 19, -6, 20, 13, 4, 11, -10, -7, 23, 16, 1, 9, -3, -9, 14, -10, 13, -16, 3, 9, -13, -10, 13, -6, 3, 8, -15, 16, -2, -8, 16, 6, -10, -3, 2, 13, -15, 13, 12, -4, -4, -16, -15, -12, -4, 9, 14, -13, -3, 4, -6, -2, -1, -17, -12, 2, 10, -5, -16, -16, -14, 7, 7, -6, 6, -15, -10, 15, 14, -10, -5, 7, 5, -9, 7, -7, -2, -11, 7, -14, 3, -10, 10, 2, 6, 18, 13, 9, -6, -2, -17, -8, -12, 2, -18, -4, 13, -8, -14, -18, 3, -16, -14, 8, -2, -2, 1, 12, 12, -10, 4, 22, 10, 22, 22, 18, 10, 26, 8, 13, 5, 3, -5, -4, 0, 5, -13, -18, -4, -3, -4, -11, 5, -13, 8, 20, -9, 20, -7, 13, 4, 12, 29, 27, 13, 19, 22, -9, 20, 14, -15, -13, -5, -6, -1, 10, -4, -4, 8, -17, -2, 13, 18, 7, 6, 9, 5, 2, 1, -8, 5, -18, -33, -7, -13, -17, -12, -1, -15, -8, -11, -2, 16, -3, -14, -6, 15, 10, -1, 14, 25, 18, 11, 28, 20, 1, -6, 5, -4, -6, -11, -10, -12, -25, -22, -11, -14, -23, -9, -4, 2, 4, -8, -14, 3, -15, 2, -1, 26, 12, 11, 8, 0, -2, 11, -16, -8, -26, -17, -5, 19, 0, -6, -7, -5, -34, -16, -6, -22, 6, -7, -16, 12, 17, -1, 28, 20, 14, 5, 15, 3, -19, 2, -13, -18, -30, -15, -20, -21, 8, 14, -1, 12, -23, -14, -28, 2, -3, -12, -18, -3, 22, 21, 39, 8, 8, 42, -3, 2, -3, -15, 7, -13, 10, 1, -14, -17, -2, -16, 2, 0, -20, -22, -29, -4, 2, -13, 8, 6, 21, 23, 19, 14, 26, 7, -5, 6, 0, -19, 1, -3, 26, -7, 16, -10, 2, -4, -1, 2, 18, -1, -13, -14, 8, 13, -3, 17, 26, 26, 38, 18, 22, 11, 24, 8, -5, 15, 12, -1, 20, 12, 0, -8, -15, 9, 20, 16, 22, 1, -9, -25, 6, -4, -14, 1, 31, 35, 22, 27, 4, 29, 9, 11, 29, 37, 9, -6, -1, 0, 4, -13, 18, -12, 0, 23, 7, -4, -17, -4, -17, -9, -13, 20, 28, 36, 20, 12, -15, 21, 11, 26, 7, 22, -5, -52, -21, -28, -11, -16, -15, -19, 20, 26, 31, -7, -5, 7, -25, -9, -13, -2, 21, 8, 0, 21, 13, 14, 11, 17, 1, -4, -30, -45, -30, -11, 1, 10, -2, 9, -1, 22, 1, 6, 1, -13, 11, 1, -3, 6, 14, 1, -13, 14, 0, -24, -13, -13, -6, -14, -43, -35, -3, 0, -3, 17, 24, 27, 22, 19, 22, 36, -4, -12, 0, 3, -9, -4, -11, -14, -36, 2, 7, 6, -15, -12, -52, -45, -66, -24, 40, 23, 11, 15, 25, 27, 21, 7, 7, 20, 0, -22, -11, -12, 11, -5, 1, -17, -19, -16, -1, -10, -36, -46, -75, -60, -37, 15, 41, 38, 28, 15, -1, 19, 23, 30, -13, -16, -6, -14, -5, -1, -14, -16, -7, 5, -15, 6, -26, -23, -46, -66, -111, -59, -24, 23, 52, 25, 41, 49, 27, 2, -3, 2, -14, -8, -17, -9, 3, -2, 13, -17, 3, -16, -5, 1, -21, -43, -52, -69, -91, -46, 28, 58, 52, 19, 36, 34, 24, 13, 5, -15, -16, -32, -22, -15, -12, 6, -6, -5, -9, -8, -22, -9, -27, -43, -23, -45, -40, -24, 49, 33, 21, 47, 21, 44, 27, 14, -6, -29, -32, -35, 5, 1, 0, 9, 1, -8, -3, 7, -11, -26, -40, -16, -30, -37, -18, -19, 45, 25, 43, 44, 29, 9, 2, -10, -9, -28, -20, -11, 4, 7, -2, 9, 12, -11, -15, -18, -35, -13, -6, -22, -23, -8, -30, -12, 22, 10, 23, 20, 19, 35, 9, 6, -19, -22, -30, -20, 5, 8, 13, -12, -15, -1, 10, 8, 0, 3, -25, -13, -25, -25, -13, -25, -20, -5, -11, 30, 2, 19, 16, 26, -12, -21, -23, -35, 3, -5, -12, -1, -9, -1, 12, 5, -15, -4, -1, -23, -27, -29, -47, -29, -16, -30, 8, 20, 8, 8, 13, 1, -19, -20, -26, -28, -5, 9, -17, 0, 2, 5, -1, -5, -7, 14, -8, -10, -17, -17, -38, -27, -9, -2, 22, 8, 29, 10, -2, 11, -10, -22, -15, -32, 6, -2, 15, 11, -3, -12, 8, 14, -2, 4, 9, 2, -5, -6, -24, -1, 10, 15, 19, 30, -4, 2, -11, 6, -1, -19, -21, 5, -8, -10, -3, -9, -8, -10, 4, -7, -3, -4, 1, -2, 2, 1, 1, 3, 0, 11, 4, 7, 28, 12, 13, 27, -16, -16, -16, -3, 11, -10, 16, -4, 4, -2, 2, -15, -16, 0, 13, 10, -3, -6, -9, 5, 11, 22, 25, -4, 21, -2, -5, 7, 13, 3, -8, 14, 9, -14, 8, -18, 2, -8, -17, -16, -4, -7, 1, 6, 8, 8, 0, 11, 3, -16, 11, 11, 9, 12, -3, 12, -6, 10, -19, -6, -20, -11, -16, 1, 1, -13, 2, 8, -12, 9, -13, 12, 0, -2, 11, 10, -11, -21, -20, -1, 6, 10, 8, 7, -10, -13, -11, -18, -12, -11, -11, 3, -11, 5, -3, -21, -1, 11, -18, -18, -7, 6, -11, 2, -18, -14, -18, -5, 7, -12, 4, -12, 0, -8, -7, -19, -21, 4, 4, -19, -17, -12, -8, -8, 5, -18, 11, 6, -12, 21, 4, 11, 16, 17, 32, 35, 5, 3, 5, 20, 2, -1, -21, -7, 1, -1, 10, 1, 6, -15, -11, -7, -14, -20, 9, -3, 7, 21, 31, 29, 31, -1, 14, 24, 13, 2, -3, -4, 13, 24, 19, 3, 4, 8, -16, 6, -21, -6, -21, 11, -22, -6, 16, 13, 17, 18, 34, -3, -5, 9, 5, 17, -1, 8, 19, 4, 13, -8, 22, 3, 6, 16, -5, 8, -20, 4, 0, -7, 12, 9, 10, 31, 27, 15, 6, 1, 15, 10, -5, 22, 9, 27, 22, 24, 27, 33, 8, -7, -5, 9, -6, -8, -20, 4, -3, -8, -16, 15, 20, -2, 2, 12, 20, 12, 7, 15, 27, 29, 20, 44, 50, 46, 44, 16, -13, -21, -14, 21, 15, 11, -7, -20, -17, -6, -6, 6, 1, 15, 0, 15, 5, 14, 22, 45, 47, 17, 27, -2, -5, -6, 2, -2, -14, -13, -16, -17, 12, -1, 3, 11, 3, 1, -16, -14, -12, 25, 13, 27, 19, 25, 25, 19, 12, -36, -52, -74, -55, -37, -47, -36, -3, -14, -5, -21, 2, -6, -14, -6, 7, 18, 5, 15, 2, 12, 12, 24, -7, 10, 0, 6, -29, -34, -76, -77, -30, -44, -28, -48, -34, -47, -35, -5, -1, -6, 7, -7, 14, 16, 19, -6, -12, -13, 5, -7, -1, 2, -7, 2, -22, -34, -34, -17, -6, -7, -50, -46, -34, -21, -9, -25, -10, -12, 4, -3, -9, -6, 4, -9, 23, -12, -2, -14, 0, -5, -3, -29, 1, -18, -1, -1, 6, -25, 2, -16, -13, -31, -10, -12, -16, -2, -21, -15, 0, -10, -23, -14, -17, 5, -15, -15, -28, -14, -17, -29, -9, -18, 2, 12, 9, -2, 18, 7, 6, -1, -22, -12, 8, -13, -21, 8, 10, -11, -27, -27, -19, -10, -2, -5, -8, -39, 0, -12, -12, -7, -9, 3, -20, 3, 4, 6, 2, 26, 6, -20, -5, -8, -18, 5, 6, 4, 3, -37, -18, -35, -26, -9, 3, -13, 3, 0, 8, 6, -22, -3, -16, 12, 25, 31, 8, 7, 23, 2, -20, 2, 8, 12, -4, -12, -6, -32, -60, -60, -42, -17, 7, -7, -9, 3, 7, -18, -31, -23, -16, 17, 26, 13, 26, 8, 9, 2, 3, 0, -7, -14, -10, -11, 5, -22, -49, -47, -64, -38, -39, -40, -31, -33, -16, -26, -8, -24, -12, 9, 21, 21, 19, 27, 14, -21, -15, -9, 3, -7, -16, -6, 0, -16, -37, -27, -57, -53, -62, -44, -85, -66, -11, 2, -2, -15, 14, -1, 19, 21, 24, 8, 24, -7, 2, -9, -20, 0, 1, 5, 5, -10, -16, -23, -27, -72, -58, -71, -72, -23, -19, 1, 7, 6, -4, 21, 12, 36, 15, 14, 5, 12, -11, 6, -7, -8, 4, 16, 16, -12, -19, -1, 2, -16, -26, -6, -19, -14, 17, 21, 14, 10, 2, 31, 28, 6, 10, 10, 5, 10, -5, -4, -9, -14, -15, 5, 5, 28, 4, 29, 6, 7, 4, 2, 36, 16, 23, 39, 5, 21, 24, 20, 15, 23, 9, 8, -10, -15, -17, 2, 9, -2, -19, -13, 11, 12, 25, 26, 7, 1, 19, 31, 12, 33, 28, 24, 24, 12, -1, 14, 20, -18, 13, 11, 12, 1, -22, -13, -7, -16, -5, 14, 19, 25, 46, 39, 25, 31, 42, 27, 19, 31, 14, 6, 6, 16, 18, -15, -12, -21, -18, -2, -21, 4, -19, -2, -4, -3, -7, 0, 21, 18, 30, 36, 38, 44, 51, 26, 44, 18, 6, 27, 9, 18, 25, -16, 0, -18, 3, 0, -2, -5, 4, -7, -20, 1, -8, 13, 8, 7, 16, 6, 14, 23, 3, 32, 32, 20, 4, 18, 30, -1, -16, -8, -16, 13, -1, -15, 15, -1, -18, -21, -10, -15, -2, -14, -7, -14, -9, -1, -9, -17, -13, 17, -15, 11, -7, 12, 4, 7, 1, 17, 10, -3, 12, -10, 5, -15, 5, 1, -20, 1, 6, -21, 13, -13, -21, -12, -17, 11, -9, -16, -4, -11, -12, -6, -14, -8, -4, 5, -13, 8, -6, -10, 4, 5, -10, -10, 3, -9, -16, -16, -24, -3, 4, -6, -25, 1, -18, -7, -18, -29, -19, -22, 1, 2, -3, -14, -5, -24, 4, -9, -8, -19, -7, 4, -6, -2, -10, -8, -27, -15, -2, -4, 3, -19, -28, -21, -31, -14, -4, -19, -10, -7, -19, -17, -24, -13, -4, -7, -22, -29, -15, -24, -12, 5, -24, -29, -10, -13, -30, -17, -31, 2, -13, -34, -5, -25, 1, -10, 8, -12, -14, -6, -7, -22, -29, -28, -21, 3, -24, -29, -6, -7, 1, -9, -24, -2, -2, 2, -15, -23, -26, -1, 7, -2, -13, -24, -18, -23, 0, -12, -19, -9, -11, -14, -28, -15, -7, -1, -13, -23, -16, -8, -11, 6, -6, 5, 9, 5, 25, 4, 33, 8, 22, 1, 9, 18, -14, 3, -17, -22, -13, -6, -15, -11, -4, -8, -27, -15, -13, -21, -4, -23, -5, -19, -20, -8, 12, 5, 34, 27, 13, 16, 25, -10, 3, -8, -2, 11, -16, -11, -28, -20, -18, -6, -29, -3, -9, -15, -1, -16, -20, -25, 7, 0, -1, 23, 10, -8, -7, 10, 1, 6, 3, 12, 2, -17, -10, -20, -24, 5, -11, -12, 1, -17, -11, -5, -13, -18, -12, 1, 8, 14, -1, 5, -2, 17, 9, 10, 14, 5, -17, 10, -10, -2, -9, -10, -14, -15, -5, -18, 0, -30, -4, -19, -14, -19, -15, -12, 9, -12, 13, -14, 14, 26, 16, -3, 8, -5, 1, 11, -13, -9, -18, 2, -14, -4, 9, -28, -20, 0, -5, -5, -24, -11, -1, -7, 9, -5, 0, 10, -4, -15, -11, -5, 0, -12, 7, 0, 2, 6, 13, 4, -7, -10, -14, -1, -11, -23, -32, -1, -19, 15, 32, 25, -6, -4, -9, -1, 6, -10, 14, 3, 14, -12, -13, 8, -12, -7, 8, -17, 6, 16, 5, -28, -24, -13, -8, -14, 12, 28, 5, 17, 15, -5, -9, -22, -12, -3, 11, -2, 8, -3, -17, 3, 9, -15, 5, 7, 12, -5, -12, -1, 4, 1, -25, -18, 5, 13, 10, -13, -10, 11, 0, -19, -20, 0, 4, 16, 9, -14, -11, 9, 9, 2, -21, -12, -23, 13, 3, 4, -2, -7, -28, -18, 7, -1, 1, -15, -17, 4, -21, -28, 13, 13, 4, 18, 16, 14, -4, 6, -4, 6, -6, -4, 1, 18, -15, -1, -3, -13, -23, -19, 6, -14, -21, 0, -23, -33, -16, 1, -8, 6, 33, 17, 11, 23, 5, -16, -2, -4, -19, -8, -25, 17, -1, -18, -24, -2, -24, -7, 18, -8, 10, -9, -24, -13, -30, -6, -6, 28, 28, 4, 30, 14, -27, -20, -25, -3, 0, -31, -8, -5, 10, -27, -18, -26, -25, 17, 1, -21, -13, -28, -24, -31, -8, 10, 8, 36, 21, 23, 22, -9, -5, -29, -15, -7, -7, -1, -3, 24, -7, -14, -6, -18, -1, 1, -10, -2, 4, 2, 4, -11, -23, 6, 19, 34, -3, 21, 3, -3, -30, -13, -9, -6, -5, -10, 17, 8, -10, -19, -3, 1, -10, -7, 17, 1, 10, -4, -10, -2, -15, 13, 1, 14, -1, 18, 18, -6, -1, 5, 8, 5, -8, -3, 18, 8, -9, -25, -28, -22, -31, -2, 16, 9, 23, 0, -14, 9, -8, -21, -23, -3, 17, 24, 10, -8, -7, 0, -7, -6, 28, 38, 7, -15, -3, -5, -10, -16, -6, -10, 22, 24, 6, 4, 0, 10, -17, -14, -21, -30, -7, -14, 5, 6, 11, 30, 33, 20, 28, 44, 3, -12, -27, -19, 4, -15, -13, -3, 4, 26, 6, -2, 7, 9, 5, -4, -40, -10, -3, -23, -12, 0, 31, 21, 18, 36, 26, 23, -2, 7, -15, -12, -22, -14, 1, 10, 22, 2, 24, 24, 10, 8, 9, -3, -7, -21, -20, -7, -16, 16, 6, -2, 12, 42, 30, 26, 10, -8, -1, -23, -4, -18, 3, 6, -9, 6, -4, 0, 26, 16, -13, -21, -13, -27, -3, -26, 4, 20, 35, 15, 22, 22, 20, 25, -7, -25, -27, -28, -16, -8, -7, -4, -35, -41, -41, -28, 3, 8, -15, 9, 4, -19, -23, -11, 15, 14, 25, 34, 8, 10, 1, -14, -23, -6, 2, 1, -10, -15, -9, -9, -15, -22, 0, -14, -22, -16, 9, -18, 20, 26, 30, 17, 6, 30, 1, 11, -1, 2, -24, -24, -12, -22, -20, -2, -15, -17, -10, -11, -16, -14, -13, -10, -16, 0, 9, -20, -1, -10, -5, -22, -19, -13, -26, -1, -6, 6, -25, -24, -1, -15, -28, -4, -17, -13, -17, 2, -23, -12, -23, -21, -2, -12, -4, -27, -7, -14, -19, -16, -6, -29, -28, -21, -27, 0, -15, -14, -30, 2, -7, -25, -21, -23, -29, -17, -5, -14, -2, -16, -10, -21, 0, 3, -14, -8, -8, 4, -6, -14, -27, 2, -15, -2, -4, -24, -27, -15, -4, -13, -23, -10, -6, -30, -21, -15, -16, -24, -25, -8, 2, 1, -20, -17, 0, -6, -30, -29, -5, -5, -14, 2, -24, -15, -12, -24, -2, -20, -26, -13, -7, -2, -5, -13, -24, -7, 0, 4, -27, -21, -4, -29, -2, -7, 2, 2, -5, -19, -22, -4, -30, -9, -20, -3, 1, -10, -22, -12, -12, -8, -27, -13, 3, -21, -27, -16, -1, -14, -10, -14, -7, 0, -7, 6, 8, -20, 7, -18, -20, -10, -14, -14, -20, -6, -29, -23, -11, 4, -8, -31, -26, -20, -19, -7, -3, 19, 11, -2, 27, 4, 12, 1, -7, -9, -5, -24, -23, -17, -17, 1, 1, -9, -24, -4, -5, 1, -30, -8, -25, -38, -19, -5, -15, 28, 14, 17, -1, -3, 6, 3, 4, 7, 25, 13, -11, -2, 9, -9, -5, -2, -16, -15, -19, -29, -20, -34, -35, -28, -24, -3, 21, 14, 9, 11, 26, 11, 26, 5, -1, 8, 18, -9, -15, -7, 3, 11, -25, -19, -1, -30, -31, -9, -11, -38, -11, -32, 19, -6, 20, 10, -3, 19, 29, 16, 36, -5, 2, -4, 23, 20, -4, -3, -19, 17, 5, -28, -31, -10, -27, -26, -29, -15, -16, -21, 8, 2, 11, 9, -4, 24, 22, 3, 26, -2, 9, 16, -12, 0, -5, 2, 27, 21, -13, -19, -21, -12, -17, -3, -17, -7, 3, 0, -2, -2, 14, 25, 18, 20, -3, -3, -3, -16, 6, -10, -21, -7, 10, -12, 9, 25, -5, -15, -13, -19, -24, -1, -22, 0, 16, 21, 36, 10, 16, 22, 1, 14, -1, 13, -16, -6, -25, -30, -17, -11, -22, -4, 37, 8, -13, -16, -13, -29, -20, -20, 3, 20, 35, 34, 10, -1, 15, 10, -20, 3, 36, 1, -3, -3, -20, 9, -2, -3, 2, 8, 36, 10, 3, -27, -3, -24, -5, -16, 3, 31, 19, 26, 14, 8, -33, -3, -20, 3, 35, 3, -7, 3, -24, 4, 1, 8, 14, 5, 3, -7, 7, -13, 3, -7, -21, -2, 5, 2, -10, -3, -2, -22, -37, -16, -11, 35, 10, 22, -4, -10, -36, -12, 9, 16, -12, -30, -17, -2, -1, -5, -21, -5, -12, -24, 11, -18, 3, 13, -10, -27, -32, 4, 12, 22, 4, 4, 6, -26, -10, -1, 2, -22, -4, -7, -27, -23, -6, -9, 4, 3, 0, -19, -10, -2, -7, -11, -10, 0, -7, -1, 10, 29, 20, 27, 5, -25, -24, -30, -14, -13, -20, -16, -6, -5, -10, 3, -24, -24, -31, 7, 10, -6, -12, -14, -29, -26, -27, -3, 25, 23, 23, 0, 5, 5, -12, -23, -3, -26, -2, -26, 0, 9, -18, -27, -30, -27, -6, -21, -18, 3, -4, -22, -25, -31, -1, 11, -5, 17, -2, 10, -1, -14, -30, -18, -20, -16, -22, -22, 4, 0, -27, -24, -27, -24, -19, -2, 7, -10, -3, -19, 8, -24, -3, 0, -22, -4, 13, -3, -12, 4, -5, 2, 5, -11, 1, 4, 0, -11, -29, -7, -10, -17, -6, -6, 8, 3, 0, 11, 0, 5, 18, -25, -22, -10, 2, 6, 0, 9, 7, 6, 15, 21, 19, 13, 24, 12, -27, -3, -16, -10, -10, 3, -9, 13, 15, 4, 8, 6, 13, -2, -19, -10, -12, 13, 19, 1, 5, 8, 20, 4, 47, 29, 27, 5, 0, -2, 0, -21, -28, -3, 20, 3, 22, 14, 15, 12, 3, 5, -21, -3, -11, 2, 13, 18, 28, 7, 30, 38, 28, 41, 11, -3, -31, -24, -10, -18, -12, -3, -5, -3, 3, 18, -2, 6, -3, -11, 7, 1, -14, -19, -9, 10, 4, 18, 3, 9, 26, 9, -11, 5, -28, -6, 1, -6, -10, 0, -22, -24, -4, -31, 19, 10, -5, -21, 12, -13, -11, -16, 2, -5, 2, 0, 19, 33, 17, 2, 14, -23, -19, -28, -1, -16, -12, -32, -13, -14, -16, -7, 6, -11, 2, 6, 13, 5, -16, 14, -1, 7, 17, 23, 28, 26, 10, 3, -9, -20, -1, 1, 0, -10, -15, -2, -26, -30, -16, -8, -18, 11, 9, -15, 7, 9, 24, 22, 16, 35, 30, 11, 29, -6, -2, -7, -22, -9, -21, -9, -23, -14, -4, -11, -19, -26, -12, 8, -20, 13, -16, 9, 5, -9, 20, 21, 3, 6, 14, 10, 1, -3, -25, -14, -29, 0, -2, -30, 1, -29, -27, -6, -17, 1, -6, -3, -28, -12, -13, -4, -4, -4, -18, -2, -15, -23, 5, -5, -8, -9, -1, 0, -25, -19, -27, -27, -4, -2, 5, -16, -15, 3, 10, -18, 8, -11, -7, 9, 6, -11, 5, 4, -5, 8, 2, 7, -9, 4, -15, 5, 3, 2, 6, 9, -12, 11, -9, 5, 8, -11, 1, -18, -10, -11, -5, -7, -2, -6, -9, -16, 8, -13, 3, 11, 2, 8, 3, 1, -10, 8, -20, -5, -4, -9, -9, -10, -18, -19, -15, -13, -20, -11, -5, 6, -18, 22, 21, 9, 0, 11, 14, 9, -18, 6, -8, -1, -5, -8, -7, -3, 8, 8, -18, -11, -11, 0, -13, -14, -12, -11, -18, -12, 10, 27, 26, 24, 34, 26, 11, 5, -5, 10, -24, -12, 3, -7, 5, -4, -11, -6, 6, 10, -4, -11, -23, -9, -22, 1, -12, -2, -12, 40, 7, 20, 15, 17, 20, -2, 3, -3, 4, -4, -11, 6, -6, -10, 8, -4, 8, -18, 2, 8, 5, -12, -4, -11, 14, 10, 26, 20, 32, 11, -18, -25, 1, 12, 0, -3, -3, -3, -10, 0, -1, 11, 3, 9, -8, 2, 7, 2, -12, -26, -27, -45, -15, 15, 22, 31, 12, -15, -23, -40, -15, -2, -12, 18, 4, -5, 1, -7, 3, -15, -6, -10, -6, -5, -3, 10, 11, 7, -27, 5, 10, 20, 28, 40, 15, -16, -18, -16, -3, -25, -10, -20, -4, 2, 0, 12, 10, -23, -18, 12, -18, 2, -3, -1, -25, -11, -25, -8, -6, 22, 39, 49, 57, 15, -8, -33, -25, -17, -6, 3, -11, 1, 13, 10, -16, -1, -13, 11, -2, 4, -4, -17, -11, -12, -22, -30, 6, 21, 53, 63, 38, -14, -52, -20, 4, 5, 0, 11, 10, 23, 25, -5, -10, -17, 11, -1, -7, -15, -20, -43, -26, -17, -24, 3, 0, 46, 71, 76, 36, -58, -55, 1, -1, 3, 3, 6, 19, 15, 7, -7, -12, 10, -9, -8, 2, -20, -25, -19, -25, -4, -18, -3, 13, 39, 48, 43, -55, -58, -37, -13, 20, -13, -2, -12, -14, -17, 9, -30, -8, -15, 8, -6, -17, -16, -39, -38, 23, 6, 5, 32, 53, 54, 52, -16, -54, -63, -27, -3, 2, -13, -14, -11, -10, 8, 12, -31, -2, 4, -7, 0, -15, -1, -40, -15, 14, 17, 18, 36, 36, 14, -2, -52, -60, -39, -25, -19, -19, -44, -24, -4, 7, 18, -5, -1, -5, 1, -21, -7, -7, 1, 0, 16, 23, 23, 28, 25, 25, -27, -29, -48, -28, -33, -21, -12, -32, -44, -19, -8, -13, 39, 15, -4, -18, -8, -22, -20, -6, -19, 1, 31, 4, 40, 17, -2, 2, -44, -34, -40, -31, -33, -35, -27, -40, -25, -13, 4, 17, 22, 28, -1, -16, 10, -22, -10, -16, -17, -11, 20, 4, 9, 16, 8, -31, -23, -44, -46, -25, -9, -26, -31, -29, -21, 13, 7, -5, 15, 11, -30, -10, 2, -18, -5, 1, 1, 4, -4, -19, -4, -1, -1, -9, -37, -41, -39, 7, 11, -32, -7, 5, 10, -3, 25, 4, 9, 17, -25, -25, -4, -11, -10, -17, -3, 4, -2, -17, -3, -15, 5, -21, -41, -40, -28, -4, 9, -6, 10, 26, 18, 9, 50, 34, 20, 11, 3, -4, -9, -16, -4, -10, 8, -4, 13, -2, -10, 15, 4, -11, 5, -12, 4, 12, 32, 23, 5, 18, 9, 37, 25, 38, 19, 16, -13, -12, 8, -2, -17, -23, 2, 7, 1, 7, 16, 18, 10, 12, 23, 52, 5, 31, 22, 21, 24, 19, 51, 26, 14, 8, -13, 4, 8, -21, -17, -22, -7, -13, -10, 10, 15, 4, 3, 30, 6, 20, 13, 22, 8, 16, 6, 17, 24, 43, 39, 33, 15, 13, -15, 1, 5, 12, 7, 9, -14, 9, 1, -18, -15, 5, -14, 20, -3, 0, -2, 9, -9, 7, 12, 21, 18, 12, 48, 8, 27, 9, -16, -23, 12, -4, -9, 3, -14, -14, 3, -11, 0, -12, -12, -2, 27, 26, 12, -2, -6, 20, -1, 0, 29, -9, 1, -11, -23, -27, -30, 3, -4, -1, 3, -2, -15, -4, -9, 2, -11, -1, -16, -8, 18, 13, 14, -12, -1, -10, -3, -17, 8, -3, 8, 0, -11, -20, 3, 7, 4, 6, -3, -6, -9, 3, -10, -8, -15, -19, -15, 9, 3, -26, -18, 1, -7, -19, -25, -26, -6, -2, 8, 11, 13, 16, -5, -6, 2, 10, 6, 0, -16, -11, -19, -4, -16, -11, -19, 9, -23, -25, -4, -23, -37, -46, -1, -20, -33, -1, 13, 5, -9, -7, -1, 8, 4, -20, -5, -18, -7, -17, 4, 8, -14, 7, -17, -7, 7, -2, 8, 7, -13, -2, 2, -16, -14, 6, 4, -17, -4, -21, 8, 0, 2, -10, -2, -23, -22, 1, 8, -18, -18, -1, 7, 5, 0, -13, -14, 6, 7, -6, -8, 3, -21, -5, -15, 5, -22, -16, 7, 7, -5, 1, -4, -3, -1, 7, -16, 1, -17, -13, -10, -13, 0, 2, -6, -9, -15, -11, -1, -4, 1, -19, -9, -23, -21, -19, -23, -6, -9, 1, -3, -6, -5, 3, -25, 4, 7, -19, 7, -16, -10, 2, 21, 13, 14, 15, 14, 2, 21, 8, 11, -2, -1, -13, 8, -13, -24, -14, -14, -20, -20, 6, -6, -12, -7, -2, 5, 6, 15, 26, 41, 43, 37, 26, 18, 4, 5, 33, 12, -3, 12, -4, 13, -21, -15, -8, 0, -15, -10, 4, -21, 8, 17, 5, 7, 28, 35, 31, 33, 23, 7, 11, 19, 28, 1, 20, 3, 10, -29, -13, -6, -25, 5, -9, -8, -5, -12, 5, 0, -4, -2, 0, -6, 17, 3, 1, -7, -9, 15, 3, 12, 5, 3, 1, 11, 3, -23, -29, -31, -27, 2, -17, -12, 2, -13, -15, 1, 2, -11, -6, 0, -9, 1, -4, 13, 16, 18, 7, -4, 13, 10, 18, -8, 6, -7, -35, -52, -36, -9, -16, -13, -17, 7, -1, -6, -6, -21, 6, 0, 12, -4, 5, 20, 28, 30, 25, 13, 0, 7, 1, -22, -20, -15, -40, -52, -33, -4, -25, -8, -15, 4, 5, 2, -3, -5, 8, 23, -2, 4, 19, 6, 0, 7, 5, -5, -7, -3, -29, -16, 9, -7, -20, -31, -28, -30, 1, 0, -9, -4, -23, 4, 4, 5, 12, 16, -2, -9, 10, 4, 11, -10, 16, 10, -12, -11, -13, 2, -12, -13, 0, -13, -41, -2, -15, -1, -7, -23, -23, 1, 9, 10, 9, -1, 16, 1, -25, -30, -33, -15, 17, -20, -43, -41, -13, 5, 2, 6, -3, 26, -27, -30, -16, -21, -8, -25, -4, 5, 4, 14, 3, -17, -16, -16, -18, -34, -7, 3, 2, -7, -6, 19, 19, 21, 17, 26, 11, 25, 11, 6, -11, -9, 8, -18, -19, -8, 22, 7, -15, 3, -11, 4, -14, -28, -43, 10, 38, 0, 2, 40, 12, 25, 0, 5, 32, 12, 19, 5, -9, -14, 5, -13, -19, -12, -19, -3, -8, 6, 3, -11, -25, -18, -27, 28, 31, 11, 42, 27, 9, -16, -4, -24, 16, 10, 18, 0, -1, -14, -2, -22, 8, 4, -31, -20, 10, 0, -9, -10, -20, -34, -7, 37, 24, 23, 26, 5, -26, -11, -7, -2, -4, 4, -22, -8, -23, -3, -26, -1, 4, -17, -16, -7, 9, 5, -4, -5, -32, 2, 1, 36, 20, 16, -7, -11, -19, 4, 3, -12, 4, -13, 6, 5, -1, -4, 6, 6, -19, -2, -12, 3, -8, -5, -5, 0, 9, 27, 9, 1, 9, -19, -15, -23, -16, 2, -8, 7, 7, 3, -10, 12, 2, 1, 2, -12, -4, -3, -17, 7, 9, -9, 11, -10, 6, 2, 15, -2, -2, -9, -17, -23, -1, -10, -5, -7, 17, 3, -1, -6, -20, -13, -26, -15, 6, 2, 3, 11, 23, 18, -3, -13, -8, 14, -16, -15, -16, -6, -11, -8, 1, 20, 3, -8, 3, 19, 9, -7, -13, -9, 7, -1, -24, 2, -4, 20, 17, 18, 12, -8, 3, 7, 9, -15, -1, 2, 12, 7, 6, 25, 11, 0, 24, 40, 5, -10, -3, -1, -3, 0, -10, 3, 11, 13, 33, 25, 2, 8, 18, -8, -2, 8, -1, 2, -1, 11, -4, 11, 21, 0, 23, -4, -5, -7, 8, -24, -10, -7, -10, -13, 1, 2, 3, 40, 4, 14, 0, 12, -3, 18, 24, -2, 6, 23, 16, 29, 27, -19, -1, 10, 12, -4, -11, 6, 7, -14, -21, -12, -10, -11, 1, -4, 0, 11, 11, -6, 4, 15, -7, -12, 12, 17, 7, -11, 12, 1, -9, 5, 0, 8, -7, -23, -15, -23, 7, 13, 8, -20, -18, -15, 10, -31, -33, 3, -10, -23, -10, 0, -10, -12, 9, 16, 0, -19, 15, 12, -5, -12, -1, 7, -4, 3, -14, -2, -14, -27, -9, 2, -7, -4, -6, -22, 7, -19, 0, 8, 36, 23, 9, 8, 10, -17, -17, 14, 1, -5, -3, 6, -15, -12, 8, 0, -7, 10, 4, 15, 24, 34, 17, 33, 43, 19, 16, 15, 36, 25, 32, 27, 3, -3, 2, 6, 7, 3, -9, 7, -10, -9, -22, -4, -15, -17, -18, -4, -1, 16, 11, 24, 40, 46, 51, 8, 14, 35, 38, 5, 3, 5, -18, -23, -16, 7, -20, -12, -22, -2, -22, -24, 6, 3, 7, -19, 8, -11, -7, 9, 2, 7, -15, 10, -18, 0, 6, -13, -1, -17, -8, -19, 3, -9, -8, -19, -7, 1, -16, 8, 3, -1, 9, 1, 3, -10, -7, 14, -11, -17, 9, 10, 11, -9, 7, 0, -13, 5, 14, -1, 3, 1, 11, 15, -4, 2, 15, -3, 10, -16, 9, -20, 2, -13, 10, 15, -1, 10, -10, 1, 14, -13, 5, -13, 14, 0, -14, -13, -13, -8, -3, -15, 10, -4, 8, 16, 1, 15, -12, -21, 0, -11, -17, -9, -16, -12, 1, -11, -25, -24, -7, -13, 2, 5, 1, -15, 11, 9, -7, -8, 0, 6, -16, -10, -11, 10, -18, -21, -15, -21, -23, -13, -49, -46, -32, -16, 0, 3, -3, 1, -10, -11, 6, -3, -18, -7, -2, 15, -16, 7, 12, -12, 10, -16, -15, 9, -15, -13, 7, -21, -32, -8, -24, -37, -10, 2, 8, 15, 23, 12, 13, -7, -8, -2, 16, 17, -10, -15, 10, -14, 8, -4, 26, 28, 5, 15, 16, -12, -28, -6, -15, -17, -29, 5, 9, 49, 36, 27, 15, 3, -12, 8, -17, 11, -8, -3, -15, -1, -10, 10, 17, 6, 0, 20, 2, 19, 36, 24, -11, -67, -84, -69, -2, 23, 44, 33, 40, 30, 2, -27, -5, 11, -17, 11, -15, 2, 18, 9, 14, -6, 15, -2, -6, 40, 45, 23, -19, -27, -82, -57, -2, 32, 31, 41, 38, 22, 11, 1, 5, -5, -13, 5, 18, 1, 19, -4, 4, -6, 10, 14, 8, 19, 51, 31, -3, -49, -49, -30, 21, 44, 29, -7, 6, 31, 1, -24, -2, -17, 17, 16, -1, 6, -7, -17, -1, -24, -4, -9, 20, 6, 13, 3, -43, -55, -78, 2, 40, 27, 28, 23, 33, 19, -15, -34, -4, 8, -11, 17, -7, -9, -24, -2, -25, -32, -29, 1, 11, 1, 13, 10, -45, -89, -57, 53, 45, 38, 14, 29, 1, 4, -20, -39, -6, 6, 0, -4, -16, 12, -31, -10, -24, -7, -21, -10, 9, 8, 30, -11, -59, -83, -41, 37, 27, 31, -5, 7, -13, -20, -3, -16, -7, -8, 9, -2, 8, -13, -21, -38, -2, -5, -16, -20, 11, 29, 27, -7, -59, -59, -16, 18, 23, 7, -6, 4, 19, -10, 7, -8, 2, -8, 14, 7, 7, 6, -22, -36, -13, -7, 9, -1, 29, 26, 12, -18, -55, -45, -1, 20, 29, 4, -8, -15, -6, -17, 26, 7, 3, 4, 12, -16, 0, -12, -5, -10, 15, 11, 25, 1, 10, 24, 3, -38, -46, -16, -1, 34, 7, -1, 12, -6, 5, -12, 10, 0, 9, 7, -13, 8, 11, 9, 2, -8, 20, 30, 22, 2, 0, 11, -15, -35, -34, -6, 21, 4, 13, 30, 9, 11, 18, 5, -16, -11, -2, 1, -16, 6, -9, 4, 14, 1, 16, 12, 32, 8, -15, -16, -10, -16, 12, -1, 19, 32, 25, 12, 13, 18, 11, 16, 8, 17, 18, -10, 9, 11, 15, -7, 27, 26, 32, 20, 32, -4, -24, -31, -19, -3, -3, 18, 11, 7, 2, 10, 2, 10, 0, 15, 6, 17, 4, -6, -9, -15, 12, 1, 6, 25, 16, 18, 3, -26, -39, -28, -2, 6, 14, 1, 10, -22, -6, -23, -30, 11, -3, -1, 15, -11, 16, -6, 14, 12, -5, 12, 8, 24, 36, 17, 5, 6, -14, 4, -12, 10, 2, -13, -15, -14, -21, -31, -7, 12, 31, 0, -1, -19, 18, 10, 17, -14, -14, 4, 7, 16, 21, 20, -3, -8, -7, -3, 16, 8, 2, -14, 8, -11, -10, -4, 8, 19, 3, -18, -13, 4, 14, 16, -1, -10, 0, 18, 8, 3, 14, 10, 22, 1, 20, 7, 12, 10, 2, -4, -23, -17, -27, -7, 4, 1, 14, 3, -26, -5, -1, 15, -14, -4, 1, -6, 1, 37, 47, 14, 21, 35, 4, 5, 26, -7, -12, -5, -12, -27, -13, 17, 11, 2, 4, -6, 12, 13, 2, -11, 5, 15, 4, 1, -8, -15, 10, 25, 27, 24, 9, 7, 1, 4, 4, -10, -6, 10, -14, -11, -18, 7, -24, -16, 11, -9, -15, -7, 1, -3, 13, 3, -5, -27, 7, -7, -1, -13, 10, 20, 12, 16, 6, -3, 5, -8, -13, -33, -30, -17, -19, -4, 2, -7, 12, -13, 16, 4, -12, -4, -14, -4, -18, -39, -20, -27, -19, -19, 8, 10, 0, 0, 23, -4, -40, -41, -19, -25, -23, 9, -18, -10, 14, -4, 1, 16, -1, -11, -5, 6, -1, 1, -16, -15, -26, -47, -21, -31, -12, -9, -17, -23, -25, -25, 0, -9, 1, -6, -9, -1, 15, -9, 9, -8, -15, 0, 8, 12, -17, -1, 12, -16, 2, 5, -14, -10, 13, -18, 12, -4, -12, -11, -18, -1, 10, 11, 12, 12, 2, -2, 2, 13, 4, -10, 2, 6, -4, -3, 14, 0, 7, 9, 12, -5, 12, -1, -8, -7, 11, 9, -1, 10, 3, 18, -1, 6, 8, -12, 1, -4, -10, 9, 11, -9, -9, 4, 14, -12, 10, -3, 4, 2, -9, 19, 8, 7, -5, 12, 0, 2, -5, 9, -7, 1, 5, 3, 11, 22, 16, -13, 2, -4, -10, 12, -13, 11, -15, -2, 9, 1, -12, -9, -5, 17, -14, 5, 5, -9, -7, -13, -5, 16, 0, 4, 12, 8, -4, 16, -4, 5, 7, -9, 2, -5, -3, 3, -17, -7, -26, -32, -20, -1, -16, 10, 13, 3, 10, 20, 0, 20, -6, 10, -7, -1, 11, 1, 6, 13, -12, -5, -1, 5, -9, -18, -16, -21, -26, -20, -19, -26, -19, -10, 9, -11, 18, 8, -2, 0, 4, 14, 15, 15, -4, 6, 6, 5, 7, -4, 12, 0, -24, 3, -6, -23, -23, -22, -22, -10, 0, -10, -6, -7, 9, 3, 1, 15, 17, 13, 4, 9, 17, 9, 4, 20, -3, -13, -7, -8, -3, 10, 4, -14, -10, -6, -2, -25, -21, -3, -4, 4, 16, 11, -10, -8, -7, 12, 10, 6, -3, 8, 9, 4, 9, -7, 5, -5, -5, -21, 8, 2, 1, -2, -34, -13, -19, 5, -4, 8, -10, 11, 5, -15, 9, -12, 11, -5, -7, -1, 12, -7, -1, 10, 0, 4, 11, -15, -6, -11, 0, -27, -22, -28, -12, 20, 3, -7, 5, -18, -2, 2, 18, 21, -10, 8, 12, 12, 17, -7, -24, 14, 13, 10, -10, -19, -26, 4, -20, -20, 4, 6, 14, 10, -1, 14, -14, -29, -27, -12, -8, 16, 15, 2, -2, 1, -7, -17, -8, -1, -7, -3, 9, 11, -27, -7, -28, -14, -10, -3, 5, 2, 1, 5, -29, -33, -41, -27, -5, 14, 6, -7, 7, 8, -12, -24, -3, -8, 23, 27, 17, -2, -2, -6, 0, 0, 11, 6, -2, -10, -15, 2, -3, -8, -27, -35, 16, 20, 0, -11, -5, 16, -7, 6, 4, 3, 4, 19, 22, 15, 5, 2, 3, 19, 6, 17, 28, -4, 7, 12, -10, -24, -19, -18, -16, 2, 20, -12, -8, 21, 2, -12, -5, 14, 4, 8, 0, -24, -17, 5, 10, 31, 18, 28, 16, 24, 7, -12, -15, -16, -12, -21, 8, -3, -3, -1, -8, 16, -1, 5, 9, -4, 5, -1, -5, -22, 11, 30, 11, 14, 31, 30, -4, 19, -8, 5, -12, -30, -1, -10, -15, 11, -7, -3, -6, 3, -4, -7, -25, -7, -29, -18, -42, -9, 21, 34, 8, 37, 41, 26, 7, -22, -12, -9, -1, -12, -36, -7, -10, -6, 8, 0, 8, 4, 5, -2, -36, -10, -8, -26, -44, 3, 1, 34, 13, 34, 7, -16, -29, -7, -19, -3, -27, -31, -34, -21, -4, -10, 18, 13, 12, 9, -27, -25, -21, -36, -45, -32, -10, -1, 5, 2, 19, 23, 8, -3, -28, -11, -28, -27, -35, -22, -19, 3, -12, 9, 15, 18, 7, 0, -25, -15, -41, -12, -31, -16, -23, 3, 12, 22, 6, 4, -6, -13, -19, -9, -22, -2, -38, -16, -17, -9, 18, 13, 7, 9, -3, -2, -2, -36, -9, -8, -6, -12, -30, -15, 6, 7, 27, -4, 5, 1, -3, -22, -11, -18, -6, -38, -26, -4, -8, 4, -5, 21, 8, 1, -22, -7, -32, -14, -18, -1, -11, -32, 3, 7, 17, 24, -7, 4, -11, 3, -3, -26, -7, -5, -6, -19, -2, -1, 15, 14, -9, -12, 2, -9, -15, -17, -14, -24, 1, -10, -6, -10, 23, 24, -10, -5, -7, -1, -23, -16, -2, -3, -9, -4, -10, -5, 14, -2, 1, -3, 10, 19, 7, 14, -7, 6, -20, -27, -16, -8, 17, 5, 17, -6, -19, -15, -19, -13, -7, -18, -10, 16, 4, 8, -5, 16, 16, 8, -11, 7, 22, -11, 7, 8, -13, -14, 12, 4, 27, 21, -4, 15, 10, 1, 11, -9, 5, -20, 6, 12, 17, -3, 15, -9, -9, 6, 5, 8, 7, -1, -1, 3, 5, 16, -12, -12, 4, 25, 13, -1, 14, 21, -10, -12, 15, -5, 0, 0, -5, 14, 10, 15, -5, 1, -12, 13, 6, -9, 7, -24, 2, 6, -3, 6, 4, -1, -8, -24, 6, 3, -18, -6, 9, -4, 20, 19, 14, 11, -11, -3, 10, 8, 8, -11, -7, -9, -5, -12, -2, -19, -28, -18, -10, 7, 2, -7, 0, 2, 4, -5, 8, -13, 1, 3, -10, -9, 16, -4, 21, 0, -11, 2, 19, 21, 5, 6, 21, 8, 19, 16, 17, 4, -4, 2, -10, -11, 7, 1, 4, -8, 2, -12, -4, 7, 8, 19, -7, 1, 19, 16, -1, 17, -10, 0, 0, 22, 7, 11, -11, 11, 15, -6, -1, 13, -11, 9, 18, -4, -5, 10, 16, -5, -8, -3, 13, 22, -3, -5, 15, 20, 19, 14, 14, -4, 1, 10, 12, -5, 21, 14, 8, -13, -10, 16, 13, 17, 9, 21, -5, 5, -1, -9, 17, 3, -4, -12, -9, -12, 9, 6, 16, 14, -5, 0, 3, 11, -6, 5, 7, -12, -19, -2, 8, 3, 15, 14, -6, 14, 7, 6, 17, -1, 3, 2, 21, 2, 0, -16, -2, 7, 9, 22, 0, -11, 8, -19, -7, -16, 15, 11, 10, -3, -8, 14, -8, -6, 9, 22, -2, 22, -11, 19, 2, 15, -16, -6, -38, -11, -9, 14, 23, 1, -2, 0, 0, 23, -6, -10, 1, 4, -19, 2, -3, 5, 2, 11, 20, 5, 12, -4, 2, -7, 10, 7, 9, 0, -7, 12, 37, 33, 14, -7, 4, -25, -13, 12, 8, 5, -1, 8, -15, 3, 13, -4, -3, -9, -4, -2, 29, 30, 23, 6, 5, 29, -1, 13, 46, 8, 5, -2, 3, 12, -9, -2, 2, -14, -6, -7, 10, -8, -6, 12, 11, -1, -17, 6, 11, 21, 2, 18, 25, 4, 17, 12, 29, 26, 27, 38, 8, 10, 10, 7, -19, -9, -36, -10, 12, 19, 3, 19, 12, 22, -24, 6, 12, 15, 21, 21, 9, 7, -11, -9, 45, 46, 13, 24, 29, -5, -4, -11, -23, -15, -14, -17, -7, 5, 13, -5, 12, -14, -6, 1, 8, 0, 27, 15, -22, -6, -4, 2, 31, 38, 32, 11, 23, -2, 1, -40, -23, -40, -9, -12, -9, 19, 17, -9, -9, 17, -22, -20, -14, -17, -24, -20, -33, -30, -28, -6, 22, 37, 10, 36, 8, -4, -11, -26, -20, -28, -26, -16, -15, -11, 12, 12, 21, -7, -25, -42, -16, -27, -5, -14, -36, -16, -34, -7, 19, 38, 8, 20, 30, -12, -40, -53, -46, -33, -29, 8, -6, -4, 11, 15, 6, 1, 3, -29, -34, -25, -21, -27, -22, -40, -25, -29, -10, -2, 7, 2, -3, -13, -37, -41, -31, -37, -1, 7, 20, -10, -8, 20, 22, 14, -17, -12, -28, -19, -6, -21, -24, -37, -36, -38, -23, -4, 33, 35, -7, -22, -66, -27, -30, -21, 6, 18, 16, -3, 16, -10, 6, 5, -3, -12, -32, -16, -5, -15, -27, -4, -14, -12, 0, 19, 25, 28, 15, -10, -27, -36, 5, -6, -2, -3, -8, 10, 11, 10, -8, 16, -8, 0, -18, 4, -8, -11, -2, -20, -17, 0, 2, 14, 12, 34, -3, -48, -23, -2, -9, -12, 3, -2, 20, 8, -11, 4, -6, 10, -14, 1, 9, 14, 14, -2, 6, -10, 6, -14, 24, 28, 39, 16, -37, -47, -36, -5, -12, -25, 15, 4, 20, 8, -9, 18, -10, 10, 12, -15, 0, 20, 22, -5, -2, -7, 12, 13, 14, 40, 7, -22, -21, -47, 9, -16, 14, 19, 19, 19, -1, 22, -7, 4, -4, -10, 0, -1, -14, 7, 7, 32, 0, 23, 6, 30, 46, 21, -2, -30, -9, 3, 4, 7, 21, 16, 16, 23, -3, 12, 19, 18, 23, 15, -3, -3, -11, 4, 14, 18, 23, 29, 33, 38, 40, 8, -9, -28, -26, -3, 23, 29, 29, 23, 36, 25, 20, -7, 21, 6, -4, 5, 22, 8, 4, -10, -6, 18, 15, 24, 28, 31, 36, -14, -36, -16, -30, -8, 5, 9, 0, 2, 31, 20, -5, -9, 18, 16, 12, 6, 8, 24, 11, -19, -6, 5, 16, 17, 28, -1, 26, -7, -10, -40, -27, -12, 10, 10, 13, 3, 27, -5, -9, -6, 9, -1, -10, 4, 19, 36, 8, 17, 11, 20, 10, -3, -13, 9, -9, 0, -9, -22, -19, -9, 5, -4, 16, 16, 1, 25, 2, 16, 0, 7, 0, 8, -11, 14, 31, 24, -9, -17, 7, -7, -18, -3, -6, -22, -15, -47, -57, -58, -39, -4, -7, -12, -4, 2, 0, 8, 18, 19, 2, 3, 9, 36, 12, 9, -16, -12, -25, -32, -17, -3, -29, -20, -48, -30, -32, -29, -10, -12, -12, -12, -9, -6, 7, 21, 21, -8, 12, 1, 8, 24, -3, -15, 7, 28, -24, -5, 11, 7, -24, -10, -43, -17, -35, -26, -16, 4, 18, -1, -11, 13, -1, 15, 1, -3, 14, 6, 7, -4, -11, 20, 24, 17, 5, 14, 2, 22, 16, 23, -3, 8, 7, -3, 7, 5, 17, 18, 22, -5, 8, 2, 15, 4, -3, -10, 12, 5, -7, 4, 4, -6, 24, 12, 17, 0, -1, 11, -4, 10, -5, 7, -6, 0, -8, 9, 6, 20, 0, -6, -11, 0, -18, 11, -3, 10, 10, 12, 10, -3, 8, -12, -6, -6, 12, -3, -12, -5, -1, 11, -20, 11, -16, 10, -10, -4, 9, 1, -4, -5, -5, -19, -7, 3, 3, -9, -15, 2, -22, -12, 0, -11, -10, -1, -1, -6, -2, -7, 5, -9, -6, -9, 9, -7, -21, 6, 5, -4, -2, 9, -16, 9, 6, -13, 4, 4, 3, -13, -12, -3, -10, 13, 9, 20, 10, -2, 1, -5, -8, -7, 5, 3, 8, -20, 2, 4, -1, -10, -11, -20, -5, -23, -20, -17, 1, -2, 7, -26, -11, 15, 27, 39, 40, 27, 29, -4, -15, -18, 5, -8, -18, -7, -1, 0, -6, -20, -9, 4, -22, -20, -12, -30, -25, -27, -5, 8, 23, 17, 8, -2, 15, 32, 8, 20, 4, 11, 18, -8, 2, -17, 3, -1, 0, -1, 3, -2, -28, -36, -46, -26, -24, -28, -10, -4, -18, -17, -33, 3, -13, 20, 6, 7, 15, 13, 7, 7, -5, -11, 1, -1, 9, -5, 5, -24, -44, -43, -49, -54, -22, -13, -8, 5, -17, -18, -25, -12, 16, 21, 45, 19, 9, 8, 27, 16, -19, -18, 2, -1, -2, 12, 0, -38, -23, -34, -39, -29, 1, -11, 13, 6, -6, 5, 2, 15, 24, 31, 37, 4, 13, 29, 14, -20, 0, -20, -12, -9, 0, -4, -5, -22, -42, -36, -24, -38, -21, -15, 0, -6, 26, 26, 13, 45, 26, 6, 19, 34, 29, 10, 9, -13, -4, -3, 12, -1, 6, 7, -23, -12, -29, -36, -34, -48, -11, -9, 2, 8, 27, 22, 27, 30, 24, 25, 25, 25, 30, 35, 37, 37, 9, -17, -7, 10, 0, 0, -4, -31, -18, -45, -44, -67, -30, -39, -3, 20, 20, 40, 38, 16, -2, 20, 19, 35, 34, 27, 42, 16, 0, 8, -10, -4, 11, -2, 27, -14, -35, -22, -60, -31, -18, -25, -17, 22, 22, 20, 13, 18, 18, 4, 15, -2, 18, 5, 22, 0, -3, 11, 12, -7, 16, -2, 2, -16, -41, -28, -49, -19, -24, -22, -23, 27, 27, 34, -1, -6, 16, -41, -29, -48, -21, -38, -33, 16, 9, -13, 0, 0, -12, 12, -6, -20, -39, -45, -26, -22, -14, -34, -46, 5, 3, 2, -23, -18, -19, -39, -20, -61, -63, -33, -29, -27, -15, -6, 5, -7, -18, 15, 18, -21, -6, -33, -7, -16, -6, -39, -8, -5, 3, -9, -26, -26, 7, -8, -21, -35, -63, -70, -40, -26, -25, -14, 8, -20, -7, 4, 11, 16, 20, 6, -18, -39, -10, -32, -9, 3, 4, -2, -15, -8, 9, -4, -7, -50, -68, -46, -35, -25, 4, -8, -20, 8, 5, -19, 25, 4, 1, -15, -28, -31, -37, -9, -13, 11, -7, 0, -20, -4, 29, 4, -3, -98, -80, -85, -55, -13, -1, 6, -18, 10, -19, -7, 13, 30, 9, -4, -9, -19, -16, -22, -11, -5, 14, 26, 12, 24, 50, 24, -25, -94, -89, -66, -22, -20, -3, 6, 13, -4, -17, -15, -3, 9, 18, 18, 0, -15, -13, -12, 1, 4, 15, 16, 41, 49, 28, 11, -50, -97, -91, -40, -16, -1, 8, 2, -17, -2, 5, -8, -12, 13, 20, 26, 14, 12, -9, -13, 21, 9, 20, 24, 16, 28, 38, -16, -60, -93, -88, -41, -34, -1, -7, 8, 9, 6, -10, -21, -7, 24, 7, 27, 33, 12, -9, -14, 9, 19, 19, 14, 16, 19, 2, -46, -101, -82, -66, -35, -3, 3, -7, -8, -2, -9, -6, -6, -14, 20, 30, 24, -1, 1, 10, 14, 1, 26, 3, 12, -16, 6, -35, -77, -83, -72, -60, -18, -1, -19, -5, -13, 5, 3, 0, -26, -6, 4, 18, 8, 2, -2, -7, 11, 13, 0, 4, -2, -1, -27, -82, -77, -66, -56, -35, -1, 0, 4, -10, -9, -2, 8, 10, 10, 10, -1, 13, 0, -7, 7, 9, 10, -3, -4, -6, -20, -43, -73, -88, -58, -41, -25, -18, -28, -20, -8, 5, 5, -17, 3, 4, -2, 23, 18, 6, 15, 5, 14, -1, 17, 21, 38, 1, -23, -28, -42, -60, -57, -31, -44, -37, -19, -4, 5, -7, -10, 4, -2, -17, 14, 13, -14, 19, 20, 45, 51, 29, 31, 46, 15, -22, -3, 15, 13, 16, 5, -13, -22, 8, -24, 3, 3, -12, -16, 2, 12, 4, -16, -4, -7, -5, -1, -1, -3, 13, 5, -1, 3, 23, 34, 19, 38, 24, 11, -6, 4, 3, -15, -18, -3, -1, 7, 5, 9, -3, -8, 2, -5, 1, 7, -19, 3, 2, -4, -19, 12, -15, 12, 16, 6, 7, -7, -3, 8, -12, 7, 2, -20, -13, 11, 6, 6, 6, 1, -13, 0, -23, 6, 1, -21, -18, 7, -14, -19, 1, -11, -21, -16, -3, 4, -18, 5, 2, -16, 3, -10, -5, -15, -16, -14, 7, -7, 6, -24, -13, -21, -21, -17, -18, -4, -15, 7, -7, -5, 0, -9, -8, -10, -22, 0, -11, -19, -10, -23, -10, 0, 5, 0, -1, 4, -12, -20, 8, -10, 9, -10, 10, -11, -5, 16, 1, 20, 0, 19, 16, -2, -12, -19, -20, 8, 0, 4, -15, -12, -14, -3, 3, -14, 0, 6, -23, -8, -6, 13, -3, -8, 0, 38, -3, 35, 15, 15, 2, 9, 8, -3, -10, -15, -7, -5, -19, -9, -21, -1, -8, -6, 2, -7, -17, -6, 8, -5, 26, 7, 25, -3, 9, 3, 17, 33, 12, 38, 20, 3, 19, 10, -5, 9, -8, 4, -14, -18, -21, -3, -22, -14, -12, -21, -22, -18, -8, -10, -7, -10, -16, 15, -6, 3, 17, 36, 47, 43, 15, 15, 6, 14, -18, -13, -2, -16, 6, -16, -22, -32, -36, -40, -36, -28, -19, -36, -12, -8, -17, 1, 3, 1, -3, 10, 16, 20, 15, 24, 15, -5, 4, -16, -10, 9, 6, -17, -33, -50, -46, -45, -11, -16, -32, -17, -10, -19, -2, -3, -19, -36, -9, -1, -6, -7, 14, 3, 23, 7, -18, -6, -19, -19, -26, -26, -22, -54, -25, -12, -11, -10, 0, -7, 20, -1, 1, -4, 7, 3, -2, 2, -2, 1, 20, 31, 19, 26, 9, 1, -5, -17, -12, -25, -18, -40, -6, -17, -5, -5, -11, -3, 19, 2, 0, 8, -11, 0, -30, -14, -22, -3, -9, 17, 26, 35, 6, -2, -6, -11, -9, 2, -9, -17, -13, -2, -5, 2, 6, 18, 3, 10, 4, 14, -28, -20, -33, -23, -3, -11, 3, 11, 33, 28, -7, 6, -9, -24, -18, -12, -20, -3, 4, 12, -5, -12, -6, -22, -11, 21, 4, -11, -22, -32, -21, -12, -17, -13, -18, 26, 13, 22, -13, 3, 1, -11, 3, -23, -24, -1, 10, -5, -18, 3, -10, -22, 9, 26, 7, -1, -31, -3, -7, -23, 2, -10, -13, 4, 14, 10, -14, 8, 9, -15, -18, -13, -31, -9, 7, -8, -22, -18, -34, 11, 41, 26, 20, -11, -45, -28, -8, -15, -7, -38, -30, -15, 4, 5, 5, -4, -1, -22, -18, 8, -25, -8, -21, -13, -16, 8, -8, 10, 18, 21, 0, 8, -25, -25, -30, -28, -21, -31, -29, 4, -11, 4, -17, -20, -4, -22, -3, 4, -18, -20, -16, -16, -11, 0, -10, 21, 20, 34, 14, 9, -31, -22, -25, -19, -37, -29, -26, -10, 17, 11, -8, -6, -21, -2, -10, 14, -9, 2, -21, -9, -11, -15, 17, 35, 25, 1, 5, -1, -14, -6, -19, -18, -23, -15, -18, 9, 19, 16, -9, 5, 5, 0, -18, 5, 9, -9, 4, -13, -14, -19, 13, 4, -8, -8, 8, 1, -14, -11, -9, -18, -3, -17, -20, 3, -10, 2, 3, 1, -24, 4, 3, 9, 18, -1, 23, 5, -1, 15, -8, -3, 9, 2, -1, 0, -6, 0, 17, 8, 15, -9, 1, -6, 31, 18, -17, -11, -14, -13, -13, -4, -3, 18, 10, -1, -3, 2, 3, 4, 11, 14, -3, 18, 41, 40, 14, 36, 26, 27, 29, 23, -4, -3, -10, -12, 4, -23, 11, -13, 2, 27, 16, 8, 19, 28, 17, 24, 29, 12, 26, 44, 14, 41, 56, 23, 31, 37, 47, 23, 10, -15, -3, -24, -21, -22, -11, 0, 17, 21, 21, 42, 16, 22, 19, 14, 23, 38, 49, 42, 18, 33, 51, 27, 37, 19, 23, 15, 7, -4, -17, -17, -21, 9, -20, -11, 18, 24, 8, 11, 3, 23, 4, 4, 13, 15, 3, 12, 2, 31, 37, 12, 4, -2, -8, 13, -3, -11, 9, -18, -24, -8, -7, -19, -5, -9, -24, -33, 12, 23, 5, -12, -7, 14, 9, 2, 19, -15, 9, -5, -23, -7, -16, -6, -21, -9, -9, -23, -2, 5, 6, -11, -2, -41, -33, -31, -24, 4, -5, -24, -14, -10, -19, -20, -10, -10, -14, 5, -21, -26, -4, -17, 4, 9, 2, 0, -22, 4, -17, -7, -34, -43, -12, -19, -30, -21, -18, -13, -17, -24, -31, -23, -20, -27, -14, -15, -31, -2, 8, -9, -15, -11, 3, -23, -4, -18, -25, -5, -5, -17, -10, -19, -20, -30, -17, -9, -4, -35, -26, -26, -16, -31, -33, -9, -11, -21, -3, 6, -10, -8, 7, 7, -1, 6, 1, -15, -10, 2, 6, -14, 0, -20, -19, -19, -10, -22, -10, 0, -12, -2, -14, -13, -15, 1, -18, -23, 9, -13, -21, -24, -13, -7, -12, 2, -15, 8, -3, 9, -9, -2, -11, -3, -17, 2, 9, -2, -7, 16, -14, 10, -1, 14, -14, 9, -6, -14, 16, -9, 15, -15, -12, -6, -12, 16, -12, 11, -14, 12, -5, 9, -9, -4, 15, -7, 9, -9, 11, -14, 17, 8, -14, 12, -4, 4, -9, -1, -10, -7, 0, -11, -3, -15, -14, -15, 7, 5, 21, 17, 2, 26, -1, 0, 5, 10, 4, 10, 10, -10, 5, 18, 6, -5, 6, -17, -7, -6, -16, -13, -12, 10, -15, 12, -20, 7, -1, -3, 2, 17, 25, 27, 3, 22, 38, 37, 19, 11, 18, -5, -8, -15, -10, -4, 7, -11, -11, -4, -3, 7, -16, -6, -44, -11, -30, -7, -5, -13, -7, 3, 7, 27, 32, 28, 39, 33, 1, 29, 7, -12, 16, 9, 7, 0, -3, -2, 3, -41, -21, -45, -34, -8, -6, 0, -13, 22, 3, 23, 32, 44, 59, 33, 47, 38, 28, 32, -5, -12, -14, -6, 4, -15, 7, -22, -20, -44, -39, -34, -20, -24, 0, -6, -5, 26, 47, 36, 60, 57, 38, 65, 47, 52, 25, 33, 38, 14, 4, -7, 0, 4, -2, -25, -42, -16, -31, -9, 9, -10, -3, 25, 0, 38, 38, 58, 42, 12, 34, 34, 6, 11, 13, -9, -7, 9, -3, 10, -1, 14, 14, -19, -15, -12, -34, -29, 9, 11, 8, 21, 26, 7, 0, 16, 2, -12, -40, -40, -33, -41, -28, -42, -33, 3, 2, 12, -13, -15, -11, -12, -13, -7, -21, -21, 8, 2, 30, 19, 14, 4, -45, -72, -83, -76, -80, -68, -77, -64, -81, -47, -39, 1, -17, 13, 10, -6, -7, -21, -16, -23, -7, -5, 3, -6, 17, -9, -10, -38, -72, -86, -75, -65, -83, -77, -79, -83, -97, -55, -42, 0, -18, 11, 0, 10, -8, -3, -21, 8, 14, 8, 3, -9, -15, 5, -26, -37, -53, -49, -33, -39, -12, -32, -67, -52, -73, -30, -29, -16, -12, -5, 1, -14, 11, 13, -17, -23, -10, -1, -4, -13, -26, -16, -3, -10, -47, -20, -26, 12, 10, -4, -13, -51, -55, -25, -25, -3, -16, 15, -17, 8, 15, 5, -5, -14, -17, -9, -19, -15, -11, 16, 2, -21, -16, -7, -28, 11, -5, 27, -4, -33, -24, -10, 3, 13, 18, -14, -1, 10, 16, 10, -25, -31, -4, 5, -22, -23, 22, 19, 1, 11, 5, 7, -4, -15, 0, 7, 7, -12, -11, -2, 5, 22, -12, 1, -12, 5, -20, -13, -20, -3, 0, 29, 17, -13, -2, 17, 4, 19, -6, 3, 2, -16, 11, 1, -10, -2, -35, -8, 44, 27, 14, -16, -14, 2, -16, 2, -24, 3, -3, -11, 10, -22, 3, 37, 34, 11, -9, -15, -21, -8, -17, -2, 4, -2, -15, 13, 25, 34, 19, -8, -8, -3, -6, -12, 10, 10, 13, -19, -8, -21, 42, 31, 34, -13, 2, -1, -13, -10, -11, -16, -15, 7, 0, -3, 7, 11, 2, 7, -8, 7, 9, -23, 16, 7, 9, 6, -21, -21, 8, 14, 19, -8, -10, -19, -5, -25, -36, -6, -19, -22, -5, -25, 16, 28, -11, 17, 5, 15, 8, 8, 6, 3, 14, -11, -13, -20, 18, 41, 16, -9, -12, -14, -25, -9, -21, -16, 7, -19, -14, -24, 1, -1, -4, -17, 16, -17, 12, 0, 22, 15, 11, 4, -1, 12, 20, 40, 47, 7, 27, 14, -8, -17, 9, 5, 11, 20, 14, 22, 23, 16, 8, -18, 7, 11, 12, 17, 0, 17, 0, 6, -9, 29, 31, 21, 29, 14, 14, -2, 14, 7, 12, 31, 33, 42, 40, 27, 37, 20, -15, 1, -8, -2, 13, 13, 0, -2, -9, 8, 6, -8, 12, 21, 9, 8, 12, 18, 11, 3, -3, 16, 13, 9, 21, 18, -2, 13, -15, 15, 9, -12, -8, -4, 7, 13, -14, -34, -6, -5, 1, 1, 14, -8, 19, 18, 20, -5, 21, 31, 10, 6, 7, 14, 22, 18, 1, -15, -16, -16, -9, 5, -7, 13, -7, -20, -28, -20, -36, -27, 2, 0, 10, 12, 15, 10, 23, 35, 15, 7, -2, 4, 15, -1, 15, -10, -10, 2, 7, 1, 13, -9, 5, -12, -2, 1, -24, -13, -15, 2, 2, 21, 30, 25, 29, 27, 20, 14, 6, -4, 5, -9, 15, -5, -8, -6, -9, -3, 11, -12, 6, 3, -10, 15, -10, -12, 0, 25, 9, 6, -9, -7, 23, 9, 25, -5, -14, -6, 0, 4, -10, -2, 5, 4, 11, -2, 15, -10, -15, -5, -2, -17, -7, 0, 16, -13, -8, 4, 16, 10, -13, 6, -8, 6, 6, -14, 12, 7, 1, -7, 1, -1, 11, -9, -16, 5, -19, 3, 9, 7, -17, 2, 2, 12, 10, 9, 2, 0, 2, 11, -9, -3, 1, 10, -20, 2, 14, -2, 9, -19, -13, 7, 8, -11, 4, 0, 9, -11, -9, -17, 11, 4, -10, -16, -9, 3, 2, -13, 6, -15, -5, 13, -10, -16, 8, -15, -4, -18, -17, 12, 2, 9, -7, -13, 14, -6, -8, -3, 18, -2, 6, 9, -13, -1, 20, 8, -14, 0, -3, -13, 14, 13, 9, -12, 13, 1, -18, 4, -6, 2, -12, -8, -3, -15, -14, 0, -14, -15, -7, 14, -7, 1, 5, 35, 21, 28, -4, -5, -1, 1, 8, 8, -4, 0, 7, -2, -17, -3, -7, -29, -23, -37, -29, -34, -18, -30, -22, -23, -39, -11, -2, 15, 3, 8, 30, 17, 6, 4, 1, 2, -11, 8, 4, -8, 10, 8, -26, -14, -18, -24, -11, -6, -20, -21, -8, -29, -40, -23, -21, -20, -21, -4, 17, 24, 8, 5, 3, -2, 12, 9, -16, 7, 10, 11, 2, -5, -4, -30, -1, -20, -16, -5, -1, -9, 5, -17, -20, -18, -10, -1, 31, 13, 11, 3, -7, -5, -17, 13, -17, 5, -23, 7, -27, -11, -13, -14, -13, 5, 17, -1, 9, 16, -6, 25, 8, 11, 10, 14, 2, 10, -5, -7, 5, -6, -5, -1, -17, -14, -5, -18, -10, -16, -4, 6, 11, 13, -17, -3, 0, -1, 8, 20, 20, -7, -1, 0, 7, -2, -4, -12, 5, 5, 9, -11, -10, 3, -14, -6, -5, -5, 14, 12, 19, 15, 2, 18, 13, 4, 4, -2, -2, 7, -17, -23, -12, -28, -16, -7, -18, 6, -5, 12, 4, -18, -19, -11, -24, 5, -14, 13, 13, 2, 15, -3, -19, -8, -4, 13, -6, -14, -6, -5, -7, -21, 0, -8, -11, -2, 1, 3, -5, 11, 1, -15, 11, -13, 3, -1, 6, 31, 27, -3, -13, 9, 9, -11, -7, 10, -12, -16, -23, -12, -8, -25, -7, 8, -12, 6, 5, 9, 7, -30, 16, 8, 10, 14, 6, 32, 25, 8, 7, -17, -18, 9, 14, -11, -20, -25, -11, -7, -18, -7, 8, -8, -19, 12, -12, 7, 14, 8, 16, 13, 9, 11, 11, 27, 6, -21, -9, -25, -9, 1, 4, 18, 9, 15, 5, -3, -24, -27, -10, 11, -11, -4, 1, 1, 7, 1, -8, 21, 16, 28, -2, 22, 4, -14, -24, 4, 10, 13, 16, 20, 35, 20, 20, -9, -19, -5, -2, -2, -9, 12, -8, 1, -6, 0, -3, 8, 20, 21, 4, 27, -8, -9, -39, -8, 14, 8, 17, 10, 5, 3, -3, -13, -30, -28, -9, -15, -17, -6, 2, 3, -23, 18, -12, 6, 23, 7, 21, -3, 2, -16, -11, -5, 9, 36, 17, 27, 25, 5, 12, -16, -41, -21, -24, 2, 1, -3, -7, -4, 5, -5, -6, 10, 21, -3, -2, -8, -3, -25, -16, -16, 27, 31, 41, 5, 12, 13, -24, -38, -15, -8, -1, 7, 12, 9, -2, -3, -13, -5, 18, 21, 9, -6, -11, -17, -9, -25, -15, 21, 24, 22, 32, 14, -10, -2, -7, -19, -35, -27, 1, 6, 14, -10, -7, -5, 3, 0, -13, -10, 12, -17, -12, -1, -3, -2, 20, 12, 8, 13, 17, -15, -15, -22, -23, -33, -20, -25, 2, -10, -5, -10, 6, -6, -19, 3, -41, -16, -8, -2, -6, -19, 15, 10, 1, -1, -4, -10, -22, -21, -18, -49, -35, -29, -22, -5, -4, -17, -3, -6, -6, -19, 3, 0, -33, -18, -8, -9, 9, 0, 9, 5, -4, -7, -3, -18, -26, -44, -34, -26, -3, -22, -5, -2, 12, 8, -15, -14, 9, 6, -28, -15, -47, -6, -11, -5, -2, 12, 18, -11, 6, -1, -25, -37, -30, -49, -36, -23, -1, -21, -16, -6, -12, -17, -8, -9, 13, 0, -18, -7, -5, 5, -3, 1, 8, 16, -6, -13, 5, -4, -30, -7, -19, -13, -25, -15, 8, 2, -12, -14, -15, -3, 10, 12, -18, 3, -7, 7, -6, 5, 19, 2, 8, 8, -13, 8, -18, -6, -4, 6, -23, -27, -6, -18, 10, -4, 1, -7, 2, 14, -2, 9, -3, 15, 2, 20, 8, 16, -14, 18, 17, 20, 16, 17, 20, 21, 1, 8, -4, 9, -6, 22, -1, -5, 9, -1, 11, 12, 10, -9, 5, -15, -4, 12, 16, -6, 15, 9, 7, 13, 33, 23, 34, 14, 29, 13, 23, -9, 12, 19, 5, 15, -9, -16, -6, 1, 3, 4, -7, -19, -15, 7, 0, 5, 8, 11, -6, -14, 15, -9, -8, 15, 0, -13, -10, 12, 3, 2, -15, -7, -17, -19, -2, 14, -2, 18, 13, 11, 10, 4, 0, -8, 15, 11, -10, 17, 1, -10, -12, -11, -10, -9, 14, 1, 15, -12, -12, -6, 0, 8, 21, -11, 15, 18, 14, 11, -11, -2, 14, 11, 20, -10, 0, 5, -11, 17, 11, 0, 15, 7, -7, 10, -10, -3, -2, 21, 10, -7, 6, -1, 1, 1, -9, 21, 19, 2, 4, 4, 11, 2, 14, -3, 4, -3, -7, 0, -13, -11, -8, 21, 12, 17, -3, 6, 11, -11, -10, 16, -13, 7, -10, -12, 13, -1, 5, 17, -9, 5, 18, -6, -7, 7, 9, 19, 4, 16, 9, -7, 2, 4, -1, -3, 8, 5, 5, 20, 13, 2, 7, 7, 0, -8, -12, 11, 10, 6, -10, 0, -5, 3, 8, 3, 13, -7, 9, 11, 8, -2, -11, 14, -13, -6, 15, 13, 9, 15, 10, -1, -6, 16, -9, -1, -13, 10, 14, 3, 20, -7, 5, 3, -8, -11, 2, -9, 8, 18, 20, 19, 8, 21, 17, -12, -12, 0, -1, 4, -1, 16, 3, 17, 3, 19, 7, 12, -7, 9, -5, 7, 14, 19, -3, -9, -1, 9, -11, 2, -8, 5, 4, -6, 7, -7, -1, 11, 4, 14, 14, -13, -11, -10, -4, -6, 6, 2, -2, 0, 3, -15, -20, -3, 15, 13, 6, 11, -8, 3, -13, -11, 14, 3, -10, 10, 6, 11, 8, -5, 13, -7, -15, -5, -14, -13, -9, 11, 0, -6, -21, -14, 13, -8, -11, 19, -1, 0, 0, 16, 16, 13, 16, -4, 18, 9, -8, -9, -1, -5, -7, 4, -16, 12, -19, -13, 8, -18, 0, -8, 5, 6, 0, -3, 21, 14, 11, -7, 20, -6, 21, -12, 10, -13, -20, -8, -2, 12, -7, -5, 4, 1, -3, -16, 11, -16, 13, -2, 13, -11, 6, -3, -1, -5, -12, -2, 15, -8, 7, 2, -10, 7, 8, -13, -5, 9, -16, -13, -21, -8, 3, 1, 1, 7, 9, -17, 6, -9, 13, 0, 5, 1, -12, 13, 10, -9, -12, 16, 9, 15, 9, 4, -5, 6, -8, -9, -7, -4, 19, -2, -20, 10, -4, -18, 6, 11, -6, -10, -13, 13, 14, 6, 20, -5, 12, -4, 9, 10, -20, 5, 11, -13, 1, -13, 4, -13, -11, 19, -16, 7, -2, 8, -1, -3, 19, 11, 18, -7, 18, 20, 2, -10, 10, 18, 19, -1, 11, 4, -12, -5, 8, -1, -13, -8, -4, -8, -11, -3, -1, -14, 14, 10, 17, -2, -4, 18, -7, 20, -3, -8, 18, 10, -11, -6, -10, 7, -16, -8, -5, 4, 0, -4, 15, 3, 1, -10, 9, -9, 2, -2, -9, 16, 0, -4, 12, 14, 3, 7, 12, -3, 19, -5, -9, -5, -7, 14, 7, -8, -1, -12, -16, -3, 7, 3, -9, -21, -7, -3, 14, -10, 10, -9, 20, 0, 12, 8, -13, 1, 3, 10, 14, 13, 7, 2, -9, 6, 1, -6, 5, -8, -6, -21, -6, -9, -7, 15, 16, -2, 13, 3, -9, -8, 6, 2, 6, 19, 7, 8, -3, -9, 0, 9, 19, 3, 6, 6, 7, -10, 6, 1, -2, 10, 18, 1, 12, 1, 14, 13, -5, 2, -6, 13, 12, 8, 4, 2, 3, 11, 19, -9, -5, 10, -3, -12, -14, 6, -1, -3, -12, 0, 3, 8, -12, 14, 10, 14, -5, -5, 10, -4, 21, 3, -2, -8, 10, -8, -12, -7, -5, 1, -8, -8, 10, -5, 11, 1, 0, -11, 3, 16, -10, -11, 9, 5, 13, 8, 13, -7, 5, -1, -8, 10, 16, -5, -5, -11, 14, 10, -3, 1, -7, -18, 10, 0, 12, 7, -13, -2, -11, -12, 12, 15, 16, 14, 0, 14, 4, 5, -11, -13, 7, 21, -12, -7, -14, 7, -6, -9, -19, -15, -12, -13, -14, 8, -1, 20, -7, -3, 3, 8, -5, 7, 17, -13, 8, 1, 8, -4, -3, 8, 10, 11, -14, -1, 11, -8, -6, -14, -8, 4, 8, 4, 10, -1, -10, -12, -7, 12, 2, 11, 12, -5, 17, -5, 11, 7, 15, -12, 2, -2, -3, -16, -18, 10, 3, 1, -7, -4, 2, 18, 3, 8, 21, 15, 7, 20, 17, 0, 17, 15, -9, 10, -4, -11, 17, 16, 12, 1, -2, 8, -11, 5, 6, 11, 10, 11, 1, 15, -5, -9, 19, 8, 8, 13, -13, -6, 4, 12, 6, 10, -8, 2, 16, 7, -7, 0, -4, 13, 0, 11, 5, 10, -2, -8, 11, 15, 6, -10, -2, 15, 2, -1, 8, -7, 7, 1, 17, 11, -10, 4, 7, 0, 7, -8, 14, -13, 13, -1, 2, 11, 4, 1, 5, 20, -13, 5, 9, 3, 3, 14, -10, 5, -19, -11, 5, 6, -21, -11, -22, -2, 9, -15, 1, 7, -8, 11, -3, -8, -3, -23, -16, -3, -20, -5, 7, -16, 3, -11, -17, 4, -3, -9, -13, -14, -22, 6, 9, -18, 4, 8, -20, -4, -21, 3, 2, 7, -12, -12, 12, -11, -5, -17, -15, 9, -6, -1, -23, -11, -5, 6, -8, -19, -20, 5, -17, -8, -10, 11, -12, -8, 3, -1, -4, 15, 7, -14, -5, 8, 8, -14, -9, -20, 6, -14, -22, -18, 8, -12, -8, -4, -10, -15, -2, 0, 1, 13, 14, 3, 20, 9, 29, 4, 0, 1, -9, 2, -7, -17, 0, 13, -10, 5, -1, -24, -12, 1, -11, 2, -21, 11, -1, 3, 22, 27, 10, 11, 31, 5, 6, 20, 28, 12, 3, -11, 6, -13, -14, 5, -16, 0, 10, -2, 2, 2, 3, 1, -14, 6, -6, 11, 9, 23, 6, 3, 8, 10, 7, -3, 3, 20, 15, 7, 0, -6, -28, -2, 9, -8, 11, 1, -23, -18, -21, 6, -14, 4, 13, 15, 19, 1, 14, -10, -2, -12, -15, 9, -13, 0, -6, -18, 8, -19, -10, 2, -14, 8, -22, 3, 7, -1, -17, -22, 0, 3, 4, 19, 7, 9, 7, 6, 0, 0, -15, -1, -1, -3, -20, 5, -15, -10, 10, -13, -12, -17, -11, 7, -14, -4, 1, 11, 21, 28, 15, 18, 16, 1, 18, -11, -11, -1, -9, -31, -12, -4, -15, -3, 13, 5, 4, 2, -22, -26, -8, -11, 1, -20, -18, 1, -1, 23, 0, 9, -1, 1, -11, -29, -2, -30, -3, -25, -12, -1, -2, 18, 33, 32, 6, -21, -19, -23, -22, 8, -3, 8, -18, -13, 8, 13, 29, 16, 2, -21, 2, -1, 2, -8, 3, -27, -9, -1, 11, 11, 11, 17, -7, 8, -6, -36, -4, -7, -10, 1, 7, 3, 16, 6, -12, -1, -14, 16, -6, -11, 17, 20, -6, 4, -4, 0, -4, 25, 14, -12, -6, 1, 0, -2, -6, -20, 6, -15, 2, -3, -10, -10, -29, 6, -10, 14, 6, 11, 12, 20, -2, 13, 4, 23, -1, -5, -10, -10, 8, 28, 20, 17, -19, -13, -5, 8, 4, -11, -13, -24, -6, -35, 9, -16, -3, 5, 29, 23, 0, 17, 18, 13, -10, -8, 2, 11, -3, 32, 6, -8, -1, 9, 10, 10, -21, -13, -30, -18, -3, -4, -22, -4, -5, 6, 1, 13, 35, 29, 25, 17, -26, -20, -18, -7, 2, 0, -21, 7, 9, -15, -6, -19, -9, 4, -31, -28, -7, -9, 2, 2, -7, 14, 8, 14, 33, 15, 10, -20, -30, 1, -15, -15, 8, -23, 1, 9, -11, -7, 5, -7, 8, 7, -14, -21, 0, 5, -14, 10, -6, 5, 10, 7, 20, -2, 20, -14, -34, 8, -26, 9, -10, 12, 15, -1, -13, 8, 10, -21, -21, -10, -3, 3, -11, -13, 18, 28, -3, 15, 7, 25, 0, -2, 4, -13, -22, -17, -19, -13, 7, 7, -9, -7, 10, -9, 1, 7, -11, -9, -11, -5, 5, -1, 13, 3, 9, 1, 17, 22, 17, -5, -5, -9, 12, -17, 3, 6, 9, 12, -17, 8, -7, 6, 4, 5, -22, -21, -1, -22, -6, 6, -8, 2, 22, 10, 10, 20, 0, 7, 4, 13, -7, -8, 0, 3, 5, 29, -26, 7, -10, -16, 8, 4, -6, -18, -14, -37, -10, 19, 14, 10, 34, 24, 23, 6, -4, -1, -4, 2, -7, 5, 29, 36, 16, -7, -18, 1, -11, -16, 6, 2, 11, 0, 9, -4, 17, 6, -8, 1, 3, 6, 8, 14, 14, 11, 5, 29, 17, 12, 18, 9, 19, 1, -3, -28, -6, -5, -6, -8, -18, 0, -8, 6, -4, 4, 8, 0, 19, 19, 24, 23, -8, 7, 5, -2, 15, 26, 2, 3, 13, 8, -24, -17, -21, -19, -13, -10, -23, -14, 2, 3, -6, -9, -11, -2, 8, -5, 12, 15, 6, 12, -7, -12, 20, 15, 14, 14, 20, -13, -24, 2, -10, -8, 10, -4, -10, -15, -19, -5, -23, -4, 8, -12, 1, 23, 22, 11, 16, 8, -3, -20, 0, 3, -5, 6, -3, -9, -13, 6, -17, 1, -1, 7, -6, -13, -4, -7, -18, -7, 4, -2, 4, -15, 10, 6, -6, 14, -6, 9, -23, -21, -4, -10, -24, -28, -19, -19, -18, -12, -19, -9, -11, -21, 2, -11, -4, -14, -3, 5, -27, -26, -34, -16, -24, -31, -26, -13, -18, -15, -23, -28, 8, -3, -5, -3, -12, -18, 10, -10, -2, -8, -22, -3, -9, 4, -9, 2, 3, 0, -4, -18, -14, -15, -1, -16, -10, -9, -12, -19, 6, -12, 7, -14, 4, 4, -14, -5, -7, -2, -21, 1, -4, 12, 14, -7, 0, -2, -8, 0, -17, -17, 5, -4, -12, 3, 0, 10, 7, -7, 1, 7, 3, -5, -1, -11, 0, -14, 9, 9, -19, -7, 10, 3, 0, -10, 6, -17, -8, 11, -9, -3, 7, 3, 4, -1, -17, -4, -14, 2, -1, -18, 9, -9, -12, -8, -2, -8, 8, -6, -16, -2, -15, -9, 2, 0, 3, -11, -26, -24, -8, -11, -12, 4, -2, -16, -11, -5, 12, 2, -4, -5, -19, -7, -2, 9, 6, -24, -13, -28, -31, -23, -41, -10, 14, -15, 24, 42, 33, -7, -12, -15, -24, -14, 4, -18, -19, 2, -9, -18, 4, -20, 8, 0, -8, 1, -1, -8, -6, -29, -13, -7, -23, -10, 6, 36, 38, 49, 36, -21, -9, -18, 4, 7, -20, -17, 12, -12, -16, -22, -8, 5, -12, 0, 0, -6, -5, -18, -33, -30, -11, 5, 11, 9, 42, 43, 77, 39, 8, 6, -11, -19, -18, 7, -3, 13, -9, -12, -22, 11, 5, -2, -31, 1, -9, -21, -3, -18, -35, 2, -26, 6, 32, 32, 81, 65, 58, 10, -16, -7, 7, 8, 0, -4, -1, 1, -25, -22, -15, -2, -4, 13, -17, 13, 9, 8, -25, -25, -30, -14, -5, 47, 81, 68, 52, 40, 24, -7, -11, 8, -8, 8, 4, -13, 10, -13, -12, -7, -1, 19, 31, 52, 31, -12, -14, -58, -63, -76, -14, 74, 71, 92, 93, 58, 8, -17, 2, 7, -7, -11, -8, 13, -18, 7, 17, 28, 38, 40, 35, 37, -3, -31, -53, -84, -74, -63, -9, 98, 98, 84, 79, 49, 2, -27, 0, 0, -18, 9, -16, -2, -24, -2, 36, 28, 22, 30, 12, 9, -12, -44, -69, -74, -100, -51, 36, 83, 82, 92, 88, 71, -13, -44, -23, -16, -7, -19, -15, -16, 5, 14, 12, 41, 41, 15, 1, -8, -47, -53, -73, -64, -80, -33, 26, 71, 70, 45, 69, 3, -10, -25, -32, 11, -4, 1, 8, -9, -19, -2, 32, 2, 12, -4, -10, -36, -42, -62, -46, -36, -56, 0, 53, 51, 37, 35, 39, 1, -14, -22, -5, 7, -19, 7, 8, -2, -7, -4, 22, 11, -7, -12, -35, -26, -37, -52, -39, -39, -46, 8, 38, 52, 22, 26, 29, -2, -4, -10, -21, -16, -10, -18, -4, -8, 7, 35, 21, 24, -4, 9, -7, -18, -14, 2, 5, -11, -30, 20, 26, 32, 34, 2, -2, -17, 0, -1, 0, -15, -8, 5, 8, -4, -8, 21, 14, 4, 16, -13, -28, -19, -32, -2, -20, -27, -24, 6, 26, 33, 12, -13, 18, -8, -5, 5, -16, 14, -6, 7, -13, -16, 18, 8, 21, 11, 12, -31, -23, -51, -21, 6, 2, 0, 6, 6, 22, 8, 0, 10, -17, -15, -27, -17, 11, -14, -7, -6, -6, -17, 35, 15, 26, 16, -7, -37, -41, -8, 7, 8, -7, 12, 11, 19, 26, -8, -19, -15, -13, -17, -24, -24, 2, -5, -1, 11, -17, -12, -6, 13, 8, 19, 13, -19, -43, 2, -9, 5, 6, 11, 4, 11, 2, 16, -31, -13, -23, -23, -33, 4, 5, 6, 3, -19, 11, 15, 2, 0, 34, 30, 39, 24, 1, 19, 21, 24, -5, 18, -2, 33, -6, -21, -43, -19, -19, -7, -6, -19, -11, 10, -17, 5, 15, 25, 10, 10, 1, 20, 9, 8, 2, -8, 12, -15, 9, 27, 4, -2, 0, 3, 1, -11, -19, -21, 2, -19, 4, -21, 13, -13, 12, 18, 7, -3, 19, 28, 24, 6, -1, 7, -5, -9, -28, -25, -4, 6, -10, -11, 13, 3, 6, -2, -3, -4, -6, -14, 13, 12, -6, -6, -5, -14, 20, 28, 28, 3, 14, 4, 10, 2, -15, 1, -22, -27, -9, 15, 13, 4, -13, -18, -4, -23, 9, 6, 1, -16, -16, 11, -34, -11, 41, 54, 27, -4, -20, 13, -9, -2, 0, -8, -28, -39, -36, -9, 4, 4, -22, 3, -9, 14, 5, 1, -11, -15, -5, 11, 11, 21, 34, 13, 2, -5, -5, 1, 4, -27, -18, -27, -17, -41, -49, -23, -17, 4, -28, -1, -5, 1, 6, -9, -2, 11, 0, 2, -8, 11, 26, 7, -8, 0, 15, 3, 7, -14, -18, -11, -20, -52, -40, -28, -8, -26, -33, -17, -19, -8, -7, 0, 5, 8, -9, -21, -5, 14, 9, 10, -4, 18, -8, -26, -8, 7, -3, -8, -12, -37, -33, -31, -11, -3, 7, 0, -3, -12, 6, -16, 1, -14, 11, 12, 5, 1, -12, 7, -15, 7, -19, -6, 5, -11, 4, 0, -6, -12, -21, 1, 14, 12, -11, 7, -3, -20, -15, -19, -11, -12, -16, -3, -4, -1, 15, -8, -9, -2, 4, -11, 9, 1, 2, 5, 8, -17, -6, 7, 8, 8, -3, 16, 7, 7, 1, -11, -12, 10, 16, 7, -9, 4, -7, -13, 8, 16, 15, -1, -8, -9, 1, 13, -12, -1, 3, -8, -8, 10, 1, 3, 6, 12, -4, 11, -10, -9, 7, -3, 18, -4, 15, 8, 21, -10, 6, 18, 13, 10, 26, 5, 11, -7, 11, 3, -2, -17, 4, 6, -10, -3, 0, -15, 3, -9, 10, -15, -4, 8, 16, 15, -3, 27, -1, 25, 13, 23, 37, 38, 0, -17, -16, -29, -34, 0, 19, 0, -1, 2, 3, 17, 11, 13, -17, 15, 18, -11, -10, -12, 29, 21, 21, 15, 18, 35, 30, 8, 0, 12, 4, 1, -21, -11, -9, -19, -19, -17, -17, 17, 15, -1, 6, 13, 1, -10, -13, -2, -4, 11, 11, 3, 28, 17, 6, 22, -11, -26, -1, 2, -17, -12, -20, -35, -38, 2, -1, 3, 3, 17, 16, 11, 10, -9, -3, -6, 3, -10, 2, -6, 29, 14, 12, 13, -11, -14, -7, -1, 7, -17, -15, -36, -32, 4, -16, 11, -4, 3, -13, 1, -15, 6, -2, 1, -7, 14, -7, 31, 32, 4, 10, -25, -23, -35, -2, -21, -14, -24, -32, -23, -3, 1, -5, 16, 9, -14, 9, -15, 16, -11, 2, 12, 15, 2, 12, 33, 27, 4, -12, -28, -21, -9, -17, 8, 6, 9, -26, -25, -4, -5, -10, 12, -5, -7, -4, -13, 8, 16, 11, 4, -5, 26, 17, 50, 16, 2, -23, -34, -11, -13, -4, 2, 35, 4, -36, -5, -6, -15, -4, 17, -3, 0, -15, 4, 8, 24, -1, 24, -1, 15, 25, 31, -13, -42, -52, -6, -28, -19, 16, 22, 18, -5, 2, 10, -2, -23, -18, 11, -15, 6, 12, -13, 14, 16, 28, -4, 14, 27, 33, -10, -40, -55, -65, -30, 18, 10, 2, 8, 24, -2, 2, 16, 22, -23, -9, 0, 9, -17, -18, -2, 9, 22, 29, -5, 2, 6, 6, -30, -77, -71, -40, -18, 12, 11, -10, 5, -3, 17, 20, 43, 23, 4, -7, -4, 3, -5, -14, 3, 46, 15, 32, 19, 19, 25, 0, -42, -105, -74, -37, -14, -6, -12, 19, 5, 3, 16, 21, 32, 27, 7, -19, -13, -7, 5, -9, 18, 34, 35, 22, 33, 41, 3, 7, -40, -89, -76, -36, 12, -7, -15, 18, 4, 2, 10, 36, 46, 46, -11, -11, -9, 14, -14, -10, -15, 10, 55, 26, 47, 26, 27, 21, -48, -50, -47, -15, 1, -30, -19, -20, 16, 22, 25, 16, 42, 25, 10, -16, 10, 7, -14, -14, -15, -2, 44, 38, 35, 45, 21, 47, 9, -15, -14, 29, -8, -32, -33, -24, 19, 29, 7, 44, 26, 13, 1, -2, 4, 14, -11, 12, -6, -18, 47, 16, 50, 46, 39, 39, 61, 31, 10, 12, -10, -15, -5, -3, 5, 24, 10, 47, 18, 24, -6, -8, 7, 1, 6, -13, 7, -18, -2, 27, 25, 44, 33, 35, 34, 32, 13, 9, -24, -10, -18, 9, 7, 19, 19, 24, 8, 1, -7, -17, -6, 16, 7, -4, 5, -27, -13, 12, 15, 17, 48, 34, 44, 12, 19, -8, -4, -30, -6, 7, 10, 20, 24, 12, 18, 14, -21, -6, 7, 13, 14, -3, -20, -36, -12, -8, 16, 9, 29, 16, 27, 19, -6, 13, 1, -6, 6, 18, 35, 12, 13, 6, 0, 7, 3, -4, 10, 0, 13, -8, -27, -16, -25, -47, -3, -26, -7, 5, -1, 5, 18, 19, -4, 13, -8, 6, 9, 16, 1, 0, -19, 0, -1, -15, -2, 11, 7, -17, -5, -7, -52, -59, -33, -51, -21, -31, -19, -7, 19, 10, 27, 32, -2, -12, 6, 5, 2, -20, -15, 0, -12, 15, -1, 15, 13, 12, 1, -1, -28, -37, -35, -67, -69, -45, -19, -25, -6, 22, 27, 9, 11, 11, -4, 5, -9, 1, 14, 8, -10, -3, 0, -13, 11, -3, -3, -4, -16, 3, -8, -14, -29, 10, -20, -5, -10, -8, -16, -37, -24, -7, 2, 2, 19, 7, 4, 4, -4, -16, -15, 14, 8, 3, 3, -13, -4, 13, 4, 9, -4, -1, 9, -28, -20, -34, -17, -42, -22, -24, 14, 17, 18, -3, 19, 7, 7, 5, -7, 2, 15, 0, -14, -3, -1, -1, 4, -5, -4, -12, -8, -2, -24, -8, -27, -22, -5, -27, -6, 2, 15, 5, -9, 1, -9, -9, -14, -17, 13, 7, 17, 13, -14, 12, 11, -13, -1, 14, -13, -7, -8, -3, 2, -12, -12, -9, -11, 20, -9, 4, 7, 0, -15, 13, -16, -6, -8, -10, -12, -6, -16, -3, -13, -2, -21, -12, -1, -15, 10, -20, 8, -17, -6, -18, -2, 6, 5, -4, 2, 3, -14, -13, 2, 5, 4, -14, 10, 10, -2, 5, 5, 11, 6, -5, 15, 11, -15, 2, 6, -10, -10, 6, -10, -15, -4, -5, -8, -20, 0, 5, -5, 6, -11, 0, -6, -10, 12, 3, 8, 10, -6, 18, 21, 12, -7, 0, 1, 7, 18, 11, 19, 1, 12, 0, -15, -2, -16, -6, 13, -10, -7, 4, -7, 6, 2, 1, -6, 3, 4, 8, -3, -3, -2, 4, 3, -6, 5, 8, 35, 32, 16, -6, 16, -12, 8, -1, 12, -8, -6, 1, 9, -20, -20, -11, -14, -7, 11, -10, 17, -2, 4, 9, -1, 21, 18, 17, 36, 29, 19, 30, 7, -1, 12, -5, 8, -1, 2, -11, -8, -2, -22, 9, -2, 24, 37, 27, 31, 33, 22, 27, 28, 34, 30, 37, 27, 34, 30, 40, 15, 26, 12, -20, -18, -4, -8, -11, -6, -14, 3, 9, 27, 23, 16, 32, 42, 51, 59, 74, 61, 52, 31, 49, 34, 42, 15, 6, 16, -5, -7, -18, 12, -17, -10, 5, 3, -17, -24, 8, 19, 45, 33, 24, 42, 47, 61, 27, 11, -5, -9, -5, -18, -7, 5, 1, -44, -4, 10, 8, -4, -3, -17, -5, -17, -26, -4, 15, 11, 20, 23, 34, 32, 13, -20, -19, -32, -42, -71, -49, -45, -46, -50, -33, -52, -54, -25, -10, -1, 5, 12, -9, -4, -8, -9, -2, -3, -2, -16, 3, -9, -34, -61, -54, -52, -66, -64, -69, -80, -75, -72, -63, -46, -33, -14, 5, 12, 9, 1, 1, -12, 10, -3, 0, 8, -10, -1, -30, -27, -65, -38, -40, -44, -18, -10, -35, -39, -45, -37, -58, -39, -16, -9, -6, 6, 12, -10, -19, 2, -1, 11, 14, -29, -18, -23, -27, -35, -42, -27, -7, 22, 31, 29, 22, 23, 7, -5, -26, -9, -27, -7, -5, -17, -15, -7, -5, 12, 12, 3, 6, -24, -28, -23, -28, -48, -48, -18, 1, 32, 30, 29, 38, 27, 20, 17, 9, -8, -22, -20, -21, -19, 12, -12, -11, -3, 15, -5, -17, 2, -19, -2, -22, -10, -22, -8, -2, 22, 7, 28, 24, 21, 14, 12, 10, -21, -9, -6, -9, -7, -21, 8, 11, 8, 16, -46, 0, -1, -1, 3, -8, -21, -40, -13, 1, -7, 13, 17, 12, 19, 38, 15, 7, -23, -1, -24, 7, 6, 8, -1, 11, -12, -2, -29, 9, -8, -3, 10, -10, -17, -38, -6, 2, 13, 24, 28, 28, 1, 29, 24, -15, -10, 23, 16, 11, -16, -1, -2, 6, -10, 0, -23, -5, -29, -23, -18, -32, -9, -34, -20, 7, 22, 18, 18, 9, 1, 5, -2, 5, 2, 27, 32, 15, 10, 2, 11, -12, 15, -13, -8, 16, -42, -2, -30, -11, 1, -12, 9, -3, 29, 12, 8, 1, 13, -13, -2, -11, -6, 12, 34, -4, 12, 2, 6, 11, -6, 17, 27, 25, 2, -7, -20, -18, 3, 14, -3, 8, 18, 10, 1, -5, 6, 2, 10, -19, -8, 30, 35, 9, -6, -20, -11, -14, 14, 27, 29, 32, 23, 39, -1, 16, 9, 20, 36, 9, 20, 4, -2, 2, 4, 13, -5, -2, 11, 13, 6, -7, 6, -16, -15, 13, 6, 17, 22, 7, 14, 22, 26, 31, 41, 25, 9, -1, 19, 24, -3, -14, -13, -28, -5, -19, 4, 14, 2, 10, 9, 11, 8, 6, 3, 10, 33, 36, 28, 16, 15, 30, 9, 7, -12, 11, 1, -2, 0, 7, -5, -4, -11, 11, 20, 12, 1, -4, -17, -18, -18, -19, -17, 2, 15, 25, 12, 29, 19, 17, -2, -12, -8, -10, -18, 12, -22, -13, -14, 9, -4, -3, 22, 17, 0, 1, -6, -20, 9, -10, -1, -1, 16, 17, 4, 22, 6, 11, -31, -37, -28, -7, -11, 5, -5, -9, -12, 6, 18, 19, 11, 9, 15, -2, -19, -17, -12, -17, -21, -21, 15, 13, 29, -17, -3, -33, -41, -13, -15, -20, -8, -22, 7, 19, 27, 25, 31, 32, 17, -13, -6, -18, -2, -7, 11, -17, -7, -8, 6, 7, 10, 7, 0, -43, -29, -10, -1, 13, -4, 18, 24, 20, 18, 40, 17, 14, 1, 15, -3, -15, 7, -21, -7, -2, -17, -14, 8, 15, -9, 7, -5, -7, -8, 0, 9, -3, -9, 20, 12, 6, 12, 27, -6, 9, 14, 6, 1, -20, -14, -10, -19, -3, -21, 5, 5, 13, 4, -1, 12, 10, 13, -16, -12, 6, 7, -17, -2, 8, 8, -8, -5, 4, -22, 7, -14, 11, -7, 14, -20, 9, 11, -6, -8, -18, -16, 7, 8, 13, -7, -1, 10, -10, -10, 7, -9, 13, -3, 2, -12, 6, 13, 4, 0, 2, 12, -6, 10, 3, -9, -13, -8, 0, 3, 12, -9, 11, -6, 3, 4, 2, 13, -6, 18, 2, 9, -14, -13, -2, 3, 11, 11, -9, -14, -6, -19, -8, 5, -3, -6, 10, 13, 12, 12, 0, -8, 3, 2, 16, 14, 11, 7, -2, 19, 7, 13, 1, -12, 14, 5, -4, 14, -11, -9, -11, -13, -19, -18, 6, 3, 9, 7, -16, -8, -13, -5, 16, 15, 17, -1, 24, 0, 12, 0, 21, -4, 17, -6, -5, -13, 7, -7, -8, -17, -3, -4, -14, -29, -21, -24, -17, -39, -31, -2, 13, 6, 1, 22, 21, 2, 11, 20, 5, 3, -6, 3, 6, 4, 6, -14, 2, -21, -20, -40, -19, -18, -24, -3, -3, -26, 1, 19, 9, -2, 17, 4, 4, 9, 25, 30, -12, -9, -6, -12, 6, -17, 4, 8, -3, -22, -17, -38, -20, -11, -20, -9, -12, 10, 17, -9, 10, -3, 1, -3, 2, 14, -5, 4, 12, 20, -1, 24, -13, -15, -6, -1, -6, -31, -38, -41, -28, -16, -23, 4, 7, 3, 21, -6, -20, 4, -6, 4, 27, 17, 13, 3, 5, 23, 21, 10, -5, -14, -19, -6, -7, -9, -22, -30, -3, -4, 0, 11, 10, 26, 1, -10, 7, 3, -1, -8, -15, 16, 19, 25, 16, 30, 39, 6, -6, 8, -11, 13, -9, -25, -21, -20, -38, -28, -18, 24, 15, 18, 17, 11, -19, -37, -15, -9, -22, 7, 6, 19, -9, 26, 44, 23, 14, 5, 8, -4, 9, -30, -10, -18, -42, 7, 10, 30, 30, 17, -7, 7, -16, -19, -5, -6, -4, -27, -13, -6, 5, 28, 41, 16, -10, 8, 11, -14, 3, -1, -28, -4, -3, 18, -10, 24, 5, 14, 22, 16, 7, -27, -28, -29, -8, -28, 2, -1, 13, 26, 20, -12, 1, -5, 12, -7, -19, -16, -4, -3, 6, 27, -11, 14, -10, -4, 16, 5, -26, -7, -6, -13, -24, -34, -4, 22, 0, 39, 35, -8, 6, 9, -19, 9, 10, 4, -2, -7, 19, 23, 6, 7, 19, 17, 30, -7, -4, -5, 5, -4, -9, -12, 13, 19, 10, 17, 16, -15, -9, -11, -2, -1, -17, -21, -25, -5, 23, -3, 5, 27, 23, 38, 18, 16, -12, -9, -3, 2, -19, -15, -8, 6, 12, 4, 2, -11, 8, -15, -5, -5, -16, 6, -11, -14, -1, 5, 23, 33, 39, 17, 10, 8, -9, -2, 0, -24, -7, -4, 7, -12, -18, 4, -23, 2, 6, 4, -14, -16, 5, -27, -28, 10, -5, 33, 18, 42, 42, 33, 13, -9, 5, -17, -4, -10, 2, -20, 11, -6, -21, -6, -8, 3, -5, 9, -14, -1, -22, -36, -31, 0, -1, 12, 28, 19, 11, 20, 29, -8, 16, 3, -20, -14, -17, -2, 20, 14, -17, -21, 3, 4, -14, -1, 13, -16, -21, -35, -4, -11, 23, 22, 17, 19, 29, 3, 10, 14, -15, -5, -7, -22, 8, 6, 17, -4, -15, -21, 6, -26, -17, -17, 13, 4, 2, -14, -7, -5, 7, 0, 2, 21, 17, 8, 9, 21, -11, -31, -29, -14, 5, 0, 9, -4, 0, -25, -14, -2, 8, -9, -15, -10, -14, -31, -15, -11, 0, 1, 15, 11, 21, 28, 25, 8, 13, -22, -12, -18, 4, -8, -27, -28, -18, -11, -18, -7, -21, -6, 2, -13, -10, -32, -14, 16, 10, -3, 1, 7, 30, 5, 28, 4, 23, 6, -11, -10, 2, 4, -6, -20, -16, -13, 2, -22, 13, 6, 4, -3, -1, 0, -12, 4, -2, -12, -7, 20, 33, 8, 15, 34, 32, 13, 4, -19, -7, -20, -36, -7, -22, -16, -25, -10, 11, 8, -4, 14, -19, -3, -23, 2, -5, -13, 17, -8, -6, 11, 24, 7, 27, 9, 4, -14, -24, -32, -34, -26, -13, -12, -5, -1, -1, 0, -9, 10, -18, -9, -20, -36, -21, -28, 6, -11, 4, -13, 0, 16, 17, 9, 19, -30, -29, -17, -12, -28, -24, -21, 2, -9, -11, -13, -13, 10, -3, -4, 7, -17, -39, -26, -45, -25, -4, 4, -1, -1, -17, 6, -5, -6, 8, -15, -17, -24, -9, -18, 1, -13, -2, 14, 10, -16, -8, 11, -11, -2, 2, -5, -1, -6, -6, -25, 0, -20, -7, -31, 1, 1, 4, -11, -10, 6, -11, -14, 7, -9, -3, -7, 4, 9, -18, -17, -11, -5, -13, 0, -13, 12, 4, -18, -21, -12, -17, -7, 6, -19, -11, -15, 10, 13, -18, -13, -12, -11, -15, 0, -24, 3, -5, -2, -22, 10, -11, 4, -13, -14, -7, 10, 3, -13, -19, -11, 2, 11, -20, -20, 11, -16, -10, -19, -5, -22, -15, -2, -8, -12, -4, 8, -4, -5, -17, 5, -18, -23, -5, -5, -23, 8, 9, -22, -21, -18, -1, 4, -10, -8, 4, -11, 11, 6, -14, -6, 7, -17, -10, 7, -18, 3, 6, -16, 5, -8, 4, -9, -18, 9, 9, -1, -7, -26, -27, -4, -14, 2, -6, 0, -9, -4, -8, -11, -18, 6, -20, -3, 9, -1, -17, -7, -16, 20, -2, 11, 24, -1, -7, -13, 7, 15, 0, -4, -14, 2, -13, 3, -7, 6, 7, 9, -7, -14, -6, -9, -10, 2, 18, 15, 8, 11, 16, 13, 9, 9, -1, -11, 6, 13, -15, -1, -8, -27, -27, -3, 8, -8, -24, 7, 6, -14, -14, 5, 5, -17, 21, 26, -5, 4, 19, 14, 22, 5, -2, -4, 23, 24, 8, 16, -13, -27, -25, -6, 3, -20, 2, -1, -5, -16, 0, -9, -5, 12, -3, 16, -8, 29, -4, 1, -14, 2, -4, 29, 19, 8, 21, -2, -6, -34, -34, -14, -34, -4, -8, -16, 2, -18, -4, -3, 14, 19, 17, 9, 10, -6, -6, -1, -6, 13, 1, 7, 17, -2, -7, -22, -13, -3, -5, -37, -5, 6, -13, 11, -21, 9, 5, -9, 22, 2, -5, -27, -22, -26, -22, -7, -10, -17, 4, 14, 16, 1, 4, 5, -13, -1, -2, -10, -45, -27, -23, -22, -21, -2, -12, -22, -12, 20, 5, 2, -4, -17, 0, -8, -27, -13, -4, -11, 6, -6, 20, 24, 6, -11, 8, -7, -35, -42, -16, 8, -16, -3, 3, -15, -1, -11, -11, -14, -15, 2, -6, -6, -17, -20, -29, -17, 12, 11, 21, 2, -2, -26, 4, -2, -37, -34, 1, -3, -16, 0, -29, -8, -14, 1, -6, -9, 2, -9, -20, -23, -28, -25, -31, -19, 11, 25, 22, 17, -3, 10, -24, -25, -35, -19, -15, 9, -5, 2, 2, -13, -24, -1, -17, -21, 5, 13, -8, -4, -18, -21, -24, -2, 17, 17, 9, 22, 18, -6, -10, -16, -13, -25, -19, -1, -23, 1, -20, -26, -11, -19, -2, -12, 14, 5, 4, 9, -4, -6, -8, -15, 25, 20, 21, 17, -2, -7, 3, 12, 11, 12, -17, 8, 6, 10, 4, 6, -2, -3, 4, 27, -9, -4, -15, 12, 26, 12, 14, 5, -2, 30, 12, 19, 5, -2, 10, 1, -4, -12, 11, 2, 1, -5, -24, -17, 22, 21, 22, -3, 5, 1, -4, 19, 0, 23, 2, -3, 33, 9, 8, -1, 5, 13, 15, -1, -5, 10, -14, -9, -18, -2, -5, -4, 7, 7, -6, -7, 8, -14, 19, 13, 26, -4, 6, 13, 8, 11, 28, -3, 4, -5, 1, 2, 9, 23, 8, -7, -20, -17, 13, 10, 19, -10, 11, -4, 7, -3, 9, 7, 31, -4, -3, -17, 12, 10, 20, -2, 1, 11, -3, 5, -26, 12, -13, 11, 5, 11, 9, 16, 19, 16, 13, 16, -3, -3, -10, -7, 22, 21, -5, 23, 27, 21, -8, -4, -9, 13, 15, 2, 10, 16, -8, 6, 8, -19, -16, 3, -2, 6, 12, 0, 10, 5, -4, 25, 18, 20, 1, -9, 10, 16, -5, -15, -10, 6, 17, 8, -23, -11, -1, -2, -13, -24, -20, 10, 6, -4, -2, 6, -1, -7, 10, -10, 10, -16, 12, 18, 8, -11, 6, -4, 0, 1, -9, -3, -6, -3, -17, -9, -17, 0, -17, -4, 8, -25, -11, 3, 10, -4, 5, 9, 8, -17, 10, -6, 19, 10, -4, -2, -12, 9, 23, 8, -2, -17, -18, -14, -22, 7, 0, 8, 2, -34, -3, -12, 5, -6, 18, 0, -4, -13, 1, -23, 8, -7, 6, 14, 17, 19, 16, 16, -2, -18, -23, -15, -21, -15, -4, 6, 13, -29, -11, 0, 9, -15, -13, -10, -4, -8, -6, -2, -5, -8, 9, 7, 17, 18, 15, -3, -17, -6, 9, -8, -19, -15, -7, 13, -16, -14, -6, 1, 13, -2, -7, -2, -13, -12, 1, -16, -7, 24, 18, 9, 16, 22, -2, 17, -10, 1, 7, -16, -9, -13, -5, -16, -16, -9, -4, 20, 16, 2, 12, -4, -9, -14, 12, -14, -4, -16, -11, -17, 11, -13, -19, 5, -18, -1, 8, -1, -3, -3, -1, -3, 5, 18, 4, 13, -18, -2, 2, -2, 10, 13, 0, -16, -22, -14, -3, -22, -21, -5, 5, -11, -11, 2, -4, 1, -14, -22, -10, 6, -15, 8, 8, 3, 10, -9, -6, -18, -23, -15, -2, -15, 0, -2, -15, -16, -17, -10, 5, -2, -22, -14, 8, -17, -3, -20, -1, -4, -14, -17, -1, 12, 5, -13, -20, -8, -2, 5, -2, 3, -2, -20, -5, -10, -7, -15, -17, 5, -16, -5, 10, -4, -11, 13, 8, 10, -18, 3, -11, 11, -11, 11, 10, -16, -5, -16, -16, -8, 4, 8, 7, -3, -2, -1, -10, 1, 4, -4, 8, -16, 7, 8, 4, -10, -13, 8, 6, 13, 13, -4, 3, 29, 23, -10, -2, -6, -14, 10, -6, 2, 16, 6, 0, -6, 11, -4, -19, 13, 13, -16, 2, 0, -12, -14, 6, -3, 21, 32, 31, 18, 24, 13, 17, -4, 10, -9, -17, -16, -27, -18, -8, -11, -14, 11, -8, 3, -20, -17, -15, 10, -10, -9, 11, 25, 23, 29, 16, -8, 15, 9, 8, 17, 27, 1, 15, -12, -13, -43, -17, -7, -18, -25, -16, -12, -13, 5, 2, 7, 0, -13, -15, 8, -3, -22, -14, -5, -11, -20, 4, 11, 31, 23, 21, 20, -3, 3, -6, -30, -34, -3, -15, -11, 0, -10, 0, 10, -2, -13, 1, -31, -22, -31, -7, -17, -8, -22, -7, -5, 10, 6, 33, 14, 18, 22, -3, -17, -38, -31, -3, -3, -19, -13, -8, -15, -4, -27, -20, -32, -16, -11, -7, -5, -21, -16, -8, -8, 3, 7, 35, 13, 13, 23, 10, -7, -33, -16, -20, 3, -5, -14, 13, 13, -1, -21, -32, -12, -10, 2, -7, -25, -28, -7, -7, 11, 35, 7, 28, 28, 13, 14, 4, -25, -15, -28, -5, -17, 5, 2, -13, -11, -4, -9, 5, -17, -25, 2, -1, -34, 1, -5, 15, 27, 16, 22, 14, 10, 21, -21, -16, -9, -15, -34, -4, -3, 7, 5, 0, -7, -3, -2, 26, 6, 3, -7, -5, 3, -7, -7, -12, -16, 3, -14, 1, 25, 28, -3, 12, 25, -8, -20, -22, -20, -11, 4, 9, -12, -9, 27, 5, -7, 20, -1, -16, 1, -14, -13, -17, -60, -60, -41, -28, 8, 16, 29, 29, 17, -12, -20, -33, -6, 11, 10, -20, -8, -10, -5, 30, 14, 14, -10, -6, -16, -2, -1, -42, -36, -47, -50, 0, 10, 31, 15, 41, 44, 19, -1, -4, -17, -16, -21, 2, -1, 7, 2, 36, 7, 14, 8, -5, -21, -23, -17, -35, -54, -43, -42, 23, 21, 18, 31, 30, 44, 22, 20, 3, 11, -11, -17, 8, -1, 10, 10, 33, 36, 41, 13, 10, 0, -12, -6, 4, -21, -40, -35, 28, 30, 49, 26, 41, 21, 30, 17, -10, -13, -19, 11, -16, -2, 3, 38, 44, 48, 70, 46, 21, 6, 11, -2, -3, 3, -34, 9, 23, 29, 20, 28, 1, 7, 38, 31, 13, -16, -6, -3, -14, -15, -3, 24, 24, 20, 20, 40, 34, 25, 4, 12, -6, -17, 0, 26, 35, 17, 23, 15, 0, 6, 11, 17, 23, -8, -1, 10, 5, -14, 10, 11, 1, 16, 34, 36, 54, 47, 16, 7, 4, -17, 17, 22, 19, 18, -8, -11, 3, -12, -16, 35, 9, -1, 11, -9, 5, -20, 2, -20, 16, 6, 23, 29, 25, 28, -3, 18, 9, 2, 11, 36, 27, 18, 2, 12, 15, -1, 9, 18, -18, -16, 12, 5, -8, -6, 16, 14, -12, 8, -1, 8, 40, 40, 30, 1, -9, 16, 10, 17, 26, -4, -10, -6, 3, -7, -27, 0, 2, -18, -1, -4, 7, -8, 27, 23, 4, 26, 1, 16, 16, 14, -4, -9, 10, -10, 10, 19, 8, 33, 13, 14, 12, 15, -9, -16, 11, 13, 3, -7, 10, 5, 17, 15, 5, 8, 17, -10, 6, -5, 12, 17, 5, -2, 26, 13, 7, 20, -18, 3, 9, -3, -2, 10, -11, 6, -15, -17, -8, -4, -12, 19, 2, 14, 6, 25, 19, 7, -1, 5, 5, 8, -1, 13, -8, -6, -8, -18, 13, 0, 14, 4, 3, 5, -6, -19, -7, -15, -5, -18, -22, -16, 5, 17, 2, -11, -7, -15, -7, -20, -28, -24, -14, -17, -9, 5, 7, 17, -3, -8, 8, -15, -1, -21, -20, 0, -15, -11, -19, -3, -9, -30, -22, -12, -4, -19, -26, -42, -15, -19, -18, -12, -14, -10, -12, 23, 16, 15, 0, 0, 8, 13, 5, 9, -20, -11, -14, 9, -25, -9, -23, -32, -26, -8, -20, -29, -32, -35, -17, 20, 16, 25, -5, -7, -7, -16, -15, -18, -1, -2, 1, -4, -5, -2, -2, -6, -3, 20, 15, 6, 2, 16, 16, -14, -6, -9, -15, 6, 25, -2, 4, -9, -13, -7, 10, 5, -15, -5, -9, -15, 6, 2, 0, -8, -17, -3, 1, 2, -12, 11, 9, -6, -10, 9, 13, 12, -2, 1, -8, -18, -19, -10, 4, 8, -11, 8, 12, -11, 11, -10, -19, -4, 7, -4, -11, 5, -1, -11, 6, 2, 3, -11, 4, 6, 13, -16, 0, -13, -5, 15, -5, -7, 5, -9, -4, -6, 11, -16, 9, -12, -16, -7, 8, 4, -7, 13, -3, 4, 4, 0, 11, -7, 10, 6, -13, 3, -9, -6, 4, -18, -11, 10, 14, 11, 10, -18, -2, -14, -16, -4, 15, 8, 6, 1, 2, 11, -7, 5, -19, -5, -7, -17, -2, 4, 8, -9, -9, -14, -3, 4, -18, -9, 10, -2, -12, 0, -14, -10, -1, 23, 4, 35, 41, 38, 32, 9, -3, -14, -29, -21, -6, 0, -25, -7, 10, -5, -1, 4, -17, 4, -19, -6, -13, -3, -10, 14, -16, 26, 19, 30, 54, 53, 27, 34, 1, -23, -37, -52, -45, -33, -38, -11, -20, -19, -8, -1, -4, -11, -2, -26, 9, -20, 23, 5, 13, 2, 16, 37, 36, 58, 66, 47, 29, 8, -5, -21, -37, -30, -24, 1, -13, -14, 0, 14, -9, -8, -10, -20, -14, -1, -8, 2, 17, 3, 8, 26, 13, 41, 45, 74, 58, 22, 10, 13, -3, -55, -51, -21, -12, -7, -16, 0, -15, -4, -6, 1, 10, -1, -5, 1, 8, -6, -1, 0, -4, 27, 61, 44, 78, 36, 29, 39, -7, -37, -32, -11, -25, 1, 5, 4, -15, 11, -7, -13, 7, -14, -2, -4, -28, -53, -55, -44, 2, 6, 51, 47, 45, 30, 48, 33, 27, -4, -24, -12, -4, -1, -13, 2, -13, 10, 10, -6, -15, -19, -22, -25, -30, -56, -47, -30, -32, -18, 14, 37, 37, 31, 31, 27, 18, 3, -15, -22, -28, -1, -17, 6, 15, 9, -8, -7, -1, -32, -44, -22, -53, -15, -28, -53, -67, -44, 8, 29, 30, 24, 39, 18, 33, 7, -28, -4, -21, 4, 5, 16, -8, -18, -21, -29, -12, -19, -36, -27, -5, -9, -48, -35, -61, -74, -62, -6, 29, 39, 40, 48, 28, 12, -7, -22, 6, -1, -4, 5, -7, -15, -25, -27, -24, -6, 0, -8, 21, -5, -30, -51, -55, -41, -45, -7, 24, 50, 39, 26, 14, -14, -24, -3, -17, 1, 8, 2, -15, -3, -16, -2, -11, 1, 4, 6, 2, -16, 0, -34, -22, -26, -22, 11, 9, 34, -1, 21, -18, -18, -17, -7, 9, 15, 5, 0, -4, -9, -12, -13, 23, 19, 2, -2, 14, -13, -16, -5, -22, 6, 2, 12, 33, 21, 11, -4, -32, -28, -40, -23, 12, -4, -5, -8, -20, 10, 4, 14, 16, 27, 28, 9, -6, -14, -14, -19, -19, -7, 22, 1, 10, -29, -32, -7, -16, -31, -17, -17, 0, -5, 2, -4, -10, -7, 5, 7, 26, 13, -10, 24, 11, -13, -5, -16, -17, -13, -8, 1, -37, -39, -47, -29, -39, -38, -33, -12, 5, -17, 6, 3, -14, -4, 21, 19, 14, -12, -15, 18, -5, -11, -12, -28, -17, -8, 2, 0, -18, -48, -45, -39, -14, -20, -6, -9, 9, 15, -11, -2, -13, 0, 9, -8, -21, -9, -2, -6, 4, 6, -10, -16, -22, -12, -25, -4, -27, -39, -48, -23, 6, -28, -8, -2, -7, -5, 5, -7, 11, -17, 8, -4, 1, 16, 27, 11, 24, -3, 1, 0, -1, -22, 9, -18, -14, -1, -23, -13, 9, 12, -19, 0, -10, 4, 4, -2, -18, 10, 19, 1, 16, 5, 11, 0, 5, 33, 31, 15, 9, 12, 21, 13, -1, 12, 5, 1, 9, 20, 8, 11, 8, -11, 12, -8, 6, 14, 17, 19, 0, -1, -7, 25, 23, 26, -7, 9, 7, 0, 8, 15, 18, -5, 3, -9, 5, 10, 20, 7, 1, -7, 0, -1, 1, 10, -10, 8, 38, 15, 35, 25, 7, 33, 30, 12, 16, 1, -4, -13, -3, 9, -13, -17, 11, 10, 24, 6, -14, 0, -8, -17, 10, 2, -20, -13, -2, 27, 28, 24, 54, 31, 31, 10, -3, -15, -6, 15, -14, -24, -40, 6, -3, 22, 4, 3, 6, -9, 10, -9, -6, -2, 2, 9, -4, -1, -2, 12, 16, 28, 53, 20, -6, -13, -17, 14, 9, 1, -31, -2, -2, -17, 14, -3, 5, -15, -4, 6, -4, 1, -9, -8, -13, -2, -19, -2, -5, 8, 0, -23, -29, -13, -22, -20, -30, 4, -2, -13, -21, 7, 2, 1, -12, 11, 4, -17, 2, 11, 0, -15, -1, 15, 19, 1, 8, 4, -16, -3, -1, 0, -11, -7, 20, 19, 7, 5, 2, 2, -19, -10, -3, 1, 15, 1, 5, 9, -5, 9, -7, 5, 2, 6, 12, -5, -4, -7, 10, -18, -18, 6, -10, -1, 13, -4, -8, 8, 9, -7, 5, 2, -5, 8, -5, 5, -16, -13, -12, 1, 14, -2, 9, 11, -8, 14, 15, 0, 13, 5, 1, 11, 10, 8, 12, -3, -12, -14, -1, 11, 10, -7, -3, 11, 4, -2, 7, 10, -16, 10, 16, 17, 9, -7, 13, -7, 0, -1, -3, -11, 8, 8, -10, -5, 2, -17, 13, 15, -14, -2, -17, 3, 4, -14, -11, -5, -11, 0, -9, -6, 12, 14, 16, 36, 14, 11, 3, 0, 18, 4, 6, -16, 9, 3, 16, -7, -2, -14, 15, -8, 2, 8, -3, -11, -11, -10, -12, -22, -8, 37, 25, 39, 32, 31, 24, 13, 11, -10, 16, -5, -5, 13, -9, 6, -11, 4, 7, 7, -10, 4, -26, -8, -1, -23, -10, -14, 19, 2, 40, 37, 15, 32, 33, 9, -2, 13, 7, 11, -9, -1, -14, -1, 1, -4, -6, 9, -6, -19, -16, -6, -3, 15, 16, 28, 14, 44, 45, 18, 10, 0, 1, 11, -1, -5, 7, 2, 14, 16, -17, 16, 10, 17, -17, 1, -2, -13, -36, -3, 10, -7, 19, 30, 47, 37, 45, 16, 14, 2, 0, -12, -15, -11, -5, -8, -6, -4, -8, -13, 15, -9, 13, -22, -18, -20, -12, -18, -5, 15, 30, 63, 58, 51, 34, 13, 6, -29, -8, -13, -9, -16, -34, -16, -9, 10, -4, -14, 3, 12, 2, -16, -45, -32, -16, -2, 24, 27, 43, 39, 35, 25, 20, -13, -15, -42, -13, -38, -1, -24, -48, -24, -26, -9, -9, -15, -3, 7, 5, -27, -9, -33, -3, 0, 20, 34, 35, 48, 32, -16, -24, -35, -55, -40, -35, -32, -35, -25, -42, -23, 13, 13, 12, -7, 2, 3, -2, -9, -21, 4, 1, 16, 33, 43, 41, 20, 1, -27, -40, -51, -20, -22, -19, -23, -27, -26, -43, -17, -11, -6, 1, -13, 17, -7, 4, 2, -11, -22, 14, 13, 16, 26, 4, -20, -30, -31, -55, -2, -9, 29, 8, -4, 4, 5, -4, 13, -2, -29, -5, 3, 6, -19, -21, 7, -13, 12, 31, 16, 6, -9, 16, -12, -42, -32, -13, 2, 5, 15, 11, 6, 5, 6, 20, 18, 5, -23, 9, -14, -9, -16, -12, -21, 23, 10, 19, 28, 3, 22, 13, -11, -33, -16, -26, -14, 3, 14, -9, 24, 18, -9, 15, 14, 2, 0, 0, 4, 2, 12, -6, -4, 22, 0, 10, 24, 9, 6, -1, -8, -5, -11, -24, -12, 17, 13, 2, 11, 26, 8, 14, 22, 26, -1, 3, -17, 9, -13, -12, -6, -18, 7, 7, 2, 1, 7, 8, -11, 5, -23, -32, -25, -7, -13, 22, 1, 1, 14, 9, 10, 5, -20, -10, -13, 16, -5, -3, -14, 5, -13, -8, -5, 2, 17, -3, 25, -16, -22, -22, -17, 1, -11, 3, 22, 22, 9, -4, 10, -13, -15, 1, 10, 12, -16, -19, 1, -7, 13, 3, -10, -7, -2, 23, 2, -22, -34, -21, 3, -1, 10, -1, 1, -1, 10, -14, -18, -9, -13, -16, 12, 15, -2, 3, 5, -3, -2, 7, 1, -20, 6, 16, -6, -18, -41, -29, -6, -4, 20, 7, 21, 0, 22, -8, -28, 9, -22, -9, 1, -16, -2, 1, 8, -15, -24, 0, -13, -2, -3, -3, -18, -37, -30, -22, 27, 27, 19, 8, 32, 38, -1, -6, 8, 4, 4, -5, 6, 5, -6, -1, 1, 14, 11, -5, -16, -11, -3, -1, -21, -29, -16, 6, 27, 31, 43, 15, 31, 29, -2, 1, 4, -4, 7, 7, 16, 0, 13, 5, 5, -11, 14, 12, -3, 1, -9, 12, -19, 5, -4, 16, 42, 48, 21, 18, 20, 30, 7, 6, -1, 20, -4, 2, 8, -13, 14, 4, 7, -7, -1, -32, -11, -3, -19, -1, -9, 14, 8, 25, 18, 36, 30, 12, 1, 12, -8, -13, 21, 16, 17, 9, -15, 7, -10, -7, 6, -21, -6, -30, -51, -23, -33, -35, -28, -9, 11, 26, 21, 40, 18, -1, 13, -14, 8, -3, -8, 0, -7, 5, 11, 13, 0, -4, 8, 6, -16, 0, -8, -10, -35, -12, -18, 7, 3, -5, 19, 3, 2, 17, -7, 10, 9, 22, 12, 2, 0, -5, 10, -12, 8, -8, 11, 10, -2, -14, -15, -21, -13, -12, -1, 7, 9, 9, -8, 3, 8, 10, 23, 18, 26, 27, 8, 8, -1, -5, 1, -10, 7, -14, -9, 12, -5, -14, 7, -1, 10, 16, -8, -11, 22, 19, 4, 4, 12, 26, 0, 21, -4, -8, 16, -16, -10, 15, 16, 14, 9, 13, 12, -6, 10, 14, 11, 7, 15, 2, -17, 13, 10, 14, -12, -3, 0, 13, 5, -16, 8, -15, -17, 6, -5, 12, -13, 8, 10, 19, 0, 22, 8, 8, -3, 26, 15, 25, 5, 17, 16, -5, 15, 18, 12, 9, 6, 0, 15, 26, 9, 3, 26, 16, 12, 11, 12, 8, 0, 15, -5, 17, 21, 7, 9, -2, 8, -5, -5, 17, -2, 10, 24, 6, -6, 18, 25, 9, 25, 13, -4, 18, 2, 22, -6, 26, 14, -4, -5, 9, 12, 10, 2, 10, 22, 2, 21, 18, -4, 13, 19, 25, 2, 32, 13, 0, 24, 18, 0, 18, 2, 2, 5, 7, -3, 26, -5, 7, 18, 11, 6, -9, -9, -5, -2, -2, -14, -10, 4, -2, 20, 21, 4, 14, 23, 0, 10, 0, 15, -3, 10, 24, 3, 15, 24, 18, 2, -2, 7, -31, -28, -51, -33, -35, -35, -27, -20, -14, -2, 0, 8, 30, 8, 20, 13, 6, 27, 3, 11, 17, 15, 20, 0, 15, -20, 5, 1, -20, -32, -31, -20, -7, -23, -35, -11, -16, 3, 13, 6, -3, 24, 11, -11, 10, 15, 5, 26, 26, 4, 24, -1, -10, -16, -20, -17, -22, -31, -26, -11, -10, 1, 9, 22, 20, -3, 17, 1, 7, -7, 13, -5, 2, 17, 2, 24, -3, 12, -3, -2, -13, -31, -14, -42, -36, -36, -24, 13, 25, 37, 38, 23, 31, 8, 13, 20, 12, -10, -19, 1, 9, 5, 19, 25, 10, 18, 15, -17, -8, -24, -22, -34, -44, -14, 6, 7, 17, 6, 4, 19, 3, -14, -3, -12, -1, -8, -9, 10, -4, 5, 16, -6, 18, 4, 1, -34, -36, -36, -45, -43, -3, -1, 30, 12, 36, 13, -18, -41, -35, -12, -49, -35, -18, -30, -4, -20, 19, 5, 26, -4, 19, 11, 9, -31, -61, -52, -35, -7, 2, 7, 27, 50, 33, 0, -9, -13, -15, -47, -51, -55, -49, -8, -15, -9, 14, 18, 19, 15, 19, -3, -5, -24, -56, -19, 13, -2, 19, 13, 44, 41, 9, 19, 3, -21, -6, -12, -26, -26, -25, -17, -14, -23, -17, 8, 16, -6, 14, 15, -3, -40, -42, -31, 17, -6, 31, 38, 65, 35, 30, 11, 0, -13, -12, 5, 9, -10, -27, -24, -28, -9, 13, 20, -5, 18, 12, 12, 2, -35, -32, -1, -13, 5, 23, 13, 44, 22, 17, 36, 30, 27, -7, -10, -12, -10, -30, -37, -24, -25, 15, 1, 0, -3, 23, 14, -13, -8, -24, 3, -1, -1, 25, 4, 23, 25, -7, 30, 20, 30, 27, -12, 6, -40, -41, -24, -11, -12, 0, 24, 16, -2, 15, 15, -3, -17, -36, -5, -10, -2, 30, 31, 23, -4, -8, 32, 45, 11, 17, 6, -13, -17, -5, -18, -32, -14, -1, 9, 18, 3, 19, 17, 4, -12, -35, -2, 14, 9, 16, 20, 7, -10, 21, 38, 43, 34, -25, -22, -23, -38, -10, -13, -29, -16, 15, 10, -5, -2, 6, -7, 13, -8, -31, -11, 6, 3, 50, 3, 0, -11, 14, 40, 16, -15, -29, -12, -35, -23, -15, -19, -11, -9, -3, -6, 2, -6, 19, -1, -6, -11, -17, -16, -46, -20, -14, 9, -2, 28, 26, 30, -22, -37, -47, -11, -23, -18, -14, 4, -6, 12, 24, 7, 9, 1, -10, -18, -7, 10, -13, -17, -42, -49, -27, -10, 23, 18, 29, 3, -13, -34, -39, -30, -23, -18, 0, -8, -8, 18, 15, -2, 13, 23, -4, 4, -12, -4, -2, -19, -37, -45, -17, -31, -10, 13, 13, 1, -23, -23, -37, -11, -25, 2, 3, 11, 12, 21, 13, 9, 13, 24, -5, -12, -15, -25, -6, -23, -2, -26, -4, -28, -8, 15, 5, -20, -29, -39, -7, -10, -7, -7, 5, -2, 6, -1, -6, 1, 8, -2, 22, 7, -9, -27, -22, -6, -21, 6, -5, -25, 4, 9, -6, -12, -20, 4, -32, -30, 3, 20, 3, 21, 7, 4, 2, 12, 20, 21, 24, 20, -1, -33, -17, -23, -11, -7, 11, 6, -8, -1, 4, -6, -10, -14, -10, -17, 8, 3, -7, 3, 7, 23, 12, 6, 23, 8, 25, -2, 18, 1, 1, -1, 1, -8, -5, -30, 1, -17, 13, -10, -10, 4, 3, -8, 10, 9, 8, 10, -3, 7, -2, 1, 15, 23, -7, 14, -2, 16, -10, -17, -10, 13, -15, -3, 17, 29, 16, 15, 19, 29, 22, 24, 3, 2, 17, 5, 0, -6, -1, 9, -7, 11, -2, 27, 21, 10, 31, 26, 8, 40, 39, 12, 26, 21, 62, 20, 47, 19, 33, 8, 17, 15, -5, 7, -7, 8, 19, 27, 13, -1, 21, 22, 3, 2, 21, 15, 5, 1, 14, 0, 23, -3, -1, 13, 10, -2, 3, 16, 23, 6, 0, 7, 15, 1, -2, 7, -14, -11, 10, -11, 4, -9, -17, 12, -5, 10, -20, 2, 4, -6, 15, -11, 7, 4, -8, -9, 13, 2, 4, -3, -8, -19, 1, -17, 1, 11, -16, -14, -1, -11, -4, 10, 0, 9, -9, 7, 9, -13, -19, -8, -5, -3, -15, 14, 2, -7, 2, -4, -13, -15, -11, 7, 2, -15, -5, 9, 11, -7, -1, 8, 14, -6, 4, -20, 8, 7, -27, -22, -7, 7, -20, 5, -13, -14, 9, -19, 12, -11, -11, -18, 8, 5, 13, -9, -12, -9, 12, 6, -1, 3, 9, -5, 0, 6, -1, 0, 13, -2, 12, -2, 23, -10, -11, -17, 6, -10, -18, -2, 12, -11, -11, 1, 12, 5, -5, -4, 13, 23, 12, 28, 33, 20, 2, 28, 3, 15, 23, 12, -22, -8, -22, -35, -5, 2, 14, -14, 9, 5, -3, -15, 6, -3, 1, -15, -3, 15, 24, 16, 2, 6, 14, 2, 23, 3, -1, -20, -13, -7, -4, -8, -5, 1, -13, -12, -6, -7, 14, 8, 14, 10, 22, -1, -1, 13, 6, 11, -8, 3, 18, -18, 11, 6, 5, 12, 13, -11, 16, 4, 14, -2, 5, 11, -6, 3, 7, -15, -4, -4, -3, 1, 10, -12, -12, 15, -13, -2, -1, -16, 3, 5, 8, 3, 0, 19, 3, -11, -9, 8, -12, -8, -9, -10, -2, -20, -2, -22, -14, -15, 12, -18, 5, 11, -15, 11, 8, 8, 13, 23, 4, 4, 9, 19, 8, 1, 12, 31, -2, -18, -19, -11, -4, 0, -4, 5, -6, 17, -10, -15, -10, -2, -9, 6, 4, 14, 28, 11, -10, -1, 6, 20, 21, 16, 50, 16, -1, 6, 9, -17, -1, 6, -21, -6, -23, 5, 21, -9, 3, -17, -1, 3, 17, 11, 39, 33, -5, -13, -14, 9, 16, 27, 37, 31, -5, -15, -14, 0, -16, -7, 1, -4, -5, 15, 3, -10, -11, 18, 14, 21, 26, 35, 4, 1, 6, -12, -25, -1, 19, 17, 14, 16, 11, 8, 2, 14, 4, -13, 8, 3, 4, -1, 16, 5, 16, 23, 34, 36, 13, 4, -5, -19, -8, -3, 9, 11, 8, -5, -4, -1, 18, 8, 1, 10, -3, -15, -4, 24, 16, 13, 23, -4, 31, 18, 41, 6, -1, -44, -38, -18, -12, 3, 13, 11, 19, 13, -14, -9, -6, -7, 2, 9, -19, -18, -8, 7, 2, 2, 1, 8, 4, 6, 25, -3, -37, -23, -35, -26, -11, 6, 16, 24, 4, 15, 5, -27, -18, 5, -13, 8, -7, 2, 28, 41, 6, -19, -17, -5, -6, 0, -13, -24, -37, -26, -21, -25, 17, 4, 23, 22, 5, 12, 45, -7, 0, 7, -6, 10, 14, -4, 8, 22, 13, -31, -47, -60, -54, -20, -24, -27, -43, -13, -17, -14, 30, 27, 29, -3, 17, 7, 15, -17, 13, 1, -4, 5, -11, -3, 39, 27, 3, -7, -54, -40, -66, -43, -39, -38, -54, 2, -19, 25, 24, 8, 2, -2, 18, 3, -20, -10, 9, 9, -8, -7, 13, 2, 4, 6, 17, 10, -3, -28, -15, -26, -50, -39, -12, -1, 27, 24, -10, 13, -17, 14, 1, -15, -17, -10, -7, -20, -16, -13, -10, 21, 2, 5, 3, 4, -2, -9, 7, 7, 19, 12, 26, 29, 18, 14, 19, -24, -15, -3, 20, -1, 2, -21, 0, 13, -15, -5, -3, 0, 18, 25, 12, 18, 13, 26, 36, 38, 32, 59, 34, 18, 1, 5, 11, -11, 0, -11, 15, 5, 2, -4, -17, 13, -17, -6, 7, 5, 2, 7, 26, 22, 28, 11, 38, 19, 39, 38, 27, 27, 22, -18, -6, -24, -1, 0, 16, -14, -2, -13, -7, -11, 13, -19, 11, 4, -1, 0, -14, 1, 21, 35, 24, 36, 25, 18, 2, 18, -3, -7, 9, 8, -10, -11, 10, -1, 0, 2, -19, 13, -5, 4, -5, 1, -3, -5, -10, -1, 5, 36, 21, 47, 10, 7, -9, 2, 19, -4, -23, -41, -38, -21, -22, 8, 16, 8, -7, -19, 14, 13, 0, 3, -9, -12, -4, 15, 4, -5, -2, -17, -11, -11, 1, -6, -11, 22, 7, -32, -19, -4, -6, 4, -13, -9, -10, 7, -15, -20, -6, 4, 10, 9, 1, 20, 8, -10, -29, -31, -25, -44, -32, -12, -13, -6, 5, 3, 18, 11, -6, 13, -12, -7, -17, -17, -5, 0, -15, 0, 7, 12, -13, -8, -1, -27, 11, 0, -8, -10, 14, 4, 11, -3, 8, -10, 15, -10, -20, 12, 9, -18, -7, 4, 0, 14, 9, -18, -12, -3, -12, -7, -7, -1, -2, -9, 1, -10, 11, -1, -24, -2, 12, -15, 7, -2, 9, 7, -15, -12, -13, 6, 13, 16, -4, -4, -17, 10, -6, -10, 16, -14, 1, -2, -6, -5, 13, -16, -8, 3, 0, -8, 15, -16, 4, -10, 7, 11, -10, 17, 17, -11, 2, -16, 15, 11, 11, -16, 11, -2, 1, -12, -15, 6, 2, -12, -9, -2, 13, -6, 12, 8, 12, 2, 7, 12, -6, -11, 2, -12, -7, 9, -1, -5, -2, 13, -14, -10, -9, -20, -4, -10, 7, 1, -13, 4, -12, -10, 3, 15, 15, -16, -15, -16, 10, 6, 13, -11, 10, 7, -15, -3, 13, -17, -8, -15, -25, -26, 2, -5, -27, -25, -17, -7, -15, -9, -14, -8, -17, -15, -4, 11, 15, -8, 15, 17, -1, 13, -15, 19, 16, 1, -8, -5, -24, -8, 6, -4, -41, -15, -25, -22, -18, -27, -11, -6, 11, -12, -6, -17, -15, 9, 11, -15, -7, 14, 10, 29, 25, 34, 16, 24, 1, 15, -1, 3, 9, 27, 16, -32, -27, -16, -23, -24, 11, -12, 3, -18, 1, 2, -7, -5, 13, -4, 19, 11, 15, 25, 27, 5, 14, 14, 1, 1, 2, -11, 1, -22, -20, -6, 2, -15, -9, 6, 0, 1, -1, 14, -7, 9, 17, 24, 5, 28, 22, 10, -5, 6, -13, -13, 7, -12, -8, -25, -35, -8, -24, -22, -21, -14, -19, -1, 1, -1, -3, -5, -4, 3, 9, 23, 2, 19, 8, -14, -20, -22, -13, -4, -4, -19, -26, -25, -19, -22, -18, -10, -10, -37, 1, 1, -12, 7, 3, -16, -2, 14, 0, 17, 14, 8, -19, -23, -48, -46, -41, -15, -13, -9, 13, 19, 21, 9, -13, -15, -30, -8, -19, -12, -25, -25, -1, 1, 9, 7, 16, 28, 7, -23, -34, -41, -36, -38, -18, -15, -3, 38, 16, 24, 23, 11, -9, -9, 8, -12, -2, -27, -32, -13, -1, -17, 8, -10, 11, 5, 1, -9, -17, -32, -20, -27, -7, 28, 31, 17, 12, 43, 19, -5, -2, 3, -12, -35, -20, -44, -27, -14, -13, 6, -7, 15, -1, 16, 2, -10, -33, -14, 10, 20, 24, 46, 36, 29, 3, 37, 20, 6, -7, -23, -10, -22, -24, -48, 1, -5, -13, -6, 12, 16, -2, 22, -3, -5, 1, 15, 17, 35, 45, 41, 9, -9, -6, 4, 2, 24, 22, -18, -9, 1, -6, -6, 7, 22, -7, 10, -10, -11, -6, 13, 10, 24, 4, 14, 24, 15, -1, 13, 8, -8, -3, 8, 3, 14, 32, 12, 19, 45, 18, 16, 26, 17, -13, 14, 8, 1, 10, 6, 9, 20, 6, 2, 2, 16, 5, 0, -2, -4, 20, 31, 23, 39, 1, 36, 19, 32, 60, 24, 3, -14, 17, -16, -15, -2, 6, -3, -11, 1, 16, 3, 24, 5, -17, -1, 9, 7, 31, 31, 23, 39, 42, 24, 35, 39, 36, 40, -5, -19, -15, -13, 11, 16, 10, -9, -11, 7, -18, 1, -28, -18, -11, -37, -30, 14, 29, 33, 19, -4, 21, 11, 0, 32, 29, 15, 19, 6, 6, -5, 8, 15, -11, -6, -5, -9, -24, -34, -15, -50, -35, -45, -28, 19, 6, 11, -18, -27, -25, -35, -21, 4, 3, -6, -19, 6, -7, 14, -7, 12, -13, -11, -11, -21, -18, -14, -41, -56, -65, -52, -38, -24, -6, 5, 0, -28, -48, -36, -19, -14, -23, -46, -22, 9, -11, 3, -15, 14, -17, -9, -28, -24, -33, -27, -39, -53, -36, -46, -29, -8, 8, -13, -26, -14, -38, -20, -18, -40, -18, -44, -18, 12, -7, -9, -7, -15, -8, -8, -17, -37, -13, -29, -24, -26, -25, -23, 1, 7, -15, -5, 2, -33, -3, -12, -44, -20, -40, -37, -11, -2, -7, 16, -9, 6, 12, 7, 4, 5, -24, 2, 6, 18, 16, 16, 5, -9, 2, -14, -32, -18, -15, -12, -13, -14, -35, -19, -3, -14, -6, -16, 15, -8, 6, -6, -3, -6, 4, 17, 17, 15, 31, 7, 17, -14, 8, -7, -25, -15, -20, 3, -32, -13, -22, -10, -18, -1, 0, 11, 14, -13, 10, -1, 0, -2, 15, 27, 18, 34, 28, 32, 6, -2, 14, -14, -14, -24, 1, -11, 0, -20, -22, -14, 11, 0, 3, 9, 16, 16, -1, -8, 6, -2, -4, 21, 0, 6, -6, 19, 24, 22, -16, -15, -14, -11, -29, -24, -30, -27, -15, -16, -12, 9, 4, -11, 16, 8, 16, 1, 12, -6, -5, 12, -16, 7, -16, -19, -31, -18, -43, -13, 1, -22, 4, -7, -17, -16, 5, 3, 14, 12, -1, 5, -11, -5, -14, 14, -11, 4, 5, -9, -10, 15, 1, -11, 7, 12, 1, -10, 16, 18, 15, 7, -13, 6, 1, 6, 12, -3, -11, 13, -1, 13, 9, 3, 6, 6, 6, -16, -14, 11, 7, 10, 1, -15, -10, 1, -10, 4, 5, 12, -10, -8, 7, -1, -12, -10, -19, -18, 1, -10, -2, 2, -11, 8, 6, -5, 0, -6, -17, 4, -27, -7, -9, -19, -25, -17, -11, 8, -17, 1, -16, 7, -18, -7, 9, -8, 10, -14, -15, -9, -4, -2, -9, -10, 3, 1, -23, -31, -19, -29, -31, -28, -4, -25, -19, -23, -16, -23, 2, 9, -3, 5, 11, 12, -12, 14, 8, -8, -1, -17, -21, -14, -31, -16, -14, -40, -37, -46, -46, -29, -49, -14, -10, -8, -26, 2, -13, -17, -5, -14, 13, -15, 1, -11, -19, 3, 3, -15, -27, -29, -9, -34, -58, -41, -36, -29, -30, -50, -34, -40, -15, -18, 0, 10, 14, -18, 5, -18, 9, -11, 13, -17, -15, -9, -13, -13, -10, -23, -10, -5, -22, -16, 1, -28, -26, -27, -7, -22, -7, 2, 8, 15, 1, -1, -8, 0, 10, -7, -10, 2, -5, 1, -21, 12, 6, 15, -17, -27, -1, -23, 1, -1, -11, -11, 15, -1, -5, 15, 29, 4, 8, 12, 8, -4, -20, -20, -3, 2, 2, 16, 2, -14, 9, -8, 1, -2, -19, -1, -17, -6, -6, -5, 13, -6, -11, 12, 15, 36, -1, -1, -4, 0, -2, 1, -5, 6, -11, -14, 9, 15, 19, 12, 0, -3, -13, 7, 2, 28, 11, 16, 7, -16, -6, 14, 4, 13, 11, 8, 18, 6, -4, 11, -10, 9, 7, -1, -22, 15, 3, 10, -6, -13, 17, 13, 34, 18, 36, 7, 13, -15, 15, 16, -2, 22, 0, -8, 6, 7, 3, 14, -10, -1, -10, -4, -28, 15, 12, 11, -1, 0, 9, 30, 3, -3, 16, 9, -4, 3, 12, 18, 3, 13, -12, -12, -19, -8, 8, -13, 7, 11, -16, 3, 2, 1, 4, 21, 27, 34, 18, 8, 9, -5, -32, 29, 16, -1, -6, -11, 19, 8, -15, -13, -13, 0, -5, -14, 11, -18, 15, 6, -2, 14, 24, 15, 24, 24, 22, -19, -12, -38, -23, 5, 19, 13, 8, 0, 1, -12, -24, -18, -14, 6, 10, -5, 4, -8, -10, -4, 13, 12, 3, 8, 13, -10, 8, -27, -31, -12, -18, 5, 1, 1, 2, -6, 11, -5, -27, -31, -27, 21, -3, -11, -4, -4, 3, 8, 33, 21, 0, 3, 18, -4, -1, -25, -34, -29, 1, 27, 24, 21, 4, 37, -2, -30, -30, -26, -35, 2, -16, 13, -5, 12, 9, 6, 17, -10, 22, -20, -10, -28, -17, -44, -13, 11, 18, 11, 36, 39, 21, -10, -14, -34, -10, -9, -23, -23, 7, 11, -8, 6, -10, -15, 6, 14, 13, 8, 14, -16, -2, -2, 15, 10, 6, 13, 21, 10, 29, -7, -2, 1, -5, -24, -32, 13, -1, -11, -13, -18, -2, -18, -5, -8, -3, 21, 11, -23, -5, 1, 25, 20, 6, 12, 13, 4, -9, -8, 1, -1, -2, -28, -8, -4, -6, 4, -16, 13, 10, 9, 5, -4, -14, -17, -19, -19, -27, -16, 7, 13, 17, 8, -15, 0, -25, -14, -5, -35, -43, -20, 5, -7, -9, -12, -5, -9, -13, -3, -4, -1, -39, -34, -7, -33, -25, -42, -23, 10, 20, -6, -7, -14, -14, -7, -11, -23, -48, -22, 15, 2, -17, 0, -10, -12, -15, -9, -25, -28, -47, -32, -39, -33, -24, -45, -23, -29, 2, 8, -19, -7, -20, -33, -40, -16, -24, 4, 9, 0, -10, -9, -10, -12, -18, -20, -29, -8, -22, -20, -8, -32, -11, -28, -11, -15, -18, -8, 6, -8, -19, -29, -23, 6, -22, -12, -7, 2, -19, -16, -2, -8, -21, -5, -20, -18, -26, -8, -25, 7, -11, -25, -19, -13, -6, -3, -18, -12, -3, 16, 20, 13, 15, -5, 15, -11, 9, 3, -4, -15, -16, -7, -24, -12, 9, 16, -6, -16, -10, 1, -18, -21, -22, -5, 9, 17, -3, 6, 36, 7, 19, -21, 3, 0, 6, -16, 4, -19, -8, -20, -21, -3, -9, 13, -15, 4, 1, -6, -8, -8, -14, 3, -9, -11, 11, 3, 5, -4, 10, 3, -5, -12, -4, -9, -1, -15, -1, 4, 12, -4, -9, -11, -9, 15, 13, -7, 2, 7, 14, 14, 17, 13, -5, -17, -9, -11, -21, -23, -17, 9, -9, -6, 2, 8, -11, 5, -2, 6, 14, -7, 8, 19, 9, 6, -6, 16, 34, 27, 12, -5, -13, 4, -6, -12, -9, 3, -1, -6, -7, -12, 12, -7, -9, -4, 2, 1, -8, 9, 2, -4, 1, -3, 14, -18, -8, 15, 4, 0, -10, -9, -6, 11, -11, -18, -21, -5, -15, 4, 5, -10, -17, -11, -17, 1, -9, 11, -19, 13, 3, -6, -11, -14, -13, 3, -2, 8, 0, 10, -18, -15, -10, -6, 0, -3, 6, -19, -4, -1, -7, 13, -8, -18, 1, -14, 9, -6, 0, -1, -12, -11, 7, 4, -12, -11, 6, 4, -17, 2, -7, -12, -12, 0, -19, 11, -11, -19, -2, 8, -19, 5, 9, 12, -1, -15, -15, -2, 19, 13, 27, 5, -11, -15, -5, 8, -3, -13, -4, 7, -1, -15, -11, -9, 6, -20, -15, -3, -6, -8, -10, 10, 19, 18, 1, 10, 12, 11, 33, 9, 8, 26, 8, -2, -23, 2, -12, -9, 12, -8, 13, -18, -5, -19, -6, -9, -8, -5, 20, 1, 44, 41, 16, 23, 17, 2, 13, 11, 9, 4, 18, 11, 16, -18, -6, -31, -14, -17, -13, -10, 10, -9, 6, 9, 11, 23, 25, 13, 20, 9, -9, -26, -26, -10, 8, 16, 5, 12, 13, 24, 3, 11, -14, -13, 0, 0, -20, -9, -19, -20, -6, -9, 17, 5, 2, 3, -4, -15, -24, -40, -19, 0, 7, 19, 3, 22, -2, -1, -5, 5, 10, 2, -8, 2, -2, -6, -5, -1, 10, -7, 15, 31, 11, -3, 4, -19, -21, -38, -37, -30, 1, -1, -4, -7, -16, 6, 1, 1, 2, -18, -12, -16, -22, 6, 14, -17, -1, -10, 32, 11, 4, 12, -5, 7, -22, -7, -10, 12, 14, 8, 17, 14, 10, 9, -7, -20, -15, -11, -23, -9, -11, -16, -8, 9, -4, 14, 9, 26, -12, 16, 0, 9, -5, -40, -3, -16, 13, 14, 38, 7, 4, 0, -15, 1, -4, -25, -25, -27, 3, -16, -7, -5, -17, 12, 23, -14, -5, 7, -8, -13, -27, -35, -22, 13, 7, 17, 17, 29, -7, 12, 1, -11, -13, -10, -40, -26, 4, -3, 0, 14, 3, 13, -5, -13, 3, -8, -2, -8, -37, -37, -33, 20, 18, 10, 3, -7, -21, 2, 4, -7, -25, -18, -16, -20, 9, 5, -13, 9, -9, 4, -11, -5, -23, -13, -18, -11, -35, -40, 16, 34, 32, 16, -6, -2, -27, 4, -2, -17, -26, -21, 32, -4, 6, -17, -16, -16, -17, -4, -43, -21, 2, -43, -19, -12, -29, 1, 11, 39, 33, 18, 8, -26, 5, -3, -17, 4, -19, 24, 3, 20, -10, -19, -14, -13, -10, -28, -28, -18, -19, -26, -22, -6, -10, 5, 30, 29, 35, -2, 3, 0, -18, 1, -22, 5, 3, 9, -4, 15, -7, -16, -14, 14, -3, -5, -5, -20, -5, -27, -4, -17, -17, 17, 15, 32, 30, 11, -2, -9, -23, -16, -17, -1, 0, 27, 32, 21, -7, 12, 1, -16, 10, 16, 22, -4, -18, 26, -5, 2, 15, 23, 17, 40, 30, -1, -6, -4, -13, 18, 14, 2, 17, 14, 22, 31, 5, -4, 1, 9, -12, 20, 18, 1, -17, 7, 28, 14, 12, 36, 37, 12, 25, -10, -19, -19, -4, 10, -2, 22, 32, 37, 14, 10, -11, 3, -15, 7, 12, 8, 26, 11, -11, 14, 3, 14, -2, 12, 21, 27, 0, -8, 10, 3, 14, 5, 0, 19, 38, 39, 21, 16, 5, -16, -4, -7, -2, 21, 13, -3, -10, 26, 12, 22, 27, 17, -11, -2, 9, 38, 29, 18, 21, 0, 0, 28, 30, 17, -1, 13, -9, -10, -19, -7, -13, 30, 2, -24, 10, 48, 21, 33, 16, 18, 17, -5, 28, 6, 16, 36, 26, 34, 38, 39, 5, 1, -1, -4, 14, -18, 11, -15, -8, 1, -3, -21, 25, 24, 26, 11, 16, 12, -12, 13, 25, 6, 4, 10, 5, 5, 2, -14, 11, -1, -21, 10, -20, -4, -8, -17, 7, -4, 1, 24, 1, 23, 5, 18, -11, 11, -15, 9, -9, 13, 1, 16, 9, 22, -12, 5, -7, -26, -22, 6, -19, -7, -14, -21, -2, 8, 28, 0, 9, 29, 17, 5, 19, 19, 1, -4, 6, -1, -8, -5, 18, 6, 0, 4, -13, -24, 4, -17, 8, 0, 6, -8, 1, -12, 13, 10, -9, -7, 3, -2, -19, -11, 9, -17, 13, -7, 5, -5, -13, -13, -12, -5, -4, -23, 0, -8, -16, -11, 4, 0, 13, 10, -11, 2, 4, 0, 7, 13, -8, 14, 8, -1, -25, -1, -28, -4, -13, -7, -26, -31, -14, -8, 11, -13, -14, -2, -16, -6, -16, 12, -7, -22, -25, -6, -24, -19, -17, -7, -38, -29, -46, -21, -29, -10, -11, -21, -6, -24, 7, -3, -9, 2, -5, 2, -18, -9, -9, 8, -12, -5, -9, 12, 2, -19, 12, -14, -23, -12, -10, -25, -5, -10, -5, 10, -2, -1, -11, -15, -5, -16, 12, 4, 8, 4, 12, -7, 9, 4, 0, -16, -2, -5, -13, -5, -17, 13, -1, -16, -12, 8, -2, -8, -7, -5, -5, 1, -5, -8, 10, 13, 2, -13, 10, -3, 8, 6, -11, -12, -14, -19, 5, -16, -2, 11, 3, 10, -14, -13, 3, -4, 0, -14, 12, -5, 12, 12, 8, 0, -6, -9, 9, -6, 4, -9, -6, -1, 6, 1, 8, -21, 5, -7, -8, -13, 8, 10, -8, 1, -6, 1, -4, 10, 16, -6, -5, 7, -17, -8, -12, 3, -4, -10, -8, 6, -11, -9, -20, -28, -11, -15, -21, 14, 14, -6, -25, -37, -19, -13, 7, 12, 8, -20, 9, -12, -3, 8, 7, 1, 6, 0, 6, -1, 2, -19, -24, -8, -9, 6, 25, 21, 16, 37, 18, -5, 7, -17, -2, -22, -29, 13, -13, -7, 9, 16, 13, 5, 5, 2, -17, -24, -29, -31, -34, -12, -11, 20, 4, 27, 19, 13, 10, 16, 2, 1, -34, -29, -6, -20, 12, 13, 14, 3, 4, 6, 9, -20, -24, -9, -38, -26, -21, 3, 8, -6, 18, 23, 14, 11, 17, -9, -8, -9, -1, -8, -31, 9, 7, -5, -6, 14, -8, 13, 5, -24, -28, -25, -20, -14, 0, -6, 12, 7, -27, 18, -11, 8, 21, 15, 10, -7, 10, 9, 6, -17, 11, -2, -7, -17, 6, 3, -21, -1, -22, -4, -21, 4, 2, 1, 4, 7, -4, -10, -12, 5, 1, 8, 2, -7, 12, 5, 6, -12, 9, 12, -9, 8, -4, -14, 5, -24, -9, -16, -9, -2, 4, 3, -14, -15, -11, -24, 6, 15, 6, 18, 19, -3, 14, 19, 4, -19, -7, -13, 11, -10, -2, 3, -15, 0, 7, -6, 5, 10, -24, -1, -18, 3, -2, 2, -1, -17, 10, 3, 23, 29, 21, 26, 15, -4, 4, -10, -2, -13, 5, -8, -4, -16, -2, 29, -6, -15, -25, -38, -22, 10, 26, 24, -12, -22, -12, 0, 14, -4, 26, 25, 36, 12, -13, 13, -11, -7, -4, -19, -8, 1, 4, -5, -17, -18, -7, -25, -24, 23, 30, 5, 6, -6, 1, 17, 4, 19, 18, 27, 28, -11, -4, 15, -5, 1, -1, -23, -35, -7, -8, -23, -13, 4, -16, 3, -15, 24, 11, 29, -2, -21, -13, -18, 1, 15, 23, 26, 50, -3, 5, -10, -15, 16, 4, -3, -23, -7, -3, 9, 8, -4, -15, 23, 12, 29, 25, 7, 2, -1, 7, -18, 1, 12, 21, 18, 33, 1, -1, -4, 0, -18, -18, -11, -18, 4, 3, 21, 18, 13, 14, 13, 26, 11, 16, -22, -4, 0, -16, -25, 5, -4, 14, 20, 20, -11, -1, -16, -12, -7, -19, -25, -22, 7, 3, 29, 19, 29, 45, 18, 16, 11, -15, -12, -30, -16, -9, -37, -16, 1, 0, 10, 11, -7, -14, -15, 5, 2, -13, -5, -2, 8, 18, 29, 21, 42, 51, 36, 2, -11, -34, -27, -29, -49, -33, -10, -6, -1, -3, -6, 11, -6, -18, -4, -18, 12, -16, -2, 0, -8, 11, 26, 34, 48, 29, 20, 12, -6, -35, -62, -30, -17, -7, -12, -13, -10, -10, 22, 16, -16, 4, -4, -16, 11, -3, -24, -29, -8, -5, 23, 21, 19, 25, 17, 0, -36, -66, -45, -15, -30, -9, -21, -3, -4, 32, -3, 1, 13, -6, 16, -12, 4, -14, -25, -22, -16, 18, 32, 33, 20, 36, 3, 3, -46, -37, -22, -37, -17, -14, -16, -3, 19, 11, -12, 2, -6, 7, 16, -7, 8, 10, -21, -25, 16, 19, 43, 15, 9, 12, 17, -4, -2, -22, -14, -36, -21, -2, -1, 3, -22, 2, -10, -18, -4, -7, 1, 0, 10, -13, 4, 0, 21, 31, 15, 17, 24, 10, -3, -3, -10, 13, -8, -24, -8, -25, -4, -5, -26, -24, -7, 4, -10, -20, -8, -17, 9, 15, 5, -23, 8, -7, 28, 28, 21, 16, 25, 10, 13, 19, -7, 13, -7, -21, -10, -32, -20, -20, -10, 2, 3, 10, -18, -1, 14, -7, -2, -2, -36, -18, -33, -4, -4, -8, 14, 2, 23, 13, 13, 3, -24, 5, -14, -17, -8, -1, -5, 3, -19, 9, 15, -9, 8, -18, -2, -15, -12, -7, -10, -12, -23, -9, 7, -16, -12, -19, -12, -8, -26, -7, -23, -9, -11, -21, -24, -17, 14, 13, -9, 14, -10, -16, -18, 8, -2, -12, -17, -12, -13, -18, -14, -4, 1, -22, -27, -4, -7, 2, -5, 11, -9, -2, 12, -1, 12, -8, -14, 7, -2, -4, -10, 3, 4, -6, -6, -12, -3, 0, 12, -12, -3, -2, 5, -10, 5, -2, 5, 8, 11, 11, 15, -11, -4, 6, 9, 19, -9, 12, -3, 5, 0, -9, 19, 7, 20, 8, 18, 13, -1, 18, 22, -12, 1, -10, 0, -8, 1, -4, 16, 21, 8, -6, -9, 3, 17, 8, 17, -11, 17, 19, -10, 4, -7, 22, -3, -9, -7, -1, -8, 5, 17, -6, -6, 7, 9, -6, -8, 10, -9, -6, 5, 2, 18, 16, 10, 7, 16, 0, 1, -9, 21, 19, 20, 0, 18, -4, -7, 5, 19, 7, 21, 22, 9, -8, -5, 8, -4, 16, -11, 13, 22, 0, 10, 19, 11, 9, 1, 18, 22, -2, 7, -7, 9, 10, 6, 11, -5, -5, 12, 22, -1, 5, 17, -7, 10, 0, 14, -4, 11, -2, 23, 15, -6, 11, 1, 5, -13, 17, -14, -1, -6, -7, -4, 1, -10, -4, -7, 9, -10, 5, -10, 1, -8, 21, -5, 1, 8, 12, 14, 12, 1, -7, -11, -11, 7, 5, -15, -6, -17, -19, -9, 12, -1, -2, -21, 6, 4, -4, 9, 6, 3, 17, -6, -10, 12, -11, 5, 13, 19, -4, 14, -13, 12, -12, -14, 1, -11, -7, -5, -18, -15, -4, 9, 6, -3, 6, 11, 16, 0, -2, -3, -2, 17, 14, -6, 12, 12, 10, -6, -20, -15, 2, 8, -13, -8, 11, 10, 1, 11, -14, -5, -16, 9, 8, 9, 13, 7, 14, 10, 22, 8, -10, 1, -11, 2, -21, 13, 3, 6, 2, 4, 10, 1, -10, -20, -12, 5, 4, -12, -8, 2, 6, 0, -6, 18, -4, 20, -2, -12, -4, -6, -9, 11, 0, -11, 6, -17, -10, 2, 0, -13, -7, -6, 2, -11, -2, 3, -13, 8, 4, 11, 11, 8, 1, 11, 1, -11, -7, 6, 20, 4, -17, 18, 15, -8, -5, 11, 5, -9, 7, -20, -17, 3, -16, 2, 8, 12, 11, -9, 0, 15, 21, 21, 6, -11, 13, -3, 16, -9, -1, 14, -8, 9, 10, -11, -5, -11, -4, 2, 10, -8, 9, -3, -14, 7, 6, 3, 20, 4, 14, 1, 19, 3, 12, 11, -9, -12, 6, -4, 8, 0, -3, 2, 9, -17, 0, 11, -15, 11, 8, -11, 16, 8, -7, 17, 21, 0, -4, 22, 15, -11, -4, 5, 3, -6, 8, 8, -4, -1, -8, -5, -11, -13, 7, -17, 10, -6, -19, -4, 5, 7, -11, 4, 19, 0, -4, 18, -9, 2, 4, 14, 2, 17, 13, 19, -9, 5, -13, 15, -6, -5, -15, 8, 8, -2, 3, 20, -1, -9, 1, 7, 0, 21, 0, -8, 2, 14, 20, 4, -5, 5, 8, 12, 15, 0, 4, -12, -10, 7, -9, -5, -7, -8, 16, -5, 5, 14, 9, 13, 13, -5, -11, -9, 5, 16, 22, -4, -1, 7, -3, 9, -4, 2, 16, 4, -7, 5, -16, -12, -4, -12, -16, -13, -6, 18, 4, 11, -4, 22, 6, 9, 8, 12, 15, 22, -5, 7, 12, -10, 3, -4, -1, 9, -11, 9, -14, -3, 10, 7, 6, 15, 0, 18, -6, 8, -2, 16, -5, -10, 10, 12, 10, 19, -3, 18, 8, -5, -6, 2, -2, -2, 8, -5, 7, 4, -8, -12, 11, 10, 17, -15, -5, 1, -5, -11, 13, 22, -8, 1, -7, 11, 11, 16, 3, 4, -20, 9, 0, -14, -14, -8, 0, -1, -18, -18, -16, 8, 11, -13, -14, -14, -2, 5, 8, 12, 3, 15, 14, -10, -16, -12, 13, -17, -9, -13, -20, -1, 12, -5, -12, -5, 5, -11, -10, -2, -9, 4, 0, -1, 20, 11, -6, 0, 12, 1, 7, 21, -9, 13, 12, -1, 7, -18, 1, 8, 8, 10, 3, 3, 7, -8, -16, 17, -7, 13, -6, 9, 6, -3, 10, 12, 7, 16, -3, 14, 5, -7, 11, -17, -3, -9, 0, 14, 3, -8, -14, -19, 3, -18, -6, 8, -2, 3, -6, 13, 16, 6, 11, 16, 5, -10, -7, 19, -3, 2, -17, 0, -10, 5, 1, -11, -8, 7, -5, -15, 12, -8, 4, -12, 16, -2, -4, -5, 6, 17, 18, -5, -8, 15, 0, 10, -13, 18, -18, 13, 4, 7, 7, -6, 5, 8, 13, -2, -10, -16, 6, -3, 12, 12, 14, 18, 0, 15, 4, 16, -11, 0, 2, 3, 18, -10, -4, 12, 0, -18, 14, -16, -8, 2, 15, 3, 6, -10, -13, 14, -10, 11, 15, 14, 19, 22, 8, 18, 14, 13, 19, 19, -4, 0, 13, -2, -2, 14, -14, -2, 9, -6, 15, 17, -7, 0, 19, 8, 19, 4, 14, 14, 10, 16, 13, 7, 11, 4, 17, 22, 3, 8, -2, 20, -3, -7, 0, 20, 7, 6, 10, 21, -12, 9, 0, 0, 5, 4, -3, 19, 17, -10, 4, 18, 11, -9, 12, 18, 19, 19, 6, 15, 17, 13, 12, 12, -5, -2, -6, -14, -5, 14, 9, 4, 18, -6, 15, 9, -7, -9, -13, 0, -8, -2, 0, -4, -12, 9, 6, 8, 18, 7, 14, -10, 11, -12, -9, 19, -1, -4, 5, -11, -14, 11, -13, -13, -5, 5, 2, 0, -7, -11, 6, -5, -7, 7, 12, -6, -6, 9, 12, 8, 19, 12, -10, 12, 17, 10, 14, 0, 12, -8, -8, -5, -8, -9, 10, -2, -9, 11, 8, 17, 11, 1, 2, 0, -3, -8, 3, 12, 4, 9, -1, -13, -8, -5, -22, -32, -30, 0, -13, 7, 14, -9, 15, -9, -4, 10, -3, 0, -16, 8, -13, -17, 11, 10, -6, -12, 9, -5, 6, 8, 15, -7, -12, -6, 2, -29, -19, -14, -6, -8, 17, 8, -3, 2, -7, -13, -1, 7, -13, -10, 0, 5, -6, 8, 19, -4, 14, 2, 10, 4, 14, -13, 5, 17, -20, -7, -13, -13, -8, 3, 13, 4, -9, 8, 19, 11, 8, 10, 17, 15, 4, 3, 21, 24, 8, -8, -1, 14, 4, 6, 2, 1, 9, 2, -9, 7, -7, 3, -10, 1, -12, 9, 3, 23, 27, 26, 3, 6, 35, 24, 12, 18, 16, 17, -6, 1, 3, 4, 9, 17, 3, 13, -19, -22, -6, 9, -10, -8, 5, 11, 26, 17, 27, 12, 25, 17, 39, 8, 30, 39, 18, 13, 7, 17, -1, 13, 7, 8, 1, 11, -19, 1, -12, 2, -1, 20, 12, -9, 19, 7, 15, 8, 28, 36, 24, 17, 35, 29, 40, 25, 8, 15, -6, 0, 2, -9, -18, -10, -11, -13, 20, -14, 14, 2, 4, -5, 2, -15, -4, 6, -11, 7, 18, -9, -16, 4, 16, 11, 5, 3, -13, -3, 4, -6, -3, 4, -23, 6, 21, -13, -7, 12, -4, -2, -10, -6, 6, 22, -10, 0, -34, -36, -40, -49, -20, -16, -14, -11, -2, 9, 10, -15, -24, 1, 20, 19, -3, 4, -10, -6, 20, 9, -5, -35, -8, -3, -3, -34, -43, -53, -37, -35, -13, -12, 7, -20, -5, -29, -10, -1, -15, -1, 8, 8, -4, 9, 16, -6, -1, -5, -13, -23, -24, -35, -42, -28, -39, -29, -19, -23, -5, -15, -3, -4, -15, -25, -18, 6, -23, 7, 12, 16, 2, 6, 6, 3, -7, -15, -20, -28, -40, -39, -66, -35, -34, -23, -7, 23, 6, -1, -18, -19, -4, -1, -6, -14, 2, -11, 8, 30, 0, 11, 13, 18, -12, -24, -35, -44, -32, -59, -42, -23, -12, 15, 13, 7, -3, -3, -26, -14, -10, -9, -8, -16, -16, -12, 26, 8, -5, -11, 17, -10, 7, -2, -33, -44, -59, -47, -14, -7, 23, 55, 17, 12, -7, -16, 4, 4, -5, 0, -3, -13, -3, 22, 21, 34, 15, -9, 4, 5, 14, -12, -36, -40, -62, -15, 24, 48, 57, 23, 22, 15, -2, -21, 0, -10, 6, -16, 1, 2, 7, 0, 43, 19, -4, 17, -5, 10, 15, -15, -31, -41, -36, 1, 27, 28, 42, 16, 19, 16, -15, -14, -35, -11, -21, 0, 5, 8, 12, 31, 17, 13, 13, -1, -3, -3, 10, -13, -45, -36, -31, 36, 51, 33, 47, 20, 31, -2, -4, 0, 16, -6, -20, -4, -18, -8, -4, 20, 9, 13, 22, -1, -11, -11, 19, -11, -39, -45, -13, 12, 26, 29, 26, 22, 41, 11, 5, -1, -13, -15, 1, 7, -9, -13, -22, 21, 19, 11, -3, 10, -10, -10, 2, -7, -3, -32, 10, 0, 23, 31, 9, 14, 0, -1, 13, -1, -15, -17, -25, -9, -17, 2, 7, 0, -3, 16, 3, 5, -10, 17, 4, -20, -7, -5, 11, 6, 19, 14, 14, 6, 2, 1, 17, 2, -13, -26, -33, -9, -21, -14, -7, 16, 18, 8, -2, 6, 15, 19, -12, 4, 7, -16, 4, -4, -1, 5, 28, 21, 44, 17, 30, 14, 14, -33, -21, -7, -26, -20, 14, 11, -14, -3, -12, 10, 7, 5, 3, -20, -5, -30, -4, -28, -2, -4, -5, 22, 33, 8, 18, 5, 5, -12, -25, -4, -22, -27, -30, -9, 5, 20, 6, -1, -4, -10, 10, -4, 5, -27, -24, -14, -13, -14, -25, 0, -19, -24, 5, -8, -16, -7, -29, -31, -1, 6, 5, 6, 8, 16, -4, 14, 3, 5, 0, -4, -6, 0, -7, 18, 23, 10, -2, -25, -19, -20, -6, -6, 5, -1, 3, 10, 0, -18, -12, -5, -13, -2, -6, 8, 14, 19, 16, -5, 12, -5, 10, 2, -14, 17, 18, -8, -9, 4, 14, 0, 9, 6, 10, -7, 7, -4, -1, -13, 17, -11, -6, 11, -10, -16, 2, -13, 2, 7, -25, -17, -16, -24, -24, 6, 7, 5, 6, -12, -13, -12, 4, -15, 5, 4, -15, 4, -15, 5, 7, 6, -2, -7, 7, -24, -16, -19, 4, -18, 1, -10, -10, 0, -16, -5, -18, 1, 10, -1, -18, -22, 2, -22, 2, -7, -21, -6, -14, 5, -12, -14, -14, -17, -5, -19, 8, -26, -22, -27, 1, -23, -5, -12, -24, 5, 4, -23, -1, -11, 6, -13, -23, -13, -24, 1, -16, -12, -13, 4, -19, -11, 4, -1, -11, -10, -3, -13, -6, -13, -4, 12, -19, 10, -3, -16, -20, -11, -21, -26, -24, 1, 3, -19, -14, 0, -16, -24, -12, 5, 3, -7, -19, -23, -1, -8, -5, 3, -9, 8, 20, 24, 30, 11, 17, 10, -17, -23, -6, -2, -6, -16, 8, -18, -21, 8, -22, -24, -16, -10, -33, -14, -41, -11, -24, -1, 15, 24, 6, 8, 22, 16, 17, 0, 32, 28, 12, -18, -11, -13, -20, -12, 6, -17, -25, -27, -18, -11, -30, -27, -32, -22, -12, -8, 21, 10, -3, 17, 11, -3, 11, 2, 13, 0, 11, 16, -9, 1, -4, -2, -2, -4, -7, -4, -27, -22, -17, -18, 2, 10, 11, 2, 7, -2, 16, 12, 6, 4, 22, -6, 17, 8, 4, 10, -12, -13, -7, -19, -14, 9, -26, -19, -29, -4, -3, -11, -9, 7, -6, -8, 12, 6, 2, 15, 27, 8, 23, 2, 24, -5, 21, -1, 28, 4, 10, 6, 5, -16, 6, -12, -2, -23, -4, 8, 17, 0, 6, 20, 1, 2, 32, -4, -5, -4, -5, 15, 3, 6, 22, 21, 23, 10, 8, -18, 8, -1, -12, -29, 14, -1, 7, 13, 13, 1, -1, 4, 2, 2, 7, 9, -13, -26, -7, -7, -4, 28, 20, 15, 31, 18, 17, -10, 2, -9, -13, -6, 5, 18, 19, -3, 15, -18, -30, -19, 12, 2, 19, 0, 8, -32, -9, -28, 16, 8, 38, 49, 31, 20, -3, -21, -21, 4, -9, 0, 27, 32, 6, -6, -3, 6, -32, -42, -24, 23, 9, 18, 4, -24, -11, -16, -8, 17, 24, 7, 20, -10, -3, 7, -16, 1, -24, 3, -16, 15, 15, -2, 2, 6, -20, -19, 21, 19, -1, 11, -1, -17, -33, -8, -8, -13, -9, 11, -11, 14, -16, 3, -11, -22, -4, -10, 5, 3, -3, 5, -14, -27, -7, 0, -2, 18, 33, 16, -4, -19, -7, -16, -3, -1, -6, -12, -12, -10, 10, 6, -16, -9, -23, -12, -11, 8, -3, 10, 10, -1, -1, -8, 24, 15, 8, 11, 1, -27, -12, -34, -4, -3, -15, -12, 10, -17, 1, -21, -8, -12, 2, -3, -7, -10, -10, -4, -10, 12, 17, -5, -1, 23, 26, 5, -17, -7, -35, -33, -38, -6, -23, 12, -15, -6, -1, 9, -14, -19, -15, 0, -10, 4, -13, -17, -25, 14, -13, 12, -4, 4, 12, 7, -2, -35, -34, -16, -20, -29, 5, -5, 16, -14, -11, -12, 4, -14, -13, -14, -11, -6, 13, -27, -7, 17, 5, 9, 8, 1, 4, -4, -20, -16, -12, -1, 5, 5, 17, 26, 31, 1, -2, -12, -8, -14, 5, -17, -4, -6, -1, -5, 23, 4, -4, -8, -7, 12, -15, -12, -6, 5, 9, 5, 13, -7, 27, 37, 11, 3, -5, -1, 1, -7, -17, 4, 5, 17, 16, -2, 31, 12, 19, 5, 1, -17, -19, -9, 6, 14, 27, 1, 22, 29, 37, 14, 18, 14, 0, -11, -8, -7, 5, 1, 13, 13, 59, 25, 6, 0, 13, -1, -10, 1, -11, -16, 9, -1, 13, 0, 5, 5, 1, 1, -14, -1, -14, -16, 6, -11, 3, -4, 20, 33, 43, 34, 11, 14, 4, 0, -20, 13, 23, -12, 5, 14, 1, 18, 18, 10, 11, 21, -11, -12, -7, -22, 4, -1, -9, -13, -20, -19, -1, 11, 24, 5, -1, 4, 6, 25, 18, 1, 26, -4, 2, 0, 21, -8, 8, 22, -3, 6, -24, 3, 0, -2, -7, -3, -36, -18, -47, -15, -24, -11, -8, -3, 35, 12, 16, 23, 22, -13, 30, 2, 11, 0, -9, 5, 7, -11, -16, -6, -11, -6, 3, -24, -14, -37, -5, -7, -15, -21, -25, -28, 1, 11, -2, 16, 21, 13, 4, 9, -16, 10, -10, 0, -4, -24, -21, -15, -10, 4, -24, -24, -14, -12, -27, -17, -7, -14, -22, -2, 12, 6, -6, -4, -19, -16, -17, -20, 1, -7, -2, -15, -23, 9, -19, -23, -19, 5, -15, 4, -22, -8, -15, -20, -10, -25, -4, -14, -16, 2, -18, -9, -19, -12, -3, -23, 1, -25, -17, -18, 6, 9, -20, -22, 10, 10, -9, -7, -8, 11, 11, 6, 5, -1, -19, -11, 6, 2, 13, -15, -4, 12, -8, 11, -10, 10, -11, -1, -10, -10, 2, -15, -19, -16, -11, 9, 8, -4, -5, 14, 8, -16, -16, -18, -15, -16, 6, 0, -10, -18, 6, -6, 7, -1, 3, 1, -9, -19, 1, 15, -16, 3, 2, 13, -2, -19, 12, 13, -1, -12, -20, -21, 6, -4, 0, -15, -4, -15, -24, -16, -5, 4, -1, -11, -18, -8, -6, -17, -13, -16, 13, 10, -8, 6, -3, 8, -22, -15, -23, -5, -2, -10, 8, 4, 1, -21, -3, 0, -23, 0, 3, -18, 14, -16, 8, -10, -3, -13, 12, 0, -14, -8, 16, -13, -5, -13, -5, 19, 20, 3, 7, -20, -17, -9, -16, -4, -17, -41, -5, -19, 5, -18, 8, 0, 11, -9, -10, -2, 16, 13, 27, 10, 14, 1, -11, 24, 38, 9, 11, 2, 7, -26, -7, -10, -28, -43, -16, -3, 0, 8, -5, 13, -16, 2, -8, 9, 19, 10, -1, 0, -4, 35, 19, 16, 16, 27, 25, 4, 36, 13, 9, -16, -26, -8, -33, -36, -10, -7, 9, 9, -5, -2, 10, 2, 19, 4, 24, -5, 3, -8, 7, 18, -4, -2, 19, 14, 20, 9, 28, 14, 0, -31, -19, -13, -30, -18, 12, 13, 9, 9, 9, 17, 13, -12, 10, 18, 6, 18, -2, -11, -7, -1, -1, 21, 8, 11, 41, 11, 10, -18, 1, -11, -42, -13, -8, -13, 13, -5, -9, 29, 16, -2, 16, 14, 34, -3, -18, 0, -13, 20, 6, 35, 10, 35, 29, 35, 20, 5, 0, -9, -23, -18, -2, -5, -13, -14, -4, 17, 30, 27, 39, 24, -2, -5, 0, -26, -21, 2, -1, 19, 36, 26, 3, 11, 19, 16, -2, -17, -50, -25, -22, -5, -8, -4, 7, 19, 28, -1, 10, 19, -20, -7, 3, -15, -12, 3, 26, 38, 21, 24, 35, 25, 33, 13, 13, -18, -28, -20, -17, -11, -11, -14, -7, 29, 30, 9, -17, -11, -7, -21, -14, -8, -13, -7, 50, 31, 30, 10, 27, -6, 22, 6, -10, -13, -35, -22, -7, -3, -18, -10, -6, 10, 24, -17, 2, -6, 5, -20, -12, -27, -29, 4, 30, 22, 23, 32, 29, 16, -2, -14, 0, -21, -12, -19, 0, -14, 4, -15, 12, 9, 23, -38, -41, -43, -22, -8, -26, -9, -23, 5, 18, 26, 40, 30, 11, -2, -20, -4, -8, -15, -5, -14, 1, 9, 6, 2, 6, 15, 0, -36, -44, -51, -44, -11, -24, -7, -16, 9, 40, 38, 10, 34, 11, -15, -15, 7, 16, -3, -12, -11, -15, -2, -12, -18, -7, 9, -5, -34, -31, -19, -21, -6, -15, -24, 3, 5, 33, 0, 7, 23, -1, -17, -9, -12, -6, -20, -26, -26, -1, 3, 14, 6, 15, -3, 0, -35, -43, -17, -26, -33, -47, -38, 3, 5, 18, 23, 12, 17, -20, -13, -7, -1, -10, -1, -15, -24, 3, 9, -11, -10, -3, 8, -36, -35, -41, -34, -13, -17, -19, -41, -35, -19, 13, 6, -17, -17, -13, 6, -6, -8, -11, -38, -38, -8, -6, -18, -6, -13, -6, -16, -10, -25, -24, -19, -5, -33, -26, -28, -27, -3, 1, -11, 3, 2, -20, 0, -8, -1, -20, -38, -11, -12, 10, -9, -7, -18, 8, 10, -3, -15, 0, 0, 7, -16, -36, -51, -36, -1, -14, -29, -2, -6, -20, -6, -1, -12, -32, -24, -14, 10, -13, 0, -6, -10, 10, 14, 4, -4, -5, 12, -15, -12, -17, -3, -12, -24, -4, 2, -1, -24, -32, 5, -30, -31, -30, -37, -21, 14, -10, 4, 8, 13, 2, -17, -10, 1, 11, 12, 1, -10, 19, 2, -12, 2, -2, 9, -13, 6, -31, -18, -18, -38, -17, -2, -16, -11, 3, -15, -15, -6, -11, 9, -18, 10, -1, 12, -13, -10, 19, 18, 1, 14, -9, 4, 1, 4, 5, -19, -16, -20, -30, -4, -15, 12, -6, -5, 0, 10, 14, -7, 30, 28, 22, 23, 24, 14, 23, 7, -22, -1, -13, -7, 5, 6, -24, -12, 1, -11, 2, -22, 7, 3, -13, -4, 13, -2, 11, 6, -11, 9, 37, 33, 48, 42, 15, 32, 30, 13, 7, 13, -6, 3, 19, -1, -4, 5, -5, -12, -21, -17, -11, 9, -8, 5, -18, 12, -5, -8, -10, 25, 35, 23, 36, 22, 11, 18, 31, 32, 34, 28, 17, 9, 10, 11, -16, 1, 3, -3, 15, -13, -16, -16, -19, -1, 14, 9, 13, 1, 5, 12, 1, -8, -14, 2, 12, 4, 6, -5, 14, -8, -8, -4, -7, 10, -18, 12, 15, -5, -2, -20, -14, -22, -17, -8, -20, 1, -9, -9, 6, 3, 2, 7, -23, -11, -13, 9, 8, -11, 9, 11, -12, 8, 11, -4, -12, 2, -13, -21, -21, -20, -21, 6, -9, -9, -10, -4, -11, 6, -24, 8, -20, -16, -22, -8, -17, 6, -23, -23, -18, 5, 4, -13, -7, -18, -7, 10, -3, -20, 7, -22, -1, -2, -12, -17, -19, -23, 0, -20, -4, -1, -6, -5, -10, -16, -26, -20, -7, -11, -15, -11, -10, 7, -7, 6, -13, 5, 11, -16, -19, -11, -1, -21, -28, -14, 9, -3, -11, -1, -9, -17, 1, 8, 1, -7, -8, -3, 3, -7, 7, -2, 8, -22, -7, 0, -21, -9, 1, 6, -7, 13, 13, 15, 29, -3, 18, 8, 6, -9, 5, -22, -25, 2, -1, -22, -18, -11, -3, 4, -18, -1, -4, -6, -16, -12, 25, 1, 4, -8, 5, 15, 8, 5, 37, 18, 19, 3, 9, 13, 10, -18, -16, -10, -6, -3, -2, 10, -12, -19, 7, -17, 3, -13, 18, 15, 8, 14, 15, 6, 12, 34, 21, 5, 19, -5, 6, 19, 4, 7, -12, 4, 1, -16, -7, 8, -17, -22, -14, -9, -8, 11, -20, 5, -6, 8, 17, 6, 9, 24, 12, 24, 6, 19, 10, 5, -18, -4, -10, 12, 11, 12, -8, -21, -3, -25, 5, -26, 0, -20, -25, 7, -1, 10, 9, -11, 14, -11, 0, 22, 23, 2, 16, -6, -7, -4, 6, -1, 18, 29, -11, -6, -14, -17, -13, -15, -12, -25, 6, 13, -16, 5, -3, -6, -20, 15, 15, 20, 4, 16, 0, 8, 6, 4, -12, 5, 30, 9, -6, -1, -9, -2, -15, 7, 10, -22, 6, -11, -6, -20, -10, 9, 0, 13, 5, 18, 20, -1, -1, -1, -17, 2, 7, 26, 8, 25, 15, -10, -8, -6, -30, -25, -23, 0, -25, -17, -18, -20, -10, 5, 5, -6, 22, 30, 23, 29, 0, 8, 7, -20, -24, 9, 13, 8, 22, 8, -21, -22, -3, -11, -6, -1, 3, -9, -25, -20, 14, -3, 22, 22, 9, 7, 25, 23, 16, 26, 8, -17, -31, -22, 1, 8, 16, 7, -19, -18, -12, -4, 7, -12, -24, -13, 17, 4, -3, 13, 11, 21, 2, 27, 34, 32, 28, 22, 7, -6, -17, -17, -25, -17, -17, 11, 8, -6, -23, -14, 7, -13, 0, -5, 4, -7, -12, 7, 23, 20, 10, 31, 21, 8, 5, -20, -9, 2, -8, -30, -6, 3, -14, 11, -9, 0, -12, -20, -3, -18, -17, -17, 7, -16, 7, -1, 11, 7, 37, 8, 15, -1, 13, -9, -24, -31, -8, -8, 2, -8, -7, -22, -9, -20, 5, -5, 4, -6, -30, -51, -27, -13, -27, -16, 8, 4, 13, -14, -4, -6, -16, -3, -16, -24, -2, 21, -18, -23, 1, -20, -4, -4, 10, 3, -5, -5, -32, -30, -8, -7, -24, -31, -16, -20, -8, -7, 12, 7, -17, -4, -8, -22, 4, 12, -22, -15, 5, -17, -17, 6, -5, 12, -1, 1, 12, -23, -25, 0, -10, -12, -32, -23, -10, -1, 4, -12, 8, 9, -5, -12, 13, -20, -14, -11, -16, -11, 5, 9, -20, 9, 5, 12, 8, -8, -16, -32, -4, -12, -28, -19, 6, 9, 6, -9, 10, 10, 20, 20, -7, -9, -17, -9, -4, -8, -10, -11, -21, -14, 19, 32, 16, 10, -12, -1, -26, -5, -9, -17, -16, 8, -4, 10, 30, 31, 5, -12, 11, -22, -18, -15, 7, -21, -2, -10, -14, 1, 10, 23, 24, 8, 11, -8, -11, -10, -9, -1, 3, -10, 8, -6, 16, -4, 22, 0, 9, -28, -32, -12, -18, -11, -19, -16, 9, 10, -10, 8, 23, 10, 13, -2, -12, 18, -2, -10, -3, -7, 0, 5, 2, 23, 4, 7, 12, -15, 4, -5, -4, -6, -6, 5, -20, -2, 6, -11, 8, 13, -6, 22, 13, 22, 7, 24, 0, 23, 21, 2, 6, 22, 13, 8, -14, 16, -18, -4, 9, -22, -16, -13, 12, -8, 2, -5, -1, 19, 32, 31, 23, 33, 20, 37, 31, 11, 7, -1, 22, 21, 0, -4, 0, -10, 3, -8, 8, 11, 6, -5, 2, -6, -18, 7, -6, -7, -7, 17, 5, -4, -6, 1, 18, -12, 11, 4, 15, 0, 13, -4, -9, 8, -7, -12, -18, -15, -9, -15, -11, -17, -2, 1, 13, -11, -24, -6, -2, 7, 16, -7, -13, -14, -2, 4, -4, -14, 2, -1, 12, -13, -15, 11, -17, -10, 10, -2, -13, -21, -13, -1, -3, -1, -9, -3, -21, -16, -5, -20, -4, -4, -26, -24, -2, 7, 8, 4, -7, -20, -18, -8, -21, -14, -2, -7, -15, -7, 7, 11, 7, 5, -21, -18, 1, -14, -16, -3, 7, 6, -12, -20, -12, -12, 12, 3, -11, -18, -15, -9, 5, 9, -8, -5, 8, 8, -21, 9, -1, -11, -4, 6, -12, 6, -22, -8, 5, -9, -14, 0, -9, 2, 10, -5, -12, 4, 1, 10, -18, 2, -4, 7, 10, 12, 2, -12, -12, -13, -23, -14, -23, -14, -3, 16, 8, -6, -15, 3, 9, 13, 15, -12, 0, -14, -1, 3, -8, 12, -18, -19, -13, -4, -17, 10, -12, -18, -19, -14, -21, -19, -39, -9, -11, -5, -6, 1, -6, 10, 15, -5, 12, -2, -18, 10, -4, 11, 3, -12, -12, -3, 13, -5, -21, 8, -8, -6, -23, -9, -6, -4, 22, 9, 0, -5, -7, -10, 18, 32, 29, 14, 4, -10, 1, 10, 11, -9, -5, -3, -10, -15, -25, -28, -20, -27, -16, -3, 13, 12, 29, -4, -12, -8, 18, 4, 8, 20, 4, 13, -6, 1, 2, -4, -11, -17, -2, -16, -13, 1, -8, -12, 3, 4, -1, -7, 21, 0, -5, 8, -19, -18, 3, 19, 12, -17, 15, 24, 24, -16, -4, -9, -16, 7, -14, -23, -17, -1, -1, -7, -17, -16, 7, -20, 1, -5, 8, -1, -2, 1, -24, -25, 2, 12, -7, -9, 21, -3, 14, -17, -1, -16, 3, -23, -7, 7, 3, -24, 16, 6, -1, -21, 1, 8, -8, -7, -5, -16, -13, -21, -15, 1, -10, -10, -2, -7, 8, 1, -5, 7, -5, -32, -10, -27, 8, -10, -3, 5, -14, -16, -4, -30, -11, -1, -25, -36, -22, -3, 0, -23, -35, -23, -11, -15, -6, -15, -2, -2, -11, -36, -24, -33, -26, -4, 16, 13, 21, 1, 5, -22, -23, -6, -15, -10, -17, -22, -20, -21, -22, -14, -23, -2, -13, -9, -7, -3, -5, -23, -7, 0, -14, 9, 2, 22, 9, 21, 26, -10, 0, -8, 8, -8, -13, -33, -37, -30, -30, 3, -16, -7, 10, -4, -3, -20, -1, -4, -20, -17, 31, 3, 7, 2, 16, 20, 7, 3, 5, 36, 25, -2, -7, -7, -17, 12, -13, 11, 1, -29, -22, 9, -5, -2, -18, -20, -10, -2, 19, 22, 6, 2, 9, 0, 25, 30, 13, 41, 38, 6, 8, 10, 5, 18, 19, 22, -16, -31, 2, -13, -3, 2, 2, -7, -16, -3, 13, -5, 24, 20, 21, 3, 13, 23, 15, 23, 43, 8, 10, -3, -17, -7, -9, -20, -44, -14, -29, -2, 0, 9, -11, -11, -18, -2, -5, -3, 14, 22, 25, 33, 8, 20, 28, 25, 29, 20, 12, -10, -13, -27, 7, -15, -50, -13, 7, -11, -6, -6, -3, -17, -39, -11, -8, -7, 25, 1, 3, -2, 21, 5, 18, 29, 23, -5, -15, -38, -34, -19, -19, -9, -25, -17, -15, -11, -11, -2, -11, -18, -16, -29, 8, 10, -3, 14, 8, 11, 20, 5, 27, 33, 4, 3, -7, -27, -13, -29, -15, -27, -14, -13, -16, -21, -22, -9, -9, -4, -13, -29, -4, -15, -19, 10, 8, -9, 5, 8, 37, 26, 13, -8, 8, -18, -18, 0, -19, -8, -23, -3, -24, -7, -11, 2, 10, -15, -34, -21, -24, -24, -9, -22, -14, 17, 0, -11, 11, -3, 2, 2, -3, 13, -21, -1, -25, -14, -2, 6, -1, -14, -1, -21, -15, -29, -10, -26, -20, -10, -33, -21, -23, -26, -30, -14, -8, 17, 11, 13, 12, 4, 5, 6, -1, -10, 0, -21, -9, 4, -14, 3, 7, -24, -24, -8, -8, 4, -8, 2, 0, 9, -5, 10, 24, 23, 24, 4, 24, 14, 1, 22, -9, -9, -19, -21, 4, 3, -19, 10, -1, 3, 6, 3, 1, 2, -1, -12, -5, -14, 3, 15, -8, 12, 10, 3, 25, 19, 10, 23, -15, 12, 10, -20, -13, 4, -3, 11, -20, -17, -7, 0, -32, -22, -16, -29, -7, -21, -19, -17, 0, 3, 25, 4, 20, 35, 12, 17, 0, 10, 8, 3, -6, -11, -20, 5, -22, 8, -10, -19, -23, -19, 5, -2, 8, -9, -12, -33, -33, -18, 13, -16, -7, 15, 26, -1, -11, -12, -16, 12, -3, 3, 1, -3, 12, -16, -14, -10, -13, -6, 0, -5, -10, -20, -28, 4, -9, -31, -23, -19, -13, -17, 0, 6, -20, -5, -17, -17, 3, -8, -1, -2, -10, -20, -6, 9, -6, 4, 0, -5, -22, -25, -7, 2, -10, -13, -31, -16, -1, -11, 4, 10, -3, -21, 9, 9, -3, -20, 7, -12, -20, 3, -15, -20, 6, 8, -14, -4, -4, 5, 3, -10, -14, -8, -8, 4, 1, -1, -19, -9, -18, -17, 3, -21, -11, 9, 6, -4, 12, 12, 10, 5, -23, -8, 8, -5, 9, -10, -13, 6, -3, -16, -5, 5, -4, -22, -3, -10, 5, -5, 8, -5, -7, 1, -12, 3, 7, -14, -6, 4, -7, -10, -18, 1, -12, -16, 2, 8, -5, 1, -9, -1, -13, -8, -22, -9, -2, -8, 4, -20, 2, -1, -18, -8, 1, -17, 6, -15, -4, 10, -9, -14, -23, -17, -18, -30, -21, -17, -26, -18, -33, -3, 1, -9, -22, -8, 11, 8, 5, 11, -17, -20, -23, 9, 4, -4, -25, -2, -30, -30, -22, -23, -21, -52, -69, -68, -56, -40, -16, -13, 0, -16, -15, -16, -15, 5, 3, -16, -7, 6, -12, -4, -14, -8, -13, 10, 15, 6, -24, -48, -73, -88, -73, -61, -46, -9, -6, 0, -5, 0, -22, -10, -14, -12, -8, -2, 8, -2, -10, -7, 9, 11, 29, 18, 35, 52, 5, -27, -69, -60, -79, -44, -36, -15, -16, -19, -22, -12, -18, -23, -3, -24, -19, -24, 7, 2, -19, -3, -16, 8, 21, 21, 32, 34, 19, -16, -23, -36, -34, -31, 11, -7, 18, 15, -3, 13, 18, -8, -11, -38, -16, 7, -8, 9, -21, -21, -19, -24, -12, 18, -1, 4, -11, -31, -27, -37, -14, -16, 20, 19, -3, 11, 13, 3, 6, -16, -13, -31, -22, -11, -2, -12, 6, 4, -16, -9, 4, 13, 10, 4, -23, -21, -29, -31, -47, 5, 6, 29, 16, 35, 12, 16, 5, -26, -7, -18, -20, -15, -16, -10, -2, -18, -33, 3, 40, 23, 5, 18, 6, -23, -53, -79, -39, 8, 35, 27, 38, 15, 24, 9, -22, -51, -28, -20, -9, 0, 8, 6, -20, 1, -1, 1, 18, 21, 7, 29, 4, -30, -93, -82, -48, 38, 52, 29, 35, 41, 31, 34, 15, -32, -8, 4, -13, 11, 3, -8, -15, 13, 3, 4, 6, 3, 39, 20, -1, -43, -55, -21, 21, 60, 43, 42, 36, 37, 58, 47, 3, -30, -30, 1, -13, 5, 1, -1, 1, 21, 6, 4, 34, 36, 56, 13, -11, -37, -1, -16, 23, 38, 13, 14, 28, 11, 50, 61, 17, -9, -41, 8, -17, -20, -5, 3, -15, 12, 12, 8, 19, 48, 31, -5, -21, -47, -32, 7, 22, -2, 0, -8, 0, 7, 42, 42, 36, -9, -19, -1, -28, -3, -10, -4, -4, -1, 29, 1, 28, 25, 14, -8, -15, -32, -10, 3, 3, -27, -17, -14, -10, -24, 17, 17, 25, -7, -5, -15, -29, -5, -22, -7, 2, 6, 15, -24, 13, 10, 9, -8, -16, -14, 16, -12, -20, -16, -40, -38, -27, -47, 12, 10, 9, 5, -23, -36, -14, 8, 4, 10, -4, -18, -14, -13, -2, -9, 13, -5, -49, -36, 15, 4, -14, -46, -56, -53, -64, -26, 17, 22, 0, 10, -22, -8, 4, 4, -8, -4, -4, -22, 10, 3, -1, -11, -22, -18, -22, 9, 33, 38, -3, -63, -85, -51, -28, -14, 3, 22, 25, 4, 3, 3, -1, -2, 9, -22, 3, -20, -14, -4, -30, -30, -23, -8, -1, 42, 64, 25, -55, -102, -97, -56, -29, -14, 16, -4, -19, -6, -24, -10, -13, -6, -21, 3, 11, 4, -4, -32, -51, -31, -21, -7, 10, 35, 53, -10, -84, -120, -96, -53, -22, -16, -9, 5, -4, -53, 0, 16, -5, 7, 9, -21, -1, -26, -10, -37, -53, -50, -16, 3, 19, 53, 41, -37, -102, -125, -69, -54, -28, -10, 8, 14, 22, 4, -5, -12, -12, 11, 4, -20, -16, -4, -8, -16, -47, -13, -7, 28, 35, 22, 11, -48, -114, -112, -93, -40, -41, -1, 40, 43, 9, -1, 12, 8, -11, -20, -13, -6, 7, -18, -1, 12, -9, 18, 11, 10, 21, 1, -1, -21, -49, -67, -61, -18, 2, 36, 31, 27, 26, 14, -10, 14, 6, 5, 11, -21, -13, -5, 3, 35, 32, 36, 22, 31, 29, 34, 29, -8, -52, -65, -66, -22, -6, 33, 21, -3, -23, -6, -16, 1, -1, -6, -1, -12, -21, -11, 16, 11, 9, 13, 25, 51, 13, 15, 16, -26, -58, -88, -97, -44, -15, 0, -6, 5, 12, 14, -2, -14, -13, 6, -21, -11, -1, -6, 2, 9, -21, -22, -9, 7, -12, 5, -17, -36, -49, -37, -41, -20, 5, -25, -13, -9, 14, 15, 0, -18, -4, -1, -21, -4, 9, -3, -14, -5, -3, -3, -2, -27, -4, -21, -30, -11, -14, -22, 0, -4, 5, 0, 4, -8, 11, -9, 8, -5, -8, -15, 7, -20, -21, -22, -13, -6, -14, -15, -7, 9, -10, -4, -3, -11, -18, 9, -20, -8, -4, 2, 6, 12, 10, -8, -2, -3, 8, -9, 12, -12, 4, 14, 5, -7, 10, 10, 5, 13, -11, 1, 3, 6, -1, 8, -8, 11, 6, -20, 0, -7, 6, 13, 1, -13, -20, -17, -17, -7, -18, 6, -2, 12, 0, -11, 6, 11, -18, -13, 14, 9, -16, -17, 13, -4, -1, -8, -1, 11, -16, 12, -10, -6, 12, -5, 11, 7, 2, 9, -2, 12, -15, 12, -3, 6, 10, -4, 5, -9, -26, -14, -5, -8, -12, 4, -21, 4, -3, 5, 7, -15, 11, -3, -9, -1, 9, 11, -18, 2, 1, -31, 0, -25, -15, 6, -13, 30, 30, 31, 31, 24, -7, 1, -40, -35, 2, -2, -16, 10, 9, -6, 13, -1, -14, -17, -7, 4, 2, -35, -20, -7, -23, -4, 14, 28, 31, 16, 7, 22, -13, -4, -6, -19, 3, 4, -12, 0, -5, -18, -4, -7, 14, -9, 0, -27, -51, -32, -25, -13, 14, 32, 10, 42, 30, 17, 11, 15, 26, 31, 3, 5, 4, -6, -21, 2, 5, -1, -16, -11, -7, -10, -23, -46, -21, -21, -21, -19, 0, 21, 2, 14, 8, -2, 15, 33, 23, 10, 27, 24, 22, -10, -1, -7, -18, -2, -3, -10, 13, -7, -9, -8, -7, 3, -16, 0, 27, 18, 21, 33, 9, -5, 12, 22, 20, 30, 30, 13, 21, 36, 15, -20, -13, 11, 8, -6, -15, 7, 13, -13, 1, 3, 3, 15, 22, 12, -3, 8, 3, 2, 14, 14, 49, 66, 29, 33, 32, 43, 11, -3, -11, -7, 5, -3, -4, 13, 9, 2, -7, 0, -3, 11, 0, -9, 0, -6, -4, -20, -14, -15, 6, 33, 36, 35, 40, 59, 1, 8, -5, -20, -20, -12, -19, -1, -12, 15, 8, 7, 15, 13, 3, -4, -23, -51, -56, -52, -35, -21, -7, -11, 12, 16, 66, 53, 31, 14, 5, 2, 10, 8, -12, -13, -14, -9, 28, 14, 5, 32, 11, -12, -73, -92, -87, -53, -28, -36, -46, -34, -7, 10, 50, 47, 53, 9, -16, 2, -16, -8, -11, -5, 0, -1, 14, -15, 37, 15, 7, -56, -103, -87, -34, -38, -25, -44, -65, -74, -35, -14, 29, 40, 23, -3, 5, -7, -17, -12, -1, -5, 4, -2, -1, 14, 27, -2, -27, -77, -68, -39, -10, -31, -37, -69, -99, -91, -41, 10, 22, 11, 20, -4, 2, -13, -10, -17, -20, 6, -2, 25, 7, 32, -1, -24, -58, -67, -51, -1, 4, -15, -61, -106, -115, -55, 4, 8, -11, -27, -3, -10, 11, -20, -13, -4, -19, -18, 19, 25, 11, 17, -24, -44, -65, -42, -29, 12, -15, -22, -81, -92, -90, -33, 32, 29, -32, -17, -28, -18, -18, -9, -10, 10, 0, -18, 16, 48, 3, 3, -38, -24, -40, -37, -28, -4, -27, -65, -127, -113, -59, 22, 40, -5, -11, -26, -45, -7, -5, -1, 12, -14, -6, -12, 24, 15, -15, 6, -4, -31, -24, -19, 8, 3, -64, -113, -128, -82, -20, 32, 22, -26, 2, -28, -62, 20, 4, -9, -2, -18, -14, -9, -21, 2, -2, 18, 8, 24, -11, -16, -14, -33, -110, -128, -98, -5, 13, 2, 14, -8, -4, -38, -37, -1, -1, 4, 13, 8, -6, -22, -8, -4, 25, 29, 18, 35, 31, 12, -15, -50, -94, -64, -1, 22, 26, 5, -3, -1, 2, -53, -29, -22, -6, -4, -6, -18, -16, -3, -8, 13, 3, 6, 36, 19, 15, 17, 20, -5, -9, 10, 17, 11, 8, -22, -8, 4, -33, -58, -20, -13, -19, -7, -19, -7, -6, 12, -36, 25, 13, 23, 27, 13, 39, 11, 38, 13, 62, 66, 64, 38, 36, 28, -6, -18, -29, -8, 4, -4, 3, -3, -5, -8, 9, -9, -9, 4, 40, 4, 47, 25, 13, 24, 26, 52, 43, 54, 50, 60, 42, 52, 17, 18, 23, -6, 6, 0, 4, -12, 12, -20, 2, -22, -24, -11, 14, 19, 25, 4, 13, 31, 31, 41, 32, 57, 52, 73, 47, 54, 33, 26, 1, -8, -12, -16, 4, -15, -19, 4, 7, -15, -18, -13, 10, 0, 19, -5, 9, 18, 3, -2, 42, 34, 50, 33, 29, 38, 16, 10, 19, 0, 16, -5, -11, -9, -6, 2, 5, 1, 7, 13, -9, -15, -26, -20, -37, -36, -28, -55, -46, -44, -8, -29, -47, -4, -6, 8, -4, 11, 8, 6, 11, 12, -12, 8, -5, -13, -2, 6, -15, 6, -2, -3, -6, -2, -15, -27, 2, -9, -10, -16, -16, -7, -7, -4, -6, -9, -9, -11, -12, 6, -3, -17, -7, -10, -15, 14, 0, -5, -4, 1, -16, -15, -17, -11, -1, 3, -1, -6, -6, 12, -8, -3, 12, -20, -11, 8, -10, 14, -11, 4, -8, 5, -1, 17, -1, 5, 8, -9, -10, 11, 1, -13, -3, 4, -11, 5, 18, 13, -10, 11, -4, 4, -13, 7, 4, -7, -2, -8, -4, -6, 2, -8, -5, 1, -13, -11, 0, 5, 9, 7, 15, -7, 4, 1, 10, 2, -6, -5, -11, 10, 4, -3, 5, -14, 1, 2, -12, -2, 5, -3, 12, 9, 13, 20, 11, 14, -2, 8, 20, 11, 2, -5, 26, 24, 17, -5, -8, -7, 7, 9, -4, 9, -10, -7, 13, -6, 11, 5, -3, 12, 18, 9, -4, 0, 8, 12, 34, 8, -2, 2, 3, -6, 15, -15, -11, -12, 0, 5, 7, 3, 16, 8, 17, -11, 20, -1, -3, 25, 18, -3, -8, -7, 15, 16, 30, 6, 29, 11, -9, -20, -15, -13, -1, 0, -14, 9, -8, 2, 1, 6, -5, 13, 24, 13, 26, -1, -2, 0, -22, 5, -15, 7, 5, 18, 17, 6, -2, 11, -4, -25, -24, -11, -1, -9, 16, 15, -1, 11, 21, 1, 15, -6, 1, -14, -9, -11, 8, -12, 14, 6, 23, 28, 9, 12, 14, -2, -18, -10, -36, -29, -20, 8, 13, 12, -5, 3, -3, 21, 18, -12, -22, -9, -19, 11, -19, -15, 13, 1, 20, 18, 7, 29, 11, 2, 8, -12, -4, -6, -20, -4, 3, -1, 13, 19, 2, 21, 18, -1, -16, 2, -12, 19, -6, -20, 12, -1, -3, 14, 0, 23, 24, 14, -2, -14, -3, -17, -31, -7, -14, 12, -10, 13, 17, 18, 16, -13, -8, -6, 5, 11, 10, -5, -4, -5, -8, 9, 18, 22, 11, 29, 14, 21, 5, -32, -44, -12, -11, -11, -14, -3, 5, 27, 22, 15, -14, 10, 13, -11, -6, -19, -42, 11, 1, 2, 24, 35, 42, 10, 24, 24, -3, -14, -33, -30, 5, -7, -4, 12, 1, 5, -5, -10, -2, 17, -13, -11, -23, -4, 1, -2, 28, 1, 20, 41, 41, 19, 44, 30, 24, -7, -55, -38, -21, -8, 17, 3, 5, 3, 19, 15, -6, 1, 7, -1, -13, -3, -28, 7, 30, 28, 43, 49, 40, 28, 30, 29, 13, 23, -20, -31, -6, 6, -11, 18, 7, -1, 26, 15, -14, 2, -6, -3, -13, -14, -19, -7, 17, 20, 30, 14, 6, 1, 21, 9, 13, -5, -8, -26, 5, 17, 8, 15, 8, -11, 4, -18, -28, -25, 5, 5, 1, 25, 10, 4, 15, 25, 13, 20, 22, 20, 0, 4, -2, -8, -7, -26, 3, 8, 2, 6, -9, -10, -5, -33, -27, -45, -11, 15, 14, 18, 16, 12, 17, 11, 13, 20, 9, 3, 7, -5, -2, -19, -8, 1, -5, 2, 14, 0, -6, -1, -8, -31, -33, -30, 16, 32, 45, 23, 9, -4, 10, -9, 1, 10, -13, -5, -5, -8, -14, -32, -18, -8, 5, 17, 2, 20, 7, 1, -11, -44, -47, -33, 22, 17, 15, 4, 6, 5, 0, -7, -18, -16, 3, -2, 10, -18, 2, -11, -38, -25, 8, 1, -14, -5, 17, -3, -15, -23, -46, -34, 12, 12, 32, 15, 11, -3, -9, -11, -20, 20, -4, 23, -11, -23, -14, -54, -49, -15, 19, 18, 15, 9, 18, 13, -5, -9, -16, -29, -10, -11, 16, -12, 7, -5, -20, -19, 0, 13, 10, -7, -29, -10, -40, -46, -15, -17, 12, -6, -10, 7, 9, -12, -3, -7, -3, -24, -23, -19, 0, -10, 0, -16, -12, 5, -7, -28, -11, -2, -20, -12, -23, -49, -26, 8, -5, -4, 10, -11, 13, 1, -8, -8, -24, 1, 5, -26, 8, -13, 15, -1, 3, -14, -17, -9, -13, -27, -2, -33, -46, -21, -4, -7, -14, 15, -10, -4, -7, -16, 3, 1, -14, -10, -5, -8, -11, 16, 23, 1, 12, 6, -3, 5, -32, -14, -20, -12, -40, -7, -6, 8, 1, -1, -6, -10, 1, 10, 10, 15, 12, -7, -19, -13, 5, -6, 3, 9, -3, 13, -21, -18, -23, -20, -17, -19, -29, -10, 15, -5, 11, -9, -8, 11, -7, 9, 16, 11, 26, 30, -9, 8, 16, -2, -3, -5, -29, -6, -10, 5, -24, -7, 7, -15, 4, -6, 14, -16, 8, -6, -3, -1, -6, -5, 10, 31, 13, 18, 35, 49, 40, 16, 17, 25, 6, 1, 3, 3, -2, 9, 4, 5, -2, 2, 2, 0, 10, 12, 16, 3, -6, -5, 2, 11, -1, 8, 21, 40, 36, 14, 11, 31, 40, 28, 40, 28, 8, 17, 12, -4, 9, 16, 6, 2, -7, -13, 18, -13, 0, 4, -9, -6, 3, 11, 3, -12, -8, 10, 19, -1, 5, 15, 14, 2, 18, 2, -8, 7, -3, -13, 5, -7, 14, -8, -5, -18, -6, -19, -31, -12, -3, -27, -8, -30, -18, -13, -11, -32, -2, -25, -33, -21, -15, -3, -5, -2, -18, -9, -23, -28, -30, -30, -21, -2, -6, -30, -28, -22, -11, -32, -24, -8, -3, -2, -25, -25, -31, -32, -7, -24, -12, 0, -14, -8, -11, -3, -1, -14, -33, -31, -19, -23, -20, -13, -34, -15, -2, -2, -7, -27, -14, -24, -34, -10, -9, -44, -29, 0, -3, -3, -11, -18, -30, -23, -29, -7, -5, -33, -19, -10, -8, -16, -21, -14, -28, -33, -17, -25, 2, 2, -3, -16, -11, -14, 9, 12, 3, 7, 13, 6, 10, -24, -13, -16, -15, -16, -31, -20, -20, -28, -32, -37, -39, -19, -21, -10, -20, 16, -12, 3, -11, 7, 7, 6, 4, -9, 16, 25, -1, 1, 17, 10, -23, -20, -17, -1, -30, -13, -41, -27, -48, -41, -9, -22, 4, 42, 27, 9, 9, -11, 22, 13, 20, 7, 26, -7, 16, -9, 11, 12, -19, -34, -31, -22, -9, -14, -15, -31, -14, -18, 10, -7, -1, 27, 17, 8, -2, 8, 1, 7, -12, 15, -8, -7, 27, 16, 31, 16, 3, -18, -25, -31, -20, -37, -46, -23, -10, 8, 16, 28, 14, 26, 18, 7, 9, 13, 26, 23, 9, -4, -8, 13, 19, 33, 36, 30, -21, -6, -28, -8, -1, -36, -23, -9, -2, 6, 5, 18, 30, 25, 23, -9, -7, -10, -3, -9, -3, 6, 8, 24, 2, 21, 32, 14, -17, -3, -33, -5, -34, -12, -36, -14, 17, 20, 7, 31, 23, 2, -6, -13, -11, -13, -10, -20, 5, 11, 9, 26, 14, 31, 41, 36, -7, -25, 0, -9, -21, -17, -6, -11, 15, 33, 33, 22, 19, 16, 0, 3, -14, -16, -16, -23, -20, -6, 12, 2, 25, 37, 43, 21, -17, -13, -9, -3, -13, -7, -8, -12, 31, 28, 13, 14, 4, 11, 24, 4, -5, -27, -28, -15, -23, -15, -5, 12, 17, 17, 40, 30, 11, -4, -33, -23, -34, -4, -12, 21, 7, 35, 23, 23, 10, 21, 22, 9, 8, -14, -33, -38, -24, 6, -13, -9, 5, 0, -10, 4, 2, -26, -24, -21, -5, -20, -16, -6, -11, 22, 1, 12, 26, 26, 30, 8, 15, -6, -20, -26, 9, 0, 10, -22, -16, -3, -2, -10, -30, -11, 0, -29, -24, -9, -10, -2, -11, -2, 5, -3, 25, 39, 36, 31, 6, -11, -3, 2, 14, -13, 11, 1, -21, -6, -27, -36, -17, -25, -18, -3, -17, -15, -25, -22, 10, -22, 4, 16, 31, 31, 31, 15, -1, -4, -20, -3, 4, -15, -12, 3, -11, -26, -8, -27, -4, -17, -9, -20, -5, -23, -9, -15, -15, -36, -20, 10, 30, 2, 21, 1, -7, -30, -19, 0, 10, 0, 7, -17, 7, -7, -8, -9, -35, -5, -28, -25, -10, -31, -16, -6, 18, 13, 16, 28, 9, 12, 6, -5, -40, -4, 12, 14, 19, -9, 22, 3, -18, 6, 1, -40, -31, -6, -26, -27, -15, -34, -19, 34, 19, 1, 26, 23, 36, 33, 3, -17, -23, -15, 15, -2, -4, 9, 2, 0, 0, 19, 12, -31, -20, -22, -23, 0, 2, -29, -14, 36, 10, 13, -2, 9, 21, 4, 9, -18, -26, -17, -11, -4, 14, 13, 4, -5, 20, 3, -14, -21, -17, -25, -29, -11, -7, -23, -12, 35, 22, -6, 8, 23, 24, 18, 9, 7, -16, 17, 2, -12, 1, 4, -5, 3, 16, 16, -17, -13, -28, -27, -14, -18, -1, -33, -8, 2, 16, 7, 5, 9, 1, 14, 10, 16, -1, -5, 14, 16, 0, -13, 13, 13, 31, 23, -22, -26, -15, -30, -23, -27, -35, -34, 2, -20, 0, 12, 5, 4, 20, 24, 27, 27, 25, -2, 21, 18, 4, 4, 12, 14, 14, 16, 1, -16, -2, -29, -20, -8, -1, -22, 3, -25, -13, 6, 21, 13, 21, -4, -3, 6, -1, 6, -5, -10, -5, 1, 25, 17, -10, 3, 3, 2, -33, -27, -16, -9, -3, -30, -42, -32, -34, -4, 24, 22, 33, 44, 19, 39, 21, 23, 39, 10, 14, 22, 1, -18, -14, -4, -26, -11, -11, 0, -18, -24, -19, -32, -15, -17, -24, -30, -17, -23, 17, 21, 11, 4, 0, 25, 19, -4, -8, -18, -21, -21, 6, -23, -15, -17, -9, -8, -21, -26, -12, -29, -25, -6, -14, -20, -12, -32, -29, -30, -3, -14, -22, -30, -29, -29, -33, -26, -24, -17, -3, -21, -21, -7, -2, -12, -13, -4, -31, -13, -20, -13, -22, -1, -29, -23, -25, -33, -20, -33, -4, -35, -7, -16, -8, -26, -19, -7, -8, -26, -14, -25, -30, -19, 4, 9, -10, -24, -17, -5, 8, 2, -2, -16, -2, -6, -18, 7, -10, -3, 8, 10, -4, -2, -8, -14, 9, -5, -23, 4, -18, -8, 9, 3, -23, -10, -24, -15, -16, 6, -11, 11, -7, 10, 6, -15, -14, -3, -1, 11, 1, -8, -1, -12, 6, -13, 0, -16, 5, -14, -24, -22, 2, -8, -20, 7, 12, -7, 13, 4, 7, 5, 19, 16, 32, 13, 35, 0, 12, -7, -10, -5, 0, -11, -4, -7, -5, 1, 7, 5, 5, -14, -16, -20, 9, 2, 14, -3, 10, 25, 22, 18, -2, 4, 4, 13, -2, 23, 25, 19, -17, -6, -15, -23, -4, -22, 3, -22, -21, -4, -16, 2, -1, 13, 11, 14, 13, 0, -14, 7, -11, -40, -30, -13, -11, -28, -30, -19, -32, -19, 2, -18, 3, -23, -15, -22, 8, -3, -7, 2, 12, 9, 11, -10, 17, -8, -17, -15, -34, -20, -37, -62, -38, -46, -48, -34, -36, -32, -14, -18, -17, -5, -15, -11, -23, -9, -3, 0, 12, -15, -21, 8, 8, -7, -26, -13, -22, -44, -44, -30, -26, -51, -54, -44, -23, -44, -34, -30, -1, -9, 6, 6, -12, 2, 21, -4, 4, -10, -25, -10, -14, 5, -23, -11, 8, -13, -26, -53, -60, -46, -29, -49, -43, -33, -28, -11, -8, -2, -20, 8, 9, 0, 14, 3, -6, -37, -33, 7, -7, -17, 19, 34, 18, 0, -37, -57, -59, -48, -50, -56, -49, -35, -28, -15, -14, -10, -10, -11, -1, 18, 16, 15, -27, -8, 0, -4, 8, 4, 3, 29, 35, 35, -10, -66, -51, -57, -38, -18, -25, -46, -27, -14, -21, -16, -13, -3, -2, 6, 2, 7, -12, 11, 26, -18, -13, 20, 25, 50, 36, 5, -28, -24, -46, -29, -21, -22, -30, -19, -42, -19, 3, -15, 0, -18, 11, 21, 9, 7, -5, 14, -3, -5, 3, 17, 10, 54, 14, -16, -40, -13, 12, -31, -4, 1, -16, -25, -39, -14, -10, 9, -17, -9, -1, -10, 36, 9, 13, 27, -4, -2, 13, 5, -7, 19, 10, -15, -16, -6, 18, -8, 18, -7, -12, 7, -9, -11, -18, 6, 10, 6, -17, 13, 28, -4, 22, -10, 6, -20, 5, -9, -4, 10, 14, -23, 1, 2, 2, 12, -8, 1, 22, 20, 34, 1, 13, -8, 10, -19, -1, 18, 1, -5, -13, -25, -13, -3, 3, -10, -13, 5, -2, 4, -7, -19, -13, -1, 38, 16, 23, 37, 34, 16, 6, 7, -14, -14, -10, -11, -10, -21, -22, -22, -24, -7, -5, -22, -22, 18, 19, -10, -25, -7, -6, 17, 51, 31, 19, 35, 49, 15, -19, -1, -2, 1, -20, -1, -28, -34, -9, -12, -34, -2, -6, -11, -6, 15, 24, -16, -14, -17, 14, 29, 22, 26, 21, 32, 36, 29, -11, -16, 2, -4, -5, 9, -2, -30, -11, -24, -35, -10, 9, -1, -17, -3, -10, -2, -16, -25, -1, 36, 12, 38, 43, 39, -1, 16, 0, -16, -13, 10, -5, -5, -19, -32, -28, -29, -28, -12, -1, -1, 11, 8, -2, -18, -14, 23, 20, 12, 21, 32, 46, 16, -8, 17, -17, -20, -4, 4, -20, -8, -34, -37, -30, 0, -26, -18, 9, -5, 2, 7, 15, -5, 18, 20, 25, 0, -7, 25, 33, 1, 16, 16, 4, -24, 9, -1, -10, -16, -4, -4, -36, -22, -17, -11, 9, -15, -23, -3, 12, -8, 14, 10, 26, 22, 1, -20, -5, -11, 9, -16, -10, -17, -16, 10, -11, -10, 1, -47, -19, -16, 2, -11, -18, -2, -9, 6, -16, -23, -28, -20, 0, -15, -41, -26, -10, -23, 0, -1, -15, 0, -22, 6, -15, -16, -3, -30, -12, -21, -15, -19, -22, -33, -30, -22, -25, -3, -23, -24, -17, -12, -3, -32, -16, -30, -25, -4, 4, -6, 1, 4, -12, -13, -16, 2, -15, -34, -12, -22, -6, -22, -20, -35, -20, -26, -44, -29, -15, -9, -19, -20, -4, -22, -13, -18, 0, 9, 0, 5, 6, -3, 2, 13, 4, 0, -3, -40, -24, -31, -21, -15, -15, -30, -2, 12, -17, 6, -24, 7, -19, 6, -22, -17, 4, -23, -14, 3, -6, -3, -18, 7, -6, 2, 7, -5, -15, 3, 6, 21, 6, 15, 38, 41, 1, 13, 3, -3, -21, -16, -2, 9, -1, 9, -21, 4, -18, -14, -11, -9, 12, 6, -11, -5, 20, 5, 14, 26, -1, 3, 15, 28, 28, 16, 11, 7, 6, -3, -4, -10, -23, 0, -20, 5, -4, -7, -12, 6, 6, 2, 10, 3, 3, 5, -5, 8, -11, 1, 2, 14, 13, 7, -18, -5, -12, -16, 1, -12, -10, 1, -8, 1, -12, -6, -2, 2, -17, 14, -3, 6, 13, 5, -1, -16, 12, 15, -10, -9, 12, 3, -5, -17, 3, -18, -12, -3, 8, -2, 2, -11, -1, -14, 0, -8, -1, -1, -9, -12, -13, 9, 15, -13, -3, -16, -17, -2, -15, 14, -8, -10, -4, -9, -5, -9, 12, -11, -10, -3, 10, 1, 2, 14, -6, 4, 2, -10, -15, 11, 8, 18, 20, 22, 4, 23, 27, 26, 6, 2, -2, -12, -19, -17, -11, 10, 7, 3, 13, -7, -2, 12, -3, 6, -5, 11, -7, 3, -2, -2, -15, 12, 5, 17, 20, 3, -2, 4, 24, 14, 1, -19, 12, -2, 1, -7, -10, -14, 1, -21, -12, -15, -8, -19, 4, -18, -3, -8, -18, -16, -19, 0, 10, 1, 3, 30, 10, 8, 15, -8, 0, 11, -18, -8, -11, 1, -5, -20, -11, -10, 2, -10, -15, -9, 18, -14, -15, -12, -14, -2, -23, -3, -15, -10, -21, 25, 5, 1, -1, 6, 13, 7, -4, -11, 5, -23, -23, 5, -8, -3, 10, 14, 14, 10, 16, -9, -8, -7, -10, 3, -16, -14, -11, -10, -3, 5, -3, 11, 14, -2, 11, -4, -26, -34, -12, -6, 2, 11, 8, 11, 7, 5, -14, -14, 14, -2, -17, -5, -19, 1, -16, 6, -8, 5, 5, 4, 2, -4, -7, -2, -9, -15, -5, 1, 20, 20, -11, 3, -6, -21, -27, -19, -7, -3, -11, -31, -28, -6, -23, -20, 12, 8, 7, -2, 10, -5, -4, 3, -24, -1, 2, -11, -5, 22, 8, 19, 4, -55, -45, -44, -12, -33, -28, -12, -7, -6, -15, -20, -13, 1, -8, -5, -5, -17, -9, -19, -21, -7, 14, -3, 31, 26, 29, 12, -7, -59, -35, -16, -26, -8, -7, 1, -34, -9, -11, -20, -10, 1, -9, 12, 12, -21, 2, 0, 9, 11, -5, 31, 34, 31, 20, 28, 6, -5, -5, -27, -17, -7, 7, -7, 11, -10, 20, -11, -23, -17, -16, 6, -7, -16, -1, 2, -2, 26, 13, 5, 17, 16, 35, 42, 11, -24, -28, 2, 25, 19, -4, 22, 15, 15, 32, 7, -8, 0, -16, 3, -17, -15, 7, -1, 4, 2, -3, 2, 14, 30, 36, 17, -8, -10, -11, 18, 14, -8, 22, 28, 41, 45, 22, 13, -25, -23, 0, -8, -14, -19, 11, 11, 1, 14, 22, 25, 2, 20, 37, 40, -7, -12, -1, 0, 7, 4, 27, 29, 23, 17, 9, 2, -17, -25, -1, 1, 2, 14, 8, -7, 5, 3, 13, 25, 2, 3, 16, 17, 15, -13, 6, 14, 4, 23, 27, 12, -10, -21, 5, -29, -26, -7, -13, 5, -7, 12, 2, -20, -5, -11, -4, -6, 11, -16, -8, 3, 13, -4, 20, 9, 9, 8, 27, -10, 2, -3, -13, -43, -18, -19, 2, -2, 6, 5, 4, -30, -22, -16, 6, -5, 15, -1, -8, -8, 10, 0, -1, 27, 4, 11, 4, -20, -1, -1, -32, -12, -21, -23, 3, -18, -5, 5, -11, -18, -14, -19, -20, 5, -3, 10, 16, -12, 18, 8, 15, -1, 14, -11, -13, -14, -24, -7, -19, -36, -4, -25, 6, -15, 6, 2, -7, -18, -36, -32, -19, -8, -30, -27, 4, 0, 5, 0, 2, -4, -5, 0, -13, -17, -1, -15, -17, -11, -15, -24, -3, 9, -8, -18, -14, -16, -12, -32, -8, -13, -10, -35, -23, -1, -5, 14, 10, -6, -11, -23, -20, 0, -5, -28, -4, 2, -13, -4, -8, -16, -2, 3, -10, -30, -37, -12, -18, -34, 4, -14, 7, 10, 6, 28, 6, 4, 1, -1, -2, -28, -25, -22, 3, -17, 13, -21, 1, 11, -5, 7, 4, -3, -26, -10, -9, -6, -26, 8, -17, -18, 10, -10, 5, -9, 10, -21, 4, 2, -5, -2, -12, 4, 7, -3, -1, -14, 14, -13, -15, -13, -4, -29, -16, -32, -29, -19, -27, -25, 3, 5, 4, -15, 4, 11, 18, 27, 39, 25, -4, -11, -16, 0, -16, -15, 7, -16, -7, 1, -20, -2, -14, -1, -25, -26, -6, -2, -12, -22, -33, 10, -12, 7, 10, 22, 37, 20, 17, 7, -19, -19, 12, 12, -4, -18, -11, 6, -3, -4, 11, -21, -17, -26, -7, 2, 9, 3, 15, 23, 16, -14, 8, -13, -4, 18, 2, -18, -20, -9, 7, -9, 9, 13, 10, -13, 2, 11, -5, -9, -3, 14, 0, 3, 7, -6, -2, -3, -16, 3, 8, 5, -15, -16, 5, -3, -15, 13, -10, 2, -11, -16, -8, 1, -18, 8, 11, -5, 14, 11, 2, 7, -3, 2, -14, 14, -18, 9, -9, -14, 11, -2, -4, 11, -17, 6, 7, 2, -7, -13, -13, -1, -4, -25, -10, -19, -19, -8, -15, -23, -27, 1, -13, 5, -6, 3, -12, -17, -2, 2, -7, -13, -10, 1, -3, 3, -25, -18, -9, -8, -15, -27, -11, -28, -10, -25, -12, 1, -20, -3, -15, -10, -8, -26, -5, -5, -10, 0, -8, -20, -13, -10, -2, -1, -15, -6, -15, -8, -21, 0, -27, -2, 2, -4, -12, -3, -28, -1, -24, -10, -27, -3, -9, -7, -16, -15, -2, 0, -18, 1, -27, -5, -27, -5, -5, 3, -17, -1, -23, 4, -30, -15, -15, -28, 2, -32, -26, -20, 2, -12, -7, -14, -15, -16, -7, -1, -17, -10, -1, -18, -19, -16, -11, -29, -1, -15, -12, -2, -17, -30, -11, -23, -7, 10, -14, -21, -22, 4, -14, -12, -3, -1, 5, -5, -18, -21, -20, -28, -9, -12, -20, -20, -9, -22, -26, 6, 11, 13, -9, 6, 18, 8, 21, -6, -23, -19, -5, -13, -7, -4, -36, -26, -19, -20, 0, -16, -15, -4, -17, -15, -14, -32, -27, -6, -10, -10, 12, 26, 23, 15, 4, 8, 9, 37, 12, 12, -19, -1, -20, -12, -16, -16, -4, -8, -16, -2, -6, -10, -23, -6, -8, 17, 25, 17, 29, 1, 32, -2, 11, 28, 32, 40, 40, 10, 3, -5, -9, 0, 4, -5, -25, -11, -1, -7, -23, -2, -21, -8, 20, 36, 16, 2, 26, 18, 4, 1, 21, -5, 25, 30, 41, 7, 7, 28, 17, -14, 17, -21, -14, -2, 2, -4, 6, -17, -7, 8, 14, 27, 0, 27, 3, -6, -9, 13, 11, 10, 1, 15, 20, 9, 5, 30, 22, 22, 12, -15, -3, 5, -6, -8, -13, -19, 14, 2, 21, 17, 19, 8, 23, 16, 11, 1, -3, 4, 3, 2, 0, 30, 17, 22, 27, 24, -10, -5, -28, -1, -10, -10, -5, -14, 19, 27, 12, 10, 24, 14, 32, 16, 26, 0, 19, -7, 26, 12, 7, 15, 26, 12, 42, 37, 6, -15, -24, -6, -8, -20, 6, 5, 19, 16, 8, 11, 25, 12, 28, 35, 20, 5, 20, 19, 24, 5, -3, 18, 15, 39, 22, 16, -4, -27, 6, -29, -1, -22, -8, -6, 8, 28, 9, 22, 21, 28, 8, 14, 12, 8, -4, 29, 27, 22, 0, 26, 31, 23, 3, -8, -26, 1, -14, -9, -19, -13, -7, 7, -1, -4, -7, -23, 5, 2, -6, 31, -11, -5, -3, 13, 17, 9, 26, 30, 2, 0, -9, -3, -40, -13, -21, -13, -14, -10, -4, 2, -12, -18, -11, -5, 4, -3, 2, 17, 12, 3, 16, 8, 14, 31, 36, 11, 24, 6, 2, -5, -51, -26, -5, -24, -7, -9, -22, -6, -9, -25, 14, -1, 5, 0, 0, -8, 10, -14, 9, -8, 22, 15, 16, -5, 16, -3, -8, -35, -26, -24, -21, -26, -12, -2, -29, -23, -10, 8, -18, -5, 10, 29, 1, -3, 21, -6, 9, -7, 24, 12, 25, -11, 5, -1, -24, -29, -31, -43, -23, -28, -24, -11, -20, -25, -9, 0, -17, 1, -15, 24, 4, 15, 7, -4, 12, -11, 5, 5, -6, -6, -11, -22, -17, -34, -16, -29, -27, -4, -14, -12, -26, -37, -21, 6, 1, -27, -4, 17, 13, 0, 11, -20, -23, 1, -15, 5, -19, 2, -14, -7, -29, -30, -18, -37, -11, 0, 0, 3, -18, -33, -42, -13, -24, -13, -29, -15, -14, -27, 7, 2, -5, -25, -38, -15, -17, -2, -21, -14, -22, -32, -27, -13, -23, -24, -24, -28, -7, -32, -40, -9, -12, 6, -4, -21, -6, 3, 26, -1, 6, -16, 8, -5, -36, -20, -9, -38, -24, -37, -36, -13, -27, -16, -24, 0, -1, -9, -31, -16, -8, 6, -21, -9, 20, 3, 25, 6, 20, 1, -9, -17, -3, -20, -33, -26, -32, -21, -15, 2, -2, -7, -8, -20, 2, -32, -6, -23, -18, 16, 0, -8, -13, -5, 12, -1, 20, 20, 27, 4, -19, -21, -30, -17, -28, -18, -2, -12, -1, -7, -16, -14, -4, -2, -19, 11, -11, 15, 20, 11, 13, 26, 22, -1, 11, 21, 8, -21, -17, 11, -7, -30, -22, -28, -12, -18, -22, -26, -21, -9, -2, -23, 2, 8, 12, -7, 23, 23, 23, 21, 26, 13, 11, 20, 19, 27, -4, -6, 4, 6, -23, -9, -18, 4, -26, -28, 2, -26, -15, 4, -28, -20, 0, 1, -4, 13, -3, 27, 23, 28, 34, 15, 17, 6, -4, -4, 12, -13, -19, 4, -17, -5, -24, 5, -17, 0, 5, -7, -28, -10, -1, 6, -19, -12, -7, 3, -6, 7, 7, -1, -18, -21, 6, -20, 6, -13, 1, -12, -18, -21, -17, -15, -2, 8, 14, 9, -15, 11, 12, -7, -18, -7, -14, -2, -19, -3, 14, 10, -9, 5, -1, 5, 7, 7, -12, 2, -16, -14, 13, -16, -12, 5, -16, -1, 6, -1, 12, 0, 1, 0, 7, -18, 6, -7, -10, -2, -3, 8, -2, -14, -7, -13, 3, -6, -7, 13, 13, 3, -15, -8, 2, 2, 14, -7, 12, -14, -7, -4, 2, 2, 12, 18, 27, 27, 20, -2, 28, 16, 16, 10, 13, -15, 14, -5, 9, 2, 7, -6, -2, -19, -5, -1, 9, -1, 11, -14, -1, 3, -6, 12, 15, -2, -8, 1, 16, 20, 34, 21, 8, -9, 16, -12, 15, -6, -9, -1, 4, -5, -14, 9, 0, -12, -17, -20, -29, -20, -31, -22, 0, -27, -25, 8, -11, 10, 13, 7, 18, 29, 20, -2, 3, -3, 2, -12, -13, 3, -13, -21, -26, -27, -29, -21, 2, -24, 5, -9, 4, -22, -5, 7, -9, -18, -30, -6, -11, 25, -4, 8, -1, -11, -16, -3, 5, -24, -16, -12, -42, -10, -30, 3, -2, -4, 1, 14, 3, -1, -16, -2, -9, 7, -19, -18, -21, 3, 29, 8, 17, -3, 4, -1, -9, -12, -30, -11, -29, -16, -20, 11, 0, 13, 18, 14, -1, -8, 6, 0, -13, -15, -5, -17, -17, 11, 10, 20, 0, 11, 11, -17, -2, -21, -21, -31, -2, -28, 7, 4, 5, 6, 8, 3, -30, -12, -14, -18, -26, -1, -1, -3, -7, 5, 1, 12, 1, -10, -18, 1, 10, -19, -23, -3, -2, -7, -9, -15, -10, 11, 16, -34, -31, -31, -45, -22, -9, -13, -38, -24, -28, -33, 7, 7, -17, 1, 6, -13, 2, -20, -17, -28, -7, -3, 5, -3, 21, 11, 17, -19, -36, -29, -24, -10, -14, -10, -8, -37, -22, -7, 13, 4, 14, 13, -7, 12, -3, -23, -17, 2, -1, -6, 19, 9, 17, 18, 29, -7, -24, -6, 12, 3, 18, 0, -21, 5, -7, -19, -12, -7, -14, -15, -17, -10, 12, 9, -13, -8, 7, 0, 27, 16, 26, 14, 4, -10, -27, 20, 1, 4, 8, 20, -3, -7, -20, -13, -20, 2, -19, -5, 15, 7, -9, 5, 11, 0, 10, 24, 3, 22, 29, 10, 31, -12, -5, 0, 39, 12, 27, 17, 2, -2, -9, -10, -18, -17, -3, -17, 4, 0, -15, 10, 22, -8, -3, 28, 20, 6, 14, 8, -4, -19, -28, 15, 4, 17, 0, 16, 18, 15, -9, -10, -12, -1, -26, 12, 14, -4, 3, -20, 9, -3, 4, 25, 3, -7, 19, 17, 12, -33, -22, 4, 4, 17, 41, 17, 31, -4, 3, -22, -18, 3, -12, -4, -8, -7, -11, -18, -25, -13, -15, 5, 2, 11, 21, -3, -26, -33, -29, 18, 11, 12, 29, 30, 6, -23, -23, -10, -31, -19, -22, 4, -12, -6, 3, -22, 0, -14, 22, 19, 1, 8, 10, -8, -18, -26, 13, -3, 11, 5, 31, 24, 1, -30, -31, -10, -9, 7, -3, 0, 14, -14, -3, -30, -20, -20, 17, 8, 10, -12, -10, -4, 6, -6, 26, -16, 3, 0, -1, 22, 11, -14, -27, -30, -27, 4, -16, -13, -1, 3, -16, -19, -22, -3, -8, -2, -18, -9, -15, -2, -10, 20, 3, -13, -16, 7, -5, 11, -29, -35, -41, -25, -22, 6, -3, -16, 3, -9, 5, -4, -2, 5, -8, -40, -41, -12, -28, -19, 9, 0, -5, -13, 5, -11, -15, -18, -9, -48, -9, -28, -5, 15, -19, -14, 7, -18, -20, -3, -12, -7, -29, -17, 1, -19, -4, -23, 11, 12, -19, -15, -2, -7, -14, -36, -10, -12, 7, -7, 13, -7, 9, 0, 0, 14, -16, 3, -4, -18, -7, -4, -19, -22, 6, -21, 1, -13, -24, -25, -12, -21, -27, -24, -18, 3, -19, -6, 8, 7, 2, 0, -11, -2, -2, -9, -9, -21, -4, -24, -23, 3, 6, 5, -1, -9, -15, -22, -12, -11, -20, -7, 17, -8, 11, -9, -16, 8, 9, -15, 11, -5, 0, 2, -21, -4, -4, -11, -10, 15, 15, -10, 7, -2, -8, -19, 14, 11, -16, -5, 25, -3, 14, 11, -16, -3, -10, -17, -13, -9, 0, -16, -11, -6, -11, 11, -7, 5, 11, 18, 18, -1, 14, 15, -11, -5, -2, 12, 16, 19, 0, -6, 3, 5, 8, -5, -11, 13, 0, 0, 9, 7, -2, 18, 1, 24, 6, 24, 25, 4, 24, 4, -2, -10, -1, 5, 18, 13, 12, 11, -11, -7, -15, -3, -8, 5, 11, -3, -5, -1, 13, -3, -11, 6, -17, -4, -18, -7, 5, -12, -18, -8, -17, 2, 11, -1, 8, 2, 5, 8, -8, -16, -5, 5, -14, 16, 1, -7, 2, -11, 1, -2, -9, -15, -5, 3, -14, -14, -6, 0, 0, 4, 14, 13, -2, 12, 16, -6, 15, -2, -7, -3, -3, 5, -11, -10, 16, 14, 5, -8, 8, -15, -16, 11, -12, -12, 12, -13, -9, 9, -4, -16, -8, -10, -4, -8, -2, 14, 2, -1, -13, 9, 9, -14, -1, 13, -9, 21, 4, -3, 9, -25, -28, -13, 7, -7, 8, -11, -11, 16, -4, -5, -10, 14, -17, 6, -14, 14, -17, 3, 9, 3, 1, -14, 0, -6, 12, -6, -32, -35, -37, -19, -48, -24, -7, -12, -21, 2, 6, -16, -12, -5, -9, 0, -5, 11, -9, -14, -17, -2, 15, -12, 2, -2, -25, -30, -6, -22, -16, -34, -28, -20, -15, -19, -4, 3, -3, 8, -1, -7, 8, -15, -11, 5, 7, 16, 1, 7, -13, -11, -14, 13, -18, -26, -28, -18, 1, -23, 9, -21, -6, -21, -38, -8, -9, 15, -18, -6, -6, -12, -4, -17, -1, -4, 18, 21, 8, 15, 17, 1, 13, -14, -6, -23, -14, 3, 4, -19, -8, -17, -8, 7, -11, -2, 5, 4, -1, 0, 5, 0, 17, 18, -2, 31, 20, 3, 21, 0, 16, 2, 7, 15, -18, -16, -11, -7, -1, 2, -10, 7, 19, -6, -15, 14, 2, 1, 11, 2, -3, -1, 34, 35, 26, 25, 30, 16, 31, 22, 31, 16, 11, 19, 17, 17, 18, 24, 38, 21, 41, 34, 23, 7, -12, 7, -6, -3, 0, 26, 35, 28, 30, 37, 29, 27, 47, 54, 42, 55, 62, 20, 25, 5, 29, 20, 9, 31, 10, 8, 4, 33, 12, -4, -4, 10, 6, 12, 27, 54, 46, 56, 44, 46, 57, 67, 60, 74, 53, 53, 35, 10, 1, 6, 22, 13, 7, -31, -18, 24, 10, -2, 3, -1, 11, 13, 16, 32, 51, 31, 25, 37, 17, 14, 36, 12, -4, -23, -2, -9, 15, 8, -2, -4, -31, -38, -27, 7, 10, -2, 7, -9, 10, 10, -15, -14, -25, -15, -8, -19, -29, -27, -56, -59, -54, -38, -18, 4, -17, -16, -13, -47, -51, -27, -42, 9, -4, 13, 10, 3, 8, -22, -49, -31, -28, -30, -21, -50, -33, -40, -72, -46, -53, -41, -26, -10, -11, -33, -26, -23, -37, -40, -6, 7, 2, -4, -18, 11, 9, -18, -51, -42, -65, -60, -48, -35, -51, -49, -55, -46, -32, -27, -3, 13, 7, -13, -18, -12, -34, -13, 8, 20, 2, -4, -16, -6, 17, 6, -14, -59, -63, -52, -49, -31, -52, -47, -17, -6, -15, -9, -15, 2, 2, 9, 9, -3, -10, -1, 13, 13, 8, 12, 13, -14, 13, -1, -50, -42, -60, -26, -33, -25, -21, -13, -13, 0, 11, 7, 18, 16, 3, 20, 29, 36, 6, 18, 25, 25, 30, 14, 16, -1, -1, -8, -18, -48, -42, -26, -10, 8, -5, 1, -9, 8, -1, 0, 20, 18, 5, 11, 28, 5, 32, 14, 25, 53, 27, -7, 9, 10, 0, -3, -19, 5, 15, 23, 11, -15, 1, -18, -2, 19, 27, 19, -1, 8, 25, 6, 2, 12, 2, 12, 2, 5, 9, -7, -11, 7, -14, -8, 2, 3, 14, 4, 41, 2, 13, 18, 11, 26, 16, 22, 9, -8, -8, -19, -10, -11, 2, 3, -5, 17, 16, -12, 13, -1, -8, 0, 44, 8, 7, 20, 28, 17, 9, 20, 11, 12, 5, 19, 1, -13, -19, 6, -10, -20, -17, -13, 19, -8, -7, -8, 2, 5, 11, 23, 25, 24, 1, 15, 21, 19, 24, 17, 12, 15, 8, -6, -5, 3, 5, -13, -12, -28, -12, -6, -4, 1, -18, -12, 11, -3, 17, 9, 3, 30, 30, 7, 24, 21, 8, 13, 3, 4, -11, -4, 3, 26, 8, -9, -30, -3, -20, -6, 21, -1, 16, -18, -13, 13, -4, 11, 4, 7, 20, 25, 12, 10, -10, 21, -20, 1, -3, -8, 12, 3, 4, 15, 7, 11, -2, -14, 15, 2, 0, -2, -5, 6, -6, 6, 16, 10, 5, 6, -24, -9, -26, -18, -19, -18, 1, -6, -13, 21, 1, 5, -12, -11, -5, -5, -10, 8, 9, -17, -8, 11, 0, 15, 4, 3, 15, -10, -8, 7, 10, -4, 2, 0, 16, 27, 37, 14, 27, 13, 15, -18, -13, -3, 4, 14, -1, -5, -14, -14, 11, -12, -5, -9, -23, 9, -1, 5, 1, 5, 17, 1, 18, 29, 19, 14, 7, 21, -13, 14, -14, 4, -8, 9, 12, -17, 11, 12, -5, -17, 15, 12, -2, -5, 14, 11, 15, -1, -6, 16, 8, 2, -10, 15, 6, -2, -15, -6, -15, -16, 7, -16, 8, 11, -8, -17, -9, -14, -8, 7, -3, -16, -8, -19, 11, -11, -4, -2, -13, -1, -3, 8, 1, 7, -7, 12, 13, -8, -11, -12, -2, -14, 11, 13, 3, -5, -8, -2, -9, 11, -2, -1, -18, -8, -15, 0, -15, -19, 3, 6, 0, 6, -5, 3, 8, -18, -2, -18, -20, 0, -13, -3, -18, -17, -15, -14, -1, 12, 16, -5, -7, 4, -11, 16, -2, 15, 17, -15, -11, -2, -18, -2, -15, -6, -15, -3, 2, -8, -4, 0, 5, -5, 7, 7, -17, -8, -2, 18, 5, 5, 3, 23, 34, 2, -2, -13, -7, -6, -25, -23, -10, -5, -4, -4, 6, -2, -7, -3, -11, -2, -13, -2, 0, 10, 8, 24, 34, 32, 20, 6, -9, 9, 21, 5, -16, 9, 5, -27, -3, -16, -21, -17, 12, -20, -13, -3, -17, 0, 8, 10, 13, 30, 6, 26, 10, 11, -16, 9, 9, 2, 9, -3, 13, -14, 0, -12, -14, -4, 8, -1, -11, 9, 10, -8, 8, 3, 13, -16, 9, -10, -25, -37, -35, -13, -41, -31, 4, 1, 1, 7, 15, 6, 0, 3, -1, -25, -19, -2, 12, -5, 5, 9, 6, 1, 15, -18, -19, -2, -24, -25, -17, -29, -19, -25, 20, 1, 9, 2, -16, -6, 12, 30, 2, -32, -51, -20, 8, 1, 8, -6, -17, 9, -16, -17, -14, -48, -43, -37, -17, -31, -24, -8, -5, 16, -11, -21, -7, -11, 5, -1, -26, -17, -59, -26, 2, -19, 12, 4, -1, 12, -4, -38, -54, -51, -32, -38, -22, -44, -33, -16, -11, 2, -12, -44, -35, -16, 5, -11, -15, -38, -45, -19, -2, 1, 9, -9, -13, -6, -12, -11, -46, -48, -45, -41, -56, -42, -35, -29, -8, -3, -10, -28, -36, -7, 7, -10, -32, -54, -36, -16, 5, -4, -17, 11, 1, -3, -7, -40, -37, -42, -50, -36, -57, -60, -24, -18, -29, -16, -40, -52, -46, -4, 1, 6, -30, -40, -46, -7, -4, -2, -1, -10, -17, 4, -8, -26, -47, -41, -4, -23, -8, -23, -3, -3, -22, -23, -15, -52, -39, -3, -10, -13, -12, -16, -7, -18, 3, 2, 9, 10, 2, -6, -7, -21, -3, -2, 2, 0, 27, 31, 16, 31, -13, -13, -4, -36, -32, -21, -9, 2, -25, -21, 7, 28, 6, -10, 11, -7, 2, 17, -2, 2, 25, 14, 53, 56, 30, 47, 34, 25, -4, -15, -21, -15, -44, -27, -29, -17, 10, 26, 12, 14, 3, 0, -17, 10, -1, 14, 10, 9, 24, 16, 29, 61, 55, 23, 36, 42, 22, 3, -1, 5, -6, -4, -31, -4, -17, -2, 47, 30, 14, 4, 11, 11, -16, 23, 30, 36, 17, 19, 41, 52, 32, 21, 28, 20, 13, 3, 26, -7, 0, 16, 4, 37, 34, -1, 38, 33, 23, -6, -12, -1, -11, -5, 31, 35, 13, 31, 13, 40, 41, 17, 16, 29, -3, 21, 16, -13, 10, 8, 2, 43, 7, 16, 25, 35, 13, -4, -17, 11, 7, 19, 12, 27, 30, 28, 34, 19, 24, 0, 19, 1, 13, -6, -8, 27, 15, 5, 17, 11, 21, 26, 21, 11, 5, 15, -17, 10, -19, 17, 28, 3, -10, 24, 23, -2, 14, -6, -1, -2, -9, 1, 12, 14, 16, 6, 13, 27, 3, 11, 16, 5, 6, -1, -15, 10, -7, 1, 34, -3, -14, 22, 9, 12, -4, 3, -18, -29, -26, 6, 15, 2, 12, 8, 1, 20, -10, 0, -2, 14, 3, -12, -10, -1, -11, 16, 34, 8, 12, -13, -5, 6, -23, -9, -24, -31, -19, -1, -5, 22, 15, 32, 14, 28, -12, 19, 15, -9, -5, 2, 5, 11, -14, 2, 24, 8, -7, 2, -17, -27, 3, -14, -16, -32, -26, -3, 6, -15, 2, 7, -3, 0, 13, -5, -12, 0, -8, -16, -17, -10, 0, -7, -22, -1, -23, -41, -30, -25, -2, -21, -19, -12, -12, -27, -2, -24, -12, 9, 8, 0, -6, -18, -11, -13, 3, -2, -19, -9, 1, -1, -12, -9, -26, -21, -37, -21, -34, -27, -21, -25, -32, -28, -36, -14, -24, -5, -4, 13, 5, -5, 15, 15, -18, -2, -10, 5, 3, 5, -11, -6, 4, -19, -31, -45, -45, -19, -36, -52, -22, -14, -15, -12, -41, -53, -34, -16, -13, 7, -8, 3, -7, -2, -13, -17, -12, 12, -13, -11, -9, -8, -7, -5, 8, -12, 2, -10, -12, -15, -9, -22, -24, 8, -9, -13, -18, -5, -11, 13, -10, -2, 11, 7, 3, 1, -17, -9, -4, -7, 12, 12, -18, 14, -19, 3, -10, -10, -12, 13, -16, -13, -20, -13, 1, 13, -6, -5, -17, -3, 9, -8, -16, -16, -1, -16, 6, -11, -1, -15, -11, -5, 6, -19, 5, -15, -16, -6, -16, 0, -20, 6, -15, -5, -3, 10, 3, 4, 8, -21, 12, -20, -12, -17, 1, 4, -19, 3, -11, -10, -23, -4, 10, -24, 2, -11, 4, -4, -23, 9, -14, 7, 7, -11, -11, -5, 11, 0, -13, 8, 0, 11, 4, -19, -1, -7, -20, -11, -18, -18, -29, -30, -3, -1, -18, 8, -12, -2, -13, -10, 1, -2, -5, -17, -18, -10, -6, 1, -8, -12, 2, -25, -22, -27, -39, -37, -43, -53, -30, -26, -26, -3, -14, 3, -19, 3, 3, -20, 0, -17, 0, -16, -13, 4, -8, -18, -14, -23, -9, -7, -26, -32, -51, -57, -57, -61, -34, -53, -42, -31, -15, -22, -36, -17, -9, -7, -13, -12, -19, -13, -8, -8, -7, 6, 1, -5, -3, -16, 5, -13, -40, -7, -15, -41, -36, -28, -46, -42, -37, -33, -24, -10, -13, -6, -15, -11, 7, 8, 8, -11, -9, 15, 8, 0, -15, 3, 19, 5, 12, 30, 22, 2, 20, -3, 5, 4, 20, 17, 8, 3, -3, 16, -10, -5, 9, -20, 1, 4, 1, -2, 11, -11, 24, 14, 27, 42, 11, 26, 13, 36, 32, 28, 13, 10, 30, 1, 11, 13, -3, 3, 2, -11, 11, -20, -13, 13, 12, -4, -17, 19, -2, 29, 34, 9, 5, 27, 31, 26, 17, 14, 21, 18, 15, 7, 5, 26, 22, 2, -7, -19, -12, -16, 4, 7, 12, 25, 8, 23, 36, 4, 28, 28, 19, 28, 10, 25, 41, 20, 5, 19, -5, 5, 11, 6, 42, 16, -12, -7, -5, -4, -12, -13, -14, 4, 3, 27, 31, 7, 23, 33, 29, 5, 15, 40, 37, 20, 22, -12, 7, 1, 31, 26, 9, -21, -7, -15, -19, -17, -14, -5, 15, 8, 11, -2, 30, 5, 14, 22, 9, 13, 3, -3, 10, 22, 5, -2, -10, 1, 28, 1, -11, -18, -43, -15, -9, 9, 2, -11, 10, 4, 8, 19, -3, 25, 27, 8, 24, 9, -37, -32, -12, 31, 25, -16, 9, 4, 21, -12, 5, -42, -39, -21, -2, -21, -20, -5, 12, 15, -3, -14, 16, 12, -6, -20, -26, -33, -41, -8, -12, -9, 16, 10, 0, 5, 15, 17, -2, -22, -26, -12, 1, 0, 8, -14, -14, -3, -3, -24, -2, 7, 17, -24, -31, -6, -27, -13, 0, -14, -6, -12, 14, 36, 23, 19, 0, -12, 9, 6, -9, -7, 4, -14, 2, 13, -10, 0, 17, -1, -7, -20, 11, -21, -7, -31, -21, -12, -8, -3, 43, 14, 32, 38, 19, -7, 5, -23, -15, -9, -18, -7, -14, -14, 6, 9, 10, 17, 12, 27, -14, -7, 14, -22, -16, -8, -7, 15, 40, 39, 36, 17, 21, -15, -11, -5, -11, 0, -15, -17, -19, -15, -5, -11, -1, 31, 24, 20, 5, 16, 6, 2, -26, -6, 13, 3, 29, 13, 24, 5, 16, -7, 3, 3, -10, 8, -16, -10, -8, -4, 3, -20, -9, 5, 0, -6, -14, 6, -7, -5, -12, -27, 6, 16, 3, 18, -1, 30, 15, -23, -16, -9, -20, -21, 5, 7, -6, -11, 12, -6, -43, -22, -21, -41, -23, -45, -41, -19, -22, -22, -1, 3, -11, 15, 17, 16, -21, -16, -4, -7, -16, -15, -5, 2, -16, -21, -18, -36, -29, -64, -48, -26, -62, -52, -43, -22, -20, -37, -19, -3, -38, 5, -17, -10, -14, -28, -2, -10, -2, 5, -16, 5, 10, -22, -26, -21, -26, -45, -40, -30, -44, -21, -29, -20, -50, -4, -5, -34, -27, 5, -34, -16, -51, 2, 10, -12, 5, -9, -12, -11, 1, -24, -3, -31, -23, -34, -3, -8, -24, -17, -27, -32, -1, 7, 12, -20, -28, -36, -34, -39, -36, -16, 4, 9, -18, -21, -14, 10, -19, 9, 14, -7, 24, 2, 10, 6, -5, -6, -6, -7, -12, -12, -11, -21, -3, -32, -25, -35, -23, -15, -8, -5, -2, -7, -6, -11, -4, -4, -1, 25, 31, 13, 16, -4, 18, -6, -16, 8, 20, -5, 23, -1, -30, -15, 1, -5, -8, -13, -12, -8, -9, -6, -19, -8, 11, -14, -7, 9, 30, 12, 26, 8, 38, 41, 28, 29, 16, 12, 24, 24, 25, 26, 21, 6, -2, -8, 6, 2, 10, -10, -10, -13, -4, -14, 2, -20, 0, 10, 21, 33, 34, 16, 6, 46, 35, 45, 34, 34, 8, 16, 0, -9, -18, -21, 8, 3, -8, 7, 12, 9, 8, 4, 6, -9, -5, 7, -4, 1, -3, -8, 10, 0, -5, 8, 14, -12, -8, -1, 11, -9, 4, -9, 10, -14, -5, 12, 16, -4, 12, 2, 12, 13, -8, 6, 7, 20, -9, 8, -4, 18, 19, 0, 14, 4, 15, -1, 5, -7, 13, 3, 0, 9, 20, 19, 18, 17, 13, -6, 23, -7, -6, -5, -8, 17, -12, 13, -8, 4, 0, 7, -7, 18, -2, 12, -2, 19, 7, 8, 2, -3, 23, 23, 18, -5, -1, 2, 4, 3, -3, 10, 11, 22, -2, 8, 1, -1, -10, 0, 17, -14, 2, 1, -13, -9, 4, 10, -4, 1, -5, 15, 14, 3, 10, 10, 21, -9, 5, 6, 1, -9, -16, 17, -7, -19, -11, -25, -13, -29, -32, -27, -15, 1, -19, 10, 21, 1, 14, 21, 21, 16, 0, 20, -12, 19, 12, -7, 10, 7, -11, -1, 16, -15, -8, -23, -23, -17, -18, -39, -24, -9, -17, -1, -16, 14, 19, 20, 14, 12, 1, 10, 24, 11, 10, 16, 10, 23, 34, 27, 17, 18, 22, 5, 6, -24, -10, -29, -34, -24, -19, -21, -23, 7, 14, 16, 13, 7, -1, 14, 17, 7, 8, 27, 39, 34, 16, 25, 19, 12, -9, -20, 20, 2, -13, -18, -16, 0, -26, -20, -28, 15, 8, 22, 18, -9, 16, 6, 20, 21, 44, 16, 7, 31, 29, 17, 8, 12, -8, -2, -2, 25, 13, 5, -23, -23, -38, -24, -14, -25, 13, 20, 0, 16, 16, 16, 30, 11, 14, 15, 3, 25, 27, 15, 18, -1, 12, -1, 22, 34, 36, 19, -25, -22, -52, -25, -18, 5, 0, 2, 22, 4, -1, 21, 15, 5, 16, -10, 12, -6, -6, 10, 5, -11, -2, -6, 13, 41, 35, -5, -35, -57, -41, -42, -18, -11, 17, 12, -11, -10, 5, -3, -12, 7, 14, 3, -9, 12, -22, -15, -13, -18, -16, 17, 27, 47, 24, 2, -40, -52, -24, -15, -35, -2, -4, -5, -1, 13, -2, 10, -22, -10, -3, -29, -5, -21, -2, -7, -31, -27, -27, -24, 20, 7, 25, 4, -37, -28, -14, -24, -24, -2, 11, -7, 7, -6, 1, -5, -8, -14, -29, -20, -41, -37, -38, -14, -5, -19, -18, -3, 11, 17, 21, -35, -53, -36, -3, -32, -19, 26, 18, 14, 6, -1, 17, 14, -12, -16, -33, -41, -40, -39, -22, -8, -10, -9, -34, -4, 18, -4, 12, -22, -20, -4, 10, -1, 14, 20, 29, 5, -4, 7, 3, 1, -28, -33, -42, -36, -40, 3, 1, 15, 10, 2, -34, -8, 14, 23, 13, 2, -33, -5, -7, 6, 36, 31, 3, -5, -5, 11, 0, 10, -9, -33, -21, -20, -8, 7, 37, 4, -7, -20, -9, 13, 8, -2, -11, 15, 12, 8, 17, 15, 20, 18, 0, 18, -2, 20, 4, 13, -8, 1, -10, 8, -3, 32, 5, 13, -16, -1, -5, 19, 16, 27, -1, 25, 17, 5, 10, 10, 23, 22, 1, -9, 5, 7, 22, 1, -5, -21, -10, -5, 12, 2, -5, 17, -11, 15, 25, 9, 0, 13, 3, 16, -6, 20, 26, -3, 22, 24, 15, -9, -7, 23, 17, -8, 9, -34, -5, 3, -2, 2, 19, -2, 18, 4, 21, -4, 14, 10, -4, -9, 7, 2, -1, 13, 19, 28, 12, 20, -5, 15, 17, -10, -11, -10, -16, -14, -20, 15, 2, 22, 4, 0, 2, 17, -11, -22, -8, -15, -30, 0, -18, 8, -13, 29, 18, 4, 5, 19, 10, -6, 8, -17, -19, -19, -17, -11, 21, 21, 21, 19, 1, 0, 5, -41, -38, -38, -9, -26, -6, -3, 15, -8, -1, 12, -5, 9, -6, 0, -9, -28, -41, -25, -17, -26, 8, 15, 5, 4, 13, -18, 7, -14, -21, -6, -33, 1, 5, -5, 18, 2, 0, 2, 18, 16, -2, -13, -4, -19, -30, -4, -3, -3, 7, 18, -7, 22, 19, 8, -19, -10, -12, -28, -1, 0, -5, -12, 6, 11, -5, -6, -6, 15, -8, -16, -14, -10, 8, -5, 13, 4, 0, 18, 27, 7, 21, 2, -5, -27, -27, -19, -5, -5, 8, -17, 2, -8, 15, 11, 6, -3, -11, -6, -12, -6, 1, 0, -14, 5, -15, 1, 3, 4, 19, 6, -14, 7, -26, -11, -34, -29, -9, 5, 14, 20, 14, -6, 9, -1, -2, -7, 1, -7, -13, 19, 3, 2, -1, -6, -8, -18, 2, 6, -18, -9, -12, -35, -6, -19, -28, -8, 8, 5, 9, 17, 5, 11, -10, 22, 14, -14, 11, -9, 12, 14, 18, 6, 12, 6, -10, -3, -9, 14, -2, -3, -5, -13, 10, 14, 19, 22, -11, 5, 10, -7, 7, -2, 5, -8, 18, -11, 17, 18, 13, 5, 1, 8, 16, 14, 24, -8, 23, 23, 20, -11, 14, 8, 10, 4, -5, 11, 12, -18, -12, 6, -17, -4, 5, -4, -16, 2, -7, 6, -2, 12, 2, 0, 9, -20, 12, 11, -1, 11, -13, -18, -7, 4, -11, 3, -11, 9, 11, -3, -18, -6, -1, 5, 7, 5, 4, -6, 3, 2, -18, 2, 8, -3, 12, 4, -13, 16, 1, -17, 13, -17, 11, 6, 10, -13, -15, -20, 8, -10, -3, 17, 19, 13, 14, 18, 0, 20, 7, 36, 19, 3, 17, 13, 14, -5, -14, -2, -1, -15, 6, 12, 7, -16, -4, -19, -12, 9, -13, 18, 11, 8, 19, 17, 7, 29, 8, 13, 32, 14, 30, 30, -8, -3, -10, 12, -12, 8, -10, 13, 14, 9, 2, 7, 8, 14, 12, 13, 0, -1, 30, 17, 1, 20, 11, 16, 28, -2, -3, 32, 10, 19, -10, 0, 8, -5, -18, 8, 4, 10, -5, -5, -12, 10, -6, 20, 8, 12, -13, -7, -11, -1, 11, 14, 3, 0, 22, 8, 27, 4, 5, -2, 4, 7, -18, -9, -4, 6, 0, -20, 7, 7, 12, 13, 7, 3, 2, 10, 12, -17, 3, -1, -11, 8, 2, -3, 7, -12, 9, 5, 6, 17, -11, 10, -10, 8, -8, -20, -17, -31, -34, 8, -18, 1, 13, -7, -4, 11, -5, 8, -23, -9, -6, -14, -15, 4, -9, -30, -11, -7, 8, -10, 3, -6, -20, -20, -16, -15, -10, 9, -24, 4, 24, -1, 1, 0, 8, -16, -12, -25, -31, -12, -6, -1, 2, -24, -17, -13, 6, 2, 8, 6, 12, -15, -4, -2, 2, -13, 10, -6, 2, 4, -14, -20, 9, -5, -17, -13, -22, -2, 8, -14, 10, -20, -1, 10, -6, -16, -17, 12, -16, -1, -1, -26, -24, 11, -19, 3, -11, -19, -10, 0, 9, 12, -3, -21, -11, -17, -9, -1, -15, 3, 13, 22, -11, -10, -5, 12, -7, 14, -12, -25, -22, -23, -27, -21, -39, -46, -36, 2, -9, -1, -19, -19, 6, 9, -10, -4, -14, 27, 12, 6, 13, 15, 11, -12, 8, -18, -11, -24, -34, -2, -30, -20, -40, -48, -44, -1, 6, 1, 2, 0, -2, -20, 0, 8, -15, -14, 17, 6, -12, 8, 0, 6, 0, 4, -27, -36, -15, -15, -8, -6, -34, -43, -9, 29, 11, -2, -17, 3, -4, 12, 14, 17, -14, 0, 1, 16, -10, -12, 0, 3, 4, 8, -7, -33, 13, 5, -14, -1, -2, -21, 22, 54, 31, 36, -19, -12, 4, -10, 0, 12, -4, -14, -14, 19, 2, -1, 10, -10, 3, -5, -4, 9, 22, -19, -14, -13, -24, 12, 49, 59, 57, 33, 2, -26, 3, -12, -20, 7, -7, -10, 3, 19, 13, 6, -6, 6, -17, 18, -10, -11, 5, 9, 1, 5, -14, 11, 17, 20, 45, 6, 12, -6, -24, -23, -12, -20, 4, 21, 13, 26, 17, 15, 3, 4, 6, 15, 19, 13, 3, 6, -14, 3, -16, 12, 15, 33, 25, 16, -10, -16, 9, 0, -22, 6, -3, 9, 5, 31, -7, -17, -12, -4, 1, 2, 10, -4, -10, 9, 20, -8, -15, 15, 5, 25, 21, -6, 13, 11, 18, 11, -6, 7, 9, 24, 37, 5, 16, 15, -8, 1, 4, 7, 7, 5, 4, 34, 26, 27, -1, -2, -3, -6, 28, 27, 26, 42, 19, -3, 11, 11, 3, 36, 33, -3, 10, 3, 9, -18, 16, 15, -5, 2, 38, 42, 25, 23, 21, 26, 26, 15, 26, 17, 43, 46, 32, 10, 31, 10, 7, 4, 22, 0, -17, -13, -6, -5, 5, 25, 30, 10, 42, 29, 12, 23, 18, 12, 10, 15, 41, 37, 16, 10, 20, 16, 19, 19, 19, 10, 9, 5, 0, -11, -10, 7, 12, -14, 28, 37, 11, 10, 12, -1, 10, 8, 0, 22, 4, 9, 21, 6, -9, 7, 24, -7, -11, -7, -9, -12, -20, 5, -12, 2, -5, -12, -1, -7, -11, -19, -32, -19, -25, -35, 5, -6, -9, 3, -8, -14, -4, -10, 3, -6, -15, -13, 5, -15, 0, 6, -16, 13, -6, -3, -15, -3, -19, -29, -39, -38, -16, -20, -20, -20, -29, -24, -36, -4, -22, -2, -21, -22, -25, -20, 4, -18, 7, -18, -17, -3, -2, 3, 1, -24, -20, -16, -31, -1, -8, -18, -7, -42, -14, -13, -24, -16, -17, 4, -6, 7, -4, 4, -10, -13, 11, -20, -12, 2, 1, -9, -17, -15, 4, -6, -8, -1, -23, -26, -18, -14, -27, 1, -9, 2, -22, -21, 5, -6, 11, -1, 1, 0, 0, 10, 9, -15, -17, 9, 1, -18, 8, -8, -15, 12, -12, 0, 14, -2, -10, -10, -5, 11, -3, 5, 9, 7, -7, -9, -13, -12, -16, 14, 6, 2, -11, 2, 0, -4, 12, 2, -11, 11, -19, -7, 3, -8, -10, -5, -1, 4, -14, 8, 9, 8, 3, -1, -16, -18, -20, -11, 8, -4, 6, 11, 9, -9, -12, -3, 1, -19, -17, -11, -2, -12, 8, 14, -9, 2, 11, 10, -3, -5, 10, -18, 13, 4, -1, 13, -2, -6, -10, -10, -3, -19, -17, 7, 6, -1, 4, -13, -2, -16, 6, -4, 4, -12, -11, -6, -22, -3, 9, 10, -11, 2, 11, -8, -11, -15, -14, 9, -20, -12, -10, 13, -4, 0, 11, 27, 28, 1, 29, 9, -16, 7, -17, -22, -1, -23, -26, -22, 0, -3, -20, -2, 9, -14, -7, 9, -3, 3, -1, 30, 31, 26, 40, 38, 27, 37, 16, 20, 12, -22, -15, -3, -37, -38, -14, -14, -19, 4, -18, -18, -21, -20, -18, -5, 8, 17, 22, 23, -9, 16, 10, -8, 12, 23, 17, 11, 18, -7, 24, 11, -2, -23, -24, -25, -20, -3, 3, 7, -3, 0, -20, -14, 23, 25, 20, 18, -5, -11, 0, -2, 10, 11, 13, -4, -5, 7, 4, -8, -14, -26, -18, -30, -32, -6, 13, -3, 5, 9, -16, -9, 23, 28, 2, 19, 15, 3, -7, 3, -9, -17, 4, 7, -7, -5, -7, 4, -20, -38, -27, -45, -41, -5, 5, 2, 6, -17, 4, 14, 11, 30, -8, 10, 17, -12, 4, -30, 7, -10, -7, 2, 21, 4, -3, -12, -21, -30, -31, -33, -38, -8, -4, 3, -7, -3, 12, -4, 15, 25, 16, 1, 0, -22, -19, -15, -17, 11, 16, 21, 32, 4, 18, -20, -12, -34, -15, -22, -28, 0, 7, 4, 2, -10, -8, -9, -5, 2, -16, 0, -14, -30, -32, -3, 10, 18, 7, 10, 24, 17, 1, -16, -25, -41, -35, -11, -1, -17, -21, 3, 12, -19, -18, -5, -11, -18, -20, -19, -27, -28, -25, -15, 19, 20, 2, 18, 16, -5, 7, 8, -27, -53, -28, -4, 3, -6, 10, 0, 5, -2, -1, 4, -7, -14, -42, -42, -22, -32, -9, -13, 33, 7, 6, -13, -1, -14, -16, -10, -36, -47, -50, -23, 1, 13, -2, 0, 4, -15, -14, -4, -14, -15, -5, -30, -8, -7, -14, -28, 22, 22, 23, 0, -26, -12, 3, -12, -49, -30, -40, -10, -11, 14, 7, 5, -7, 5, 7, 4, -24, -30, -18, -10, 12, -9, -19, -44, -12, 14, 12, 0, -4, -33, -36, -25, -28, 2, -3, -12, 8, 4, -11, -8, -6, -11, 5, 0, -10, 0, -17, -4, -18, -28, -37, -33, -28, 24, 23, -6, 1, -22, -52, -14, -18, 3, -7, 5, -4, 4, 10, -1, 12, -12, 2, -4, 8, -9, -35, -27, -27, -30, -29, -41, -52, -4, 23, -4, -30, -36, -16, -9, 1, 19, 36, 25, 30, 2, 3, 2, -18, -11, -15, -5, 18, -25, -34, -37, -42, -48, -62, -64, -61, -28, -5, -19, 1, -20, 0, 20, 11, 5, 22, 32, -15, 5, 9, -6, -15, -1, -3, 11, -13, -3, -11, -10, -34, -52, -67, -60, -44, -18, -13, -16, 3, 6, 7, 15, -1, 6, 21, 8, -2, 9, 5, 3, -21, 10, -8, 20, -21, 6, -1, -10, -1, -15, -10, -28, -24, -10, 6, 12, 8, 23, 13, 8, 8, 33, 12, 5, -12, 5, 12, -2, 3, -3, 9, 15, 8, -25, 1, 0, 1, 5, 8, 11, 14, 4, 2, 4, 17, 31, 23, 19, 46, 28, 30, 19, 0, 10, 6, 2, -1, 9, 9, 12, 23, -19, -5, 26, 20, -8, 22, 3, -3, 12, -6, 1, 0, 25, 47, 33, 26, 19, 6, -3, 4, -1, -7, -8, 12, -20, 7, 14, 19, 1, -6, 23, 9, 14, 2, 24, 3, 2, 6, 0, 6, 39, 38, 37, 26, 24, -8, -14, -10, -18, -17, -5, 8, -16, 15, -10, 21, 27, 1, 3, 28, 29, 36, 4, 25, 6, 2, 34, 5, 33, 34, 30, 6, -6, -11, -14, -4, -14, -18, 7, -14, -3, -8, 11, -3, 19, 19, -6, -3, 30, 2, 23, 3, 25, 28, 13, 1, 29, -4, 10, -9, 4, 2, -11, 11, -1, -11, -6, -5, 11, 0, -10, -19, -11, -2, 6, -1, 9, -4, -9, -4, 7, 11, -1, 0, -28, -10, 3, -19, -1, 6, 0, 3, -14, -1, -12, -12, -12, -16, -3, -19, 7, -16, 7, -4, -9, -27, -21, -15, -40, -8, -6, 0, -10, -11, -24, -10, 12, 7, -3, -5, 10, 10, -21, -8, -2, -21, -16, 2, -10, 9, 12, -20, -10, -6, -5, -20, -18, 10, 6, -21, 6, -3, 8, 5, -19, -19, -2, 13, 12, -16, -3, 14, 16, -10, 10, -10, 4, 2, 12, -8, 1, -14, 16, 5, -16, -1, -14, -5, -2, -14, -16, -5, 15, -13, -12, -7, -4, 11, -8, 3, 7, 5, -8, 7, 11, 2, -15, 10, -3, 8, -11, -3, 6, 15, -13, -13, 16, -13, 6, -13, 1, -13, -11, -14, -2, 8, 9, -9, 7, 10, 13, -17, 12, 11, -3, 8, 16, -6, 11, -4, 14, -4, -4, 17, 5, 10, -9, -7, 3, -4, 7, 3, 1, -11, -11, -13, 2, -11, -14, 4, 0, 0, 7, 22, -13, 9, 4, 14, 10, 7, 22, 8, 10, 13, 20, 28, -10, 9, -7, -11, -17, 13, -12, 9, 15, -14, 10, 1, -6, 3, 18, -8, -5, -14, -2, -16, -32, -42, -2, -18, -15, -15, 13, 5, 4, 0, 7, -3, 6, 11, 6, 4, 7, 10, -1, -3, 17, -10, -9, -14, -8, 5, -30, -33, -28, -40, -5, -11, 1, 21, 10, 20, 27, 32, 13, 18, 6, 8, 6, -14, -11, 2, -3, -8, -6, 13, -10, 2, 24, 15, -8, -21, -13, -33, -23, 7, 15, 22, 12, 35, 10, 31, -3, 18, -19, -7, -2, -2, 17, 3, -13, 20, 19, 4, 11, -3, 18, 25, 12, 0, 3, 4, -8, 19, 40, 48, 24, 41, 15, 4, -17, -25, -16, 10, -13, -10, 14, -14, 4, 29, 17, -25, 23, 5, 22, 51, 44, 15, -9, -5, 14, 6, 41, 46, 9, 24, 5, 23, 1, -15, -7, 9, -1, -4, 0, -14, 24, 17, -4, 7, 32, 23, 17, 18, 4, 4, -48, -61, -19, 8, 32, -4, -9, -3, 5, 18, -11, -15, -10, -13, 15, -1, -2, -11, 3, 9, -7, 8, -6, 3, -13, -10, -18, -53, -94, -57, -17, 7, 18, 2, -18, -1, -20, -24, -30, -3, -11, -9, -14, 5, 14, -5, 7, -19, -23, -40, -52, -39, -77, -79, -85, -128, -99, -12, 2, 4, 2, -10, -7, -23, -13, -12, -6, -22, -5, 2, 1, -14, -10, 14, -14, -57, -54, -47, -76, -83, -92, -89, -105, -68, -15, 1, 31, 2, -12, 5, -25, -4, -5, -16, -27, -22, 14, -14, 12, 16, 1, 15, -16, -46, -80, -60, -103, -103, -96, -73, -12, 8, 28, 19, 14, 13, -7, -7, -21, 3, -4, -3, -19, -14, 9, 17, -4, 7, -15, 7, 1, -7, -42, -59, -41, -43, -13, -3, 22, 48, 20, 25, 18, 29, 14, 12, 12, 18, 7, -3, 10, 4, 14, 16, -11, -9, 17, 8, 5, -2, 13, -12, 1, 7, 7, 32, 54, 48, 35, 29, 24, -8, 4, 22, 30, 16, 14, -2, 17, 31, 1, -1, 8, 16, -11, -1, 7, 6, 21, 30, 40, 30, 35, 35, 35, 39, 30, 31, 20, -3, 1, 15, 24, 12, 27, -6, 19, 9, -1, -9, 16, -15, 3, 10, 16, 41, 12, 32, 18, 45, 18, 13, 33, 18, 13, 17, 3, 13, 12, 24, 2, -15, 9, 1, -7, -1, 20, 14, -8, 5, 10, -2, 46, 38, 38, 17, 2, -3, -3, -11, 11, 9, 24, 1, 12, 20, -1, 9, 4, 6, -12, -7, 4, 19, 22, 12, -14, -9, 6, 1, 25, 51, 12, 21, 5, 7, -2, -5, -3, 7, 7, 10, 9, 1, -7, 9, 13, 13, 2, -18, -18, -5, -6, -12, 10, 1, -4, 0, 42, 48, 18, 26, 7, 7, 6, -29, -26, -27, 4, 16, -5, 5, 6, 6, -14, -13, -17, -13, 1, -4, 16, 17, 13, -17, -1, 1, 7, 16, 3, -10, 8, -26, -20, -12, -14, 1, -24, 6, -3, 0, 13, 15, 15, 22, -12, -28, 0, 2, 9, 7, -12, -8, -9, -14, 2, 29, 5, -2, -9, -8, -32, -16, -9, -23, -1, -6, 8, 25, 12, -3, 19, 9, 4, -10, -16, -12, 1, 2, -1, 1, -11, 0, -3, 25, 35, 14, -1, -17, 3, -16, -19, 3, -15, -2, -13, 7, 26, 16, -23, -8, -15, -3, -3, -12, -3, -1, -7, -6, -1, 6, 10, 9, 29, 21, 25, 28, 8, 2, 8, 8, 16, 21, 7, 14, -4, -51, -32, -20, -17, -7, -9, -12, 16, 3, 4, -16, -4, 0, 14, -9, 18, 18, 7, 14, 20, 19, 1, 25, 11, -11, -2, -9, -34, -18, -41, -13, -34, -12, 2, 16, 4, 10, -12, 2, -16, 6, -9, -3, 1, -16, -4, -2, -11, 0, -1, -22, -10, 0, 2, -12, -18, -13, -19, 2, -22, -5, -13, -1, 10, -11, -8, 12, 17, 2, -8, -10, -6, 7, -4, 9, -10, -12, -5, 2, -2, -10, -4, 6, 12, 1, 15, -5, -16, -16, -3, -12, 1, -4, 11, -9, -11, 19, 18, 3, -6, 3, 10, 17, -10, 3, -6, -14, -6, -2, 12, 17, -4, -6, 12, 10, -10, -12, 18, 19, 2, 20, 5, 3, 11, 18, -13, -4, -14, 17, 16, -9, -14, -14, -5, 6, 1, 11, -14, -21, 4, 2, -4, 12, -12, -13, -13, 1, 17, 10, 18, 11, 19, 7, 18, -2, 11, -11, -6, 1, -1, 6, -23, -13, -28, -9, -14, -30, 6, -11, -5, -8, -3, -17, -2, 7, 13, 11, 19, -6, -11, -4, 0, -12, -9, 2, -14, -5, 4, -16, 2, -34, -29, -39, -33, -21, -10, -11, -8, -7, 5, 3, 0, -6, 19, 2, -7, -13, -2, -8, -12, -6, 3, 2, -1, -13, -23, -32, -16, -19, -7, -26, -14, -15, -19, -19, -44, -20, 5, 6, 20, 13, -10, -3, 14, 13, -14, 5, 15, -9, -15, -17, 5, -26, -14, 0, -8, 4, -14, -21, -18, -23, -30, -30, -28, -22, 2, 7, 9, 2, -12, 16, 19, -11, -7, 7, 13, -13, -8, -11, -27, -21, 1, 6, -4, -13, -19, 1, -22, -25, -16, -25, -30, -4, -10, 0, 14, 29, -6, -7, -2, -11, 7, 4, 4, -3, -11, -9, -8, 0, -3, 1, -10, 1, -9, -2, -17, -22, -16, -6, -11, 5, 18, 15, 18, 29, 9, 24, -9, -11, -5, -3, 13, -13, 0, -3, -23, -16, -8, -7, -20, -1, -21, 3, -1, -20, -13, -7, -23, 4, 13, 10, 31, 32, 23, 9, 12, 4, 6, -15, -22, -14, -30, -35, -27, -2, 13, -8, 4, 8, 8, -2, 4, 7, 11, -4, -26, -9, -9, -7, 22, 19, 25, 9, 1, -5, 4, -3, -11, -16, -29, -35, -7, 10, 16, 12, 4, 18, 7, -25, 4, 13, 7, -1, -28, -29, -11, -5, 9, 4, 32, 20, 2, 0, 7, -5, 2, -17, -25, -12, 17, 32, 6, 19, 28, -8, -5, -33, 16, 19, 2, 4, -27, -12, -20, 8, -5, -9, 3, 14, -11, 11, 9, -16, 0, -19, -46, 9, 7, 12, 15, 35, 25, -5, -6, 16, 30, 31, 12, 8, -19, -26, -19, 6, -13, 3, -11, 4, -6, 9, -3, 3, 0, 0, 7, -2, 22, 17, 12, 39, 35, 4, 3, 27, 17, 22, 38, 4, -18, -11, 0, -9, -8, -6, -15, -5, 3, 8, -14, -16, -11, 15, 21, -4, 21, 31, 24, 14, 21, 29, 20, 16, 16, 44, 46, 2, 18, -9, -9, -20, -12, -15, -17, 5, -4, -7, 6, -4, 12, 0, -16, 12, 22, 18, 14, 5, 27, 14, 14, 20, 23, 29, 35, -2, -21, -37, -27, -27, -24, -14, -16, -18, -14, -12, -4, -8, -13, -6, -6, -24, -2, 9, 3, 19, 24, -3, 28, 7, 25, 32, 12, -12, -44, -52, -11, -26, -36, -27, -10, -11, -3, -12, -12, -13, -2, -26, -17, -36, -55, -26, -24, -24, -35, -10, -3, 23, 9, 7, 9, -21, -61, -39, -20, -38, -17, -21, -8, -8, 6, -12, 12, -8, -15, -15, -26, -22, -32, -20, -36, -38, -35, -11, 3, -3, 17, -2, -25, -41, -37, -29, -30, -34, -31, -28, -23, -8, 11, 2, 4, -7, 2, 10, -3, -41, -43, -37, -18, -18, -30, -42, -32, -3, -15, 7, -24, -15, -35, -25, -27, -26, -38, -12, 0, -10, -10, 7, 16, 13, -21, -23, -25, -25, -29, -38, -23, -18, -16, -36, -17, -1, -16, 5, -18, -8, -41, -44, -31, -22, -7, -10, 1, 19, 1, -13, -1, -4, 11, -4, 2, -2, 1, 0, 1, -7, -13, -9, -10, -31, -26, 4, -4, -10, -54, -40, -32, -12, 5, -10, 1, -13, 11, 5, 11, -6, 5, -18, 1, 5, -5, 0, 20, 17, 2, 1, -4, -12, -7, -15, -6, -3, -27, -11, -26, 5, -6, 5, -13, 13, -4, 4, 11, -1, -12, -21, -16, 4, 18, 28, -3, 31, 20, -12, -12, -3, 7, -5, 18, -6, -11, 11, -16, 16, -5, 7, 1, 18, 2, 14, 13, -3, 5, 11, 0, -4, 9, -4, 27, 23, 2, 1, -24, 12, -10, 6, 8, 16, 17, 8, 9, 17, 3, 5, -4, 20, -9, -2, 1, 4, 1, 14, 12, -15, 8, -24, 10, 11, -7, -23, 6, -4, 10, 1, -16, 3, -7, -16, -6, 22, 6, -3, -10, 18, -3, -10, 0, 16, 0, -6, 1, 14, -9, -9, -21, -4, 9, 2, -6, -23, 7, 9, -19, -23, 4, 11, 1, -9, 18, -5, -6, 1, 2, 0, -4, -7, 10, -8, 18, 5, -5, -14, 5, 12, 9, -7, -9, -3, -6, 11, -5, -6, -13, -12, 15, 2, 11, 6, -9, -14, 6, -17, 6, -2, 5, -12, 9, 14, 10, -14, -16, 4, 7, -11, -17, 16, -9, 0, 14, 4, 14, -2, -16, -4, -15, -8, -8, -6, -3, 9, -17, -12, 1, -4, -5, -7, 16, 8, 6, -1, 11, 8, -3, -4, -12, -15, -6, -15, -5, 13, 7, -2, -11, -13, -8, 16, -4, -5, 14, -13, 3, 5, -2, -5, 3, -10, 18, -9, 1, 20, 0, -3, 17, 14, -12, 13, -11, 0, 4, 1, 3, -15, 8, 9, -7, 9, 9, 1, 0, 3, -1, 13, 0, 4, -8, -3, -22, -17, -8, -2, -15, -6, 6, -24, -15, -18, -13, -10, -8, 1, 5, 9, 4, 7, 14, -3, 3, -17, 10, -15, -7, 0, -20, -4, -4, -12, 16, 11, 12, -2, 27, -6, 10, 31, -17, -9, -17, 1, -16, -17, -13, 16, 13, 10, 10, -1, -27, -15, 4, 6, -1, 4, -12, 17, -10, 20, 26, -6, 29, 7, 14, 5, 1, -3, 3, 7, -15, 10, 1, -10, 3, 0, -7, 0, -27, -21, -6, -10, -28, -15, -10, 12, -16, 20, 20, 14, 3, -5, 3, 10, 4, 5, -10, -32, -22, -1, 4, -15, -1, -11, -19, -8, -35, -10, -24, -13, -15, -23, -4, -10, 14, 1, 14, -7, -4, -1, -18, -19, 9, 15, -7, -21, -15, 4, -5, 13, 12, 11, -6, -16, -10, -1, 4, -9, 3, -9, -4, -25, -2, 2, -16, 10, 13, -14, -7, -27, -10, -11, -13, 2, -10, -21, -11, 11, -14, -4, 3, -27, 2, -14, -2, 7, -14, 10, -9, -22, 4, 2, -22, -4, -22, -18, -13, -4, -12, -41, -20, -18, -33, -17, 4, -2, 1, -13, -28, -16, -18, -7, 0, -1, 22, -9, -11, 9, -12, -4, -26, -8, -20, 11, -17, -11, -13, -19, 10, -37, -21, 2, -9, 12, 5, -10, -22, -20, 12, -6, 13, 24, -1, 11, 12, -6, -29, -8, -25, 5, -3, 3, 3, 1, -10, 7, 8, -4, -23, -14, 7, 1, 12, 5, -23, -19, 8, 5, -1, 17, 6, 17, -8, 0, -7, -30, -6, -5, 8, 10, 24, 4, 18, -2, 31, 45, 5, -10, -18, -1, -12, 6, -16, -10, -4, 11, 6, 26, 26, 29, 29, 13, 11, -2, 33, 2, 2, 6, -4, 17, -2, 20, 27, 14, 11, -20, 5, 13, 4, 5, -17, 2, 24, 12, 15, 10, 31, 18, 19, 37, 18, 2, 0, 20, 19, 11, 8, -9, 5, -7, 4, -17, -16, -10, -14, 13, -15, 1, 12, -17, -11, 0, 26, 22, 2, 28, 42, 37, 23, 24, 10, 28, 11, 7, -12, -8, -11, -24, -14, 3, 12, -12, 8, 0, 5, -20, 0, -18, 10, -10, 14, 24, 31, 33, 41, 17, 16, 9, 24, 17, 2, -7, -32, -28, -26, 0, -5, -26, -12, -15, -7, -13, 12, -16, -24, -36, -20, -12, 11, -4, 26, 19, 31, 26, 20, 14, 19, 15, 4, -3, -7, 1, 0, -17, -22, -6, 0, 6, -17, 10, 12, 8, -26, -28, -29, -20, -2, 10, 25, 25, 25, 19, 31, 9, 5, -15, -8, -23, -15, 3, -26, -41, -29, -10, 9, -11, 4, 3, 1, 2, -24, -16, -38, -19, -5, 12, 29, 25, 21, 25, 9, -16, -2, -4, 1, -18, 5, -14, -2, -8, -9, -8, -18, -14, -14, -6, -17, -9, -26, -23, -25, -9, -20, -22, 0, 22, 25, 18, -6, 0, 10, -18, -15, 7, 2, 10, 6, -10, -21, -10, 6, -8, 5, 13, -5, -13, -6, -31, -4, -4, -22, 6, 10, 8, 16, 12, 3, -9, 14, -8, 12, -16, 8, -4, 9, 5, 10, 9, -19, 11, -8, 8, -13, 6, -2, 1, -20, -17, 8, 6, 8, -2, 18, 0, -5, 14, -20, -5, -5, 1, -4, -20, 15, 11, 5, 5, -15, 13, 5, 13, -13, 4, -20, -31, -28, -10, -5, -8, -2, -6, 5, -10, -13, 8, -1, -8, 17, 14, 3, 28, 23, 32, 19, 7, -20, -16, -9, -7, 4, 1, 0, -19, -30, -20, -30, -18, -12, -11, -32, -33, -35, -18, -13, 2, -14, 4, 9, 17, 11, 19, -1, -15, -8, 11, 2, 0, 10, 4, -13, -17, -30, -2, -27, -22, -10, -22, -8, -22, -22, -2, -1, -34, -20, -17, -3, 15, 0, -9, -6, 11, -3, 12, -10, -15, 14, 15, -12, 2, 8, 18, 14, -12, -18, -8, -27, 0, -12, -8, -7, -7, 4, -22, -13, -12, -2, -1, 4, -7, 12, -12, -7, -16, 13, -17, 16, -9, 11, -11, -1, -15, 2, -1, -17, -2, 1, -12, 1, -15, 9, 5, -1, 0, 10, 5, 2, 8, 14, -11, 3, 4, -4, 21, -2, 2, -11, -5, 9, 19, -6, 9, 9, -8, -6, 17, 21, -4, -4, -11, -2, -9, 18, 6, 11, 18, 13, -10, 7, -5, 21, -9, 19, 15, 12, 20, 16, -4, 16, -1, 7, -7, 19, 3, 7, -4, 14, -2, 22, -11, -7, 5, -9, 18, -6, 3, 9, -10, -7, 22, -1, -4, -6, 9, -5, -6, 3, 17, 5, 13, 29, 12, 19, 17, 27, 4, 17, 7, 5, 20, -5, -7, 13, 9, -2, -5, -7, 18, -2, 11, 21, -8, 19, 14, 8, 11, 17, -14, -2, -9, 10, -2, -9, 3, -11, 2, 9, -6, 14, 2, -7, 1, 19, -9, -2, -2, -1, -6, 13, 9, 6, 6, -1, 15, -13, 5, -1, -1, -20, -11, 14, -18, -4, 5, -13, -8, -12, -23, 2, 10, 8, 15, 11, -6, -6, -2, 16, 13, -1, -2, -15, -24, -21, -12, -19, 14, 11, -13, 5, 2, -1, 3, 3, 19, 14, -16, -21, -10, 13, -9, -11, -3, -10, 9, 8, -16, -14, -49, -37, -46, -10, -43, -3, -12, -17, -10, -21, -7, -4, -19, -11, 9, -8, -12, 3, -7, -5, 21, 18, -11, 1, 9, -1, -27, -24, -43, -30, -32, 3, -10, -28, -4, -4, -10, -17, -18, -21, -19, 0, -3, -1, -1, -24, -10, -6, -10, 15, -10, -3, 7, -19, -14, -1, -18, -16, -22, -8, -27, 4, 11, -10, -24, 1, -6, -7, -7, -14, -23, -35, -19, -5, -15, -13, -11, -7, -11, -2, -13, -4, -12, -23, -30, -39, -35, -7, -17, -9, 17, 22, -9, -12, -21, -2, -8, -23, -45, -27, -32, -31, -8, 4, 1, -6, -14, 10, -7, 5, -18, -22, -31, -38, -9, -17, -8, 9, 32, 19, 7, 6, -9, -11, -16, -7, -31, -45, -31, -38, -9, 7, 8, 15, -18, 2, -33, -1, -11, -25, -17, -47, -20, -39, 15, 1, 4, 13, -6, -4, -24, -21, -10, -4, -30, -11, -30, -28, -11, 18, 12, 2, -11, -6, -30, -19, -5, -25, -16, -21, 10, 14, 36, 29, 13, -15, 3, -20, -3, -27, -9, -5, 22, 6, -1, -23, -3, 3, -10, 1, 6, 2, -4, -26, -15, -1, -17, 40, 34, 18, 53, 11, 3, -13, -5, 0, -9, -18, -30, -6, 6, 13, 13, 8, 4, -7, -11, 16, -6, 17, -2, 10, -2, 3, 33, 41, 17, 29, 27, 19, 9, -6, -6, -21, -17, -23, 1, -18, 14, 28, 19, 27, 19, 5, 11, 0, -1, 19, -13, -2, 9, 12, 26, 39, 37, 45, 20, 19, 2, 7, -11, -21, -2, 4, -17, -4, -1, 6, 39, 16, 15, 1, 22, 12, 0, 1, -14, -6, 10, 3, 4, 19, 40, 35, 20, 25, 29, 7, -8, -3, 0, -4, 18, 26, 5, 2, 36, 36, 22, 8, 10, 10, -6, -8, -8, -14, 9, -8, 21, 13, 45, 28, 27, 17, 30, 5, 13, 12, 23, 2, 21, 33, 10, 16, 25, 12, 7, 4, 0, -4, -1, 12, 19, -20, -30, -10, 11, 12, 32, 29, 31, 33, 17, 23, 26, 24, 34, -3, -6, 16, 8, 24, 26, 26, 11, 12, 8, -2, -10, -5, 26, 6, -32, -11, 18, 19, 11, 32, 17, 17, 15, 36, 31, -2, 27, 23, -1, -6, 15, 24, 26, 17, -9, 20, -10, -1, -10, -4, 3, -11, 0, 2, -16, 18, 19, 6, 29, -6, 17, 14, 15, -6, 31, 19, 15, -3, 7, -6, -5, 19, 5, 18, -7, -8, 11, -5, 6, 6, -6, -6, -10, -5, -6, -10, 2, -21, 8, -21, -25, -2, 11, 21, -10, 7, -12, -4, 2, -9, -10, 8, 18, -11, -9, 13, -13, 3, -18, -22, -37, -9, -40, -28, -32, -23, -25, -29, -26, -9, 3, 4, -1, 5, -19, -25, -9, -6, -7, 17, 21, -9, -7, 14, 8, 14, 2, -25, -19, -6, -27, -30, -23, -6, -24, -29, -12, -16, 21, -6, 10, 10, -8, 7, 5, 7, -1, -3, 0, -12, 5, 15, 11, -21, -15, -24, -25, -23, -7, -38, -11, -27, -10, -28, -13, -26, -9, -5, -18, -11, -16, 4, 9, 4, 11, 7, 3, 17, 7, 3, -3, 12, -26, -3, -18, -35, -41, -9, -28, -24, -21, -13, -13, -15, -34, -40, -11, 5, -16, 14, -9, 17, 12, 22, -8, 6, 1, -1, 10, 8, 15, 1, 6, -10, -18, -6, -23, -14, -6, -25, -8, -7, 2, -15, -17, -10, -1, 16, 2, 10, 0, 0, 9, 4, 7, -6, 17, 13, 1, -13, -5, 12, -4, -1, 19, -6, 7, 4, -13, 9, 13, 8, 6, -12, 15, 12, -1, 17, 12, 16, -12, 9, -5, -14, -1, 14, 12, -8, -3, 8, 4, 14, 16, -4, -8, -17, -10, -15, 10, 13, -9, 7, -14, 12, -17, -17, -2, 5, 9, 3, 4, -15, -17, -10, 12, -1, -12, -2, 4, 18, 7, -4, 8, -12, -15, 4, 13, -3, 7, -11, -10, -10, 4, 3, -15, 7, 7, -7, 10, -6, -6, 3, -8, 20, 1, 20, 23, 24, 18, -4, 9, 24, 18, 19, -2, -7, 9, -3, 3, 10, -5, -4, -11, 11, 7, -5, -15, -18, 12, -16, -10, 2, -5, 13, 24, 4, 31, 14, 21, -10, 3, -16, 17, 5, 1, 17, 5, -10, 15, 15, 10, -5, -16, 11, 3, -3, 8, 0, -15, 11, 15, 37, 6, 1, -2, -16, 1, 6, 0, 16, 8, 9, 17, -9, -12, -19, 9, 2, 11, 13, 13, 2, 3, 12, -10, -17, -6, 8, 22, 29, 21, -8, 3, 4, -2, -19, 3, 6, -20, 4, 4, 2, -17, 5, -18, 9, 12, 4, 2, 10, 11, 8, 13, 16, 29, 17, 31, 2, -3, 3, 4, 9, 0, 1, 14, -5, -10, 0, -22, 12, -3, -14, -3, -5, 2, -3, 15, 16, -13, -7, 1, 8, 15, 30, 21, 16, 15, 21, -5, 7, -7, -7, -7, -4, -7, 12, -20, 0, -10, 11, -3, 15, 5, -12, 15, 0, 15, 15, 30, 30, 17, 22, 4, 4, 30, 13, -2, 8, 9, 11, 16, -9, -10, 0, 6, -3, 8, 12, 8, -9, 2, 15, -6, 4, -3, 6, 27, 26, 5, 5, 9, 2, -6, 8, -1, 22, 20, 4, -12, -12, -13, 6, -3, 9, 9, 16, -4, -8, 19, -3, -8, 15, 12, 5, 27, 12, 27, 8, 47, 14, 26, 1, -8, 10, -6, -3, -10, -2, -14, 18, 6, -18, 4, 22, 23, -16, -4, 16, 8, -11, 12, -21, 17, -1, 2, 53, 30, -1, 9, -7, -46, -39, -34, -23, 3, 5, -19, 1, -11, 10, 10, 12, 8, 9, 17, 3, -9, -8, 12, -4, -12, -13, -7, 3, -13, -4, -39, -50, -52, -49, -21, -9, -24, -21, 1, -19, -13, -14, -20, -2, 17, 31, -15, 1, -6, -14, -12, 7, -26, -37, -41, -38, -31, -15, -43, -28, -40, -19, -24, -2, -19, -12, -20, -30, -15, -19, -5, 8, 30, 22, -2, -7, 14, 14, 9, -3, -24, -47, -37, -40, -58, -53, -33, -31, -20, -10, -7, -10, -10, -30, -3, -23, -20, 4, 24, 3, 14, 27, 6, -7, 9, -14, -4, 7, -35, -20, -49, -32, -50, -48, -41, -28, 24, 29, 33, -2, -7, -20, -15, -1, -5, -11, -4, 24, 6, 18, -6, 8, -16, -10, 0, -8, -23, -36, -35, -57, -58, -42, 0, 16, 26, 30, 23, 18, -3, 6, -2, -2, 4, -2, -25, -6, 24, 9, -4, -5, -9, 10, 9, -4, -18, -31, -39, -33, -39, -11, 10, 28, 34, 45, 9, -2, 17, 3, 21, -4, -15, -11, -4, -15, 3, 27, 23, 10, -11, -12, 12, -15, -25, -30, -37, -21, -13, 19, 14, 20, 36, 41, 4, 9, 15, 13, 8, -5, -22, -10, -17, -9, -8, 14, -6, -16, 2, 16, -19, -24, -23, -28, -18, 4, 8, 20, 29, 39, 20, 13, 36, 13, 25, 3, 12, -13, -6, -15, -8, -17, 0, -9, -4, -12, -18, -15, -2, -7, -23, -33, -9, -5, 6, 19, 25, 33, 29, 32, 25, 35, 11, 1, -2, -6, -15, -5, -11, -6, -5, -2, 7, 7, -5, 14, 12, -13, -22, -17, -21, -2, 0, 26, 22, 12, 8, 27, 14, 22, 3, 17, 24, 9, 4, 4, 9, 10, 9, 4, -14, 1, 7, -17, -6, -11, -5, -16, -13, 22, 3, -8, 8, 9, 23, 19, 19, 5, -6, -10, 2, 14, -14, 20, -12, -12, 1, -14, -7, -5, -4, 12, -7, 8, -5, 5, -15, -11, -9, 1, -7, 10, 12, 2, -2, 12, 24, 5, 10, 11, 23, 19, 3, -6, -14, -13, 1, 5, -16, -9, -18, -17, -10, -14, -30, 0, -9, 16, -13, -12, 19, 9, 35, 30, 28, 4, 20, 3, 1, 11, -23, 3, -11, 7, 4, 5, 3, 16, 3, -2, -20, -11, -7, 3, -6, 7, -14, 16, 15, -10, -5, 27, 7, -10, 9, -11, 2, 1, 1, -8, -15, 8, -16, -4, 1, 14, -10, 3, -10, -21, 3, 1, -6, -10, -19, -13, 4, 3, 7, 9, -3, -16, 5, -9, -4, -22, 6, 5, 15, -3, 13, 5, -16, -5, -9, -2, 9, -14, -7, 6, 0, -14, -5, -10, -10, 4, 12, 10, 20, 18, 5, 14, 7, 14, -19, 0, 11, -18, 9, 13, -4, -5, 6, -9, 11, -9, 18, 11, -11, 14, 16, 13, 14, 11, 13, -9, -7, -10, 7, 7, 3, 0, 1, 13, -5, 18, -3, 6, -9, 21, -10, 14, 4, -9, 19, 1, 18, 13, -7, -8, -3, -9, 0, 8, -8, 0, 4, -11, -10, 15, -3, 1, -8, 20, 2, -5, 3, 6, 8, 23, -5, 15, -7, 14, 2, 6, 15, 16, 15, 12, 6, 14, 3, -10, 16, 18, -14, 6, 0, 0, 15, -1, 17, 15, 19, 2, 12, -6, 11, -8, 9, -2, -5, 5, -23, -18, -20, -17, -3, -19, -1, -15, -37, -10, 0, -22, -4, 18, 17, 7, 2, 18, 14, 18, 8, -8, 22, 21, 0, 16, 6, -10, -16, -12, -9, 1, 8, -5, -11, -27, -26, 3, -30, -20, -20, -23, -22, -1, -11, 22, 13, -1, 15, 3, 18, 8, 24, 9, -1, -5, 6, -23, -4, 11, 10, 17, -8, -24, -13, -35, -37, -33, -13, -10, -20, -14, 20, 3, -3, -11, 13, -1, -3, 7, 13, 14, -16, 9, 14, 23, 4, 8, 18, 0, 5, 18, -12, -38, -42, -19, -36, -39, -29, 6, 15, 12, -4, -4, 10, 26, 22, -18, 14, -7, 5, 27, 7, 20, 10, -4, 3, -10, -2, 13, 7, -28, -36, -62, -55, -26, -40, -26, 15, 16, 3, -2, 24, 13, 7, -9, -2, 26, 2, -4, 1, 9, 4, 21, 40, 33, 24, 27, 6, -42, -56, -54, -57, -33, -18, -17, 0, 11, 20, -6, 6, 23, -5, 23, 13, 5, -7, -6, -4, 2, 4, 13, 32, 61, 39, 32, -20, -35, -59, -56, -45, -30, -14, -1, -10, 9, 15, 2, -1, 14, 4, 3, -19, 9, -31, -20, -9, -13, -15, 27, 21, 61, 57, 10, -43, -74, -81, -40, -16, -42, -34, -1, 3, 21, 7, 8, 21, 5, -18, -3, -5, -20, -13, -13, -12, -12, -3, 16, 24, 42, 23, 8, -35, -58, -52, -47, -27, -19, -10, -18, -10, 14, -11, 23, 0, 5, -14, -18, -23, -14, -16, -13, -14, -24, 1, 6, 32, 21, 22, -2, -49, -76, -49, -22, -6, -4, 14, 20, -6, 24, 16, 21, 17, 5, -5, -6, -9, -15, -24, -8, -28, -15, -13, 5, 40, 40, 30, -10, -33, -53, 9, 22, 2, 1, 19, 21, 24, -4, 13, -11, 6, -1, -8, 9, -35, -25, -17, -6, -5, -1, -17, 17, 13, 37, 12, 8, -32, 1, 3, 19, 29, 36, 7, 5, -4, 9, -10, 1, 8, 6, -1, -6, -16, 9, 16, -2, -4, -5, -10, 14, 46, 16, 11, -28, -32, 4, 0, 9, 30, -1, 14, 13, 4, 14, 13, 5, 21, -9, 0, 7, 7, 17, -8, 5, -13, -13, 2, 36, 41, 32, 2, -40, -20, 9, 10, 20, 9, -11, 5, -2, 24, 3, 19, 18, -5, 18, 14, 2, -11, -12, -26, -15, -28, -5, 7, 13, 47, 35, -1, -30, -10, -16, -1, 3, -3, 14, 28, 4, 11, 5, -7, 22, 18, 1, -15, -14, -39, -36, -30, -26, -38, -6, 3, 30, 37, 20, -8, -19, 0, 0, 6, -1, 26, 11, -6, 21, -1, -9, -6, -8, 11, 2, -20, -37, -25, -35, -23, -32, -43, -24, -7, 23, 14, 15, -4, -24, -11, 18, 8, 11, -3, -3, -5, 19, 14, -6, 13, 12, 12, -11, 2, -35, -28, -12, -22, -42, -37, -31, 5, 4, 36, 1, 3, 12, -4, 1, -5, 8, -9, 0, 9, 14, -4, 22, 4, 23, 18, 11, -9, 4, -11, -5, -7, -33, -24, -43, -9, 8, 12, 18, 20, 7, 12, 7, -10, 7, 8, -10, -6, 20, 2, 17, 11, -4, -11, -4, -5, 33, 16, -9, -18, -1, -16, -46, -31, 3, 29, 10, -16, 4, 20, 22, 26, 4, -13, 3, 17, 15, 1, 9, 21, 4, -4, 19, 5, 6, 8, 7, -13, -13, -23, 0, 23, 31, 3, -5, 14, 23, 6, 8, -1, 6, -24, 10, 3, 19, 23, 8, 16, -8, -11, -4, -3, -2, 25, -11, -6, -31, -16, -11, 12, 7, 10, -8, -16, -6, 0, -12, 8, 13, -17, -4, -9, -6, 16, 16, 20, 5, 19, -10, 15, -10, 19, 13, -12, -14, -42, -32, -18, 5, -1, -36, -30, -14, -15, -28, 8, -20, 8, 4, 19, -7, 21, -4, 14, 5, 16, 21, 9, 0, 2, 7, 15, -8, -10, 10, -7, -24, 3, -13, -21, -6, 17, 0, 8, 12, 18, 3, -11, 4, 6, -5, 21, -2, -4, 17, 10, 20, 22, 6, 17, -11, 7, 21, 8, -3, 16, 6, 18, 19, 2, -3, 15, 18, 9, 2, 22, -1, 7, 1, -16, -14, -4, -15, -4, -8, 4, -3, -10, 8, 0, 15, 7, -3, -11, 9, -1, 10, -2, -9, -6, -11, 13, -19, 7, 9, -4, 8, -1, 0, -11, -4, -11, 9, 0, -6, -7, 12, 5, -11, -15, 6, -7, -7, -13, -8, -9, -10, -7, -1, -18, 5, 4, -20, -14, -20, -2, 5, -1, -3, -4, 14, 0, -12, -17, 6, -7, 13, 3, 4, -11, 16, 2, -10, 11, 22, 10, 5, 3, -1, -5, 10, 10, -8, 3, -3, -1, -14, -18, -1, 8, 12, 0, -5, -2, -7, -19, -16, -20, -23, 0, -14, 9, -21, -16, 11, 2, 17, 13, -11, 12, -20, -11, -19, -8, 9, -4, -1, -11, 5, -11, -13, -20, -14, -10, 22, -2, -9, -4, -29, -25, 4, 2, 22, 28, -4, 9, -6, -1, 6, -12, -2, -17, 12, 3, 22, 12, 1, 15, 13, -3, 2, 25, 11, 18, 26, 3, -11, -23, 9, 2, 2, -8, -1, 3, 12, 2, 5, 6, -6, -18, 0, 8, 14, -13, -5, 2, 27, -11, 13, 4, 12, -2, 13, -4, 3, -11, -10, -2, 15, -9, 21, 15, 3, -13, 7, 11, -17, -15, 12, 3, 1, -18, -12, -6, 15, -7, -2, -2, 6, 13, -12, -13, 0, -11, -5, 10, 20, 1, -3, -6, 8, -12, -14, 2, 8, 0, 11, -3, 3, -8, 4, -3, 20, -30, -10, 3, 0, -23, -17, -16, 3, 3, 7, -10, 8, -13, -20, 0, -18, -12, -9, -1, -19, 10, 7, 11, -17, 12, 21, 23, -4, -29, -12, 0, 9, -19, 1, -23, -15, 0, 26, 12, 15, -15, -34, -27, -13, 0, 4, 4, 9, -14, -2, 18, -15, -10, -6, -14, -16, 5, 7, 1, -13, 3, -6, 3, 5, 6, 19, 14, -16, -20, -23, -43, -23, -16, -3, 13, -4, -20, -14, 0, -3, -20, 10, 18, 30, 26, 26, 32, 11, -6, 32, 31, 20, 30, -1, 7, -9, 14, 0, -26, -23, -8, -6, 2, -19, -7, 3, -3, 6, 11, 11, 32, 26, 15, 39, 23, 5, -3, 53, 58, 31, 1, 2, -1, -4, 22, 18, 11, -2, -23, 6, -8, 4, -14, 9, -1, 0, 18, -10, 15, 10, 34, -2, -16, -7, 5, 33, 51, 35, 1, 21, -1, 27, 34, 26, -30, -7, 1, -5, 1, 0, -18, -9, 11, 13, 11, 4, 8, 16, -4, 14, 6, 6, 26, 22, 45, 38, 28, 16, 21, -2, -4, -22, -23, -25, -20, -4, 6, -3, -15, -9, -19, -4, 1, -1, 23, 14, 6, 20, 0, 12, 31, 10, 33, 11, 21, 17, 19, 6, 19, -14, -29, -12, -15, 4, 5, -19, -12, 0, -10, -24, 15, 23, 27, -2, -12, 20, 6, 9, 33, 22, 21, 22, 2, 2, 15, -25, -3, -11, -36, -17, -7, 4, -12, -18, -2, -29, -17, -17, -21, 27, 13, 18, -1, 14, 23, 22, 13, 1, -11, 3, -1, 4, 3, -9, -18, -34, -17, -11, 0, -2, 1, -10, -8, -20, -26, -22, 7, -2, 6, 9, -14, -8, 24, 42, 16, -12, -16, 17, 19, 9, 2, 8, -38, -30, -19, -4, -19, 5, -13, -16, 1, -16, -25, -3, -2, -10, -17, -11, -20, -1, -8, 0, -1, 3, -10, -7, -7, 20, -15, -26, -26, -30, -19, -23, -6, -19, 10, 14, -12, -31, -47, -18, 1, 2, 5, 0, -8, -18, -10, -10, -5, -9, -7, 8, 14, 2, 12, -16, -12, -33, -41, -4, 3, 15, 4, -16, -17, -23, -29, -38, 1, -15, 21, 21, 20, 5, -5, 14, 4, -2, 15, 3, 17, 8, 12, 3, -27, -44, -18, -26, -6, 8, 6, 0, -18, -11, -18, -9, -29, 9, -16, 22, -4, -1, 15, -11, -3, 21, 16, -8, 17, 0, 3, 6, -8, -25, -26, -5, -1, 5, -14, 4, -13, -20, 8, -8, 3, 18, -5, -10, -18, 2, -2, -18, 4, 8, -3, 21, 18, 28, -5, 12, -2, -14, -13, 2, -13, -3, -9, -3, 10, 8, 16, 0, 2, 6, 11, -11, -1, -9, -24, -28, -13, -26, 8, -19, -10, 9, -7, 15, -17, -1, -2, -8, -6, 10, 12, -7, -7, -16, 0, 11, 9, 2, 0, 27, 30, 11, -4, 10, 12, -18, -16, -1, 10, -20, 1, 10, -8, -8, -6, -19, -6, -20, 9, 9, 2, 5, 0, 0, 17, 0, 12, 5, -7, -6, 3, -5, -10, -15, -16, -7, -10, -12, -5, -5, -9, -8, 14, -4, -12, -5, 12, -13, -11, -20, 8, -10, 12, 4, -15, -2, 6, -11, -17, -1, 11, 0, 12, 15, -5, 15, 7, 12, 14, -1, 0, 2, -4, -5, 0, 2, 6, 12, -3, 7, -2, -6, 5, -3, -5, 6, 11, 1, 6, 8, -6, 12, 11, 22, -1, -11, 2, -4, -3, 7, 4, 10, 17, -1, 3, -2, 16, 9, 7, -1, 12, 5, 15, 4, 21, 6, 0, 8, -12, -7, 19, 16, 6, 14, 2, 4, -10, 22, 22, 12, -1, 18, 15, 4, 14, 12, 10, 3, 21, -10, 0, 14, -8, -7, 1, 7, -5, -13, 9, 5, 0, 6, 17, 15, 20, -3, 11, -8, 6, 4, 0, -2, -3, 3, 1, 10, 17, -3, 14, 14, -6, 13, -3, -9, 7, 1, 5, -23, 0, -2, 9, 6, 19, 16, 14, -6, 9, 12, 8, -2, 9, -6, -11, 19, 9, 6, -11, -14, 16, 2, -13, -23, -3, -22, 10, -14, -9, -9, 15, 16, 16, 22, -8, -5, 14, 2, 9, 20, -11, -3, 16, 19, 12, 10, 7, -3, -9, 5, -20, -4, -19, -12, -8, -11, -11, 13, -7, 15, -1, 12, -11, 15, -3, 4, -4, 21, -6, -2, 13, 14, 10, -13, 7, 4, -14, -5, 2, 13, -4, -10, 13, 12, -2, 21, 17, -8, 15, -3, 21, -3, 8, -3, 21, 19, -1, -12, -9, 14, 9, 0, 4, -19, -11, 12, -16, 3, -16, 18, -12, -10, -7, 9, 14, -6, 14, 9, -12, -1, 18, -1, 16, 9, -10, -3, -9, 1, -3, -6, -5, 11, -11, 5, -5, 1, -11, 15, -11, 0, 12, 1, 9, 15, -6, 12, -10, -9, 3, 16, 3, 18, -7, 4, -9, -2, 6, -13, -11, -5, 8, 2, 17, 19, 13, 22, 1, -9, 7, -11, 16, -3, 2, 12, 16, -8, -7, 9, -6, 8, 14, 11, 7, 13, -3, 0, -13, 5, 8, -8, -16, -1, -3, 19, -11, 10, 10, 9, 12, 16, 18, 3, 8, 5, -6, 20, 9, -3, 18, -11, 11, -2, 3, -7, 12, 10, -2, -21, 11, -5, 15, -10, -2, -7, -10, -5, -2, -8, 18, 5, 4, 4, -1, -6, -12, -1, 20, 2, -10, -12, 8, -17, -17, 10, -10, -5, 10, 9, 5, 4, -9, 2, 9, 0, 8, -5, -7, -3, -6, 9, 1, 10, 15, 13, 20, -13, -2, -7, -19, -14, -3, 5, 4, -14, -5, -18, -8, 5, -10, 1, 8, -20, -20, -3, 7, -9, -12, 5, 5, -11, 5, 6, 10, -2, 2, -21, -16, 0, 2, -14, 2, -2, 3, 4, -3, 12, 0, -12, -7, 3, -9, 0, -14, 21, -4, 21, 5, 10, -7, 14, 20, 16, -6, -20, -14, -11, 1, -14, 0, -8, 0, -3, -22, 8, 5, -4, -22, 7, 3, 10, 13, 1, 14, 11, -1, 1, 9, -11, -4, -14, 7, 11, 0, -4, 0, -10, 5, -6, 4, -21, 4, -8, 1, 1, -2, 6, 7, -16, 5, 13, 15, 10, 5, 0, -9, 1, 20, -14, 0, 1, -2, -7, -8, 11, 9, -12, 1, 0, -17, -13, -4, -4, 4, -5, 8, 1, 18, 22, -5, -3, -3, 1, 15, -5, 8, 7, 6, 7, -7, 11, 2, -21, 11, 2, -2, 6, 0, 12, -9, 4, -6, -15, 12, 17, 6, -2, 4, 17, 15, 16, -7, -7, -11, 14, 19, 12, 8, -11, 11, 6, -12, -19, 7, 7, 7, -4, 10, -12, 8, -4, 10, 1, 13, 8, -1, -5, -9, -12, 19, 5, 0, 15, -10, 10, 3, 14, -12, -18, -7, 0, 0, -7, -11, -16, -12, -2, 14, 3, -11, -3, -3, -1, -1, 14, 11, 4, 13, 0, -9, -4, -6, 18, -3, 16, -8, 8, -9, 11, 12, 11, 5, -17, 10, 16, -9, 17, 10, 11, 23, -10, -10, 13, 2, -6, 18, 6, 18, 18, 5, -9, 20, 2, -10, 1, -10, -3, 5, 14, -5, -10, -5, 5, 9, -5, 22, 16, 8, -8, 14, 19, -12, -4, 7, -9, -5, -1, 19, -8, 8, 5, 13, -5, -10, 5, 2, 6, -6, -4, 12, 7, 21, 20, 4, -10, 22, 11, 16, 4, 19, 20, -6, 12, -9, 13, 11, 5, -6, 1, 4, -5, -9, 6, -7, 14, -6, -3, 3, -11, -9, 3, 2, 12, 10, 4, 15, -5, 22, -5, -9, 20, 21, -5, 1, 12, -5, 11, -5, -8, 4, 16, -1, 6, 7, -3, 19, -8, -12, 9, 16, -7, -6, -1, 19, -4, 9, 0, 3, -7, 11, 4, 20, 1, 7, 12, 5, 0, -5, 8, -7, 7, -8, 5, 16, 17, 5, 0, 7, -7, 13, -5, 3, -9, 6, 16, 12, 15, 21, 22, 17, -4, 13, -1, 10, -5, 20, -9, -4, -11, 15, 6, 20, -7, -8, 21, 10, -10, 0, 16, 14, 14, -1, -11, -3, 9, 7, -16, -21, -8, -22, 5, 2, -11, -13, -2, -13, -17, -11, 12, -20, -5, 8, -13, -22, 5, -4, -6, 7, -9, -21, -21, -4, -9, -11, -4, -22, 1, -13, -19, 11, 7, 11, -16, -6, 2, -7, 12, 7, -8, 11, 9, -14, -2, -9, -20, 11, -8, -16, -11, -19, 1, 1, -6, -2, -8, -19, 0, -11, -13, -18, -13, 6, 8, 5, 9, 1, -2, -21, 9, -12, -13, 10, 8, -9, -6, -1, 7, -10, 10, -4, -5, 11, -10, -3, 9, 9, 13, -1, -5, -1, 6, 5, -10, 3, -8, 13, -20, 1, -4, 10, -5, 3, -15, -10, 2, -5, 3, -2, -9, -8, -6, 22, 49, 64, 46, 41, 39, 6, 27, 18, 12, 7, 2, 4, 23, -6, 7, -18, -5, -10, -4, -8, -11, -14, 8, 0, -14, -1, 27, 68, 61, 44, 40, -11, -10, -15, -23, -14, -9, -24, -5, -15, -9, -17, -17, -10, -23, -15, 0, 6, 4, 8, -1, -17, 5, 5, 32, 31, 43, 8, -20, -29, -57, -41, -14, 9, -3, 3, 4, -1, -17, -20, 4, 9, 3, -10, -18, 0, -2, -11, -14, -7, 25, 21, 21, 51, 23, 25, -33, -50, -53, -28, -15, -8, 26, 23, 13, -4, 37, 18, 6, -7, -1, -18, -16, 4, -15, 9, -8, 29, 43, 44, 27, 48, 52, 23, -20, -71, -41, -41, 6, 18, 23, 19, -4, 4, 7, 3, 22, -4, -2, -8, 8, 7, 3, -3, 10, 40, 21, 43, 35, 64, 60, 46, -28, -60, -78, -37, -16, 13, 13, 2, -10, 33, 15, 11, 3, 7, 9, 0, 2, -20, -2, -15, -15, 16, 38, 12, 47, 60, 99, 46, -49, -86, -100, -25, 7, 0, -2, -4, -1, 5, 28, 6, 5, 43, 15, -1, -10, 8, 10, 16, 8, -8, 25, 9, 45, 85, 109, 48, -53, -94, -73, -5, 12, -3, -8, 12, -18, 6, 20, 15, 35, 26, 11, 7, -4, -21, -18, -1, -6, -6, 39, 26, 42, 64, 84, -11, -69, -105, -47, -23, -6, 25, -3, 8, -3, -7, -1, 1, 6, 16, 16, -20, -12, -17, 1, 14, -6, 13, 32, 35, 33, 42, 55, -10, -62, -79, -24, -29, -3, 3, 1, 10, -10, -23, -1, 7, 34, 20, 8, 4, -22, 3, -13, -4, -8, -6, 28, 34, 38, 33, 44, -11, -27, -36, -14, -21, -11, -18, 15, -6, -16, -35, -29, 9, 38, 20, 13, -9, -16, 2, -20, -15, -13, 6, 15, 18, 31, 17, 35, 9, 31, -21, -16, -33, -36, -17, -6, -2, -12, -14, -18, 22, 25, 16, 13, 12, 3, -2, -2, 7, -10, -25, -5, 29, 39, 29, 33, 13, 5, -34, -13, -46, -27, 10, -11, -14, 5, 19, 7, 49, 61, 23, 38, -17, -24, -14, -18, 9, -13, -9, 23, -2, 13, 21, 9, 9, -31, -53, -36, -17, -14, 18, 19, -7, -3, 22, 34, 34, 53, 39, -14, 9, -2, 5, -1, 12, -30, -2, -8, 4, 1, 17, 3, -11, -33, -25, -15, -18, -17, 6, 11, 13, -4, 45, 37, 47, 3, 23, -21, -5, 9, 6, -12, -7, -14, -3, -19, 27, -8, 32, 9, -10, -8, -35, -21, 0, -2, -3, 20, -1, -12, 19, 51, 15, 20, 23, 1, 8, -9, -1, 5, -12, -10, -8, -7, -22, 13, -9, 14, 9, -31, -23, -11, 12, 22, 7, 37, 17, 15, 35, 30, 18, 6, -36, -3, 7, 7, -7, -16, -1, 1, -10, -18, -13, -17, 0, 20, 14, -3, -17, -1, 2, 22, 39, 35, 19, 30, 46, 27, 21, -3, -9, 7, -18, 7, -16, -12, -13, -3, -5, -16, -19, -9, -15, -2, -25, -34, -36, -34, 7, 22, 43, 52, 47, 38, 40, 26, -8, -13, -9, -7, -17, -22, 6, -22, -10, 0, 0, -17, -22, -24, -13, -23, -31, -43, -43, -36, -11, 34, 48, 30, 34, 33, 20, -4, -27, -41, -38, 5, 13, -6, 7, -11, -18, 12, 10, -12, -18, -2, -13, -6, -17, -14, -23, -33, 3, 15, 25, 26, 11, 27, 14, -11, -19, -37, -22, -1, 0, -14, -17, -3, -17, 3, -17, -16, 8, 8, -14, 2, -30, -18, -14, -1, -10, 12, 25, 20, 3, -26, -15, -7, -19, -4, 0, 7, -21, 7, -18, -5, -19, -4, -20, -13, -1, -3, 6, -17, -20, -16, -8, -16, -2, -25, -25, 3, -27, -4, -28, -6, -14, -20, -7, -13, -6, -19, -20, 10, -4, 10, -16, -1, 2, 2, -18, -12, 6, -11, 12, -13, 9, -19, 4, -15, -10, -6, -12, -19, 9, -18, 2, -21, -19, -9, 0, -25, -23, -4, -26, -1, -25, 3, -24, -16, 3, -22, -20, -12, -23, 6, 0, -1, 6, 2, 2, 8, -20, -5, -23, 6, -27, -13, -3, -22, -10, -7, -23, -6, -8, -10, -18, 1, -22, -25, 3, -17, -19, -12, -11, -6, -22, -21, -12, 7, -22, -15, -10, -11, -20, -8, -15, 1, -22, -12, -6, -15, -19, -7, -24, -1, -12, -7, -18, -16, -6, -30, -33, -26, 0, -26, 3, -4, -22, -3, 0, -26, -24, -15, -14, -18, -13, -4, -23, 3, 6, -25, 11, 17, -9, 4, 5, 16, 24, -13, 10, -7, -20, -4, -25, -9, -7, -10, -10, 4, -5, -23, 6, -23, -23, 7, 7, -4, -10, -16, 18, 14, 8, 36, 36, 7, 12, 3, 19, 24, 8, -22, -22, -24, -17, -16, 7, -2, -15, -21, -22, 6, -11, -26, -23, -5, -15, -3, -11, 15, 5, 26, 10, -2, 22, 22, -6, 16, 16, 29, 9, -10, -13, -23, -18, -12, -1, -24, -21, 0, -3, -8, 0, -19, 5, -2, 5, -1, -8, 15, 2, 4, 7, 23, 10, 13, 0, 1, -11, 13, -15, -14, -12, 5, -28, 6, -10, -20, -13, -20, 18, 12, 0, -11, 3, 20, 4, 1, 14, 11, -11, 29, 24, 16, 23, 12, -8, 1, 1, -8, 4, -5, 1, -21, -18, -6, -5, 6, -10, 5, 11, 18, -5, 21, 15, 9, 7, -1, 9, 4, -4, 25, 5, 8, 8, 16, -4, -14, -17, -5, -16, -17, -20, -11, -9, -19, -1, -11, 4, 8, 9, 5, 3, -10, -6, 6, -3, 4, 5, 30, 26, 5, 11, 20, 23, 0, 0, -1, -7, -21, -12, -3, -6, -4, 6, -4, 3, 8, 4, 2, -6, -14, 10, -25, -20, 3, 1, 14, 4, 9, 26, -6, 8, 5, 12, -16, 2, -15, -14, -27, -23, -7, -25, 3, -2, 20, 14, 20, -2, 8, 12, 10, -19, -12, -9, 1, 16, 17, 0, 15, 4, 10, 4, -20, -13, -5, -21, -11, -30, -15, 2, 9, -9, 0, -24, 8, 11, 17, 9, 0, -11, -16, 4, 3, -10, 5, -6, -7, 19, 14, 44, -13, -22, 1, 1, -12, -12, -17, 1, 12, 9, -4, -17, 21, 25, 17, 25, 14, -8, 13, 8, -7, 27, 27, 9, 20, -3, 33, 15, 13, -9, -4, -10, 5, -12, -6, -30, 5, -11, 12, -7, -6, 27, 31, 22, 29, 3, 4, 7, 3, 22, 2, -15, 18, -7, 21, 14, -7, -4, -13, -4, 1, -14, -27, -26, -9, -1, -6, 27, 5, 11, 12, 33, 11, 18, 12, 12, 10, 4, 20, -7, 4, 10, -2, 17, 7, 2, -23, -9, -6, -15, -18, 12, 12, 13, 2, 6, 20, 6, 24, 23, 13, -10, 0, 4, 18, -4, -6, -12, -4, 11, 8, 7, -7, -3, 1, -8, -8, 0, -11, -13, -4, -6, 11, 1, 9, 35, 24, 37, 4, -1, -22, 10, 23, -2, -5, -1, 8, 7, 12, 6, -16, -5, -9, -22, -6, -11, 9, 2, -8, 0, 3, 13, 24, 21, 42, 32, 4, -21, -28, -2, -12, 10, -6, 11, -5, 15, 27, -19, -3, -5, -8, -25, -25, -19, -21, 1, 18, 3, 13, 24, 0, 40, 13, 30, 9, -3, -5, 2, -2, -3, -13, -16, 17, 24, 1, -8, 0, -10, -27, -18, -12, -16, -17, 0, 5, 15, 1, 16, 22, 12, 19, 13, -5, -12, -13, -15, -18, -15, -19, 15, 16, -9, 7, -20, -11, -26, 6, -2, -1, -23, 0, -2, -1, 17, 13, 7, 27, 24, 24, 16, 19, 16, 17, 16, -12, -5, -4, -4, -16, 23, 7, -17, -22, -16, -2, -23, 2, -10, -1, -17, -31, -10, 10, -3, -6, 6, 13, 27, 4, 21, 5, 19, 17, -2, -13, -6, 8, 3, -7, -21, -18, 1, -14, -16, -9, -13, 9, 4, -22, -4, 17, -3, 15, 21, 11, -1, 7, 4, 6, 14, 10, 9, 21, 15, -6, -9, 12, -24, -7, -25, -1, -19, -14, 5, 0, -13, -7, -2, 8, -3, -1, -4, 12, 17, 27, 5, 5, 35, -13, 3, 1, 9, 0, 8, -4, 3, -22, -27, -10, -9, 7, -22, -8, -25, -22, -22, -3, -31, 4, 21, 5, -3, -11, 18, 13, -9, -20, -18, 2, -13, -3, -2, -18, -28, -2, -21, -18, -24, -25, -19, -11, 1, -16, 5, 3, 4, -35, -8, -7, -21, -9, -32, -10, -30, -26, -10, -5, -13, -24, -10, -15, -18, 2, -10, -18, -16, -23, -23, 1, -15, -10, -15, 4, -3, -2, -11, 7, -16, -3, -22, 3, 0, -17, -26, -10, -3, -25, -26, -15, -17, -10, -21, -23, -2, 16, 4, 1, 9, -9, -3, -11, 14, 14, -5, -1, 16, 13, 1, -6, -9, -1, 13, 9, -1, -1, 16, 8, -8, 10, 8, -12, -5, 4, 10, 6, -11, -7, -9, 9, -6, -5, -2, -15, 0, -14, -2, -11, -2, -13, 5, -12, 2, -8, 5, -15, -7, -15, 3, 0, 17, -14, -15, 1, -13, 5, 1, 8, 6, 4, -20, 8, -6, -4, 5, -9, 0, 12, -12, -5, 1, -11, 10, 3, 1, 7, -9, -6, -4, 9, 7, 11, -16, 11, -15, 11, -1, 9, 1, -5, 4, 6, 8, -6, 9, -2, -13, -21, -25, -13, -14, -10, 10, 12, -2, -6, -3, -15, 11, 14, 11, 15, -10, -7, -7, 0, 8, -2, 25, 1, 22, 11, 1, 4, 22, -1, -1, -2, -21, -18, 10, -6, -11, 5, -8, -9, -15, -1, -1, -17, 8, 17, -4, -17, -11, 0, -10, 12, 9, -5, 27, -5, 19, 19, 11, -9, 0, -28, 4, 1, -3, 18, -10, 12, 4, 8, 6, -5, 13, 1, -12, -7, 17, 2, -8, -5, 9, -1, -2, 12, -14, -3, -6, 21, 13, -14, -10, 12, -6, 15, -3, 2, 11, 10, 15, 25, 21, -7, 12, 19, 13, 24, -2, -3, -14, -28, -36, 1, 21, -2, 26, 7, 9, 4, 6, 9, 1, -12, 0, -14, 2, 0, -7, 19, 16, 6, 17, 21, 7, 16, 22, 7, -27, -8, -10, -2, 29, 9, 7, 8, 7, 7, -11, -9, -12, -8, -4, 2, -5, 14, 20, 7, 16, 9, 20, 12, 6, 20, 13, -9, -21, -29, -1, 11, 10, 31, 5, 8, -2, -14, -6, -14, 20, 13, 17, 17, -8, 5, 9, 5, 3, 24, 7, -12, -8, -11, -2, -28, -19, 0, 29, 28, 20, 22, 2, -11, -23, -29, -13, -22, 12, 19, 0, 17, 16, -4, -11, 11, -25, 7, 3, -10, -2, -5, -18, -21, 0, 22, 9, 2, -6, -6, 6, -1, -16, -19, -7, -2, 11, 14, 2, -2, 6, -8, -3, -19, -30, -42, -20, -42, -22, -29, 0, -8, -20, 18, 19, 12, 5, -10, 6, 8, 1, -1, 16, 16, 18, -8, 13, 11, 14, 6, -40, -60, -45, -51, -44, -47, -34, -3, 6, 19, -8, 18, 26, 8, -5, 7, -12, 17, -10, -1, 26, 44, 23, 14, -13, 17, 3, 6, -32, -52, -37, -47, -53, -40, -3, 7, 26, 10, 12, 12, 15, 1, -8, -14, -20, 3, -8, 12, -2, 8, 27, 11, -12, 14, -12, 12, -19, -38, -34, -48, -22, 7, -11, 21, 31, 39, 12, 9, -7, 12, 13, 5, 1, 15, 8, -13, 26, 24, 1, 0, 16, -8, 0, -7, -20, -12, 2, 3, 16, 15, 8, 25, 34, 33, 33, -4, 15, 5, -6, -12, -16, 10, 8, -13, -2, 35, 3, 8, -13, 8, -11, 4, 4, -1, 7, 31, 21, 33, 29, 33, 42, 29, -4, 8, -5, -23, -21, -26, 0, -4, -5, 5, 28, 21, 14, -14, 4, 4, 7, -6, -7, 30, 7, 35, 17, 28, 18, 27, 37, -5, 1, -2, -3, -13, -25, -1, -29, -14, 6, 12, 19, 20, 5, 15, -3, 7, 15, 9, 8, 21, 0, 15, 22, 34, 10, 0, 2, -18, -26, 1, -7, -7, -28, 0, -25, -25, 16, 16, 13, 5, 15, 19, 13, 8, -3, 8, 16, -6, 23, 7, 30, 5, 14, 12, 6, -32, -19, -18, -26, -7, -18, 0, -1, -18, -3, 10, 24, 11, -11, 5, -11, 11, 4, 10, 31, 7, 26, 9, -3, 4, 6, -2, -7, -16, -26, -7, -6, -9, -14, -8, -9, -14, 2, 30, -9, 1, 5, -3, 7, -4, -8, 17, 6, 7, 29, 36, 8, 16, 23, 25, 10, -11, -15, -29, -24, -33, -18, 8, -21, 17, 19, -4, -7, 5, 17, 1, -9, 18, -2, 11, -6, -8, 30, 23, 3, 27, 20, 15, 0, 19, -8, -16, -14, -17, -3, 12, 3, 11, 5, 9, -19, -3, 10, -7, -9, -12, -12, -10, 1, -24, -9, -5, 4, -2, -7, 23, 13, 19, 18, 12, -12, -25, -21, -13, -22, -22, -1, -2, -14, -3, -15, 5, -4, -5, 5, -10, 15, 1, 4, -20, -27, -24, 11, 15, -5, -4, 4, 15, -8, -23, -25, -38, -31, -32, -5, -1, -12, 17, 6, 4, 18, 17, -1, 9, -12, -15, -10, -1, -14, -17, -13, -9, -11, -22, -33, -7, -8, -24, -24, -14, -15, -8, -4, 1, -6, -2, -16, 16, 9, -11, 3, -9, 18, -5, 9, 15, 14, -5, 3, 3, 12, 12, 4, -7, 17, 18, -1, -4, -2, -6, -14, 11, -14, 3, 7, -3, 9, -18, -10, -11, 9, 6, -18, 11, -4, -6, 12, -6, -10, -14, -7, 0, -9, -6, -14, 8, 7, -2, 8, -8, -20, -11, -20, -6, -8, -13, 6, 3, -3, -22, 7, 8, 12, -8, 10, 11, 14, -20, -13, -8, -15, -6, -19, 8, 7, -17, -5, 6, 5, -1, -16, 9, -18, -17, -3, 6, -1, -20, 0, 7, -18, -7, -10, 17, 22, -5, 19, -8, -13, 14, -3, 2, -4, -11, -20, 6, 8, 0, 10, -2, 8, 9, -8, -7, 1, -11, -6, -17, 3, 8, 31, 32, 23, 19, 26, -2, 12, 17, -13, -6, 10, -10, -6, 2, 5, 5, 6, -10, -3, -12, -3, 10, -15, 9, -1, 8, 24, 16, 19, 19, 20, -5, -14, -2, -19, -9, -15, -10, -8, 0, -14, -28, -17, -8, 12, -9, -21, 5, -20, 10, -17, -20, 9, 11, 39, 20, 30, 21, -10, 15, -12, -13, 7, -7, 3, 5, -12, -10, 8, -21, -17, 5, -9, 3, -11, -14, 12, -5, -14, -7, 34, 28, 34, 24, 17, 30, -3, 8, 13, 10, 20, 8, -3, -5, -2, 25, 0, -7, 3, 1, 2, -10, -20, -17, 5, -2, -10, 3, 15, 36, 39, 46, 46, 33, 41, 43, 13, 34, 25, 33, 34, 19, 20, -2, 13, -26, -21, -27, -14, 2, 4, -20, -14, -3, 5, 5, 19, 16, 28, 29, 19, 20, 20, 21, 50, 42, 18, 27, 10, 13, 26, -13, -8, -2, -17, 0, -17, -5, -12, 9, -12, -13, 4, -12, -13, -7, 1, 13, 1, 9, 20, 2, 3, 26, 33, 9, 31, 7, -4, 12, 1, -13, -28, -17, -15, -18, -13, 11, -11, -8, -14, -29, -29, -34, -37, -42, -14, -51, -43, -14, -1, -27, 5, 1, -10, -17, 10, -19, -7, -6, -26, -24, 2, -7, -3, -2, -1, -5, -11, -55, -51, -38, -48, -35, -47, -44, -54, -37, -65, -30, -51, -7, -8, 4, -8, 9, -6, -21, -22, -10, 5, -6, 1, -20, -4, -8, -41, -43, -35, -49, -18, -16, -10, -33, -18, -45, -39, -31, -28, -21, -26, -15, -24, -34, -7, -4, -16, 2, -10, 4, -20, -20, 8, -4, -28, -49, -36, -30, -6, -22, 6, -5, -5, -25, -18, -41, -33, -37, -37, -28, -30, -1, -5, -2, 7, -5, -2, 4, 12, 2, -12, -20, -16, -41, -8, -5, 5, 9, 3, -2, 13, -10, -13, -24, -30, -33, -37, -10, -15, -2, -12, 7, 21, -4, -1, -19, -13, -10, -10, -21, -26, 4, -12, 21, 22, 7, 11, 8, 1, -22, -31, -29, -19, -1, 0, -15, -4, -16, 2, 16, 43, 15, -15, -13, 12, 2, -21, 2, -3, 5, -1, 0, 27, 31, 4, -20, 1, -19, -19, -24, -20, 1, -1, 10, -3, -12, -4, 21, 25, 5, -7, 11, 4, -6, -18, -11, -12, -3, -21, -16, -4, -7, 0, -32, -18, -35, -25, -7, -16, 15, 2, 6, -15, 0, -7, -10, 9, 1, -11, 2, -19, -21, -8, -13, 12, 1, 1, 6, 13, -16, -7, -42, -45, -23, -24, -1, 0, 2, 10, -15, -18, 15, 23, 1, 0, 14, 3, -2, 7, 6, -22, -9, -3, -16, 1, 13, 7, 10, 0, 8, -5, -4, -11, 5, 10, -10, -23, -16, -5, 15, -4, -5, 4, 10, -8, 11, -5, 12, -14, 11, 23, -17, -2, -13, 1, 9, 8, 22, 17, -1, 16, 0, 4, 5, -1, -20, -1, -8, 3, 2, -21, -17, 14, -16, 5, -6, -4, 10, -9, 1, -22, 8, 3, -8, 21, 22, 30, 21, 28, 17, 18, -1, 4, -4, -4, 0, -13, -3, -6, -15, -3, -19, 1, -4, -19, -7, -21, -7, 19, 8, 9, 13, 14, 19, 38, 20, 6, 17, 8, -10, 4, -5, -30, -26, 2, -14, -10, 10, -9, -1, 3, -14, -16, -7, -5, 13, -5, 31, 10, 0, 34, 10, 9, -6, -2, -8, -7, -4, 9, -16, -3, -18, 8, 6, -9, -17, 1, -19, 11, -4, -7, 6, -6, 27, 23, 20, -10, -1, -5, -15, 8, 8, 11, 21, -4, 25, -12, -5, -9, -19, -2, -11, 11, 3, 7, 0, -8, -18, 4, -20, 15, 8, 1, 12, 18, 22, -9, 16, 8, -6, -7, 8, 13, 5, -20, 2, -4, -8, 10, 5, -10, -2, 1, -3, -8, 6, -19, -4, 3, -24, -25, -1, -1, 13, -5, 5, -14, 17, 0, 8, 32, 2, 24, 13, -19, 12, -2, 0, 6, -9, 3, -17, -1, -15, -18, -19, -17, 3, -6, -5, -15, 1, -12, -8, -3, -18, 0, 12, -14, -17, -19, -11, -11, 5, 10, -12, -18, -21, 6, -3, -15, -14, -9, -22, 6, -8, -14, -3, 8, -14, 10, -13, -20, -11, -16, -9, -20, -1, -15, -9, -5, 10, -5, -15, 6, -5, -11, -1, 6, 12, -4, -5, -15, 7, -21, -5, 0, -16, -1, 5, -11, -5, -3, -2, -8, -18, -10, 0, -3, -7, -8, -2, -9, -9, -11, -10, -20, -14, 2, -4, -6, -6, -16, -3, -16, 9, -16, 7, -12, -24, -16, -16, 13, 1, 11, 9, 12, -22, -4, -8, -4, -7, -22, 7, -5, -8, -7, 5, -3, 7, -4, 7, 4, -19, -28, -20, -22, -20, -1, 3, -3, -4, 10, 14, 24, 9, 3, 7, -10, -9, -20, -1, 3, -1, -10, 12, -15, 6, 8, -17, -26, -34, -9, -23, -34, -30, -19, 8, -19, -2, 11, 21, -5, 20, -2, 0, -5, -10, 11, 7, -21, -17, 4, 11, -7, 9, 3, -34, -19, -20, -16, -8, -6, 3, -28, -20, -19, -35, -11, 0, -20, -11, -12, 6, -4, 4, 9, 4, -5, -20, -3, 10, -11, -23, -10, -26, -38, -27, -10, -14, -21, -19, 0, -26, -17, 10, 17, -4, 6, 12, -1, 9, -17, 9, -19, 4, -16, 9, -7, 3, -26, -40, -15, -15, -20, -38, -30, -9, -9, -6, 14, 29, 20, 30, 29, 14, 21, 16, 20, 23, 12, -2, 8, -12, -21, -21, -16, -12, -26, -22, -17, -16, -17, -26, -16, -3, 4, 22, 9, 14, 21, 26, 31, 18, 31, 16, -1, 7, 5, -5, -19, 11, 8, 4, -5, 0, -28, -9, -35, -35, -20, -2, -13, -11, 0, 18, 3, 27, 15, 15, 14, 0, 9, -2, 21, 17, 35, 7, 8, 3, -3, 9, 14, -7, -21, -7, -15, -1, 5, -4, -19, 4, 9, 34, 27, 19, 15, 6, 20, 25, 13, 10, 5, 13, 30, 7, 4, -8, 8, 10, -16, -1, 12, 1, 8, 16, -15, -3, -7, 7, 3, 28, 37, 43, -1, 1, 22, 4, 33, 7, 32, 2, 21, 10, 15, -18, -14, -12, -1, 14, 10, -8, 26, 19, 5, -2, 0, -8, -32, 2, 26, 17, -5, 16, -3, 15, -2, -11, -2, -7, -15, 14, 15, 11, -6, -10, 3, 10, 5, 2, 10, 10, 2, -19, -15, -2, -23, 8, 22, 3, -9, -22, -4, 17, 10, -11, -3, -25, -15, -20, 3, -13, -3, -15, -15, 9, 10, 19, 23, 21, -7, -4, -19, -13, -27, -5, -11, 2, -19, -28, -15, -7, 11, 3, -4, -11, -18, -23, -1, 6, -17, -12, -4, -11, -5, 36, 11, 11, -5, -10, -29, -32, -2, -18, -27, -23, -21, -12, 14, 7, 6, -17, 2, -24, -27, -31, 3, -3, -22, -11, -23, 3, -1, 17, 1, -11, -15, -13, -4, -18, -32, -40, -25, -32, -15, -10, -11, -13, -7, -42, -29, -31, -17, -19, -23, 3, -8, 9, -12, -3, -12, 10, 5, -2, -20, -4, -35, -34, -40, -25, -20, -4, -2, 4, -1, -15, -11, -24, -30, -6, -15, -18, 9, 12, -6, -10, -21, 0, 6, 26, 29, -6, 18, -6, -27, -21, -20, -8, 13, 25, -11, 0, -8, -19, -35, -29, -36, -39, -35, -4, 10, 8, -5, 3, 4, -8, 6, 3, 12, 10, 21, -2, -15, -10, -16, 4, 11, -10, -20, -3, -31, -13, -20, -14, -20, -6, 6, 3, 5, -5, 11, -15, 11, -27, -12, 5, 25, 11, 21, 5, -21, -7, 18, 12, 10, -17, -32, -37, -42, -49, -48, -16, -21, -23, -25, -8, -9, 5, -7, 0, -12, -9, -6, -1, 21, -9, -2, -15, -3, 10, 7, -2, 3, -9, -50, -33, -47, -31, -36, -20, -20, 0, -12, -12, -17, 11, -12, 12, -1, -12, -25, -15, 7, 12, -7, 20, -15, 3, -3, -12, 3, -20, -52, -43, -26, -32, -27, 4, 6, -9, -10, -24, -10, 7, -21, -9, -23, 1, -2, -4, -7, 0, -3, -18, -8, 6, -11, -4, -19, -34, -51, -53, -31, -17, -14, -10, -16, -7, -12, -11, -16, 0, 6, 7, 8, -9, -2, 23, 8, 3, 11, -11, 19, -5, 0, -6, -25, -37, -50, -38, -16, -7, -1, -20, -12, 9, -16, -24, -17, -15, 6, 6, -8, 9, 6, -8, -13, 23, 18, 40, 26, 5, 13, 1, 14, 8, -2, 6, 15, 0, 18, -3, 0, -6, 0, -20, 9, -20, -9, -3, 1, -3, -11, -13, -2, -13, 22, 23, 21, 12, 19, 38, 59, 23, 36, 11, 30, 5, -1, 19, 1, -22, -16, 11, -22, 2, -17, -19, -10, -8, -18, -21, -5, 4, 11, -14, 2, -10, -6, 13, 10, -18, -15, 4, 9, -10, -18, -8, -2, -7, 4, -12, 11, -6, -3, -10, -19, 1, -4, -4, -8, 3, 11, -15, 0, 2, 7, 9, -12, 12, 2, 0, 12, -6, -11, -2, -12, -20, -12, -13, 0, 13, 3, -16, -20, 10, 4, 1, 3, -10, -18, -9, -6, -16, 15, 10, 10, -18, 17, -11, 13, 6, -4, -16, -15, -1, -6, 1, -20, 9, -19, 8, 11, -17, 0, -20, 10, -9, -11, 15, 11, 27, 26, 16, 10, 16, -7, -10, 6, 7, -12, 17, -8, 11, -18, -8, -13, -4, -1, 8, -14, 12, -6, -3, -2, -10, 5, 21, 16, 18, 6, 9, 11, -13, 17, 6, -17, -24, -30, -9, 3, 14, 14, -5, -12, -4, 12, -4, -1, -17, 9, 11, 11, 10, 13, 23, 13, 21, -10, 8, 3, -6, 19, 24, 21, -2, -1, -13, -6, -20, -27, -13, -11, 9, -17, -14, -8, 5, 6, -8, -12, -22, 6, -23, -1, -10, -10, 5, -4, 6, 2, 27, 39, 6, 13, 5, -18, -10, -20, 3, -8, 9, 3, -21, 5, -1, 9, -21, -18, -28, -36, -48, -24, -20, -29, -5, -6, -5, -1, 2, 4, -8, -22, -9, -5, -6, -3, 0, -15, 10, 3, 2, 10, -1, 7, -4, -8, -39, -37, -45, -36, -10, -32, -3, -10, -30, -18, -7, -2, 1, -29, -19, 3, -35, -11, 2, -1, -18, -2, -9, -10, -11, -18, -12, -25, -19, -31, -32, -27, -2, 13, -10, 1, -8, 0, -3, -5, -18, -18, -9, -21, -18, -35, -32, -18, -19, -10, -18, -5, -5, -7, -31, -9, -27, -33, -30, -6, 2, 17, 13, -11, -8, 10, 15, -8, -25, -6, -4, -29, -34, -18, -43, -24, 7, 5, -7, 0, -2, -19, -1, -7, -4, -21, -25, -2, 5, 19, -21, -25, -26, -4, 12, 5, -19, 5, -14, -10, -7, -40, -17, -17, -13, 4, -16, -4, -16, -28, -4, -13, 10, 8, -14, -16, -2, -18, -30, -48, -27, -15, -31, -9, -13, -11, -9, -1, -19, -14, -24, -18, -19, -13, -5, -7, -16, -27, -6, -16, -9, 3, 1, -17, 7, -9, -9, -19, -23, -18, -36, -13, 3, 2, -2, -3, 15, 32, 0, -20, 0, 4, 8, -22, -11, -31, -9, 19, 23, 20, 12, 19, 9, -2, -16, -25, -35, -15, -20, -3, -8, -18, 10, 12, 34, 39, 2, 17, -9, -4, -2, -9, 10, 4, 20, 16, 38, 41, 16, 19, 42, 21, -12, -35, -15, -24, -6, -6, 10, -7, 13, 12, 26, 33, 30, 8, 12, -6, -15, -12, 11, -15, 3, 0, 12, 20, 14, 13, 47, 25, 32, -19, -7, 14, 5, -2, 9, 14, -7, 23, 8, 20, 27, 20, -2, -4, 9, -12, 11, 6, 13, 26, 6, 24, 27, 31, 33, 23, 11, 17, -2, 19, 34, 3, 0, -2, 35, 23, 8, 35, 53, 5, 7, -6, -7, -4, -13, -6, 17, -1, 14, 27, 12, 31, 30, 15, 3, -2, 21, 9, 26, 27, 22, -4, 17, 10, -1, 29, 40, 9, 10, 3, -7, -10, 1, 1, 2, -12, 27, 4, 31, 24, 4, 25, -16, 5, 16, 36, 11, 18, 8, 2, 6, 19, 35, 27, 30, 8, -4, 8, 9, 1, 11, -7, -15, -11, 6, -4, 26, 16, 28, 23, -14, 13, 5, 17, 15, 28, 13, 12, 36, 36, 13, 3, 1, -9, -8, 2, 5, -10, -9, 18, 23, -4, 25, 5, 24, 0, 13, 23, -8, 15, 1, 21, -3, 28, 16, 30, 33, 9, 8, 8, 16, 11, 2, 11, -14, 1, 4, 23, 1, 0, 18, 25, 17, 27, 21, 12, 16, -2, 2, -6, 1, -3, 23, -8, 16, 30, 23, 0, 2, -16, -17, -20, -7, 14, 2, 7, 1, -11, -11, 8, 28, 1, 9, 11, -9, -27, 5, -14, -12, -10, 6, -24, 12, 11, -13, -8, 5, -1, -17, -17, 7, -10, 2, -16, -16, -28, -11, 0, -17, 9, -2, 1, -9, -20, -27, -6, -15, -8, -41, -7, -17, 13, -16, -5, 1, -13, 2, 0, 2, -19, -11, -26, -29, -15, -18, -38, -31, -12, -42, -11, -42, -14, -7, -31, -19, -14, -25, -30, -21, -13, -11, -18, -14, -18, 5, -2, 13, -5, -4, 4, -22, -14, -18, -19, -49, -47, -48, -30, -25, -15, -43, -12, -29, -48, -21, -21, -34, -5, -14, 9, -9, 11, 6, -10, -1, 3, -7, -1, -4, 7, 6, -2, -6, -12, -17, -14, -5, -22, -8, -10, -24, -15, -3, -6, -11, -5, -15, -6, 9, -5, 14, -5, -17, -17, -2, 11, 2, -5, 6, -21, 3, 1, -8, 13, 9, -22, -16, -22, -16, 4, 6, 8, -16, -18, 5, 1, 9, 10, -1, 9, -17, 1, -17, -2, -2, -17, 6, 4, -5, 11, 0, -15, -2, -10, -17, 4, 5, 14, 13, -7, 3, 12, -1, 7, -12, 7, -17, 3, 14, -7, 15, -14, 13, 13, -1, -14, -12, 4, 3, 8, -4, 13, -15, 6, -8, 10, -15, -12, -11, -12, 7, -1, 14, -7, 15, -16, -15, -15, -1, -4, 16, 14, -15, 15, -17, 9, -18, -16, -9, 14, 22, 19, -12, 11, 9, 2, -19, 11, -13, 4, 2, -3, -9, 6, 14, -6, 11, -3, 3, 9, -7, -18, 1, -20, -23, -44, -28, -19, -24, -13, -27, 2, -25, -20, -13, 15, 7, -16, -7, 1, -7, -16, 9, 16, 13, -11, -7, -5, -19, 3, -25, -17, -19, -20, -37, -29, -30, -12, 15, -5, 22, 3, 8, 15, 5, -16, 10, -12, 9, -4, 6, -15, -13, -4, -10, -3, -6, -9, -3, -8, -32, -23, -12, -14, 1, -15, 7, 19, 14, 34, 6, 7, 1, -8, -11, -1, -7, -7, 10, 4, -12, -12, -25, -11, -28, -18, -31, 0, -28, -25, -28, -14, 7, 27, 7, 9, 11, 36, 24, 15, -8, -7, -16, -12, 4, -8, -11, -1, 1, -20, -37, -13, -21, -24, -29, -6, -33, 4, 3, 10, 22, 30, 7, 23, 20, 30, 34, -8, -5, -11, 5, 8, 3, 9, -9, 4, 4, -18, -19, -4, -6, -21, -21, -26, -11, 22, 7, 25, 15, -5, -25, -11, 7, -18, 17, 3, 10, 14, 5, -14, 11, 4, -14, 0, -15, -28, -14, -16, -43, -38, -34, -15, 6, 9, 14, 9, 18, -19, -23, -20, -33, -24, -23, -8, 2, 2, 10, 3, 0, -17, -5, -13, -27, -17, -23, -32, -27, -6, -17, 14, 13, 24, 23, 41, 19, 3, -17, -18, -37, -29, -4, -8, -11, 10, -13, 4, -12, 17, 10, -17, -14, 7, 12, -10, -20, 7, 21, 19, 29, 23, 8, 27, 34, 20, 3, -4, -32, 0, -20, -4, -18, 1, -7, 2, 16, 6, 5, -8, -12, 29, 8, -6, 9, 19, 23, 3, -2, -7, 3, 21, 5, 9, -11, -9, -26, 7, -5, -17, -17, -3, 15, 13, -6, 11, -9, 14, -6, -1, -19, -2, -8, 15, 2, -19, -31, -41, -12, 35, 29, 30, 16, -12, -14, -4, 5, -3, -4, -29, -15, 14, -13, -8, -15, 13, -8, -3, 0, -3, -8, 8, -4, -7, -19, -32, 27, 29, 13, 39, -2, -19, -34, 0, -9, -5, -31, -31, -11, -12, -7, 1, -17, 15, 9, -13, -16, 9, 9, 1, -23, -31, -18, 2, 35, 29, 37, 43, 6, -34, -30, -24, -14, -20, -15, -33, 0, 3, -12, -6, -18, -15, -9, -26, -8, 8, 14, 5, -20, 4, -7, 22, 29, 29, 31, 28, -29, -46, -33, -39, -41, -2, -4, -4, -11, -15, -13, -13, -7, -17, -22, 2, -22, -10, -8, 12, -20, 12, 19, -1, 19, 44, 20, -3, -55, -46, -28, -23, -2, -28, -30, 9, -12, -8, -4, 11, -13, 5, 9, -31, -17, -13, -2, -11, -5, 9, 17, 27, 6, 18, -1, -46, -29, -10, -15, -16, -2, 2, -15, 7, 18, -10, 9, 14, 2, -10, 2, -28, -27, -13, -20, -17, -13, 19, 7, 30, 21, -1, -6, -5, -15, -29, -24, -22, -20, -5, 0, 4, 1, 12, 1, 0, 15, 2, -22, -16, -35, -33, -28, -8, -21, 9, -3, 28, 21, 6, 9, -6, -15, -1, -9, -20, -18, -16, -9, 14, 13, -13, -6, -12, -13, -8, -15, 1, -7, -6, -22, -18, 14, 11, -9, -2, -2, -7, -15, 8, -5, -6, -3, 14, -4, -7, 0, 13, 18, -3, -13, -14, -11, -6, -6, 14, 14, -15, -24, 4, -11, -10, -18, -33, -16, 7, -2, -1, 8, -5, -5, -1, 22, 1, 13, 1, 4, -9, -15, 7, -8, 16, -24, 4, 7, 4, -29, -6, -22, -31, -19, -11, 5, 3, -1, 26, -4, -6, -2, 16, 6, 21, 0, 9, -4, 4, -17, -7, 5, 5, -19, -16, -2, -18, -15, -8, -35, -32, -23, -45, -47, -44, -12, 8, -6, -5, 16, 8, 8, 15, 20, -8, 4, -7, 9, 14, 15, -2, 8, -19, 11, 8, 7, -7, -30, -17, -1, -9, -23, 1, -19, -17, 2, 19, -2, 11, 6, 17, 2, -13, 4, -11, -8, -10, 12, -15, 11, -6, -5, 7, 9, 8, 32, 7, 29, 16, 21, 29, 11, 6, -3, 5, 12, 9, -2, 4, -8, 9, 16, 3, -13, 11, 4, -3, -8, -15, 15, 1, -12, 4, -12, -16, 18, -14, -14, -5, -7, 8, -7, 8, 18, -6, -5, -5, 5, 9, 9, 0, 5, 15, -16, -16, -13, -15, 16, -11, 5, 7, -18, -10, -9, 15, 13, 2, -4, -18, -16, -11, -13, -9, 4, -11, 14, 7, 15, 8, -6, 11, 3, 0, -5, -8, -12, 10, -9, 2, -10, -18, -18, -16, -15, 6, -5, 12, -10, -5, -4, -17, -9, 13, -14, 2, -11, 8, 15, -8, 1, -7, 12, 6, 12, -9, -15, 6, -11, 6, 3, -12, -4, -14, 1, 9, -11, -3, -19, 0, -20, -5, -6, -13, -9, 8, 3, -2, 13, -14, -1, 9, 17, 15, -2, 17, 11, 5, 10, -4, 3, 5, -17, -25, -16, -22, -33, -15, -23, -3, 4, -19, 2, -10, -14, -15, -14, 2, 13, -5, 10, -3, -1, 3, 6, 13, 33, 31, 21, 10, 7, -20, -10, -24, -42, -49, -20, -18, -30, -10, -5, -9, -7, -5, 0, -10, 2, -3, 9, 15, 19, 9, 31, 18, 12, 13, 30, -3, 16, 11, -6, 4, -8, -31, -29, -47, -31, -28, -14, -1, 4, 1, -3, -14, 14, -5, -13, -3, 8, 14, 24, 26, 10, 18, 25, 7, 10, 31, 12, 22, -5, -42, -27, -37, -45, -30, -20, -2, -13, 0, 12, 10, 6, 5, 4, -7, -7, 14, 9, 11, 21, 2, 25, 10, 16, 3, 33, 11, -1, -9, -21, -24, -15, -18, 3, -19, -10, 14, -3, 9, 2, -13, 9, 10, -23, -11, 0, 7, -15, 19, 20, 21, 30, 15, 27, 27, 4, 20, -21, -3, -20, -37, -21, 11, -9, -3, -19, 7, -16, 5, -5, -5, -13, -7, -26, -2, 2, 12, -4, 4, 41, 38, 17, 25, 23, 28, -2, -14, -14, -28, -10, -21, -7, -4, 0, 2, -5, 7, -18, -9, -6, 5, -14, -11, -17, -17, -4, -9, 1, 5, 15, 34, 20, 13, -10, 6, -10, -11, -1, -18, 10, 11, -3, -13, 10, -2, -17, 14, -2, -15, -5, -17, -8, -23, 5, -11, 0, 23, 25, 12, -1, 20, 25, 5, -4, -17, -2, 15, -1, -1, 7, -11, 8, 12, 10, -18, -9, -7, -6, -9, -33, -32, 13, 24, 22, -3, 17, 23, 18, 31, -7, 2, 0, -20, 7, -13, 2, 4, -2, -4, 4, 3, -17, -18, -3, 1, -3, -14, -10, 6, -5, 17, 13, -3, 28, 13, 2, 10, 17, 6, -14, -15, -3, 10, 5, -7, 5, 4, -13, 11, -15, -3, -1, -3, 16, -5, 12, -12, -10, -7, -4, -14, 13, 30, 9, 11, -10, -11, -28, -13, -15, -7, 0, -1, 14, -8, -2, 9, 22, 6, 2, 5, -7, -2, 8, 21, 13, -25, -8, -6, -4, 27, 29, 1, 0, 12, -2, -11, -15, -9, -12, -17, 13, -12, -5, 25, 12, -13, 8, 11, 21, 22, 4, 21, -21, -10, -9, 11, 28, 21, -9, 1, -16, 16, -5, -19, -9, -10, -17, 0, -1, -3, 25, 14, -14, 2, 16, 7, 2, -9, 1, -10, 7, -39, -8, -10, -4, 1, 19, 1, -23, -14, -9, -20, -14, -3, 1, -9, 11, 18, 19, 22, 7, 5, 11, 16, -6, -9, -8, -12, -28, -5, -8, 8, 5, 0, -7, 11, -16, -3, 9, -27, -18, 15, 12, 6, 14, -12, 16, 21, -2, 9, 3, -6, -3, -25, -2, -14, -33, -33, -17, -6, 1, 5, 1, 4, 2, 12, -22, -22, -3, 8, 9, -16, 5, -14, 22, 7, 17, -9, -15, 11, -8, -29, -37, -37, -27, -12, -29, 6, 9, 6, -8, 9, 18, -18, 3, 7, 14, 7, 14, 1, 16, 2, -9, -2, -11, -9, -7, -13, -25, -22, -8, -27, -12, -5, -12, -11, 7, -1, 1, -6, 7, 6, 3, 0, 12, 16, 4, -15, -7, 4, -4, -12, -18, 6, -19, 12, 0, -8, 6, 17, -1, 8, -3, 13, -16, -14, 6, -17, -30, 7, -16, 6, 13, 7, 1, 8, -15, 14, 13, -9, 5, -13, 6, 10, 0, 4, 1, 22, 7, 14, 9, 16, 14, 7, -1, 8, 7, 18, 22, 2, -12, -3, 4, 8, -10, -14, 10, 2, 1, 9, 40, 12, 5, 16, -2, 20, 18, 12, 2, 22, 1, 12, 1, 16, 9, 4, -2, -13, -6, -4, -14, -12, -1, 4, -9, -11, 22, 9, 27, 30, 16, 37, 21, 32, 35, 3, 21, 29, 11, 10, 22, 28, 19, -4, -16, -9, -1, 11, 1, 4, 6, 13, -8, 8, 10, 2, 18, 26, 2, 4, 17, 7, 13, 19, 15, 18, 33, 3, -3, 17, 5, 17, -7, 8, -13, -16, 0, 10, 3, 9, 8, -12, 16, 9, -9, 3, 14, 11, -4, -14, 10, 15, -16, 10, 4, 2, 12, 15, 8, 9, -15, -17, 13, 0, -11, -9, 7, 6, 6, 14, 13, 2, -2, -12, -16, -17, -14, -6, 13, 0, 9, -9, -2, -12, 1, -12, -4, 8, -16, -7, -10, 5, -7, 8, -6, 3, 2, -7, 16, 16, 16, 7, -12, 0, 14, 0, -3, 8, 15, 10, -9, -2, -17, -10, 5, 16, 9, 15, -16, -16, 4, -9, 16, 8, -7, 15, 9, 8, 6, -18, 5, -15, -9, -15, 3, -2, 10, -16, -2, -4, -18, -4, -7, -6, -16, 11, 11, -16, 4, -2, 4, 1, -12, -8, 13, -3, -8, -2, 2, -15, 15, -12, -17, 10, 7, 23, 23, -5, 6, 0, 0, -19, 10, 4, -13, 16, -14, -2, -13, -14, -8, 18, -6, -2, 14, -13, -9, 4, 24, -8, 2, -15, 33, 3, 14, 9, -2, 20, -2, 7, -12, 4, 11, 0, 10, 11, 5, -12, 3, 20, -7, -2, 3, 0, 14, -9, -10, -24, -20, 14, 24, 23, -4, 5, 26, -1, -13, -6, 7, 8, -12, 16, 9, 5, 14, 6, -7, 15, -2, 4, -10, -11, -14, 15, -17, -11, 7, 2, -14, -2, 13, 7, -5, -11, 3, 18, -3, -4, -6, -10, 12, -2, 6, -5, 10, 5, 12, 17, 12, 2, -4, 11, -17, -15, -8, -8, -12, 13, 11, -10, -11, 9, -2, 13, -3, -11, -14, -5, -11, -13, 6, 15, 16, 12, 1, -4, -14, -25, -19, -12, -5, 15, 19, 25, 10, 28, 18, 13, 6, 6, -21, 20, -9, -5, 9, -5, -14, 16, 9, -11, 19, 27, 13, 1, 10, 4, -16, -13, -1, -6, 26, 39, 36, 20, 13, -1, -9, -3, -8, 8, 13, 8, 14, -16, 12, -16, -13, 6, 7, 15, -12, -23, 1, -4, 7, -23, 3, -18, 12, 36, 14, 24, 17, -4, 3, 11, 14, 23, 6, -2, -5, 15, 12, 5, 15, -10, 5, 4, -1, -16, 5, -19, 12, 5, 2, 8, 25, 5, -6, -4, -6, -11, 7, -24, -6, 6, -14, 4, 16, 3, 14, -16, -14, 6, 2, 14, -13, 2, -3, -13, 16, 8, 16, 23, 10, 10, 2, -13, 11, -11, -17, -18, -8, -18, -12, -3, -3, -12, 3, -3, -1, -3, -4, -5, -4, 18, 10, 1, 18, -3, 3, -7, -25, -20, -17, -31, -12, 17, -29, -30, 3, -20, -19, 6, -9, -11, 0, -13, 3, 11, -8, 1, 9, 23, -4, 31, 6, -3, -8, -35, -16, -8, -1, -2, -6, -7, 11, 19, 16, 21, 32, 23, -15, 5, -1, 15, -8, -14, 6, -7, 30, 22, -5, 12, -8, -33, -16, 3, -35, -13, -16, -28, 3, 4, 20, 12, 15, 5, 34, 24, -19, -5, 7, -16, 13, 15, 15, 22, 15, 3, 16, -24, -38, -13, -5, -17, -12, 1, -16, -26, -16, -8, 11, 4, 15, 24, 38, 26, -11, 9, -8, -10, 14, 8, 1, 15, 18, -5, 5, -9, -33, -37, -8, -11, -21, -4, -20, -4, 22, -5, 15, -3, 5, 31, 12, 3, -20, 0, 7, 11, -8, 1, 28, 18, 26, -10, -17, -15, -34, -14, -35, -11, -5, -16, -9, 4, 9, 18, 12, 17, 13, 5, 4, -17, 10, -14, -15, -16, 7, 0, 12, 2, 0, 1, 19, 2, -13, -6, -20, -13, -4, 15, 2, 28, 6, 5, -2, -13, -7, -7, -13, 8, -8, -10, 0, -4, 0, -1, 18, 25, 15, 8, 26, 7, 19, 7, 5, 14, 27, 29, 24, 17, -6, 4, -20, 7, 8, -22, -12, 8, -7, 13, -5, -14, -7, -7, -2, 4, -5, 18, 11, 18, 11, -1, 15, 29, 10, 9, -1, 17, 10, 0, -4, -11, -15, -31, -33, -28, -18, 1, -1, 4, 2, 0, -2, 5, 3, 6, -17, 4, 7, 10, 4, 13, 9, 12, 35, 11, 19, 13, 10, -11, -30, -12, -11, -16, 11, 5, -1, -2, -10, 14, 16, 4, 16, 15, 6, -21, -5, -1, 14, 10, -1, 33, 4, -2, 9, -19, -5, -39, -14, -24, -17, -12, -15, -14, 12, -17, -17, 11, -1, 11, 26, 29, 12, 11, 4, -8, 6, 12, 38, 31, -1, 10, -6, -2, -30, -41, -36, -12, 6, 3, -10, -5, 11, -15, 15, 4, -7, 17, 2, 23, 29, 10, 30, 18, -1, 19, 2, -17, -19, -17, -19, 0, -21, -16, 0, -4, -14, -9, -7, 9, 5, 3, 16, -1, -17, -11, -7, -9, -5, -13, -18, -17, 5, -5, -17, -20, 10, -12, 9, -7, 8, -4, 6, 9, 11, 4, 15, -10, 10, -5, -6, -14, 10, 1, 15, 8, 10, 7, -17, -1, -4, -13, -9, -10, 13, 10, -7, -11, 13, 7, -15, -10, 1, -6, 10, 5, 10, -17, -10, 12, 4, -11, 12, 5, 2, -3, 13, -2, -13, -16, -16, 3, 4, -16, 1, 6, -8, -15, -3, 13, -9, 3, 6, 10, -4, 15, 14, -10, -13, -7, -1, -13, -5, -3, -5, 3, -18, 1, 0, 7, 6, 11, -8, 13, 1, 15, -18, -7, 14, 10, 6, -7, 7, 11, 8, 12, -5, 12, 12, 14, -1, 16, 8, 11, 17, 12, -2, -8, 14, 12, 4, -6, 2, -15, -10, -14, 14, -18, -8, -7, 9, -19, -3, -4, 5, 9, -18, -17, -10, 28, 33, 33, 24, 22, 13, 8, 23, 13, 6, 23, -5, 10, -2, -9, -2, -8, 5, 5, -17, -9, -13, -19, -7, -2, 7, -3, -8, -6, 22, 4, 19, 22, 2, 14, 2, -12, 19, 16, 7, 6, -9, -7, -10, -13, -18, 14, -17, -17, 11, 8, -12, 13, -1, -10, 12, -1, 15, 6, 3, 19, 24, 5, 3, 24, 23, 20, 20, 1, 11, 11, -5, -2, 6, -16, -19, -8, -5, 12, -13, 6, 15, -6, 13, 19, 23, 1, 11, 16, 36, 8, 46, 45, 27, 18, 23, 9, 6, -10, -18, 4, -5, -13, 2, 0, -7, -7, 7, 5, -14, -3, 2, 19, -4, 16, 24, 28, 47, 45, 47, 51, 26, 30, 10, 21, 7, 17, 11, 2, 18, -19, -3, -5, -2, -11, -1, -1, -15, 13, 0, 7, -4, 12, 7, 38, 27, 35, 5, 30, -10, 6, 30, 8, 34, 27, 28, -8, -3, 16, -1, 10, -15, 11, 7, -2, 17, -14, -8, 17, 13, -17, -2, -13, -34, -45, -32, -23, -14, 0, 28, 5, 5, 32, 32, 2, 15, 14, -12, 12, -5, 6, 2, 8, 7, 0, -22, 0, -24, -5, -17, -47, -59, -55, -37, -17, -13, 17, 10, 4, 1, 22, 28, 2, -1, -5, -4, -18, 2, 0, -20, -2, -12, -19, -15, 6, -2, -44, -50, -54, -74, -37, -24, -27, 2, 3, -3, 9, 20, 20, 1, 10, 4, -17, -4, -9, -14, 1, -6, -23, -8, -28, -12, -2, -3, -32, -30, -20, -21, -30, -25, 1, -1, 0, 5, 11, 22, 7, -21, -7, 13, -6, 2, -1, 9, 0, 10, -33, -26, -9, -27, -25, -9, -5, -5, -23, -3, 1, -2, -2, -15, -11, 6, 6, -6, -22, -16, 0, 11, -6, 14, 14, -6, 9, 12, -39, -38, 9, -17, -12, -14, -35, -11, -18, 23, 25, 11, 15, -6, -22, -26, -25, -19, 0, -26, -12, -18, 7, -10, -12, -16, -16, 11, -11, 4, 1, -16, -11, -13, -12, -4, 17, 25, 17, 26, 11, -23, -40, -26, -31, -34, -24, -35, -8, 9, -17, 11, -8, 14, -10, 5, -5, 10, 10, -10, -1, -12, -3, 22, 11, 24, 17, 22, 19, -15, -14, -43, -45, -24, -7, -16, 8, 12, -8, -1, -11, 5, -18, 22, 11, 18, 19, 6, 15, 7, 3, 26, 27, 30, 13, 17, 17, 16, -22, -28, -16, -24, -24, -11, -1, 10, -2, -17, -12, 13, 10, -3, 24, 23, 10, 0, -9, 8, 15, 25, 5, 10, 3, -4, 15, 9, 21, -6, -18, -20, -25, -6, 3, 6, -5, 1, 3, 0, 8, 12, 33, 28, 12, 21, -3, 17, -8, -3, 17, 12, 3, 9, -2, 11, 18, -7, -4, -24, 0, -14, -12, 16, 10, -12, 12, -15, -17, -1, 33, 36, 17, 28, 7, 1, -10, -1, -6, 0, 6, 11, 7, -8, -9, 12, -3, 11, 8, 19, 21, -7, 7, 2, -7, 5, 17, 17, -4, 8, 26, 13, 14, -6, -6, -18, -5, -5, -22, -20, 2, 6, 7, 11, 7, 12, 17, 2, 18, -3, 15, 13, -14, 12, 16, -7, 11, -6, 13, 27, -9, 7, -5, 15, 11, -13, 4, 3, -4, 28, 32, 26, 21, 24, 26, 13, 9, -8, -4, 9, -4, -4, -13, -17, -10, -16, -12, 1, 15, 13, -22, -18, 1, 4, 4, 14, 41, 21, 22, 43, 34, 42, 44, 19, -2, 0, 11, -1, -9, -4, -2, 7, -8, 5, 4, -4, 1, 16, 11, 15, 10, 9, 27, 55, 30, 36, 23, 33, 37, 31, 2, -2, -7, -8, -8, -13, 5, -3, 9, 9, -21, -3, -17, 15, 0, 16, 10, 22, 38, 24, 42, 36, 39, 23, 29, 8, -5, 1, 4, -15, -12, 5, -18, -15, -3, 12, -10, 1, -15, -5, -5, -11, 21, 16, 19, 12, 4, -10, 1, -10, -3, -7, -9, 6, -4, 12, -13, 8, -18, -3, 4, -17, 12, 13, 3, 7, -8, 12, -14, -10, -16, -5, -3, 2, -1, -14, -16, -5, 13, -16, -9, -18, -9, -14, -10, -17, 12, -10, 11, 5, 7, 0, 1, -4, -23, -15, -4, 4, -1, 8, -5, 7, -12, -20, -9, -11, -10, -23, -24, 2, -20, -23, -3, 8, -13, 3, -13, -18, -2, -7, 2, 2, 8, -9, -16, 3, -3, -23, -5, -16, -12, -22, -21, -3, -18, -2, 4, 4, -11, -3, -18, 11, -21, -2, 2, -15, -19, -1, 4, -4, -7, 9, -13, -5, -5, -12, 8, -2, -9, -11, -3, 9, -11, 15, 6, 0, -7, -8, -23, 0, -1, -24, -18, -18, 8, 4, -24, -5, -19, -16, 4, -12, -12, 1, 2, -19, -4, 7, -11, -9, -2, 12, 25, 13, -9, 6, -12, 3, -9, -22, -4, 8, -12, 10, -10, -16, 3, 7, -9, -24, -4, -21, -9, -20, -15, 1, 14, 25, 3, -12, 6, 4, -2, 9, -14, -24, -2, -19, 6, -3, -5, -21, 4, -1, -25, -2, -17, -21, -25, -20, -32, -12, -5, -7, -18, -28, -12, -17, -26, -22, -8, -6, -5, -14, -25, -16, -11, 7, 6, -4, 1, -6, 0, -19, -12, -8, -17, -17, -33, -8, -6, -9, -1, -22, 1, 6, 22, 19, 13, 1, 4, -5, 19, -10, 6, -16, 5, -18, 7, 1, -8, -22, -24, -28, -32, -26, -13, -10, -2, -13, 5, 4, 28, 12, 17, 30, 29, 28, 14, 22, -4, -1, -11, -20, 5, -5, 10, 3, -31, -9, -12, -21, -16, -20, 8, 10, 15, 8, 27, 14, 29, 21, 29, 10, 31, 36, 39, 37, 22, 18, 14, 8, -9, 8, 7, -7, -1, -24, -18, -1, -23, -8, 7, 28, 32, 15, 9, 24, 15, 25, 1, 10, 4, 14, 26, 36, 40, 10, -10, -4, -18, 11, -6, 12, 14, -24, -9, -22, -1, 1, 29, 8, 9, 20, 37, 30, 14, 22, -9, 15, 25, 12, 28, 23, 49, 19, 11, 6, 0, 0, 16, -7, 7, -22, 2, -4, 9, 7, -11, 11, 9, 40, 18, 42, 31, -4, 21, -12, 18, -2, 27, 48, 23, 23, 12, -17, -18, 4, 8, 4, 2, 13, -19, -15, -3, -23, -16, -6, -27, 13, 10, 26, -11, 1, 8, 0, -10, -27, 7, 16, -14, 1, 7, -6, -22, -20, -1, 11, 7, 6, -1, -15, -23, -26, -14, -36, -26, -7, 27, 4, -18, -31, -17, -31, -13, -11, 3, -21, -31, -23, -1, -4, -22, -12, 10, 4, -14, -14, 4, -18, -28, -13, -21, -19, -27, -16, 7, -9, -11, -11, 0, 2, 17, 2, -2, -23, -18, -24, -10, -19, 7, 6, -14, -16, -12, -4, 7, 5, -25, -19, -15, -19, -5, -14, -23, -29, -13, -4, -7, -11, 3, -3, -28, -5, 1, -6, -20, 3, -22, 9, -4, -8, -9, -2, 14, -3, -5, -4, -12, -22, -33, -39, -33, -15, -21, -6, -7, -15, 1, -29, -15, -31, -24, -10, -24, -24, -18, -10, -11, 8, 13, 21, 15, 19, -4, -17, -10, -23, -30, -25, -9, -6, -1, -9, -3, -4, -4, -21, -46, -43, -14, -31, 8, 7, -16, -5, -19, -13, 4, -16, 11, -7, -9, -6, -19, -20, -36, -7, -1, -2, -25, 10, 27, 20, 18, -29, -24, -28, -40, -24, -23, 1, 4, 1, 2, -23, 1, 7, 13, 4, 7, 10, -11, -32, -28, 13, -15, -7, -14, 18, 4, 9, 1, -21, -21, -16, -14, -8, 1, -14, -16, 0, -9, -10, -8, -3, 16, 11, 19, -13, 6, -12, -13, -9, 10, -16, -15, 15, 11, 0, -31, -32, -12, -25, -7, -24, 9, -2, 4, -8, -10, -10, -2, 6, 17, 16, 1, 7, -1, -5, 21, 6, 7, 1, -3, 6, 15, -11, -14, -37, -14, -20, -5, -15, -13, 8, -5, -23, 5, -24, -15, 2, 23, 16, -11, -1, -1, 7, 10, -16, 16, 3, -1, -19, -10, -20, -23, -40, -19, -4, 4, -15, -12, -2, -24, -13, 3, -18, -9, 6, 19, -13, -14, -25, -10, 6, 7, -13, 0, 1, -5, -12, -43, -32, -18, -31, -16, -5, -14, -1, -19, 1, -8, 3, -7, -1, -7, 3, -2, 20, 12, 4, 9, -3, 32, 4, -3, 23, 6, -2, -36, -11, -22, -23, -5, -13, 8, -21, 5, 2, 5, -18, 8, 2, 5, -20, -10, 7, 35, 15, 20, 33, 17, 19, 0, 17, 27, 23, 18, 24, 5, 0, -17, 3, 5, -18, -22, -15, 8, 9, -9, -18, -15, -1, 3, 0, -9, 18, 12, 24, 31, 26, 41, 25, 41, 16, 11, 4, 16, 4, 4, -20, -22, -22, -21, 10, 7, 9, 5, 6, -4, 4, -16, -14, 8, -15, -12, -13, -21, -10, 13, 4, -4, 1, -16, -14, -20, 10, -8, -22, -2, 3, -22, -20, -9, -13, -1, 9, -9, -8, 0, 5, -15, -2, -1, 11, 0, 1, -17, -15, 2, -17, 0, -13, -9, 10, 8, -18, 0, -13, -4, -12, -11, -14, 12, 5, 9, 0, 8, 9, 5, 11, -12, -5, -19, -6, 6, 15, -15, -9, -3, 6, 9, 15, 15, -4, -5, 10, 11, 12, -11, -5, -8, -7, -15, 0, -11, -7, 4, 2, -16, 2, -14, -24, -5, -18, -21, 6, 10, -6, 7, -10, -17, 14, 4, -13, 4, 1, -17, 6, 5, 8, -10, -3, -9, 1, -5, 6, -5, -10, -1, -9, -12, -6, -2, -6, 5, 10, -2, -11, -18, -19, -6, -9, 4, -15, -5, -15, -16, -14, -11, -16, -15, 7, 2, -7, 9, 3, 10, 5, -6, -4, -3, 10, 17, -12, -11, 10, -1, 2, 8, 14, 7, 15, 10, 15, 8, -1, -7, -36, -18, -20, -3, -2, 30, 30, 21, 34, 36, 13, 22, 4, 24, 15, 4, 23, 21, 5, -9, -5, -6, 0, -17, -3, 15, -13, -29, -29, -20, 4, -5, 31, 23, 41, 50, 70, 53, 31, 6, 1, -15, 4, -9, 5, 7, 4, -12, 0, 16, -1, -7, 2, 10, -18, -2, 1, -9, 8, 26, 3, 35, 39, 58, 36, 32, 3, 10, -18, -8, -13, -21, -10, 17, 3, -5, 9, -5, -4, 14, -17, 3, -23, -18, 6, 2, -12, 25, 31, 35, 46, 17, -11, 17, 13, 1, -5, -1, 1, 6, -9, -21, 3, 7, -1, -4, -6, -19, 11, -22, -11, -30, -3, 17, 13, 5, 32, 31, 3, -20, -2, 3, -3, -2, 29, 20, -20, -16, 1, -14, 2, 22, 26, 12, -9, -17, -5, 6, -20, 5, 3, 34, 36, 21, 18, -14, -4, -10, -43, -18, -4, 12, 5, 8, -11, -13, 7, -8, 4, 8, 26, -12, -7, -9, -5, 3, -8, -13, 31, 49, 29, 27, 13, -6, -22, -36, -39, -25, 1, -6, 7, 8, -8, -7, -2, 1, -19, -7, 8, 5, 8, 5, -4, 5, 15, -7, 8, 8, -2, 15, -25, -1, -36, -33, -20, -18, -34, -11, -16, 0, 23, 33, 3, -13, 1, -5, -13, 5, -5, -2, -17, -21, -2, 26, 12, -3, 18, -16, -18, -9, -14, 1, 1, -23, -38, -25, -14, 1, 21, 32, -4, 16, -13, -6, -1, 0, 15, -12, -1, 1, -10, -8, -27, 0, -4, 8, -6, -10, 0, -2, -12, -4, -21, -30, -23, -13, 16, 31, 2, 5, -26, -25, -16, -5, -8, 10, -7, 10, 6, -3, -17, -1, 0, -15, 7, -7, -18, -26, -27, -25, -29, -23, -8, -15, 18, 3, 0, -10, -9, 7, -14, 11, -15, -4, 6, -10, 13, 23, -9, -6, -23, -22, -28, -11, 6, 6, -3, -13, -44, -33, -5, -4, -10, 6, -2, -4, -23, 9, 19, 21, -7, -13, -4, 9, 6, 22, 5, 9, -14, -25, -15, -4, -17, 7, -12, -34, -36, 0, 7, -7, -1, -16, -32, -24, -7, -9, 27, 2, 15, -7, 13, -2, 0, 35, 8, 11, -20, -9, -8, 3, 14, -23, -31, -17, -9, -9, 17, 13, -18, -3, -28, -14, 4, 8, 26, 1, 13, -16, -2, 11, 6, 11, 11, -4, -5, 9, -6, -18, 7, -1, -4, -18, 0, 9, 15, 15, -6, 13, -10, 9, -3, 7, 1, 14, -1, -18, -6, 0, 8, 31, 22, 16, -3, 12, 7, 1, 16, 13, -5, 17, 27, 42, 17, 21, -2, 16, 2, 2, 12, 35, 5, -15, -12, -19, -6, 15, -3, 25, 17, -4, 15, 7, -6, -5, 17, 8, 2, 9, 35, 40, 32, 28, 11, 24, 15, 1, 34, 11, 1, -4, -10, 7, 13, -2, 1, 18, 16, 16, 18, 19, 28, 32, 18, 31, 36, 34, 28, 42, 13, 28, -7, 24, 18, 6, 38, 2, -7, 7, -13, 1, 0, -4, 1, -5, -15, -14, 0, 3, 1, 23, 37, 25, 21, 32, 25, 17, 10, -5, 22, 7, 40, 28, 11, 2, -12, 8, 4, -6, -6, -1, 1, -4, 1, -12, -30, -3, -9, 11, -3, 23, 19, 31, 34, 33, 23, 28, 21, 19, 30, 12, 13, -1, -13, -18, -15, 6, -17, -10, -16, -1, -13, 6, -22, -9, -13, -45, -43, -30, -38, -18, -9, 22, 32, 16, 6, 44, 13, 1, 16, 17, 12, -7, 4, -12, 12, -3, -15, 6, 1, -5, -5, -5, 6, 9, 7, -17, -11, 14, -12, -4, 18, -1, -4, 13, -8, -8, 8, -2, 2, 8, -19, 10, 16, -15, -6, 13, -4, 4, -4, -1, 13, 2, -18, -8, -13, -9, 11, -11, -10, 4, 4, -2, 10, -12, -2, -13, -9, 11, 4, 7, -3, 15, -7, 12, -16, -17, 5, 1, 8, 1, 9, -2, 15, -15, 8, -2, -1, 10, -1, 9, 16, 3, 14, -7, -14, 12, 17, 2, -13, 3, 2, 7, -10, 3, 14, -5, -7, 4, -13, -12, -9, 12, 6, -17, -14, 11, -10, -14, -9, 1, -6, -10, 3, 10, 12, -16, -16, -1, 13, 13, 2, 18, 0, -9, 1, -4, -4, 18, -10, 10, -21, -20, 1, 15, 24, -4, 1, 22, -3, -13, -3, 8, 1, 7, -13, -17, 8, 5, 8, 9, 6, 1, -7, -7, 18, 12, -20, -18, -1, -24, 20, 1, 8, 13, 30, 4, -5, -6, 11, 8, 10, 14, -1, 10, 6, 1, -9, -2, -11, -6, 22, 19, -7, -23, -11, -13, 16, 1, 4, 28, 25, 34, 39, 21, 19, -9, 1, 16, 17, -9, -8, 10, -12, -8, -16, -12, -8, 4, 5, 2, -33, -9, -8, -2, -20, 9, 9, 5, 37, 27, 30, 10, 20, 5, 4, -1, 1, -13, -10, 12, 10, 7, 0, 14, 8, 24, -20, -20, -5, -10, -23, -31, -38, -31, -3, -20, 13, 26, 32, 25, 29, 38, -7, -12, 6, -4, 5, 9, -12, -3, 29, 11, -4, 10, -7, -1, -13, -14, -24, -25, -19, -34, 1, 4, -7, -3, -7, 3, 50, 40, 6, -9, -13, -14, -8, 9, 1, -7, 26, -9, -14, -1, 20, -11, -1, 4, 5, -29, -39, -10, 18, 11, -4, 10, 15, -2, 27, 8, 2, -7, 12, 11, 3, -3, -11, 9, -17, 6, 12, 10, -9, 7, -1, -21, -12, -2, -18, -6, 7, 17, 12, 13, 11, 7, 25, 13, 11, 10, -1, 8, -6, 9, -9, -1, -4, -29, -14, -20, -10, -18, -13, -20, 5, 7, -5, 5, 31, 0, 0, -17, 6, 13, 3, 35, 10, 9, 4, -8, 14, -7, -8, 5, -24, -4, 9, 10, 11, 3, -22, 6, 3, 2, 23, -1, 18, 12, -20, -1, -15, 14, 19, 9, -4, 12, 14, -1, -1, 6, -5, -8, -22, 16, -2, -6, 9, 8, 8, 4, 24, 32, 29, 22, -2, 13, -26, -31, 8, 7, 40, 44, -14, -12, -5, 3, -17, -6, -19, -23, 4, 17, 0, 18, 25, 26, 24, 33, 11, 2, 12, 19, 8, -7, -2, -18, -24, 5, 11, 0, -21, -30, 10, 14, -10, -2, 1, -23, -13, 8, 14, 24, 39, 4, 9, 14, 3, -10, 7, -23, -16, 14, -15, -10, 5, 11, 10, -6, -3, 0, -6, 12, 8, -9, -3, 1, 10, -17, -6, 11, 13, 19, 28, 2, -25, 8, -20, -17, -19, -13, -8, -5, 2, 24, 14, -12, -18, -26, 3, -15, 8, 2, -25, -12, -2, -1, 12, 24, 12, 17, 15, 8, -33, -8, -14, -2, -27, 14, 4, 12, -13, -3, 5, -2, -19, -22, -2, 13, -16, -4, -11, 5, -4, 19, 14, 5, 20, 30, -1, -20, -2, -21, -22, 12, 5, -14, 0, -11, 4, 14, 27, -20, -27, -26, -17, -11, -1, 11, -17, 7, 2, 12, 5, 2, 22, 21, 18, -3, 8, -20, 8, 5, 4, -14, 5, 1, -14, -9, 18, -19, -10, -21, -5, -1, -5, 7, 2, 0, 16, 26, 18, 32, 23, 16, 35, 15, -14, -1, 18, 0, -4, 5, 2, -3, -10, -8, -24, -4, 0, 2, 4, 8, -2, -17, 5, -14, -8, 2, 14, 33, 21, 42, 25, 50, 19, 34, 22, -9, 5, 15, 2, -1, -1, -33, -10, -26, 3, -11, 5, 8, -6, 10, -16, -18, -6, -8, 33, 17, 33, 8, 35, 31, 24, 13, 7, -4, 0, -3, -18, -6, -21, -16, -23, -29, 12, -9, 8, 13, -9, -12, -22, -24, 0, -14, 1, -5, 4, 20, 29, 17, 27, 37, 46, 14, 9, 6, 4, -23, -15, -15, -24, -4, -11, 1, -14, 11, -17, 6, -16, -6, -25, -16, -7, -15, -13, -17, 16, 6, 34, 34, 25, -12, -24, -14, 1, -24, -19, -28, -18, 5, -15, 0, 13, -5, -5, 2, -9, 12, -7, -21, -26, -6, -5, -1, -6, 16, 4, -2, 7, -6, -30, -16, -11, -8, -26, -17, -18, 12, 5, 2, -3, 15, -15, 4, 5, -21, -10, 3, -7, -10, -21, -3, 1, -14, -42, -43, -20, -5, -20, -16, 5, -11, 1, 16, -1, 6, 13, -8, -5, -17, 9, 11, 4, 5, -18, -24, -25, -17, -30, -30, -17, -17, -22, -32, -26, -9, -4, -4, -21, -17, -10, 10, -12, 13, 9, -14, 2, -7, 12, 14, 6, 2, 10, -14, 10, -1, -16, -12, -5, -15, -12, -12, 10, 5, 0, 3, -18, 12, -7, 13, -13, 10, 0, 11, -13, -14, 12, -11, 0, 4, 10, -10, -2, -8, -10, 4, 6, -16, 5, -10, 13, -16, -3, 9, 2, 5, -2, 12, 11, -2, -10, -12, 12, -3, 1, 6, 8, -10, -2, -12, 13, 6, -2, -9, 15, 15, -5, -10, 14, -5, 3, -16, 15, 3, 0, -6, 8, 7, 0, 8, -1, -12, -2, 7, -10, 15, -9, -17, -2, -8, -2, -20, 1, 0, -6, 17, -1, -6, 12, -9, 12, -16, 9, -10, 16, 6, -14, -9, 16, 11, -15, -14, -8, 11, 8, -16, -1, -23, 0, -23, -28, -16, 16, 14, -12, 3, -14, -8, -18, 2, -8, 15, -5, -4, -17, -8, -18, -4, -4, -15, 11, 4, 2, -26, -12, -22, -20, -9, 15, 23, 27, -7, -9, 14, -10, -15, 13, 11, -2, 0, 15, -11, 17, 5, -6, -10, -7, -11, -9, -3, -28, -3, -9, 0, -9, 2, -15, 14, 2, -17, -26, -23, -33, 1, -6, 21, 15, 8, 18, -14, -4, 10, -8, -3, -4, 15, 6, -9, 16, -24, -26, -34, -29, -14, 2, 7, -17, -18, -37, -46, -11, -16, 5, 17, 7, 28, 23, 7, 4, -2, 15, 9, 2, -11, -8, -12, -9, 10, -2, -28, 1, -9, 1, -17, -33, -56, -44, -36, -28, 11, 17, -10, 5, 16, 11, -18, 7, 11, -10, 1, 4, 2, 23, 32, 3, -1, -9, -5, 12, 11, 4, 19, -23, -26, -39, -27, -8, 4, -4, -5, -15, 10, 10, -12, 8, 2, 0, -13, -8, 1, 6, 4, 18, -9, 1, -21, -6, -2, 9, 26, 10, -18, -13, -18, -11, 22, 3, 6, 14, 25, 16, 1, -20, -19, -1, -17, -9, 11, 13, 24, 24, -9, 2, 2, 11, 7, 37, 35, 11, -20, -13, -19, 21, 16, 10, 13, 12, 2, 2, -6, -13, -11, -17, -1, -2, 7, -7, 22, 0, 7, -3, -11, 5, 27, 28, 43, -4, -36, -29, 2, 6, 31, 9, 7, -13, 1, 2, -8, 0, -16, 4, -1, 1, 16, 17, 12, -12, 0, 24, 33, 21, 28, 40, 11, -19, -37, -35, 7, 27, 7, 11, 0, 1, 0, 3, -8, -19, 4, 0, 1, 10, -4, 5, -19, 18, 27, 6, 23, 25, 40, 28, 2, -36, -45, -11, 6, 24, 12, -18, 4, 12, -2, 21, -11, -15, 1, 8, 6, -11, 1, 11, 5, 21, 6, 29, 13, 36, 32, -10, -34, -40, -36, -35, -7, 4, 18, 9, -2, -4, 15, 12, 2, -16, -5, -1, 5, -1, 6, 8, 13, 17, 24, 10, 32, 28, -18, -62, -49, -62, -24, 8, -16, -8, 12, 11, 16, -11, 10, 6, -14, -29, -8, -15, 6, -9, 16, 17, 6, 13, 29, 48, 22, 7, -46, -73, -83, -73, 0, 23, 3, -18, -7, -4, -20, 3, 0, -9, -10, -12, -3, 9, -5, -17, -14, -22, 17, 13, 6, 12, -13, -38, -59, -59, -101, -52, 2, 33, 12, -6, 10, -20, -23, -22, -13, -25, -33, -11, 6, -2, -3, 10, -8, -7, -1, -1, -18, -16, -8, -42, -50, -88, -71, -2, 16, 20, -1, 7, -6, 1, 11, 8, -27, -34, -31, -5, 2, -4, 5, 6, -16, -3, 15, 10, -2, -29, -10, -27, -61, -59, -39, -10, 2, 5, 21, 20, 5, 0, -23, -27, -30, -46, -23, 3, 0, -9, -11, -7, 10, -10, -24, -16, 2, -19, -8, -34, -38, -28, -3, -5, 0, 27, 24, 5, 16, -4, -17, -12, -53, -21, 1, -10, 2, 3, -17, 11, 14, -18, -6, 9, -6, -17, -15, -28, -29, -5, -16, 5, 16, 24, 10, 23, 24, 15, -12, -10, -39, -21, -15, 5, -17, 5, 11, -10, -9, -3, -13, 19, 7, -15, -11, -13, 9, -13, 3, 7, -15, 3, 10, 8, 35, 8, 18, -11, -39, -5, 3, -19, -16, -18, 0, 7, 2, 1, -21, -7, 11, -19, -23, -4, -22, -19, -14, -6, -14, 2, 3, 15, 20, 12, 5, -9, -38, -17, -15, -6, 16, -18, -12, 10, -4, -16, 0, 10, -6, 8, -23, -22, 0, -15, -6, -17, -12, -9, 3, -7, -4, -16, -23, -24, -6, -21, -17, 3, -9, -16, 12, -4, 4, 9, -3, -6, 6, -10, 3, 6, -9, 0, -11, -13, -9, 4, -12, -6, 7, -7, -18, 6, -17, 2, 11, -10, -12, 1, 15, 3, 7, 9, -5, -17, 7, -6, -9, -1, -23, 3, -21, 4, -40, -12, -8, -14, -5, -7, -9, -1, -11, 13, 12, -12, 9, 16, -8, 8, -17, 1, -6, 0, 4, -9, -1, 15, 11, 3, 1, 7, 6, -9, 0, 3, 14, -5, 5, 0, -5, -14, -5, 13, -16, -11, 2, 20, 12, 21, 17, -2, -9, -3, 0, -4, 24, -6, 3, 17, 7, 5, 3, 3, -8, 18, 21, -3, 6, 11, 8, -3, 0, 3, 20, 21, 16, 23, 25, 24, 20, 12, 16, -7, 17, 26, 9, 18, 23, 22, 17, 5, -7, 12, 13, 21, 2, -4, -8, 21, 1, 4, 14, -2, 1, -2, 18, 5, -2, 21, 0, 23, 14, 34, 26, 12, 4, 6, 25, 13, 8, 0, 29, 15, 16, -2, 10, 18, -9, -2, 9, -4, -3, -7, 19, 17, -4, 1, 17, -2, -3, -15, -15, 2, 22, -4, 11, 8, -15, -6, 21, -5, 9, 29, 16, 9, 6, -3, 21, 12, 22, -2, 15, 25, 23, 5, 7, 5, -11, -8, 3, 13, -10, 10, 16, 5, -20, 5, 3, -4, 15, 9, 15, 16, 19, 18, -9, 15, 20, 15, 5, 18, 12, 22, 14, -3, 1, -8, 10, -2, 6, 28, 19, -10, -11, -9, -5, -1, -16, -10, -10, -14, -3, 6, -9, 14, 2, 12, 11, 14, 7, -5, -15, 4, -12, -2, -9, -16, -15, -1, 4, 17, -1, -15, -19, -10, -16, -16, -20, -2, 1, 12, 18, 2, 7, -8, 6, 5, -16, -19, -12, 20, 9, 5, -21, -13, -6, 0, 2, -5, 18, 4, -7, -31, -30, -27, -24, -10, 5, 24, 2, 5, 16, -1, 18, -15, 3, 4, -10, -1, -5, -20, -32, -38, -15, 21, 1, 26, -6, -19, -31, -47, -21, -25, -33, -10, 18, 18, -2, 14, -13, 7, 6, 11, -9, -11, 6, -25, -14, -31, -25, -7, -3, 44, 32, 12, 5, -41, -19, -44, -42, -32, -31, -31, -5, 7, -2, 19, 19, -1, -2, -18, -16, 2, -7, -25, -24, -15, -30, -10, 21, 59, 37, -6, -28, -21, -32, -35, -42, -30, -44, -33, 12, 22, 5, 7, -9, -8, 2, -26, -3, -28, -28, -29, -7, -20, -8, 23, 39, 38, 35, -14, -39, -38, -6, -16, -11, -17, -29, -33, -12, 7, 0, 5, 17, 1, 2, 4, -18, -7, 16, 2, 0, -12, 22, 29, 27, 8, -7, -12, -45, 1, 2, -6, 15, 21, -14, -11, -11, 4, -3, 7, 16, 18, -18, -11, 11, -10, -1, 25, 6, 10, 34, 17, 28, 34, 16, -4, 10, 12, 26, 42, 22, 27, -7, -21, -17, 4, 23, 17, -1, -4, -4, -15, 17, 18, 20, 5, 20, -3, 7, 7, 13, 26, 3, 14, 2, 47, 45, 45, 15, 7, -5, 3, -6, 10, 19, 22, 9, 2, -13, 5, 12, 19, 34, 2, -20, -11, 17, 35, 18, 26, 5, -17, -8, 20, 19, 29, 1, 2, -16, -1, -5, 21, 6, 15, -3, 7, -16, -4, 14, 5, 15, 7, -29, 11, -8, 36, 38, 23, -14, -21, -18, -18, -3, 8, 14, 8, 10, 9, 6, 15, -1, 1, 5, 2, 3, -16, -9, -3, -16, -15, -18, -11, -11, 25, 40, -10, -23, -24, -5, -25, -1, 8, -6, -8, -21, -11, -13, -9, 0, 8, 6, -8, -8, -29, -15, -23, -15, -17, -16, -17, 9, 23, 22, 21, 3, 1, -1, -5, -1, -3, 4, -4, -9, 9, 21, -6, 18, 7, 15, -10, -7, -10, -21, -26, -34, -51, -29, 1, -3, 15, 8, 27, 10, 6, 19, -13, -6, -23, -14, -5, -23, -13, 21, 21, -2, 19, 9, 22, -22, -7, -11, -2, -15, -39, -30, -23, 11, 9, 41, 14, 22, 17, 39, -18, -4, -3, -9, -12, -23, -16, 11, -2, -5, 7, 6, 26, -5, -14, -16, 1, -9, -7, -27, 5, -4, 0, 17, 25, 29, 25, -1, 1, -10, -35, -17, -16, 2, -11, -9, -7, 10, 11, 1, 16, -7, 29, 1, 5, 2, -20, -9, -9, -22, -18, 2, 6, 2, 6, -5, -13, -2, -26, -18, -28, -3, 17, 16, 13, 4, 16, 5, -6, 21, 10, 12, -15, -30, 8, 7, -1, 8, 26, -15, -4, 1, 12, 14, 3, -6, -12, 0, 9, -10, 12, 14, -8, -4, 4, 11, -8, -3, 6, -10, -1, -16, -15, 7, -3, 12, -3, -8, -11, -6, -11, 9, 14, 16, 16, 20, 16, -2, -9, 6, 21, 2, -2, 22, -6, -2, 0, -13, -22, -21, -19, -7, -11, -19, -15, -9, -12, -23, -27, -3, -3, 3, 14, 2, -2, 14, 8, 23, 15, 0, -6, 16, 2, 19, -1, 0, 3, -17, -16, -2, -13, -32, -16, -43, -14, -39, -22, -16, -13, -14, 4, 21, 0, 16, 22, -4, 18, -7, 9, -9, 19, 13, 22, -8, 13, -3, -10, 16, 6, -8, 15, 2, 10, 13, -3, 10, 23, 4, 9, 22, 9, -8, 0, 6, 15, -16, -17, 0, -5, -3, -11, -7, 2, 9, -15, -4, 1, 2, 11, -19, -10, 8, -8, 9, -14, -15, -2, -18, -14, -13, -12, 4, 8, 6, -16, 2, 8, -21, -3, -8, 10, -18, -4, -2, -20, 1, -18, 12, -17, 6, -1, -18, 3, -10, -20, -20, -19, -4, -18, 3, -15, 1, 9, -13, -19, -13, -21, 3, -7, -3, 6, -1, 7, -16, -13, -26, -8, -23, 1, -4, -26, -14, -2, -21, -16, 13, 12, -14, -15, -11, 6, -12, -11, 6, -13, -15, -22, -7, -30, -15, -10, -20, -8, 0, -26, -10, -17, -22, -15, -20, -36, -22, -2, -1, -6, -17, -2, 9, -11, 6, -13, -14, -5, -18, -22, -15, -50, -29, -57, -37, -42, -15, -5, -2, -5, -2, -29, -26, -31, -22, -31, -6, -20, 2, 1, -17, 8, -4, -2, 8, -13, -13, -38, -51, -39, -16, -31, -29, 2, -14, -6, 4, -12, -7, -11, -15, -20, -15, -36, -26, -23, -1, 9, -21, 4, -5, 1, -14, -19, -23, -17, -37, -48, -17, 3, -4, -22, -21, -11, -22, -20, 2, -3, 1, -5, -8, -9, -34, -17, -23, -6, -14, 3, 4, -10, -10, -11, -29, -1, -10, -12, -17, -22, 3, -4, -17, -15, -16, 5, 17, -15, -8, 3, 19, 3, 7, -19, -26, -14, -7, -13, 5, 18, -10, -14, -21, -18, -30, -31, -14, -3, 20, 3, -1, 8, -11, 22, 16, 24, -5, 0, 19, 45, 19, 0, 9, 4, -14, 3, -1, 6, 21, 8, 11, -5, -30, 10, 11, -21, 21, 6, 14, -2, 5, 4, 22, 15, 0, 21, 29, 11, 36, 7, -4, -12, -19, -1, 26, 7, 25, 7, 17, -4, -31, -5, -5, 20, 22, 46, 29, 12, 22, 8, 9, 24, 13, 21, 15, 23, 32, -4, -1, -15, 9, 11, 1, 21, 9, -9, 16, 24, 14, 16, 15, 16, 5, 42, 43, 1, 11, 15, 26, 3, 22, 34, 40, 22, 44, 2, -5, -11, 5, 1, 22, 11, 13, 4, 22, 18, 8, 19, 9, -5, -12, 6, 6, -6, 0, 14, 8, 4, 2, 16, 28, 39, 42, -2, 4, 0, -16, 0, 4, 2, 12, 7, 3, -5, 0, 2, -5, 4, 1, -13, 0, -3, -18, -14, 12, 11, -2, 2, 13, 21, 19, 17, 8, -12, 0, 5, 0, -7, -17, 0, 8, 0, -27, 9, 9, 9, -24, -34, -38, -35, 3, -12, 4, 5, 3, -14, 6, 20, 22, 10, 2, 11, -13, 6, -17, -8, -35, -19, -11, 11, 11, 5, 23, -6, -23, -15, -24, -41, -22, -9, 19, 9, 15, 14, -6, -2, 20, 4, -15, 6, -7, -11, 10, 1, -17, -20, -12, 7, 32, 26, 9, -5, -11, -49, -52, -36, -37, -12, 2, 1, -10, -19, 3, 8, 14, -6, -6, -11, -17, -2, 3, -1, -7, 13, 14, 21, 17, 24, 32, 25, -15, -38, -31, -38, -20, -32, -24, -18, -14, -10, -1, -12, 26, -3, -11, -10, 2, 9, -19, -18, -24, -9, -6, 27, 21, 14, 8, 16, -40, -58, -65, -27, -24, -36, -21, -11, -19, -24, -19, -2, 1, -15, -10, 5, -1, -8, 2, -28, 3, 2, 22, 17, 35, 14, 17, -14, -33, -38, -23, -35, -19, -27, -8, -26, -30, -6, -13, -27, -20, -6, -19, -3, 11, -14, -22, -18, -29, 4, 20, 29, 33, -7, 0, -16, -34, -27, -43, -37, -44, -18, -19, -33, -16, -6, -18, -32, -15, -8, -1, 6, 11, 8, -17, -17, -19, 17, 29, 17, -2, -12, 10, 1, -40, -38, -25, -28, -20, -21, -15, -27, -32, -27, -17, -25, -16, -5, 5, 5, -5, 11, -22, -31, -23, 20, 56, 48, 17, 3, 24, 14, -12, -14, -12, -34, -20, -17, -34, -16, -29, -11, -15, -1, -2, -18, 11, -18, -14, -13, 10, -1, 6, -2, 15, 15, 21, 32, 30, 27, 31, 23, 10, -20, -21, -21, 1, -4, -28, -10, -20, -20, 9, -7, -9, -12, 13, -12, 3, -8, -2, -20, -12, -7, 4, 20, 26, 8, 21, 35, 5, 1, 18, 11, 15, 4, -16, 2, -7, -5, -5, 13, 10, -16, -1, 10, -14, 13, -4, -39, -26, 1, -31, -20, -5, -7, 3, -4, -9, 4, -9, 17, 2, 25, -19, -3, 9, -7, -12, -4, -12, -14, -13, 9, -14, 12, -15, -11, -27, -19, -11, -21, -26, 0, -22, -3, -8, -12, 18, 8, 20, -1, -14, 9, -10, -21, 8, -17, -18, -11, -11, -13, 9, -8, 2, 1, 10, -7, -1, 5, 4, 0, 3, 11, 5, -13, -12, -10, -12, 11, -1, 14, -14, -2, 12, -4, -4, -8, -15, 8, -13, -15, -6, 13, -5, 0, -4, -12, -10, 0, 14, 7, 16, -13, -10, 12, 3, -15, -14, -16, 3, -16, 13, -11, 5, -13, 8, 4, -10, -3, -13, 14, -4, -8, -4, 16, 6, -16, -9, 8, -5, -10, -12, -11, 1, -9, -6, -3, 11, -13, 8, -11, -13, 6, 11, -5, 7, 5, 12, 11, -9, -12, 2, -4, -14, 8, 8, 6, 10, 8, -3, 5, 14, 14, 21, 11, 11, 14, -15, -13, -5, 10, 12, 12, -16, 11, 6, -1, -6, 8, -7, -16, 3, 7, -25, 4, 4, 7, -7, -11, 16, -9, 15, 11, -8, 0, 13, 8, 12, 8, 16, 4, 12, -17, -15, 6, -6, -12, -26, -12, -40, -11, -24, -11, -22, -5, -30, -4, 4, 6, -1, 5, 9, 0, -11, 6, 5, 8, -16, 4, -15, -11, -7, 5, -20, -5, 8, -4, 1, -14, -17, -9, 10, 6, -4, -32, -1, -9, -5, -4, -15, 12, 2, -12, -14, -16, 2, 7, -8, 13, -3, 8, 2, 14, 3, -13, -11, -11, -8, -17, 2, -2, -21, -4, -17, -32, -17, 4, -11, -25, -26, -26, 15, 13, -9, -17, -15, 0, 0, -13, -19, -4, -18, -8, -6, 16, -3, -3, -25, 1, -6, 7, -20, -8, -17, -21, -13, -23, 5, 8, 15, 16, 1, -1, 12, -5, 11, 16, 1, -21, 11, -6, -5, 12, -6, 0, -4, -21, 9, 11, -3, 9, -9, -17, -23, -16, -14, -16, -4, -1, -4, -15, 10, 15, 1, 19, -10, 8, -17, -8, 13, -9, 2, 6, -13, -16, 3, 11, -5, 19, -11, -4, -23, -21, -4, -14, 5, -4, -18, 6, -10, -9, -6, -16, -8, -1, 12, 10, -6, 4, -1, -6, -21, -8, -9, 1, 4, 0, 18, 2, -25, -9, -23, -29, -7, -5, -1, -16, 12, -15, -2, -36, -21, 2, -3, 3, 3, 20, -2, -25, -24, -17, -11, 7, 21, 20, 8, 8, 13, -30, -37, -30, -21, 12, 8, -17, 2, 5, -28, -28, 10, 2, 27, 19, 7, 17, -2, 2, -14, -1, 10, 30, 30, 24, 6, 15, 13, 17, -6, -34, -4, 15, 13, 7, -17, -9, -7, 8, -7, 17, 21, 1, 14, 51, -7, -2, -12, -23, -6, 4, 1, 10, -7, 14, 4, 3, 8, -16, -7, 4, 16, -7, -8, -19, -8, -11, -1, 2, 17, 14, 13, 47, 8, -2, -22, -21, 1, 6, 35, 38, 24, 12, 9, 5, -16, -31, -9, 10, 8, -10, 0, 1, -9, -4, 14, 1, -4, 13, 30, 42, -9, -9, -49, -27, 2, 29, 42, 21, 14, -3, 18, 12, -4, 0, -17, -12, -10, -5, -18, -14, -19, -4, 15, 13, 10, 17, 4, 17, -27, -36, -43, 10, 6, 43, 44, 37, 30, -7, 12, -25, -9, -15, 6, -14, -1, 10, -20, -27, -9, 1, 1, -4, 28, 31, 25, 4, -30, -31, -17, 11, 30, 39, 28, 29, 8, -12, -5, -9, -23, -10, 7, -17, 10, 5, -12, 0, -7, -19, -6, -6, 6, -8, 16, -10, -8, -27, 3, 10, 1, 11, 14, 1, -18, -20, -29, -52, -17, 6, -11, 4, -3, 7, -3, -23, -23, -29, -22, -12, -21, -12, -24, 19, 10, 2, 18, -5, 15, 7, 12, -15, -34, -36, -22, -37, -31, -6, 13, -5, -5, 15, -15, -14, -21, 2, -39, -45, -17, -32, -21, 10, 24, 16, 4, -16, -6, -3, -30, -24, -30, -37, -47, -13, -11, -21, 12, -7, -13, 13, -5, 1, -17, -27, -18, -21, -5, -27, -6, 1, 6, -7, -1, -25, 4, -27, -15, -15, -20, -15, -36, -33, -9, -21, 17, -14, -4, -17, -7, -24, -37, -12, -3, -11, 6, -7, -7, 12, 9, 16, -3, 7, -15, -10, -35, -24, -18, -25, -13, -9, 2, -1, 12, 2, 4, 6, 0, -4, -28, -22, -27, -14, 3, -6, -6, -2, -2, -20, 1, 10, -2, -22, -25, -9, -19, -23, -25, -26, 2, -4, 12, -6, -6, 15, 11, 3, -9, -10, -1, -11, -21, 6, -22, -2, -6, -4, -32, -1, 15, -1, 3, -21, 11, -11, -4, -13, 2, -5, 8, 5, 8, -13, 8, 11, 0, 18, -17, 8, -12, -5, 10, 16, -10, -19, -1, 1, -7, 0, 11, -25, -19, -8, -20, -15, -9, -14, -8, 16, -16, 0, -5, 13, 4, -9, -3, 15, -7, -4, 28, 9, 2, 12, 30, 15, -8, -11, -2, -15, -5, 4, -8, 7, 13, 1, -4, 6, 8, -8, 0, 14, 6, 11, -7, 7, -5, -9, 2, -4, -7, 9, 10, -3, -12, -2, 1, -12, -12, 6, 6, 9, -15, -7, 5, 14, 4, 17, 11, 10, 3, 4, 11, 1, 4, -2, 13, 3, 7, -8, -9, 14, -6, -2, -6, -12, 16, 9, -16, 2, -3, -8, -10, 0, 4, 0, 6, -9, 5, -9, 14, 16, 12, 4, 6, -8, 11, -15, 8, 10, 19, -8, 10, 10, 1, -7, 8, 9, 15, -14, 0, 18, -9, 7, -7, -12, 10, -3, 0, -14, 16, 13, -1, -7, 13, 11, 22, 17, 40, 11, -6, 4, -19, -13, 11, 5, 3, -14, 4, 12, 7, 6, -11, -11, 16, -8, -8, -11, 10, 22, 20, 11, 39, 27, 66, 58, 64, 56, 49, 21, 17, -23, -24, -8, -23, 17, 11, 12, 5, -13, 9, -8, 9, 10, 19, 14, 22, 4, 25, 25, 26, 14, 55, 76, 63, 74, 65, 36, 31, -5, -12, -30, -33, -23, -15, 1, 1, 9, 17, 0, 2, -14, -9, -6, 3, 5, 1, -10, -10, 13, 22, 35, 51, 31, 57, 48, 23, 21, 21, -18, -40, -21, -15, -14, 1, 8, 4, 14, 5, 6, 2, -21, -13, 10, -3, -16, 2, -1, 20, 28, 38, 35, 59, 34, 31, 20, -3, -29, -19, -8, -15, -11, 11, 9, -8, 8, -6, 7, -7, -10, -9, -5, 6, -20, -34, -38, -1, -12, 16, 27, 23, 33, 15, 13, -2, -13, -21, -7, -12, -10, 5, 18, 2, -15, -16, -12, 9, 2, 5, -4, -23, -34, -34, -41, -47, -14, 17, 26, 18, 33, 25, -11, 15, -8, -30, -22, 17, -9, 16, 5, 0, -2, -16, -29, 0, -24, 3, -35, -29, -27, -37, -84, -75, -19, 20, 30, 22, 19, 27, 12, 3, -29, -41, 6, 1, -6, 3, 11, 13, 14, -5, -17, 5, -28, -31, -41, -33, -49, -53, -67, -81, 12, 44, 49, 40, 10, 8, 7, -11, -11, -28, 0, -10, -2, -10, 0, 6, -4, -22, -9, -23, -17, -38, -37, -25, -16, -39, -38, -29, 9, 21, 45, 32, 37, 30, -6, -18, -27, -20, 2, -7, -7, 15, 17, 4, 7, -15, -24, -37, -14, -25, 2, 5, 9, -11, -11, 23, 17, 31, 17, 37, 19, 1, -27, -41, -34, -6, 14, 15, -14, 18, 4, -15, -10, -9, -8, -10, -9, -14, 2, 11, 24, 10, 2, 9, 12, 13, 11, 6, 3, -1, -16, -11, -17, -18, 0, -14, 14, 18, -8, 8, 21, -3, -7, 18, -1, 0, -11, 13, -8, -1, 1, -8, -3, 6, 27, 25, -6, -5, -23, -20, -3, 3, -13, 2, 3, -12, -6, -13, 11, 23, 28, 8, 10, -32, -12, -30, -25, -44, -38, -18, -9, 7, 9, -17, -5, -8, -30, -32, -18, -15, 7, 16, 4, 10, 17, -3, 38, 20, 21, -14, -20, -50, -31, -27, -35, -48, -29, -18, -9, 5, -3, 0, 11, -2, -37, -38, -11, -2, 2, 4, -6, 8, -6, 6, 31, 32, 9, -1, -14, -21, -31, -39, -20, -17, -8, -13, -4, 6, -15, 1, 2, -44, -14, -28, -38, -8, 12, 20, -4, 14, 5, 15, 47, 16, 10, 5, 15, 7, 0, 12, 15, 8, 20, 25, -1, -11, -6, 15, -8, -10, -29, -28, -19, -16, 4, -12, -7, 8, -14, 12, 10, 11, 10, 15, 8, 26, 26, 35, 52, 47, 66, 16, 13, 16, 4, 11, -16, -31, -39, -17, 13, 21, -6, 8, -7, 10, -6, 0, 30, 3, 15, 32, 17, 20, 43, 34, 58, 35, 39, 25, 11, 28, 28, -1, -1, 0, -10, 14, 2, 7, 22, -12, -10, 6, -2, 11, 12, 13, 18, 8, 10, 33, 25, 31, 23, 13, -13, 16, -10, 2, 23, 3, 7, 9, 1, 0, 6, 13, 14, -8, -3, -12, -6, -10, 27, 35, 34, 13, 10, 13, 9, 14, -17, -13, -24, 3, 4, 11, 16, 8, 39, 11, 15, 18, 13, -8, 18, 2, -5, -13, 12, -3, 7, 31, 27, 19, 10, 10, 17, 18, -15, -10, -25, -8, 3, -4, 21, 32, 28, 2, 17, -6, 0, 19, 18, 18, -10, 1, 12, -13, 3, 7, 22, 11, 28, -9, -3, -4, -35, -23, -9, -28, 10, 28, 22, 18, 12, 13, 8, 18, -5, 16, 9, 7, -8, 18, 7, 6, -15, 8, 14, 10, 0, -7, -2, -35, -13, -18, -21, -4, -1, 9, -8, 13, -9, -14, 2, 2, 6, 12, -12, -10, 7, 1, -11, 4, -12, 12, -2, -11, 16, -5, 9, -7, 5, 9, 15, -12, -4, -9, 9, -2, -12, -1, 17, -15, -13, 2, 3, 0, 14, 5, -14, -4, 16, 4, 15, -9, 0, 4, -7, 17, 8, -5, 17, -5, 9, -15, -4, 12, -10, 10, -4, -4, -11, -12, 0, 16, 18, -12, -8, -2, -18, 5, -14, 5, -11, -8, -18, -9, -8, -21, 5, 5, -9, -5, -13, 5, 1, 6, 6, 8, -8, -14, 10, 5, 8, 9, -9, -6, 5, -3, -16, -22, -21, -2, -12, -16, -13, -2, 8, -22, -19, -19, 1, -6, 6, 7, -1, -7, -18, -17, -23, -9, -20, 0, 10, 5, -16, -21, -3, 4, 2, -16, 5, -6, 6, 12, 3, 14, -2, -8, 2, -5, 11, -16, -10, 16, -5, -5, 9, 10, -8, 8, -24, -19, 3, -18, -6, 13, -8, 23, 18, -1, 14, 28, 21, 11, 25, 18, 16, 17, 12, 32, 15, -1, 10, -10, -20, 3, -15, -10, -15, -6, -17, -16, -4, 4, 9, 15, 6, 31, 18, 10, -2, 1, -6, 31, 27, 5, 7, 4, 16, 20, 4, 7, 13, -15, -7, -20, -5, 8, 12, 18, 26, 35, 36, 22, 19, -2, -7, 2, -14, -12, 8, 27, 20, 26, 38, 16, 16, -8, 20, 11, 5, -3, 7, -6, -22, -16, 15, 16, 5, 12, 7, -2, 9, 16, -1, 6, 13, -4, -7, 13, 8, -15, 4, -4, -13, -21, 0, 1, -11, -13, -8, -16, 1, -20, -10, 30, 19, -7, 1, 21, 14, 6, 1, -4, 0, 1, -23, -33, -17, -30, -36, -29, -6, -28, -14, -18, 7, -15, 2, -22, -18, -6, -13, 32, -6, 5, 10, -7, 8, 7, -13, -16, -1, -21, -49, -37, -32, -16, -11, -8, -35, -19, -30, -22, -4, -17, -14, 3, -4, -18, 7, 30, 10, 7, -3, -2, -11, -32, -13, -23, -12, -18, -43, -24, -22, -34, -2, -7, -15, -3, -8, -34, -4, 7, -10, -3, -16, 9, -6, 23, -20, -24, -30, -32, -26, -35, -21, -40, -26, 2, -9, -3, 8, 6, -4, 7, -18, -2, -10, -13, -12, -9, -19, -19, 2, -1, -15, 17, -25, -24, -27, -30, -13, -2, -1, -1, 28, 32, 15, 8, -11, 5, 10, -18, -15, -24, 5, -10, 0, -10, -6, 9, -8, 2, 3, -7, -11, -20, -22, -17, -16, -13, 5, 27, 24, 31, 20, 16, -11, 2, -25, -14, 2, -14, -18, -27, -1, -11, -6, -22, -19, 3, 16, -21, -22, -23, -16, 21, 4, 11, -12, 1, 45, 24, 18, 1, -2, 2, -19, -11, -5, -16, -5, -15, -9, -15, 0, -9, 7, 8, -2, -19, -20, 14, -12, 20, 15, -10, 8, -4, 36, 36, 3, 17, -5, -14, 2, -8, 2, -11, 1, 8, -12, 3, -22, -9, -8, -4, 15, -9, -23, 18, 20, 2, -14, -21, 1, 2, 25, 36, 8, -9, 7, 21, 23, -6, 0, 11, -4, 16, 16, 2, -21, -7, -1, -21, 12, 0, 2, 22, 16, -10, 10, -20, 9, 6, 26, 8, -9, -6, 0, 4, 29, 37, 32, 26, 4, 11, 4, -11, -15, 10, -11, -2, -3, -12, -8, 20, -12, -7, -14, -40, -24, -5, 10, -28, -29, -3, 0, 12, 25, 9, 24, 17, 21, 24, 19, -5, 10, -15, -7, -8, 21, 21, 14, 3, 12, -7, -15, -31, -13, -20, -27, -43, -18, -9, 8, 3, 9, 42, 18, 41, 23, 1, 18, -5, -14, -11, -17, -21, 0, 1, 6, 26, 20, 19, 17, -3, -1, -4, -12, -6, 7, 12, 21, 6, 27, 16, 27, 31, 39, 18, -14, 7, 4, -23, -13, 14, 2, 8, 18, 10, 41, 20, 27, 11, 26, 1, 0, -4, 24, 16, 18, -1, 24, 27, 14, 37, 31, -10, 8, 6, -5, 5, -4, 16, 14, 1, 3, 14, 29, 25, 32, 26, 16, 36, 19, 29, 12, 19, -2, 25, 19, 37, -1, 26, 3, 7, -7, 0, -22, -1, 2, 2, 8, 5, -3, 7, -2, 9, -11, 20, 12, 19, 13, -5, 9, 13, 16, 1, 0, -1, 10, -15, 5, -9, -13, -23, -5, -4, 5, -2, -4, 29, -12, 0, -3, -24, -6, -12, 1, -4, -24, -27, 5, -18, -12, 5, -10, 13, -24, -11, -3, 0, -17, 9, -8, -10, 4, 11, 5, -6, -16, -13, -13, -9, -10, -17, -26, 4, 4, -7, -22, -25, -17, -12, -17, -8, -10, -29, -18, -7, 5, -23, -17, -12, -11, -18, -23, 5, -10, -17, -13, -19, 11, -2, 14, 17, 3, -6, -3, -1, 0, -4, -19, -30, -13, -15, -22, -1, -3, -6, 8, -3, -4, -24, -13, 1, 9, -8, -1, -6, -25, -20, -7, -5, -23, -24, -24, -17, -19, -12, -2, 4, -14, -1, -4, 7, 8, -5, -10, -18, 8, -7, -11, 5, -21, -7, -12, -6, -24, -16, -15, 6, 4, -10, -11, -14, -23, -20, 3, -6, -2, -13, -17, -21, -19, 9, -8, -1, -6, 0, 1, 12, 17, 3, 20, 14, -10, -9, 9, 8, 1, -8, -4, 14, 11, 11, -7, -4, 0, -8, -4, 21, 7, 17, 8, 2, 19, -5, 7, 14, 8, 22, 1, 0, 5, -5, -3, 17, 14, -11, 16, -2, -1, 22, 19, 7, 17, 6, 6, 5, -4, 11, 12, 0, 13, 13, 19, 1, 9, 17, -1, 8, 13, 2, 19, 2, 8, -3, -5, 11, 18, 15, 9, 10, 5, 20, 20, -3, -9, -10, 16, -12, -12, 1, 21, 15, -12, -3, -13, -5, -29, -26, -18, -43, -59, -30, -12, -30, 15, 30, 37, 32, 38, 44, 23, -8, 12, 13, 17, -8, -11, 20, 15, 12, 10, -2, 5, -40, -21, -44, -54, -47, -46, -38, -20, -6, -19, 12, 32, 25, 30, 14, 38, 27, 15, -4, 13, 19, 2, -4, 19, 12, 8, -2, -13, -31, -37, -47, -51, -50, -45, -25, -12, -39, 13, 21, 17, 26, 5, 18, 42, 13, 26, 13, 5, 21, 2, 18, 13, 8, -16, -20, -11, -30, -57, -73, -61, -33, -16, 2, 24, 2, 19, 40, 31, 54, 20, 24, 27, 26, 21, 23, 22, 8, -2, -5, 11, 12, -25, -8, -36, -38, -52, -62, -55, -3, 7, 13, 22, 43, 29, 38, 23, 50, 48, 40, 44, 34, 11, -7, 13, -2, -6, -13, -11, -17, -16, -32, -34, -39, -62, -54, -22, 18, 19, 29, 26, 26, 6, 18, 5, 9, 25, 4, 5, 20, 19, 4, -4, -11, -4, 2, -11, -5, -14, -45, -48, -49, -62, -27, 36, 30, 51, 32, -11, -5, -20, -8, -2, -11, 15, -8, 14, 55, 49, 30, -11, 4, 15, -2, 6, 0, -23, -43, -54, -52, -38, 21, 22, 45, 25, 18, -12, -44, -14, -22, -20, -34, -18, 5, 34, 57, 20, 19, 18, 12, 8, 11, 3, -17, -38, -70, -77, -55, -30, 11, 21, 41, 18, 24, -13, -32, -22, -11, -29, -35, -27, -11, 31, 33, 18, 19, 14, 20, 15, 10, 1, -14, -25, -51, -44, -42, -16, 22, 18, 24, 27, 22, 27, -15, -16, -33, -45, -19, -47, -18, -10, -6, -18, 11, 9, -11, 7, -1, 13, -16, -37, -53, -29, 12, 4, 13, 16, 41, 40, 13, 28, -6, -14, -45, -25, -33, -46, -61, -36, -41, -22, 7, 10, 21, 1, 18, 9, -4, -26, -32, -18, -17, -9, -9, 22, 11, 34, 24, 19, 11, -20, -46, -41, -34, -43, -57, -56, -37, -27, -21, -10, 12, 0, -6, 8, -7, -18, -22, -19, -20, -2, 8, 9, 2, 25, 25, -2, -1, 11, -19, -32, -15, -56, -59, -43, -37, -5, -3, 15, 2, 1, -2, -4, -4, -10, -16, -9, -16, -33, -3, 12, 2, -5, -5, 16, -6, -4, -6, -31, -29, -69, -55, -29, -25, -31, -22, 3, 7, 12, -11, -12, 9, -6, -6, 16, -20, -10, 14, -13, -13, -7, -22, 23, 14, 20, -1, -41, -52, -52, -35, -21, -33, -25, -20, -8, 10, 0, -1, -9, -27, -2, 12, 20, 5, 2, -8, 19, -1, -18, 16, 33, 33, 6, -11, -42, -63, -59, -49, -37, -40, -12, 7, 6, -6, 7, 2, -38, -34, -7, 16, 14, 5, -5, 25, 11, 11, -2, -7, 35, 37, 16, 0, -46, -38, -46, -30, -28, -8, -9, 1, 12, 13, 3, -1, -35, -52, -30, -12, -18, 8, 14, 2, 23, 5, 6, 0, 17, 9, 3, -31, -54, -60, -50, -45, -4, 6, -1, 5, 8, -12, 17, -6, -29, -18, -33, -11, -1, 5, 6, 10, -1, 30, 31, 4, 12, -12, 2, -25, -50, -59, -35, -37, -12, 6, 2, 2, 13, -9, 13, 4, -16, 7, -30, -36, -8, -17, 15, 5, 25, 34, 25, 21, 21, -12, -12, -55, -48, -39, -11, -2, 16, -8, 11, -2, 8, 7, -8, 3, 7, -18, -26, -24, -13, -4, 17, 13, -2, 28, 5, 2, 9, -4, -32, -57, -27, -32, -3, 0, -5, -11, -12, 3, -7, 14, 7, 21, -3, -9, -8, -33, 7, 10, -7, 14, 0, 28, 28, 11, 23, 28, -34, -22, -29, -7, -2, -8, 9, -7, 11, -1, 9, 0, 16, 2, 2, -1, -6, -13, 1, -7, -9, 4, -7, 3, 5, 26, 5, 38, 23, -6, 10, 20, 8, 2, 20, 12, 2, -12, -4, -1, 3, 3, -6, 18, -3, 19, 23, -8, 1, 15, 13, 17, 25, 26, 28, 6, 29, 24, -7, 20, -3, 6, 22, 18, 8, -2, 17, -12, -12, 8, -12, -9, 15, -11, 10, 0, -10, -12, 16, 12, 1, -3, 17, 20, 16, -5, 9, 20, 19, 13, 2, 18, -8, -8, -5, -21, -6, 6, -3, 9, -15, 4, -21, 10, 8, 8, -10, -7, 7, 9, 0, -8, -12, -2, -14, 0, -7, -13, -16, -3, -9, -7, -22, -23, -4, 4, 7, -18, -6, -13, -13, -9, -6, -6, -20, -7, 7, -18, -1, -21, 5, 3, -3, -18, -8, -2, -7, 0, -16, 2, 0, 7, -6, -12, -7, -7, -11, -15, 4, 0, -11, 0, -17, -26, -36, -38, -16, -21, -21, -7, -14, -15, -7, -17, 8, -14, -3, -17, 8, -13, -5, -1, 3, -1, 6, -10, 9, -7, -21, -5, 9, 9, -15, 3, 12, 14, 16, -19, -6, 3, -14, -4, -22, 9, -6, -20, -4, -11, -18, -9, -14, 1, -6, 3, -14, 6, -1, 13, 34, 2, -18, 5, 4, 6, 9, 14, 1, -12, -22, -11, -15, 12, -18, -8, 4, 7, -6, -12, 8, -15, 5, -15, 11, 21, 6, 13, 15, -4, -2, 3, -25, -26, 3, -4, 2, -15, -31, -8, -42, -11, 13, 6, 3, 1, 3, -14, 12, 11, -3, -9, 14, 28, 14, 20, 25, -2, 7, 14, 0, 18, -7, -5, 3, -9, -2, -16, -9, -22, 2, 7, -2, -14, 11, -3, -1, -16, -11, 20, 6, 10, 30, 7, 12, 27, 1, 25, 15, 1, 14, 9, -4, 17, -15, 21, 17, 13, -13, -15, -2, -14, 0, -14, 7, -4, 4, -1, 8, 13, 9, 31, 11, 20, 19, 25, 29, 29, 7, 8, 7, 2, 0, 29, 16, 23, 24, -9, 9, -9, -1, -5, -4, -6, -1, 25, 9, 30, 11, 17, 23, 24, -4, 20, 23, 27, 40, 6, 6, 25, 11, 39, 20, 33, 26, 1, 6, -16, -6, 10, 7, 16, 22, 25, 10, 9, 31, 4, 23, 19, -5, 29, -1, 35, 17, 11, -10, 36, 11, 23, 19, 19, 25, 19, -9, -3, -2, -15, 5, -4, 16, 28, 2, 14, 12, 4, -4, 9, 10, 6, 16, -6, 26, 25, 14, 1, 11, -4, 8, -6, 7, -14, 5, -4, -11, -9, 18, -9, 11, 3, 21, -15, -21, 12, 19, -2, 21, 11, -7, 5, -4, 10, 1, -11, -4, -14, 3, -11, -9, 17, 10, -12, -19, -16, -4, 12, 16, 4, -8, -14, 7, 7, 14, -4, 10, 4, -21, -36, -14, -6, 2, 20, -16, -26, -23, -11, -13, -18, 3, -2, -19, 3, 12, -12, 6, 17, 1, -3, -22, -3, 6, -10, -16, -11, -27, -18, -11, 23, -6, 30, -4, -5, 11, 17, -13, -22, -3, -17, -10, -3, -9, -8, 8, 6, -5, -21, -28, 1, -2, -5, 0, -17, -20, -18, -13, 22, 34, 39, 29, 28, 13, 15, -12, 0, 8, -20, -9, 1, -12, -1, 4, -31, -33, -16, -15, -34, -35, -21, -32, -31, -9, -27, 8, 19, 16, 16, 27, 10, 30, -5, -1, -1, -5, -22, -20, -4, -12, 14, 18, 10, -21, -14, -16, -26, -18, 4, -9, -29, -29, -14, 23, 20, 10, 25, 11, 1, 29, 7, -23, 5, 0, -23, 10, -21, -6, 13, 0, 4, 0, 6, -19, 6, -20, -27, -22, -15, -6, -9, -2, 16, 22, 23, 10, 10, 15, -2, -12, -4, -8, -1, -15, 5, 3, 8, 4, 17, 5, 11, -18, -14, -13, -6, -24, -11, -22, 8, 4, 8, 20, 14, 0, -14, -17, -17, -8, -6, -23, -21, -20, 1, 10, -1, 39, 24, -1, 7, 17, 3, -16, -7, -15, -28, -29, 3, 11, -17, -13, -13, -1, 9, 5, -1, -23, -12, 9, 3, 6, -13, -9, -17, 21, 21, -13, 3, -7, -15, -2, -22, -19, -1, -6, -9, 9, -11, -29, -14, -30, 1, -5, -7, -21, -12, 10, 7, -19, -13, -17, -26, 1, -13, 6, 5, -5, -18, 6, -3, -5, 9, 13, 2, -8, -20, -13, -39, -27, 6, -6, 5, -19, -14, -19, -21, 5, -1, 11, -6, 13, 28, 14, 5, 17, 6, 31, 11, 17, 16, 24, 25, -1, -28, -46, -25, -37, -7, -3, 8, -13, -22, 6, -18, -23, 9, -2, 0, 19, 11, 26, 21, 2, 22, 13, 40, 36, 31, 32, 20, 20, -14, -16, -25, 0, 3, -13, 2, 3, -8, -17, 10, -16, -16, -7, -11, 0, 16, 14, 3, 7, 25, 48, 44, 49, 29, 36, 36, 32, 17, 20, 11, 16, 6, -4, -2, -10, -15, 9, 4, -10, -18, -16, -5, -18, -15, -14, 14, 13, -10, 3, 17, 34, 25, 28, 28, 23, 2, 3, 6, -13, -1, -6, 5, -21, -6, 11, -13, -1, -12, -12, -5, -7, -5, 9, 2, -9, 1, -8, -8, -6, -17, -1, -4, 9, -15, -4, -7, -11, -21, -16, -20, 9, -16, 12, -3, 8, 5, 10, 11, 11, 1, -15, -3, 11, -19, -10, -18, 3, 0, -18, -10, -5, -10, -5, -17, -5, -21, -8, -19, -13, 7, -9, 11, -15, -17, 12, -22, -21, -4, -16, -9, -22, -6, 9, -5, -12, 0, -11, -13, -16, 9, -7, -6, -13, -1, -22, -12, -22, 4, 0, -6, 6, -2, -22, 4, -16, -12, -8, -16, -19, -12, -5, -1, -16, -21, -4, -6, 2, -9, 7, -26, -26, -16, -8, -18, -22, 9, -16, 7, -22, 0, -1, -7, -13, 2, -21, -1, -9, -13, -22, -17, -31, -28, 9, 1, 13, 15, -14, 13, 5, 2, -23, 4, 11, -14, -6, 3, 1, -11, 6, 4, 10, 0, -16, -20, 12, 19, 35, 23, 22, 15, 14, 12, 6, 24, -3, 12, 15, 4, 18, -7, -7, -23, -9, 1, -2, -2, 10, 4, -4, -11, -1, -4, 14, 5, 13, -3, -3, -10, 5, 2, 23, 17, 30, 30, 11, 20, 9, 24, -13, -17, -9, -20, 3, 0, -3, -6, 24, 26, 20, -1, 1, 14, -9, 1, -4, -29, -44, -14, -16, 11, 8, -5, 22, 23, 34, 9, 0, -8, 7, -23, -5, -10, -19, -10, 13, 20, 12, 18, 22, -8, -11, -29, -12, -26, -48, -25, -5, 8, 7, -1, -8, 10, 12, 23, 4, -16, -9, 3, 2, 9, -16, -6, -1, 23, 4, -8, 11, 17, 3, -19, -3, -32, -31, -32, 0, 1, 6, -9, 16, 12, 7, 47, 28, 0, -1, -16, -19, -8, 4, 7, 12, -5, 8, -1, 8, -10, -13, -9, -32, -31, -32, -28, -13, -8, -2, 1, 9, -1, 10, 12, 31, -13, 10, 1, -16, 2, 0, -17, 13, 6, 1, -1, -5, 3, 5, -15, -25, -55, -22, -4, -10, -14, -19, -8, -16, -11, -6, 23, 13, 2, -19, -4, 10, -1, -26, -20, -6, 0, -8, 12, -2, -12, -10, -9, -28, -24, -28, -1, -30, -8, -13, -18, -31, -48, -11, 8, 14, 17, -5, 4, 10, -16, -11, -20, -23, 4, -2, -20, -2, 21, 26, 9, -7, -20, -11, -22, -13, -22, -21, 5, -30, -22, -33, -19, -21, -22, -8, -14, -19, 0, 2, -7, 3, 9, -8, 20, 5, 8, 9, 18, -1, -3, 15, -13, 0, 2, 3, -22, -11, -32, -47, -47, -20, -1, -13, 0, 10, 1, -15, 9, 6, 3, 26, -4, -11, 17, 0, 11, 23, 21, 19, 12, -15, 6, -6, -19, -4, -33, -6, -3, 5, 0, 4, 2, 0, -6, 8, 15, 13, 12, -1, 0, 17, 4, -16, 11, 30, 8, 18, 0, -9, -7, -12, -31, -28, -17, -22, 5, 0, -19, 11, -6, -13, 8, -5, -22, -5, 2, -7, -11, 1, -36, -18, 3, 35, 11, 3, 16, -4, -14, 20, 8, 9, -15, 0, -10, -2, 9, 5, -7, -10, -21, 4, 21, 13, 16, 5, -8, -20, -41, -19, -2, 7, -2, -10, 13, 12, 24, -3, -1, 10, -15, 3, -12, -2, 7, 1, -6, -11, 5, 7, 15, 26, 21, 1, -3, -27, -22, -9, 3, -15, -5, -9, 7, 12, -15, 17, 14, 2, 5, -3, -6, 3, 2, -18, -15, -12, -8, 22, 5, 36, 17, -13, -1, -1, -16, -25, -27, 4, 4, 1, 26, 7, 9, 15, 11, 5, 23, -1, 0, -12, -17, -13, -17, -9, -4, -3, 17, 19, 25, -7, -12, -5, -22, -22, -10, -8, -15, -11, 21, 13, 6, 3, 22, 34, 29, 21, 2, -3, 4, 11, -5, -15, -17, -10, 30, 5, 28, 11, -12, -17, -24, 5, -13, -28, -7, -4, 20, 1, 22, 29, 24, 16, 19, 27, -19, -16, -1, 4, 2, -7, -6, 7, 22, 23, 22, 11, 6, -1, -10, -22, -6, -1, -1, 5, 2, 14, 9, 13, 37, 48, 29, 19, -7, -15, -17, -19, -20, 6, -1, -11, -10, -10, -3, -3, 31, 29, 16, 25, 0, 19, 10, 13, 17, 0, 8, 15, 39, 10, -4, -11, -11, -6, -6, -15, -23, -12, 3, -13, -22, -23, -1, -1, 14, -1, 10, -1, 18, 29, 19, 21, -6, 3, 18, 24, 5, 3, -2, -18, -9, -14, 1, 9, -10, -13, -11, -10, 1, -33, -27, -18, -16, -3, 2, -21, 2, 0, -18, -9, -29, -8, -23, -22, -36, -17, 11, 5, -15, -19, 11, -19, -10, 8, 1, -5, -22, -14, -22, -20, -31, -35, -29, -32, -36, -41, -32, -38, -34, -24, -19, -26, -15, -3, -13, -2, -2, -21, 6, 2, 2, -14, -2, -6, -8, -3, 7, -6, -11, -21, -16, -9, -15, -2, 1, -19, -4, -24, -8, -22, -7, -3, -9, -22, -1, -22, 8, -3, 5, 12, -2, -18, -5, 16, 8, -17, 14, 2, -14, -12, 0, -16, -15, 10, 1, 10, -7, -10, -4, -11, 8, -12, 15, 13, -11, -16, 5, -6, 12, 0, -5, -14, 1, 5, 10, -4, -1, -1, 18, 12, 15, -10, -10, 17, -2, -2, -12, -18, -18, 12, 11, -18, -15, -7, 16, 1, 11, -1, 7, 7, 4, -13, -3, 2, 2, 22, -5, -2, -4, 23, 32, 17, 23, 7, 9, -10, -3, 7, -17, -18, -13, -11, -2, -5, 8, -15, 8, 14, -12, -10, 0, 1, -3, 3, 14, 22, 3, 21, 15, -1, 23, 3, 30, -4, -7, 4, -4, -16, -14, -9, -1, 13, 14, 5, 2, -7, 4, -11, -23, -10, -21, -5, -23, -1, 3, 17, -8, -15, -30, -2, -3, 12, 4, 6, 3, -12, 13, 10, -13, 6, 13, 9, -5, -18, -9, -28, -3, 4, 23, -9, 7, -3, -23, -4, -26, -34, -16, -26, -14, -31, 7, 29, 25, 26, 1, 0, -14, -1, 11, -17, -15, 0, -11, -2, 1, 13, 11, -8, 2, 8, -11, 2, -21, -33, -31, -10, -10, -5, 12, 2, 22, 8, 16, 12, 5, -12, 8, 0, -6, 13, 7, -15, -11, 9, -6, 16, -1, -5, 11, -1, -13, -8, -19, 5, 5, 19, 13, 17, 26, 28, 23, -16, -11, -15, -10, 1, -25, -22, -29, -25, -2, -3, -10, 16, -21, -15, -29, -9, -29, -10, -17, -18, 5, 30, 14, -3, 29, 18, 24, -15, 11, -7, 5, -27, -30, -22, -4, 10, 9, 1, 12, 9, 15, 2, -28, -24, -25, -32, -15, -22, -9, 3, 17, 0, 40, 42, 0, -13, -1, 15, -1, -31, -19, -35, -10, 24, 21, 16, -9, 8, -18, -26, -47, -53, -61, -32, -13, -7, -3, 18, -15, 3, 4, 24, 16, -15, 12, 10, 2, -20, -36, -15, -5, 27, 34, 1, -6, -3, -3, -2, -20, -1, -29, -31, -4, -9, 9, 20, 3, -22, 5, 12, 13, -12, 3, 0, -5, -15, -10, -16, -9, 27, 40, 25, 33, 18, 35, 30, 11, 19, 1, -17, -41, -9, 0, -17, -2, -15, -27, 4, 2, 4, 7, 0, -9, -16, -13, -20, 20, 33, 30, 17, 29, 39, 31, 45, 35, 31, 6, -16, -32, -17, -30, 0, 2, -22, -18, -31, 4, -3, 2, 2, 8, -21, -14, -14, 25, 15, 43, 48, 49, 45, 19, 39, 42, 19, 16, 20, -3, -22, -13, -19, -6, 9, 1, -33, -15, -6, 11, -5, -9, -16, -25, -21, -33, 2, 17, 17, 47, 39, 47, 16, 8, 18, -6, -19, -9, -4, -25, -4, 14, -2, -5, -6, -18, 16, -16, 8, 4, -12, -7, -55, -74, -48, -29, -31, -23, 37, 18, -11, -7, -5, -17, 0, -9, -5, -13, -3, 15, 28, -2, 8, -7, -1, 3, 13, 3, 4, -21, -43, -62, -71, -42, -44, -55, -33, -45, -62, -16, -24, -11, -7, -5, -12, -18, -15, 19, 21, 3, -10, -20, -4, 3, 9, 1, -2, 7, -17, -34, -29, -56, -51, -67, -82, -64, -55, -24, -1, -5, 8, -6, -11, 11, -8, -1, -1, 9, -18, -6, -11, 7, -6, -5, 18, 3, -7, -6, -14, -35, -37, -26, -35, -50, -18, 8, 3, 14, 5, -13, 12, 12, -7, 18, 1, 21, 8, 0, -7, -15, 13, 9, -9, 7, -13, -13, -11, -10, -10, -23, 5, -10, 1, 22, 5, 16, 20, 4, 16, -14, -12, 9, 20, -6, 2, 4, 2, -18, 15, -11, 17, 22, -4, -11, 2, 16, 12, 9, 4, 15, 18, 19, 11, -11, 15, 15, 2, 6, 10, 26, 6, 9, 16, 16, 6, -1, 5, 11, -13, 20, -18, -3, 22, 15, 15, 6, 15, 19, 11, 2, -5, 13, 6, -11, -11, 1, 2, -2, 0, 7, -8, 13, 10, 3, 14, -9, -3, 26, 16, 20, 23, 26, 49, 45, 26, 26, -1, -7, 9, -15, -14, -9, -10, -16, -9, -9, 7, -12, -7, 14, 9, -7, 5, -7, 2, -5, 14, 29, 15, 46, 38, 56, 36, 31, 32, 25, 2, -18, -21, -19, -3, 11, 6, 21, 25, 8, -12, 12, 9, 9, 9, -5, 12, -8, 18, 4, 16, 1, -2, -10, 5, 3, 7, -13, 7, -13, -21, -10, -17, -10, 22, 16, 15, -7, -2, 0, 13, -5, 1, -9, -4, -13, -7, 3, -5, 3, -9, -13, 13, -4, -4, 5, 10, -17, 12, 6, -6, -15, -7, -15, 12, -17, -18, -14, 0, 14, 5, -12, 10, 7, -3, 8, -6, -18, -12, -11, 3, -13, -18, 14, -14, -13, -12, -8, -13, 0, -21, -11, 15, 0, -8, 7, -2, -16, 11, -15, -10, -4, -7, -4, -6, -16, 8, -10, 1, 4, 2, -19, 12, -5, -5, -15, -7, -7, -11, 6, -17, -14, -5, 7, -5, -11, 6, -3, 10, -18, -18, 9, -12, -6, -12, -3, 10, 5, 3, -2, 4, -19, -11, -14, -20, -4, 11, 0, 2, 9, 9, 0, -19, -19, 10, 6, -8, -2, 2, 2, 5, -1, -22, -11, -7, 1, 1, -10, -14, -5, -18, 8, -15, 14, -6, -1, -20, -17, 13, -13, 3, 8, 6, -2, -5, -18, -20, -8, -24, -25, -18, -4, -4, -33, -9, -28, -21, -4, -7, -5, -7, 0, -12, -7, -11, 13, -4, 8, -14, 4, -12, 0, -20, -7, 2, -1, -3, -12, -24, -10, -4, -28, -17, -47, -35, -20, -45, -24, -12, -24, -20, 7, -21, 2, -13, 7, -13, -10, -5, 9, 10, -5, 7, 3, 12, -21, -18, -16, -36, -24, -25, -32, -19, -20, -28, -17, -30, -9, -36, -33, -22, -12, 5, 2, -1, 13, 0, -11, -13, -12, -8, -1, -23, -15, -23, -25, -29, -37, -21, -15, -13, 2, -29, -2, -36, -13, -18, -26, -8, -6, -9, 5, -12, -18, 8, -3, 5, -9, -21, 0, -5, 10, 4, 7, -15, 20, 14, -6, -14, 10, 9, -7, -19, 5, -9, 6, -9, -16, -15, -1, 8, -3, -20, 0, 6, 5, -19, -10, 10, 12, 13, 28, 16, 6, 16, 18, 12, -11, -5, 3, -25, 1, 19, 10, -17, -16, 4, -24, 6, -11, 3, -10, 7, -10, -8, 7, 29, 29, 30, 31, 38, 28, 26, 14, 12, 8, -7, 3, -8, 0, -6, 16, 16, -6, 1, -5, 1, -8, 4, 1, -5, 15, 14, 32, 39, 36, 8, 31, 15, 34, 25, 22, 17, -12, 1, -22, 5, -5, 19, -8, -20, -20, -4, 1, 14, 7, 3, 15, 22, 3, -1, 28, 15, 20, 6, 12, 12, -1, -19, 7, 3, -26, -15, 10, -22, -2, -3, 17, -5, -39, -16, -15, -4, -16, 11, 14, 4, 6, 0, 26, 29, 5, 11, 2, -15, -34, -24, 15, 0, -6, 17, -6, -1, 15, -14, 13, -14, -48, 4, 11, 2, 8, 10, 10, 5, 15, -17, -14, 10, -5, -28, -19, -46, -32, -15, 34, 28, 4, 24, -2, -4, 5, 13, -13, -38, -46, 6, -1, -18, -1, -8, -12, 3, 2, -26, -5, -4, 7, 4, -10, -26, -5, 0, 8, 42, 35, 11, 23, 13, 5, 5, -16, -32, -35, -13, 7, -14, 13, -2, -11, 1, -14, -24, 5, -12, 9, -8, 11, 11, 10, 6, 23, 3, 24, 16, 8, 32, 17, 19, 0, -18, -32, -10, -20, -7, 13, 2, -21, -2, 2, 8, 9, -4, 4, 13, 7, 1, 6, -1, -20, -2, 10, 11, 1, 20, 0, 10, 2, -1, -26, -6, 7, 12, -10, -17, -9, -20, -9, -11, 8, 6, -6, -19, -11, -33, -4, -38, -12, 2, -2, 22, 8, -1, 9, -17, -14, -7, -9, -5, 4, -2, 10, 6, -4, -20, -6, -14, -18, -10, -16, -39, -41, -38, -49, -49, -36, -27, -12, 15, -22, -18, -1, -12, -3, -22, -12, -15, 4, -10, -12, -5, 0, -1, -26, -29, -40, -47, -51, -37, -41, -46, -67, -60, -9, -7, -7, 2, -18, -2, 3, -13, -21, -32, -17, -17, -5, -8, 9, -13, -17, 9, -21, -5, -27, -27, -45, -32, -45, -72, -74, -20, -9, 1, -27, -29, -18, 5, -12, -12, -21, -23, 1, -2, 4, 5, 6, -7, 6, -1, -6, -24, -4, -34, -24, -25, -37, -18, -23, -25, -14, -2, 4, -31, -12, -5, -15, -15, -15, -19, -4, -9, 7, -8, 6, 13, 9, -15, 2, -10, -23, -20, -2, 1, 15, 16, -16, -3, 3, 8, -13, -12, -7, -31, -4, -7, 2, 3, -15, -14, -16, 11, 2, 3, 11, -4, 2, 6, 9, 23, -8, 2, 4, -1, -2, -19, -5, -5, -8, -2, -37, -18, -18, -32, 5, 8, -6, -11, -10, -9, 12, 8, -4, -14, 8, 44, 28, 36, 12, 12, 0, 2, -21, -24, -12, -22, 9, 12, -27, -41, -20, 17, 9, -10, 10, -20, -14, -4, -11, 1, -6, -9, -11, 22, 28, 25, 32, 22, 30, 26, 40, 22, 30, 10, 19, -6, 15, 1, 5, -6, -12, -14, -7, 2, -13, -20, 10, 8, -9, -7, 1, -14, 20, -11, 18, 38, 41, 36, 12, 35, 42, 37, 23, 10, 29, 3, 3, 11, 8, -2, -7, -4, -4, -13, -18, 5, -6, -13, 0, -13, 6, 8, -1, 15, -15, 0, 3, -5, -9, 15, 7, 15, 3, 12, -6, 5, -13, 11, -13, 1, 3, -3, -1, 17, -10, 20, -2, 1, -11, 7, 2, 10, 3, 21, 8, 19, 11, 16, 2, 17, 5, 9, -11, 4, -7, -1, -3, -9, -8, 19, -9, 16, 9, 7, 6, 17, -11, 6, 4, 11, 7, -2, 2, 7, -1, 18, 14, -4, -7, 18, -4, 13, 3, 2, 13, -8, 10, 19, -13, -11, 9, -1, 14, -12, 21, 1, 20, 18, 7, 15, 25, 12, -2, -7, 19, 13, -1, 24, -3, 17, 17, 9, 6, -2, -8, -3, 0, -1, 10, 3, -4, 4, 9, 3, -15, -11, -11, -5, 20, 22, -4, -12, -14, 5, 5, 18, 26, 10, 25, 18, 2, 6, 15, 3, 13, 1, -3, -2, -5, -18, -23, -15, -15, -21, 5, 12, -9, 0, -23, -15, -9, 11, 1, 10, 15, 37, 29, 43, 13, -7, 0, 3, -3, 12, 14, -11, -17, -24, -24, -42, -38, -34, -31, 14, 4, 9, -20, -19, -22, 3, -9, 0, 19, 4, 21, 32, 34, 3, 1, 22, -6, -9, -5, 8, -17, -5, -52, -28, -17, -26, -22, 5, 10, -14, -15, 2, 6, -2, 2, 40, 23, 29, 26, 26, 33, 19, 7, 7, 0, -14, -7, -19, -27, -38, -38, -44, -12, -8, 14, -3, -15, 8, 1, 9, 19, 38, 44, 34, 53, 45, 42, 42, 36, 21, 9, -13, -7, 2, 1, -12, -21, -25, -27, -36, -5, 1, 0, 20, 10, 7, 4, 16, 13, -2, 9, 16, 11, 49, 23, 36, 41, 33, 27, 15, 11, 16, 16, -14, -36, -19, -17, -25, 20, 3, 12, 17, 3, -28, -41, -40, -23, -36, -24, -28, -19, 7, -5, -3, 49, 23, -4, -2, 6, 5, 7, -3, -16, -20, -25, 13, 3, 37, 34, 31, -8, -15, -31, -33, -60, -49, -66, -58, -51, -46, -19, -14, 25, 38, 20, -4, -9, -1, -7, -1, -9, 0, -17, 27, 20, 28, 18, 22, 24, 5, -25, -21, -36, -34, -33, -49, -48, -35, -29, -29, -12, 14, 3, -12, -10, 12, 15, -19, -6, -18, 12, 2, 26, 19, 21, 23, 24, 16, -21, -9, -12, -16, -47, -50, -35, -47, -31, -46, -12, 8, -7, 6, 20, 4, -3, -15, -12, 0, -16, 17, 15, 14, 11, 12, 41, 39, 18, -1, 5, -10, -5, 0, -5, -42, -18, -28, -25, -17, 14, -7, -8, -13, 10, 10, -18, -1, -3, 24, 24, 16, 28, 23, 28, 15, 24, 11, 2, -3, 0, 16, -2, -17, -20, -43, -34, -13, 8, 13, 3, 8, -8, -16, -14, -36, -11, -30, 5, 25, 18, 25, 30, 13, 15, 4, 18, -12, 7, 3, 11, -21, -6, -33, -19, -9, -10, 9, 13, 1, 12, -9, -25, -34, -25, -42, 0, -28, -4, 20, 32, 15, 12, 2, -5, -18, 5, -6, -1, -28, -17, -5, -28, -4, -16, 10, -8, 9, -6, 7, -12, -20, 3, -14, -26, -19, -3, 21, -5, -12, -6, 5, 4, 6, -3, -5, -8, -14, -24, -1, -1, -24, 5, 9, -7, -9, 17, -13, 3, -15, -5, 1, -4, 7, 19, 0, 3, 17, -12, -5, 6, 5, -14, 22, 0, -21, -24, -4, 0, 3, 2, 2, 11, 13, 2, -11, -5, -4, 19, -14, 2, -3, 0, 17, 30, -9, 0, 10, 1, -17, -7, -6, 12, 0, 2, -11, 15, -12, -14, 17, 8, 3, 19, -17, -4, -16, -13, -1, 10, -6, -1, -3, 4, -12, 4, 10, -12, -4, 24, 14, -2, -19, -1, -11, 14, -4, 17, -14, -6, -10, -11, -18, -1, 7, -32, 5, 0, 14, 3, -4, 12, -6, -1, 19, 3, -1, 19, 0, 17, 3, 17, -6, -6, 23, 20, -6, 15, 16, 2, 14, 11, 0, -41, -12, 2, 8, 5, 13, 14, 9, -4, -2, 13, 16, 23, 6, -11, -5, -6, 0, 4, -3, 16, -2, 6, -1, -2, -6, -4, 0, -13, -20, -6, 4, 0, -3, 16, 6, 11, 7, 21, 20, -10, 11, 1, -14, -10, 19, 7, 18, 1, 3, 0, 17, 1, 2, 12, -22, -3, 2, -7, 9, 26, 20, 13, 26, 42, 26, 13, 3, -1, 0, 6, -6, 17, -2, 15, 4, -14, -12, 2, 14, -5, 1, 14, 2, -5, -11, -3, 19, 24, 16, 32, 46, 27, 30, 45, 31, 7, 13, 15, 18, 12, 6, 2, 12, -4, 6, 4, -3, 10, 14, -5, -4, 21, -1, 3, 6, 3, 31, 16, 0, 26, 14, 7, 4, 10, 3, -11, -6, 4, -1, -1, 19, 20, 4, -4, 14, 18, 6, 20, -11, 18, 16, 19, 18, -11, -9, -4, 18, 21, -2, 7, -3, -12, 9, 20, -4, 13, -12, -4, 9, -10, -11, 13, -8, -3, 3, -17, 12, -18, -14, -5, -13, 13, -11, -2, 10, 5, 0, -21, 6, -17, -8, -14, -13, 8, 10, 5, 5, 3, 3, -4, -14, -3, 6, -15, 6, 4, 7, -17, -7, 0, -18, 1, -3, -5, -9, 4, 4, -19, 0, 6, 4, 5, -15, 2, -16, -10, 3, -2, -13, -13, 12, -9, -15, 8, -10, -7, -9, 7, -30, -33, -20, -3, 0, -13, -20, 4, -14, -14, -6, -9, -19, -14, 13, -3, -6, -6, 11, -5, -16, 0, -15, -23, -12, -18, -27, -6, -14, -26, -20, -15, -28, -19, -27, -30, -18, -21, -27, 2, -12, -14, 2, 5, 11, 0, -19, 13, -4, -3, 10, -15, 12, 16, -7, 10, 16, 12, 26, 23, 0, -11, -10, -19, 1, 6, -24, -9, -1, -3, 4, 10, 6, -10, -11, -6, -11, 10, 5, 13, -5, 2, 2, 17, -3, 1, 26, 6, 19, 13, -8, 11, 3, 14, 15, 2, -3, -6, -16, 3, -12, -7, 4, -10, -4, -2, 6, -8, -10, 1, -9, 9, -1, 12, 3, -8, -6, -5, -9, -6, 4, -21, -25, 16, 25, -16, -18, 9, -11, -6, -1, -9, -22, 7, 1, 9, -14, -26, -20, -9, -3, -4, 10, -13, -4, -6, 0, 26, 3, 12, 1, 17, 38, 0, 22, 11, -17, 11, -14, 5, -11, -1, -24, -23, -18, -19, -27, -15, -13, 1, 6, -2, -10, -1, 4, 13, 4, -11, 2, -14, 1, 25, 22, -17, 0, -6, -17, -10, -25, -14, -5, -1, -15, 0, 2, -2, -8, -20, 27, -12, -33, -16, 19, 16, 31, 24, 5, -21, 7, 15, -21, 5, 11, 10, 10, -10, -26, -13, 19, 10, -18, -18, 10, 4, -11, 15, -5, -41, -56, -51, 2, 6, 3, -2, -20, -3, 11, -16, -13, -12, 7, 6, -15, -10, -19, -6, 0, 13, 11, -17, -3, -3, -19, 6, -33, -44, -46, -58, -18, 22, 31, 2, -7, -11, 7, 11, -4, -9, -8, -11, 5, -13, -25, -19, 14, 28, 27, 0, -7, -5, -7, 6, -7, -35, -67, -53, -26, 8, 14, 22, 30, 23, -7, 2, -10, -6, 8, -15, 6, -22, -26, -8, -3, 4, 41, 42, 17, -12, 12, 10, -6, -18, -45, -36, 3, 27, 27, 52, 60, 30, 6, -7, 8, 12, -5, -7, -9, -5, -7, 15, 33, 15, 18, 40, 21, 20, 31, 30, -2, -33, -32, 2, 11, 29, 40, 36, 15, 1, -19, 7, 16, -5, 13, -4, -2, -6, 25, 11, -9, 10, 25, 66, 53, 35, 49, 20, -23, -12, -3, 16, 25, 43, 48, 19, -21, -23, -22, -31, -6, -11, -12, -5, 8, -22, 13, -10, -10, 36, 16, 56, 61, 36, 15, 6, 1, -30, -1, 45, 64, 45, 28, 8, 30, 3, -11, -17, 17, 22, -6, -3, -3, -20, -19, 2, 20, 46, 40, 51, 57, 17, -18, -8, -27, 3, 34, 31, 11, 17, 2, 8, 20, 1, -2, -23, 22, 7, -5, 1, 7, -1, -13, -6, 17, 55, 45, 51, 23, -15, -33, -35, -28, 8, 10, 29, 20, 14, -3, -14, -3, -21, -22, 10, -17, 13, -10, -6, -12, 2, -15, 0, 16, 61, 71, 63, 4, -46, -62, -55, -44, -11, 8, 36, -1, 43, 16, 9, -7, 0, 26, -8, -21, -5, 11, -14, 5, -2, 14, -8, 30, 40, 63, 25, 13, -30, -52, -36, -37, 1, 19, 33, 17, 3, 24, 16, 22, 26, 23, 7, -13, -11, 3, -1, 12, 17, 18, 14, 32, 40, 57, 22, -4, -19, -38, -6, -13, 15, -5, 7, 8, 3, 6, 21, 6, 41, 8, 5, -16, 2, 5, -19, 7, 16, 3, 5, 55, 71, 60, 36, 31, 21, 10, 2, -26, -36, -42, -32, -36, -24, 4, 26, 43, 24, 18, 2, 6, -12, 0, 9, 10, 12, -15, -16, 12, 34, 22, 35, 19, -13, 10, -10, -18, -39, -49, -40, -41, -27, 7, 4, 34, 31, 1, 7, -3, -2, 7, -4, 4, -8, -3, -12, -24, -11, 2, 36, 4, 10, 4, -2, 0, -20, -12, -34, -54, -39, -10, -28, -5, -6, 0, -10, -16, -1, -14, -9, -4, -1, -9, -28, -12, 3, -16, -17, -27, 7, -18, -8, -5, 16, -13, -12, -47, -45, -54, -9, -18, -32, 0, -6, -10, 13, 2, 8, -14, 11, -14, -7, 18, 18, -7, -7, -5, 1, -13, -9, -10, 16, -23, -17, -41, -29, -37, -11, -25, -2, -8, 9, -3, -18, -15, -14, 2, 9, -10, -16, -18, -16, 12, 4, 2, -20, -20, -8, -9, -19, -22, 9, -10, -18, 5, -16, 5, -7, -5, -4, 7, -2, -13, 4, 1, -5, -19, 6, -2, 7, -7, -5, -6, 1, 5, -17, -25, 4, -22, -22, -11, 4, -26, -8, -13, 7, 2, -20, -1, -11, -20, 8, -5, -21, -23, -1, 6, -3, -1, 9, -10, -6, -9, -9, -19, -10, -11, -13, -3, -12, -9, -22, 7, 3, -4, -1, 0, -25, -16, -13, -2, -1, -10, -4, -19, -18, -24, 12, -9, 11, -6, -10, 2, 2, -1, 0, 7, -13, 5, -2, -14, -24, -24, -8, 8, -19, -8, 1, 1, -13, -12, -10, -17, 9, 17, 16, 7, 29, 20, 14, 13, 35, 28, 12, 6, 19, 19, 14, -2, 1, 5, -7, -20, -5, 0, -16, -24, -3, -18, -21, -7, 11, 33, 28, 11, 34, 33, 10, 18, 5, -9, -1, -4, 18, -8, -19, -21, -2, -19, -7, -8, -25, -1, 8, -18, -1, -8, 14, -12, 7, 6, 10, -9, 9, 4, 4, -7, 5, -10, -1, -9, 10, 23, -6, -17, -25, -23, -19, -17, -23, 3, -7, -7, -13, 8, -14, -5, -14, 11, 10, -5, 12, 17, 7, 20, 9, 7, 22, 20, -1, -8, 5, -26, -32, -42, -34, 3, -18, -11, -6, -23, -1, -9, 1, -13, -8, 6, 13, -11, -13, 8, 24, -1, 32, 27, 0, -7, -4, -19, -13, -19, -46, -50, -34, -9, -13, -14, -8, -19, -18, -11, -16, -27, -18, -20, -1, -23, 10, -5, -7, 6, 15, -7, -6, -12, -17, -16, -20, -20, -3, -42, -44, -24, 1, -20, -10, 5, -6, -1, 4, 5, -4, -1, 14, 1, 6, 2, -21, 4, 1, 16, 19, -8, 4, 18, 6, 9, -10, -15, -7, 0, -19, -26, 7, -3, -17, 2, -16, -9, 19, 18, 4, -13, -14, -9, -23, -25, 0, -8, 17, 12, 6, 2, 20, -16, -16, 13, -10, -7, -7, -23, -1, -16, -4, -7, 5, -9, 2, 11, 1, -25, -25, -21, -32, 5, 5, 20, -10, 14, 10, 0, 30, 19, 10, -3, 18, -11, -23, 4, -7, -6, -25, -1, 5, 16, -8, -13, -30, -13, -16, -27, -20, 1, 12, 14, 11, -8, 20, -1, 13, 9, 1, -2, 15, 5, -17, 5, -22, -22, -30, -12, 3, -2, -1, -17, -15, -11, -20, -22, 3, 27, 31, 4, 15, 7, 9, -14, -11, -1, -18, 6, -1, -23, 3, -24, -14, -16, -2, -12, -31, -10, -19, -7, -10, -9, -8, -22, 10, 37, 22, 24, 11, -23, -10, -37, -25, 9, -12, -20, -16, 2, -19, -25, -14, -12, 1, -9, 12, -1, -2, -15, -19, -28, -7, -8, 8, 20, 22, -3, 15, -9, -2, 7, -9, 6, -17, -3, 6, 14, -6, 0, 6, -24, 3, -4, 26, -7, -7, -32, -31, -18, 10, -5, 12, 3, -9, -19, -7, 8, -1, 17, -13, 12, 1, 30, 15, 22, -11, -13, 0, -17, 8, 5, 27, 10, 4, -12, -17, -22, -20, -10, -17, -31, -41, -6, -3, 13, -1, 23, -8, 3, -9, -3, 7, -4, 12, -3, -24, 5, 6, 24, 7, 1, 10, 13, 1, -24, -14, -16, -18, -11, -21, 4, 19, 11, 14, 15, -5, 14, 2, 18, 14, 19, -5, -1, -10, 0, 5, 26, 8, 13, -2, 6, 20, -1, 20, -10, -4, 2, -20, 3, 11, 19, -2, 25, 9, 20, 21, 12, 20, 13, 7, -21, 7, -16, 8, 10, 14, 6, 26, 20, -2, 7, -7, -13, -3, 10, -8, -3, 6, 1, 20, 24, 11, 16, 17, 5, 11, -12, -19, -8, -2, -3, -8, 14, 16, -2, 6, 18, -4, 12, 18, 6, -4, 9, 2, 11, -7, 22, 15, 20, 15, 18, 8, 27, -8, -9, 7, -2, 0, 0, 11, 1, -4, 11, 14, 11, 14, -3, 11, 10, 19, 16, 4, 5, 3, 17, 23, 11, 9, 11, 31, 13, 14, 0, -26, 1, -9, -20, -8, 17, 0, -14, -10, 10, -6, 9, 18, 7, -12, 4, 4, -15, -22, 9, 18, 21, 4, 27, 21, 7, 10, -11, -5, 1, -24, -12, 3, -4, -12, -21, -5, -8, 17, -15, 7, 3, -9, -27, -5, -1, 12, 8, 13, 0, 26, -3, -4, 16, 4, -10, -3, -2, -10, -12, 7, -11, -14, -15, 20, 27, 31, 9, 19, 14, 15, 5, -5, 4, 23, 12, 9, 24, 18, -9, -6, 2, -21, -18, -17, -10, 5, -10, 6, 4, -9, 6, -8, 15, 1, 19, 14, 14, 22, 27, 21, 15, 6, 3, -9, 0, -11, 18, -16, -7, -6, -8, 8, -20, -11, -7, -5, -15, -14, -19, -7, -20, -12, -27, -19, -23, 2, -24, -21, -22, -8, -9, 2, -8, -14, 4, -7, -6, -9, -12, -16, 0, -16, 6, 17, -14, -17, -8, -16, -2, 15, -4, 5, -1, 13, 15, 13, -12, 8, 9, 2, 12, -6, -6, -8, -12, 14, 10, 3, -1, -8, -2, 8, -17, 5, 7, -7, 10, 1, 16, -18, 9, -8, 3, 13, 5, -5, 8, 11, 3, 16, 7, 10, -7, -7, 4, -16, -14, 17, 14, 12, -15, 3, 3, 4, -4, -15, -7, -21, -17, 4, -20, -4, -15, 8, -24, -5, -8, 12, -11, 14, 10, 12, -9, -5, -17, 11, -10, -14, 7, 15, 12, 3, -14, -1, -18, -8, 1, -10, 2, -19, -38, -20, -7, -32, -33, -36, -5, 3, -9, -12, -7, -5, -13, -5, 13, 4, -3, -3, -14, -6, -8, 21, 23, 21, 16, 6, 18, -7, -39, -28, -32, -44, -38, -37, -41, -22, -8, -15, 9, -14, -6, 17, -15, 10, 5, -7, 7, 6, 1, 18, 2, 1, 24, 35, 37, 6, 24, -19, -37, -25, -52, -30, -18, -43, -16, -13, 11, -5, 15, 2, -6, -1, 17, -4, 13, 15, -4, -9, 3, 24, 9, 18, 36, 17, 23, 31, 3, -10, -50, -35, -37, -28, -30, -39, -19, -6, -4, -4, 3, 16, 23, 9, -7, 4, 13, 5, 11, -8, -4, 25, 29, 9, 40, 39, 23, 8, -15, -48, -30, -50, -11, -33, -5, -17, -8, 11, -2, 0, 22, 7, 4, 20, -3, 1, 9, 20, -1, 9, 30, 15, 42, 31, 8, 5, -9, -31, -66, -51, -23, -26, -24, 6, 2, -5, 8, -13, 4, 27, 21, 13, 2, 0, 13, -10, -28, -8, 24, 40, 60, 31, 35, 36, -1, 7, -55, -57, -38, -33, -1, -15, 9, 0, -10, 0, 31, 24, 24, 18, 11, 10, -5, -10, 4, -4, -3, 27, 23, 34, 21, 14, 10, -11, -34, -49, -47, -47, -6, 13, -8, 1, -14, -7, 29, 10, 10, 0, 6, -7, -17, -6, 13, 8, -5, 40, 32, 32, 24, 32, 20, 2, -42, -45, -41, -47, -3, 5, -3, 4, 11, -5, 2, 8, -11, -30, -17, -5, 4, -16, -26, -23, -18, 36, 54, 40, 47, 40, 7, 3, -27, -47, -24, -35, 15, -7, 18, 14, -10, 0, -6, 16, -28, -26, -1, 5, -24, -23, -18, -6, 13, 33, 39, 52, 32, 24, 3, -35, -37, -21, -35, -17, 24, 7, 16, -13, 2, -1, 0, 0, -37, -25, -7, -7, -30, -34, -5, -27, 8, 17, 35, 28, 23, 6, -20, -2, -25, -6, -26, -2, 8, -1, -1, -12, -16, 12, -3, -2, -21, -41, -34, -15, -8, -4, -6, -26, 23, 24, 7, 13, 14, 1, -34, -21, 4, 3, -1, -19, 6, -4, -14, -14, 5, 5, -6, -12, -34, -33, -14, -12, -16, 3, 0, 0, 13, 23, 15, 34, 9, -15, -29, -21, -3, 5, -9, -13, 6, 11, 18, -15, 17, -15, 6, -16, -27, -23, -17, 12, -11, -19, -10, -1, 15, 4, 19, 1, -10, -19, -4, -25, -4, 13, -5, 9, 11, -9, -7, 1, -15, -7, -4, 8, -25, -31, -25, -10, 5, -20, -22, -7, 5, 16, -3, -1, -23, -16, 5, -3, -8, 21, 11, 2, -2, 13, 0, -3, -10, -5, -10, -17, -28, -26, 5, -26, -27, -21, -48, -26, 9, -22, -21, 2, -17, -2, 11, -4, -3, 2, -13, -19, -6, 17, 2, 3, -2, -13, -8, -2, -24, -25, -2, -3, 4, -12, -19, -20, -18, -2, -26, -25, -3, -2, 10, -5, 10, -3, -7, -10, 5, 11, 8, -9, -11, 5, 13, -16, -37, -20, -21, -10, -1, 6, -24, -3, -25, -22, 2, -14, 2, -9, 3, 15, -7, -8, 0, 13, 13, -6, 14, -2, -5, 2, 10, 4, -17, -24, -14, 7, -4, 3, 12, 2, -11, -13, -15, -12, -29, -27, -7, 22, 7, 1, 12, -6, 8, -9, 7, 9, 10, 16, 8, -14, -11, -10, 8, 9, -11, -17, -4, -2, 8, -4, 1, -25, 7, -5, 21, 17, -2, 0, -14, 4, -6, 9, -15, 13, 9, 17, -16, 16, 1, 19, 8, -12, -20, -21, -19, -32, -16, -5, -10, -9, -15, -12, 13, -6, 16, 12, -11, -2, -11, -10, 11, -16, 2, -9, 14, -3, 3, 6, 15, 24, 14, 20, 14, 23, 6, -1, -8, -14, 6, -6, 19, 24, 0, -13, -26, -12, -5, 2, -4, 1, -3, 3, -7, 6, 19, 3, 12, 7, 18, 41, 30, 20, 19, 28, 26, 29, 35, 29, -1, 11, 8, -9, 15, -15, -1, 5, 12, 6, 6, -11, 0, 9, 17, 14, 9, 19, 16, -10, -3, 2, -9, -1, -8, 0, 15, 19, 12, -2, -13, -13, -15, -1, -17, 12, -15, 12, -15, 2, -1, -18, 0, -18, -18, -16, 4, -2, 12, 13, 1, 13, -13, 10, -15, -2, 13, -17, -1, 7, 6, 6, 10, 13, 11, 6, -5, 9, -9, -9, -17, 14, 14, -5, 7, 12, -15, 1, -14, -18, -3, -4, 7, -5, 5, 14, -11, 14, 3, -7, 9, -9, -15, 11, -7, 2, -12, -19, 1, 10, 12, -9, -20, -12, 6, 2, 3, -29, -10, -10, -9, 6, -8, -5, 11, 13, -4, 0, 0, -14, -17, -12, -14, 0, -6, -18, -9, -10, -24, 0, -6, 1, -32, -21, -2, -6, -27, -13, 0, -24, -2, -10, -5, 5, 9, -17, 7, -1, 9, -17, -4, 9, 13, 12, -22, -2, -34, -34, -35, -33, -29, -47, -17, -43, -40, -37, -11, -14, -16, -16, -16, -27, -9, 0, -1, 4, -3, -5, -1, 9, -11, -21, -23, -23, -7, -24, -18, -26, -35, -39, -20, -45, -20, -38, -25, -2, -24, -38, -14, -35, -52, -9, -3, -12, -2, 8, 4, -3, 7, -5, 8, 0, -2, -26, -16, -7, -5, -13, -39, -36, -22, -10, 9, 13, 22, 6, 2, -3, -42, -42, -12, -10, 13, -16, 4, 11, -7, 1, 6, 14, 1, -24, -9, -9, 3, 14, -5, 10, 0, 6, 10, 7, 2, 18, 20, 11, 18, 7, -9, -9, -12, -12, -1, -8, 18, -20, -1, 4, 24, 19, 5, 5, -8, 30, 28, 35, 20, 10, 24, 6, 6, 16, 26, 3, 42, 37, -20, -2, 5, 9, -1, 12, -3, 1, -1, 20, 17, 13, 15, -2, 20, 10, 16, 48, 21, 2, 0, 12, -1, 30, 25, 5, 15, 34, -6, -13, -9, -15, -16, -7, 9, 27, 18, 12, 24, 19, 19, 23, 16, 30, 37, 66, 46, 28, 22, 28, 18, -3, 4, 1, 35, 27, 13, 4, -3, -9, -4, 30, 23, 5, -4, 17, 24, 0, -9, 26, 40, 35, 39, 30, -12, 12, -5, -1, 15, 6, 0, 22, 33, 55, -6, -3, 2, 10, 11, 13, 5, -3, 21, 21, 12, 9, 8, 1, 8, -9, -6, 3, 1, -7, -26, 9, -18, -5, -3, 13, 39, 27, 6, 13, -2, 11, -10, 8, 13, 5, 17, 20, 6, 6, -5, -12, -20, -18, -6, -24, -17, -39, -26, -7, 0, -2, 10, 6, 22, 13, -8, -17, 5, 7, -9, -9, -8, -3, 22, -13, 0, -12, 2, 17, 7, -15, -21, -25, -32, -29, -32, -24, -4, -13, -5, 5, 33, 17, 13, 0, -18, -15, 4, -12, -10, -25, 15, 5, 10, 3, -9, 1, 16, 4, -20, -8, -32, -18, -13, 5, -10, 12, 27, 20, 36, 25, 4, 3, -8, 0, -18, -2, -26, -6, 6, -3, 7, 18, 5, 29, -19, -13, -48, -25, -14, -19, 8, 6, -17, -6, 12, -2, 3, 8, -4, 2, -3, 7, 12, -13, -24, 2, -5, -1, 26, 33, 7, 2, -10, -26, -28, -26, -21, -18, 2, 5, -7, 8, -10, 14, -20, 7, -18, -3, 4, -12, -4, -9, -36, -15, -3, 13, 27, 30, 26, -2, -37, -63, -21, -16, 5, -14, 16, -24, -27, -13, 0, 6, -16, 2, 4, 5, 8, -1, -16, 4, -34, -14, -12, -10, 21, 21, 5, -11, -24, -29, -34, -7, -24, -29, 6, -19, -14, -6, -34, -19, -4, -9, -14, 2, 0, -19, 2, -20, -21, -8, 5, -1, -1, 4, -2, 6, -13, -11, -11, -12, -27, -22, -38, -26, -16, -22, -27, -6, 7, -2, -1, -19, 12, 3, 6, -15, -4, -26, 10, 32, 21, -6, 17, 16, -7, -19, -36, -24, -19, -7, -42, -43, -28, -39, -13, -15, -24, 7, 6, -17, -7, -10, 7, -21, -29, -15, -17, 13, 22, 28, 34, -1, 18, 18, 12, -6, -1, 4, -5, -16, -23, -32, -26, -23, -8, -8, 11, -17, 2, 4, 13, -17, -12, -4, -8, 20, 27, 6, 13, 30, 21, 27, 30, -11, -7, -7, 2, -24, -25, -42, -38, 1, -5, 10, -19, 2, -9, -7, -4, -4, -14, -23, -2, -20, -22, 3, 24, 20, 23, 22, 14, 3, 21, 15, 2, 9, -11, 4, -14, -5, -2, -13, -20, -2, -2, -15, -13, 10, -13, 14, -14, -28, -6, -1, -19, -7, 2, 13, 16, 8, 14, 39, 27, 31, 27, -2, -8, -4, -1, 4, -10, -16, -3, 11, 6, -15, -19, -3, -22, -23, -7, 30, 1, 26, 21, 3, 29, 37, 19, 21, 40, 13, 28, 21, 3, 2, -12, 15, -16, 8, -19, -17, -4, -17, -11, -15, 1, -7, 11, -9, 5, 13, 3, -13, 5, 20, -10, -10, -10, 19, -8, -6, 9, -6, 15, 4, -19, -9, -16, 19, 16, 16, 10, 6, 19, -6, 6, 10, -6, 13, 18, -2, -11, -13, -14, 11, 7, 1, 19, -14, -10, 17, 19, 6, 1, -11, -13, -12, 16, 2, 8, 4, 6, -13, 4, 17, 9, -4, -10, 21, 10, 21, -12, 11, -10, -6, 17, 3, 5, 9, -6, 18, -5, 4, 5, -1, 1, 3, 11, 0, -9, 5, 7, 11, -10, 4, -7, -5, 7, -7, 11, -1, 7, -2, -6, 11, -14, -12, 18, -13, 4, 1, 13, -3, 17, -12, 20, 19, 2, -3, -10, -8, -1, -6, 5, -6, 4, -26, -21, -23, -42, -25, -5, -26, -1, -14, 7, 9, 6, -2, -4, 19, 16, 4, 0, 11, 24, 4, 8, 11, -7, -2, -23, -5, -21, -36, -39, -33, -40, -48, -15, -12, -10, -26, -7, 7, -11, -11, -4, -6, 14, -11, 6, -3, -8, 11, 20, -5, -14, -10, 16, 21, 10, -11, -15, -29, -38, -25, -16, -14, -7, -24, -22, -2, 1, 5, -11, -12, -3, 19, -3, 12, -12, 8, -2, 18, 8, 14, 12, 12, 15, 2, 9, 26, 1, -39, -29, -22, -19, -31, -22, -5, 8, 8, 0, 19, -2, -1, 25, 14, -5, -13, 5, -6, 16, -12, -6, 3, 26, 16, 31, 0, -4, -17, -19, -30, -25, -27, -34, -22, 0, 11, 2, 4, 17, 1, 3, 7, 5, 0, 33, 4, 17, 31, 11, 7, 33, 44, 14, 3, 16, -4, -28, -34, -25, -34, -14, -24, -25, -10, 8, -6, 7, 22, 21, 4, 31, 3, 32, 24, 1, 8, 9, 19, 38, 31, 9, 6, 28, 0, -7, -46, -41, -31, -24, -22, -2, 5, -2, -2, -1, 9, -3, 21, 35, 21, 34, 9, 12, 23, 16, -14, 20, 37, 23, 12, 34, 24, 1, -32, -42, -36, -32, -31, -33, -9, -3, 16, 10, 16, 24, 31, 44, 30, 6, 2, -4, 10, 3, -21, 9, 20, 14, 30, 15, 23, 14, -19, -19, -51, -51, -18, -6, -3, -6, 14, 7, 3, 11, 36, 20, 16, -2, -12, -17, -13, -16, -39, -45, 18, 34, 12, 34, 35, 16, -14, -32, -43, -30, -14, -15, -3, 5, -13, 10, 14, 19, 0, -5, -22, -7, -21, -12, -29, -14, -45, -24, -16, 16, 16, 29, 25, 13, -38, -42, -38, -17, -3, 16, 10, 21, -5, 13, -9, -7, -17, -19, -43, -46, -39, -46, -20, -15, -15, -21, 15, 7, 14, 24, 28, 4, -20, -37, -10, 22, 22, 7, 3, 12, 11, 11, 0, 11, -1, -42, -21, -41, -24, -14, -25, -16, -11, -14, 18, 16, 17, 3, -1, -8, -31, -34, -8, 2, 7, 28, 8, 13, -6, 2, 4, 2, -1, -34, -33, -41, -27, -16, -14, -9, -5, 22, 17, 27, 24, 9, -7, -36, -10, -33, -34, -17, -6, 29, 19, -10, -11, 16, 9, -6, 7, -39, -29, -68, -74, -17, 13, 30, 15, 5, 19, -1, -14, -18, -19, -25, 2, -11, -1, -31, 11, 24, 10, 20, 3, -7, -3, -22, -18, -42, -49, -84, -94, -18, 34, 18, 33, -1, 24, -2, -7, -2, -11, -34, -3, -16, 4, -17, -12, 21, -9, 6, -14, 5, -1, -4, -10, -31, -47, -61, -82, 0, 36, 25, 8, 35, 0, -7, -17, -19, -11, -9, -19, -34, -19, 6, 5, 7, -5, 12, 15, -10, -3, -13, -15, -26, -41, -26, -61, 0, 23, 40, 32, 29, 35, 8, -11, -19, 0, 11, 9, -24, -9, -2, 14, 20, 21, 12, -5, -3, 12, -9, -30, -39, -40, -31, -15, -5, -6, 11, 21, 10, 5, 18, -2, 9, -20, -13, 3, -17, -5, -11, 3, 20, 4, -11, 0, -10, 4, -13, -14, -4, -35, -10, -12, -17, 1, -20, 7, -2, -1, 13, 14, -6, -1, 4, -1, -7, -15, 3, 3, -3, -7, 3, 18, 20, -9, -8, -27, -4, 2, -26, -8, -6, -23, -2, 2, -11, 7, 12, -7, -5, 19, -5, 10, 25, 1, 13, -7, -9, -10, -6, -14, -14, -12, -20, 3, 17, -22, -11, -27, -29, -50, -28, -3, -35, -17, 13, -5, -24, -2, -6, 12, 4, -6, -13, -6, 12, -12, 10, 12, 13, 0, -3, -4, -5, 6, -9, 10, -10, -22, -20, -19, -3, 5, 12, 7, -13, -4, 16, -6, 13, 8, 3, -9, 8, -1, -4, -2, 18, -14, -1, -15, 11, 7, 4, 18, 18, 13, -4, 12, 9, 37, 27, 34, 7, 38, 27, 9, 16, -9, -7, 0, -6, 17, 12, -7, 5, 8, -3, 14, 16, 0, -12, 12, 15, 9, -1, -3, 15, 6, 11, 22, -4, 13, 17, 11, 1, 6, 13, -8, -2, 6, 1, -1, -23, -14, -15, -6, -13, 10, -9, -20, -20, -7, 6, 10, -13, -3, -3, -17, -18, 11, -20, -9, -16, 2, -5, -17, -4, 4, -2, -13, -19, -13, -15, 2, 10, -13, -16, -23, -11, -20, -9, -10, 6, -24, -4, 2, 9, -3, -19, -8, -17, 4, -23, -18, -4, -8, -7, -24, -22, -16, -4, -1, 3, -11, 1, -20, 2, -9, -2, -5, -33, -8, -5, -20, -22, -20, -23, -25, -19, 1, -16, -14, 3, -4, -11, 0, -5, -3, 2, -22, -7, 3, -13, -3, -11, -26, -32, -2, -14, 1, -1, -11, -5, -12, -10, -16, -10, -23, 1, 1, -19, 7, -7, -23, -14, -4, -10, -18, -28, -26, -31, -14, -19, -20, 1, -6, -13, 5, -2, -15, 4, 12, 3, -11, 14, 12, 1, 6, -18, -19, 9, 1, -12, -4, 0, -5, -1, -24, -10, 10, 2, -2, 5, 27, 0, 14, 6, -2, 9, -6, -17, 3, -2, -4, -18, 10, 0, -15, 7, -15, -7, -23, 1, -25, 3, 16, 12, 16, 22, 21, 17, 37, 37, 12, 18, -8, 30, 6, 9, 13, 7, 15, 1, -1, 10, -14, 8, 3, -10, -19, -19, -20, 4, 10, 31, 0, 9, 26, 4, 15, -6, -11, 16, 7, 18, 34, 13, 4, 7, 13, 26, 24, 26, 6, 8, -1, 1, 10, -17, -32, 3, 3, 2, 16, 18, 13, 26, 3, -5, 0, 13, 40, 22, 6, 10, 17, -1, 16, 17, 30, 22, -5, 3, -8, -21, -8, 0, -5, 0, 10, -9, 14, 26, 18, -2, 14, 18, 8, -11, 26, 4, 27, 28, 27, 30, -2, 13, 53, 19, 6, 8, 3, 11, 6, 13, -5, 4, 15, -5, 11, 19, 16, 2, 12, 18, 3, 10, 19, 4, -3, 7, 19, 8, 14, 4, 33, 18, 8, 10, -12, -2, -6, 8, 11, -7, 7, 14, -4, 12, 11, 12, 27, 10, 6, -7, 8, 14, -6, 12, 22, 3, 0, -2, 8, -13, 13, -20, -6, -13, 5, 0, 3, -13, 15, 8, 6, 15, 25, 32, 24, 15, 2, -11, -8, -18, 22, 26, 27, 22, 20, 16, 13, 4, 15, -10, -4, -16, -5, 4, 5, 9, 6, 24, -9, 0, 20, 39, 0, -34, -15, -8, -6, -19, 2, 1, 17, 17, -5, 7, -16, 1, -11, 9, -11, -5, 8, -8, -4, -1, 10, 13, -13, 23, 26, 15, 9, -14, -29, -8, -28, 1, 46, 39, 7, -6, 18, 9, 5, -6, -5, -14, 8, -2, 5, -25, -18, 17, -4, 0, -5, 28, 19, -13, -17, -26, -3, -28, -16, 28, 43, 22, 9, 8, 24, 27, 1, -25, -5, -18, 10, -10, -6, -19, 4, 4, -4, 13, 9, -11, -13, -20, -5, 0, -14, 7, -10, 45, 26, 9, 36, -6, 24, 11, -30, -44, -10, 0, -17, -5, 7, -6, -11, 18, 18, 16, 9, 24, -25, 7, -3, -20, -21, -2, 27, 11, 2, -8, 5, 26, 21, -6, -3, -14, -6, -5, -10, -10, -14, -1, 11, 2, -1, 4, 17, 2, -12, 15, -1, -8, -5, 0, 1, 11, -4, 14, -4, 0, 8, -17, -3, -30, 3, -12, -1, 12, 2, -25, -2, 9, 0, -2, 9, -1, 6, 7, -21, 0, -4, -20, -22, -7, 4, 11, -2, -23, -25, -21, 1, -2, 2, -11, 1, -3, 2, 2, -14, 24, 15, 9, 21, 6, -4, 11, -14, 11, -18, 8, -3, 11, -14, -29, -32, -34, -20, -35, -15, -20, -24, -13, -9, -1, 1, -13, -27, 5, 13, 16, -14, -13, -13, 7, -1, 10, -9, -9, -19, -18, -24, -14, -21, -41, -22, -5, 0, -1, -20, -13, -6, -17, -10, -27, -30, -33, 11, 4, 4, -8, 14, -1, 21, 9, 18, 8, 8, -12, -20, -22, -32, -34, -17, 1, -22, -12, 11, -6, -23, 4, -21, 7, -6, -21, 16, 14, 22, 26, 14, 28, 24, 12, 15, 2, 23, 9, -23, -19, -29, -25, -5, -22, -25, 3, -8, -6, 6, -7, -8, -13, -16, -5, 6, 23, 7, 19, 36, 26, 31, 41, 25, 40, 15, 9, -18, -18, -25, -17, -33, -20, -20, -11, -3, -11, -2, -18, 2, -12, 3, -10, 0, 0, -12, 8, 18, 21, 10, 14, 6, 4, 23, 1, 7, -10, -30, -15, -20, -2, 9, -10, 8, 5, -19, -7, -8, -23, 6, 1, -3, 8, 9, -3, -14, 11, 1, -12, -22, -18, -9, -17, -3, 2, -26, -9, -19, -10, 11, -6, -4, -3, -12, 7, -19, 6, 6, -17, -14, -23, 1, -7, -12, 9, 7, -17, -14, 5, -7, -13, -12, 1, -14, -22, 9, 4, 9, 5, -19, 8, -17, -16, -25, -4, -13, -4, -14, 4, -4, -20, 2, -20, -28, -7, -7, -9, -18, -9, -18, 6, -23, -8, -28, -23, -28, -25, -19, -12, -5, -18, -27, 0, -10, -2, 1, -16, -19, 1, -18, 1, 0, -1, -8, -30, -22, 1, -22, -22, -28, -19, 4, -22, -10, -7, -28, -19, -11, 5, -5, -5, -26, -14, 4, -18, -20, -3, -9, -21, -41, -31, -24, -25, -41, -28, -25, -23, -15, -27, -20, -32, -28, -8, 2, -20, -1, -15, -27, -25, -27, -15, -16, -34, -29, -14, -18, -3, -22, -5, -21, -16, -28, 5, 6, -26, 13, -11, 1, -13, -26, -27, 0, -18, -2, -26, -12, 1, -22, -4, -6, -19, -27, 8, -7, 16, 25, 5, 18, 7, -3, 0, -2, -17, -16, 3, 7, 6, 7, -2, -2, -25, -3, -20, 0, 2, -8, -23, -21, -7, 4, 26, 11, 38, 20, 23, 18, 11, 12, 18, 5, 1, 17, 27, 30, 0, 14, -12, -3, -15, 2, 4, -11, -22, -30, -17, -8, 3, 16, 19, 8, 9, 26, 30, 27, 23, 13, 18, 19, 15, -8, 19, 30, 37, 19, -6, 10, -27, 4, -5, -8, -4, -18, 25, 4, 6, 15, 13, 6, 12, -6, 10, 4, -8, 3, 23, 22, 9, 10, -1, 4, 21, 16, 25, -8, 0, 6, -24, 4, -1, -32, 6, 11, -5, 9, 9, -7, -7, -10, -6, 0, -3, -7, 17, 17, 3, 0, 13, 8, 7, 55, 30, 16, -14, -19, -3, -23, -11, -25, 3, -2, -12, -8, -9, -2, 12, 15, 8, -28, -23, 9, 16, 22, 23, 4, -2, -5, 17, 36, 27, 8, -9, 6, -10, -8, -18, -13, -23, 0, -5, 5, 8, 5, -1, 28, -3, -38, -3, -19, -6, 21, -3, -19, 10, 9, 11, 39, 1, -3, -4, -25, -23, -22, -25, -13, -8, -3, 21, -4, 0, 15, -2, 27, 0, -29, -12, 5, -12, -10, -9, -28, -6, -4, -11, -7, 19, 14, -8, -2, -17, -34, -30, -27, -9, 25, -9, -14, 13, 26, 20, 8, 26, -11, -14, 4, -4, -8, 1, -1, 0, -26, -4, -13, -9, -10, -24, -26, -3, -11, -27, -3, 2, 9, 24, 14, 13, 2, 29, 22, 29, -14, -6, -18, -1, 26, 26, 11, 8, -5, -12, -33, -24, 3, -27, -11, -10, -29, -20, -13, -7, -7, 17, 19, -2, 16, 14, 19, 8, 13, 1, 3, 30, 7, 6, -8, -9, -28, -19, -29, -26, -1, -1, 3, -2, -15, -28, -1, 5, 4, 20, 6, 13, -2, 11, 34, 1, -14, -15, 12, -1, 16, 10, 0, 1, 7, -18, -12, -30, 3, -28, -8, -24, -10, -16, 9, 18, -9, -1, -9, 24, 12, 32, 41, -2, 2, 6, 13, 30, 28, 4, -9, 1, -9, 26, -24, -4, -27, -11, 5, -26, 1, -24, -1, -6, 6, -7, -8, 5, 16, 10, -9, 11, -13, -14, 39, 26, 3, 1, 8, 16, -7, 21, -21, -44, -5, 0, -22, -18, -11, -12, 21, 18, 12, 22, 15, 22, 1, 13, 16, 13, -18, -13, 14, -10, -13, 5, -10, 0, 6, 10, -30, -18, -19, -15, 6, -15, -28, 1, -1, 20, 35, -6, 7, -11, -2, 12, -11, 13, -14, 7, 10, 8, 16, 6, 15, 23, -6, -20, -16, -9, -25, -17, -10, -14, 0, -22, 18, 40, 14, 10, -5, 13, -11, -2, -19, -10, -16, -4, -9, 11, 0, -17, -9, 20, 1, 10, -30, -25, -5, -3, -14, -18, 1, -28, -3, -2, 11, 2, 12, 9, 9, -10, -22, -16, 13, 4, 2, -1, -12, 2, -11, 18, 6, -13, -27, -13, -25, 1, -8, -21, -18, -25, -4, -31, -6, 12, -7, 1, -8, 28, 14, 9, 15, -2, -13, 8, 14, 7, 16, 21, 11, -2, -8, -17, 1, -3, -9, -8, -27, -10, -14, -19, -30, 6, 9, 23, 28, 31, 24, 13, 4, 26, 19, 18, 15, 23, 14, 17, 3, 3, -21, -1, -18, -13, 3, -2, -18, -9, -2, -12, -31, 2, 17, 13, 20, 34, 27, 21, 46, 20, 40, 11, -10, -1, 16, -10, -6, -9, -6, -24, -29, -5, -5, 0, -2, -4, -9, -16, -6, -2, -28, -13, 6, 6, -27, 11, -19, -5, 2, 3, -17, -8, -7, -9, -21, 8, -25, -11, -20, -27, -2, 2, 4, -4, -1, -8, -9, -10, -16, -17, -24, -16, 0, -31, -33, -38, -27, -42, -39, -40, -15, -36, 0, -19, -14, -15, 4, -10, -3, -26, -17, -11, -10, -15, -20, -15, -26, -19, -10, 4, -23, -33, -8, -7, -31, -13, -2, -17, -30, -13, -1, -6, -17, 3, 4, -1, 6, -14, 6, 5, 8, 6, -17, 9, -13, -19, 7, -5, 10, -14, 12, 2, -6, -11, 5, -3, -21, 0, -1, 5, 12, -2, 5, -8, -18, -17, 0, 2, 5, 6, 7, 3, -1, -22, 1, -15, 0, -21, -14, 1, -18, -13, -15, 4, -12, -15, -7, 8, -13, -1, 4, -2, -15, 5, -13, -12, -15, 1, 8, -24, -13, -16, -17, -20, -32, -10, -2, -18, -9, -5, -3, -6, 10, -16, -9, 7, -11, -8, 1, -16, -2, -13, -21, -16, 9, 2, -15, -9, -13, -16, -16, -6, -29, -22, -20, -28, -32, 2, -6, -12, -9, -9, -26, -10, -15, -12, -14, 5, -7, -15, -17, -17, 9, 0, 9, -2, -3, -30, -18, -2, -2, -33, -17, -22, -17, -4, 0, 4, -23, -13, -17, -3, -6, -19, 8, -5, -16, 0, -12, 8, -8, 1, -3, 6, 13, -7, 13, 17, -17, -16, -1, -8, -8, 4, 6, -23, -20, -2, -5, -1, -21, -1, 4, 7, -6, 3, 2, 13, 0, 36, 15, 6, 13, 30, 23, 3, 6, -2, -16, -17, -6, 15, -7, 2, -1, -12, -5, 24, 1, -19, -1, 11, -9, -3, -9, 7, 10, 35, 8, 7, 1, 22, 5, 12, -1, -8, -15, -1, -19, -6, -4, -11, -8, -17, 9, 25, 5, -8, -4, 9, 3, -17, -11, 18, -3, 16, 17, -2, 4, 13, -2, -13, 1, -11, -11, -13, -24, 5, -10, -7, 7, -11, 29, 5, 39, 14, -7, -10, 3, 10, 7, 5, 8, 5, -20, -3, 20, -10, -26, -3, 0, -14, -28, -8, 14, 27, 18, -17, -11, 25, 28, 11, 4, 9, -10, 10, 0, -9, 10, 9, -2, -20, -34, -14, 6, -19, -12, -4, -27, -25, -21, 13, 12, 21, -16, -21, 10, 9, -7, 1, 9, 3, -3, -2, 11, 4, 1, 8, 1, -5, -32, -15, 5, -2, -4, -8, 10, -29, -32, 10, 19, -4, -5, -23, -29, -26, -22, -21, -10, -1, -18, 2, -5, -19, -7, -8, -2, -26, 6, -10, -1, 14, 18, 24, 24, -8, 10, -16, -9, -18, 6, -25, -7, -4, -37, -35, -6, 8, -18, -12, -19, 4, -16, -3, 0, -17, 4, 20, 25, 24, 29, 34, 17, 22, -13, -9, -5, -1, 18, -18, 0, 4, -14, -35, -33, -22, -18, 2, -10, -15, -12, -4, -5, -8, -14, 15, 9, 20, 14, 10, 9, -2, 8, 26, -7, 4, 3, 13, 0, 19, 0, -23, -15, -13, 8, -14, -10, 9, -2, -12, 5, 8, -9, 6, 23, 8, 24, 23, 36, 34, 8, 37, 20, 9, -7, 17, 10, 22, 42, 18, -25, -8, -16, -6, -10, 11, 7, -14, -5, -22, -16, -15, 4, 27, 11, -5, 19, 8, -1, 12, 10, 13, 29, 7, 6, 9, 16, 21, -20, -25, -8, -15, -20, -6, -1, -4, 5, -40, -29, -29, -31, -26, -7, -1, 12, -3, -6, 21, 5, 14, 12, 4, -17, 14, 6, -8, -15, -6, -24, 8, -14, 3, -14, 2, -4, -32, -20, -41, -43, -43, -25, -19, -8, -7, 7, 1, 11, 0, 12, -21, -2, 3, -6, -27, -22, -5, -14, -20, -8, 2, 7, 8, 10, -9, -17, -46, -57, -56, -37, -36, -25, -43, -26, -9, -4, -4, 2, -19, -11, 1, -2, -8, -8, -16, 7, 4, 1, -8, 3, -1, 12, -12, -3, -28, -40, -29, -47, -46, -30, -49, -39, -25, 0, -14, 11, -2, -8, -3, -7, -12, -7, 5, -1, -21, -7, -12, 14, 12, -2, -9, 14, -17, -4, -17, -35, -27, -33, -33, -31, 11, -6, -4, 10, 11, 10, 1, -20, -8, -14, 9, -11, 8, -17, -13, -14, 14, 13, 0, 29, 21, -1, -1, -13, 7, -21, -24, -3, -21, -9, -4, 10, 15, -8, -18, 7, 4, 9, 1, -20, -4, -9, 5, 2, 15, 7, 30, 33, 33, 34, 7, 36, 7, 19, 19, 25, 16, 4, -7, 10, 1, 9, -25, -33, -10, 0, -18, -10, 1, 4, 4, -10, 6, -4, 4, 25, 50, 33, 23, 29, 29, 31, 27, 10, 18, 9, 14, -1, 8, -13, -5, 9, -5, 4, 6, -2, -15, -17, 3, -19, 8, 8, 20, 7, 10, 27, 8, 33, 27, 1, 29, 7, 8, 2, -2, 1, -24, -19, -20, -2, 11, -13, -7, 1, 3, -20, -16, -5, 11, -16, -6, -7, 1, -22, -18, -15, -7, -28, -7, -26, -35, -32, -16, -40, -12, -6, -3, -8, -21, 2, -18, -14, -13, 4, -10, 7, -11, -12, -6, -2, -18, -1, 11, -4, -23, -18, -21, -15, 1, -8, -4, -19, -8, -3, 6, -5, -6, 1, -11, -11, 2, 2, 2, 1, -16, -10, -2, -1, -24, -7, 5, -2, 8, 1, -24, -24, -22, 2, 0, -2, -19, -17, -5, 2, 5, 8, -21, -10, 8, -24, 10, 8, -15, -21, -3, -24, -3, -7, 2, -24, -6, -12, 0, -14, -20, -23, -24, -14, -16, -6, -13, -4, 0, -7, -21, -20, 4, -14, -2, -3, 1, -17, -22, -2, -8, -22, -19, 1, 9, -15, 9, -9, -1, -21, 2, -8, -17, 1, -15, 1, 1, -9, 8, -21, -15, 7, 1, -10, -17, -4, -20, 7, -1, -2, 14, 22, 17, 24, 14, 30, 7, 13, 0, -4, 10, -8, -3, -15, -10, -4, 6, -25, 2, 4, -15, -17, 5, -21, 13, -2, 7, 34, 18, 19, 0, 7, 25, -2, 13, 17, 16, 15, 1, 7, -5, -27, -24, -28, 8, -21, -11, 3, -6, -13, 3, 15, 16, 9, 28, 13, 2, -5, 7, 15, -10, -10, 3, 15, 4, 3, 10, -1, -6, -4, -9, -15, 4, 1, 2, -9, -4, 2, -2, 20, -1, -4, 3, 8, 5, 4, -10, 12, 9, 13, -13, -13, 0, -6, -3, -16, -28, -5, -23, 2, -4, -20, -15, -22, 0, -21, -5, 24, 30, 0, 17, -5, 4, -25, 1, -19, -8, -6, 12, 1, -33, -2, -12, -26, -23, -14, -25, -12, -32, -10, 5, -22, 8, -1, -12, 16, -3, 7, 21, -19, -15, -23, -16, -16, 2, 6, -8, -19, -20, -18, -5, -19, 1, -5, -23, -27, -19, 5, -16, -4, -13, 2, -4, 7, 2, -13, -14, 13, -15, -24, -2, -1, -17, 2, -17, 8, 6, 22, 9, 8, 1, 1, -31, -31, -41, -25, -3, -24, -25, -31, -20, 15, -11, 2, -11, 3, -12, -5, -23, 4, -21, -1, 4, 18, 31, 19, -2, -14, -15, -9, -20, -26, -16, -2, -23, -2, -5, -6, -14, -10, 9, 0, -17, 9, -7, -2, -14, -2, -24, 8, 7, 16, 7, 8, 13, -8, -24, -15, -20, -26, -30, -18, -8, -17, -1, -7, -16, 1, -23, -26, -10, -19, -18, 10, -12, 1, -2, 7, 23, 19, 30, 22, -3, 3, -4, -20, -15, 0, -8, 4, -11, 1, -12, -22, -5, -34, -5, 3, -18, -6, -10, -33, 8, 17, 33, 31, 23, 29, 8, 22, -16, -26, -32, 0, -4, 0, -10, -3, -6, 4, 9, -11, -20, -30, -27, -16, -12, -7, -1, -10, -14, -1, 5, 31, 18, 21, -1, 4, -3, -41, -18, -12, -25, -24, 8, -5, -21, -9, 6, -6, 8, -9, -10, 0, -28, -24, -12, -20, 3, 17, 29, 40, 23, 32, 4, -10, -16, -8, 2, -18, -2, 5, 9, -14, 3, -7, -10, -14, 12, 16, 0, -2, 9, -22, -6, 5, -1, 19, 10, 15, 2, -14, -9, 12, 14, -13, 4, 22, 4, 28, 2, -14, -16, 4, -19, -8, 16, 22, -17, -14, 28, 18, 0, -11, 1, 1, 26, 0, 8, -11, 6, 11, 16, 11, 24, 21, 9, 0, 0, -11, -22, -10, 1, -20, 1, 1, 27, 6, 2, 8, 6, 3, -8, 1, 8, 7, -12, -3, 1, 21, 19, -4, 26, 5, 5, -2, -6, -15, 0, 8, -3, -19, 10, -9, 12, 28, 25, -14, 15, -10, 13, 0, -9, 6, 3, 0, 25, 12, 13, 2, 24, 10, 16, -9, -8, -9, -22, -9, 8, -4, 17, 6, 17, 10, 18, 2, 11, -3, -2, -3, -20, 15, 4, 24, 16, 18, 0, 19, 26, 1, 15, 1, -6, 6, -12, -21, 8, 0, 9, 21, -4, 11, 25, 11, 1, 12, 12, -1, 3, 14, 18, 2, 27, 28, 37, 9, 0, 7, -6, -3, -17, 7, -17, -18, -5, -7, 3, 22, 11, -14, -1, -11, 10, -8, 10, 4, 1, -8, -1, 7, -6, 4, 28, 23, 25, 14, -6, 0, -3, -23, -6, -16, -8, 9, 6, -4, 10, -6, 1, -9, -8, 5, 5, 5, -20, -17, -3, -3, -3, 52, 22, 28, 16, 7, 2, 4, -2, -13, -23, 4, 7, -4, -1, 15, -2, -2, -12, 4, -26, -21, -17, -20, -23, 3, -18, 4, 9, 5, 4, 13, 11, 1, -12, -16, 11, -22, -11, -20, -13, -15, 3, -18, -12, -2, -10, 19, 17, -1, -9, 7, 9, 17, -1, -16, -19, 3, -10, -6, 2, -14, -24, 4, 9, 1, -5, -14, -21, 3, 9, -15, -8, -1, -14, -1, -22, -21, 10, -9, -25, -11, -31, -4, -5, -1, -18, 5, -11, -14, -6, -14, 4, 3, 1, 7, -3, 4, -1, 4, -22, -18, -12, -3, -17, -24, -2, 3, -25, 1, -24, 0, -7, -7, 3, -4, -14, -19, -15, 9, -24, 4, 9, -1, -14, -13, 9, -12, -5, -11, 5, -19, -12, -8, 2, -6, 8, -10, -14, -7, -10, -3, 3, 4, -19, -11, 12, 2, -16, 6, 8, -21, -20, 9, -17, 1, 9, 3, -9, 15, 8, -3, 10, -5, -17, -10, 7, -1, -1, -8, 5, -11, -16, -14, -5, -11, -18, 10, -19, -2, -11, 1, 2, -19, -14, -6, 8, 12, 8, 12, 7, 5, 6, -3, 7, -5, -3, 15, 22, 6, -10, -3, -5, 6, -14, -18, 4, -11, 12, 7, -19, 10, -9, -8, -8, 0, 40, 27, 11, 24, 31, 7, 24, 21, -4, 2, 18, 1, 19, -4, 13, -3, -16, -18, 8, -7, 0, -6, 6, -23, 0, 15, 1, -11, 31, 17, 21, -2, 13, 17, 14, 1, 17, 7, -4, -15, -8, -2, -4, -14, 2, 10, -7, 4, -16, -9, -7, -11, -19, -21, -3, 11, -2, 19, 10, 3, -9, -18, -26, -9, -9, -2, 7, 9, 8, -15, -5, 1, -8, -2, 7, -12, -10, 10, -21, 5, 4, -7, 2, 20, -15, -18, -27, -2, -14, -5, -22, -26, -15, -12, -18, -27, 0, 4, -11, -24, 10, -3, 4, -18, -3, -12, -11, -6, -22, -10, 4, -3, -12, -23, 5, -22, -6, -19, -20, -44, -23, -37, -19, -29, 0, -16, -25, -9, 11, -10, -15, 11, -9, 11, -23, -3, -7, -14, -12, 8, 14, -6, -11, -3, 6, -20, -21, -33, -4, -34, -27, -21, -22, -11, -11, -30, -17, -8, -5, 10, -12, 12, -20, -21, 11, -20, -14, -11, -8, -25, -6, -21, -23, -14, -8, 9, -7, -8, -31, -19, -3, -23, -28, 4, 7, 11, -8, 5, -10, 15, -21, -22, -10, 3, -1, -12, -5, -20, -3, -9, -23, 0, 3, 9, -12, 1, -20, 9, 8, -15, 15, 12, 3, -20, 8, 5, -5, -14, -5, -27, -20, -29, -15, -23, -5, -19, -37, -23, -21, -29, -16, -4, -22, -6, -3, -7, 21, 15, 25, -1, -9, 1, 6, 5, 12, -4, -4, -35, -26, -21, -24, -18, -35, -21, -7, -4, 3, -14, -10, -28, -16, -3, -16, -24, -4, 10, -9, 27, 7, -21, 11, 4, -17, -11, -2, -28, -46, -40, -10, -20, -14, -4, 15, 20, -12, 6, -1, -14, -4, -26, 6, 0, 2, 8, 15, 46, 26, -6, -2, 4, -12, 11, -14, -30, -16, -12, -11, 1, 32, 20, 38, 24, -9, -26, -20, -23, -12, -12, 2, 7, 18, 16, 21, 40, 14, 11, 8, 0, 1, 6, 5, -21, -15, 15, 15, 7, 10, 44, 46, 7, 12, -6, -18, 3, -12, 3, 6, -13, 12, 18, 33, 30, 16, -10, -5, 8, 6, -3, 19, 8, 21, 16, -4, 13, 6, 23, 40, 5, 3, -9, 8, 5, 12, 16, 12, 0, 23, 26, 31, 25, 33, 24, 5, 6, -19, -3, -3, -4, 19, 10, -11, 19, 9, 27, 7, -14, -19, -10, 8, 0, 14, 33, 3, -7, 25, 4, 22, 23, 23, 17, 9, 2, 9, -12, 2, 23, 15, -1, 22, 7, -8, 5, 9, 6, 14, 0, 10, 29, 25, 10, -8, 18, 0, 25, 28, 14, 15, -17, -10, -18, -15, -13, 7, 10, 9, 14, 8, -4, 10, 13, 12, 0, 22, 17, 19, 7, 20, 14, 6, 24, 18, 30, 6, 22, 26, 5, -2, 0, -18, 9, 3, 8, 27, -16, 10, 3, 5, 21, 26, 32, 17, 25, 19, -8, -10, 21, 16, 1, 17, 0, -1, -13, 10, -12, -5, 12, -18, 6, -2, 18, -7, -19, 15, -4, 14, 23, 5, 32, 5, -4, -13, -4, -5, -15, -16, 2, -11, 17, 2, -10, 8, -15, -6, -21, 6, -8, -15, -4, 12, -7, 15, 6, 16, 20, 10, -6, 5, -34, -8, -11, -27, -12, -16, -7, 2, -15, -11, -20, 3, 8, -1, -19, -20, 8, 8, 11, -13, -9, -20, -22, 6, -18, -25, 4, -8, -10, -30, -38, -36, -34, -46, -33, -21, -5, -25, -1, 9, 4, 13, 1, 13, -17, -11, -12, -22, -20, -2, -24, -20, -38, -25, -35, -11, -14, -39, -40, -34, -39, -42, -36, -12, -28, -21, 7, 10, 3, -1, 11, -7, -10, 10, 8, -4, -28, -18, -19, -14, -31, -39, -21, -49, -49, -21, -28, -32, -15, -33, -7, 3, 5, 2, 5, -11, -6, -10, -21, 7, -6, -5, -20, -17, -4, -18, -1, 11, -1, -5, -19, -18, -22, 6, -17, -9, 7, 5, -17, 2, -12, 12, 2, -13, 13, -20, -16, 3, -1, 13, 12, 9, -7, -14, -18, 6, -16, 13, -20, -9, -13, 13, 13, 5, -19, 6, -19, 4, 11, 7, 9, -18, 3, -17, -9, 0, -19, -10, -15, -16, 11, -3, -21, 8, 8, -8, 12, 4, -14, -3, 6, -13, -20, 2, 2, 0, 5, -17, 1, -9, -8, -19, 2, 5, 10, -12, 2, -15, 13, 0, 11, 4, -15, 9, 2, -9, -18, -6, 0, -22, 0, -22, -13, 8, 13, 11, 1, -11, 7, -5, -10, -2, 7, 2, 12, 0, -19, 2, 4, 9, -2, 1, -9, -4, 9, 5, 9, -10, -24, -5, 3, 7, 7, -14, -4, -15, 7, -8, -18, -13, 5, -9, -9, -4, 6, -2, -10, 13, 4, 14, 16, 0, -2, -9, -15, 15, 7, -6, 9, -11, 0, -25, -13, -19, -14, -18, -14, -9, -15, -6, 9, -10, 14, 18, 31, 37, 32, 23, 41, 47, 43, 43, 32, 4, 7, 19, -19, -13, -24, -36, 6, 12, 4, 9, -8, -18, -20, -10, 12, 22, 7, 14, 9, -11, 22, 1, 21, 2, 15, 13, 17, 19, 13, 5, 29, 13, 0, -34, 0, -10, -21, -21, -10, 4, -19, 7, -3, 14, 23, -10, 14, 21, 7, 3, 10, 20, -6, 23, 14, -3, 5, 7, 7, 24, -10, -5, -18, 1, 7, 2, -11, 7, -9, -17, 20, 13, 14, -1, -10, -4, -16, -2, 11, 19, 21, 5, 9, 11, 26, 20, -14, 13, 18, -3, 0, 2, -6, -6, -3, -15, 8, -7, 9, 7, 17, -3, -3, -3, -19, -5, 15, 3, -2, 11, 2, 19, 12, -4, 18, 8, -3, -9, -13, 6, -15, -5, -20, -19, -2, -14, 30, 3, 2, -12, -7, 13, -20, -1, 1, -8, 10, 24, 1, 34, 4, 27, 4, -7, 23, 26, -11, 10, -17, -16, -9, -22, -11, 0, 1, -2, -15, -27, -13, 6, 0, 2, -18, 29, 15, -3, -12, 31, 7, 21, 22, 23, 23, 9, 6, -15, 1, -7, 5, 5, -22, 4, 15, -28, -38, -10, -17, -2, -24, 5, 4, 25, -7, 5, -10, 1, 20, 9, 5, 2, -15, -8, -9, 9, -10, -20, -17, -21, -5, 2, -21, -13, -6, -10, -14, -4, -6, -34, -8, -4, 19, 9, 15, -12, -4, -6, -10, -14, -29, -32, 8, -13, -11, 2, -19, -9, 8, -9, -12, -41, -21, -2, -20, -26, -35, -40, 9, -5, -3, 4, -8, 7, -14, 7, -12, -41, -42, -26, -13, -4, -18, -6, 12, -16, 6, -20, -2, -9, -18, -20, -3, -27, -17, -15, 5, 23, 29, 6, -21, -10, -32, -24, -15, -38, -54, -44, -27, -1, -7, 11, 9, -11, -15, 7, -17, -23, -26, -10, -19, -14, -21, -25, 16, 25, 40, -17, 2, -13, -45, -11, -8, -13, -33, -11, -16, 0, 11, 9, -6, -20, -3, 11, 22, -5, -42, -25, 3, 6, 5, -10, -10, 22, 24, -29, -12, -36, -37, 3, -7, -11, -6, 7, 11, 3, -3, -16, -15, -11, -15, 25, 8, -3, -22, -12, -32, -4, -16, -32, -23, -6, -30, -37, -23, -19, -28, -3, 2, 2, 2, 12, -12, -10, -4, -16, -22, -3, -19, 24, 2, -2, 4, -4, -1, -21, -15, -35, -19, -27, -10, -12, 0, 14, -4, 1, -16, 5, 25, 16, 2, -18, 5, -10, -5, 11, -14, -8, 9, 12, 18, -4, -6, -5, -24, -25, -42, -6, -15, -11, 12, 26, 21, 27, -5, 34, 24, 18, 2, -17, 5, 5, 6, -16, 10, 22, 3, 13, 21, -1, 21, -8, 8, -23, -29, 8, 9, 19, 39, 20, 17, 40, 34, 22, 10, 17, -18, 10, -4, -20, 9, 9, 14, 19, 3, 20, 9, 15, 1, -8, -2, -10, -11, 11, 23, 26, 20, 11, 24, 44, 20, 7, 17, -2, -9, -20, -9, -21, -6, 9, -4, 19, 13, 6, 21, 16, 24, 15, 16, 11, 8, 19, 9, 8, 0, 36, 40, 35, 21, 12, -16, 1, 6, 4, 7, -6, -15, -7, 5, 0, 24, -5, 11, 33, 21, 22, 0, 34, 31, 9, 34, 32, 33, 26, 33, -4, -4, -10, -10, -8, 0, -7, 0, -6, -4, -6, -19, 6, -13, 9, -5, 13, 30, 38, 28, 31, 39, 19, 29, 17, 40, 9, 22, 16, -19, -21, 3, 3, -21, -21, 7, -2, 5, -13, -3, 5, -5, -4, 1, 6, 15, 14, -7, -18, 19, 4, -4, -14, 2, -1, -7, -3, -6, -11, 4, 9, -16, -8, -10, -2, 1, -19, -2, -2, 0, 1, 1, -8, 7, 1, -15, 12, -19, -18, -1, 1, -18, -4, -6, 2, -1, 6, -3, -9, -12, -7, -13, 4, -19, 3, 8, -9, 5, 4, 9, 9, -10, -5, -18, 5, 1, 7, -1, 9, -4, -19, -9, -6, -21, -15, -5, 0, -14, 10, 7, 6, -11, -7, 13, 7, 4, -10, 0, 14, -1, 9, -15, -14, -12, 14, 4, 10, -3, 3, -16, -8, 12, -8, -10, -4, 9, -1, 16, -7, -15, 6, -4, 1, -2, 15, -5, 13, 0, -2, -8, 8, 11, 1, -17, -13, 0, 7, -2, 8, 17, -2, -8, 14, 14, 6, 8, -14, -15, 7, -13, -15, 0, -10, -4, 7, 31, 35, 27, 49, 27, 3, 14, 16, 22, 20, 30, -5, -6, 24, 21, 17, 0, -5, -15, -4, -8, 6, -11, 4, 16, 10, -3, 5, 29, 43, 39, 30, 21, 40, 20, 9, 9, 25, -12, -2, -10, -4, -2, -4, 21, 0, 10, -15, -6, -7, 14, -13, -14, 9, 28, 33, 24, 12, 13, 8, 18, -13, 15, -16, -27, -17, -15, -18, -49, -51, -41, -24, -6, -11, 4, 18, 16, -3, 6, -7, 21, 6, 11, 35, 37, 47, 42, 20, 19, 5, 3, -17, -11, -69, -82, -61, -47, -46, -42, -26, -12, 2, -9, 1, 10, 16, 1, 7, 1, 12, 12, 41, 40, 18, 31, 30, 16, -3, -18, -16, -28, -43, -59, -51, -29, -42, -35, -13, -14, -2, -12, 17, 9, 0, -10, -7, 6, -3, -9, 1, 17, 19, 17, 19, 10, -13, -5, -11, -38, -34, -47, -37, -49, -43, -52, -24, -17, 2, -2, 4, 12, -6, 8, 5, 15, -9, 2, -25, 5, -7, -27, -28, -48, -58, -50, -53, -39, -43, -44, -55, -5, -8, -19, -21, -29, -25, -14, 0, -15, 12, -15, 11, 3, -25, -50, -33, -33, -44, -36, -42, -70, -91, -74, -55, -40, -37, -39, -32, 8, 12, -6, -28, -13, -33, -7, 7, 5, -8, -10, -21, -20, -26, -29, -28, -23, -51, -41, -74, -87, -85, -51, -16, 30, 2, -17, 7, -3, 6, 18, -2, -5, -17, -12, 1, 15, -4, 16, -4, 5, -29, -52, -17, -44, -34, -71, -55, -60, -11, 22, 19, 24, 10, 3, 5, 29, 51, 18, 22, 3, -20, -11, -4, 10, -2, -8, 19, 6, -15, -27, -40, -1, -33, -35, -26, -5, 26, 61, 55, 47, 21, 11, 36, 45, 24, 7, 17, 10, -6, 2, 10, 6, 11, 6, 1, 11, -4, -3, -10, -1, -34, -2, 14, 46, 64, 48, 39, 39, 1, 35, 48, 30, 5, -1, 51, 44, 2, -1, -9, -1, 12, 4, 4, 6, 7, 7, -10, -2, 12, 11, 29, 59, 49, 39, 37, 47, 20, 30, 47, 14, 30, 22, 59, 32, 15, 17, -11, 14, -12, 2, -9, -14, -2, 31, 19, 9, 6, 11, 28, 44, 32, 38, 32, 40, 13, 27, 39, 14, 30, 21, 25, 45, 23, -9, 1, -7, -16, 11, 10, 23, 39, 58, 12, -10, -16, -3, 13, 24, 22, 42, 6, 13, -4, 8, 20, 12, 33, 15, 19, 20, 45, -1, -5, 14, 5, 12, 22, 28, 34, 43, 4, -3, -2, 10, 32, 35, 18, 20, 18, 20, 11, 21, 6, -7, 3, 22, 3, 26, 51, 8, 10, 7, -15, 16, 17, 30, 1, -5, 22, 8, 1, 10, 20, 25, 18, 32, -3, 23, 37, 37, 22, 6, -14, -10, 1, 28, 40, 2, 13, 8, 9, -1, 16, 24, 15, 17, 7, -10, 3, 10, 36, 26, 32, 20, 29, 18, 10, 10, -22, -30, 0, -12, 8, -13, 14, 9, -18, 3, 10, -7, 27, -4, 10, -30, -4, -7, -14, 9, 8, 21, 28, 25, -1, 6, -2, -22, -40, -43, -23, -62, -52, -11, -3, -13, 2, -4, 3, 7, 23, 1, -16, -39, -40, -10, -32, -7, -14, -5, -2, -5, -1, 2, -38, -27, -31, -56, -37, -54, -43, -38, -5, -11, 2, 13, 16, 14, -16, 4, -23, -58, -36, -25, 6, 7, -26, -31, -28, -35, -41, -29, -55, -70, -60, -41, -46, -52, -34, -25, -18, -2, -13, -7, 11, 4, -5, -16, -16, -17, 6, -26, -16, -4, -26, -29, -36, -31, -25, -57, -58, -64, -52, -27, -22, -16, -22, -7, 4, 10, -5, -6, -9, 13, -15, 13, -1, -3, 0, 19, -16, -16, 4, -6, -7, -7, -49, -46, -27, -63, -60, -35, 4, -29, -23, -6, 1, -5, -15, -16, 5, -13, 7, -1, -13, 12, 10, -21, -7, 0, -4, -6, 10, -6, 2, -13, -11, -24, -39, -9, -26, -12, -8, -13, -6, -11, -15, 7, -8, -1, 4, -14, 10, -14, -9, -1, -11, -11, -19, -10, 7, -1, 9, -14, -6, -13, -20, 6, -2, -3, -12, -11, -2, -5, -2, -6, 14, 2, 5, 4, -17, 13, -17, -9, 0, 6, 2, 5, -1, -15, -5, 3, 14, -2, 15, -6, -13, -2, 16, 5, -3, 0, -5, -14, -3, 1, -19, -10, 5, -13, 13, 5, 7, -11, -13, 7, -3, 11, 14, 5, 7, -9, 7, -3, 0, 7, -13, 10, 15, -5, -19, 15, 11, -11, 9, -17, 2, -14, -8, -12, -2, -3, -10, -12, -1, 15, 8, 17, 11, 6, -3, -10, -10, -4, 11, -7, 5, -15, 2, 8, -19, -4, -14, 10, 8, -16, -2, 2, 10, -8, -10, 2, 1, 6, -2, 6, 2, 6, 0, 8, 2, -3, -11, 8, -3, 1, 1, 7, -3, -1, -11, 6, -2, 0, 1, -22, -16, -8, -35, -30, 6, -8, -3, -13, 4, -31, -20, -4, -26, -1, -2, -13, -1, -7, 11, -6, -9, 3, -6, -5, -23, -6, -4, -9, -34, -26, -16, -43, -8, -28, 1, -24, -11, -25, -17, -15, -32, -9, -13, -2, 1, -15, -6, 12, 13, 13, 3, 4, -4, -4, -2, -12, -5, -10, -24, -8, -7, -2, -4, -13, -12, -13, -9, -18, -16, -24, -25, -12, 15, -1, -12, 6, 6, 5, -3, -11, -12, -7, -16, -20, -17, -20, -22, 1, 15, 17, 15, 15, 30, 26, 7, -12, -1, -5, -39, -21, -2, -18, 5, -9, 2, 16, 4, 16, -4, 7, -5, -36, -9, -9, -22, 20, 22, 4, 42, 31, 30, 46, 21, 39, 32, 16, 4, -3, -21, -9, -18, -10, -5, 1, -2, 3, 21, 2, 12, 15, 13, 17, -12, 21, 0, 37, 46, 46, 28, 43, 36, 10, 33, 3, 2, -2, -24, 8, 11, -12, -11, -1, 16, 9, 21, 9, 12, -11, -1, 13, 15, 31, 10, 30, 24, 29, 12, 36, 24, 14, 1, 17, 7, -3, -18, 3, -8, 8, 11, -10, 4, 1, 24, 13, -5, 0, -1, -1, 17, -5, 33, 34, 23, 38, 2, 35, 6, 4, 13, 36, 39, 13, -16, -14, 15, -8, -3, 16, 20, -5, -29, -4, 20, 10, -11, -2, -6, -6, -1, 0, -13, -22, 19, 16, 10, 32, 14, 36, 40, 37, -1, -2, -7, 9, -6, 15, 8, -12, -6, -13, -13, -4, 1, -5, -12, -49, -52, -14, -27, -2, -10, -2, -7, 1, 11, 17, 39, 8, 3, -16, -14, 1, -16, 15, -3, -3, -14, 10, -11, 7, 3, 7, -30, -32, -54, -21, -21, -18, -7, -7, -16, -6, 8, 5, 3, 9, -10, -14, 8, -13, 9, -6, 7, -4, -9, -8, -12, -2, -9, -9, -21, -8, -43, -22, -20, -21, 1, 2, 9, 8, 6, -15, 4, -1, -19, -7, 3, 11, -9, -2, 2, 1, 15, -1, 0, -15, 5, -6, -20, -37, -24, -24, -13, -14, -2, -1, 4, 3, -3, 2, -22, -14, -19, -19, 5, 2, -7, 13, -33, -2, -5, 4, -1, 14, 7, -5, 5, -33, -50, -54, -17, -11, -5, -14, -25, -31, -11, -8, -20, -12, 5, 5, -5, -8, -5, -19, -11, -9, -13, -5, 1, 17, 12, 17, -23, -37, -28, -38, -7, -12, -13, -14, -19, -14, -28, 0, -21, -2, -14, 7, -5, 4, 1, -1, -32, -6, -21, 8, 15, 12, 23, -2, -8, -20, -28, -3, -13, -24, -20, -2, -31, -13, 4, -23, -22, 1, -10, 11, -14, 3, -12, -10, -26, -28, -18, 5, -1, 11, -9, 7, -2, -15, -14, -24, -23, -14, 3, -32, -26, -19, -17, 1, -2, 3, 13, 7, 13, 1, 15, -13, -30, -2, -9, 0, 14, 8, -19, -5, 2, -1, 5, -25, -15, -11, -14, -26, -11, -38, -7, -31, -24, -10, -6, 10, -18, 8, -6, -17, -18, -12, -5, 18, 7, 13, -2, 11, -2, 12, -16, -13, -7, -21, -17, -10, -34, -24, -15, -31, -25, 6, 0, -7, 11, 8, -1, -6, -8, -18, 5, 38, 19, 8, 27, -8, -6, 13, 18, -8, -7, 6, -28, -24, -46, -54, -14, -35, -23, -9, 6, -5, 14, -11, -12, 0, -26, -13, -8, 14, 38, 18, 35, 23, 9, 14, 20, 4, 15, -6, 4, -21, -39, -57, -17, -29, 0, -8, -4, 4, 8, -1, -14, 7, -19, -13, -7, 16, -14, -8, 8, 24, 6, 17, 41, 26, 34, -2, 7, -25, -1, -7, 4, -18, -20, -13, 14, -17, -13, -7, -7, -9, 15, 9, 4, 0, -12, 19, 8, 14, 12, 5, 10, 0, 19, 14, 15, 10, 16, 17, -8, -2, -15, 14, 2, 15, 3, 11, -18, -18, 1, 9, 5, -5, -8, -1, 25, 2, 3, 4, 26, 21, 24, 40, 6, 32, 22, 9, -1, -8, 2, 8, 3, -8, 14, 7, -10, 13, -8, 3, -14, -3, -11, -3, -10, -15, 9, -1, -9, 21, 8, 8, -13, 17, -13, -15, 16, 10, 4, -10, -19, -6, -16, 10, -19, -14, 8, -14, 3, -12, -6, -10, 12, 3, 2, 9, -10, -18, -4, -20, -13, -15, 7, -3, 13, 2, -3, 13, -9, -15, -12, -10, -2, 3, 10, -13, -2, -16, -11, -1, -4, -9, -15, -19, -12, 1, -14, -25, -12, -16, -16, -5, 6, -1, -14, -13, 7, -5, 3, 3, 7, -15, 7, -20, 2, -22, -23, 1, -1, -21, -19, -14, -36, -5, -33, -21, 1, -25, -6, -11, -7, -4, 5, 3, 10, -3, 12, 5, -11, 8, 4, -11, -16, -19, -9, -9, -39, -41, -32, -48, -53, -24, -39, -19, -5, -17, -21, -10, -15, -3, 10, -11, 6, 6, 0, -9, -11, -2, 3, -19, -27, -27, -13, -37, -59, -36, -27, -63, -34, -37, -41, -34, -11, -9, -16, -8, 12, 9, -2, 2, -18, 2, -3, -12, 12, -9, 8, -14, -4, -17, -37, -29, -47, -47, -49, -19, -29, -15, -27, -17, -20, -8, -21, -11, -21, -13, 3, -9, 9, -17, -10, -2, -21, -18, 4, 3, 2, -12, -21, -19, -15, -2, -11, 5, 8, 12, 16, -1, 8, 7, 3, 23, -1, 0, -14, -3, -1, 3, 10, 1, -14, -15, -14, 14, -12, 16, 23, 13, 2, 28, 20, 36, 40, 40, 36, 26, 28, 7, 25, 22, 8, 4, -13, 5, -24, 4, -12, 7, -9, 7, 14, 19, -12, 3, 12, 27, 33, 39, 33, 39, 19, 5, 22, 21, 9, 4, 8, 8, 10, 25, 11, -5, 6, 8, 0, 0, -8, -6, 16, 9, 28, 49, 29, 36, 20, 13, 24, 12, 0, -18, 1, -8, 3, 17, -3, 14, 41, 38, 7, 11, 8, -13, -17, -14, 2, 3, 21, 20, 2, 22, 22, 31, 8, 1, -26, -27, -53, -62, -42, -11, -12, 15, 14, 17, 31, 21, 2, 9, 6, -11, -9, -3, -14, -21, 21, -1, 21, 12, 17, 28, 8, -10, -36, -48, -48, -60, -15, 8, 14, 13, -4, 13, 28, 18, 13, 5, 1, -16, 12, 8, 3, 8, -5, 3, 10, 15, 1, -6, -13, -14, -48, -35, -53, -22, -6, 16, 17, 7, 21, 39, 13, -9, -13, -27, -11, -8, -15, 8, 0, -11, 3, 27, 6, 21, 30, 25, -6, -3, -1, 0, 2, 13, 11, 0, 27, -2, 15, 23, 7, -8, -18, -30, -13, -19, -18, -17, -8, 5, 5, 32, -1, -8, 18, 41, 26, 26, 36, 31, 34, 27, 17, 22, 7, 7, 2, 29, 2, -24, -2, -7, 0, -4, -17, 7, 6, -9, 14, -9, -16, 2, -8, 44, 26, 58, 50, 46, 47, 36, 16, 12, 10, 8, -8, 6, 2, 10, -8, -31, -37, -18, -16, -13, -6, 13, 14, -13, -6, -13, -7, 29, 28, 35, 42, 56, 43, 36, 32, 14, 23, 15, -2, -17, -20, -18, 5, -31, -13, 8, -22, 11, -17, 7, -5, 2, -20, -7, -13, 4, -16, 9, -5, 24, 40, 15, 31, 18, 9, 20, -8, -20, 6, -1, -24, -24, -7, 3, -4, 8, -16, 13, 8, 6, -34, -17, -26, -35, -29, -24, -4, -27, 9, -7, 10, 3, -5, -17, -12, 7, 4, -10, -44, -19, -17, 13, -16, -6, 3, 2, 23, 1, -29, -22, -33, -44, -33, -25, -34, -16, -33, -11, -21, 16, -7, -9, -15, -8, -17, -32, -42, -37, -11, 5, -7, 12, -15, 0, 2, -7, -4, -4, -26, -30, -46, -40, -39, -50, -27, -1, -22, -11, -12, -3, -25, 3, -4, -28, -4, 3, -12, 8, 9, 13, -14, 13, -5, -6, 9, 0, -19, -28, -12, -30, -22, -10, -41, -17, -24, -5, -34, -34, -3, -10, -9, -3, 6, -13, 8, 11, 11, 3, 6, -6, 17, 6, 14, -21, 0, -25, -29, -19, -16, -27, -15, -17, -15, -35, -11, -21, -8, -16, -1, 4, 11, -4, 12, -21, -21, -17, -12, 8, -11, 10, 13, 31, 19, 13, -4, 5, -13, -36, -5, -17, -19, -25, -21, 5, -8, 7, -15, -6, -15, 2, 10, -4, -12, 6, -19, -3, 16, 23, 21, 32, 27, 7, 23, 18, -3, 9, 9, -5, 22, 12, 3, -1, 15, 6, -7, 14, -14, -17, 3, 0, -18, -4, 10, -7, -11, -8, 18, 30, 47, 32, 45, 45, 44, 19, 32, 18, 26, 0, 25, 25, 8, 5, 22, -2, 1, -2, 5, -5, -14, 6, 13, 2, 9, 11, -1, 1, 9, 25, 36, 18, 12, 27, 22, 36, 29, 13, 31, 16, 6, 2, -4, -6, -17, -2, 1, 1, -13, -16, 9, -14, -2, -18, 7, -19, 5, 3, 6, -20, -18, 0, -14, -14, 14, 10, -13, 11, -2, 9, -18, -16, -21, -13, -20, 0, -21, -8, -8, -3, -7, 2, 10, 0, 1, -2, -9, -4, 2, 1, -13, 18, 14, -4, -7, 6, 20, 8, -11, 8, 10, 19, 12, 16, -8, 2, 15, -5, -1, 15, 15, -4, 13, -13, 14, 0, -11, 14, 18, 18, 8, -1, 3, 20, 17, -10, 10, -7, 13, -5, 15, -12, 8, 3, 11, -2, 16, 21, -5, -2, 6, 17, 13, 11, -9, 10, -10, -10, 14, 10, -4, 2, -14, -14, 6, -12, 15, -10, 8, 7, 2, -11, 17, -1, 21, -11, 18, -6, 3, -3, -2, 1, -2, -10, -18, 1, 5, -1, -11, 8, -2, -15, -2, 2, 6, -4, -1, 19, 9, 16, 1, -7, -12, 0, -2, 11, -14, -16, -4, -11, -3, 2, 4, 4, 17, 4, 5, 8, 6, 30, 16, 15, 13, -7, 11, 14, -3, 11, 1, 13, -11, -10, -2, 20, 15, 11, -5, -13, -16, -28, -14, 11, 30, 17, -8, -11, 16, -5, 5, 13, -14, 1, 13, -8, 5, 13, -5, 18, 15, -5, 11, 6, -8, 0, -18, -14, 2, -4, 5, -5, 12, 20, 2, -21, 0, -4, 18, -9, -1, -22, 12, 4, -6, 4, -7, -10, -12, -4, -1, -4, -10, -3, 5, -5, -5, -20, -12, 3, 29, 15, -14, -4, -5, -10, -14, -10, -13, 0, -5, 22, 8, 3, -7, 7, 0, 10, 21, 3, 5, -6, 0, 19, -8, 8, 17, 0, 22, -8, -4, -9, 4, -6, -14, -24, -33, -26, 20, -5, -5, 6, 13, -7, 7, 15, 11, -4, -9, 2, 6, 11, -3, 8, 2, 12, -1, 4, -1, 1, -13, -3, -12, -23, -10, -3, 6, -1, 16, 17, 13, 14, 4, 14, -8, -15, -23, -11, 15, 33, 11, -2, -1, 4, 12, 2, 30, 7, 9, -22, -8, -27, -51, -26, -4, 4, 4, 9, 12, 14, 1, -24, -32, -12, 16, 16, 7, 42, 2, 5, -2, 12, 19, 8, 10, -10, 13, 7, -18, -32, -32, -8, -29, -7, -3, -13, 14, 9, -1, -16, -11, -10, 12, 13, 35, -6, -13, 0, 9, 30, 19, 40, 36, 9, 10, -19, -23, -10, -15, 0, -16, 10, 0, -4, 15, -11, 17, -15, -6, -18, -8, 15, -4, -10, -1, 6, 25, 13, 22, 34, 8, -6, -8, -21, -31, 4, -20, -28, -4, 5, 3, 21, -12, 8, 10, 11, -26, -25, -18, -13, -18, -31, -24, 10, 34, 46, 37, 20, 26, -12, -37, -65, -24, -29, -9, -4, 15, -1, 17, -4, -4, -9, 5, -16, -14, -22, -30, -55, -46, -43, -19, 8, 12, 14, 44, 18, -11, -41, -32, -40, -56, -45, -26, -26, 5, -5, 2, 4, 16, -7, 11, -8, -10, -48, -49, -54, -25, -31, -20, 6, 1, 16, 17, 22, -15, -30, -40, -40, -45, -39, -5, -10, 11, 12, -2, 9, 13, 10, -1, -2, -45, -58, -78, -42, -23, 17, 5, 22, 8, 21, 26, 10, -12, -14, -32, -25, -14, -12, 2, -19, -18, 20, 19, 8, -5, 2, 9, -12, -27, -75, -60, -58, 12, 2, -10, -8, 18, 25, 25, 10, -20, -10, -22, 10, -17, -20, -32, 9, 15, -5, 16, 21, 8, 15, -13, -25, -46, -38, -30, -23, 5, 18, 6, 1, 14, -7, -1, 6, 10, 15, -15, 12, -26, -10, -8, -3, 14, 1, -12, 11, 11, 15, -2, -28, -57, -26, -36, -8, 6, 31, 8, 3, 16, 24, -2, -1, 1, -1, -6, -18, -12, -13, -5, -1, 17, 15, 15, -12, -5, 3, -6, 6, -35, -28, -1, -23, -18, -9, 1, -13, -3, 24, -1, 4, 7, -15, 0, -18, 7, -14, -20, 15, 1, 11, 6, -10, 9, 18, 0, 11, 17, -23, -13, -18, -4, -17, -9, -4, -2, 6, 13, -11, -14, 12, -26, 4, 3, 7, 14, 4, 1, 18, 16, 4, 0, 3, -15, -22, -21, -16, -14, -7, -8, -28, -23, 17, 20, 6, 8, 31, 13, 1, 9, -11, -6, -10, 14, 11, 5, 13, -10, 15, 17, 16, -14, -3, -6, -25, -12, -32, -10, -25, -8, 15, 10, -12, 0, -2, -5, 6, 39, 20, 12, -17, -11, -6, 6, 0, -6, 6, -11, -5, 21, -2, -8, -21, -28, 1, -3, -2, -26, -20, -21, 9, -20, 0, -13, 9, -5, -14, -18, -4, -9, 5, 7, 19, 20, 15, -11, -1, 9, 7, -5, 11, 18, 23, 13, 0, 9, -12, -23, -23, 5, 8, -11, 14, 13, 7, -3, 17, 3, -9, 2, 3, 9, -1, -13, 11, 3, -1, -12, 4, -3, -9, 10, -1, 19, 11, 9, 16, -8, -4, 14, 0, 10, -10, -7, 11, -13, 20, -5, 16, -10, 10, 4, 7, -19, -20, -5, 3, 14, -10, 13, -10, 6, 13, -13, -14, -20, -7, -13, 4, 9, -18, 10, 13, -6, -11, 4, -19, 9, 8, -6, -19, -8, 5, 11, 3, -12, -11, -17, -6, -15, -9, 0, -16, -13, 2, 6, -4, -4, 8, 8, 13, -10, -15, -12, -12, -6, 12, -17, -7, -7, -8, -16, 8, -14, 12, 13, -15, -11, -3, -16, -21, -17, 8, -12, -23, 0, -8, -19, 0, -8, 15, 9, -10, -10, 4, -9, -5, -17, 3, 8, -14, -3, 14, 22, 41, 45, 19, 17, -7, -28, -29, -24, -21, -27, -20, -14, -16, 2, 12, 0, -5, 1, -2, -13, 0, 0, 7, 10, 22, 32, 13, 23, 19, 15, 18, 14, -13, -18, -45, -60, -41, -30, -24, -16, -8, -15, 1, -1, -14, 0, 7, -19, -6, 1, 7, 28, 17, 15, 8, 23, 21, 13, 24, -5, -12, -14, -21, -29, -37, -21, -40, -34, -22, -23, -29, -15, 0, 0, 0, 3, 1, -3, 9, 7, 23, 17, 17, 27, 20, 39, 19, 40, 43, 31, 23, -6, -28, -40, -67, -35, -36, -34, -6, -22, -14, 6, 13, 14, 9, 22, 19, 6, 28, -12, -5, 30, 19, 46, 45, 56, 63, 53, 48, -8, -21, -60, -54, -60, -55, -49, -28, -24, -16, 10, -5, 7, 9, -12, 22, 7, -9, 1, 21, 12, 34, 19, 26, 48, 38, 27, 45, 26, 10, -5, -62, -59, -34, -57, -37, -8, -14, -16, -4, 1, 5, 11, 23, 1, 14, -11, 6, 17, 22, -11, 32, 32, 55, 35, 39, 32, 9, 1, -36, -63, -49, -56, -13, -15, 5, 13, -1, -16, 7, 16, -18, 22, 11, 2, 8, -9, -2, 1, -6, 13, 33, 21, 37, 15, 15, 7, -10, -51, -50, -16, -3, 12, 13, 4, 6, 9, -3, -3, 15, 7, 13, 11, -8, -33, -40, -19, -19, -28, -14, -4, 2, 22, 29, 34, -6, -44, -30, -35, -21, 0, -14, -13, -16, 1, 0, -14, -12, -25, -11, -12, -28, -13, -21, -42, -36, -25, -3, 20, 0, 21, 30, -1, -25, -42, -63, -31, -31, -1, 15, 9, 6, 0, 3, 7, -25, -31, -28, -5, 0, -26, -15, -50, -40, -12, -11, 4, 2, 28, 26, -29, -42, -42, -37, -24, -21, 14, 17, 2, -12, -16, 5, -10, -21, -37, -32, -4, -15, -5, -22, -34, -31, -7, -11, 9, -4, 12, -4, -27, -27, -35, -39, -37, -6, -15, -8, 7, 12, -13, -16, -6, -20, -35, -7, -11, -3, -8, -15, -10, -11, 2, -1, 3, -4, 3, -16, -32, -31, -16, -19, -5, -7, 15, 21, -14, 5, 1, 4, -4, 2, -14, -23, -12, -9, 13, 3, 1, -11, -17, -17, -20, -10, -16, -26, -12, -2, 2, 3, 20, 8, 14, 24, 16, 7, 2, 1, -3, -4, -5, -9, -16, -21, -4, 4, -17, -15, -31, -10, -15, -12, -15, -18, -34, -6, 20, 2, -8, 19, 44, 3, -11, -15, 9, 12, 9, 6, -3, -18, -18, 5, -1, -11, -14, -39, -23, 11, -12, 12, -10, -3, 16, 20, 15, 42, 29, 22, 39, 1, 16, -17, -17, -21, -1, -7, -3, -39, -6, 4, -18, -1, 2, 9, 12, -1, -4, 6, -5, 20, 5, 4, 32, 36, 22, 18, 30, 16, -2, -16, -8, 10, -17, -23, -12, -34, -8, -6, 16, 3, 17, -7, 22, 7, 12, 3, 6, -7, 23, 39, 36, 0, 29, 10, 16, -9, -9, 13, -18, 6, -5, 12, -9, -20, -6, -15, 13, 10, -5, -7, 12, 7, 11, 5, -24, 2, 25, -1, 17, 11, 4, 6, -10, 5, 10, -3, -18, 0, -5, -1, 3, 21, -3, 16, 11, 1, -3, -10, -6, 4, -7, 4, -6, -5, 20, 9, 10, 3, 23, 3, -2, 8, -18, -5, -18, 3, 16, 13, 14, 3, 16, -3, 8, 12, 5, 35, 5, 9, 11, -10, 3, -6, -10, -2, 7, -6, 0, 15, 0, 3, 1, -12, -16, 0, -10, -15, 1, -1, -6, -26, -21, -7, -1, 19, -12, 4, 3, 10, 19, -2, 14, -7, 1, -15, 15, 3, -14, -5, -2, 8, -8, -12, -11, 9, 11, 6, 18, -2, -12, -3, 0, 19, 30, 2, 19, 15, 25, 31, 17, 8, 7, -3, -14, 4, -14, -12, 2, -11, -1, -6, 3, 3, 2, -2, 14, 2, 19, 12, 39, 25, 47, 28, 15, 20, 25, 34, 2, 16, 7, 4, 12, -18, 9, -8, -6, 13, -1, -3, -19, 5, 13, 0, 13, -9, 3, 4, -3, -8, 10, 8, 14, 11, -7, -1, 9, 6, 14, 2, -3, -16, -9, 9, 4, -4, 21, -6, 18, 0, 5, 4, 3, -9, 6, 3, 5, -4, -2, 19, 11, 13, 20, 16, 18, 17, -9, -11, 11, 7, 7, 15, -1, -8, 15, 22, 18, -1, 6, 14, 9, 1, 4, 0, 11, 15, 23, -2, 16, 13, -2, -2, -2, -8, 9, -3, 21, 18, 13, 10, 18, 6, 5, 12, -5, 18, 13, 13, 9, 20, -4, 23, 29, 34, 9, 30, 8, 3, 6, 17, 8, 30, 16, 1, 18, -9, -8, -3, 9, 21, 2, 7, -8, 1, 10, 4, 12, -3, 5, 5, 29, 29, 33, 11, 28, 9, 17, 2, 1, 8, 11, 23, -3, 10, 8, -1, 21, 10, 6, -12, 15, 6, 5, 13, 0, 17, -20, -18, 0, -16, 9, -12, -16, -5, -19, -4, 3, 1, -5, -16, -6, -30, -8, -2, 10, 2, 1, -6, -2, 4, 31, 37, 6, -10, -18, -25, -11, -11, 20, 6, 1, 15, -18, -8, -21, -36, -40, -41, -21, -35, 4, -13, 8, 17, 11, 6, 21, 12, -9, -12, -15, 9, 5, -2, 1, -16, -8, 5, 30, 10, -6, -17, -41, -50, -50, -31, -22, -25, -17, -5, 12, 2, 12, 19, 21, 42, 17, 3, -16, -6, -6, -11, -13, 6, 14, 41, 18, 22, -24, -19, -31, -49, -60, -22, -39, -13, -19, 11, 6, 8, -2, 6, 10, 28, 15, -17, 1, -27, -17, -25, -12, -22, 8, 24, 51, 23, -16, -58, -56, -62, -51, -21, -46, -19, -7, 1, -11, -2, -3, 24, 24, 31, 10, -13, 3, -36, -46, -41, -22, -3, 28, 71, 58, 4, -50, -63, -39, -45, -35, -24, -38, -13, -30, 2, 14, 7, -4, 3, 8, 15, -24, -23, -25, -62, -58, -29, 12, 31, 63, 63, 12, -34, -64, -38, -44, -24, -38, -7, -47, -18, -25, -7, 12, -10, -11, 2, 15, -3, -26, -52, -31, -65, -28, 18, 28, 34, 55, 56, -19, -77, -64, -35, -36, -1, 0, -22, -19, -57, -26, -21, -12, 7, 22, 23, 6, 6, -27, -33, -33, -35, 21, 33, 59, 43, 27, 2, -50, -28, -42, -5, 10, -19, -11, -16, -1, -43, -41, -9, 18, -1, 5, 20, 15, -6, -13, -18, -35, -14, 36, 57, 20, 24, 13, -11, -46, -14, -6, 5, 12, 22, 6, -4, 15, -29, -18, -13, 4, 0, 21, -8, -6, -11, 0, -31, -20, 6, 21, 51, 24, -6, -30, -14, -43, -17, -20, -5, 24, 33, 40, 5, -2, -11, -2, -15, 3, 17, 15, -1, 9, 6, -18, -14, -17, 14, 46, 40, 14, 12, -7, -5, -14, 2, -1, 10, 27, 27, 27, 40, -5, -25, -16, -21, 16, 13, 13, 9, -10, 0, -11, -9, -10, 8, 30, 30, 47, -12, 5, -23, -24, -9, -15, 16, 10, 4, 5, 38, 21, -15, -20, -2, 12, -4, 10, 12, 11, -11, -19, -38, -25, -11, 36, 40, 22, 5, 20, -21, -20, -7, 2, 6, -2, 19, 24, 35, 18, 3, 0, 3, 16, 11, 15, -12, 17, 6, -30, -28, -40, -19, 22, 24, 25, 8, 24, -20, -16, 11, 16, 24, 17, 4, 19, 28, -9, -40, -20, 0, 12, -12, -1, 10, -5, -29, -40, -22, -14, -11, 2, 0, 2, 26, 1, 12, 5, -1, -12, 19, 17, -4, 21, 12, -15, -23, 8, -3, 5, -3, 7, 14, -17, -33, -33, -16, 7, -30, -12, 11, 11, 22, -8, 9, 11, 13, -11, 1, -12, 2, -10, 5, -12, -5, 1, -3, 13, 5, 0, 2, 13, -38, -39, -34, -31, -21, -28, -23, -22, -12, 5, 6, 17, 13, -5, 13, -7, -1, -6, -25, 2, -4, 1, 12, 4, -7, 15, 12, -5, -15, -24, -37, -42, -12, -29, -10, -22, 10, 0, 15, 6, -7, -21, 19, -7, -5, -20, 11, -16, -2, 15, 9, 17, 0, 22, -12, 4, -15, -18, -32, -20, -21, -9, 6, 9, -9, -10, -5, 17, 14, -6, 26, -1, -19, -10, -24, -2, 9, 9, 14, 5, -8, -3, 0, -4, 8, 23, -4, -9, -3, -12, -5, 12, -18, 10, 6, 15, 7, 37, -20, -22, -29, -18, 9, 8, 12, -4, -7, -9, 15, 19, 15, -6, 8, -4, 11, 33, 21, 30, 24, 23, 15, 13, 18, 38, 19, -10, 1, 17, -9, 8, -5, 1, -6, 14, 16, -8, 14, -5, -5, 0, 14, 20, 4, 3, 8, 20, 14, 18, -16, 10, -2, 27, 10, 16, -6, -7, 11, 17, 6, 0, 6, 6, 18, 6, 10, 14, 5, 18, 15, -8, 4, 4, -1, 6, -8, 0, 21, 4, 11, 1, 4, 10, -2, 20, 20, 2, -1, 6, 20, 5, 0, -4, -9, 4, -6, -15, -18, -14, 12, -7, -10, 2, -17, 12, 3, -6, 5, -14, -6, 9, -7, 10, -16, -16, 2, 2, -4, -4, -16, -1, -4, 12, -18, 10, 1, -15, 4, 3, 15, 0, -17, -11, -11, -5, 14, 8, 11, -11, 9, -6, 9, -18, -13, -7, 3, 0, -18, 3, 11, 9, -3, -10, 2, 6, 15, -2, 20, -4, 5, -5, 6, 8, 15, -1, 14, -8, 13, -1, -13, 1, 11, -1, -4, -17, 9, -7, -12, -11, -11, 5, -11, 5, -6, -6, 7, 9, 28, 30, 18, 24, 2, -10, 1, -4, -11, -15, 4, 8, 0, -17, 10, 7, -4, -2, -19, 13, 13, 11, 17, 4, 3, 24, 37, 9, 26, 21, -9, 7, -26, -11, -23, -7, -13, -27, -19, -27, -23, -18, 8, 2, 2, -15, 10, -18, 13, -6, -7, -11, 15, 1, 24, 0, 25, -1, 10, -5, 7, -2, -18, -3, -35, -15, -35, -36, -24, -18, -6, -17, -11, 2, -3, -14, 10, -5, 16, -6, -8, 16, 3, 25, 23, -7, 23, 5, 31, 36, 31, -6, 8, -10, -5, -23, -11, -41, -36, -6, -13, -4, -13, 4, 12, 17, -3, 0, 20, 4, 22, 2, 6, 9, 43, 19, 38, 25, 30, 14, -21, -18, -10, 5, -2, -18, -32, -13, -20, 8, -4, -3, 3, 3, 26, 9, -9, 23, 23, 20, 23, 30, 46, 28, 42, 34, -8, 21, 7, 8, -8, -18, 12, -24, -41, -14, 3, -1, -18, -5, 19, 6, 27, 2, 1, 8, 20, 7, 21, -1, 11, -5, 10, -11, 4, 0, 19, 4, 5, -14, 13, -20, -16, -32, 3, -17, 2, 5, -4, 9, 7, 6, 34, 20, -9, 14, 8, -2, -48, -26, -31, -7, 5, 15, 10, 0, 26, 18, 13, -11, -5, 2, 4, 9, 15, 4, 17, -1, 7, 1, -3, -14, 5, -22, -34, -46, -54, -59, -41, -12, -3, 23, 30, 21, 29, 0, 20, 13, -6, -16, -17, 1, 7, -17, 17, -17, -26, -24, -15, -16, -39, -37, -21, -52, -47, -44, -12, -4, 12, 22, -3, 1, 1, -6, -7, -3, 12, 6, -11, 12, -12, -6, -8, -8, -8, -30, -32, -35, -15, -27, -38, -56, -30, -11, 4, 1, -2, 16, 8, -4, -18, -15, -20, -11, -10, -4, -10, 16, -9, -13, -17, -1, -30, -26, -26, -24, -19, -9, -15, 0, -12, -9, -6, 11, 31, -1, 22, 5, 15, 13, -18, -20, 12, 5, 11, -3, 10, 10, 1, 8, -7, -5, -15, -5, -11, -12, 6, 2, 7, -10, 18, 10, -9, -7, -2, 11, 1, 11, -16, -11, 3, 7, -7, -2, -7, 10, 14, 0, -15, -12, 7, -1, -18, -25, -16, -9, 0, 3, 0, 1, 2, -5, 15, 19, 6, 15, 6, 10, 1, 28, 18, -9, -17, 15, 17, 2, 21, 4, -12, -4, 2, -6, -11, -11, -2, 20, -5, -11, -2, -6, -7, -9, -21, 4, -12, -6, 24, 16, 12, 3, -7, -10, 2, 34, 10, 17, -9, -17, 10, -3, -12, 14, 15, 12, -6, 13, 2, 10, 11, 17, 0, 3, -13, -10, 12, 1, 2, -3, -9, 11, 11, -2, 3, 20, 8, -2, -10, -7, -3, 20, -2, 13, 9, 4, -3, 11, 12, 12, -10, -17, -7, -4, -8, 16, -8, -2, -15, -16, 11, 25, 19, 26, -4, 27, 1, 9, 4, -12, -8, -10, -6, 12, -2, -4, -8, -9, -19, -11, -26, -12, -13, 10, 7, 14, 2, 3, 7, 20, 6, -14, 3, 8, 2, 6, -5, -11, 18, 4, -5, 1, 11, -11, 11, 7, 0, -28, -21, 3, 2, 2, 5, -3, 13, 13, -6, 0, 10, -6, 6, -13, 3, 2, -1, -13, -11, -5, -18, 7, 15, -18, 0, -4, -9, 1, 10, 10, 13, -10, -9, 6, -13, 11, -10, 9, 21, 20, 29, 24, 4, -14, -23, -14, -24, -4, -22, -3, -11, -8, 6, -11, 0, -18, 1, 13, 2, 12, -8, -6, -13, 7, -10, 1, 12, 7, 35, 15, -9, -20, -5, -5, -17, -26, -3, 4, -5, 3, -23, -3, -16, -1, -11, 2, 0, -12, -11, 0, -5, 12, 15, 5, -10, 3, 24, 12, 34, 24, 28, 7, 15, 6, 21, 12, 5, 21, 14, 16, -5, -13, -14, -7, 0, 5, -6, 12, 8, 0, -14, -4, -10, -18, 2, -4, 1, 1, 2, 19, -11, 23, 32, 36, 33, 25, 34, 27, 0, 12, -17, 8, -2, 13, -16, 8, -1, -11, 13, -9, 13, 5, 11, -9, -3, 6, -6, 10, -3, -3, 17, -11, 8, 12, -1, -8, 13, -12, -16, -7, 2, -3, 15, 5, -25, -13, -18, -7, -6, 0, -4, -6, -24, 3, -28, 3, -21, -24, -2, -19, -18, -5, -2, -10, -12, 2, -17, -3, 1, -10, -11, -28, -3, -15, 0, -27, 3, -25, -13, -27, -20, 1, -3, -9, -7, -14, -4, -4, -33, -11, -3, -24, -5, -12, -27, -17, -8, 3, -27, -19, -29, -20, -20, -2, -29, -19, -2, -11, 1, -2, -3, -23, -7, -8, -5, -10, -31, -28, -1, -23, -6, -28, -14, -13, -15, -15, 2, -5, -7, -8, -7, -14, -2, -16, -10, -23, -28, -20, -1, -1, -6, -28, -25, -8, -4, 2, 15, 0, 10, 0, -1, 6, -24, -20, -20, -22, -29, -20, -28, 2, -12, -18, -30, -5, 2, -12, 9, 7, 22, -6, 16, 6, -10, 11, 1, 10, -13, 19, -5, -10, -6, 0, -19, -8, -13, -11, -9, -10, -26, -17, -18, -2, 13, 4, 19, 5, 9, 17, 0, -16, 14, 15, 12, -11, -1, 9, 25, 3, 3, 6, -3, -28, 0, -10, -23, -1, -8, -13, -22, 18, 4, 22, 10, 2, 19, -9, 17, 12, 3, 10, -19, -9, -7, -16, 13, 12, 22, -4, -15, -17, -17, -3, -22, -4, -5, 2, 18, 16, 15, 26, -9, 10, 7, -5, 0, -7, -3, -16, -11, -2, -9, 1, 7, 30, 37, 17, -11, -9, -29, -11, -28, -29, -14, 22, -8, 0, 30, 18, 22, 21, -9, -22, -12, -33, -12, -24, -9, -23, 14, 4, 22, 21, 42, 14, 2, -15, -15, -14, -28, -26, -1, -12, -15, 7, -4, 21, 14, 23, 8, -11, -30, -40, 1, -20, -25, -11, 8, 28, 7, 27, 1, 22, 11, -27, -4, 0, -16, -11, 0, -12, 2, 3, 5, 4, 5, 23, 0, -31, -15, -11, -32, -15, -31, 2, 7, 13, -13, 1, 20, 10, 4, -28, -29, 3, -4, -10, -23, 20, -2, -11, 7, 36, 14, 5, 34, -10, -25, -19, 3, 9, -1, -2, -16, -36, -16, -11, -22, 10, -5, -17, -20, 2, -12, -23, -24, 13, -22, 6, 11, 13, 18, 17, 27, 16, 8, 1, 11, -19, -5, 13, -3, -15, -33, -42, -14, 7, -14, -14, -3, -20, -19, -24, -36, -6, -21, 3, 0, -4, 21, 13, 39, 29, -1, 0, 20, 7, 2, 13, 2, -11, -17, -34, -30, -25, -3, -13, -1, -16, 0, -22, -9, -12, -8, -21, 3, 19, 19, 12, -2, 26, 19, 17, 6, 7, 21, 19, 2, -5, -24, -4, -34, -11, 0, -21, -5, -13, -20, -8, 10, -6, 17, -18, 5, 15, 5, 4, 18, 10, 12, 27, 32, 23, -7, 19, 0, 2, -12, -9, -16, -15, -25, -6, -28, -6, 1, 3, -4, -10, 0, 0, -16, -4, -16, 0, 15, 30, 11, 13, 1, 10, 16, -2, 21, 16, 1, 6, -14, -2, -1, 0, 4, -10, -11, -18, -8, 1, 30, -8, 8, -17, -21, 0, 13, 6, 14, 13, 27, 18, 16, 7, 10, 9, 11, 19, -5, -5, -22, -17, -24, -13, -5, -16, 4, 26, 19, 16, 4, -21, -20, 20, 39, 3, -6, 16, 5, 16, -1, 11, 23, -8, -7, -4, 1, -28, -28, -28, -16, -13, -26, -18, -3, 12, 3, 10, 11, -6, 9, 19, -1, 10, 15, -10, 7, -11, 1, -20, 3, 9, -13, -5, -23, -17, -25, 0, -3, -16, -11, -4, 5, -6, 4, -9, -9, 3, 12, -6, 14, -8, -9, -4, -7, -5, -2, -13, 15, -4, 6, 11, -29, -15, -26, 2, -21, -19, 3, 6, -8, -13, -11, -22, -1, -10, -15, 12, 12, 13, -6, -3, 8, -5, 12, -14, -8, 13, 2, -6, -5, -15, -13, -2, -16, -27, -7, -8, -14, -15, -19, -28, 1, -17, -2, 14, -9, -6, 1, -2, 15, 5, 19, 11, -7, 6, 16, 11, -22, -10, -11, -27, -2, -8, 0, 0, 3, -18, -27, -20, 12, 20, 1, 10, 3, -2, -10, -5, 7, 8, 26, 6, 28, 4, 6, 8, -6, 4, -2, -22, -11, -4, -6, -3, -12, -21, -18, -6, 2, 36, 7, 42, 28, 25, 36, 12, 36, -14, 4, 0, 0, -1, -2, -2, 4, -13, -23, -12, -17, -30, -29, -4, -7, -31, -17, -15, -13, -14, 22, 20, 10, 12, 16, -1, 15, 16, 2, -23, -10, -9, -3, 4, -2, -1, -5, -9, -13, -11, 1, -10, -4, -27, -29, -20, -18, -41, -20, -25, -5, -35, -23, -13, -32, -32, -41, -39, -11, -7, -28, -8, -17, -7, -19, -17, -4, -15, -6, -18, -21, -10, -10, -3, -26, -16, 1, -18, -3, -18, -27, 1, -21, -2, -1, -32, -1, -20, -29, -5, 1, -26, -5, -12, 3, -17, 5, 6, 5, -17, -3, -17, -8, -14, 1, 0, -1, -19, -8, -3, 1, -10, -13, 0, -23, -21, 4, -12, 5, -7, -17, -11, 3, -21, -17, -19, 8, -5, 7, -17, -13, -16, -24, -1, -24, 5, 2, -8, -11, -5, 2, -25, -3, -4, 5, 4, -13, 1, -17, -15, -18, -24, -24, 8, -15, -6, -9, -18, -10, 3, -30, -24, -25, -18, -24, -9, -8, -26, 2, -20, -18, 3, -1, -21, -16, -9, -16, -19, -21, -19, -10, -26, -4, -7, -27, -9, -16, -11, -33, -23, -21, -18, -19, -11, -6, -25, 8, -17, 11, -6, 12, -19, -3, 1, -17, -1, -14, -23, -15, 3, -20, -26, -14, -23, -12, -28, 4, -6, -12, -15, 8, -2, -10, 5, -21, -18, 8, 7, 4, -5, -8, 6, -22, -25, -4, -7, -8, 5, -27, -24, -21, -31, -30, 11, -14, 1, 9, 7, 8, -14, 21, -2, -2, 9, 5, 0, 12, 8, 11, 13, -2, -8, 2, -22, -19, -21, -7, -10, -6, -12, 1, 17, 0, 32, 26, 2, -12, 6, -17, 3, -1, 22, 1, 12, 11, 13, 19, 23, 9, 2, -12, -20, -4, -15, -13, -22, -26, 11, 29, 12, 19, 32, 11, -21, -7, -24, -24, -7, 10, -9, -3, 22, 3, 18, 14, 35, 15, 0, -11, 3, -16, -28, -31, 8, -13, 10, 12, 4, 14, 23, 1, 1, -32, -7, -25, -16, -8, -12, 16, 27, 30, 29, 48, 36, 0, 8, 5, -24, 1, -5, -14, 0, 3, -1, 4, 16, -7, 14, 1, -16, -30, -39, -25, -6, 9, -10, -9, 6, 3, 35, 49, 47, -5, -2, -9, -11, -7, -18, -21, -3, 7, -3, 19, 33, 13, 25, 5, -21, -37, -16, -41, -28, -27, 2, -29, -13, 18, 5, 20, 21, 13, -11, -24, -15, -17, -8, 2, -1, 8, 17, 9, 0, 18, 0, 31, 21, -1, 0, -11, -25, -19, -15, -31, -33, -30, 13, 25, 28, 17, -23, -11, -21, -18, -17, -25, 7, 17, 8, 23, 19, 14, 25, 38, 24, 14, 27, 4, 1, -16, -17, 7, -10, -4, -6, -9, -8, -3, 3, -5, 6, -7, -9, -20, -3, 8, 4, 0, 22, 14, 26, 27, 14, 1, 24, 6, 15, 12, -11, 19, -22, -12, -19, -44, -28, -24, -12, -10, -21, -5, -27, 0, -5, 0, 16, 16, 3, 33, 9, 21, -4, 4, 30, 30, 17, 23, 21, -19, -23, -23, -15, -20, -9, 0, -21, -10, -12, -6, -21, -7, -25, -14, -22, 22, -2, 4, 15, 2, 25, 28, -7, 17, 24, 20, -6, -32, -32, 2, -22, -24, -35, -7, -18, -25, -18, -18, 2, -39, -37, -21, -12, -6, 6, -6, 6, 9, 22, 27, 1, 31, -2, -14, 4, -12, -29, -14, -12, -16, -8, -21, -13, -3, -17, -20, -14, -20, -5, 0, -29, -14, 6, -5, -10, -8, -7, 28, 14, 18, 8, 4, -10, -18, -14, -29, 3, 2, -12, -7, 0, -5, -21, -8, -17, -8, -2, -8, -9, -6, -28, -15, 4, 7, 0, 16, 0, -10, -30, -4, -4, -10, 1, -7, 1, -1, -12, -5, 2, -6, -11, -3, 2, 0, -23, 3, -15, -21, -7, -35, -19, -5, -13, -10, 10, -15, -30, -10, -12, -7, -13, -14, -26, 6, -7, -12, 1, -17, -4, -18, -7, -10, -27, -30, -26, -26, -10, -15, -26, -29, -16, -23, 5, -6, 9, 10, 2, -2, -26, 8, -8, -2, -23, -14, -21, -14, -21, -18, -11, -27, -12, -9, 5, -25, -12, -4, -14, -25, -14, -6, -2, -13, 20, 0, 11, 26, -9, 7, 0, -15, -17, 7, -15, -20, -15, 4, 0, 1, -27, 3, -18, -3, -5, -9, 16, 2, 2, 15, 4, 10, -2, 2, 22, 9, -7, 0, -1, 11, 10, -8, 2, -15, -12, 1, -20, -6, -4, -25, -15, -6, -3, 9, -9, 9, 15, 29, 3, 19, 17, -4, 30, 19, 24, 0, -19, -9, -14, -7, 6, 4, -6, -25, -19, 0, -7, -5, -16, -5, 44, 14, 39, 35, 41, 22, 6, 10, 4, 5, 2, 4, -10, -6, -22, 0, -6, 8, -7, 1, 0, -10, 1, -25, -30, -33, 0, -19, -2, 2, -4, -10, 17, 6, 15, -11, -7, -11, -18, -6, 8, -9, 8, -10, 3, -20, -7, -15, -1, -14, 5, -1, -25, -14, -13, -21, -9, -31, -22, -30, -34, -16, -21, -14, -17, -30, -27, 1, -17, -23, -2, -21, -24, -6, -13, -3, -21, -12, 7, -1, 0, -5, -2, -18, -16, -3, -24, -12, -16, -23, -15, -18, -14, -26, 0, 6, -23, -22, 7, -7, -7, -2, 8, -15, -8, -17, 6, 15, -1, -7, -7, 10, 5, 2, -15, -1, 2, 17, -13, -11, 15, 1, -12, 11, 12, -13, 15, -11, 8, 14, -6, 12, 5, 10, -16, -13, 9, 13, 15, 12, 6, -6, -3, 16, 8, -12, 13, -3, -15, 1, -5, 4, 6, -10, 0, -13, -16, -8, 4, 1, 3, -4, 3, 17, -4, -8, 18, -8, -7, 11, 20, 20, 7, 26, 10, 0, -3, -1, 10, 25, 9, 22, -5, -11, 3, -15, -8, -9, 17, -10, 10, -12, -2, -3, 6, -2, -3, 1, 16, -7, 8, 5, -4, -3, 4, 10, 23, -1, -4, 3, 4, -7, -10, 10, 14, -16, -14, 11, -11, 19, 22, 25, 12, 13, 14, -7, -9, -16, -9, -6, 11, 2, 7, 16, 10, 29, 9, -5, -3, -25, -24, -8, 12, -15, -2, 8, 9, 25, 27, 26, 23, 4, -12, -11, -11, -11, 14, 17, 40, 49, 10, 14, -6, 6, 3, -18, 8, -7, -4, 1, 7, 12, 7, -15, 10, 15, 14, 30, 8, 12, 16, -26, -25, -19, -36, 15, 28, 33, 24, -12, -18, -35, -16, -14, -25, -32, 1, -2, -8, -3, -11, 18, 1, 27, 28, -4, 5, -19, -6, -22, -24, -19, -28, 12, 5, 24, 25, -15, -24, -37, -18, -34, -20, -12, -7, 7, -2, -8, -9, 8, -4, 32, 13, 7, 12, -21, -34, -28, -26, -20, -22, -10, 2, 27, 19, -13, -34, -49, -57, -30, -26, -16, -3, -14, -13, 13, 1, 10, 1, 26, 6, -6, 1, -7, -24, -15, -32, -37, -25, 16, 30, 44, -7, -36, -33, -54, -57, -49, -22, -27, -7, 2, -4, 1, 0, -14, -13, 1, -5, -26, -13, -32, -8, -36, -24, -20, 1, 13, 33, 29, -7, -14, -29, -50, -52, -22, -25, -27, -9, -16, 14, 0, -12, 3, -21, -3, -21, -43, -11, -33, -14, -32, -37, -3, 15, 37, 37, -5, -37, -47, -32, -31, -22, -28, -6, -38, -2, 6, 16, -11, 4, -4, 1, -10, -40, -32, -21, -1, -9, -15, -16, 6, 40, 21, 8, 2, -53, -59, -18, -26, -5, 4, 18, 4, 10, 10, -4, -8, 3, 8, -15, -23, -35, -23, -14, 11, -8, 3, -9, 28, 14, 12, 9, -9, -17, -20, -16, 9, 22, -11, 27, 29, 13, 11, -2, -8, -14, 12, 1, -22, -11, -19, -9, 15, 16, 1, 16, 35, 36, 38, 26, 9, -30, -13, 3, 10, 3, 4, 12, 7, 1, 3, 3, 9, -8, -16, -10, -11, -22, 5, 19, 23, 14, 14, 19, 45, 42, 39, 5, -2, -24, -1, 20, 10, 9, 35, 15, -4, 5, -4, 11, -7, -5, 3, 11, 4, -6, 42, 29, 22, 51, 7, 37, 9, 21, 41, 17, 11, 12, 10, 24, 18, 30, 18, 29, 12, 21, 0, 8, 5, -1, 0, 16, 5, 7, 24, 43, 13, 5, 25, 20, 8, 28, 30, -12, 6, 11, 16, 18, 2, 14, 38, 35, 15, 14, 15, -11, -14, -5, 2, -2, 9, -14, -2, 2, 7, 21, 2, -1, 13, 1, -20, 10, 1, -2, 39, 14, 21, 16, 10, 6, 10, 20, 2, -15, -14, -2, -5, -4, 1, -23, -16, 1, 4, 5, -9, -25, -27, -8, -16, 14, 16, 9, 20, 19, 18, 18, 22, -3, -2, 7, 5, 3, 13, -3, 13, 0, -20, -7, 11, 19, 15, 1, -14, 10, -24, -2, 5, 35, 10, 28, 20, 17, 34, 21, -20, -10, 1, -22, 2, -5, -1, -3, 2, -8, 6, -3, -4, -7, -5, 17, -2, -20, 9, -9, 29, 13, 14, 45, 21, 18, -15, -8, -23, -32, -16, -5, -10, -16, 14, -4, 15, 17, 1, 12, -4, -2, -10, -11, 14, 15, -12, 13, 7, 5, 10, 14, -14, 7, -1, 1, -14, -8, -23, -17, 13, 1, 14, -15, -14, 10, 2, -11, -10, -18, 4, -1, 11, -1, -5, 13, 3, 12, -3, 3, 1, -22, 0, -23, -20, -9, -23, 6, -15, 4, 14, 12, 17, 2, 2, -6, 5, 12, -6, -19, 3, -16, -14, -26, -10, -6, -8, -5, -37, -12, -17, -4, 1, 4, 12, -8, 14, 3, 13, 14, 8, -5, 5, 14, 2, -6, -8, -25, -30, -10, -14, -22, -16, -32, -19, -11, -37, -17, -10, -13, -19, -8, 4, 16, 10, 16, 11, -13, -13, 3, 8, 5, -17, 13, -11, 4, -16, -22, -26, -22, -35, -30, -30, -35, -10, -23, 1, -10, -16, -13, 13, 3, 13, -9, 10, -4, 2, 8, -15, 7, -3, -7, -2, 12, 1, 1, 9, 12, 1, 8, 17, 2, -11, 4, 3, -11, 12, 2, -9, -1, -4, 12, 15, 6, -4, -18, -3, 9, 15, 9, 12, -1, 0, -14, 14, -13, 7, -13, -4, -17, 9, 1, -11, -5, 11, -3, -8, 3, 0, 8, -13, 12, 9, 1, 12, -5, -2, -5, 14, 3, -12, 10, 2, 13, 4, 14, -3, -6, -9, 4, -1, -7, 2, 8, -4, 14, -3, 5, -11, 4, 10, -18, -4, -17, -14, 11, 17, 19, 4, -6, 10, 2, 9, -5, 16, 15, 5, -9, 5, 7, 15, -5, -3, -8, 11, -9, -4, -16, 3, -8, -15, -20, -14, -17, 7, 0, -4, 23, -2, 22, -17, 7, 14, -15, 7, -3, 4, -5, -8, 0, -8, 1, -1, -5, 0, -2, -4, 15, -8, 9, 1, -7, 4, 13, -16, 5, -22, -19, -32, -13, 1, -15, -14, -8, -1, -9, -2, -11, -26, -10, 7, 10, 7, 8, 13, 1, 9, -7, -5, 17, -3, 2, -2, -26, -17, -15, -15, -12, -1, 1, -6, -4, -29, -33, -32, -25, -4, -12, -14, -14, 15, 13, -13, 8, 8, 11, 17, 24, -2, -12, 8, 4, 9, -6, 1, 5, 1, -7, 4, -4, -26, -3, -5, -29, -38, -3, -24, -14, -2, -2, 6, 16, -7, 20, 18, 9, 20, 15, 3, -5, -1, 4, -29, -25, -3, 23, -7, -6, -13, -9, -12, -10, -14, 2, -2, 8, -4, 10, 6, 7, -5, 22, 16, -14, 17, 6, -5, -13, -26, 0, -11, 3, 6, -13, 0, -16, 11, -9, -36, -28, -34, -7, -8, -9, 8, 9, -12, 2, 5, 28, 1, -6, 10, -5, 19, 11, -8, -7, 10, -5, 15, 18, -3, 29, 9, -15, -9, -31, -13, -17, 0, -12, 5, -8, 11, 9, 3, 3, -2, -9, -1, -16, 6, -14, -16, -10, -4, -27, -5, 11, 38, 11, 13, 15, 1, 0, -20, -25, -29, -12, -8, -1, -5, -17, -22, -19, -1, 19, 5, 23, 17, -13, -17, -10, -18, -10, -21, -18, 20, 38, 3, 30, 5, -11, -38, -48, -13, 13, -17, 2, 1, 8, 6, -26, -13, 2, 22, 20, 15, -5, 7, -13, -33, -14, -33, 13, 31, 27, 6, 19, 15, -9, -7, -16, -16, -2, 14, -13, -10, -10, 6, -13, -9, 9, 20, 17, 16, 2, -7, -18, -31, -14, -28, 3, -1, 28, 20, 9, 4, 25, 15, 5, -1, -1, 2, -1, -17, -7, -25, 0, -6, 30, 14, 21, 30, 9, -1, -26, -16, -11, -18, 16, 32, 43, 13, 3, 31, 32, 16, -12, 4, -9, 5, -8, -18, -18, -22, -2, 2, 5, 15, 1, 33, 16, -15, -1, -25, -21, -3, 49, 39, 48, 27, 28, -3, -3, 3, 10, 9, -1, -4, -16, -19, -18, -18, -13, 13, 13, 25, 28, 7, 16, -16, -41, -8, 30, 40, 44, 49, 20, 29, 26, 2, 4, -11, 3, 18, -17, -13, -8, -10, -13, -1, 13, -5, -10, 25, 6, 14, -17, -47, -35, 3, 19, 41, 32, 29, 32, 32, 24, 17, -20, -7, 11, 18, 16, 15, 15, -16, -29, -12, -20, 10, -3, 12, 7, -4, -3, -22, -26, -3, 16, 26, 39, 42, 6, 6, -7, 10, -12, 19, 18, -5, -6, -6, -1, 11, -24, 1, -6, 6, -9, -8, -6, -11, -21, -12, 5, -6, 17, 19, 6, 8, 9, 3, 2, -18, -5, -7, -3, -13, -14, -17, -2, 3, 0, -4, 8, -13, -10, 1, -4, -2, 17, -10, -9, -8, -19, -3, -26, -14, -38, -43, -38, -9, 0, -12, -9, 7, 2, -4, -7, -13, -7, -11, 6, 4, -24, -4, -6, 11, 4, 2, -8, -17, 1, 2, -36, -24, -44, -46, -39, -36, -16, 7, -16, -1, 10, -16, -7, 5, -10, -23, -3, 16, 5, 15, 20, 8, 5, 13, -24, -18, 7, -4, -14, -23, -21, -36, -20, -8, -14, 11, 0, -5, 13, -4, -17, -18, -19, -22, -23, 20, 13, 19, 10, -11, -14, 11, -19, -1, -13, 3, 14, -26, -16, -25, -28, -4, -37, -1, -19, -3, -11, -19, 5, 14, -20, -2, -17, -2, -3, 6, 3, -8, -28, -25, -25, -1, 7, -4, 0, 7, -13, -32, -3, -27, -5, 10, -10, 14, -7, -6, 11, 6, -7, -4, 13, -10, -6, 8, -17, -26, -28, -10, -44, -25, -18, -1, 4, 0, -4, -6, -9, -4, 1, 5, -1, -12, 9, -13, -9, 4, 1, -3, -19, -5, -1, -4, 11, 21, 18, 13, 7, 17, 22, 20, 16, -3, -5, -12, 8, 13, -1, -7, -7, -13, -1, -19, 7, -17, 9, -5, 8, 8, 8, 7, -5, -9, -17, -13, 10, -13, -1, 12, 8, 7, -3, -3, 7, 11, 14, -5, 11, 13, 1, -2, -2, 0, -11, -18, 11, -15, -1, -11, 9, 4, 0, 9, 10, 1, 1, -10, -3, -10, -3, -10, 13, 10, 13, -14, 0, -19, 4, 11, 13, -9, 7, 0, 13, -18, 10, 5, 1, 10, 5, 11, 4, 1, -9, -14, -14, 7, 13, 10, 5, 1, -18, -18, 12, 1, -12, 0, 11, -6, -18, -13, -20, -8, 11, -12, -7, -4, -9, 4, -3, 12, 13, 11, 27, 8, 24, -4, 13, -17, -16, 8, -16, -19, 10, 7, 12, 5, -9, 1, 4, 1, 8, -14, -3, 10, -7, -15, 10, 7, -2, 11, 7, 10, 14, 23, 13, 23, 16, 12, -3, 2, -12, -12, 4, -16, 11, 13, -5, -12, -20, -8, 13, -10, 7, 2, -9, 12, 11, 24, 2, 19, 6, 23, 11, 14, 9, -9, 8, 1, -13, 2, 7, -7, 12, -3, -4, -20, -24, -10, 10, 22, -21, 1, 3, 14, 2, 18, 17, 13, 2, 3, 6, 35, 33, 16, 19, 10, 12, -2, -14, 12, -20, 7, -25, -28, -2, 18, 10, -1, -24, -24, -20, -33, -30, -42, -61, -51, -25, -25, -27, 8, 38, 37, -5, 3, 15, 12, -9, -13, -13, -21, -5, -1, 3, 24, -7, 22, 20, -34, -34, -34, -19, -42, -36, -45, -47, -42, -12, 15, 26, 23, 24, -10, -18, -2, 10, 9, -8, -31, 1, -28, 7, 8, 39, 0, -6, -17, -21, -49, -21, -44, -24, -28, -49, -5, -1, 6, 23, 34, 17, -14, 10, -16, 12, -8, -9, -25, -29, -31, -8, -5, -9, 17, 4, 4, -12, -43, -45, -24, -5, -32, -18, -25, 0, -14, -2, 14, -1, -10, 6, -1, 2, 10, -14, -14, -27, -45, -13, 18, 5, 10, -8, -11, -20, -42, -33, -15, -15, -8, 2, 1, -4, -3, -20, 11, -4, -12, -19, -1, -8, -20, -27, -24, -24, -12, -7, -1, 17, 4, 4, 7, -8, -49, -27, 6, -8, -14, -11, -16, -6, 2, -17, 20, -13, -3, -20, -19, -4, -4, -17, -37, -27, -24, -21, -16, 14, 7, 19, 23, 6, -47, -13, -1, -12, -4, -17, 7, 10, 13, 17, 5, 13, -9, -16, -12, -13, -14, -21, -21, -16, -15, -20, -16, -1, 23, 13, 44, 8, -41, -28, -9, -16, -13, 12, 22, -13, -2, 9, 7, -10, -13, -20, 7, -5, -12, -8, -38, 4, -18, 10, 1, 19, 27, 38, 21, -12, -27, -10, -20, -18, 2, -11, 2, 3, 12, 20, 1, -8, -11, -4, 9, -5, 14, 14, -1, -9, -20, 21, 10, 14, 8, 34, 37, -6, -1, 13, -13, 2, -12, -14, -11, 14, 7, 15, 0, 7, -21, -9, -2, -19, -6, 12, -13, -20, 15, -1, -5, 18, 0, 32, 20, 9, 23, 28, 7, -2, 1, 18, 24, 18, -5, 22, -10, 12, -17, -12, -15, -3, -18, -16, -24, 0, 12, 4, 7, 16, 8, 4, 12, 13, 14, -5, 3, -16, -2, 14, 3, 8, 8, 16, -6, -10, -13, -2, 1, -14, 6, -15, 12, 2, 19, 7, 10, -14, 8, 12, 33, 36, 14, 9, 21, 5, 12, 9, 3, -6, -17, -11, -6, 0, -9, -8, -2, 13, -8, -2, -16, -3, 12, -1, -5, -1, 29, 25, 39, 15, 12, 28, -12, -5, -16, -19, -6, -3, -15, 1, -25, 1, -18, -20, 1, -14, -6, -6, -13, -8, -16, -26, 11, 32, 11, 34, 36, 19, 13, -2, -11, 16, 16, -13, 21, 12, -18, -30, 1, -17, 0, 13, 0, 5, -5, 11, 3, -8, -21, -33, 2, 28, 41, 37, 12, 34, 10, 8, -7, 6, -9, 12, 27, 26, -11, -13, 0, -10, -9, -11, 12, -19, -3, 9, 10, -12, -37, -18, -19, -20, 12, 31, 19, 25, 19, 14, 26, 13, -8, 20, -11, -3, -15, -26, -26, 1, 13, 4, 2, 7, -20, 10, -22, -20, -40, -50, -25, -30, -10, 9, -12, -2, 5, 19, 6, -18, -19, 0, -14, -28, 1, -31, -18, 3, 6, -3, 2, -11, -17, -13, -12, -21, -23, -61, -56, -7, -26, -33, -11, -1, 1, 1, -3, -32, -22, -27, -27, -36, -19, 3, 3, 7, -8, 6, 3, 12, 3, 12, -3, -23, -12, -25, -39, -49, -24, -32, -20, -35, -38, -3, -2, -34, -12, -39, -14, -7, 7, -22, -18, -2, 1, 10, 2, 8, 1, -10, -10, 1, -19, -21, -23, -39, -31, -28, -43, -32, -48, -17, -39, -19, -35, -33, -16, -7, -12, 10, -10, 5, -2, 6, -6, 7, -20, 3, 1, -9, -2, -22, 2, -8, -8, -11, -1, 9, 4, -1, -22, 0, 1, 11, 6, -22, -3, -5, 10, -8, 10, 8, -6, 20, 2, -1, -10, -7, 21, 7, -1, 3, 3, 15, 8, -7, 6, 11, 11, 24, 15, 15, 7, -6, 10, -9, 5, -5, 14, 7, 14, 16, 0, 13, 19, 1, 22, -3, -10, 16, 20, -7, -5, 16, 1, 9, 13, 6, -1, 19, -8, -6, 16, -7, 3, -5, 1, -7, 0, -4, 0, -5, 21, -9, 2, 7, 5, 7, -7, 19, 13, 29, 8, 34, 20, 7, 11, 3, -11, 2, 17, -5, 20, 14, 19, 15, 15, 19, 21, -1, -5, 21, 5, 4, 0, 8, 21, 8, 22, 36, 33, 38, 12, -7, -3, 4, -28, -5, 1, -16, 10, -4, 13, 5, 14, 22, -3, -5, 18, -3, -4, 1, 17, 6, 14, -5, -4, 0, -6, 10, 33, 18, 14, 21, 21, 9, -14, -20, -22, -12, -11, 8, -4, 9, -4, 2, 16, -5, 6, -29, -25, -18, -23, -20, -37, -46, -52, -28, -3, 41, 28, 16, -5, 38, 24, 13, 2, -22, -12, 4, -6, 9, 17, -2, 16, -10, -20, -21, -49, -34, -28, -25, -34, -29, -40, -32, 8, 46, 44, 12, 14, -3, 2, 10, -4, 5, 6, 14, -10, 16, -4, 8, -8, -16, -14, -29, -34, -10, 16, 6, -22, -15, -39, -12, 12, 54, 52, 52, 19, 25, 15, -28, -38, -15, -6, -1, 3, 5, 20, 4, -8, -10, -8, -15, -12, 0, 14, 15, -21, -43, -61, -42, 37, 64, 41, 23, -13, -23, -4, -10, -32, 6, -12, -4, 17, -8, -2, 8, -13, -12, -24, -20, 2, 25, 11, 17, 0, -70, -83, 2, 57, 56, 7, -2, -43, -37, 2, -12, -28, -16, 1, 5, 9, -5, 20, 8, 13, 22, 4, 2, 8, 10, 10, 7, -10, -73, -49, 16, 64, 40, 22, -7, -42, -25, -37, -14, -23, 5, 14, 21, -7, 9, 16, -5, -1, 24, 22, 19, 0, 30, 20, 3, -34, -63, -22, 33, 66, 21, 22, -31, -15, -8, -32, -18, -25, 5, -7, 10, 15, 22, -10, -5, 18, 11, 1, -14, 18, -7, -26, -33, -25, -47, -21, 30, 54, 36, 6, -24, -22, 2, 6, -7, -5, 21, 6, 14, 3, -6, 9, 7, 9, -7, -11, -26, 0, -5, -32, -23, -7, -12, 18, 9, 46, 19, 3, -5, 25, 6, 3, 0, 33, 26, 32, 4, 8, -4, 16, 5, 3, -5, -38, -40, -26, -40, -35, 22, 30, 4, 12, 23, 34, 27, 6, 1, 14, 5, -14, -4, 22, 26, 24, 12, 4, -5, 17, -3, -3, -17, -33, -26, -41, -24, 22, 47, 53, 43, 23, 20, 16, -5, -21, -10, -30, -40, -2, 14, 1, -2, -5, 3, 10, 8, 7, 9, -31, -40, -18, -45, -31, 8, 49, 61, 34, 20, -1, -5, -13, -37, -63, -31, -61, -39, -42, -19, -15, 14, 8, 23, 16, 9, 22, -11, -21, -15, -10, -36, 11, 40, 45, 64, 25, 16, -8, -16, -55, -59, -53, -39, -51, -22, -39, -23, 35, 22, -4, 9, 11, -10, 9, 6, 4, -36, -33, 5, 32, 57, 79, 48, 48, -3, -31, -48, -40, -17, -18, 0, -9, 5, -8, 16, 12, 23, 17, 21, 13, -7, -10, 21, 41, -1, -4, 21, 23, 74, 44, 46, 2, -11, -52, -50, -29, -15, -3, 1, 7, 9, 33, 14, 19, 30, 0, -3, 9, 11, 9, 31, 25, 6, 7, 36, 48, 27, 22, 12, -14, -17, -32, -45, 0, 20, -3, 18, 6, 21, 10, 25, 28, 15, 0, -7, 6, -5, 3, 20, 39, 41, 0, 18, 22, -3, -3, -13, -8, -4, -28, -27, -2, 25, 18, 24, 47, 9, 4, 19, 14, 2, -1, 19, -7, 15, 22, 1, 19, 61, 47, 17, 0, -15, -32, -6, -22, 7, -6, -10, -1, 1, 17, 32, 33, 34, 6, -12, -1, -9, 19, 8, -8, 20, -5, -19, 10, 17, 17, 7, -7, -11, -5, 17, 13, 25, 1, -29, -25, -15, 6, 19, 20, -3, 2, -21, -12, -4, 21, 20, 18, 18, 16, -19, -17, -18, -21, -30, -25, -30, -23, 5, 33, 43, 3, -6, -25, -24, -15, -9, -9, 13, 5, -15, 20, 13, -4, 11, 2, 15, 18, -8, 9, -16, -6, -10, -17, -14, -10, 2, 36, 25, 10, 8, -22, -20, -41, -45, -21, -32, 1, 4, -10, 18, 23, 11, -10, -1, 19, 4, -6, 4, 18, 8, -14, -17, -12, 5, -7, 3, -14, -34, -9, -7, -20, -20, 2, -21, 3, 17, 20, 6, -10, 2, -9, 15, -5, -2, 23, 8, -6, 20, 20, 20, -10, 13, 7, -4, -1, 6, 21, 22, 9, -1, 19, -8, -12, 10, -10, -7, 16, 11, 6, 18, 5, -6, -12, 18, -12, 13, 12, 17, 14, 10, -10, -16, 3, 5, -9, 13, -13, 15, 2, 2, -7, -1, 3, -15, -9, 13, 11, -5, -11, 16, -15, 15, 14, 15, 6, 3, 7, -8, -15, -11, -6, -3, 8, 8, 15, 15, -5, -7, -3, -12, 5, 8, 5, 12, 0, -10, 16, 11, 2, -7, -3, 17, 11, 14, 13, 14, 10, 8, -1, 7, -4, 18, -1, -1, 9, 0, 2, 5, -3, 15, 0, -15, -1, -6, -6, -2, 2, -3, -12, 3, 4, -15, -1, -5, -24, -28, -12, 2, -2, -9, -26, -19, -20, -16, -9, -8, 17, -14, -5, 9, -12, 13, -9, 9, 18, 0, 12, 15, 8, 1, -4, -12, -7, -11, -41, -32, -11, -22, -20, 9, 12, 11, 4, 14, 2, -10, 11, 12, -13, 13, 15, -7, 14, -8, 21, 17, 39, 23, -7, -12, -7, -27, -7, -10, -7, -20, -40, -31, -4, 6, -11, 16, 5, -3, 0, -8, -4, -2, -7, 2, 15, 22, 31, 34, 23, 8, 3, -6, 20, -13, -24, -7, -32, 4, -27, -33, -4, -11, -3, 30, -5, -17, -4, -10, 5, 4, 19, 19, -3, 4, 4, 38, 30, 39, 10, 3, -8, -26, -29, -29, -19, 4, -6, -18, 7, -2, 9, -3, -18, -14, -7, -8, -8, 8, 8, 19, 14, 26, 38, 27, 12, 26, 6, -7, -24, -33, -20, -22, -27, -15, -14, -25, -2, -8, 7, -2, -15, -16, -5, -13, 15, 9, 5, -11, 9, 12, 24, 27, 1, 18, 17, 15, -7, -34, 2, 8, -5, 2, -8, -22, 11, -5, -12, 4, 2, -19, -15, 2, -7, -4, 12, -16, 1, -2, 18, 12, 4, 2, 22, -8, -33, -6, -30, -5, 14, 19, 23, 0, -6, 0, 2, -16, -11, -3, -14, -14, -8, -3, 18, 18, 12, -10, -15, 3, -9, 1, 32, -1, -23, -26, -22, 17, 17, 25, -6, 9, -18, -25, -15, -18, -14, -31, -9, -3, 10, 2, 17, 13, -8, -1, -19, 4, 13, 20, -3, -11, 2, -15, -39, 7, 15, 7, -5, -5, 9, 18, -12, -20, -22, -26, 9, -8, -5, -15, 14, 1, -17, 2, 27, 14, 23, -8, 13, -18, -23, -20, -12, 19, 27, 9, 26, -4, 11, 41, 23, -16, -19, -4, -4, -5, 18, -5, -3, 8, 19, 16, 31, 24, 13, 1, -7, -7, -13, -24, 10, 16, 36, 27, 6, 27, 32, 11, 24, 11, 3, -10, -2, -4, 16, -2, -3, -7, -4, 11, 20, 10, 4, -29, -23, -39, -33, -26, 20, 23, 21, 19, 17, 28, 5, 12, 27, 14, -34, -16, -14, -14, 8, -4, 10, 11, -1, 21, 23, 5, 4, -7, -51, -54, -20, 4, 37, 31, 31, 7, 21, 25, 21, 3, -17, -13, -28, -17, -21, 7, -4, -12, 15, 8, -5, -8, -15, 11, -31, -54, -50, -58, -12, 10, 27, 19, 25, 8, 27, -21, 11, -11, -23, -17, -8, 14, 0, -8, -5, -8, -9, -12, 2, -6, -16, -40, -46, -71, -69, -40, 22, 31, 41, 37, 17, 1, 3, -20, -11, -36, -17, -21, -10, 5, -12, -14, -13, -5, 13, -20, -5, -37, -26, -16, -27, -71, -82, -4, 9, 39, 19, 12, 4, 13, 2, -12, -14, -53, -53, -51, -13, -20, -16, -3, -5, 3, 15, -19, -17, -17, -32, -24, -41, -55, -47, 10, 16, 34, 30, 13, 37, 11, -5, -2, -43, -22, -55, -36, -29, -9, -6, 15, -1, 14, 6, -11, -20, -34, -26, -45, -31, -15, -24, -1, 3, 2, 33, 25, 4, -1, 14, 5, -22, -13, -30, -14, -21, -2, -2, 17, 2, 4, 1, -9, -17, -20, -11, -18, -13, -19, -4, -16, 9, 0, 0, 13, 10, -3, -4, -1, -15, -3, -14, -7, 5, -6, -11, 13, 6, -10, -4, 0, 2, -1, -18, -22, -20, -22, -24, -27, -9, -6, -6, 3, 16, 0, 6, 9, -9, 22, 6, -29, 7, 14, 5, -10, -7, -14, -10, -14, -8, 12, -4, -31, -38, -11, -17, 1, -9, -9, -20, 3, 5, -15, -6, -9, -3, 15, -5, -20, -1, 14, 6, 7, 13, 9, 16, 2, 3, 8, -9, -27, -19, 0, -27, 9, -31, -7, -12, -24, -8, -9, -13, -20, -5, -17, -10, -10, 10, 2, 12, 18, 17, -13, -6, 6, 13, -16, -16, -4, -13, 5, 7, -31, -32, -31, -34, -13, -26, -27, -2, -24, -13, 2, 10, 12, 1, -2, 10, 8, -16, 8, -6, -10, -10, 13, 11, -9, -3, -9, -13, -16, 14, 4, -6, 12, -7, 15, 17, -14, 9, -6, -5, 12, 0, 17, -5, 6, 11, 8, -1, 13, -10, 5, 2, 3, -12, 0, -11, -4, 6, -11, -12, -11, -19, -7, -8, -3, -14, 13, -15, -4, -10, 4, -14, -8, -6, 11, -13, 9, 11, 0, 12, 0, -1, -13, -11, 15, 8, 4, -12, 8, -14, 11, -10, -1, -10, 11, -3, 0, 12, -3, -1, -2, -7, 14, 13, 8, 2, -13, -13, 9, 3, -17, 3, -11, 3, 4, -1, 0, 2, 28, 14, 25, 1, -14, 4, -15, 11, 12, -14, 3, 6, -3, 13, -1, -10, -16, -9, -16, -19, 3, -23, -42, -38, -34, 0, 0, 22, 9, 16, 32, 41, 26, 1, 9, 8, 14, 11, -8, -5, 12, -4, 5, -5, 9, 8, -18, -26, -29, 9, -4, -38, -27, -21, 2, 17, 20, 18, 26, 21, 43, 37, 34, 25, -13, -12, 2, -7, 11, -12, -6, 0, -17, -5, -16, 10, 17, 0, -29, -19, -27, -7, 2, 21, 30, 21, 14, 23, 13, 15, 33, 12, -9, -6, -16, 15, 11, -2, -10, -13, 23, 14, 4, 19, -7, 2, -10, -13, -21, -18, -10, 15, 24, 10, 39, 3, 10, 5, 36, 33, 5, 6, -7, 5, -1, -14, 13, 12, -1, 15, 20, -11, 1, -2, -2, 1, -14, -2, 1, 30, 30, 17, 13, 26, 26, 3, 24, 21, 9, 6, 13, -6, -1, -16, 1, -8, -16, 1, 2, 17, 4, -4, -2, 15, 16, -7, -5, -9, 7, -16, -7, 11, -1, -7, 8, 6, 11, -4, -1, -11, -8, -1, -1, -3, -23, -23, -9, 21, 9, -8, 15, 29, 16, -12, -25, -44, -40, -60, -48, -45, -37, -20, -47, -24, -6, -7, -6, -16, -15, 4, 10, 16, -23, -29, -9, 16, 4, 14, 10, 50, 20, -43, -36, -56, -30, -61, -65, -50, -66, -74, -72, -55, -20, -8, -16, -12, 12, 6, 0, 18, 14, -15, -5, -18, 15, 30, 38, 18, -25, -41, -36, 6, -10, -29, -54, -61, -56, -69, -82, -42, -9, -9, -10, -2, -15, 18, -3, -7, -6, -3, 11, -7, 1, 35, 19, -12, -36, -50, 2, 0, 6, -14, -6, -24, -19, -39, -58, -41, -23, 3, -7, -11, -3, -5, 1, 3, 22, 5, -3, -9, -8, -7, -13, -8, -46, -17, 0, 22, -2, -15, -19, 25, 6, -9, -13, -43, -38, -17, 10, -18, -13, 9, -8, 5, 19, 27, 7, -5, 0, -15, -5, -46, -30, -10, 10, 20, 10, 17, 22, 46, 35, 24, 21, -27, -24, -28, -2, -3, 10, 3, 11, 8, 21, 6, 1, -8, 15, 12, -14, -17, -11, -11, 25, 25, 25, 36, 21, 22, 38, 37, 11, 6, -28, -22, 9, 6, 12, 11, -5, -2, 17, -1, 30, 11, -7, -12, -14, -24, -34, -14, 12, -1, 18, 33, 19, 19, 36, 29, 12, -2, -17, -27, 9, 7, 12, 0, 12, 16, -3, 7, 19, 10, 6, -21, -38, -64, -50, -3, 33, 2, 21, 19, 37, 23, 27, -11, 12, -6, -39, -1, -11, -16, -12, -9, -10, -16, 7, 14, -4, 19, 10, -42, -40, -79, -94, 12, 12, 32, 12, 12, 30, 31, 36, 1, -10, 9, 0, 9, -5, -1, -1, -5, 6, -6, -7, -9, -13, 1, -20, -38, -37, -65, -93, -7, 18, 13, 27, 17, 32, 18, 17, -18, -7, 20, -19, -17, -16, 11, -14, 8, -6, -14, -32, -15, -17, 21, 4, 1, -33, -61, -47, 5, 7, 44, 46, 27, 45, 24, -5, -2, 0, -11, 10, -17, 7, 9, 4, -10, -11, 14, -24, -9, 3, 9, 12, 10, -4, -27, -19, 19, 50, 52, 26, 48, 32, 12, 15, 17, -17, 9, 1, 14, 1, -20, -2, 1, -1, -2, -12, -29, -6, -1, 3, 1, -29, -28, 7, 4, 44, 16, 29, 45, 56, 39, 18, -8, -1, -6, 13, 4, 9, -3, 12, -4, 11, 15, 4, -11, -28, -27, -26, -33, -22, 0, -8, 9, 33, 41, 28, 18, 12, 21, -7, -24, -5, -5, -9, 0, 12, -12, -3, 12, -14, -4, 10, 17, 14, -4, -20, -24, -30, -6, 18, 17, 43, 51, 35, 27, 22, 3, -11, -6, -12, -22, -11, 7, 13, -4, -18, 1, -16, -15, 7, -3, -14, 7, -6, -12, -5, 14, 6, 15, 18, 4, 8, -7, -12, -4, -3, -7, 3, -2, 2, -3, 6, -16, 2, -14, 11, 10, 12, 3, 10, 5, -11, -11, -1, -6, -4, -20, -8, -13, -21, -20, -9, -12, -9, -4, -3, -6, -6, -8, -1, -17, 5, 1, 0, -14, -16, -12, -12, -1, -9, 11, -14, 15, 0, -20, -7, 9, 15, 1, -9, 12, -5, -1, 8, 5, 4, -18, -1, 3, -5, 7, -10, 12, -14, 12, -9, -17, 7, 4, 13, -11, -18, -13, -6, -7, 3, -13, -14, 4, 1, 5, -12, -20, -6, 11, -18, -1, 4, -13, 12, 14, 1, -14, -12, 9, -13, -14, -19, -19, 9, -6, -5, 15, -14, 13, 2, 3, 8, 7, -2, -1, 8, 11, 0, 13, 2, -7, -6, 4, 13, -13, -16, 13, 1, 19, -3, 3, -4, 22, 7, 2, 28, 26, 30, 26, 19, 15, -3, -7, -6, -9, -13, -17, -8, 7, 7, -7, 6, 3, -5, -1, 6, 6, 27, 10, -14, 15, 10, 12, 13, 16, 26, 16, 5, 25, 16, -11, -7, 6, -13, 11, -12, 4, 6, 2, 10, -3, 12, 24, 15, 17, 26, 25, -15, -4, 6, 21, 21, 19, 23, 11, 21, 24, 1, 25, -15, -11, 11, -11, -2, -9, -9, 10, 6, 21, 10, -18, -18, -5, -4, 5, 17, 18, 26, 24, 27, 31, 32, 49, 20, 40, 6, 8, -6, 6, -7, -17, -9, 3, 6, -11, -9, -11, 5, 7, -7, 21, 21, 8, 28, 7, 8, 42, 35, 42, 33, 31, 23, 19, 7, 10, 6, 6, 11, -7, -3, 8, 2, -2, -7, 9, 5, 21, 10, 8, 10, 26, 30, 27, 37, 29, 14, 22, 10, 19, 4, -1, 2, 4, 3, 6, -18, -16, 14, -22, 6, -13, 8, 3, -2, 33, 23, 5, -8, 14, -8, -2, 10, 11, -20, -27, -18, -19, -2, -11, -17, 4, 0, -3, -5, 7, -9, -9, 19, 14, 4, 11, 41, 28, 16, 7, -14, -13, 2, -26, -51, -41, -63, -50, -37, -49, -31, -6, -22, -29, -7, -10, -15, -6, 11, -11, 1, -5, 20, 27, 14, 14, 10, 1, -13, 3, -13, -32, -76, -44, -35, -41, -15, -42, -13, -25, -30, -46, -9, -2, 13, -8, 6, 12, -4, 29, 1, 10, 5, -11, -2, 3, 10, 9, 2, -3, -18, -6, 21, 0, -8, -21, -23, -42, -23, -26, -10, -7, -2, -17, -10, -15, -2, 12, -10, 3, -13, -7, 0, 8, -1, 4, 22, 29, 37, 6, 32, 4, -18, -24, -13, -26, -21, -44, -10, -9, -4, 2, -16, -7, -16, -21, -28, -24, 5, 0, 7, 14, -6, 20, 18, 37, 23, 26, 25, 15, -21, -26, -24, -17, -25, -17, -20, 7, -7, -1, -9, -8, 9, -13, -50, -20, -3, -7, 16, 10, -2, 13, 20, 28, 1, 21, -2, -10, -18, -18, 5, -21, 7, -2, 0, 3, -5, 5, -7, -10, -2, -34, -46, -13, -22, -29, 4, -3, 2, 46, 20, 0, -17, -11, -14, 14, 12, 21, 29, 9, 13, -6, -9, 3, -7, -1, 3, 2, 9, -3, -47, -31, -30, -25, -15, 3, 40, 12, 13, -13, -14, 2, -9, -6, 18, 27, 22, 44, 22, 15, -18, -8, -19, -19, -9, -14, 9, -4, -27, -37, -32, -49, -59, -58, -7, -12, -24, -17, -14, -36, -5, 11, 29, 16, 37, 33, 19, -3, 0, 4, -16, 5, -6, 5, 6, 26, -33, -7, -56, -70, -82, -64, -80, -50, -53, -36, -15, -3, 23, 1, 23, 17, 29, 24, 18, -17, -15, -20, 13, 2, 7, -4, 30, 21, 0, 12, 3, -6, -27, -60, -66, -58, -46, -28, -31, -10, 13, 13, 33, 5, 30, 35, 25, 18, 3, -7, 13, 5, -18, 2, 15, 14, 23, 29, 4, 9, 13, -19, -16, -5, 0, -14, -16, -3, -6, 26, 26, 23, 17, 35, 19, -14, -3, 7, -18, 4, 9, -4, 5, 31, 8, 2, 15, 5, 12, 17, 20, 32, 15, 10, 2, 20, 13, -9, 6, 34, 8, -1, 0, 7, 1, 2, 13, 14, -11, 13, 28, 7, 5, 27, 21, 23, 31, 42, 36, 30, 15, 15, 27, 28, 0, 22, 9, 11, 22, 27, 4, 7, -3, -17, 2, -9, -15, 5, 20, 26, 52, 35, 45, 33, 12, 40, 28, 23, 16, 21, 19, 13, 23, -5, -16, 5, 0, -14, -5, -1, 7, -6, -15, -10, -15, 12, 0, 5, 11, 43, 42, 50, 39, 25, 42, 38, 9, 18, 41, 37, -5, 3, -18, 4, 12, 17, 10, 11, -10, 2, -7, -15, 2, 10, -2, -1, 18, 30, 23, 45, 56, 59, 34, 36, 46, 37, 43, 18, 29, -14, 24, 17, 11, -1, -7, 14, 7, -16, 8, -12, -10, 4, -3, -5, 1, -10, 12, -1, 0, 28, 19, 24, 11, 32, 3, 24, 4, -3, -4, 12, -11, 12, 11, -6, 14, -14, 1, -14, 2, 0, 0, 6, -12, 6, -1, -5, 13, -15, -3, -4, 11, -2, -13, -17, -8, -9, -17, -17, 13, -16, 3, -15, 0, 3, -13, -9, 11, 15, 9, 3, 4, 10, 1, -5, -15, 14, 5, 9, -14, -11, -6, -11, 4, -1, 14, -18, 4, 11, -16, 9, 1, -17, 1, -9, -16, -16, -5, 15, 15, 9, -14, 5, 16, -9, 1, -7, -12, 13, -2, -15, -8, -9, 2, -18, -15, -1, -4, 0, -19, 2, -15, -10, 1, 13, 0, 9, 0, 15, 4, -11, 5, -18, 8, 2, -3, -6, -12, 13, 15, 15, 13, -4, -16, -6, 7, 3, -16, -10, -4, 4, 4, 13, 2, 11, -3, -13, 6, 7, -7, -15, -10, -29, -24, -29, 8, -19, -26, -15, -6, -11, 21, -2, -12, -13, -11, -11, 10, 1, 15, 5, 8, -19, -10, -17, -22, -8, 5, -29, -3, -28, -25, -18, -7, 9, 21, -1, -6, 1, -9, 16, 21, 8, 0, 15, -9, -8, -15, 5, -19, 1, -6, 9, 11, -11, -14, -23, 8, -3, 7, -1, -10, -4, -23, -32, -23, -8, -7, 28, 1, 15, 19, -7, 4, -2, -17, -18, -5, 2, 4, -2, 1, -5, -8, 0, -6, 15, -17, -10, -21, -36, -4, -12, 3, 5, 31, 8, 22, 8, 2, 10, 4, -10, 7, -15, 15, -4, 10, 4, 9, 11, -10, 24, -1, 24, -1, -4, -12, -9, 21, 22, 20, 28, 21, 30, 9, 27, 14, -5, -11, -14, 17, 18, 6, 8, 17, 13, 12, 18, 6, 25, 10, 21, 33, 16, 24, 28, 21, 22, 34, 31, 21, 11, 29, 11, 38, 13, 5, -6, 3, 17, 10, 17, 12, 29, 15, 22, 23, 22, 41, 42, 38, 37, 35, 12, 37, 15, -6, 0, 8, 23, 10, 22, 30, 27, -14, -17, 6, -10, 19, -5, 28, 16, 17, 17, 1, 25, 31, 29, 65, 21, 28, -3, -10, 9, -16, 11, 9, -24, -17, 23, 22, 13, 15, -9, 8, -5, 6, -7, 17, -5, 1, -8, -2, -4, 12, 7, 36, 24, 12, -6, -14, -18, -32, -19, -23, -36, -42, -7, -3, 21, -15, -8, -8, 0, 4, -13, -2, -27, -5, -12, -8, -17, -44, -55, -51, -26, -21, -49, -40, -10, -20, -21, -34, -37, -36, -10, -13, 9, 15, -3, 0, 10, 2, -30, -23, 0, -17, -24, 1, -35, -26, -65, -61, -8, -42, -13, -3, -23, -21, -28, -23, -37, -21, -20, -1, -2, -16, 3, -17, 8, -22, -28, -13, -36, -34, -8, -37, -38, -22, -36, -26, -11, -22, -13, -12, -15, -7, -17, -33, -17, -23, -23, -20, 6, -10, -10, 3, 7, -19, -16, -29, -15, -17, -30, -6, -10, -37, -17, -1, 4, -8, -25, -6, -25, -19, 4, -16, -22, -26, -19, 9, 13, -10, -15, 14, 0, 12, -20, -17, -31, -28, -10, -27, -24, -14, -24, -1, 12, 2, -18, -6, -11, -27, -11, -8, -17, -6, 10, 18, 5, -6, -4, -3, 1, -15, -25, -20, -43, -46, -30, -14, -26, 1, 0, 29, 3, 32, -9, -16, -19, -17, 1, -8, -17, -27, 3, 8, 12, -11, 1, 11, -2, -3, -12, -26, -11, -9, -7, -5, -13, 7, 25, 26, 18, 3, 9, 14, -6, -15, -17, -20, -16, -12, 12, -7, -12, -2, -8, -7, -10, 15, 6, -25, -16, 11, 15, 40, 0, 8, 15, 25, 0, 35, 9, 15, 15, 2, 8, -16, -34, -4, 13, 2, 17, 11, 15, 8, -10, 12, -6, 8, 6, 17, 27, 2, 11, 5, 18, 15, 32, 11, 19, 20, 12, -3, -3, 9, 7, 11, 16, -15, -6, -8, -9, 11, 16, 7, 23, 21, 25, 11, 9, 27, 8, 13, 18, 10, 20, 4, 21, 18, 26, 14, 23, 0, 2, 0, 17, 14, 8, 9, -6, 4, -2, 8, 1, 21, 14, 8, 12, 17, -18, 2, 12, 23, 8, 24, 6, 9, 8, -3, 9, -5, 9, 3, -15, -3, 11, -11, -11, -17, -2, 8, 8, 2, 25, 13, -14, 9, 19, 14, 5, 4, 9, 8, -1, 16, -8, 15, -3, -6, -12, 13, -17, 8, -1, -10, 12, -12, -9, -20, -17, 3, -20, 5, 1, 27, 19, 15, 9, 10, 21, 4, 8, 5, 26, 7, -9, -15, -17, 10, -6, 14, -4, 3, -9, -8, -18, 14, 1, -28, -21, -4, 18, 12, -13, 20, 37, 18, 26, 3, 28, 19, 29, 25, 12, 8, 5, -11, -6, -14, -11, 12, -15, -9, 9, -11, -10, -5, -12, -20, 12, 12, 2, 16, 14, -6, -10, 29, 8, 15, -4, 19, -1, 5, -15, 7, -6, 5, -17, 0, 8, 16, 3, -11, -3, -1, -2, -4, -13, -9, 5, 5, 4, -8, -4, -14, -8, 18, 2, 4, -8, 1, 16, -5, 0, -2, -14, 12, 7, 8, -2, -7, -3, 13, -1, 6, -13, 15, -1, -9, -11, 1, -5, 10, -1, 14, -4, 9, -3, -10, 0, 14, -14, 1, -17, -15, 14, 1, -15, -11, 9, -16, -12, 16, -15, -14, -16, 3, 1, 6, -11, -11, 7, -14, -8, 0, 4, -8, -8, 11, -6, -2, 13, 11, 14, 8, 13, 6, 5, 5, -10, 18, 9, 3, 22, -1, 29, 8, 10, 29, 12, -4, 17, 1, 4, 5, -5, 19, 14, -9, -19, 1, 5, -9, -1, 6, -2, 3, -5, -3, 19, 2, -6, -1, 5, 11, 10, -3, -6, -22, 5, -3, 7, 2, 24, 6, 17, 14, 2, -14, 1, 2, -8, -6, -2, 12, -6, 14, -11, -17, -12, 6, 4, -13, 4, -16, -23, -13, 2, 13, 0, -4, 9, 24, 7, 1, -2, -19, -1, 13, 0, 14, -4, 4, 0, -9, -24, -6, 5, -21, -8, -12, -33, -30, -12, 6, 28, 25, 4, -1, 20, 8, -7, 6, -18, -11, -5, 6, -12, -1, 11, -16, -17, -19, -14, -25, -16, 5, -14, -34, -14, -36, -36, -21, 16, 17, 24, 14, -24, 7, 1, -3, -7, 9, 15, -5, 11, -9, 10, -31, -39, -33, -38, -29, -7, 1, -4, 2, -6, -8, -30, 11, 20, -4, 20, 22, 13, -2, -3, -16, -3, -3, 0, 12, 12, 1, 2, -24, -43, -52, -47, -41, -22, -10, -11, -2, -21, -1, -19, -2, -4, 14, 13, 28, 8, -11, -12, -1, -7, -13, 13, -7, -3, -19, -8, -39, -27, -39, -12, -3, 9, 8, -1, -4, -3, 12, 7, -6, 10, -1, 3, 0, -18, -38, -29, -21, -23, 13, -1, -12, -3, 7, -8, -12, -9, -15, -20, -8, 9, 9, 6, -2, -11, -32, -7, 8, -18, -14, -25, -25, -37, -17, -35, -19, -21, 2, -9, -11, -10, 6, -21, 13, 10, -2, 6, -8, 2, 0, -1, -25, -50, -23, 1, -11, 6, -9, 3, -29, -39, -17, -35, -38, -11, -9, 2, -5, -10, 7, -3, 0, 11, -4, -6, 1, -19, -19, -22, -20, -15, -22, -28, 9, 5, -10, -22, -12, -11, -13, -30, -36, -20, 13, 5, 2, -4, -12, 6, 12, 22, 26, 28, -6, 0, -30, -19, -24, -2, -4, -5, -1, 4, -12, -6, -13, 12, 11, -5, -14, -17, -13, -14, -7, 10, -7, 4, 7, 13, 31, 34, 22, -18, -43, -9, -18, -12, -9, 22, 12, -1, -2, 6, 4, 24, 5, 1, -7, -5, 12, 13, -7, -4, 19, 15, 20, 36, 37, 43, 22, 26, -12, -8, -10, -3, 22, 12, -1, 0, 6, -5, 16, -2, 3, -12, 19, 1, 3, 5, -6, -16, 15, 11, 30, 38, 32, 57, 51, 49, 31, 23, 4, 19, 5, 9, 18, 3, 4, -9, 19, 0, 4, -7, 7, 12, -12, -7, -5, 6, -13, -32, 11, 35, 43, 45, 36, 48, 55, 35, 16, 3, 31, 28, 9, 5, 9, -14, -13, -7, -12, -21, 4, 12, -5, -17, -2, -13, -6, -3, -14, -12, 41, 39, 36, 46, 45, 28, 36, 38, 43, 13, 7, 15, 13, -9, 14, 19, -6, 4, 18, -16, 11, -8, -6, -12, 8, -13, -26, -13, 25, 31, 14, 15, 32, 8, 15, -1, 35, 21, 37, 28, 26, 2, 29, 26, 4, -9, 13, 1, -6, 13, 7, -18, 4, -11, -2, -17, 2, 0, 23, 18, 5, 16, 6, 18, 34, 45, 41, 34, 42, 16, 9, 21, 29, -1, 14, -18, -1, 12, 9, 16, -11, -18, 2, -15, -12, 14, 8, 0, 6, -11, -3, 8, 21, 35, 40, 45, 32, 12, 11, 44, 26, 5, -1, -9, 10, 7, 13, -15, 10, 7, 13, -5, -16, -3, 2, -27, -18, -26, -13, -9, -16, 10, 4, -1, 18, 24, 29, 5, 8, -12, 1, -7, 13, -18, 4, 12, -15, -1, -8, -12, -21, -17, -17, -9, -28, -18, -19, -19, 3, -4, -10, 11, 23, 0, 6, 14, -8, 3, -7, -15, -14, -11, 1, -1, -12, -12, -8, -2, -25, -15, -19, -36, -13, -30, -38, -33, -40, -27, -40, -21, -11, 12, -2, 24, 19, 17, 16, 11, 8, 2, -5, -9, 8, -1, -11, 2, -17, -20, -20, -8, -21, 1, 7, -25, -10, -19, -22, -23, 19, 16, 12, 6, -6, -3, 14, -15, -19, 9, 6, 1, 1, 5, 13, 23, 12, -3, 11, 6, 14, 34, 0, 14, 6, 2, 2, -8, -14, 4, 1, -15, -3, 3, -2, 0, 11, -12, -8, 14, 2, 8, 12, -9, -17, -4, 8, 15, 8, -4, -17, 9, -11, 12, -11, 9, -17, -1, -14, -14, -16, 11, 11, 2, 1, 16, -8, -14, 12, 7, 12, 0, 8, 10, -7, -8, 4, 7, -17, 15, -17, -8, -10, 7, 2, -6, 9, 6, 5, 17, 15, 2, 6, -7, -5, 7, -5, 12, -16, 6, 10, -8, 11, -6, 14, -21, 8, -18, -13, -10, 4, 11, -13, -7, -18, -12, 10, 13, -13, -13, 15, -5, -13, 3, 5, 16, -7, 9, 9, 4, -1, -14, -21, -32, -28, -36, -39, -26, -28, -1, -8, -5, -6, -20, -19, -14, -6, -2, -6, 6, 6, -2, 1, -4, -12, -16, -19, -11, -13, -24, -14, -17, -18, -40, -43, -38, -41, -55, -58, -34, -20, -28, -20, 0, 12, 2, -7, 6, 1, -9, -16, 12, -10, -5, -27, -11, -3, -35, -4, -48, -44, -34, -39, -43, -34, -33, -59, -34, -18, -16, -3, -12, -14, -5, 12, 9, 11, 13, 9, 8, 7, -22, -3, -1, -14, -34, -12, -49, -44, -37, -39, -27, -31, -12, -44, -42, -28, -13, -24, -31, 6, -12, -4, 14, 1, 2, 11, 0, -12, -6, -20, -10, -20, -17, -23, -28, -3, -15, -13, -27, 2, -14, -12, -23, -11, -16, -28, -6, -4, 3, -12, 1, -5, 1, 6, 13, 5, 17, 9, 2, 13, 16, 5, 11, 29, 18, 7, 28, 0, 19, 14, -10, -2, -1, -7, -16, -14, 5, -3, 9, 12, 2, 2, -12, 5, 27, 9, -6, 18, 20, 9, 29, 14, 47, 38, 13, 29, -2, 19, -11, -17, 16, -4, -7, 0, -6, -5, 13, -1, -5, 28, -6, 21, 29, -8, 11, 7, 35, 39, 23, 36, 29, 48, 47, 15, 22, 22, -4, -17, -23, -14, 12, 11, 0, -7, 13, 2, 3, 28, -2, 6, 19, 14, 6, 3, 15, 42, 47, 40, 41, 38, 40, 19, 32, 23, 2, -36, -18, -1, 2, 17, 15, 11, 12, -3, -3, 4, 5, 0, 2, 2, 15, 12, 21, 19, 6, 27, 24, 7, 27, 10, 23, 28, 10, -19, -29, 0, -7, 7, 20, 2, 13, 17, 9, 21, 9, -19, -3, -4, 7, 12, 5, -4, -13, -11, 8, 4, -20, 0, 22, 31, -3, -28, -34, -10, -24, 13, 6, 0, 3, 10, -3, -6, 15, -12, -17, 31, 25, -16, -11, 12, 13, 2, -20, -15, -3, -8, 32, 20, -5, -32, 0, -21, 24, 20, 26, 19, -13, 10, 15, 12, -3, -18, 15, 33, -3, -8, 17, 9, 13, 14, -3, -14, 0, 25, 38, 14, 26, -21, -1, 12, 24, 5, 0, -16, -4, -2, 3, -10, 18, -6, 8, 2, 11, 10, 1, -6, 14, -5, -15, -13, 4, 29, 20, 0, 34, 11, 10, 25, 35, 10, 8, -11, -14, 5, 1, 10, 23, -1, 7, 32, 30, 14, 7, 9, -3, -29, -17, 9, 22, 43, 21, 8, 14, -2, 28, 19, 32, 17, 8, 9, -10, -5, 4, 7, 10, 5, 22, -2, 4, 13, 19, 9, -16, -9, -12, 10, 6, 32, 24, -9, 19, 1, 42, 9, 26, 12, 17, -3, -14, 2, 17, 12, -10, -5, -2, -9, 9, -10, 5, -17, -27, -31, -1, 13, 4, 4, 11, -5, 19, 8, 20, 5, 8, 5, -1, 14, -13, 15, 0, -5, -6, -16, -19, -34, -39, -19, -18, -29, -6, -8, -16, 3, -21, -5, -18, 20, 11, 11, 11, 13, 5, -9, 14, -5, 13, 8, 7, 4, 3, -5, -38, -50, -29, -23, -39, -8, -7, -13, -22, -29, -5, -9, -16, -9, 14, -8, 9, -11, 0, 12, -8, 8, -8, 5, 15, 6, -3, -19, -32, -16, -19, -45, -16, -18, -10, -7, -27, -30, -16, -45, -41, -23, -45, -16, -22, -2, 14, 15, -4, -11, 16, -5, 12, -5, -21, -4, -4, -19, 1, -12, -21, -26, -2, -23, -28, -7, -21, -26, -39, -69, -39, -26, -13, 5, 10, -5, -17, 0, -14, 9, -16, -12, -17, 20, 14, 35, -6, -2, 11, 3, -11, -44, -13, -19, -22, -22, -69, -71, -61, -32, 1, 14, 15, 18, -16, 6, 17, -10, -4, -1, -2, 33, 14, 5, 15, -4, 8, 1, -14, -11, -7, -15, -26, -30, -26, -38, -3, 7, 18, 3, 4, -10, -2, 10, 15, -15, 11, -11, 14, 31, 10, 2, 3, 19, 5, 18, 17, 2, 8, 18, 3, -8, 9, 12, 5, 17, 16, 8, -12, -11, -16, -5, -3, -16, 15, -10, -8, -9, 14, 18, 25, 29, 19, -1, 35, 7, 30, 10, 27, 18, 10, 10, 13, 13, -11, 10, 6, 7, 4, 8, -1, 8, 2, 4, 9, -5, -12, 6, -3, 14, 6, 11, 5, 10, 11, 1, -7, 14, 9, 5, -8, 3, 1, -10, -9, -14, -13, 0, -11, -17, 7, -23, -2, -3, -4, -7, -14, 8, 1, 5, -24, -12, -15, -17, 6, -14, -4, 7, -4, -8, -8, -7, -6, -10, -1, -10, -13, -16, -17, -3, -17, -20, -13, -21, -15, -2, -22, -8, -26, -9, -8, 0, 10, 5, -20, 1, 2, -19, 4, -5, -9, -19, 9, -3, -24, -11, -24, -15, -22, -14, -21, 1, -23, -2, -19, -24, 0, -10, -12, -39, -25, -7, -30, -23, -31, -6, -10, -3, -1, -10, -25, -19, -24, -16, -17, 5, -13, -17, -19, -10, -13, -12, 10, -4, 4, -3, 6, -14, -7, 6, -6, -8, -12, -31, -26, -9, 3, 7, -23, -22, -9, -4, -18, -12, 5, 8, -17, 16, -2, 7, 28, 18, 30, 18, 9, 21, 28, 22, 15, -10, -25, -20, -4, -35, -3, -10, 0, -5, -23, -21, -19, 4, -10, -6, -18, -16, -11, -4, 21, 27, 17, 5, 22, 3, 7, 22, 21, 23, 11, -6, -24, -25, 4, -13, -5, 0, -12, 3, -24, 7, -13, -2, -11, -11, -4, -4, -4, 5, 1, 6, 12, 6, 25, -5, -3, 8, 11, 3, -5, 4, 0, -14, -8, -22, 8, 7, -17, -14, 11, -10, 3, -19, 9, 11, 14, -7, 10, 16, 12, 6, 24, 15, 6, 17, -17, 3, 4, 29, -5, -3, 4, -20, -22, -24, 0, 8, 14, -3, -15, 4, -8, 10, 0, -24, 6, -1, -12, 13, 37, 28, 25, 14, 18, 8, -3, 6, 3, 11, 2, -23, -17, -11, -17, -15, -16, 2, -15, -10, -14, 19, -13, -8, -19, 1, -15, -2, 14, 11, 3, 9, 8, 15, 19, 23, 30, 10, 3, -23, 3, -17, 3, -13, -5, -17, -18, -7, -2, 0, 11, -16, -15, -35, -14, -22, -25, 4, 28, -8, 24, 22, 0, 37, 24, -13, 0, 8, -3, -24, -16, -3, -26, -23, 1, 20, 18, 25, 22, 4, -16, -35, -23, -36, -17, -2, -8, 11, 22, -2, 14, 28, 38, 19, 0, -19, 3, 3, -29, -23, -25, 3, -6, -3, 9, 3, 0, -7, 21, 23, -3, -23, -39, -24, -14, 23, 24, 1, 17, 23, 5, 12, 6, -23, -20, -7, -26, -17, -28, -17, 18, 17, 15, 14, 6, 26, 24, 46, 21, -10, -12, -21, 22, 8, 14, 12, -1, 17, 18, 9, 16, -17, -7, -17, 4, 1, -25, 15, -4, 30, 14, 19, 31, 33, 27, 26, -2, -18, -7, 9, 14, -23, 3, 11, 11, -4, -3, 19, -10, 9, 3, 5, -19, -2, 4, 0, 17, 8, -3, 27, 24, 3, 33, 17, -4, -6, -22, -21, 9, -18, 12, 5, 14, 22, 19, 19, -1, 6, -25, 9, -20, -14, 1, -3, 21, -7, -2, 9, 34, 36, 28, 11, -11, -10, -17, 0, -20, -10, -15, 10, -6, 6, 26, -11, -1, 7, -10, 8, -4, -5, 1, 4, 24, 18, -1, 11, 21, 33, 30, 1, -40, -36, 16, -7, -28, -14, -5, -6, 20, 3, -8, -1, -4, -7, -11, 5, -13, 8, 21, 0, 18, 19, 9, 8, 41, 27, -17, -36, -49, -30, 20, -1, -23, -2, -15, 1, 9, 0, 3, -7, 7, 0, -13, -5, 8, 14, -2, 3, -4, 14, 16, -1, 22, -11, -4, -21, -38, -14, 16, 13, -2, 6, 3, 8, 11, 9, 4, -5, -11, -15, -4, -19, 2, 7, -3, 7, 18, 21, 13, -6, 19, 4, -20, -7, -24, 18, 6, 7, -13, -3, 9, 5, 10, 8, -16, -2, 1, -15, -9, 1, -18, 17, -7, -16, 15, 7, 10, 9, -3, 14, -1, 16, -17, 8, -3, -5, -21, 3, -1, 12, 0, 1, 1, -16, -12, 6, -1, -25, 10, 15, 7, 3, -2, 19, 10, 2, -6, 0, -2, 18, -2, 20, 15, 12, 15, 13, -10, 11, 5, 7, -2, -1, 1, 6, 4, -3, -15, 10, 11, -12, -23, 13, 7, 28, 21, 25, 6, 32, 18, 30, 24, 12, 32, 9, 2, -4, 4, 2, 8, -18, -5, 6, -13, 9, -1, -12, -11, -20, -9, -6, 1, 5, 27, 22, 34, 44, 45, 18, 41, 21, 21, 7, 8, 10, 3, 15, -3, -17, 0, -23, -2, -22, -3, -7, -8, -18, 0, -19, -27, -19, 3, 1, -21, 11, -4, -8, 15, 12, 4, 5, -10, -14, 0, 8, -14, 4, -17, 0, -1, -22, 7, 1, -19, -2, -23, 4, -16, 2, -4, -20, 6, -3, -15, -20, -31, -26, -7, -26, -10, 1, 3, -3, -11, -14, 2, -13, -1, -21, 3, -2, -2, -17, -1, -9, -10, 8, -8, -3, 4, 3, -28, -8, 4, 3, 7, 1, 3, -5, -4, -15, -25, -19, 6, 6, 7, -5, -18, -8, 9, -9, -18, -10, 0, -5, -9, 6, 8, -13, 9, -9, 8, 1, 3, 10, 13, 4, 12, -7, 10, -9, 9, 0, -15, -9, -7, -6, 0, 7, -2, -9, -3, -1, -14, -15, -3, -9, -1, -18, 3, 12, 13, -6, -3, -10, 11, 9, -14, 3, 5, -4, 9, 4, -18, 5, 14, -2, -8, 8, -17, 9, 4, 3, 1, -2, -5, -16, 8, -10, 5, -23, 6, 7, -14, -13, -9, -15, -12, 10, -17, -11, -11, 5, -8, 10, -1, -9, 10, -6, 1, 25, 12, 3, 21, 6, 10, 5, 2, 10, 1, -2, -17, -9, -2, -2, -7, 9, -14, -16, 0, 7, 0, 4, -7, 15, 4, 25, 37, 39, 46, 41, 11, 23, 28, 19, 33, 25, -2, -12, -15, -22, -3, 15, -11, -18, 1, -6, -15, -2, 11, 17, 7, 30, 13, 29, 7, 36, 21, 19, 8, 23, 29, 10, 32, 8, -5, 2, -10, -27, -17, 1, -9, -2, -1, -1, -8, 16, -7, 38, 32, 6, 15, 21, 23, -2, 19, 21, 22, 6, 22, 1, 15, 19, 8, -2, -15, -18, 8, -10, -16, 7, -15, -12, -1, -9, 25, 33, 15, 8, 0, -11, -14, 3, -10, -17, -3, -17, 3, -3, 11, 0, -9, -8, -20, -15, -23, -24, 7, -7, -10, -12, 8, 5, 7, 37, 28, 19, -14, 5, -29, -15, -14, -16, 9, -15, 13, 17, 5, 27, -1, -7, -24, -6, -18, -6, -15, -12, 12, -4, 15, -1, 15, 36, 1, 1, -4, -37, -43, -52, -3, -7, -23, -1, 4, 25, 38, 10, 11, -19, -30, -29, -32, -10, -2, 4, -10, 6, 11, -9, 0, 10, -10, -25, -8, -32, -32, -40, -3, -2, -7, -30, 27, 40, 22, 33, 0, -33, -33, -20, -26, -16, -17, -10, -2, 14, 5, -14, -15, -17, -35, -24, -26, -6, -13, 11, 7, -20, -22, -14, 1, 19, 41, 13, -18, -49, -51, -23, -25, -5, -11, -1, 3, -14, -19, 12, -22, -48, -21, -16, -4, -4, 8, 23, 1, -14, -1, -19, 22, 24, 36, 19, -34, -26, -42, -38, -32, -5, 6, -6, 14, 12, -13, 2, -28, -34, -46, -32, -7, -10, 2, -8, 5, 3, -15, -17, 14, 9, 27, -10, -27, -28, -26, -43, -19, -16, -1, -14, -2, -4, -14, 0, -5, -35, -28, 14, -17, -1, -20, -18, 5, 13, 2, 0, -5, 17, 0, 0, -26, -19, -18, -8, -13, 0, 4, -2, 5, -10, -12, 11, 19, -3, 21, -3, -10, -2, -31, -12, -14, -6, 9, -10, 26, 24, -1, -10, -14, -26, -15, -6, 18, -9, -11, -9, 3, 14, -11, 5, 25, 28, -11, -16, -25, -12, -55, -58, -37, 2, -13, 7, -15, 3, -13, -9, 4, -10, 26, 0, 5, 6, -4, -2, 12, -3, 14, 0, 31, 34, -11, -1, -21, -28, -35, -48, -9, -2, -13, -17, -3, 18, 17, 19, -14, 12, 10, 21, -2, 2, -4, 11, 14, 0, 0, 35, 28, 21, 8, -3, -5, 2, -7, -2, -19, 3, -12, -1, 21, 20, 5, 9, 14, 3, 30, 31, 8, 5, 1, 13, -8, 14, 3, 15, 26, 35, 21, 12, 13, 6, -11, 0, 4, 13, -8, 27, 21, 24, 17, 19, 7, 3, 0, 18, 1, 8, 6, 10, -11, -16, -17, 19, 32, -4, 5, 4, 24, 15, -4, -7, 13, 15, -3, -9, 6, 23, 15, -9, 18, -3, -14, 3, -12, -11, -8, -10, 3, -3, 1, 8, -9, 1, -15, 13, -4, -6, 3, 14, -9, 1, 9, 19, 6, 6, 14, -7, 12, 0, 5, 5, 16, 5, 11, -8, 9, -2, 13, 20, 12, 6, 11, 16, 16, -15, 23, 1, 5, 10, -13, -14, -11, 12, 16, 24, -3, 19, 16, 0, 21, 5, 12, 10, 12, 11, -3, 16, 27, 11, 0, 25, 7, 13, 21, 23, -1, 2, 10, -10, -12, 8, 36, 20, 9, 19, -4, -8, -7, -7, 7, 4, 15, 3, 2, -5, 2, 16, 31, 14, 3, 12, 7, 4, -22, 0, 11, 9, 13, 4, 29, 3, -3, 13, -7, 0, -1, 14, -15, -17, 2, 1, -2, -17, 14, -8, -7, 1, -2, 7, 9, 22, 14, 23, 5, 8, -18, -19, -17, -18, 6, -4, 1, 14, 7, -3, -4, -4, 2, 13, 8, -7, 11, -2, -10, -14, -21, -7, -1, -11, -5, -21, -22, -10, -3, -2, -6, 8, -6, -9, -16, -4, 3, 2, -11, -2, 6, -13, 8, 5, -14, 2, 1, -6, 2, 1, 1, 4, 3, 8, -16, -2, -13, -17, 10, -2, -16, -2, 11, -10, 10, 11, -3, -9 };
 
-const float fc1_scale = 0.00206094;
+constexpr float fc1_scale = 0.00206094;
 
-const std::vector<float> fc1_bias = { 0.002914681099355221,-0.020877551287412643,0.017162900418043137,-0.014283201657235622,0.023939261212944984,0.007341976277530193,-0.018600203096866608,0.04924764856696129,-0.015118959359824657,-0.030589984729886055,-0.010502511635422707,0.02360691875219345,0.02700723148882389,-0.00441981665790081,0.012488306500017643,-0.0069609135389328,0.035895004868507385,-0.003772623371332884,0.03716098517179489,-0.0022230457980185747,-0.02883884124457836,0.022495929151773453,-0.008909429423511028,0.008520757779479027,0.03458559885621071,0.004658821038901806,0.031784869730472565,-0.015771733596920967,-0.011078694835305214,0.008638584986329079,0.010159767232835293,-0.015165154822170734,0.018535731360316277,-0.01883799582719803,0.034745924174785614,0.01567649468779564,-0.03293883055448532,-0.013462201692163944,-0.02716020867228508,0.007367550395429134,-0.016246363520622253,0.0026230306830257177,0.0372544601559639,0.0072003514505922794,-0.031217025592923164,-0.000748880032915622,-0.010111517272889614,0.03581484779715538,0.028047770261764526,0.0018910198705270886,-0.009036791510879993,0.01627476140856743,0.019765116274356842,0.004097362980246544,0.0018067766213789582,0.0001392856938764453,-0.005208919756114483,-0.03317303583025932,0.009253717958927155,-0.016440924257040024,0.01293487660586834,0.01536141149699688,-0.004659881349653006,-0.009334013797342777,0.008563417010009289,0.02303183823823929,0.001411918899975717,-0.013560505583882332,-0.030501369386911392,0.036602746695280075,-0.025929469615221024,-0.008888830430805683,0.03962960094213486,0.031154515221714973,0.03911127522587776,0.036930616945028305,0.03505314514040947,-0.0336451418697834,-0.014406138099730015,0.003937615547329187,0.03117498755455017,0.010519841685891151,0.007338322699069977,-0.017967617139220238,-0.007522271480411291,-0.0029586488381028175,-0.018159309402108192,0.023438407108187675,0.0026975185610353947,0.008848026394844055,0.007902048528194427,-0.00099625822622329,0.0033246781677007675,0.027995502576231956,0.02735990658402443,-0.02770330011844635,-0.009254682809114456,0.025255629792809486,0.0344507060945034,-0.006978961639106274,0.004695690702646971,-0.00011430235463194549,0.042676761746406555,0.014414330944418907,0.014155767858028412,0.030755499377846718,0.014069745317101479,-0.03380163758993149,0.024079198017716408,-0.019589222967624664,0.023382870480418205,-0.011028321459889412,-0.02542118914425373,0.016445370391011238,0.029129071161150932,0.028471307829022408,0.0002797986671794206,0.02136426419019699,0.03291363641619682,-0.0013571535237133503,0.011062906123697758,-0.014604193158447742,-0.020109426230192184,0.030935950577259064,0.009877614676952362,0.02300110273063183,0.0006752972840331495,0.0012992649571970105 };
+alignas(64) constexpr std::array<float, 128> fc1_bias = { 0.002914681099355221,-0.020877551287412643,0.017162900418043137,-0.014283201657235622,0.023939261212944984,0.007341976277530193,-0.018600203096866608,0.04924764856696129,-0.015118959359824657,-0.030589984729886055,-0.010502511635422707,0.02360691875219345,0.02700723148882389,-0.00441981665790081,0.012488306500017643,-0.0069609135389328,0.035895004868507385,-0.003772623371332884,0.03716098517179489,-0.0022230457980185747,-0.02883884124457836,0.022495929151773453,-0.008909429423511028,0.008520757779479027,0.03458559885621071,0.004658821038901806,0.031784869730472565,-0.015771733596920967,-0.011078694835305214,0.008638584986329079,0.010159767232835293,-0.015165154822170734,0.018535731360316277,-0.01883799582719803,0.034745924174785614,0.01567649468779564,-0.03293883055448532,-0.013462201692163944,-0.02716020867228508,0.007367550395429134,-0.016246363520622253,0.0026230306830257177,0.0372544601559639,0.0072003514505922794,-0.031217025592923164,-0.000748880032915622,-0.010111517272889614,0.03581484779715538,0.028047770261764526,0.0018910198705270886,-0.009036791510879993,0.01627476140856743,0.019765116274356842,0.004097362980246544,0.0018067766213789582,0.0001392856938764453,-0.005208919756114483,-0.03317303583025932,0.009253717958927155,-0.016440924257040024,0.01293487660586834,0.01536141149699688,-0.004659881349653006,-0.009334013797342777,0.008563417010009289,0.02303183823823929,0.001411918899975717,-0.013560505583882332,-0.030501369386911392,0.036602746695280075,-0.025929469615221024,-0.008888830430805683,0.03962960094213486,0.031154515221714973,0.03911127522587776,0.036930616945028305,0.03505314514040947,-0.0336451418697834,-0.014406138099730015,0.003937615547329187,0.03117498755455017,0.010519841685891151,0.007338322699069977,-0.017967617139220238,-0.007522271480411291,-0.0029586488381028175,-0.018159309402108192,0.023438407108187675,0.0026975185610353947,0.008848026394844055,0.007902048528194427,-0.00099625822622329,0.0033246781677007675,0.027995502576231956,0.02735990658402443,-0.02770330011844635,-0.009254682809114456,0.025255629792809486,0.0344507060945034,-0.006978961639106274,0.004695690702646971,-0.00011430235463194549,0.042676761746406555,0.014414330944418907,0.014155767858028412,0.030755499377846718,0.014069745317101479,-0.03380163758993149,0.024079198017716408,-0.019589222967624664,0.023382870480418205,-0.011028321459889412,-0.02542118914425373,0.016445370391011238,0.029129071161150932,0.028471307829022408,0.0002797986671794206,0.02136426419019699,0.03291363641619682,-0.0013571535237133503,0.011062906123697758,-0.014604193158447742,-0.020109426230192184,0.030935950577259064,0.009877614676952362,0.02300110273063183,0.0006752972840331495,0.0012992649571970105 };
@@ -1,5 +1,5 @@
-const std::vector<int8_t> fc2_weight = { -63, 17, -14, -59, -21, 32, 9, -28, 27, -23, -34, -9, -13, -57, -58, 18, -37, -50, 45, -35, 23, -44, 29, 4, 4, 31, 33, -19, -37, 27, 64, -38, 24, 3, 43, 57, 49, 6, 32, -15, -46, -9, 26, 10, -5, -13, -23, 15, -38, 19, 101, 27, -3, -25, -23, -14, -27, -74, -23, -17, 46, -40, -12, -65, -39, 34, 28, -34, -26, -50, 16, 13, 23, -39, 49, 22, 36, -20, 26, 41, -49, -2, 39, 25, -2, -36, 35, 43, -37, -79, -2, 24, -8, -67, -63, -51, 0, -19, 20, 27, 46, 43, 4, -21, -35, 18, 13, -30, 42, -84, -1, 34, 4, -12, -44, -31, -54, 34, 22, -49, -31, -62, -47, -62, -13, 51, 47, -27, -16, -61, 45, 21, -7, -34, 11, -1, -39, 29, 21, -47, 48, -52, 26, 60, 32, 24, 85, 14, 45, 36, 32, 16, 46, -5, -46, 21, -12, 12, -21, -14, -14, -49, -41, -9, 44, -18, -16, 29, 13, 33, 23, -4, 32, 21, -3, 22, 15, 110, -16, -6, -45, 50, -25, -42, -55, -37, 3, -64, -18, 51, 42, 22, 0, 8, 45, 3, 60, 6, 21, -45, -53, -19, -32, 2, -38, 41, -54, 17, -47, 12, -30, -5, 57, 41, 17, -45, 63, 10, -5, -67, 10, 4, -5, -37, 68, -16, 25, -47, 21, -64, -45, -26, 2, -38, 36, -43, 0, -50, 26, 17, 26, -26, -49, -8, 37, -44, -11, 93, 11, 63, -26, 28, 24, -47, -48, -20, 13, 54, 8, 8, 9, 24, -120, 26, 66, -14, 57, -23, -36, 23, 16, -16, 38, 16, -35, 27, 37, -27, 5, -88, 24, 21, -7, 29, 0, 32, -107, 24, -19, 34, 39, 44, -57, -36, -2, 34, 36, 18, 7, -25, 50, -9, -23, -17, -24, -95, 62, -47, -17, 38, -13, -40, -20, 75, 78, 8, 53, 18, 14, 20, -32, 4, 29, 51, 6, -41, 30, -123, 9, 32, 43, -46, 54, 34, -10, -23, 23, -41, 42, -48, -27, -24, -12, -6, 23, 15, -97, -14, 1, -25, -11, -54, 59, 9, 32, -8, 41, -31, -25, -29, 13, 46, 8, 50, 4, -41, -19, 46, -47, 34, 16, -43, 18, 28, 15, 77, 6, -75, -17, 38, 11, 29, 27, 48, 21, -26, -52, 10, 23, 52, 36, 14, 20, -44, -53, 34, 51, -12, -28, 36, 23, -3, -4, 38, -10, -24, -18, 29, 3, -43, 2, 22, -5, 50, -10, -23, -47, 30, -9, -19, -31, -70, 30, 34, 4, 33, -19, -38, -44, -19, 28, 41, -22, -103, -33, 24, -16, 41, -47, -12, -57, 24, -39, 23, -18, 4, 51, 87, -23, -45, -18, -16, -19, -1, -6, -100, 14, -5, 9, 7, -42, -26, 33, 48, 13, 2, -29, 12, -61, -12, -48, -28, 76, 41, -58, 14, 16, 9, 41, -51, -84, 24, 36, -43, -32, -9, -5, 46, 36, -35, 44, 4, -27, 51, -37, 35, 56, 46, 18, -20, 10, -50, -21, -53, -73, -18, 55, -16, -2, 12, 27, 46, 44, 37, -28, -17, -22, 36, 47, -55, -119, 45, -33, -4, -40, -10, -29, -103, 15, -42, 18, -61, 85, 35, -10, -64, -23, -128, 23, 11, -5, 63, 8, -115, -9, 30, 1, -75, -27, 17, -80, 60, 40, 7, -43, 30, -27, -47, -6, 20, 36, 28, -36, -18, -11, -77, 33, -6, 23, -67, 13, -4, 22, -53, -1, 3, 59, 34, 12, -76, 17, 51, -9, 71, 2, 11, -61, -40, 16, 21, -19, -18, -99, -73, -70, -5, 40, 42, -73, 29, -58, -50, -13, -35, 38, 11, -3, -27, 62, -39, 6, -63, -49, -1, 21, 52, 8, -36, -47, -74, -86, 18, 7, -73, -14, -64, 47, 44, 31, -1, 49, 34, 38, 20, -89, -72, 24, -16, 6, 48, 3, -22, 102, -38, -16, 44, -24, 41, 30, -34, 57, 20, 59, 79, -75, 76, 12, 37, 11, 0, -108, -57, 37, 51, 36, 68, 32, 23, -36, -128, -17, 88, 5, -20, -44, -61, 37, 2, 31, -19, 3, -22, -54, 26, -30, -5, -58, 24, -7, 54, -37, -58, 29, -59, -2, -17, 28, 22, -12, 15, -70, 18, -4, -2, 16, -37, -9, -5, -97, -44, 31, 29, -15, -71, 0, 36, -30, 1, -23, 17, -19, 27, 33, 4, -19, -55, -12, 2, -14, 10, 62, 28, 41, 45, 8, 41, -46, -7, -69, -3, -108, 17, 9, 25, -29, 14, -6, 23, -13, -15, -59, -33, -86, -32, 33, 43, -38, -28, 36, -95, -46, 41, 58, 50, 13, 20, 10, 4, -53, 17, -64, -95, -3, 41, 40, 32, -12, -46, -8, -21, -23, -59, 52, -46, -25, -38, 16, 35, -17, 5, -45, -6, 23, 67, 32, 14, 19, -21, 63, -3, 32, 8, 22, -79, 24, 5, -26, -25, -31, 13, 2, -13, -19, -36, -33, -45, 20, -47, 28, 14, -13, 37, 34, -12, 39, -49, -3, -74, -39, 17, -45, 4, -53, 40, 37, 38, -29, 44, -11, 54, 9, -46, 13, -19, 32, 1, -50, -4, -24, -22, -41, 40, 16, 18, -56, 38, -128, 25, 47, -49, -33, 2, -69, 30, -12, -13, -48, -19, -12, -44, -33, -45, 10, 38, -36, 94, -33, -78, -38, -97, 39, 15, 8, -20, 36, 13, 58, -32, 29, 27, 7, -25, 43, -109, -15, -74, 3, -11, -26, -36, -68, -48, 9, -32, 61, -26, -1, 22, -79, 46, 54, -23, -16, -42, 46, -5, 39, 7, 63, 24, -59, 1, 29, -29, -20, 42, -52, 47, -12, -38, -47, 16, -4, -13, -48, 70, 41, -3, 11, -5, 47, -36, 33, -28, -28, 67, 37, 20, -32, 8, 8, 40, 11, 45, -20, 56, 63, 14, -69, 71, -14, -41, -40, 39, 27, 29, 27, 52, -35, 29, 55, 22, -83, 21, -17, 15, 7, 20, -57, -32, 95, 12, 44, 33, -7, -1, -60, 9, -63, -46, 31, -64, -36, -52, 34, 20, 30, 33, -47, 3, -37, -22, -60, 70, 41, 9, -12, 13, 21, 45, -15, -17, 27, 26, -28, 22, 30, 58, -56, 32, -68, 42, -54, 9, -12, -75, -76, -27, 48, -18, -42, 35, -63, -71, 19, -8, -61, -68, 44, -55, 44, 38, -85, 40, 5, 20, -67, 13, 31, -16, -21, -16, 36, -29, -47, -21, 35, -8, -27, -17, -38, -66, -53, -73, 8, 11, 54, -14, 21, 27, -5, 34, 16, -106, -128, 5, 30, -69, 25, 49, -35, -52, -67, -28, -31, 13, -1, -77, -51, 42, -45, 39, -36, 21, 31, 7, 39, 14, -39, -5, -30, 29, -9, -34, 22, 14, -36, 16, -45, -27, 52, -24, -82, 23, 26, -5, 15, -47, -78, -2, 36, -5, 15, 5, 0, 14, 9, -15, 12, -26, 27, -91, 17, -15, 27, -17, -82, -46, 38, 44, -6, -28, 26, -71, -1, -75, 1, 10, -55, -35, 44, 5, -57, 7, 15, -40, 25, -74, 25, -47, -28, 53, -119, 37, 19, -10, -47, -32, 26, 32, -90, 25, -70, 3, -1, -4, -44, 3, 35, -1, -32, 47, 42, 65, -13, 24, 59, 25, 54, 52, 16, -16, 35, -73, -38, 14, -110, -20, 32, 27, 17, 14, 33, 31, -16, -10, 35, 30, 35, -55, -47, 30, -28, -60, -3, -114, 31, 24, -31, -99, -26, 36, 0, -32, -7, -57, -54, 33, -32, 49, 36, -30, -26, 2, 52, -36, -66, -54, -46, 27, 40, -33, 51, -1, -41, 6, 30, -4, 26, 8, 54, -10, 11, -15, -16, -4, -8, -68, -36, -114, 3, 33, 0, 36, -59, 4, -5, -9, -102, 9, -72, -119, -29, -48, 23, -59, 46, 27, -3, 6 };
+alignas(64) constexpr std::array<int8_t, 1280> fc2_weight = { -63, 17, -14, -59, -21, 32, 9, -28, 27, -23, -34, -9, -13, -57, -58, 18, -37, -50, 45, -35, 23, -44, 29, 4, 4, 31, 33, -19, -37, 27, 64, -38, 24, 3, 43, 57, 49, 6, 32, -15, -46, -9, 26, 10, -5, -13, -23, 15, -38, 19, 101, 27, -3, -25, -23, -14, -27, -74, -23, -17, 46, -40, -12, -65, -39, 34, 28, -34, -26, -50, 16, 13, 23, -39, 49, 22, 36, -20, 26, 41, -49, -2, 39, 25, -2, -36, 35, 43, -37, -79, -2, 24, -8, -67, -63, -51, 0, -19, 20, 27, 46, 43, 4, -21, -35, 18, 13, -30, 42, -84, -1, 34, 4, -12, -44, -31, -54, 34, 22, -49, -31, -62, -47, -62, -13, 51, 47, -27, -16, -61, 45, 21, -7, -34, 11, -1, -39, 29, 21, -47, 48, -52, 26, 60, 32, 24, 85, 14, 45, 36, 32, 16, 46, -5, -46, 21, -12, 12, -21, -14, -14, -49, -41, -9, 44, -18, -16, 29, 13, 33, 23, -4, 32, 21, -3, 22, 15, 110, -16, -6, -45, 50, -25, -42, -55, -37, 3, -64, -18, 51, 42, 22, 0, 8, 45, 3, 60, 6, 21, -45, -53, -19, -32, 2, -38, 41, -54, 17, -47, 12, -30, -5, 57, 41, 17, -45, 63, 10, -5, -67, 10, 4, -5, -37, 68, -16, 25, -47, 21, -64, -45, -26, 2, -38, 36, -43, 0, -50, 26, 17, 26, -26, -49, -8, 37, -44, -11, 93, 11, 63, -26, 28, 24, -47, -48, -20, 13, 54, 8, 8, 9, 24, -120, 26, 66, -14, 57, -23, -36, 23, 16, -16, 38, 16, -35, 27, 37, -27, 5, -88, 24, 21, -7, 29, 0, 32, -107, 24, -19, 34, 39, 44, -57, -36, -2, 34, 36, 18, 7, -25, 50, -9, -23, -17, -24, -95, 62, -47, -17, 38, -13, -40, -20, 75, 78, 8, 53, 18, 14, 20, -32, 4, 29, 51, 6, -41, 30, -123, 9, 32, 43, -46, 54, 34, -10, -23, 23, -41, 42, -48, -27, -24, -12, -6, 23, 15, -97, -14, 1, -25, -11, -54, 59, 9, 32, -8, 41, -31, -25, -29, 13, 46, 8, 50, 4, -41, -19, 46, -47, 34, 16, -43, 18, 28, 15, 77, 6, -75, -17, 38, 11, 29, 27, 48, 21, -26, -52, 10, 23, 52, 36, 14, 20, -44, -53, 34, 51, -12, -28, 36, 23, -3, -4, 38, -10, -24, -18, 29, 3, -43, 2, 22, -5, 50, -10, -23, -47, 30, -9, -19, -31, -70, 30, 34, 4, 33, -19, -38, -44, -19, 28, 41, -22, -103, -33, 24, -16, 41, -47, -12, -57, 24, -39, 23, -18, 4, 51, 87, -23, -45, -18, -16, -19, -1, -6, -100, 14, -5, 9, 7, -42, -26, 33, 48, 13, 2, -29, 12, -61, -12, -48, -28, 76, 41, -58, 14, 16, 9, 41, -51, -84, 24, 36, -43, -32, -9, -5, 46, 36, -35, 44, 4, -27, 51, -37, 35, 56, 46, 18, -20, 10, -50, -21, -53, -73, -18, 55, -16, -2, 12, 27, 46, 44, 37, -28, -17, -22, 36, 47, -55, -119, 45, -33, -4, -40, -10, -29, -103, 15, -42, 18, -61, 85, 35, -10, -64, -23, -128, 23, 11, -5, 63, 8, -115, -9, 30, 1, -75, -27, 17, -80, 60, 40, 7, -43, 30, -27, -47, -6, 20, 36, 28, -36, -18, -11, -77, 33, -6, 23, -67, 13, -4, 22, -53, -1, 3, 59, 34, 12, -76, 17, 51, -9, 71, 2, 11, -61, -40, 16, 21, -19, -18, -99, -73, -70, -5, 40, 42, -73, 29, -58, -50, -13, -35, 38, 11, -3, -27, 62, -39, 6, -63, -49, -1, 21, 52, 8, -36, -47, -74, -86, 18, 7, -73, -14, -64, 47, 44, 31, -1, 49, 34, 38, 20, -89, -72, 24, -16, 6, 48, 3, -22, 102, -38, -16, 44, -24, 41, 30, -34, 57, 20, 59, 79, -75, 76, 12, 37, 11, 0, -108, -57, 37, 51, 36, 68, 32, 23, -36, -128, -17, 88, 5, -20, -44, -61, 37, 2, 31, -19, 3, -22, -54, 26, -30, -5, -58, 24, -7, 54, -37, -58, 29, -59, -2, -17, 28, 22, -12, 15, -70, 18, -4, -2, 16, -37, -9, -5, -97, -44, 31, 29, -15, -71, 0, 36, -30, 1, -23, 17, -19, 27, 33, 4, -19, -55, -12, 2, -14, 10, 62, 28, 41, 45, 8, 41, -46, -7, -69, -3, -108, 17, 9, 25, -29, 14, -6, 23, -13, -15, -59, -33, -86, -32, 33, 43, -38, -28, 36, -95, -46, 41, 58, 50, 13, 20, 10, 4, -53, 17, -64, -95, -3, 41, 40, 32, -12, -46, -8, -21, -23, -59, 52, -46, -25, -38, 16, 35, -17, 5, -45, -6, 23, 67, 32, 14, 19, -21, 63, -3, 32, 8, 22, -79, 24, 5, -26, -25, -31, 13, 2, -13, -19, -36, -33, -45, 20, -47, 28, 14, -13, 37, 34, -12, 39, -49, -3, -74, -39, 17, -45, 4, -53, 40, 37, 38, -29, 44, -11, 54, 9, -46, 13, -19, 32, 1, -50, -4, -24, -22, -41, 40, 16, 18, -56, 38, -128, 25, 47, -49, -33, 2, -69, 30, -12, -13, -48, -19, -12, -44, -33, -45, 10, 38, -36, 94, -33, -78, -38, -97, 39, 15, 8, -20, 36, 13, 58, -32, 29, 27, 7, -25, 43, -109, -15, -74, 3, -11, -26, -36, -68, -48, 9, -32, 61, -26, -1, 22, -79, 46, 54, -23, -16, -42, 46, -5, 39, 7, 63, 24, -59, 1, 29, -29, -20, 42, -52, 47, -12, -38, -47, 16, -4, -13, -48, 70, 41, -3, 11, -5, 47, -36, 33, -28, -28, 67, 37, 20, -32, 8, 8, 40, 11, 45, -20, 56, 63, 14, -69, 71, -14, -41, -40, 39, 27, 29, 27, 52, -35, 29, 55, 22, -83, 21, -17, 15, 7, 20, -57, -32, 95, 12, 44, 33, -7, -1, -60, 9, -63, -46, 31, -64, -36, -52, 34, 20, 30, 33, -47, 3, -37, -22, -60, 70, 41, 9, -12, 13, 21, 45, -15, -17, 27, 26, -28, 22, 30, 58, -56, 32, -68, 42, -54, 9, -12, -75, -76, -27, 48, -18, -42, 35, -63, -71, 19, -8, -61, -68, 44, -55, 44, 38, -85, 40, 5, 20, -67, 13, 31, -16, -21, -16, 36, -29, -47, -21, 35, -8, -27, -17, -38, -66, -53, -73, 8, 11, 54, -14, 21, 27, -5, 34, 16, -106, -128, 5, 30, -69, 25, 49, -35, -52, -67, -28, -31, 13, -1, -77, -51, 42, -45, 39, -36, 21, 31, 7, 39, 14, -39, -5, -30, 29, -9, -34, 22, 14, -36, 16, -45, -27, 52, -24, -82, 23, 26, -5, 15, -47, -78, -2, 36, -5, 15, 5, 0, 14, 9, -15, 12, -26, 27, -91, 17, -15, 27, -17, -82, -46, 38, 44, -6, -28, 26, -71, -1, -75, 1, 10, -55, -35, 44, 5, -57, 7, 15, -40, 25, -74, 25, -47, -28, 53, -119, 37, 19, -10, -47, -32, 26, 32, -90, 25, -70, 3, -1, -4, -44, 3, 35, -1, -32, 47, 42, 65, -13, 24, 59, 25, 54, 52, 16, -16, 35, -73, -38, 14, -110, -20, 32, 27, 17, 14, 33, 31, -16, -10, 35, 30, 35, -55, -47, 30, -28, -60, -3, -114, 31, 24, -31, -99, -26, 36, 0, -32, -7, -57, -54, 33, -32, 49, 36, -30, -26, 2, 52, -36, -66, -54, -46, 27, 40, -33, 51, -1, -41, 6, 30, -4, 26, 8, 54, -10, 11, -15, -16, -4, -8, -68, -36, -114, 3, 33, 0, 36, -59, 4, -5, -9, -102, 9, -72, -119, -29, -48, 23, -59, 46, 27, -3, 6 };
 
-const float fc2_scale = 0.00243421;
+constexpr float fc2_scale = 0.00243421;
 
-const std::vector<float> fc2_bias = { -0.011966601014137268,0.0490017868578434,-0.054666996002197266,0.013661564327776432,0.0855969786643982,0.008908791467547417,-0.010472199879586697,-0.02685420960187912,0.02491043135523796,-0.05323871225118637 };
+alignas(64) constexpr std::array<float, 10> fc2_bias = { -0.011966601014137268,0.0490017868578434,-0.054666996002197266,0.013661564327776432,0.0855969786643982,0.008908791467547417,-0.010472199879586697,-0.02685420960187912,0.02491043135523796,-0.05323871225118637 };
@@ -0,0 +1,152 @@
+#pragma once
+
+// Dynamic request batching.
+//
+// Callers block in submit() while a single batching thread (run()) collects their
+// requests and hands them to Engine::forward_batch in groups. A batch is closed as
+// soon as it reaches max_batch requests or its oldest request has waited
+// max_delay_us, so batching raises throughput without unbounded queueing delay.
+// Each batch runs on the model that is current when it starts (server/model_handle.h),
+// so a reload never stalls the queue.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "engine/engine.h"
+#include "server/model_handle.h"
+#include "server/protocol.h"
+
+namespace quantnn
+{
+
+struct BatcherStats
+{
+    uint64_t requests = 0;
+    uint64_t batches = 0;
+    uint64_t full_batches = 0; // closed because max_batch was reached
+};
+
+class Batcher
+{
+public:
+    // every model the handle is given must have the output_dim of the current one, at most
+    // kMaxLogits so that the logits fit a Response
+    Batcher(ModelHandle & model, int max_batch, int max_delay_us)
+        : model{model}, max_batch{std::max(1, max_batch)}, max_delay{std::chrono::microseconds(max_delay_us)}
+    {
+        out_dim = model.read()->engine->output_dim();
+        if (out_dim > kMaxLogits)
+        {
+            throw std::invalid_argument("the model has " + std::to_string(out_dim) + " outputs, a response holds at most "
+                                        + std::to_string(kMaxLogits));
+        }
+        images.resize(static_cast<size_t>(this->max_batch) * Engine::input_dim);
+        logits.resize(static_cast<size_t>(this->max_batch) * out_dim);
+        batch.reserve(this->max_batch);
+    }
+
+    // runs one image through the engine as part of a batch; returns the label
+    int submit(const float * image, float * out_logits)
+    {
+        Request request { image, out_logits, std::chrono::steady_clock::now() };
+        std::unique_lock<std::mutex> lock(mutex);
+        queue.push_back(&request);
+        queue_cv.notify_one();
+        request.done_cv.wait(lock, [&] { return request.done; });
+        return request.label;
+    }
+
+    // the batching loop; returns after stop() once the queue is drained
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            queue_cv.wait(lock, [&] { return stopping || !queue.empty(); });
+            if (queue.empty())
+            {
+                break;
+            }
+
+            auto deadline = queue.front()->enqueued + max_delay;
+            queue_cv.wait_until(lock, deadline, [&] { return stopping || static_cast<int>(queue.size()) >= max_batch; });
+
+            int n = std::min(static_cast<int>(queue.size()), max_batch);
+            batch.assign(queue.begin(), queue.begin() + n);
+            queue.erase(queue.begin(), queue.begin() + n);
+            stats.requests += n;
+            stats.batches++;
+            stats.full_batches += n == max_batch ? 1 : 0;
+            lock.unlock();
+
+            for (int i = 0; i < n; i++)
+            {
+                memcpy(&images[i * Engine::input_dim], batch[i]->image, sizeof(float) * Engine::input_dim);
+            }
+            {
+                ModelHandle::ReadGuard current = model.read();
+                current->engine->forward_batch(images.data(), n, logits.data());
+            }
+
+            lock.lock();
+            for (int i = 0; i < n; i++)
+            {
+                Request * r = batch[i];
+                memcpy(r->logits, &logits[i * out_dim], sizeof(float) * out_dim);
+                r->label = argmax(r->logits, out_dim);
+                r->done = true;
+                r->done_cv.notify_one();
+            }
+        }
+    }
+
+    void stop()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        queue_cv.notify_all();
+    }
+
+    BatcherStats get_stats()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+private:
+    struct Request
+    {
+        const float * image;
+        float * logits;
+        std::chrono::steady_clock::time_point enqueued;
+        int label = -1;
+        bool done = false;
+        std::condition_variable done_cv;
+    };
+
+    ModelHandle & model;
+    int out_dim = 0;
+    const int max_batch;
+    const std::chrono::microseconds max_delay;
+
+    std::mutex mutex;
+    std::condition_variable queue_cv;
+    std::deque<Request *> queue;
+    bool stopping = false;
+    BatcherStats stats;
+
+    // owned by the batching thread
+    std::vector<Request *> batch;
+    std::vector<float> images;
+    std::vector<float> logits;
+};
+
+} // namespace quantnn
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "common/bench.h"
+#include "server/protocol.h"
+
+#include "mlp/static_quantization/data_7.h"
+
+// Sends the test image to inference_server from several concurrent connections
+// and reports the predictions, throughput and latency percentiles. With --distinct N
+// the requests cycle through N copies of the image that differ in one pixel, to
+// exercise the result cache of the server at a hit rate below 100%.
+
+int main(int argc, char * argv[])
+{
+    std::string socket_path = "/tmp/quantnn.sock";
+    int requests = 1000;
+    int concurrency = 8;
+    bool u8 = false;
+    int distinct = 1;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc)
+        {
+            socket_path = argv[++i];
+        }
+        else if (arg == "--requests" && i + 1 < argc)
+        {
+            requests = atoi(argv[++i]);
+        }
+        else if (arg == "--concurrency" && i + 1 < argc)
+        {
+            concurrency = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--u8")
+        {
+            u8 = true;
+        }
+        else if (arg == "--distinct" && i + 1 < argc)
+        {
+            distinct = std::max(1, atoi(argv[++i]));
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--socket /tmp/quantnn.sock] [--requests 1000] [--concurrency 8] [--u8] [--distinct 1]" << std::endl;
+            return 1;
+        }
+    }
+
+    // the test image as raw pixels for --u8, and variant v with pixel v % 784 changed
+    std::vector<uint8_t> pixels (quantnn::kImagePixels);
+    for (int i = 0; i < quantnn::kImagePixels; i++)
+    {
+        float value = std::round((data[i] * 0.3081f + 0.1307f) * 255.0f);
+        pixels[i] = static_cast<uint8_t>(std::clamp(value, 0.0f, 255.0f));
+    }
+    std::vector<std::vector<uint8_t>> pixel_variants (distinct, pixels);
+    std::vector<std::vector<float>> image_variants (distinct, std::vector<float>(data.begin(), data.end()));
+    for (int v = 1; v < distinct; v++)
+    {
+        const int i = v % quantnn::kImagePixels;
+        const int step = v / quantnn::kImagePixels + 1;
+        pixel_variants[v][i] = static_cast<uint8_t>(pixels[i] + step);
+        image_variants[v][i] += 0.01f * step;
+    }
+
+    std::mutex mutex;
+    std::vector<double> latencies;
+    std::vector<int> label_counts (quantnn::kMaxLogits, 0);
+    int failures = 0;
+
+    double start = quantnn::now_us();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < concurrency; t++)
+    {
+        int count = requests / concurrency + (t < requests % concurrency ? 1 : 0);
+        threads.emplace_back([&, t, count] {
+            std::vector<double> local;
+            std::vector<int> local_labels (quantnn::kMaxLogits, 0);
+            int fd = -1;
+            try
+            {
+                fd = quantnn::connect_unix(socket_path);
+            }
+            catch (const std::exception & e)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                std::cerr << e.what() << std::endl;
+                failures += count;
+                return;
+            }
+
+            quantnn::RequestHeader header { quantnn::kRequestMagic, static_cast<uint32_t>(u8 ? quantnn::PixelFormat::U8 : quantnn::PixelFormat::F32) };
+            size_t payload_size = u8 ? pixels.size() : quantnn::kImagePixels * sizeof(float);
+            int local_failures = 0;
+            for (int i = 0; i < count; i++)
+            {
+                const int v = (i * concurrency + t) % distinct;
+                const void * payload = u8 ? static_cast<const void *>(pixel_variants[v].data())
+                                          : static_cast<const void *>(image_variants[v].data());
+                quantnn::Response response;
+                double t0 = quantnn::now_us();
+                bool ok = quantnn::write_full(fd, &header, sizeof(header)) && quantnn::write_full(fd, payload, payload_size)
+                          && quantnn::read_full(fd, &response, sizeof(response));
+                if (!ok)
+                {
+                    local_failures += count - i;
+                    break;
+                }
+                local.push_back(quantnn::now_us() - t0);
+                local_labels[std::clamp(response.label, 0, quantnn::kMaxLogits - 1)]++;
+            }
+            close(fd);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            latencies.insert(latencies.end(), local.begin(), local.end());
+            for (int l = 0; l < quantnn::kMaxLogits; l++)
+            {
+                label_counts[l] += local_labels[l];
+            }
+            failures += local_failures;
+        });
+    }
+    for (std::thread & t : threads)
+    {
+        t.join();
+    }
+    double elapsed_us = quantnn::now_us() - start;
+
+    quantnn::Stats stats = quantnn::summarize(latencies);
+    int top_label = static_cast<int>(std::max_element(label_counts.begin(), label_counts.end()) - label_counts.begin());
+    std::cout << "Prediction: " << top_label << " (" << label_counts[top_label] << "/" << latencies.size() << " requests)" << std::endl;
+    std::cout << "Throughput: " << latencies.size() / (elapsed_us * 1e-6) << " req/s, failures: " << failures << std::endl;
+    std::cout << "Latency [us]: p50 " << stats.median << ", p95 " << stats.p95 << ", p99 " << quantnn::percentile(latencies, 99.0)
+              << ", max " << stats.max << std::endl;
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,360 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/thread_pool.h"
+#include "engine/factory.h"
+#include "engine/shared_bundle.h"
+#include "kernels/dispatch.h"
+#include "kernels/tuning.h"
+#include "server/batcher.h"
+#include "server/model_handle.h"
+#include "server/protocol.h"
+#include "server/result_cache.h"
+
+// Long-running inference daemon: loads a model bundle once and serves
+// classification requests over a Unix domain socket (see server/protocol.h),
+// batching concurrent requests through Engine::forward_batch. With --cache-entries,
+// byte-identical requests are answered from a result cache (server/result_cache.h).
+// With --shared-weights, worker processes share one read-only copy of the model
+// (engine/shared_bundle.h). SIGHUP reloads the bundle (and --layer-config) on a reload
+// thread and swaps it in while requests and new connections keep being served
+// (server/model_handle.h).
+
+struct Options
+{
+    std::string model = "mnist_conv.qnn";
+    std::string precision = "static";
+    std::string layer_config;
+    std::string socket_path = "/tmp/quantnn.sock";
+    int max_batch = 32;
+    int max_delay_us = 1000;
+    int threads = 1;
+    size_t cache_entries = 0; // 0 = no result cache
+    std::string shared_weights; // shared memory segment name, empty = private copy
+};
+
+std::atomic<bool> stop_requested { false };
+std::atomic<bool> reload_requested { false };
+
+void handle_signal(int)
+{
+    stop_requested = true;
+}
+
+void handle_reload(int)
+{
+    reload_requested = true;
+}
+
+// the bundle and engine of the options; `source` describes where the weights came from
+std::unique_ptr<quantnn::LoadedModel> load(const Options & options, bool reload, std::string & source)
+{
+    auto model = std::make_unique<quantnn::LoadedModel>();
+    if (options.shared_weights.empty())
+    {
+        model->bundle = quantnn::load_model(options.model);
+        source = "private copy";
+    }
+    else
+    {
+        // the first worker to reload a changed file replaces the segment, the others attach to it
+        bool published = false;
+        model->bundle = reload ? quantnn::reopen_shared_model(options.shared_weights, options.model, &published)
+                               : quantnn::open_shared_model(options.shared_weights, options.model, &published);
+        source = (published ? "published to /dev/shm/" : "attached to /dev/shm/") + options.shared_weights;
+    }
+    if (options.layer_config.empty())
+    {
+        model->engine = quantnn::make_engine(model->bundle, quantnn::parse_precision(options.precision));
+    }
+    else
+    {
+        model->engine = quantnn::make_engine(model->bundle, quantnn::LayerPrecisions::load(options.layer_config));
+    }
+    return model;
+}
+
+double elapsed_ms(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// loads the model again and swaps it in; requests keep running on the old one meanwhile
+void reload(const Options & options, quantnn::ModelHandle & handle, int output_dim)
+{
+    const auto start = std::chrono::steady_clock::now();
+    try
+    {
+        std::string source;
+        std::unique_ptr<quantnn::LoadedModel> next = load(options, true, source);
+        if (next->engine->output_dim() != output_dim)
+        {
+            throw std::runtime_error("the reloaded model has " + std::to_string(next->engine->output_dim()) + " outputs instead of "
+                                     + std::to_string(output_dim));
+        }
+        // one forward pass here takes the page faults on the new weights before a batch would
+        std::vector<float> image (quantnn::Engine::input_dim, 0.0f);
+        std::vector<float> logits (output_dim);
+        next->engine->forward(image.data(), logits.data());
+        const double load_ms = elapsed_ms(start);
+        const quantnn::ReloadStats stats = handle.replace(std::move(next));
+        std::cout << "Reloaded model generation " << stats.generation << " in " << elapsed_ms(start) << " ms (load and warm-up " << load_ms
+                  << " ms, old model freed " << stats.grace_us << " us after the swap, " << source << ")" << std::endl;
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << "Reload failed, keeping generation " << handle.generation() << ": " << e.what() << std::endl;
+    }
+}
+
+void serve_connection(int fd, quantnn::Batcher & batcher, quantnn::ResultCache * cache, const quantnn::ModelHandle & handle,
+                      int output_dim)
+{
+    std::vector<float> image (quantnn::kImagePixels);
+    std::vector<uint8_t> pixels (quantnn::kImagePixels);
+    quantnn::RequestHeader header;
+    while (quantnn::read_full(fd, &header, sizeof(header)))
+    {
+        if (header.magic != quantnn::kRequestMagic)
+        {
+            break;
+        }
+        const bool u8 = header.format == static_cast<uint32_t>(quantnn::PixelFormat::U8);
+        if (u8)
+        {
+            if (!quantnn::read_full(fd, pixels.data(), pixels.size()))
+            {
+                break;
+            }
+        }
+        else if (header.format == static_cast<uint32_t>(quantnn::PixelFormat::F32))
+        {
+            if (!quantnn::read_full(fd, image.data(), image.size() * sizeof(float)))
+            {
+                break;
+            }
+        }
+        else
+        {
+            break;
+        }
+
+        auto run = [&](float * logits) {
+            if (u8)
+            {
+                for (int i = 0; i < quantnn::kImagePixels; i++)
+                {
+                    image[i] = quantnn::normalize_pixel(pixels[i]);
+                }
+            }
+            return batcher.submit(image.data(), logits);
+        };
+        quantnn::Response response {};
+        response.num_logits = static_cast<uint32_t>(output_dim);
+        if (cache != nullptr)
+        {
+            // keyed by the bytes as received, so a hit skips the normalization as well
+            const void * raw = u8 ? static_cast<const void *>(pixels.data()) : static_cast<const void *>(image.data());
+            const size_t raw_size = u8 ? pixels.size() : image.size() * sizeof(float);
+            // results of another model generation are never hit
+            const uint64_t seed = handle.generation() << 8 | header.format;
+            response.label = cache->get_or_compute(raw, raw_size, seed, response.logits, run);
+        }
+        else
+        {
+            response.label = run(response.logits);
+        }
+        if (!quantnn::write_full(fd, &response, sizeof(response)))
+        {
+            break;
+        }
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--model" && i + 1 < argc)
+        {
+            options.model = argv[++i];
+        }
+        else if (arg == "--precision" && i + 1 < argc)
+        {
+            options.precision = argv[++i];
+        }
+        else if (arg == "--layer-config" && i + 1 < argc)
+        {
+            options.layer_config = argv[++i];
+        }
+        else if (arg == "--socket" && i + 1 < argc)
+        {
+            options.socket_path = argv[++i];
+        }
+        else if (arg == "--max-batch" && i + 1 < argc)
+        {
+            options.max_batch = atoi(argv[++i]);
+        }
+        else if (arg == "--max-delay-us" && i + 1 < argc)
+        {
+            options.max_delay_us = atoi(argv[++i]);
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            options.threads = atoi(argv[++i]);
+        }
+        else if (arg == "--cache-entries" && i + 1 < argc)
+        {
+            options.cache_entries = static_cast<size_t>(std::max(0L, atol(argv[++i])));
+        }
+        else if (arg == "--shared-weights" && i + 1 < argc)
+        {
+            options.shared_weights = argv[++i];
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--model mnist_conv.qnn] [--precision fp32|dynamic|static]"
+                      << " [--layer-config precision.cfg] [--socket /tmp/quantnn.sock] [--max-batch 32] [--max-delay-us 1000] [--threads 1]"
+                      << " [--cache-entries 0] [--shared-weights quantnn_mnist]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::unique_ptr<quantnn::ModelHandle> handle;
+    int listen_fd = -1;
+    std::string weights_source;
+    double load_ms = 0.0;
+    try
+    {
+        const auto load_start = std::chrono::steady_clock::now();
+        handle.reset(new quantnn::ModelHandle(load(options, false, weights_source)));
+        load_ms = elapsed_ms(load_start);
+        listen_fd = quantnn::listen_unix(options.socket_path);
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    signal(SIGINT, handle_signal);
+    signal(SIGTERM, handle_signal);
+    signal(SIGHUP, handle_reload);
+
+    quantnn::set_intra_op_threads(options.threads);
+    const quantnn::Isa isa = quantnn::active_isa();
+    int output_dim = 0;
+    std::string engine_name;
+    size_t bundle_bytes = 0;
+    {
+        quantnn::ModelHandle::ReadGuard model = handle->read();
+        output_dim = model->engine->output_dim();
+        engine_name = model->engine->name();
+        bundle_bytes = model->bundle->size();
+    }
+    if (output_dim > quantnn::kMaxLogits)
+    {
+        std::cerr << "The model has " << output_dim << " outputs, but a response holds at most " << quantnn::kMaxLogits << std::endl;
+        close(listen_fd);
+        unlink(options.socket_path.c_str());
+        return 1;
+    }
+    quantnn::Batcher batcher(*handle, options.max_batch, options.max_delay_us);
+    std::unique_ptr<quantnn::ResultCache> cache;
+    if (options.cache_entries > 0)
+    {
+        cache.reset(new quantnn::ResultCache(options.cache_entries, output_dim));
+    }
+    std::thread batch_thread([&] { batcher.run(); });
+    // reloads run here so that the accept loop keeps taking connections during a load
+    std::thread reload_thread([&] {
+        while (!stop_requested)
+        {
+            if (reload_requested.exchange(false))
+            {
+                reload(options, *handle, output_dim);
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            }
+        }
+    });
+    std::cout << "Serving " << engine_name << " on " << options.socket_path << " (max batch "
+              << options.max_batch << ", max delay " << options.max_delay_us << " us, " << options.threads << " threads per batch, "
+              << quantnn::isa_name(isa) << " kernels, " << quantnn::tuning_cache().size() << " tuned shapes, "
+              << (cache ? std::to_string(cache->capacity()) + " cached results" : std::string("no result cache")) << ")" << std::endl;
+    std::cout << "Model loaded in " << load_ms << " ms (" << bundle_bytes << " bytes, " << weights_source << ")" << std::endl;
+
+    // connection threads are detached; each removes and closes its own socket
+    std::mutex connections_mutex;
+    std::condition_variable connections_cv;
+    std::vector<int> connection_fds;
+    while (!stop_requested)
+    {
+        pollfd pfd { listen_fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 200) <= 0)
+        {
+            continue;
+        }
+        int fd = accept(listen_fd, nullptr, nullptr);
+        if (fd < 0)
+        {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        connection_fds.push_back(fd);
+        std::thread([&, fd] {
+            serve_connection(fd, batcher, cache.get(), *handle, output_dim);
+            std::lock_guard<std::mutex> lock(connections_mutex);
+            connection_fds.erase(std::find(connection_fds.begin(), connection_fds.end(), fd));
+            close(fd);
+            connections_cv.notify_all();
+        }).detach();
+    }
+
+    // stop accepting, finish a running reload, unblock the connection threads, then drain the batcher
+    close(listen_fd);
+    unlink(options.socket_path.c_str());
+    reload_thread.join();
+    {
+        std::unique_lock<std::mutex> lock(connections_mutex);
+        for (int fd : connection_fds)
+        {
+            shutdown(fd, SHUT_RDWR);
+        }
+        connections_cv.wait(lock, [&] { return connection_fds.empty(); });
+    }
+    batcher.stop();
+    batch_thread.join();
+
+    quantnn::BatcherStats stats = batcher.get_stats();
+    double mean_batch = stats.batches > 0 ? static_cast<double>(stats.requests) / stats.batches : 0.0;
+    std::cout << "Served " << stats.requests << " requests in " << stats.batches << " batches (mean batch size "
+              << mean_batch << ", " << stats.full_batches << " full)" << std::endl;
+    if (cache)
+    {
+        quantnn::ResultCacheStats c = cache->get_stats();
+        std::cout << "Result cache: " << c.hits << "/" << c.lookups << " hits (" << 100.0 * c.hit_rate() << "%), "
+                  << c.evictions << " evictions, " << c.saved_us() * 1e-3 << " ms of inference saved" << std::endl;
+    }
+    return 0;
+}
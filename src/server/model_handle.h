@@ -0,0 +1,172 @@
+#pragma once
+
+// A model that can be replaced while requests run on it.
+//
+// ModelHandle holds the current LoadedModel (a bundle and the engine built on it) behind
+// an atomic pointer, with epoch-based reclamation: a reader announces the global epoch
+// in its slot before it loads the pointer and clears the slot when done. replace()
+// swaps the pointer, advances the epoch and frees the previous model once no slot still
+// holds an older epoch, i.e. once every forward pass that could have seen it has
+// returned. Readers never wait: a request that starts during a reload runs on the old or
+// the new model, whole, and only the reloading thread waits out the grace period.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "engine/engine.h"
+#include "engine/model_bundle.h"
+
+namespace quantnn
+{
+
+struct LoadedModel
+{
+    std::shared_ptr<const ModelBundle> bundle;
+    std::unique_ptr<Engine> engine;
+    uint64_t generation = 0; // set by ModelHandle, 1 for the first model
+};
+
+struct ReloadStats
+{
+    uint64_t generation = 0;
+    double grace_us = 0.0; // from the swap until the old model could be freed
+};
+
+namespace handle_detail
+{
+
+constexpr int kMaxReaders = 64;
+
+inline std::atomic<bool> * taken_slots()
+{
+    static std::atomic<bool> taken[kMaxReaders] {};
+    return taken;
+}
+
+// a reader slot per thread, returned when the thread exits
+inline int reader_slot()
+{
+    struct Owner
+    {
+        int index = -1;
+        ~Owner()
+        {
+            if (index >= 0)
+            {
+                taken_slots()[index].store(false, std::memory_order_release);
+            }
+        }
+    };
+    thread_local Owner owner;
+    if (owner.index < 0)
+    {
+        for (int i = 0; i < kMaxReaders && owner.index < 0; i++)
+        {
+            bool expected = false;
+            if (taken_slots()[i].compare_exchange_strong(expected, true))
+            {
+                owner.index = i;
+            }
+        }
+        if (owner.index < 0)
+        {
+            throw std::runtime_error("more than 64 threads read a ModelHandle");
+        }
+    }
+    return owner.index;
+}
+
+} // namespace handle_detail
+
+class ModelHandle
+{
+public:
+    explicit ModelHandle(std::unique_ptr<LoadedModel> initial)
+    {
+        initial->generation = 1;
+        current.store(initial.release(), std::memory_order_release);
+    }
+
+    ~ModelHandle() { delete current.load(std::memory_order_acquire); }
+
+    ModelHandle(const ModelHandle &) = delete;
+    ModelHandle & operator=(const ModelHandle &) = delete;
+
+    // The current model, pinned until the guard is destroyed. Guards do not nest.
+    class ReadGuard
+    {
+    public:
+        ReadGuard(ModelHandle & handle, int slot) : slot{&handle.slots[slot].epoch}
+        {
+            // announce before loading the pointer (both seq_cst), see replace()
+            this->slot->store(handle.epoch.load(), std::memory_order_seq_cst);
+            model = handle.current.load(std::memory_order_seq_cst);
+        }
+        ~ReadGuard() { slot->store(0, std::memory_order_release); }
+
+        ReadGuard(const ReadGuard &) = delete;
+        ReadGuard & operator=(const ReadGuard &) = delete;
+
+        const LoadedModel & operator*() const { return *model; }
+        const LoadedModel * operator->() const { return model; }
+
+    private:
+        std::atomic<uint64_t> * slot;
+        const LoadedModel * model;
+    };
+
+    ReadGuard read() { return ReadGuard(*this, handle_detail::reader_slot()); }
+
+    // kept apart from the model, so that it can be read without pinning one
+    uint64_t generation() const { return current_generation.load(std::memory_order_acquire); }
+
+    // Installs next and frees the previous model once no reader can still be using it.
+    // A reader that announced an epoch before the increment may hold the old pointer;
+    // one that announces after it loads the pointer after the swap and gets the new one.
+    ReloadStats replace(std::unique_ptr<LoadedModel> next)
+    {
+        std::lock_guard<std::mutex> lock(writer_mutex);
+        ReloadStats stats;
+        stats.generation = current_generation.load(std::memory_order_relaxed) + 1;
+        next->generation = stats.generation;
+        const auto start = std::chrono::steady_clock::now();
+        LoadedModel * old = current.exchange(next.release(), std::memory_order_seq_cst);
+        current_generation.store(stats.generation, std::memory_order_release);
+        const uint64_t now = epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+        for (const Slot & s : slots)
+        {
+            for (;;)
+            {
+                const uint64_t e = s.epoch.load(std::memory_order_seq_cst);
+                if (e == 0 || e >= now)
+                {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        }
+        stats.grace_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        delete old;
+        return stats;
+    }
+
+private:
+    // one cache line per reader, so that announcing does not false-share
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> epoch { 0 }; // 0 = not reading
+    };
+
+    std::atomic<LoadedModel *> current { nullptr };
+    std::atomic<uint64_t> current_generation { 1 };
+    std::atomic<uint64_t> epoch { 1 };
+    Slot slots[handle_detail::kMaxReaders];
+    std::mutex writer_mutex;
+};
+
+} // namespace quantnn
@@ -0,0 +1,133 @@
+#pragma once
+
+// Wire protocol of inference_server over a Unix domain socket.
+//
+// A connection carries any number of request/response pairs:
+//   request  : RequestHeader, then 784 pixels as float32 (PixelFormat::F32,
+//              already normalized like the training data) or uint8 (PixelFormat::U8,
+//              raw 0-255 pixels that the server normalizes)
+//   response : Response with the predicted label and the logits
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace quantnn
+{
+
+constexpr uint32_t kRequestMagic = 0x524e4e51; // "QNNR"
+constexpr int kImagePixels = 28 * 28;
+constexpr int kMaxLogits = 16;
+
+enum class PixelFormat : uint32_t
+{
+    F32 = 0,
+    U8 = 1,
+};
+
+struct RequestHeader
+{
+    uint32_t magic;
+    uint32_t format;
+};
+
+struct Response
+{
+    int32_t label;
+    uint32_t num_logits;
+    float logits[kMaxLogits];
+};
+
+// the normalization of pytorch/train_*.py: transforms.Normalize((0.1307,), (0.3081,))
+inline float normalize_pixel(uint8_t pixel)
+{
+    return (pixel / 255.0f - 0.1307f) / 0.3081f;
+}
+
+inline bool read_full(int fd, void * buf, size_t n)
+{
+    uint8_t * p = static_cast<uint8_t *>(buf);
+    while (n > 0)
+    {
+        ssize_t r = ::read(fd, p, n);
+        if (r < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (r <= 0)
+        {
+            return false;
+        }
+        p += r;
+        n -= static_cast<size_t>(r);
+    }
+    return true;
+}
+
+inline bool write_full(int fd, const void * buf, size_t n)
+{
+    const uint8_t * p = static_cast<const uint8_t *>(buf);
+    while (n > 0)
+    {
+        ssize_t w = ::send(fd, p, n, MSG_NOSIGNAL);
+        if (w < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (w <= 0)
+        {
+            return false;
+        }
+        p += w;
+        n -= static_cast<size_t>(w);
+    }
+    return true;
+}
+
+inline sockaddr_un unix_address(const std::string & path)
+{
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        throw std::runtime_error("socket path too long: " + path);
+    }
+    memcpy(addr.sun_path, path.c_str(), path.size());
+    return addr;
+}
+
+inline int listen_unix(const std::string & path, int backlog = 128)
+{
+    sockaddr_un addr = unix_address(path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path.c_str());
+    if (fd < 0 || bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || listen(fd, backlog) != 0)
+    {
+        throw std::runtime_error("cannot listen on " + path + ": " + strerror(errno));
+    }
+    return fd;
+}
+
+inline int connect_unix(const std::string & path)
+{
+    sockaddr_un addr = unix_address(path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        throw std::runtime_error("cannot connect to " + path + ": " + strerror(errno));
+    }
+    return fd;
+}
+
+} // namespace quantnn
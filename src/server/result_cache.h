@@ -0,0 +1,344 @@
+#pragma once
+
+// Content-addressed cache of inference results.
+//
+// A request is keyed by a 128-bit hash of its raw bytes, so a byte-identical request
+// (a retry, a duplicate, a synthetic probe) is answered with the stored logits and
+// label for the cost of one hash instead of a forward pass. The input is not stored:
+// two different requests with the same 128-bit hash are treated as impossible.
+//
+// The cache is split into shards, and each shard is set-associative: a key maps to one
+// set of kWays slots, and a full set evicts with CLOCK (a slot hit since the hand last
+// passed it gets a second chance). Lookups take no lock. Every slot has a sequence
+// counter that an insert makes odd while it rewrites the slot, and a lookup that sees
+// the counter odd or changed treats the slot as a miss. Inserts lock their shard.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "server/protocol.h"
+
+namespace quantnn
+{
+
+struct Hash128
+{
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+};
+
+namespace cache_detail
+{
+
+inline uint64_t rotl64(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t fmix64(uint64_t k)
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+} // namespace cache_detail
+
+// MurmurHash3_x64_128 (Austin Appleby, public domain), ~1 us for a 3 KB float image
+inline Hash128 hash128(const void * data, size_t n, uint64_t seed = 0)
+{
+    using cache_detail::rotl64;
+    const uint8_t * p = static_cast<const uint8_t *>(data);
+    const uint64_t c1 = 0x87c37b91114253d5ULL;
+    const uint64_t c2 = 0x4cf5ad432745937fULL;
+    uint64_t h1 = seed;
+    uint64_t h2 = seed;
+
+    const size_t blocks = n / 16;
+    for (size_t i = 0; i < blocks; i++)
+    {
+        uint64_t k1;
+        uint64_t k2;
+        memcpy(&k1, p + i * 16, 8);
+        memcpy(&k2, p + i * 16 + 8, 8);
+        k1 *= c1;
+        k1 = rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        h1 = rotl64(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+        k2 *= c2;
+        k2 = rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        h2 = rotl64(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    const uint8_t * tail = p + blocks * 16;
+    const size_t rest = n & 15;
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    for (size_t i = rest; i > 8; i--)
+    {
+        k2 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 9) * 8);
+    }
+    if (rest > 8)
+    {
+        k2 *= c2;
+        k2 = rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+    }
+    for (size_t i = std::min<size_t>(rest, 8); i > 0; i--)
+    {
+        k1 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 1) * 8);
+    }
+    if (rest > 0)
+    {
+        k1 *= c1;
+        k1 = rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+    }
+
+    h1 ^= n;
+    h2 ^= n;
+    h1 += h2;
+    h2 += h1;
+    h1 = cache_detail::fmix64(h1);
+    h2 = cache_detail::fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+    return Hash128 { h1, h2 };
+}
+
+struct ResultCacheStats
+{
+    uint64_t lookups = 0;
+    uint64_t hits = 0;
+    uint64_t inserts = 0;
+    uint64_t evictions = 0;
+    double hit_us = 0.0;  // total time of the hits (hash + lookup)
+    double miss_us = 0.0; // total time of the misses (hash + lookup + forward + insert)
+
+    double hit_rate() const { return lookups > 0 ? static_cast<double>(hits) / lookups : 0.0; }
+
+    // what the hits would have cost as misses, minus what they did cost
+    double saved_us() const
+    {
+        const uint64_t misses = lookups - hits;
+        if (hits == 0 || misses == 0)
+        {
+            return 0.0;
+        }
+        return hits * (miss_us / misses - hit_us / hits);
+    }
+};
+
+class ResultCache
+{
+public:
+    static constexpr int kWays = 8;
+
+    // at least `entries` results of `num_logits` logits each (at most kMaxLogits), in `shards` shards
+    ResultCache(size_t entries, int num_logits, int shards = 16)
+        : num_logits{num_logits}
+    {
+        if (num_logits > kMaxLogits)
+        {
+            throw std::invalid_argument("a cached result holds at most " + std::to_string(kMaxLogits) + " logits, not "
+                                        + std::to_string(num_logits));
+        }
+        int shard_count = 1;
+        while (shard_count < shards)
+        {
+            shard_count *= 2;
+        }
+        size_t sets = 1;
+        while (sets * kWays * shard_count < entries)
+        {
+            sets *= 2;
+        }
+        set_mask = sets - 1;
+        shard_mask = static_cast<uint64_t>(shard_count - 1);
+        shard_list.reserve(shard_count);
+        for (int s = 0; s < shard_count; s++)
+        {
+            shard_list.emplace_back(new Shard(sets));
+        }
+    }
+
+    size_t capacity() const { return shard_list.size() * (set_mask + 1) * kWays; }
+
+    // Copies the cached logits of `key` and returns its label, or returns -1 on a miss.
+    int lookup(const Hash128 & key, float * logits) const
+    {
+        Shard & shard = *shard_list[key.hi & shard_mask];
+        shard.lookups.fetch_add(1, std::memory_order_relaxed);
+        Slot * set = &shard.slots[(key.lo & set_mask) * kWays];
+        for (int way = 0; way < kWays; way++)
+        {
+            Slot & slot = set[way];
+            const uint32_t before = slot.seq.load(std::memory_order_acquire);
+            if ((before & 1) != 0 || slot.key_lo.load(std::memory_order_relaxed) != key.lo
+                || slot.key_hi.load(std::memory_order_relaxed) != key.hi)
+            {
+                continue;
+            }
+            const int label = slot.label.load(std::memory_order_relaxed);
+            uint32_t bits[kMaxLogits];
+            for (int i = 0; i < num_logits; i++)
+            {
+                bits[i] = slot.logits[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (label < 0 || slot.seq.load(std::memory_order_relaxed) != before)
+            {
+                continue;
+            }
+            memcpy(logits, bits, sizeof(float) * num_logits);
+            slot.referenced.store(1, std::memory_order_relaxed);
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return label;
+        }
+        return -1;
+    }
+
+    void insert(const Hash128 & key, const float * logits, int label)
+    {
+        Shard & shard = *shard_list[key.hi & shard_mask];
+        const size_t set_index = key.lo & set_mask;
+        Slot * set = &shard.slots[set_index * kWays];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        // the slot of the same key (two connections missed on it at once), else an empty one
+        Slot * victim = nullptr;
+        for (int way = 0; way < kWays; way++)
+        {
+            Slot & slot = set[way];
+            const bool empty = slot.label.load(std::memory_order_relaxed) < 0;
+            if (!empty && slot.key_lo.load(std::memory_order_relaxed) == key.lo
+                && slot.key_hi.load(std::memory_order_relaxed) == key.hi)
+            {
+                victim = &slot;
+                break;
+            }
+            if (empty && victim == nullptr)
+            {
+                victim = &slot;
+            }
+        }
+        if (victim == nullptr)
+        {
+            // CLOCK: clear the referenced bits in front of the hand until an unreferenced slot
+            uint8_t & hand = shard.hands[set_index];
+            while (set[hand].referenced.exchange(0, std::memory_order_relaxed) != 0)
+            {
+                hand = static_cast<uint8_t>((hand + 1) % kWays);
+            }
+            victim = &set[hand];
+            hand = static_cast<uint8_t>((hand + 1) % kWays);
+            shard.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const uint32_t seq = victim->seq.load(std::memory_order_relaxed);
+        victim->seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        victim->key_lo.store(key.lo, std::memory_order_relaxed);
+        victim->key_hi.store(key.hi, std::memory_order_relaxed);
+        victim->label.store(label, std::memory_order_relaxed);
+        for (int i = 0; i < num_logits; i++)
+        {
+            uint32_t bits;
+            memcpy(&bits, &logits[i], sizeof(bits));
+            victim->logits[i].store(bits, std::memory_order_relaxed);
+        }
+        victim->referenced.store(0, std::memory_order_relaxed);
+        victim->seq.store(seq + 2, std::memory_order_release);
+        shard.inserts.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // The result of the request `bytes`: from the cache, or from compute(logits), which
+    // returns the label and whose result is then cached. Both paths are timed for
+    // ResultCacheStats::saved_us(). `seed` separates requests of different formats.
+    template <typename Compute>
+    int get_or_compute(const void * bytes, size_t n, uint64_t seed, float * logits, Compute && compute)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const Hash128 key = hash128(bytes, n, seed);
+        Shard & shard = *shard_list[key.hi & shard_mask];
+        int label = lookup(key, logits);
+        const bool hit = label >= 0;
+        if (!hit)
+        {
+            label = compute(logits);
+            insert(key, logits, label);
+        }
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        (hit ? shard.hit_ns : shard.miss_ns).fetch_add(static_cast<uint64_t>(ns.count()), std::memory_order_relaxed);
+        return label;
+    }
+
+    ResultCacheStats get_stats() const
+    {
+        ResultCacheStats stats;
+        for (const auto & shard : shard_list)
+        {
+            stats.lookups += shard->lookups.load(std::memory_order_relaxed);
+            stats.hits += shard->hits.load(std::memory_order_relaxed);
+            stats.inserts += shard->inserts.load(std::memory_order_relaxed);
+            stats.evictions += shard->evictions.load(std::memory_order_relaxed);
+            stats.hit_us += shard->hit_ns.load(std::memory_order_relaxed) * 1e-3;
+            stats.miss_us += shard->miss_ns.load(std::memory_order_relaxed) * 1e-3;
+        }
+        return stats;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint32_t> seq { 0 };
+        std::atomic<uint8_t> referenced { 0 };
+        std::atomic<int32_t> label { -1 }; // -1 = empty
+        std::atomic<uint64_t> key_lo { 0 };
+        std::atomic<uint64_t> key_hi { 0 };
+        std::atomic<uint32_t> logits[kMaxLogits] {};
+    };
+
+    // its own cache lines, so that the counters of different shards do not false-share
+    struct alignas(64) Shard
+    {
+        explicit Shard(size_t sets) : slots(sets * kWays), hands(sets, 0) {}
+
+        std::vector<Slot> slots;
+        std::vector<uint8_t> hands; // CLOCK hand per set, guarded by mutex
+        std::mutex mutex;
+        std::atomic<uint64_t> lookups { 0 };
+        std::atomic<uint64_t> hits { 0 };
+        std::atomic<uint64_t> inserts { 0 };
+        std::atomic<uint64_t> evictions { 0 };
+        std::atomic<uint64_t> hit_ns { 0 };
+        std::atomic<uint64_t> miss_ns { 0 };
+    };
+
+    const int num_logits;
+    size_t set_mask = 0;
+    uint64_t shard_mask = 0;
+    std::vector<std::unique_ptr<Shard>> shard_list;
+};
+
+} // namespace quantnn
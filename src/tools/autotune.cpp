@@ -0,0 +1,366 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/bench.h"
+#include "common/cpu_features.h"
+#include "common/half.h"
+#include "common/thread_pool.h"
+#include "engine/engine.h"
+#include "engine/model_bundle.h"
+#include "engine/reparameterize.h"
+
+#include "kernels/conv.h"
+#include "kernels/linear.h"
+#include "kernels/tuning.h"
+
+// Tunes the conv and linear kernels for the layer shapes of the given model bundles on
+// this machine and writes the winners to the tuning cache (kernels/tuning.h), which
+// every later run loads at startup.
+//
+// The candidates are searched one parameter at a time, each stage keeping the winner
+// of the previous ones: the ISA tier, then the thread split, then row_block x
+// batch_block for the batched linear layers. Each candidate is timed through the real
+// kernel entry points (median of --reps calls, cache-hot). Linear layers are tuned for
+// every --batch size; a batch in between uses the entry of the largest tuned batch below it.
+
+using quantnn::TuneConfig;
+using quantnn::TuneKey;
+using quantnn::TunedOp;
+
+struct Options
+{
+    std::vector<std::string> models { "models/mnist_conv.qnn", "models/mnist_fc.qnn" };
+    std::vector<int> batches { 1, 8, 32 };
+    std::string out = quantnn::tuning_cache_path();
+    int threads = 1;
+    int reps = 200;
+};
+
+std::vector<std::string> split(const std::string & list)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+template <typename T>
+std::vector<T> random_vector(size_t n, double lo, double hi, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(lo, hi);
+    std::vector<T> v (n);
+    for (T & x : v)
+    {
+        x = static_cast<T>(dist(rng));
+    }
+    return v;
+}
+
+// one kernel call of a tuned shape, on random inputs owned by the closure
+std::function<void()> make_call(const TuneKey & key)
+{
+    const int a = key.dims[0];
+    const int b = key.dims[1];
+    const int batch = key.batch;
+    switch (key.op)
+    {
+        case TunedOp::LinearF32:
+        {
+            auto x = std::make_shared<std::vector<float>>(random_vector<float>(static_cast<size_t>(batch) * a, -1, 1, 1));
+            auto w = std::make_shared<std::vector<float>>(random_vector<float>(static_cast<size_t>(a) * b, -0.1, 0.1, 2));
+            auto bias = std::make_shared<std::vector<float>>(random_vector<float>(b, -0.1, 0.1, 3));
+            auto y = std::make_shared<std::vector<float>>(static_cast<size_t>(batch) * b);
+            return [=] { quantnn::linear_f32_batch(x->data(), w->data(), bias->data(), batch, a, b, y->data()); };
+        }
+        case TunedOp::LinearS8S8:
+        {
+            auto x = std::make_shared<std::vector<int8_t>>(random_vector<int8_t>(static_cast<size_t>(batch) * a, -127, 127, 1));
+            auto w = std::make_shared<std::vector<int8_t>>(random_vector<int8_t>(static_cast<size_t>(a) * b, -127, 127, 2));
+            auto acc = std::make_shared<std::vector<int32_t>>(static_cast<size_t>(batch) * b);
+            return [=] { quantnn::linear_s8s8_batch(x->data(), w->data(), batch, a, b, acc->data()); };
+        }
+        case TunedOp::LinearF16:
+        case TunedOp::LinearBF16:
+        {
+            auto x = std::make_shared<std::vector<float>>(random_vector<float>(static_cast<size_t>(batch) * a, -1, 1, 1));
+            auto w = random_vector<float>(static_cast<size_t>(a) * b, -0.1, 0.1, 2);
+            auto hw = std::make_shared<std::vector<quantnn::Half>>(quantnn::narrow_weights<quantnn::Half>(w.data(), w.size()));
+            auto bw = std::make_shared<std::vector<quantnn::BFloat16>>(quantnn::narrow_weights<quantnn::BFloat16>(w.data(), w.size()));
+            auto bias = std::make_shared<std::vector<float>>(random_vector<float>(b, -0.1, 0.1, 3));
+            auto y = std::make_shared<std::vector<float>>(static_cast<size_t>(batch) * b);
+            if (key.op == TunedOp::LinearF16)
+            {
+                return [=] { quantnn::linear_f16_batch(x->data(), hw->data(), bias->data(), batch, a, b, y->data()); };
+            }
+            return [=] { quantnn::linear_bf16_batch(x->data(), bw->data(), bias->data(), batch, a, b, y->data()); };
+        }
+        case TunedOp::LinearU8S8:
+        {
+            auto x = std::make_shared<std::vector<uint8_t>>(random_vector<uint8_t>(static_cast<size_t>(batch) * a, 0, 255, 1));
+            auto w = std::make_shared<std::vector<int8_t>>(random_vector<int8_t>(static_cast<size_t>(a) * b, -127, 127, 2));
+            auto acc = std::make_shared<std::vector<int32_t>>(static_cast<size_t>(batch) * b);
+            return [=] { quantnn::linear_u8s8_batch(x->data(), w->data(), batch, a, b, acc->data()); };
+        }
+        case TunedOp::Conv3x3F32:
+        {
+            const int h = key.dims[2];
+            const int wd = key.dims[3];
+            auto in = std::make_shared<std::vector<float>>(random_vector<float>(static_cast<size_t>(a) * h * wd, -1, 1, 1));
+            auto w = std::make_shared<std::vector<float>>(random_vector<float>(static_cast<size_t>(b) * a * 9, -0.5, 0.5, 2));
+            auto bias = std::make_shared<std::vector<float>>(random_vector<float>(b, -0.1, 0.1, 3));
+            auto out = std::make_shared<std::vector<float>>(static_cast<size_t>(b) * h * wd);
+            return [=] { quantnn::conv3x3_f32(in->data(), a, h, wd, w->data(), bias->data(), b, out->data()); };
+        }
+        case TunedOp::Conv3x3S8S8:
+        {
+            const int h = key.dims[2];
+            const int wd = key.dims[3];
+            auto in = std::make_shared<std::vector<int8_t>>(random_vector<int8_t>(static_cast<size_t>(a) * h * wd, -127, 127, 1));
+            auto w = std::make_shared<std::vector<int8_t>>(random_vector<int8_t>(static_cast<size_t>(b) * a * 9, -127, 127, 2));
+            auto acc = std::make_shared<std::vector<int32_t>>(static_cast<size_t>(b) * h * wd);
+            return [=] { quantnn::conv3x3_s8s8(in->data(), a, h, wd, w->data(), b, acc->data()); };
+        }
+    }
+    return [] {};
+}
+
+// the fp32 linear op of a layer, by the dtype of its weights
+TunedOp float_linear_op(const quantnn::ModelBundle & bundle, const std::string & weight)
+{
+    const quantnn::TensorView * t = bundle.find(weight);
+    if (t != nullptr && t->dtype == quantnn::DType::F16)
+    {
+        return TunedOp::LinearF16;
+    }
+    if (t != nullptr && t->dtype == quantnn::DType::BF16)
+    {
+        return TunedOp::LinearBF16;
+    }
+    return TunedOp::LinearF32;
+}
+
+// the shapes the engines call for one bundle, see engine/*.h
+std::vector<TuneKey> layer_shapes(const quantnn::ModelBundle & bundle, const std::vector<int> & batches)
+{
+    const quantnn::MnistNet net = quantnn::MnistNet::from_bundle(bundle);
+    const TunedOp fc1_op = float_linear_op(bundle, "fc1.weight");
+    const TunedOp fc2_op = float_linear_op(bundle, "fc2.weight");
+    std::vector<TuneKey> keys;
+    if (net.conv)
+    {
+        keys.push_back(TuneKey::conv(TunedOp::Conv3x3F32, 1, net.conv_out_c, net.image_size, net.image_size));
+        keys.push_back(TuneKey::conv(TunedOp::Conv3x3S8S8, 1, net.conv_out_c, net.image_size, net.image_size));
+    }
+    for (int batch : batches)
+    {
+        keys.push_back(TuneKey::linear(fc1_op, net.fc1_in, net.fc1_out, batch));
+        keys.push_back(TuneKey::linear(TunedOp::LinearS8S8, net.fc1_in, net.fc1_out, batch));
+        keys.push_back(TuneKey::linear(fc2_op, net.fc1_out, net.fc2_out, batch));
+        keys.push_back(TuneKey::linear(TunedOp::LinearU8S8, net.fc1_out, net.fc2_out, batch));
+    }
+    return keys;
+}
+
+double median_us(const std::function<void()> & fn, int reps)
+{
+    for (int i = 0; i < 10; i++)
+    {
+        fn();
+    }
+    std::vector<double> samples (reps);
+    for (int i = 0; i < reps; i++)
+    {
+        double start = quantnn::now_us();
+        fn();
+        samples[i] = quantnn::now_us() - start;
+    }
+    return quantnn::summarize(samples).median;
+}
+
+// times `config` for `key` by installing it in the cache and calling the kernel
+double time_config(const TuneKey & key, const TuneConfig & config, const std::function<void()> & call, int reps)
+{
+    quantnn::tuning_cache().set(key, config, 0.0);
+    return median_us(call, reps);
+}
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--model" && i + 1 < argc)
+        {
+            options.models = split(argv[++i]);
+        }
+        else if (arg == "--batch" && i + 1 < argc)
+        {
+            options.batches.clear();
+            for (const std::string & b : split(argv[++i]))
+            {
+                options.batches.push_back(std::max(1, atoi(b.c_str())));
+            }
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            options.threads = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--reps" && i + 1 < argc)
+        {
+            options.reps = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--out" && i + 1 < argc)
+        {
+            options.out = argv[++i];
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--model models/mnist_conv.qnn,models/mnist_fc.qnn] [--batch 1,8,32]"
+                      << " [--threads 1] [--reps 200] [--out quantnn_tuning.txt]" << std::endl;
+            return 1;
+        }
+    }
+    if (options.out.empty())
+    {
+        std::cerr << "no tuning cache path (QUANTNN_TUNING_CACHE is empty and no --out given)" << std::endl;
+        return 1;
+    }
+
+    quantnn::set_intra_op_threads(options.threads);
+    quantnn::TuningCache & cache = quantnn::tuning_cache();
+    if (options.out != quantnn::tuning_cache_path())
+    {
+        cache.load(options.out);
+    }
+
+    std::vector<TuneKey> keys;
+    try
+    {
+        for (const std::string & model : options.models)
+        {
+            auto bundle = quantnn::load_model(model);
+            for (const TuneKey & key : layer_shapes(*bundle, options.batches))
+            {
+                if (std::find(keys.begin(), keys.end(), key) == keys.end())
+                {
+                    keys.push_back(key);
+                }
+            }
+        }
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::vector<quantnn::Isa> isas;
+    for (int i = 0; i < quantnn::kIsaCount; i++)
+    {
+        const quantnn::Isa isa = static_cast<quantnn::Isa>(i);
+        if (quantnn::isa_supported(isa) && static_cast<int>(isa) <= static_cast<int>(quantnn::active_isa()))
+        {
+            isas.push_back(isa);
+        }
+    }
+    std::vector<int> thread_counts { 0 };
+    for (int t = 1; t <= options.threads; t *= 2)
+    {
+        thread_counts.push_back(t);
+    }
+    if (thread_counts.back() != options.threads)
+    {
+        thread_counts.push_back(options.threads);
+    }
+
+    std::cout << "Tuning " << keys.size() << " shapes on " << quantnn::cpu_features().brand << " ("
+              << options.threads << " threads, up to " << quantnn::isa_name(quantnn::active_isa()) << ")" << std::endl;
+    printf("%-60s %10s %10s %8s  %s\n", "shape", "default", "tuned", "speedup", "config");
+
+    for (const TuneKey & key : keys)
+    {
+        const std::function<void()> call = make_call(key);
+
+        quantnn::set_tuning_enabled(false);
+        const double baseline = median_us(call, options.reps);
+        quantnn::set_tuning_enabled(true);
+
+        TuneConfig best;
+        best.isa = quantnn::active_isa();
+        double best_us = time_config(key, best, call, options.reps);
+        auto consider = [&](const TuneConfig & candidate) {
+            double us = time_config(key, candidate, call, options.reps);
+            if (us < best_us)
+            {
+                best_us = us;
+                best = candidate;
+            }
+        };
+
+        const TuneConfig stage_isa = best;
+        for (quantnn::Isa isa : isas)
+        {
+            TuneConfig c = stage_isa;
+            c.isa = isa;
+            consider(c);
+        }
+        const TuneConfig stage_threads = best;
+        for (int threads : thread_counts)
+        {
+            TuneConfig c = stage_threads;
+            c.threads = threads;
+            consider(c);
+        }
+        if (!quantnn::is_conv(key.op))
+        {
+            const TuneConfig stage_tile = best;
+            for (int row_block : { 1, 2, 4, 8 })
+            {
+                for (int batch_block : { 0, 1, 4, 8 })
+                {
+                    if (batch_block >= key.batch)
+                    {
+                        continue;
+                    }
+                    TuneConfig c = stage_tile;
+                    c.row_block = row_block;
+                    c.batch_block = batch_block;
+                    consider(c);
+                }
+            }
+        }
+
+        cache.set(key, best, best_us);
+        printf("%-60s %8.2fus %8.2fus %7.2fx  %s\n", key.to_string().c_str(), baseline, best_us,
+               baseline / best_us, best.to_string().c_str());
+    }
+
+    try
+    {
+        cache.save(options.out);
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    std::cout << "wrote " << cache.size() << " entries for this CPU to " << options.out << std::endl;
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "common/half.h"
+#include "engine/model_bundle.h"
+#include "engine/reparameterize.h"
+
+// Rewrites the fp32 weight tensors (*.weight) of a model bundle as fp16 or bf16, for the
+// fp32 engines to stream half the weight bytes. Biases, int8 weights and scales are
+// copied unchanged. Train-time branched blocks are folded first (engine/reparameterize.h),
+// and --weights f32 only folds them.
+//
+//   convert_bundle models/mnist_conv.qnn models/mnist_conv_f16.qnn --weights f16
+//   convert_bundle models/mnist_conv_branched.qnn models/mnist_conv.qnn --weights f32
+
+bool is_float_weight(const quantnn::TensorView & t)
+{
+    const std::string suffix = ".weight";
+    return t.dtype == quantnn::DType::F32 && t.name.size() > suffix.size()
+           && t.name.compare(t.name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+int main(int argc, char * argv[])
+{
+    if (argc != 5 || std::string(argv[3]) != "--weights"
+        || (std::string(argv[4]) != "f32" && std::string(argv[4]) != "f16" && std::string(argv[4]) != "bf16"))
+    {
+        std::cerr << "usage: " << argv[0] << " in.qnn out.qnn --weights f32|f16|bf16" << std::endl;
+        return 1;
+    }
+    const bool f32 = std::string(argv[4]) == "f32";
+    const bool bf16 = std::string(argv[4]) == "bf16";
+
+    try
+    {
+        auto raw = quantnn::ModelBundle::open(argv[1]);
+        const size_t folded = quantnn::branched_blocks(*raw).size();
+        auto bundle = quantnn::reparameterize(raw);
+        quantnn::BundleWriter writer;
+        int converted = 0;
+        for (const quantnn::TensorView & t : bundle->all())
+        {
+            if (f32 || !is_float_weight(t))
+            {
+                writer.add_raw(t.name, t.dtype, t.shape, t.data, t.nbytes);
+                continue;
+            }
+            const float * values = t.as<float>();
+            if (bf16)
+            {
+                writer.add(t.name, t.shape, quantnn::narrow_weights<quantnn::BFloat16>(values, t.numel()));
+            }
+            else
+            {
+                writer.add(t.name, t.shape, quantnn::narrow_weights<quantnn::Half>(values, t.numel()));
+            }
+            converted++;
+        }
+        writer.write(argv[2]);
+        std::cout << "Wrote " << argv[2] << " (" << folded << " branched blocks folded, " << converted
+                  << " weight tensors as " << argv[4] << ")" << std::endl;
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
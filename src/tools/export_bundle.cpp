@@ -0,0 +1,101 @@
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "engine/model_bundle.h"
+
+// Packs the weights that are compiled into the step-by-step programs into model
+// bundles for the runtime engines (src/engine):
+//   mnist_fc.qnn   : fp32 + int8 weights and static scales of the MLP
+//   mnist_conv.qnn : int8 weights and static scales of the ConvNet, plus the fp32
+//                    weights when src/conv/fp32/mnist_conv.h has been generated
+//                    by pytorch/train_convnet.py
+
+namespace mlp_fp32
+{
+#include "mlp/fp32/mnist_fc.h"
+}
+
+namespace mlp_int8
+{
+#include "mlp/static_quantization/quantized_fc1.h"
+#include "mlp/static_quantization/quantized_fc2.h"
+}
+
+namespace conv_int8
+{
+#include "conv/static_quantization/mnist_conv_bias.h"
+#include "conv/static_quantization/quantized_conv1.h"
+#include "conv/static_quantization/quantized_fc1.h"
+#include "conv/static_quantization/quantized_fc2.h"
+}
+
+#if __has_include("conv/fp32/mnist_conv.h")
+#define HAS_CONV_FP32
+namespace conv_fp32
+{
+#include "conv/fp32/mnist_conv.h"
+}
+#endif
+
+void export_mlp(const std::string & path)
+{
+    quantnn::BundleWriter writer;
+    writer.add("fc1.weight", { 128, 784 }, mlp_fp32::fc1_weight);
+    writer.add("fc1.bias", { 128 }, mlp_fp32::fc1_bias);
+    writer.add("fc2.weight", { 10, 128 }, mlp_fp32::fc2_weight);
+    writer.add("fc2.bias", { 10 }, mlp_fp32::fc2_bias);
+
+    writer.add("fc1.qweight", { 128, 784 }, mlp_int8::fc1_weight);
+    writer.add_scalar("fc1.wscale", mlp_int8::fc1_scale);
+    writer.add("fc2.qweight", { 10, 128 }, mlp_int8::fc2_weight);
+    writer.add_scalar("fc2.wscale", mlp_int8::fc2_scale);
+
+    // copied from the output of ./build/mlp_calibration
+    writer.add_scalar("scale.input", 0.0222164f);
+    writer.add_scalar("scale.fc1", 0.171222f);
+    writer.add_scalar("scale.relu", 0.0829648f);
+    writer.write(path);
+}
+
+void export_conv(const std::string & path)
+{
+    quantnn::BundleWriter writer;
+    writer.add("conv1.bias", { 5 }, conv_int8::conv1_bias);
+    writer.add("fc1.bias", { 128 }, conv_int8::fc1_bias);
+    writer.add("fc2.bias", { 10 }, conv_int8::fc2_bias);
+#ifdef HAS_CONV_FP32
+    writer.add("conv1.weight", { 5, 1, 3, 3 }, conv_fp32::conv1_weight);
+    writer.add("fc1.weight", { 128, 3920 }, conv_fp32::fc1_weight);
+    writer.add("fc2.weight", { 10, 128 }, conv_fp32::fc2_weight);
+#endif
+
+    writer.add("conv1.qweight", { 5, 1, 3, 3 }, conv_int8::qconv1_weight);
+    writer.add("conv1.wscale", { 5 }, conv_int8::qconv1_scale);
+    writer.add("fc1.qweight", { 128, 3920 }, conv_int8::qfc1_weight);
+    writer.add_scalar("fc1.wscale", conv_int8::qfc1_scale);
+    writer.add("fc2.qweight", { 10, 128 }, conv_int8::qfc2_weight);
+    writer.add_scalar("fc2.wscale", conv_int8::qfc2_scale);
+
+    // copied from the output of ./build/conv_calibration
+    writer.add_scalar("scale.input", 0.0222164f);
+    writer.add_scalar("scale.conv1", 0.0326954f);
+    writer.add_scalar("scale.fc1", 0.209524f);
+    writer.add_scalar("scale.relu", 0.0927161f);
+    writer.write(path);
+}
+
+int main(int argc, char * argv[])
+{
+    std::string out_dir = argc > 1 ? argv[1] : ".";
+    export_mlp(out_dir + "/mnist_fc.qnn");
+    export_conv(out_dir + "/mnist_conv.qnn");
+    std::cout << "Wrote " << out_dir << "/mnist_fc.qnn and " << out_dir << "/mnist_conv.qnn";
+#ifndef HAS_CONV_FP32
+    std::cout << " (the ConvNet bundle has no fp32 weights; run pytorch/train_convnet.py first)";
+#endif
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,811 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/half.h"
+#include "common/thread_pool.h"
+#include "kernels/activation.h"
+#include "kernels/conv.h"
+#include "kernels/conv2d.h"
+#include "kernels/dispatch.h"
+#include "kernels/linear.h"
+#include "kernels/quantize.h"
+#include "kernels/tuning.h"
+
+// Differential fuzzing of the dispatched kernels against plain scalar references.
+//
+// Every iteration draws a random shape, scale, zero-point and input (a share of them
+// at the saturating extremes: -128/127 int8, 255 uint8, values rounding to +-127.5 and
+// beyond) and runs each kernel on every ISA tier this CPU supports, through the public
+// entry points with a random tuning configuration (thread split, row and batch tiles).
+// The references are the loops of the original inference code (std::round, std::clamp,
+// int32 sums), so:
+//   integer and element-wise kernels must match bit for bit
+//   conv3x3_f32 must match bit for bit against a zero-padded copy (the tiers keep the
+//   scalar order of the sums, and the implicit border only skips terms adding a zero)
+//   every path of Conv2d must match bit for bit a direct loop over the taps inside the
+//   image (kernels/conv2d.h keeps that order of the sums on all paths)
+//   the fp32 dot products (linear_f32, _f16, _bf16) must be within (n + 1) ULPs of
+//   sum |w x|, the worst-case error of any summation order, from a double reference
+//
+//   kernel_fuzz --iterations 2000 --seed 1 --isa avx2,avx512vnni --threads 2
+
+using quantnn::Isa;
+
+struct Result
+{
+    long cases = 0;
+    long failures = 0;
+    double max_ratio = 0.0; // fp32 dot products: error / bound
+    std::string first_failure;
+};
+
+class Report
+{
+public:
+    void exact(const std::string & kernel, Isa isa, bool ok, const std::string & detail)
+    {
+        Result & r = results[{ kernel, static_cast<int>(isa) }];
+        r.cases++;
+        if (!ok)
+        {
+            fail(r, detail);
+        }
+    }
+
+    // error as a fraction of the allowed bound; fails above 1
+    void bounded(const std::string & kernel, Isa isa, double ratio, const std::string & detail)
+    {
+        Result & r = results[{ kernel, static_cast<int>(isa) }];
+        r.cases++;
+        r.max_ratio = std::max(r.max_ratio, ratio);
+        if (!(ratio <= 1.0))
+        {
+            fail(r, detail);
+        }
+    }
+
+    bool passed() const
+    {
+        for (const auto & kv : results)
+        {
+            if (kv.second.failures > 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void print() const
+    {
+        printf("%-24s %-11s %8s %8s %10s\n", "kernel", "isa", "cases", "failed", "err/bound");
+        for (const auto & kv : results)
+        {
+            const Result & r = kv.second;
+            printf("%-24s %-11s %8ld %8ld ", kv.first.first.c_str(), quantnn::isa_name(static_cast<Isa>(kv.first.second)),
+                   r.cases, r.failures);
+            if (r.max_ratio > 0.0)
+            {
+                printf("%10.3f\n", r.max_ratio);
+            }
+            else
+            {
+                printf("%10s\n", "-");
+            }
+        }
+        for (const auto & kv : results)
+        {
+            if (kv.second.failures > 0)
+            {
+                printf("FAIL %s/%s: %s\n", kv.first.first.c_str(), quantnn::isa_name(static_cast<Isa>(kv.first.second)),
+                       kv.second.first_failure.c_str());
+            }
+        }
+    }
+
+private:
+    static void fail(Result & r, const std::string & detail)
+    {
+        if (r.failures++ == 0)
+        {
+            r.first_failure = detail;
+        }
+    }
+
+    std::map<std::pair<std::string, int>, Result> results;
+};
+
+// ---- inputs ----
+
+class Inputs
+{
+public:
+    explicit Inputs(uint64_t seed) : rng(seed) {}
+
+    int range(int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); }
+    bool chance(double p) { return std::uniform_real_distribution<double>(0.0, 1.0)(rng) < p; }
+    float uniform(float lo, float hi) { return std::uniform_real_distribution<float>(lo, hi)(rng); }
+
+    // lengths with the SIMD tails in mind: mostly short, sometimes a real layer size
+    int length()
+    {
+        switch (range(0, 3))
+        {
+            case 0: return range(1, 17);
+            case 1: return range(1, 80);
+            case 2: return range(1, 600);
+            default: return range(1, 4000);
+        }
+    }
+
+    // a scale spanning several orders of magnitude
+    float scale() { return std::exp2(uniform(-16.0f, 4.0f)); }
+
+    std::vector<int8_t> s8(int n)
+    {
+        std::vector<int8_t> v (n);
+        const int mode = range(0, 5);
+        for (int8_t & x : v)
+        {
+            switch (mode)
+            {
+                case 0: x = -128; break;
+                case 1: x = 127; break;
+                case 2: x = static_cast<int8_t>(chance(0.5) ? -128 : 127); break;
+                case 3: x = static_cast<int8_t>(range(-127, 127)); break;
+                default: x = static_cast<int8_t>(range(-128, 127)); break;
+            }
+        }
+        return v;
+    }
+
+    std::vector<uint8_t> u8(int n)
+    {
+        std::vector<uint8_t> v (n);
+        const int mode = range(0, 3);
+        for (uint8_t & x : v)
+        {
+            x = static_cast<uint8_t>(mode == 0 ? 255 : (mode == 1 ? (chance(0.5) ? 0 : 255) : range(0, 255)));
+        }
+        return v;
+    }
+
+    // values around the quantization grid of `scale`: exact halfway points, the
+    // +-127.5 / 255.5 boundaries, far beyond them, signed zeros and tiny values
+    std::vector<float> quantizable(int n, float scale)
+    {
+        std::vector<float> v (n);
+        for (float & x : v)
+        {
+            float q;
+            switch (range(0, 6))
+            {
+                case 0: q = static_cast<float>(range(-300, 300)) + 0.5f; break;
+                case 1: q = (chance(0.5) ? -1.0f : 1.0f) * (127.5f + static_cast<float>(range(-1, 1))); break;
+                case 2: q = static_cast<float>(range(-300, 300)) + 0.5f * uniform(0.99f, 1.01f); break;
+                case 3: q = uniform(-1.0e6f, 1.0e6f); break;
+                case 4: q = chance(0.5) ? 0.0f : -0.0f; break;
+                default: q = uniform(-400.0f, 400.0f); break;
+            }
+            x = q * scale;
+            if (chance(0.01))
+            {
+                x = std::numeric_limits<float>::denorm_min() * static_cast<float>(range(-8, 8));
+            }
+        }
+        return v;
+    }
+
+    std::vector<float> f32(int n, float magnitude)
+    {
+        std::vector<float> v (n);
+        for (float & x : v)
+        {
+            x = uniform(-magnitude, magnitude);
+        }
+        return v;
+    }
+
+    std::vector<int32_t> s32(int n)
+    {
+        std::vector<int32_t> v (n);
+        const int32_t limit = chance(0.2) ? std::numeric_limits<int32_t>::max() : 1 << range(4, 20);
+        for (int32_t & x : v)
+        {
+            x = static_cast<int32_t>(std::uniform_int_distribution<int64_t>(-static_cast<int64_t>(limit), limit)(rng));
+        }
+        return v;
+    }
+
+    // a random split and tiling for the next kernel call of this shape
+    quantnn::TuneConfig config(Isa isa, int batch)
+    {
+        quantnn::TuneConfig c;
+        c.isa = isa;
+        c.threads = range(0, 4);
+        c.row_block = range(1, 8);
+        c.batch_block = range(0, std::max(1, batch));
+        return c;
+    }
+
+private:
+    std::mt19937_64 rng;
+};
+
+// ---- scalar references, the loops of the original inference code ----
+
+int8_t ref_quantize_s8(float x, float scale)
+{
+    return static_cast<int8_t>(std::clamp(std::round(x / scale), -127.0f, 127.0f));
+}
+
+uint8_t ref_quantize_u8(float x, float scale, int zp)
+{
+    return static_cast<uint8_t>(std::clamp(static_cast<int>(std::round(x / scale)) + zp, 0, 255));
+}
+
+int8_t ref_requantize(int32_t acc, float multiplier, float bias, float out_scale)
+{
+    float value = multiplier * static_cast<float>(acc) + bias;
+    return static_cast<int8_t>(std::clamp(std::round(value / out_scale), -127.0f, 127.0f));
+}
+
+uint8_t ref_relu_s8_u8(int8_t x, float in_scale, float out_scale)
+{
+    float value = std::max(0.0f, static_cast<float>(x) * in_scale);
+    return static_cast<uint8_t>(std::clamp(std::round(value / out_scale), 0.0f, 255.0f));
+}
+
+template <typename A, typename B>
+int64_t ref_dot(const A * a, const B * b, int n)
+{
+    int64_t sum = 0;
+    for (int j = 0; j < n; j++)
+    {
+        sum += static_cast<int64_t>(a[j]) * static_cast<int64_t>(b[j]);
+    }
+    return sum;
+}
+
+float as_float(float w) { return w; }
+float as_float(quantnn::Half w) { return quantnn::half_to_float(w); }
+float as_float(quantnn::BFloat16 w) { return quantnn::bf16_to_float(w); }
+
+// the exact dot product in double, and sum |w x| to measure the error against
+template <typename W>
+void ref_dot_f32(const W * w, const float * x, int n, double & value, double & magnitude)
+{
+    value = 0.0;
+    magnitude = 0.0;
+    for (int j = 0; j < n; j++)
+    {
+        double term = static_cast<double>(as_float(w[j])) * x[j];
+        value += term;
+        magnitude += std::abs(term);
+    }
+}
+
+bool same_bits(float a, float b)
+{
+    return quantnn::float_bits(a) == quantnn::float_bits(b);
+}
+
+// ---- one fuzz iteration per kernel ----
+
+std::string describe(uint64_t seed, long iteration)
+{
+    std::ostringstream s;
+    s << "seed=" << seed << " iteration=" << iteration;
+    return s.str();
+}
+
+void fuzz_quantize(Inputs & in, Report & report, Isa isa, const std::string & where)
+{
+    const int n = in.length();
+    const float scale = in.scale();
+    const int zp = in.chance(0.3) ? (in.chance(0.5) ? 0 : 255) : in.range(0, 255);
+    std::vector<float> x = in.quantizable(n, scale);
+    for (float & v : x)
+    {
+        // the reference converts round(x / scale) to int before adding the zero-point
+        v = std::clamp(v, -1.0e9f * scale, 1.0e9f * scale);
+    }
+
+    std::vector<int8_t> q8 (n);
+    quantnn::quantize_s8(x.data(), n, scale, q8.data());
+    std::vector<uint8_t> qu (n);
+    quantnn::quantize_u8(x.data(), n, scale, zp, qu.data());
+    int bad_s8 = -1;
+    int bad_u8 = -1;
+    for (int i = n - 1; i >= 0; i--)
+    {
+        if (q8[i] != ref_quantize_s8(x[i], scale)) bad_s8 = i;
+        if (qu[i] != ref_quantize_u8(x[i], scale, zp)) bad_u8 = i;
+    }
+    std::ostringstream s8;
+    s8 << where << " n=" << n << " scale=" << scale;
+    if (bad_s8 >= 0)
+    {
+        s8 << " x[" << bad_s8 << "]=" << x[bad_s8] << " got " << int(q8[bad_s8]) << " want "
+           << int(ref_quantize_s8(x[bad_s8], scale));
+    }
+    report.exact("quantize_s8", isa, bad_s8 < 0, s8.str());
+    std::ostringstream u8;
+    u8 << where << " n=" << n << " scale=" << scale << " zp=" << zp;
+    if (bad_u8 >= 0)
+    {
+        u8 << " x[" << bad_u8 << "]=" << x[bad_u8] << " got " << int(qu[bad_u8]) << " want "
+           << int(ref_quantize_u8(x[bad_u8], scale, zp));
+    }
+    report.exact("quantize_u8", isa, bad_u8 < 0, u8.str());
+
+    float lo = 0.0f;
+    float hi = 0.0f;
+    quantnn::minmax_f32(x.data(), n, lo, hi);
+    const float abs_max = quantnn::absmax_f32(x.data(), n);
+    float want_lo = x[0];
+    float want_hi = x[0];
+    float want_abs = 0.0f;
+    for (float v : x)
+    {
+        want_lo = std::min(want_lo, v);
+        want_hi = std::max(want_hi, v);
+        want_abs = std::max(want_abs, std::abs(v));
+    }
+    report.exact("minmax_f32", isa, lo == want_lo && hi == want_hi, where + " n=" + std::to_string(n));
+    report.exact("absmax_f32", isa, abs_max == want_abs, where + " n=" + std::to_string(n));
+}
+
+void fuzz_elementwise(Inputs & in, Report & report, Isa isa, const std::string & where)
+{
+    const int rows = in.range(1, 4);
+    const int cols = in.length();
+    const int n = rows * cols;
+    std::vector<int32_t> acc = in.s32(n);
+    std::vector<float> multiplier (rows);
+    std::vector<float> bias (rows);
+    for (int r = 0; r < rows; r++)
+    {
+        multiplier[r] = in.scale() * 1.0e-3f;
+        bias[r] = in.uniform(-1.0f, 1.0f) * in.scale();
+    }
+    const float out_scale = in.scale();
+
+    std::vector<float> y (n);
+    quantnn::dequantize_s32(acc.data(), rows, cols, multiplier.data(), bias.data(), y.data());
+    std::vector<int8_t> q (n);
+    quantnn::requantize_s8(acc.data(), rows, cols, multiplier.data(), bias.data(), out_scale, q.data());
+    bool deq_ok = true;
+    bool req_ok = true;
+    for (int i = 0; i < n; i++)
+    {
+        const int r = i / cols;
+        deq_ok = deq_ok && same_bits(y[i], multiplier[r] * static_cast<float>(acc[i]) + bias[r]);
+        req_ok = req_ok && q[i] == ref_requantize(acc[i], multiplier[r], bias[r], out_scale);
+    }
+    const std::string shape = where + " rows=" + std::to_string(rows) + " cols=" + std::to_string(cols);
+    report.exact("dequantize", isa, deq_ok, shape);
+    report.exact("requantize", isa, req_ok, shape);
+
+    std::vector<int8_t> s = in.s8(n);
+    const float in_scale = in.scale();
+    std::vector<uint8_t> u (n);
+    quantnn::relu_s8_u8(s.data(), n, in_scale, out_scale, u.data());
+    std::vector<int8_t> r8 = s;
+    quantnn::relu_s8(r8.data(), n);
+    std::vector<float> f = in.quantizable(n, in_scale);
+    std::vector<float> rf = f;
+    quantnn::relu_f32(rf.data(), n);
+    bool u8_ok = true;
+    bool s8_ok = true;
+    bool f32_ok = true;
+    for (int i = 0; i < n; i++)
+    {
+        u8_ok = u8_ok && u[i] == ref_relu_s8_u8(s[i], in_scale, out_scale);
+        s8_ok = s8_ok && r8[i] == std::max<int8_t>(0, s[i]);
+        f32_ok = f32_ok && same_bits(rf[i], std::max(0.0f, f[i]));
+    }
+    report.exact("relu_s8_u8", isa, u8_ok, shape);
+    report.exact("relu_s8", isa, s8_ok, shape);
+    report.exact("relu_f32", isa, f32_ok, shape);
+}
+
+void fuzz_linear_int(Inputs & in, Report & report, Isa isa, const std::string & where)
+{
+    const int in_dim = in.length();
+    const int out_dim = in.range(1, 40);
+    const int batch = in.chance(0.5) ? 1 : in.range(1, 12);
+    std::vector<int8_t> w = in.s8(in_dim * out_dim);
+    std::vector<int8_t> xs = in.s8(batch * in_dim);
+    std::vector<uint8_t> xu = in.u8(batch * in_dim);
+
+    const quantnn::TuneConfig config = in.config(isa, batch);
+    quantnn::tuning_cache().set(quantnn::TuneKey::linear(quantnn::TunedOp::LinearS8S8, in_dim, out_dim, batch), config, 0.0);
+    quantnn::tuning_cache().set(quantnn::TuneKey::linear(quantnn::TunedOp::LinearU8S8, in_dim, out_dim, batch), config, 0.0);
+    std::vector<int32_t> acc_s (batch * out_dim);
+    quantnn::linear_s8s8_batch(xs.data(), w.data(), batch, in_dim, out_dim, acc_s.data());
+    std::vector<int32_t> acc_u (batch * out_dim);
+    quantnn::linear_u8s8_batch(xu.data(), w.data(), batch, in_dim, out_dim, acc_u.data());
+
+    bool s_ok = true;
+    bool u_ok = true;
+    for (int b = 0; b < batch; b++)
+    {
+        for (int o = 0; o < out_dim; o++)
+        {
+            s_ok = s_ok && acc_s[b * out_dim + o] == ref_dot(&xs[b * in_dim], &w[o * in_dim], in_dim);
+            u_ok = u_ok && acc_u[b * out_dim + o] == ref_dot(&xu[b * in_dim], &w[o * in_dim], in_dim);
+        }
+    }
+    std::ostringstream s;
+    s << where << " in=" << in_dim << " out=" << out_dim << " batch=" << batch << " " << config.to_string();
+    report.exact("linear_s8s8", isa, s_ok, s.str());
+    report.exact("linear_u8s8", isa, u_ok, s.str());
+}
+
+template <typename W>
+void check_linear_f32(Report & report, const std::string & kernel, Isa isa, const std::string & shape,
+                      const std::vector<W> & w, const std::vector<float> & x, const std::vector<float> & bias,
+                      const std::vector<float> & y, int batch, int in_dim, int out_dim)
+{
+    // (n + 1) ULPs of sum |w x|: n - 1 additions, the rounding of each product (or none
+    // with FMA) and the final add of the bias
+    const double eps = std::numeric_limits<float>::epsilon() / 2.0;
+    double worst = 0.0; // the largest error / bound of any output
+    for (int b = 0; b < batch; b++)
+    {
+        for (int o = 0; o < out_dim; o++)
+        {
+            double value;
+            double magnitude;
+            ref_dot_f32(&w[o * in_dim], &x[b * in_dim], in_dim, value, magnitude);
+            value += bias[o];
+            magnitude += std::abs(bias[o]);
+            const double err = std::abs(static_cast<double>(y[b * out_dim + o]) - value);
+            const double bound = (in_dim + 1) * eps * magnitude;
+            worst = std::max(worst, bound > 0.0 ? err / bound : (err == 0.0 ? 0.0 : HUGE_VAL));
+        }
+    }
+    report.bounded(kernel, isa, worst, shape + " error/bound=" + std::to_string(worst));
+}
+
+void fuzz_linear_f32(Inputs & in, Report & report, Isa isa, const std::string & where)
+{
+    const int in_dim = in.length();
+    const int out_dim = in.range(1, 40);
+    const int batch = in.chance(0.5) ? 1 : in.range(1, 12);
+    const float magnitude = in.scale();
+    std::vector<float> w = in.f32(in_dim * out_dim, 1.0f);
+    std::vector<float> x = in.f32(batch * in_dim, magnitude);
+    std::vector<float> bias = in.f32(out_dim, magnitude);
+    std::vector<quantnn::Half> wh = quantnn::narrow_weights<quantnn::Half>(w.data(), w.size());
+    std::vector<quantnn::BFloat16> wb = quantnn::narrow_weights<quantnn::BFloat16>(w.data(), w.size());
+
+    const quantnn::TuneConfig config = in.config(isa, batch);
+    for (quantnn::TunedOp op : { quantnn::TunedOp::LinearF32, quantnn::TunedOp::LinearF16, quantnn::TunedOp::LinearBF16 })
+    {
+        quantnn::tuning_cache().set(quantnn::TuneKey::linear(op, in_dim, out_dim, batch), config, 0.0);
+    }
+    std::ostringstream s;
+    s << where << " in=" << in_dim << " out=" << out_dim << " batch=" << batch << " " << config.to_string();
+
+    std::vector<float> y (batch * out_dim);
+    quantnn::linear_f32_batch(x.data(), w.data(), bias.data(), batch, in_dim, out_dim, y.data());
+    check_linear_f32(report, "linear_f32", isa, s.str(), w, x, bias, y, batch, in_dim, out_dim);
+    quantnn::linear_f16_batch(x.data(), wh.data(), bias.data(), batch, in_dim, out_dim, y.data());
+    check_linear_f32(report, "linear_f16", isa, s.str(), wh, x, bias, y, batch, in_dim, out_dim);
+    quantnn::linear_bf16_batch(x.data(), wb.data(), bias.data(), batch, in_dim, out_dim, y.data());
+    check_linear_f32(report, "linear_bf16", isa, s.str(), wb, x, bias, y, batch, in_dim, out_dim);
+}
+
+// the reference convolves an explicitly zero-padded copy, as the original code did
+template <typename T>
+std::vector<T> pad_border(const std::vector<T> & x, int channels, int h, int w)
+{
+    std::vector<T> padded (static_cast<size_t>(channels) * (h + 2) * (w + 2), T(0));
+    for (int c = 0; c < channels; c++)
+    {
+        for (int i = 0; i < h; i++)
+        {
+            std::copy_n(&x[(c * h + i) * w], w, &padded[(c * (h + 2) + i + 1) * (w + 2) + 1]);
+        }
+    }
+    return padded;
+}
+
+void fuzz_conv(Inputs & in, Report & report, Isa isa, const std::string & where)
+{
+    const int in_c = in.range(1, 6);
+    const int out_c = in.range(1, 6);
+    const int h = in.range(1, 30);
+    const int w = in.range(1, 40);
+    const quantnn::TuneConfig config = in.config(isa, 1);
+    quantnn::tuning_cache().set(quantnn::TuneKey::conv(quantnn::TunedOp::Conv3x3F32, in_c, out_c, h, w), config, 0.0);
+    quantnn::tuning_cache().set(quantnn::TuneKey::conv(quantnn::TunedOp::Conv3x3S8S8, in_c, out_c, h, w), config, 0.0);
+    const int h2 = (h - 1) / 2 + 1;
+    const int w2 = (w - 1) / 2 + 1;
+    quantnn::tuning_cache().set(quantnn::TuneKey::conv(quantnn::TunedOp::Conv3x3S8S8, in_c, out_c, h2, w2), config, 0.0);
+    std::ostringstream s;
+    s << where << " in_c=" << in_c << " out_c=" << out_c << " h=" << h << " w=" << w << " " << config.to_string();
+
+    std::vector<int8_t> xq = in.s8(in_c * h * w);
+    std::vector<int8_t> wq = in.s8(out_c * in_c * 9);
+    std::vector<int32_t> acc (out_c * h * w);
+    quantnn::conv3x3_s8s8(xq.data(), in_c, h, w, wq.data(), out_c, acc.data());
+    std::vector<int32_t> acc2 (out_c * h2 * w2);
+    quantnn::conv3x3_s8s8_strided(xq.data(), in_c, h, w, 2, wq.data(), out_c, acc2.data());
+
+    std::vector<float> x = in.f32(in_c * h * w, in.scale());
+    std::vector<float> wf = in.f32(out_c * in_c * 9, 1.0f);
+    std::vector<float> bias = in.f32(out_c, 1.0f);
+    std::vector<float> y (out_c * h * w);
+    quantnn::conv3x3_f32(x.data(), in_c, h, w, wf.data(), bias.data(), out_c, y.data());
+
+    const std::vector<int8_t> xq_padded = pad_border(xq, in_c, h, w);
+    const std::vector<float> x_padded = pad_border(x, in_c, h, w);
+    bool q_ok = true;
+    bool q2_ok = true;
+    bool f_ok = true;
+    for (int o = 0; o < out_c; o++)
+    {
+        for (int i = 0; i < h; i++)
+        {
+            for (int j = 0; j < w; j++)
+            {
+                int32_t sum = 0;
+                float value = 0.0f;
+                for (int c = 0; c < in_c; c++)
+                {
+                    for (int k = 0; k < 3; k++)
+                    {
+                        for (int l = 0; l < 3; l++)
+                        {
+                            const int xi = (c * (h + 2) + i + k) * (w + 2) + j + l;
+                            const int wi = ((o * in_c + c) * 3 + k) * 3 + l;
+                            sum += static_cast<int32_t>(xq_padded[xi]) * wq[wi];
+                            value += x_padded[xi] * wf[wi];
+                        }
+                    }
+                }
+                value += bias[o];
+                const int yi = (o * h + i) * w + j;
+                q_ok = q_ok && acc[yi] == sum;
+                f_ok = f_ok && same_bits(y[yi], value);
+                // stride 2 keeps the even rows and columns of the stride-1 output
+                if (i % 2 == 0 && j % 2 == 0)
+                {
+                    q2_ok = q2_ok && acc2[(o * h2 + i / 2) * w2 + j / 2] == sum;
+                }
+            }
+        }
+    }
+    report.exact("conv3x3_s8s8", isa, q_ok, s.str());
+    report.exact("conv3x3_s8s8_s2", isa, q2_ok, s.str());
+    report.exact("conv3x3_f32", isa, f_ok, s.str());
+}
+
+// a shape for each Conv2d path in turn, or any mix of kernel, stride, padding, dilation
+// and groups; Conv2d runs on the path it picks and again forced onto the generic one
+void fuzz_conv2d(Inputs & in, Report & report, Isa isa, const std::string & where)
+{
+    quantnn::Conv2dShape shape;
+    const int kind = in.range(0, 3);
+    shape.in_c = in.range(1, 9);
+    shape.out_c = in.range(1, 9);
+    shape.in_h = in.range(1, 20);
+    shape.in_w = in.range(1, 40);
+    if (kind == 0)
+    {
+        shape.kernel_h = shape.kernel_w = 1;
+    }
+    else if (kind <= 2)
+    {
+        shape.pad_h = shape.pad_w = 1;
+        shape.stride_h = shape.stride_w = in.range(1, 2);
+        if (kind == 1)
+        {
+            shape.out_c = shape.groups = shape.in_c = in.range(2, 9);
+        }
+    }
+    else
+    {
+        shape.kernel_h = in.range(1, 5);
+        shape.kernel_w = in.range(1, 5);
+        shape.stride_h = in.range(1, 3);
+        shape.stride_w = in.range(1, 3);
+        shape.pad_h = in.range(0, 2);
+        shape.pad_w = in.range(0, 2);
+        shape.dilation_h = in.range(1, 2);
+        shape.dilation_w = in.range(1, 2);
+        shape.groups = in.chance(0.5) ? 1 : in.range(1, 3);
+        shape.in_c = shape.groups * in.range(1, 3);
+        shape.out_c = shape.groups * in.range(1, 3);
+        shape.in_h = std::max(shape.in_h, shape.dilation_h * (shape.kernel_h - 1) + 1);
+        shape.in_w = std::max(shape.in_w, shape.dilation_w * (shape.kernel_w - 1) + 1);
+    }
+    const int out_h = shape.out_h();
+    const int out_w = shape.out_w();
+    const quantnn::TuneConfig config = in.config(isa, 1);
+    quantnn::tuning_cache().set(quantnn::TuneKey::conv(quantnn::TunedOp::Conv3x3F32, shape.in_c, shape.out_c, out_h, out_w), config, 0.0);
+    quantnn::tuning_cache().set(quantnn::TuneKey::conv(quantnn::TunedOp::Conv3x3S8S8, shape.in_c, shape.out_c, out_h, out_w), config, 0.0);
+
+    const quantnn::Conv2d chosen (shape);
+    const quantnn::Conv2d generic (shape, quantnn::Conv2dPath::Generic);
+    std::ostringstream s;
+    s << where << " " << shape.in_c << "x" << shape.in_h << "x" << shape.in_w << "->" << shape.out_c << " k=" << shape.kernel_h
+      << "x" << shape.kernel_w << " s=" << shape.stride_h << "," << shape.stride_w << " p=" << shape.pad_h << "," << shape.pad_w
+      << " d=" << shape.dilation_h << "," << shape.dilation_w << " g=" << shape.groups << " " << config.to_string();
+
+    const int group_in = shape.in_c / shape.groups;
+    const int weights = shape.out_c * group_in * shape.kernel_h * shape.kernel_w;
+    const size_t outputs = chosen.output_size();
+    std::vector<int8_t> xq = in.s8(shape.in_c * shape.in_h * shape.in_w);
+    std::vector<int8_t> wq = in.s8(weights);
+    std::vector<float> x = in.f32(shape.in_c * shape.in_h * shape.in_w, in.scale());
+    std::vector<float> wf = in.f32(weights, 1.0f);
+    std::vector<float> bias = in.f32(shape.out_c, 1.0f);
+    const float * b = in.chance(0.25) ? nullptr : bias.data();
+
+    std::vector<int32_t> acc (outputs);
+    std::vector<int32_t> acc_generic (outputs);
+    std::vector<float> y (outputs);
+    std::vector<float> y_generic (outputs);
+    chosen.run_s8s8(xq.data(), wq.data(), acc.data());
+    generic.run_s8s8(xq.data(), wq.data(), acc_generic.data());
+    chosen.run_f32(x.data(), wf.data(), b, y.data());
+    generic.run_f32(x.data(), wf.data(), b, y_generic.data());
+
+    bool q_ok = true;
+    bool f_ok = true;
+    for (int o = 0; o < shape.out_c; o++)
+    {
+        const int c0 = o / (shape.out_c / shape.groups) * group_in;
+        for (int i = 0; i < out_h; i++)
+        {
+            for (int j = 0; j < out_w; j++)
+            {
+                int32_t sum = 0;
+                float value = 0.0f;
+                for (int c = 0; c < group_in; c++)
+                {
+                    for (int k = 0; k < shape.kernel_h; k++)
+                    {
+                        for (int l = 0; l < shape.kernel_w; l++)
+                        {
+                            const int r = i * shape.stride_h - shape.pad_h + k * shape.dilation_h;
+                            const int col = j * shape.stride_w - shape.pad_w + l * shape.dilation_w;
+                            if (r < 0 || r >= shape.in_h || col < 0 || col >= shape.in_w)
+                            {
+                                continue;
+                            }
+                            const int xi = ((c0 + c) * shape.in_h + r) * shape.in_w + col;
+                            const int wi = ((o * group_in + c) * shape.kernel_h + k) * shape.kernel_w + l;
+                            sum += static_cast<int32_t>(xq[xi]) * wq[wi];
+                            value += x[xi] * wf[wi];
+                        }
+                    }
+                }
+                if (b != nullptr)
+                {
+                    value += b[o];
+                }
+                const int yi = (o * out_h + i) * out_w + j;
+                q_ok = q_ok && acc[yi] == sum && acc_generic[yi] == sum;
+                f_ok = f_ok && same_bits(y[yi], value) && same_bits(y_generic[yi], value);
+            }
+        }
+    }
+    const std::string path = quantnn::conv2d_path_name(chosen.path());
+    report.exact("conv2d_s8_" + path, isa, q_ok, s.str());
+    report.exact("conv2d_f32_" + path, isa, f_ok, s.str());
+}
+
+// ---- driver ----
+
+std::vector<Isa> parse_tiers(const std::string & list)
+{
+    std::vector<Isa> tiers;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        Isa isa;
+        if (!quantnn::parse_isa(item, isa))
+        {
+            throw std::runtime_error("unknown ISA tier: " + item);
+        }
+        if (!quantnn::isa_supported(isa))
+        {
+            throw std::runtime_error(std::string("ISA tier ") + item + " is not supported by this CPU");
+        }
+        tiers.push_back(isa);
+    }
+    return tiers;
+}
+
+int main(int argc, char * argv[])
+{
+    long iterations = 500;
+    uint64_t seed = std::random_device()();
+    int threads = 2;
+    std::vector<Isa> tiers;
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--iterations" && i + 1 < argc)
+            {
+                iterations = std::max(1L, atol(argv[++i]));
+            }
+            else if (arg == "--seed" && i + 1 < argc)
+            {
+                seed = std::strtoull(argv[++i], nullptr, 10);
+            }
+            else if (arg == "--threads" && i + 1 < argc)
+            {
+                threads = std::max(1, atoi(argv[++i]));
+            }
+            else if (arg == "--isa" && i + 1 < argc)
+            {
+                tiers = parse_tiers(argv[++i]);
+            }
+            else
+            {
+                std::cerr << "usage: " << argv[0] << " [--iterations N] [--seed S] [--threads N] [--isa tier,...]" << std::endl;
+                return 1;
+            }
+        }
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    if (tiers.empty())
+    {
+        for (int t = 0; t < quantnn::kIsaCount; t++)
+        {
+            if (quantnn::isa_supported(static_cast<Isa>(t)))
+            {
+                tiers.push_back(static_cast<Isa>(t));
+            }
+        }
+    }
+
+    // start from an empty tuning cache; every call gets its configuration from the fuzzer
+    setenv("QUANTNN_TUNING_CACHE", "", 1);
+    quantnn::set_intra_op_threads(threads);
+    std::cout << "Fuzzing " << iterations << " iterations, seed " << seed << ", " << threads << " threads" << std::endl;
+
+    Report report;
+    for (Isa isa : tiers)
+    {
+        quantnn::set_isa(isa);
+        // the same inputs for every tier
+        Inputs in (seed);
+        for (long it = 0; it < iterations; it++)
+        {
+            const std::string where = describe(seed, it);
+            fuzz_quantize(in, report, isa, where);
+            fuzz_elementwise(in, report, isa, where);
+            fuzz_linear_int(in, report, isa, where);
+            fuzz_linear_f32(in, report, isa, where);
+            fuzz_conv(in, report, isa, where);
+            fuzz_conv2d(in, report, isa, where);
+        }
+    }
+    report.print();
+    std::cout << (report.passed() ? "PASS" : "FAIL") << std::endl;
+    return report.passed() ? 0 : 1;
+}
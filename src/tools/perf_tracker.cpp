@@ -0,0 +1,428 @@
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/bench.h"
+#include "common/cpu_features.h"
+#include "common/perf_history.h"
+#include "common/thread_pool.h"
+#include "engine/factory.h"
+#include "engine/mixed_engine.h"
+#include "kernels/dispatch.h"
+#include "kernels/tuning.h"
+
+#include "mlp/static_quantization/data_7.h"
+
+// Benchmark history of the engines, to find the change that made a path slower.
+//
+//   perf_tracker record  times every engine (fp32, dynamic, static) end to end and each
+//                        of its layers (conv1, fc1, fc2) on the test image, appends the
+//                        run to the history and compares it with the previous
+//                        comparable run
+//   perf_tracker compare compares two runs: ratio of the medians with a bootstrap
+//                        confidence interval per benchmark, flagged when significant
+//   perf_tracker history searches the runs of this machine and configuration for level
+//                        shifts per benchmark and names the commit where each began
+//
+// A run stores --samples samples per benchmark, each the mean time of --inner calls;
+// the benchmarks take turns within every sample so that drift (frequency, other load)
+// spreads over all of them. Runs are comparable when the machine fingerprint (CPU,
+// core count, kernel tier, compiler) and the configuration (model, threads) match.
+// record and compare exit with 2 when a benchmark got significantly slower.
+//
+//   perf_tracker record --model models/mnist_conv.qnn
+//   perf_tracker compare --baseline 3
+//   perf_tracker history --filter static
+
+using quantnn::Layer;
+using quantnn::LayerPrecisions;
+using quantnn::PerfComparison;
+using quantnn::PerfHistory;
+using quantnn::PerfRun;
+using quantnn::PerfVerdict;
+using quantnn::Precision;
+
+struct Options
+{
+    std::string command;
+    std::string model = "models/mnist_conv.qnn";
+    std::string store = "perf_history.txt";
+    std::string commit;
+    std::string filter;
+    int samples = 30;
+    int inner = 50;
+    int threads = 1;
+    int run = 0;      // 0 = the last run
+    int baseline = 0; // 0 = the previous comparable run
+    double min_effect = 2.0; // percent
+};
+
+struct Benchmark
+{
+    std::string name;
+    std::function<void()> fn;
+};
+
+// `git rev-parse` of the working directory, with -dirty for uncommitted changes
+std::string current_commit()
+{
+    auto run = [](const char * command) {
+        std::string out;
+        FILE * pipe = popen(command, "r");
+        if (pipe == nullptr)
+        {
+            return out;
+        }
+        char buffer[128];
+        while (fgets(buffer, sizeof(buffer), pipe) != nullptr)
+        {
+            out += buffer;
+        }
+        pclose(pipe);
+        out.erase(out.find_last_not_of(" \n") + 1);
+        return out;
+    };
+    std::string commit = run("git rev-parse --short HEAD 2>/dev/null");
+    if (commit.empty())
+    {
+        return "unknown";
+    }
+    return run("git status --porcelain --untracked-files=no 2>/dev/null").empty() ? commit : commit + "-dirty";
+}
+
+// FNV-1a over what makes timings of one host comparable to another's
+std::string machine_fingerprint()
+{
+    const std::string id = quantnn::cpu_features().brand + "|" + std::to_string(std::thread::hardware_concurrency()) + "|"
+                           + quantnn::isa_name(quantnn::active_isa()) + "|" + __VERSION__;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (unsigned char c : id)
+    {
+        h = (h ^ c) * 0x100000001b3ULL;
+    }
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(h));
+    return hex;
+}
+
+std::string base_name(const std::string & path)
+{
+    return path.substr(path.find_last_of('/') + 1);
+}
+
+// every engine end to end and every layer in every precision the bundle supports
+std::vector<Benchmark> make_benchmarks(std::shared_ptr<const quantnn::ModelBundle> bundle, const std::string & filter)
+{
+    std::vector<Benchmark> benchmarks;
+    auto reference = std::make_shared<quantnn::MixedEngine>(bundle, LayerPrecisions::uniform(Precision::FP32));
+    const quantnn::MnistNet & net = reference->net();
+    auto conv_out = std::make_shared<std::vector<float>>(net.fc1_in);
+    auto hidden = std::make_shared<std::vector<float>>(net.fc1_out);
+    auto logits = std::make_shared<std::vector<float>>(net.fc2_out);
+    reference->forward_features(data.data(), conv_out->data());
+    reference->linear(Layer::FC1, conv_out->data(), 1, hidden->data(), Precision::FP32);
+    quantnn::relu_f32(hidden->data(), net.fc1_out);
+
+    for (Precision precision : { Precision::FP32, Precision::DynamicInt8, Precision::StaticInt8 })
+    {
+        const std::string prefix = std::string(quantnn::precision_name(precision)) + "/";
+        std::shared_ptr<quantnn::Engine> engine;
+        try
+        {
+            engine = quantnn::make_engine(bundle, precision);
+        }
+        catch (const std::exception &)
+        {
+            continue; // e.g. no calibrated scales for static
+        }
+        benchmarks.push_back({ prefix + "forward", [=] { engine->forward(data.data(), logits->data()); } });
+        if (net.conv)
+        {
+            benchmarks.push_back({ prefix + "conv1", [=] { reference->conv1(data.data(), conv_out->data(), precision); } });
+        }
+        benchmarks.push_back({ prefix + "fc1", [=] { reference->linear(Layer::FC1, conv_out->data(), 1, hidden->data(), precision); } });
+        benchmarks.push_back({ prefix + "fc2", [=] { reference->linear(Layer::FC2, hidden->data(), 1, logits->data(), precision); } });
+    }
+    benchmarks.erase(std::remove_if(benchmarks.begin(), benchmarks.end(),
+                                    [&](const Benchmark & b) { return b.name.find(filter) == std::string::npos; }),
+                     benchmarks.end());
+    return benchmarks;
+}
+
+void measure(std::vector<Benchmark> & benchmarks, const Options & options, PerfRun & run)
+{
+    for (Benchmark & b : benchmarks)
+    {
+        for (int i = 0; i < 20; i++)
+        {
+            b.fn();
+        }
+    }
+    for (int s = 0; s < options.samples; s++)
+    {
+        for (Benchmark & b : benchmarks)
+        {
+            const double start = quantnn::now_us();
+            for (int i = 0; i < options.inner; i++)
+            {
+                b.fn();
+            }
+            run.samples[b.name].push_back((quantnn::now_us() - start) / options.inner);
+        }
+    }
+}
+
+const char * verdict_name(PerfVerdict verdict)
+{
+    switch (verdict)
+    {
+        case PerfVerdict::Slower: return "SLOWER";
+        case PerfVerdict::Faster: return "faster";
+        case PerfVerdict::Same: return "same";
+    }
+    return "";
+}
+
+// prints the comparison of every benchmark both runs have; returns whether any got slower
+bool print_comparison(const PerfRun & baseline, const PerfRun & current, const Options & options)
+{
+    std::cout << "run " << current.id << " (" << current.commit << ") against run " << baseline.id << " (" << baseline.commit
+              << "), 95% bootstrap intervals, min effect " << options.min_effect << "%" << std::endl;
+    printf("%-18s %12s %12s %8s %19s  %s\n", "benchmark", "base[us]", "run[us]", "ratio", "95% CI", "verdict");
+    bool slower = false;
+    for (const auto & kv : current.samples)
+    {
+        auto it = baseline.samples.find(kv.first);
+        if (it == baseline.samples.end() || kv.first.find(options.filter) == std::string::npos)
+        {
+            continue;
+        }
+        const PerfComparison c = quantnn::compare_samples(it->second, kv.second, options.min_effect / 100.0);
+        printf("%-18s %12.2f %12.2f %8.3f   [%6.3f, %6.3f]  %s\n", kv.first.c_str(), quantnn::median_of(it->second),
+               quantnn::median_of(kv.second), c.ratio, c.ratio_lo, c.ratio_hi, verdict_name(c.verdict));
+        slower = slower || c.verdict == PerfVerdict::Slower;
+    }
+    return slower;
+}
+
+const PerfRun * previous_comparable(const PerfHistory & history, const PerfRun & run)
+{
+    const PerfRun * previous = nullptr;
+    for (const PerfRun * r : history.series(run))
+    {
+        if (r->id < run.id)
+        {
+            previous = r;
+        }
+    }
+    return previous;
+}
+
+int record(const Options & options)
+{
+    PerfHistory history;
+    history.load(options.store);
+    quantnn::set_intra_op_threads(options.threads);
+
+    PerfRun run;
+    run.id = history.next_id();
+    run.time = static_cast<int64_t>(time(nullptr));
+    run.commit = options.commit.empty() ? current_commit() : options.commit;
+    run.machine = machine_fingerprint();
+    run.cpu = quantnn::cpu_features().brand;
+    run.config = "model=" + base_name(options.model) + ",threads=" + std::to_string(options.threads)
+                 + ",tuned=" + std::to_string(quantnn::tuning_cache().size()) + ",filter=" + options.filter;
+
+    std::vector<Benchmark> benchmarks = make_benchmarks(quantnn::load_model(options.model), options.filter);
+    std::cout << "run " << run.id << ": commit " << run.commit << ", machine " << run.machine << " (" << run.cpu << ", "
+              << quantnn::isa_name(quantnn::active_isa()) << "), " << benchmarks.size() << " benchmarks x " << options.samples
+              << " samples x " << options.inner << " calls" << std::endl;
+    measure(benchmarks, options, run);
+    PerfHistory::append(options.store, run);
+
+    const PerfRun * baseline = options.baseline > 0 ? history.find(options.baseline) : previous_comparable(history, run);
+    if (baseline == nullptr)
+    {
+        printf("%-18s %12s %19s\n", "benchmark", "median[us]", "95% CI");
+        for (const auto & kv : run.samples)
+        {
+            double lo;
+            double hi;
+            quantnn::bootstrap_median(kv.second, lo, hi);
+            printf("%-18s %12.2f   [%7.2f, %7.2f]\n", kv.first.c_str(), quantnn::median_of(kv.second), lo, hi);
+        }
+        std::cout << "no earlier run on this machine and configuration to compare with" << std::endl;
+        return 0;
+    }
+    return print_comparison(*baseline, run, options) ? 2 : 0;
+}
+
+int compare(const Options & options)
+{
+    PerfHistory history;
+    history.load(options.store);
+    if (history.runs.empty())
+    {
+        std::cerr << "no runs in " << options.store << std::endl;
+        return 1;
+    }
+    const PerfRun * run = options.run > 0 ? history.find(options.run) : &history.runs.back();
+    if (run == nullptr)
+    {
+        std::cerr << "no run " << options.run << " in " << options.store << std::endl;
+        return 1;
+    }
+    const PerfRun * baseline = options.baseline > 0 ? history.find(options.baseline) : previous_comparable(history, *run);
+    if (baseline == nullptr)
+    {
+        std::cerr << "no baseline run to compare run " << run->id << " with" << std::endl;
+        return 1;
+    }
+    if (!baseline->comparable(*run))
+    {
+        std::cerr << "warning: runs " << baseline->id << " and " << run->id << " differ in machine or configuration" << std::endl;
+    }
+    return print_comparison(*baseline, *run, options) ? 2 : 0;
+}
+
+int history_command(const Options & options)
+{
+    PerfHistory history;
+    history.load(options.store);
+    if (history.runs.empty())
+    {
+        std::cerr << "no runs in " << options.store << std::endl;
+        return 1;
+    }
+    const PerfRun * last = options.run > 0 ? history.find(options.run) : &history.runs.back();
+    if (last == nullptr)
+    {
+        std::cerr << "no run " << options.run << " in " << options.store << std::endl;
+        return 1;
+    }
+    const std::vector<const PerfRun *> series = history.series(*last);
+    std::cout << series.size() << " runs on machine " << last->machine << " with " << last->config << std::endl;
+    for (const auto & kv : last->samples)
+    {
+        if (kv.first.find(options.filter) == std::string::npos)
+        {
+            continue;
+        }
+        std::vector<double> medians;
+        std::vector<const PerfRun *> runs;
+        for (const PerfRun * r : series)
+        {
+            auto it = r->samples.find(kv.first);
+            if (it != r->samples.end())
+            {
+                medians.push_back(quantnn::median_of(it->second));
+                runs.push_back(r);
+            }
+        }
+        std::cout << kv.first << ":";
+        for (double m : medians)
+        {
+            printf(" %.1f", m);
+        }
+        std::cout << std::endl;
+        for (const quantnn::ChangePoint & c : quantnn::change_points(medians))
+        {
+            const double change = 100.0 * (c.after / c.before - 1.0);
+            printf("  %s %+.1f%% from run %d (commit %s), %.2f -> %.2f us, p=%.4f\n", change > 0 ? "SLOWER" : "faster", change,
+                   runs[c.index]->id, runs[c.index]->commit.c_str(), c.before, c.after, c.p_value);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i == 1 && (arg == "record" || arg == "compare" || arg == "history"))
+        {
+            options.command = arg;
+        }
+        else if (arg == "--model" && i + 1 < argc)
+        {
+            options.model = argv[++i];
+        }
+        else if (arg == "--store" && i + 1 < argc)
+        {
+            options.store = argv[++i];
+        }
+        else if (arg == "--commit" && i + 1 < argc)
+        {
+            options.commit = argv[++i];
+        }
+        else if (arg == "--filter" && i + 1 < argc)
+        {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--samples" && i + 1 < argc)
+        {
+            options.samples = std::max(2, atoi(argv[++i]));
+        }
+        else if (arg == "--inner" && i + 1 < argc)
+        {
+            options.inner = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            options.threads = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--run" && i + 1 < argc)
+        {
+            options.run = atoi(argv[++i]);
+        }
+        else if (arg == "--baseline" && i + 1 < argc)
+        {
+            options.baseline = atoi(argv[++i]);
+        }
+        else if (arg == "--min-effect" && i + 1 < argc)
+        {
+            options.min_effect = atof(argv[++i]);
+        }
+        else
+        {
+            options.command.clear();
+            break;
+        }
+    }
+    if (options.command.empty())
+    {
+        std::cerr << "usage: " << argv[0] << " record|compare|history [--store perf_history.txt] [--filter static]\n"
+                  << "  record:  [--model models/mnist_conv.qnn] [--threads 1] [--samples 30] [--inner 50] [--commit SHA] [--baseline ID]\n"
+                  << "  compare: [--run ID] [--baseline ID] [--min-effect 2]\n"
+                  << "  history: [--run ID]" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        if (options.command == "record")
+        {
+            return record(options);
+        }
+        if (options.command == "compare")
+        {
+            return compare(options);
+        }
+        return history_command(options);
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
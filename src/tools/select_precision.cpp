@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/bench.h"
+#include "common/mnist_data.h"
+#include "engine/mixed_engine.h"
+#include "engine/reparameterize.h"
+
+// Picks a precision per layer (fp32, dynamic or static int8) for a model bundle:
+//   1. times every layer in every precision on its own (batch 1, median)
+//   2. measures the top-1 drop on the held-out images when only that layer is
+//      quantized, the others staying fp32
+//   3. ranks every assignment by the sum of its layer latencies, skips those whose
+//      summed drops exceed the budget, and measures the real drop of the rest in
+//      order until one stays within --budget
+// The first MNIST test images (--holdout) are used for the selection and the
+// remaining ones to report the accuracy of the result. The assignment is written
+// to --out, which inference_server runs with --layer-config.
+
+using quantnn::Layer;
+using quantnn::LayerPrecisions;
+using quantnn::MixedEngine;
+using quantnn::Precision;
+
+constexpr Precision kPrecisions[] = { Precision::FP32, Precision::DynamicInt8, Precision::StaticInt8 };
+
+struct Options
+{
+    std::string model = "models/mnist_conv.qnn";
+    std::string data = "pytorch/data/MNIST/raw";
+    std::string out = "mixed_precision.cfg";
+    double budget = 0.5; // allowed top-1 drop in percentage points
+    int holdout = 5000;
+    int reps = 300;
+};
+
+struct Dataset
+{
+    const float * images;
+    const uint8_t * labels;
+    int count;
+};
+
+double accuracy(const MixedEngine & engine, const Dataset & set)
+{
+    const int batch = 64;
+    const int outputs = engine.output_dim();
+    std::vector<float> logits (static_cast<size_t>(batch) * outputs);
+    int correct = 0;
+    for (int start = 0; start < set.count; start += batch)
+    {
+        int n = std::min(batch, set.count - start);
+        engine.forward_batch(&set.images[static_cast<size_t>(start) * quantnn::Engine::input_dim], n, logits.data());
+        for (int b = 0; b < n; b++)
+        {
+            correct += quantnn::argmax(&logits[b * outputs], outputs) == set.labels[start + b];
+        }
+    }
+    return 100.0 * correct / set.count;
+}
+
+template <typename Fn>
+double median_us(Fn && fn, int reps)
+{
+    for (int i = 0; i < 20; i++)
+    {
+        fn();
+    }
+    std::vector<double> samples (reps);
+    for (int i = 0; i < reps; i++)
+    {
+        double start = quantnn::now_us();
+        fn();
+        samples[i] = quantnn::now_us() - start;
+    }
+    return quantnn::summarize(samples).median;
+}
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--model" && i + 1 < argc)
+        {
+            options.model = argv[++i];
+        }
+        else if (arg == "--data" && i + 1 < argc)
+        {
+            options.data = argv[++i];
+        }
+        else if (arg == "--out" && i + 1 < argc)
+        {
+            options.out = argv[++i];
+        }
+        else if (arg == "--budget" && i + 1 < argc)
+        {
+            options.budget = atof(argv[++i]);
+        }
+        else if (arg == "--holdout" && i + 1 < argc)
+        {
+            options.holdout = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--reps" && i + 1 < argc)
+        {
+            options.reps = std::max(1, atoi(argv[++i]));
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--model models/mnist_conv.qnn] [--data pytorch/data/MNIST/raw]"
+                      << " [--budget 0.5] [--holdout 5000] [--reps 300] [--out mixed_precision.cfg]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::shared_ptr<const quantnn::ModelBundle> bundle;
+    quantnn::MnistSet test;
+    try
+    {
+        bundle = quantnn::load_model(options.model);
+        test = quantnn::load_mnist(options.data, "t10k");
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    std::vector<float> images = test.normalized();
+    const int holdout = std::min(options.holdout, test.count);
+    Dataset select_set { images.data(), test.labels.data(), holdout };
+    Dataset report_set { images.data() + static_cast<size_t>(holdout) * quantnn::Engine::input_dim,
+                         test.labels.data() + holdout, test.count - holdout };
+
+    MixedEngine reference(bundle, LayerPrecisions::uniform(Precision::FP32));
+    const quantnn::MnistNet & net = reference.net();
+    std::vector<Layer> layers;
+    if (net.conv)
+    {
+        layers.push_back(Layer::Conv1);
+    }
+    layers.push_back(Layer::FC1);
+    layers.push_back(Layer::FC2);
+
+    // representative inputs of every layer, from the first image
+    std::vector<float> conv_out (net.fc1_in), hidden (net.fc1_out), logits (net.fc2_out);
+    reference.forward_features(images.data(), conv_out.data());
+    reference.linear(Layer::FC1, conv_out.data(), 1, hidden.data(), Precision::FP32);
+    quantnn::relu_f32(hidden.data(), net.fc1_out);
+
+    const double base_accuracy = accuracy(reference, select_set);
+    double latency[quantnn::kLayerCount][3] = {};
+    double drop[quantnn::kLayerCount][3] = {};
+    bool available[quantnn::kLayerCount][3] = {};
+
+    std::cout << reference.name() << ": fp32 top-1 " << base_accuracy << "% on " << holdout
+              << " held-out images, budget " << options.budget << " points" << std::endl;
+    printf("%-6s %-8s %12s %12s\n", "layer", "prec", "latency[us]", "drop[pts]");
+    for (Layer layer : layers)
+    {
+        const int l = static_cast<int>(layer);
+        for (int p = 0; p < 3; p++)
+        {
+            Precision precision = kPrecisions[p];
+            try
+            {
+                reference.check(layer, precision);
+            }
+            catch (const std::exception &)
+            {
+                continue;
+            }
+            available[l][p] = true;
+            switch (layer)
+            {
+                case Layer::Conv1:
+                    latency[l][p] = median_us([&] { reference.conv1(images.data(), conv_out.data(), precision); }, options.reps);
+                    break;
+                case Layer::FC1:
+                    latency[l][p] = median_us([&] { reference.linear(layer, conv_out.data(), 1, hidden.data(), precision); }, options.reps);
+                    break;
+                case Layer::FC2:
+                    latency[l][p] = median_us([&] { reference.linear(layer, hidden.data(), 1, logits.data(), precision); }, options.reps);
+                    break;
+            }
+            if (precision != Precision::FP32)
+            {
+                LayerPrecisions single;
+                single[layer] = precision;
+                drop[l][p] = base_accuracy - accuracy(MixedEngine(bundle, single), select_set);
+            }
+            printf("%-6s %-8s %12.2f %12.2f\n", quantnn::layer_name(layer), quantnn::precision_name(precision),
+                   latency[l][p], drop[l][p]);
+        }
+    }
+    for (Layer layer : layers)
+    {
+        if (!available[static_cast<int>(layer)][0])
+        {
+            std::cerr << "the bundle has no fp32 " << quantnn::layer_name(layer) << " weights to measure the drop against" << std::endl;
+            return 1;
+        }
+    }
+
+    // every assignment with its predicted latency and drop
+    struct Candidate
+    {
+        LayerPrecisions precisions;
+        double latency = 0.0;
+        double drop = 0.0;
+    };
+    std::vector<Candidate> candidates { Candidate {} };
+    for (Layer layer : layers)
+    {
+        const int l = static_cast<int>(layer);
+        std::vector<Candidate> next;
+        for (const Candidate & c : candidates)
+        {
+            for (int p = 0; p < 3; p++)
+            {
+                if (available[l][p])
+                {
+                    Candidate n = c;
+                    n.precisions[layer] = kPrecisions[p];
+                    n.latency += latency[l][p];
+                    n.drop += drop[l][p];
+                    next.push_back(n);
+                }
+            }
+        }
+        candidates = next;
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate & a, const Candidate & b) { return a.latency < b.latency; });
+
+    Candidate chosen;
+    double chosen_drop = 0.0;
+    std::cout << "checking assignments, fastest first:" << std::endl;
+    for (const Candidate & c : candidates)
+    {
+        if (c.drop > options.budget)
+        {
+            continue;
+        }
+        double measured = base_accuracy - accuracy(MixedEngine(bundle, c.precisions), select_set);
+        printf("  %-40s predicted %8.2f us, drop %5.2f predicted / %5.2f measured\n", c.precisions.to_string().c_str(),
+               c.latency, c.drop, measured);
+        if (measured <= options.budget)
+        {
+            chosen = c;
+            chosen_drop = measured;
+            break;
+        }
+    }
+
+    // end-to-end comparison on the remaining images
+    MixedEngine mixed(bundle, chosen.precisions);
+    std::vector<float> out (net.fc2_out);
+    double e2e_mixed = median_us([&] { mixed.forward(images.data(), out.data()); }, options.reps);
+    double e2e_fp32 = median_us([&] { reference.forward(images.data(), out.data()); }, options.reps);
+    std::cout << "chosen: " << chosen.precisions.to_string() << std::endl;
+    printf("latency %.2f us (fp32 %.2f us), held-out drop %.2f points", e2e_mixed, e2e_fp32, chosen_drop);
+    if (report_set.count > 0)
+    {
+        printf(", top-1 on the other %d images %.2f%% (fp32 %.2f%%)", report_set.count, accuracy(mixed, report_set),
+               accuracy(reference, report_set));
+    }
+    printf("\n");
+
+    char comment[256];
+    snprintf(comment, sizeof(comment), "%s, top-1 drop %.2f points (budget %.2f) on %d held-out images",
+             options.model.c_str(), chosen_drop, options.budget, holdout);
+    try
+    {
+        chosen.precisions.save(options.out, comment);
+    }
+    catch (const std::exception & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    std::cout << "wrote " << options.out << std::endl;
+    return 0;
+}